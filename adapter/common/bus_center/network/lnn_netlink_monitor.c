@@ -159,7 +159,8 @@ static void ProcessAddrEvent(struct nlmsghdr *nlh)
     static uint32_t callCount = 0;
     if (type == LNN_NETIF_TYPE_ETH || type == LNN_NETIF_TYPE_WLAN) {
         LNN_LOGI(LNN_EVENT, "network addr changed, ifName=%{public}s, netifType=%{public}d, callCount=%{public}u",
-            ifName, type, callCount++);
+            ifName, type, callCount);
+        callCount++;
         LnnNotifyAddressChangedEvent(ifName);
     }
 }
@@ -196,7 +197,8 @@ static void ProcessLinkEvent(struct nlmsghdr *nlh)
     static uint32_t callCount = 0;
     if (type == LNN_NETIF_TYPE_ETH || type == LNN_NETIF_TYPE_WLAN) {
         LNN_LOGI(LNN_BUILDER, "link status changed, IFLA_IFNAME=%{public}s, netifType=%{public}d, callCount=%{public}u",
-            (const char *)RTA_DATA(tb[IFLA_IFNAME]), type, callCount++);
+            (const char *)RTA_DATA(tb[IFLA_IFNAME]), type, callCount);
+        callCount++;
         LnnNotifyAddressChangedEvent((const char *)RTA_DATA(tb[IFLA_IFNAME]));
     }
 }
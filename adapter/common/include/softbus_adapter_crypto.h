@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -94,6 +94,20 @@ int32_t SoftBusDecryptData(AesGcmCipherKey *key, const unsigned char *input, uin
 int32_t SoftBusDecryptDataWithSeq(AesGcmCipherKey *cipherKey, const unsigned char *input, uint32_t inLen,
     unsigned char *encryptData, uint32_t *encryptLen, int32_t seqNum);
 
+/* AES-GCM context holding a prepared key schedule, not thread safe, one user at a time. */
+typedef struct SoftBusGcmCipherCtx SoftBusGcmCipherCtx;
+
+SoftBusGcmCipherCtx *SoftBusCreateGcmCipherCtx(const unsigned char *key, uint32_t keyLen);
+
+void SoftBusDestroyGcmCipherCtx(SoftBusGcmCipherCtx *cipherCtx);
+
+/* same output as SoftBusEncryptDataWithSeq with the key of cipherCtx */
+int32_t SoftBusEncryptDataWithCtx(SoftBusGcmCipherCtx *cipherCtx, const unsigned char *input, uint32_t inLen,
+    unsigned char *encryptData, uint32_t *encryptLen, int32_t seqNum);
+
+int32_t SoftBusDecryptDataWithCtx(SoftBusGcmCipherCtx *cipherCtx, const unsigned char *input, uint32_t inLen,
+    unsigned char *decryptData, uint32_t *decryptLen);
+
 uint32_t SoftBusCryptoRand(void);
 
 int32_t SoftBusEncryptDataByCtr(AesCtrCipherKey *key, const unsigned char *input, uint32_t inLen,
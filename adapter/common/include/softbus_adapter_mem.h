@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,8 @@
 #ifndef SOFTBUS_ADAPTER_MEM_H
 #define SOFTBUS_ADAPTER_MEM_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 #if __cplusplus
 extern "C" {
@@ -29,6 +31,36 @@ void *SoftBusCalloc(unsigned int size);
 void SoftBusFree(void *pt);
 void SoftBusClearFree(void *pt, unsigned int size);
 
+typedef enum {
+    SOFTBUS_MEM_MODULE_COMMON = 0,
+    SOFTBUS_MEM_MODULE_AUTH,
+    SOFTBUS_MEM_MODULE_LNN,
+    SOFTBUS_MEM_MODULE_CONN,
+    SOFTBUS_MEM_MODULE_DISC,
+    SOFTBUS_MEM_MODULE_TRANS,
+    SOFTBUS_MEM_MODULE_SDK,
+    SOFTBUS_MEM_MODULE_BUTT,
+} SoftBusMemModule;
+
+typedef struct {
+    uint64_t usedBytes;
+    uint64_t usedCount;
+    uint64_t peakBytes;
+    uint64_t totalCount;
+} SoftBusMemStat;
+
+/*
+ * Per module accounting only works when the size class allocator is enabled (DSOFTBUS_FEATURE_MEM_SLAB),
+ * otherwise the module is ignored and SoftBusGetMemStat returns SOFTBUS_NOT_IMPLEMENT.
+ */
+// tags the following allocations of the calling thread, returns the previous module of the thread.
+SoftBusMemModule SoftBusSetMemModule(SoftBusMemModule module);
+void *SoftBusMallocByModule(SoftBusMemModule module, unsigned int size);
+void *SoftBusCallocByModule(SoftBusMemModule module, unsigned int size);
+int32_t SoftBusGetMemStat(SoftBusMemModule module, SoftBusMemStat *stat);
+// gives the arena pages of the size classes back to the OS where no block of them is in use.
+void SoftBusMemTrim(void);
+
 #ifdef __cplusplus
 #if __cplusplus
 }
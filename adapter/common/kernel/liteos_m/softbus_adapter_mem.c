@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -17,6 +17,8 @@
 
 #include <securec.h>
 
+#include "softbus_error_code.h"
+
 #if defined(OHOS_MEM)
 #include "ohos_mem_pool.h"
 #endif
@@ -69,4 +71,33 @@ void SoftBusClearFree(void *pt, unsigned int size)
     }
     (void)memset_s(pt, size, 0, size);
     SoftBusFree(pt);
-}
\ No newline at end of file
+}
+
+void *SoftBusMallocByModule(SoftBusMemModule module, unsigned int size)
+{
+    (void)module;
+    return SoftBusMalloc(size);
+}
+
+void *SoftBusCallocByModule(SoftBusMemModule module, unsigned int size)
+{
+    (void)module;
+    return SoftBusCalloc(size);
+}
+
+SoftBusMemModule SoftBusSetMemModule(SoftBusMemModule module)
+{
+    (void)module;
+    return SOFTBUS_MEM_MODULE_COMMON;
+}
+
+int32_t SoftBusGetMemStat(SoftBusMemModule module, SoftBusMemStat *stat)
+{
+    (void)module;
+    (void)stat;
+    return SOFTBUS_NOT_IMPLEMENT;
+}
+
+void SoftBusMemTrim(void)
+{
+}
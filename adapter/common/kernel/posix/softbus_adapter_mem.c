@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,7 +16,497 @@
 #include "softbus_adapter_mem.h"
 
 #include <securec.h>
+#include <stdlib.h>
+
+#include "softbus_error_code.h"
+
+#ifdef DSOFTBUS_FEATURE_MEM_SLAB
+#include <pthread.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <sys/mman.h>
+
+#define MEM_BLOCK_MAGIC       0x5B1Bu
+#define MEM_BLOCK_FREE_MAGIC  0xDEADu
+#define MEM_MIN_CLASS_SHIFT   5 // 32 bytes
+#define MEM_SIZE_CLASS_NUM    8 // 32 bytes ~ 4k
+#define MEM_LARGE_CLASS       0xFF
+#define MEM_CACHE_MAX_BLOCKS  64
+#define MEM_ARENA_SIZE        (64 * 1024 * 1024) // address space only, pages are committed on first use
+#define MEM_SPAN_SIZE         (64 * 1024)
+#define MEM_SPAN_NUM          (MEM_ARENA_SIZE / MEM_SPAN_SIZE)
+#define MEM_SPAN_RELEASING    0xFFFFu
+#define MEM_LARGE_BUCKET_NUM  256 // must be a power of 2
+#define MEM_LARGE_HASH_SHIFT  4
+
+/*
+ * size class blocks are carved from one reserved arena, so SoftBusFree tells them apart by address and never reads
+ * memory in front of a foreign pointer. every block starts with this head, the payload behind it keeps 16 bytes
+ * alignment.
+ */
+typedef struct {
+    uint32_t size;
+    uint16_t magic;
+    uint8_t sizeClass;
+    uint8_t module;
+    uint64_t reserved;
+} MemBlockHead;
+
+typedef struct MemFreeBlock {
+    struct MemFreeBlock *next;
+} MemFreeBlock;
+
+typedef struct {
+    MemFreeBlock *head;
+    uint32_t count;
+} MemFreeList;
+
+/* blocks above the largest class, and class blocks once the arena is used up, come from malloc and live here */
+typedef struct MemLargeNode {
+    struct MemLargeNode *next;
+    void *ptr;
+    uint32_t size;
+    uint8_t module;
+} MemLargeNode;
+
+/* each bucket has its own lock, so large blocks and foreign frees on different buckets do not wait on each other */
+typedef struct {
+    pthread_mutex_t lock;
+    MemLargeNode *head;
+} MemLargeBucket;
+
+typedef struct {
+    atomic_uint_fast64_t usedBytes;
+    atomic_uint_fast64_t usedCount;
+    atomic_uint_fast64_t peakBytes;
+    atomic_uint_fast64_t totalCount;
+} MemModuleStat;
+
+static __thread MemFreeList g_threadCache[MEM_SIZE_CLASS_NUM];
+static __thread bool g_threadCacheRegistered = false;
+static __thread uint8_t g_threadModule = SOFTBUS_MEM_MODULE_COMMON;
+
+static MemFreeList g_depot[MEM_SIZE_CLASS_NUM];
+static pthread_mutex_t g_depotLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t g_threadCacheKey;
+static pthread_once_t g_threadCacheOnce = PTHREAD_ONCE_INIT;
+static bool g_threadCacheKeyValid = false;
+static MemModuleStat g_memStat[SOFTBUS_MEM_MODULE_BUTT];
+
+static pthread_once_t g_arenaOnce = PTHREAD_ONCE_INIT;
+static atomic_uintptr_t g_arenaBase = 0;
+static atomic_uintptr_t g_arenaSize = 0;
+static atomic_uintptr_t g_arenaUsed = 0;
+static uint16_t g_spanDepotNum[MEM_SPAN_NUM]; // blocks of each span sitting in the depot, under g_depotLock
+static uint8_t g_spanClass[MEM_SPAN_NUM];
+static uint32_t g_releasedSpan[MEM_SPAN_NUM]; // spans given back to the OS and not carved again, under g_depotLock
+static atomic_uint_fast32_t g_releasedSpanNum = 0;
+
+static pthread_once_t g_largeOnce = PTHREAD_ONCE_INIT;
+static MemLargeBucket g_largeBucket[MEM_LARGE_BUCKET_NUM];
+static atomic_uint_fast64_t g_largeCount = 0;
+
+static void ReserveArena(void)
+{
+    void *base = mmap(NULL, MEM_ARENA_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_NORESERVE,
+        -1, 0);
+    if (base == MAP_FAILED) {
+        // every block goes to malloc then
+        return;
+    }
+    atomic_store_explicit(&g_arenaBase, (uintptr_t)base, memory_order_relaxed);
+    atomic_store_explicit(&g_arenaSize, MEM_ARENA_SIZE, memory_order_release);
+}
+
+static inline bool IsSlabBlock(const void *pt)
+{
+    uintptr_t size = atomic_load_explicit(&g_arenaSize, memory_order_acquire);
+    uintptr_t base = atomic_load_explicit(&g_arenaBase, memory_order_relaxed);
+    /* the first bytes of the arena belong to a head, no block payload starts there */
+    return size != 0 && (uintptr_t)pt - base - sizeof(MemBlockHead) < size - sizeof(MemBlockHead);
+}
+
+static inline uint32_t ClassToSize(uint8_t sizeClass)
+{
+    return 1u << (sizeClass + MEM_MIN_CLASS_SHIFT);
+}
+
+static inline uint8_t SizeToClass(unsigned int size)
+{
+    if (size <= (1u << MEM_MIN_CLASS_SHIFT)) {
+        return 0;
+    }
+    uint32_t shift = (uint32_t)(sizeof(unsigned int) * 8) - (uint32_t)__builtin_clz(size - 1);
+    uint32_t sizeClass = shift - MEM_MIN_CLASS_SHIFT;
+    return sizeClass < MEM_SIZE_CLASS_NUM ? (uint8_t)sizeClass : MEM_LARGE_CLASS;
+}
+
+static void AccountAlloc(uint8_t module, uint32_t size)
+{
+    MemModuleStat *stat = &g_memStat[module];
+    uint64_t used = atomic_fetch_add_explicit(&stat->usedBytes, size, memory_order_relaxed) + size;
+    atomic_fetch_add_explicit(&stat->usedCount, 1, memory_order_relaxed);
+    atomic_fetch_add_explicit(&stat->totalCount, 1, memory_order_relaxed);
+    uint64_t peak = atomic_load_explicit(&stat->peakBytes, memory_order_relaxed);
+    while (used > peak &&
+        !atomic_compare_exchange_weak_explicit(&stat->peakBytes, &peak, used, memory_order_relaxed,
+        memory_order_relaxed)) {
+    }
+}
+
+static void AccountFree(uint8_t module, uint32_t size)
+{
+    MemModuleStat *stat = &g_memStat[module];
+    atomic_fetch_sub_explicit(&stat->usedBytes, size, memory_order_relaxed);
+    atomic_fetch_sub_explicit(&stat->usedCount, 1, memory_order_relaxed);
+}
+
+static inline uint32_t LargeBucketIndex(const void *pt)
+{
+    return (uint32_t)(((uintptr_t)pt >> MEM_LARGE_HASH_SHIFT) & (MEM_LARGE_BUCKET_NUM - 1));
+}
+
+static void InitLargeBuckets(void)
+{
+    for (uint32_t i = 0; i < MEM_LARGE_BUCKET_NUM; i++) {
+        (void)pthread_mutex_init(&g_largeBucket[i].lock, NULL);
+        g_largeBucket[i].head = NULL;
+    }
+}
+
+static void *AllocLarge(uint8_t module, unsigned int size)
+{
+    MemLargeNode *node = (MemLargeNode *)malloc(sizeof(MemLargeNode));
+    if (node == NULL) {
+        return NULL;
+    }
+    void *pt = malloc(size);
+    if (pt == NULL) {
+        free(node);
+        return NULL;
+    }
+    node->ptr = pt;
+    node->size = size;
+    node->module = module;
+    (void)pthread_once(&g_largeOnce, InitLargeBuckets);
+    MemLargeBucket *bucket = &g_largeBucket[LargeBucketIndex(pt)];
+    (void)pthread_mutex_lock(&bucket->lock);
+    node->next = bucket->head;
+    bucket->head = node;
+    (void)pthread_mutex_unlock(&bucket->lock);
+    atomic_fetch_add_explicit(&g_largeCount, 1, memory_order_release);
+    AccountAlloc(module, size);
+    return pt;
+}
+
+/* takes the large block out of the table, returns false when SoftBusMalloc never handed it out */
+static bool FreeLarge(void *pt)
+{
+    /* a live large block is counted before its pointer is handed out, so no count means a foreign pointer */
+    if (atomic_load_explicit(&g_largeCount, memory_order_acquire) == 0) {
+        return false;
+    }
+    MemLargeNode *node = NULL;
+    MemLargeBucket *bucket = &g_largeBucket[LargeBucketIndex(pt)];
+    (void)pthread_mutex_lock(&bucket->lock);
+    MemLargeNode **prev = &bucket->head;
+    while (*prev != NULL) {
+        if ((*prev)->ptr == pt) {
+            node = *prev;
+            *prev = node->next;
+            break;
+        }
+        prev = &(*prev)->next;
+    }
+    (void)pthread_mutex_unlock(&bucket->lock);
+    if (node == NULL) {
+        return false;
+    }
+    atomic_fetch_sub_explicit(&g_largeCount, 1, memory_order_relaxed);
+    AccountFree(node->module, node->size);
+    free(node);
+    free(pt);
+    return true;
+}
+
+static inline uint32_t SpanIndex(const void *block)
+{
+    return (uint32_t)(((uintptr_t)block - atomic_load_explicit(&g_arenaBase, memory_order_relaxed)) / MEM_SPAN_SIZE);
+}
+
+static inline uint32_t SpanBlockNum(uint8_t sizeClass)
+{
+    return MEM_SPAN_SIZE / ((uint32_t)sizeof(MemBlockHead) + ClassToSize(sizeClass));
+}
+
+/* the depot helpers are called with g_depotLock held */
+static void DepotPush(uint8_t sizeClass, MemFreeBlock *block)
+{
+    block->next = g_depot[sizeClass].head;
+    g_depot[sizeClass].head = block;
+    g_depot[sizeClass].count++;
+    g_spanDepotNum[SpanIndex(block)]++;
+}
+
+static MemFreeBlock *DepotPop(uint8_t sizeClass)
+{
+    MemFreeBlock *block = g_depot[sizeClass].head;
+    if (block != NULL) {
+        g_depot[sizeClass].head = block->next;
+        g_depot[sizeClass].count--;
+        g_spanDepotNum[SpanIndex(block)]--;
+    }
+    return block;
+}
+
+/* the blocks of a dying thread go to the depot for other threads */
+static void FlushThreadCache(void *arg)
+{
+    (void)arg;
+    (void)pthread_mutex_lock(&g_depotLock);
+    for (uint8_t i = 0; i < MEM_SIZE_CLASS_NUM; i++) {
+        MemFreeList *cache = &g_threadCache[i];
+        while (cache->head != NULL) {
+            MemFreeBlock *block = cache->head;
+            cache->head = block->next;
+            DepotPush(i, block);
+        }
+        cache->count = 0;
+    }
+    (void)pthread_mutex_unlock(&g_depotLock);
+}
+
+static void CreateThreadCacheKey(void)
+{
+    g_threadCacheKeyValid = (pthread_key_create(&g_threadCacheKey, FlushThreadCache) == 0);
+}
+
+static void RegisterThreadCache(void)
+{
+    (void)pthread_once(&g_threadCacheOnce, CreateThreadCacheKey);
+    if (g_threadCacheKeyValid) {
+        (void)pthread_setspecific(g_threadCacheKey, (void *)g_threadCache);
+    }
+    g_threadCacheRegistered = true;
+}
+
+static void RefillThreadCache(uint8_t sizeClass)
+{
+    MemFreeList *cache = &g_threadCache[sizeClass];
+    (void)pthread_mutex_lock(&g_depotLock);
+    while (g_depot[sizeClass].head != NULL && cache->count < MEM_CACHE_MAX_BLOCKS / 2) {
+        MemFreeBlock *block = DepotPop(sizeClass);
+        block->next = cache->head;
+        cache->head = block;
+        cache->count++;
+    }
+    (void)pthread_mutex_unlock(&g_depotLock);
+}
+
+static bool TakeReleasedSpan(uintptr_t *offset)
+{
+    if (atomic_load_explicit(&g_releasedSpanNum, memory_order_relaxed) == 0) {
+        return false;
+    }
+    bool found = false;
+    (void)pthread_mutex_lock(&g_depotLock);
+    uint32_t num = (uint32_t)atomic_load_explicit(&g_releasedSpanNum, memory_order_relaxed);
+    if (num != 0) {
+        *offset = (uintptr_t)g_releasedSpan[num - 1] * MEM_SPAN_SIZE;
+        atomic_store_explicit(&g_releasedSpanNum, num - 1, memory_order_relaxed);
+        found = true;
+    }
+    (void)pthread_mutex_unlock(&g_depotLock);
+    return found;
+}
+
+/* cuts a new span, or one given back by SoftBusMemTrim, off the arena into blocks of the class */
+static bool CarveSpan(uint8_t sizeClass)
+{
+    (void)pthread_once(&g_arenaOnce, ReserveArena);
+    uintptr_t arenaSize = atomic_load_explicit(&g_arenaSize, memory_order_acquire);
+    uintptr_t offset = 0;
+    if (!TakeReleasedSpan(&offset)) {
+        offset = atomic_fetch_add_explicit(&g_arenaUsed, MEM_SPAN_SIZE, memory_order_relaxed);
+        if (offset >= arenaSize || arenaSize - offset < MEM_SPAN_SIZE) {
+            return false;
+        }
+    }
+    if (!g_threadCacheRegistered) {
+        RegisterThreadCache();
+    }
+    g_spanClass[offset / MEM_SPAN_SIZE] = sizeClass;
+    uint8_t *span = (uint8_t *)atomic_load_explicit(&g_arenaBase, memory_order_relaxed) + offset;
+    uint32_t stride = (uint32_t)sizeof(MemBlockHead) + ClassToSize(sizeClass);
+    MemFreeList *cache = &g_threadCache[sizeClass];
+    for (uint32_t pos = 0; pos + stride <= MEM_SPAN_SIZE; pos += stride) {
+        MemBlockHead *head = (MemBlockHead *)(span + pos);
+        head->magic = MEM_BLOCK_FREE_MAGIC;
+        head->sizeClass = sizeClass;
+        MemFreeBlock *block = (MemFreeBlock *)(head + 1);
+        block->next = cache->head;
+        cache->head = block;
+        cache->count++;
+    }
+    return true;
+}
+
+static void DrainThreadCache(uint8_t sizeClass)
+{
+    MemFreeList *cache = &g_threadCache[sizeClass];
+    (void)pthread_mutex_lock(&g_depotLock);
+    while (cache->count > MEM_CACHE_MAX_BLOCKS / 2) {
+        MemFreeBlock *block = cache->head;
+        cache->head = block->next;
+        cache->count--;
+        DepotPush(sizeClass, block);
+    }
+    (void)pthread_mutex_unlock(&g_depotLock);
+}
+
+static MemBlockHead *AllocBlock(uint8_t sizeClass)
+{
+    MemFreeList *cache = &g_threadCache[sizeClass];
+    if (cache->head == NULL) {
+        RefillThreadCache(sizeClass);
+    }
+    if (cache->head == NULL && !CarveSpan(sizeClass)) {
+        return NULL;
+    }
+    MemFreeBlock *block = cache->head;
+    cache->head = block->next;
+    cache->count--;
+    return (MemBlockHead *)block - 1;
+}
+
+static void FreeBlock(MemBlockHead *head)
+{
+    if (!g_threadCacheRegistered) {
+        RegisterThreadCache();
+    }
+    MemFreeList *cache = &g_threadCache[head->sizeClass];
+    MemFreeBlock *block = (MemFreeBlock *)(head + 1);
+    block->next = cache->head;
+    cache->head = block;
+    cache->count++;
+    if (cache->count > MEM_CACHE_MAX_BLOCKS) {
+        DrainThreadCache(head->sizeClass);
+    }
+}
 
+void *SoftBusMalloc(unsigned int size)
+{
+    if (size > MAX_MALLOC_SIZE) {
+        return NULL;
+    }
+    uint8_t module = g_threadModule;
+    uint8_t sizeClass = SizeToClass(size);
+    MemBlockHead *head = (sizeClass == MEM_LARGE_CLASS) ? NULL : AllocBlock(sizeClass);
+    if (head == NULL) {
+        return AllocLarge(module, size);
+    }
+    head->size = size;
+    head->magic = MEM_BLOCK_MAGIC;
+    head->module = module;
+    AccountAlloc(module, size);
+    return head + 1;
+}
+
+void SoftBusFree(void *pt)
+{
+    if (pt == NULL) {
+        return;
+    }
+    if (!IsSlabBlock(pt)) {
+        if (!FreeLarge(pt)) {
+            // not allocated by SoftBusMalloc, such as memory returned by a third party library
+            free(pt);
+        }
+        return;
+    }
+    MemBlockHead *head = (MemBlockHead *)pt - 1;
+    if (head->magic != MEM_BLOCK_MAGIC) {
+        // double free or a pointer into the middle of a block, fail as loud as libc would
+        abort();
+    }
+    head->magic = MEM_BLOCK_FREE_MAGIC;
+    AccountFree(head->module, head->size);
+    FreeBlock(head);
+}
+
+SoftBusMemModule SoftBusSetMemModule(SoftBusMemModule module)
+{
+    SoftBusMemModule prev = (SoftBusMemModule)g_threadModule;
+    if (module >= SOFTBUS_MEM_MODULE_COMMON && module < SOFTBUS_MEM_MODULE_BUTT) {
+        g_threadModule = (uint8_t)module;
+    }
+    return prev;
+}
+
+int32_t SoftBusGetMemStat(SoftBusMemModule module, SoftBusMemStat *stat)
+{
+    if (module < SOFTBUS_MEM_MODULE_COMMON || module >= SOFTBUS_MEM_MODULE_BUTT || stat == NULL) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    stat->usedBytes = atomic_load_explicit(&g_memStat[module].usedBytes, memory_order_relaxed);
+    stat->usedCount = atomic_load_explicit(&g_memStat[module].usedCount, memory_order_relaxed);
+    stat->peakBytes = atomic_load_explicit(&g_memStat[module].peakBytes, memory_order_relaxed);
+    stat->totalCount = atomic_load_explicit(&g_memStat[module].totalCount, memory_order_relaxed);
+    return SOFTBUS_OK;
+}
+
+/* unlinks the depot blocks of the spans marked MEM_SPAN_RELEASING, called with g_depotLock held */
+static void UnlinkReleasingBlocks(void)
+{
+    for (uint8_t i = 0; i < MEM_SIZE_CLASS_NUM; i++) {
+        MemFreeBlock **prev = &g_depot[i].head;
+        while (*prev != NULL) {
+            if (g_spanDepotNum[SpanIndex(*prev)] == MEM_SPAN_RELEASING) {
+                *prev = (*prev)->next;
+                g_depot[i].count--;
+            } else {
+                prev = &(*prev)->next;
+            }
+        }
+    }
+}
+
+void SoftBusMemTrim(void)
+{
+    uintptr_t arenaSize = atomic_load_explicit(&g_arenaSize, memory_order_acquire);
+    if (arenaSize == 0) {
+        return;
+    }
+    if (g_threadCacheRegistered) {
+        FlushThreadCache(NULL);
+    }
+    (void)pthread_mutex_lock(&g_depotLock);
+    uintptr_t used = atomic_load_explicit(&g_arenaUsed, memory_order_relaxed);
+    uint32_t spanNum = (uint32_t)(((used < arenaSize) ? used : arenaSize) / MEM_SPAN_SIZE);
+    bool found = false;
+    // a span is free only when every block of it sits in the depot, no thread cache or caller holds one
+    for (uint32_t i = 0; i < spanNum; i++) {
+        if (g_spanDepotNum[i] != 0 && g_spanDepotNum[i] == SpanBlockNum(g_spanClass[i])) {
+            g_spanDepotNum[i] = MEM_SPAN_RELEASING;
+            found = true;
+        }
+    }
+    if (found) {
+        UnlinkReleasingBlocks();
+    }
+    uint8_t *base = (uint8_t *)atomic_load_explicit(&g_arenaBase, memory_order_relaxed);
+    uint32_t releasedNum = (uint32_t)atomic_load_explicit(&g_releasedSpanNum, memory_order_relaxed);
+    for (uint32_t i = 0; found && i < spanNum; i++) {
+        if (g_spanDepotNum[i] == MEM_SPAN_RELEASING) {
+            (void)madvise(base + (uintptr_t)i * MEM_SPAN_SIZE, MEM_SPAN_SIZE, MADV_DONTNEED);
+            g_spanDepotNum[i] = 0;
+            g_releasedSpan[releasedNum++] = i;
+        }
+    }
+    atomic_store_explicit(&g_releasedSpanNum, releasedNum, memory_order_relaxed);
+    (void)pthread_mutex_unlock(&g_depotLock);
+}
+#else
 void *SoftBusMalloc(unsigned int size)
 {
     if (size > MAX_MALLOC_SIZE) {
@@ -25,6 +515,55 @@ void *SoftBusMalloc(unsigned int size)
     return malloc(size);
 }
 
+void SoftBusFree(void *pt)
+{
+    if (pt == NULL) {
+        return;
+    }
+    free(pt);
+}
+
+SoftBusMemModule SoftBusSetMemModule(SoftBusMemModule module)
+{
+    (void)module;
+    return SOFTBUS_MEM_MODULE_COMMON;
+}
+
+int32_t SoftBusGetMemStat(SoftBusMemModule module, SoftBusMemStat *stat)
+{
+    (void)module;
+    (void)stat;
+    return SOFTBUS_NOT_IMPLEMENT;
+}
+
+void SoftBusMemTrim(void)
+{
+}
+#endif /* DSOFTBUS_FEATURE_MEM_SLAB */
+
+/* the module versions go through SoftBusMalloc and SoftBusCalloc, so mocks of those still cover their callers */
+void *SoftBusMallocByModule(SoftBusMemModule module, unsigned int size)
+{
+    if (module < SOFTBUS_MEM_MODULE_COMMON || module >= SOFTBUS_MEM_MODULE_BUTT) {
+        return NULL;
+    }
+    SoftBusMemModule prev = SoftBusSetMemModule(module);
+    void *tmp = SoftBusMalloc(size);
+    (void)SoftBusSetMemModule(prev);
+    return tmp;
+}
+
+void *SoftBusCallocByModule(SoftBusMemModule module, unsigned int size)
+{
+    if (module < SOFTBUS_MEM_MODULE_COMMON || module >= SOFTBUS_MEM_MODULE_BUTT) {
+        return NULL;
+    }
+    SoftBusMemModule prev = SoftBusSetMemModule(module);
+    void *tmp = SoftBusCalloc(size);
+    (void)SoftBusSetMemModule(prev);
+    return tmp;
+}
+
 void *SoftBusCalloc(unsigned int size)
 {
     void *tmp = SoftBusMalloc(size);
@@ -40,14 +579,6 @@ void *SoftBusCalloc(unsigned int size)
     return tmp;
 }
 
-void SoftBusFree(void *pt)
-{
-    if (pt == NULL) {
-        return;
-    }
-    free(pt);
-}
-
 void SoftBusClearFree(void *pt, unsigned int size)
 {
     if (pt == NULL) {
@@ -55,4 +586,4 @@ void SoftBusClearFree(void *pt, unsigned int size)
     }
     (void)memset_s(pt, size, 0, size);
     SoftBusFree(pt);
-}
\ No newline at end of file
+}
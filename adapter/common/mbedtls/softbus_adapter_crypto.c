@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -26,6 +26,7 @@
 #include "mbedtls/md.h"
 #include "mbedtls/platform.h"
 #include "softbus_adapter_file.h"
+#include "softbus_adapter_mem.h"
 #include "softbus_error_code.h"
 
 #ifndef MBEDTLS_CTR_DRBG_C
@@ -75,6 +76,41 @@ static mbedtls_cipher_type_t GetCtrAlgorithmByKeyLen(uint32_t keyLen)
     return MBEDTLS_CIPHER_NONE;
 }
 
+static int32_t MbedAesGcmSeal(mbedtls_gcm_context *aesContext, const unsigned char *iv,
+    const unsigned char *plainText, uint32_t plainTextSize, unsigned char *cipherText, uint32_t cipherTextLen)
+{
+    unsigned char tagBuf[TAG_LEN] = { 0 };
+    int32_t ret = mbedtls_gcm_crypt_and_tag(aesContext, MBEDTLS_GCM_ENCRYPT, plainTextSize, iv, GCM_IV_LEN, NULL, 0,
+        plainText, cipherText + GCM_IV_LEN, TAG_LEN, tagBuf);
+    if (ret != 0) {
+        return SOFTBUS_ENCRYPT_ERR;
+    }
+
+    if (memcpy_s(cipherText, cipherTextLen, iv, GCM_IV_LEN) != EOK) {
+        return SOFTBUS_ENCRYPT_ERR;
+    }
+
+    if (memcpy_s(cipherText + GCM_IV_LEN + plainTextSize, cipherTextLen - GCM_IV_LEN - plainTextSize, tagBuf,
+        TAG_LEN) != 0) {
+        return SOFTBUS_ENCRYPT_ERR;
+    }
+    return (plainTextSize + OVERHEAD_LEN);
+}
+
+/* the iv is taken from the head of cipherText */
+static int32_t MbedAesGcmOpen(mbedtls_gcm_context *aesContext, const unsigned char *cipherText,
+    uint32_t cipherTextSize, unsigned char *plain)
+{
+    int32_t actualPlainLen = (int32_t)(cipherTextSize - OVERHEAD_LEN);
+    int32_t ret = mbedtls_gcm_auth_decrypt(aesContext, cipherTextSize - OVERHEAD_LEN, cipherText, GCM_IV_LEN, NULL, 0,
+        cipherText + actualPlainLen + GCM_IV_LEN, TAG_LEN, cipherText + GCM_IV_LEN, plain);
+    if (ret != 0) {
+        COMM_LOGE(COMM_ADAPTER, "[TRANS] Decrypt mbedtls_gcm_auth_decrypt fail. ret=%{public}d", ret);
+        return SOFTBUS_DECRYPT_ERR;
+    }
+    return actualPlainLen;
+}
+
 static int32_t MbedAesGcmEncrypt(const AesGcmCipherKey *cipherKey, const unsigned char *plainText,
     uint32_t plainTextSize, unsigned char *cipherText, uint32_t cipherTextLen)
 {
@@ -84,37 +120,18 @@ static int32_t MbedAesGcmEncrypt(const AesGcmCipherKey *cipherKey, const unsigne
         return SOFTBUS_INVALID_PARAM;
     }
 
-    int32_t ret;
-    unsigned char tagBuf[TAG_LEN] = { 0 };
     mbedtls_gcm_context aesContext;
     mbedtls_gcm_init(&aesContext);
 
-    ret = mbedtls_gcm_setkey(&aesContext, MBEDTLS_CIPHER_ID_AES, cipherKey->key, cipherKey->keyLen * KEY_BITS_UNIT);
-    if (ret != 0) {
-        mbedtls_gcm_free(&aesContext);
-        return SOFTBUS_ENCRYPT_ERR;
-    }
-
-    ret = mbedtls_gcm_crypt_and_tag(&aesContext, MBEDTLS_GCM_ENCRYPT, plainTextSize, cipherKey->iv, GCM_IV_LEN, NULL, 0,
-        plainText, cipherText + GCM_IV_LEN, TAG_LEN, tagBuf);
+    int32_t ret =
+        mbedtls_gcm_setkey(&aesContext, MBEDTLS_CIPHER_ID_AES, cipherKey->key, cipherKey->keyLen * KEY_BITS_UNIT);
     if (ret != 0) {
         mbedtls_gcm_free(&aesContext);
         return SOFTBUS_ENCRYPT_ERR;
     }
-
-    if (memcpy_s(cipherText, cipherTextLen, cipherKey->iv, GCM_IV_LEN) != EOK) {
-        mbedtls_gcm_free(&aesContext);
-        return SOFTBUS_ENCRYPT_ERR;
-    }
-
-    if (memcpy_s(cipherText + GCM_IV_LEN + plainTextSize, cipherTextLen - GCM_IV_LEN - plainTextSize, tagBuf,
-        TAG_LEN) != 0) {
-        mbedtls_gcm_free(&aesContext);
-        return SOFTBUS_ENCRYPT_ERR;
-    }
-
+    ret = MbedAesGcmSeal(&aesContext, cipherKey->iv, plainText, plainTextSize, cipherText, cipherTextLen);
     mbedtls_gcm_free(&aesContext);
-    return (plainTextSize + OVERHEAD_LEN);
+    return ret;
 }
 
 static int32_t MbedAesGcmDecrypt(const AesGcmCipherKey *cipherKey, const unsigned char *cipherText,
@@ -135,18 +152,9 @@ static int32_t MbedAesGcmDecrypt(const AesGcmCipherKey *cipherKey, const unsigne
         mbedtls_gcm_free(&aesContext);
         return SOFTBUS_DECRYPT_ERR;
     }
-
-    int32_t actualPlainLen = (int32_t)(cipherTextSize - OVERHEAD_LEN);
-    ret = mbedtls_gcm_auth_decrypt(&aesContext, cipherTextSize - OVERHEAD_LEN, cipherKey->iv, GCM_IV_LEN, NULL, 0,
-        cipherText + actualPlainLen + GCM_IV_LEN, TAG_LEN, cipherText + GCM_IV_LEN, plain);
-    if (ret != 0) {
-        COMM_LOGE(COMM_ADAPTER, "[TRANS] Decrypt mbedtls_gcm_auth_decrypt fail. ret=%{public}d", ret);
-        mbedtls_gcm_free(&aesContext);
-        return SOFTBUS_DECRYPT_ERR;
-    }
-
+    ret = MbedAesGcmOpen(&aesContext, cipherText, cipherTextSize, plain);
     mbedtls_gcm_free(&aesContext);
-    return actualPlainLen;
+    return ret;
 }
 
 static int32_t HandleError(mbedtls_cipher_context_t *ctx, const char *buf)
@@ -337,6 +345,77 @@ int32_t SoftBusDecryptDataWithSeq(AesGcmCipherKey *cipherKey, const unsigned cha
     return SoftBusDecryptData(cipherKey, input, inLen, decryptData, decryptLen);
 }
 
+struct SoftBusGcmCipherCtx {
+    mbedtls_gcm_context aesContext;
+};
+
+SoftBusGcmCipherCtx *SoftBusCreateGcmCipherCtx(const unsigned char *key, uint32_t keyLen)
+{
+    if (key == NULL || (keyLen != EVP_AES_128_KEYLEN && keyLen != EVP_AES_256_KEYLEN)) {
+        COMM_LOGE(COMM_ADAPTER, "invalid param, keyLen=%{public}u", keyLen);
+        return NULL;
+    }
+    SoftBusGcmCipherCtx *cipherCtx = (SoftBusGcmCipherCtx *)SoftBusCalloc(sizeof(SoftBusGcmCipherCtx));
+    if (cipherCtx == NULL) {
+        COMM_LOGE(COMM_ADAPTER, "malloc cipher ctx fail.");
+        return NULL;
+    }
+    mbedtls_gcm_init(&cipherCtx->aesContext);
+    if (mbedtls_gcm_setkey(&cipherCtx->aesContext, MBEDTLS_CIPHER_ID_AES, key, keyLen * KEY_BITS_UNIT) != 0) {
+        COMM_LOGE(COMM_ADAPTER, "mbedtls_gcm_setkey fail.");
+        SoftBusDestroyGcmCipherCtx(cipherCtx);
+        return NULL;
+    }
+    return cipherCtx;
+}
+
+void SoftBusDestroyGcmCipherCtx(SoftBusGcmCipherCtx *cipherCtx)
+{
+    if (cipherCtx == NULL) {
+        return;
+    }
+    /* mbedtls_gcm_free zeroizes the key schedule */
+    mbedtls_gcm_free(&cipherCtx->aesContext);
+    SoftBusFree(cipherCtx);
+}
+
+int32_t SoftBusEncryptDataWithCtx(SoftBusGcmCipherCtx *cipherCtx, const unsigned char *input, uint32_t inLen,
+    unsigned char *encryptData, uint32_t *encryptLen, int32_t seqNum)
+{
+    if (cipherCtx == NULL || input == NULL || inLen == 0 || encryptData == NULL || encryptLen == NULL ||
+        inLen >= UINT32_MAX - OVERHEAD_LEN) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    unsigned char iv[GCM_IV_LEN] = { 0 };
+    if (SoftBusGenerateRandomArray(iv, sizeof(iv)) != SOFTBUS_OK) {
+        COMM_LOGE(COMM_ADAPTER, "generate random iv error.");
+        return SOFTBUS_ENCRYPT_ERR;
+    }
+    if (memcpy_s(iv, sizeof(int32_t), &seqNum, sizeof(int32_t)) != EOK) {
+        return SOFTBUS_ENCRYPT_ERR;
+    }
+    int32_t result = MbedAesGcmSeal(&cipherCtx->aesContext, iv, input, inLen, encryptData, inLen + OVERHEAD_LEN);
+    if (result <= 0) {
+        return SOFTBUS_ENCRYPT_ERR;
+    }
+    *encryptLen = (uint32_t)result;
+    return SOFTBUS_OK;
+}
+
+int32_t SoftBusDecryptDataWithCtx(SoftBusGcmCipherCtx *cipherCtx, const unsigned char *input, uint32_t inLen,
+    unsigned char *decryptData, uint32_t *decryptLen)
+{
+    if (cipherCtx == NULL || input == NULL || inLen <= OVERHEAD_LEN || decryptData == NULL || decryptLen == NULL) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    int32_t result = MbedAesGcmOpen(&cipherCtx->aesContext, input, inLen, decryptData);
+    if (result <= 0) {
+        return SOFTBUS_DECRYPT_ERR;
+    }
+    *decryptLen = (uint32_t)result;
+    return SOFTBUS_OK;
+}
+
 uint32_t SoftBusCryptoRand(void)
 {
     int32_t fd = SoftBusOpenFile("/dev/urandom", SOFTBUS_O_RDONLY);
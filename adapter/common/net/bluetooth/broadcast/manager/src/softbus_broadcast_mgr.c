@@ -490,7 +490,8 @@ static void BcStartBroadcastingCallback(BroadcastProtocol protocol, int32_t adap
             continue;
         }
         DISC_LOGI(DISC_BROADCAST, "srvType=%{public}s, lId=%{public}u, bcId=%{public}d, status=%{public}d,"
-            "c=%{public}u", GetSrvType(bcManager->srvType), managerId, adapterBcId, status, callCount++);
+            "c=%{public}u", GetSrvType(bcManager->srvType), managerId, adapterBcId, status, callCount);
+        callCount++;
         if (status == SOFTBUS_BC_STATUS_SUCCESS) {
             if (!bcManager->isAdvertising) {
                 g_bcCurrentNum++;
@@ -581,7 +582,8 @@ static void BcSetBroadcastingCallback(BroadcastProtocol protocol, int32_t adapte
         }
         static uint32_t callCount = 0;
         DISC_LOGI(DISC_BROADCAST, "srvType=%{public}s, lId=%{public}u, BcId=%{public}d, status=%{public}d,"
-            "c=%{public}u", GetSrvType(bcManager->srvType), managerId, adapterBcId, status, callCount++);
+            "c=%{public}u", GetSrvType(bcManager->srvType), managerId, adapterBcId, status, callCount);
+        callCount++;
         BroadcastCallback callback = *(bcManager->bcCallback);
         SoftBusMutexUnlock(&g_bcLock);
         callback.OnSetBroadcastingCallback((int32_t)managerId, status);
@@ -604,7 +606,8 @@ static void BcSetBroadcastingParamCallback(BroadcastProtocol protocol, int32_t a
         static uint32_t callCount = 0;
         DISC_LOGI(DISC_BROADCAST, "srvType=%{public}s, lId=%{public}u, BcId=%{public}d,"
             "status=%{public}d, c=%{public}u", GetSrvType(bcManager->srvType),
-            managerId, adapterBcId, status, callCount++);
+            managerId, adapterBcId, status, callCount);
+        callCount++;
         if (status == SOFTBUS_BC_STATUS_SUCCESS) {
             SoftBusCondSignal(&bcManager->setParamCond);
         }
@@ -628,7 +631,8 @@ static void BcEnableBroadcastingCallback(BroadcastProtocol protocol, int32_t ada
         static uint32_t callCount = 0;
         DISC_LOGI(DISC_BROADCAST, "srvType=%{public}s, lId=%{public}u, BcId=%{public}d,"
             "status=%{public}d, c=%{public}u", GetSrvType(bcManager->srvType),
-            managerId, adapterBcId, status, callCount++);
+            managerId, adapterBcId, status, callCount);
+        callCount++;
         if (status == SOFTBUS_BC_STATUS_SUCCESS) {
             bcManager->isDisabled = false;
             SoftBusCondSignal(&bcManager->enableCond);
@@ -653,7 +657,8 @@ static void BcDisableBroadcastingCallback(BroadcastProtocol protocol, int32_t ad
         static uint32_t callCount = 0;
         DISC_LOGI(DISC_BROADCAST, "srvType=%{public}s, lId=%{public}u, BcId=%{public}d,"
             "status=%{public}d, c=%{public}u", GetSrvType(bcManager->srvType),
-            managerId, adapterBcId, status, callCount++);
+            managerId, adapterBcId, status, callCount);
+        callCount++;
         if (status == SOFTBUS_BC_STATUS_SUCCESS) {
             bcManager->isDisabled = true;
             bcManager->isDisableCb = true;
@@ -1115,7 +1120,8 @@ int32_t RegisterBroadcaster(BroadcastProtocol protocol,
     BaseServiceType srvType, int32_t *bcId, const BroadcastCallback *cb)
 {
     static uint32_t callCount = 0;
-    DISC_LOGI(DISC_BROADCAST, "enter register bc, c=%{public}u", callCount++);
+    DISC_LOGI(DISC_BROADCAST, "enter register bc, c=%{public}u", callCount);
+    callCount++;
     int32_t ret = SOFTBUS_OK;
     int32_t adapterBcId = -1;
     DISC_CHECK_AND_RETURN_RET_LOGE(IsSrvTypeValid(srvType), SOFTBUS_BC_MGR_INVALID_SRV, DISC_BROADCAST, "bad srvType");
@@ -1291,7 +1297,8 @@ int32_t RegisterScanListener(BroadcastProtocol protocol,
     BaseServiceType srvType, int32_t *listenerId, const ScanCallback *cb)
 {
     static uint32_t callCount = 0;
-    DISC_LOGD(DISC_BROADCAST, "enter c=%{public}u", callCount++);
+    DISC_LOGD(DISC_BROADCAST, "enter c=%{public}u", callCount);
+    callCount++;
     int32_t ret = SOFTBUS_OK;
     int32_t adapterScanId = -1;
     DISC_CHECK_AND_RETURN_RET_LOGE(IsSrvTypeValid(srvType), SOFTBUS_BC_MGR_INVALID_SRV, DISC_BROADCAST, "bad srvType");
@@ -2128,7 +2135,8 @@ int32_t StartBroadcasting(int32_t bcId, const BroadcastParam *param, const Broad
     SoftbusBroadcastParam adapterParam;
     ConvertBcParams(protocol, param, &adapterParam);
     DISC_LOGI(DISC_BROADCAST, "start bc srvType=%{public}s, bcId=%{public}d, "
-        "c=%{public}u", GetSrvType(g_bcManager[bcId].srvType), bcId, callCount++);
+        "c=%{public}u", GetSrvType(g_bcManager[bcId].srvType), bcId, callCount);
+    callCount++;
     BroadcastCallback callback = *(g_bcManager[bcId].bcCallback);
     SoftBusMutexUnlock(&g_bcLock);
     ret = g_interface[protocol]->StartBroadcasting(g_bcManager[bcId].adapterBcId, &adapterParam, &softbusBcData);
@@ -2200,7 +2208,8 @@ int32_t SetBroadcastingData(int32_t bcId, const BroadcastPacket *packet)
     }
     static uint32_t callCount = 0;
     DISC_LOGI(DISC_BROADCAST, "replace bc srvType=%{public}s, bcId=%{public}d,"
-        "c=%{public}u", GetSrvType(g_bcManager[bcId].srvType), bcId, callCount++);
+        "c=%{public}u", GetSrvType(g_bcManager[bcId].srvType), bcId, callCount);
+    callCount++;
     SoftbusBroadcastData softbusBcData = {0};
     ret = BuildSoftbusBroadcastData(protocol, packet, &softbusBcData);
     if (ret != SOFTBUS_OK) {
@@ -2367,7 +2376,8 @@ int32_t SetBroadcastingParam(int32_t bcId, const BroadcastParam *param)
     }
     static uint32_t callCount = 0;
     DISC_LOGI(DISC_BROADCAST, "replace param srvType=%{public}s, bcId=%{public}d, "
-        "c=%{public}u", GetSrvType(g_bcManager[bcId].srvType), bcId, callCount++);
+        "c=%{public}u", GetSrvType(g_bcManager[bcId].srvType), bcId, callCount);
+    callCount++;
     SoftbusBroadcastParam softbusBcParam = {};
     ConvertBcParams(protocol, param, &softbusBcParam);
     g_bcManager[bcId].isDisableCb = false;
@@ -2644,7 +2654,8 @@ int32_t StartScan(int32_t listenerId, const BcScanParams *param)
         return SOFTBUS_BC_MGR_INVALID_LISN_ID;
     }
     DISC_LOGI(DISC_BROADCAST, "start scan, lId=%{public}d, srvType=%{public}s, c=%{public}u",
-        listenerId, GetSrvType(g_scanManager[listenerId].srvType), callCount++);
+        listenerId, GetSrvType(g_scanManager[listenerId].srvType), callCount);
+    callCount++;
 
     BroadcastProtocol protocol = g_scanManager[listenerId].protocol;
 
@@ -2691,7 +2702,8 @@ int32_t StartScan(int32_t listenerId, const BcScanParams *param)
 int32_t StopScan(int32_t listenerId)
 {
     static uint32_t callCount = 0;
-    DISC_LOGD(DISC_BROADCAST, "enter stop scan, listenerId=%{public}d, c=%{public}u", listenerId, callCount++);
+    DISC_LOGD(DISC_BROADCAST, "enter stop scan, listenerId=%{public}d, c=%{public}u", listenerId, callCount);
+    callCount++;
     int32_t ret = SoftBusMutexLock(&g_scanLock);
     DISC_CHECK_AND_RETURN_RET_LOGE(ret == SOFTBUS_OK, SOFTBUS_LOCK_ERR, DISC_BROADCAST, "mutex error");
     if (!CheckScanIdIsValid(listenerId)) {
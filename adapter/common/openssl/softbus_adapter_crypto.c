@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -98,14 +98,14 @@ static int32_t OpensslEvpInit(EVP_CIPHER_CTX **ctx, uint32_t keyLen, bool mode)
     return SOFTBUS_OK;
 }
 
-static int32_t PackIvAndTag(EVP_CIPHER_CTX *ctx, const AesGcmCipherKey *cipherkey, uint32_t dataLen,
+static int32_t PackIvAndTag(EVP_CIPHER_CTX *ctx, const unsigned char *iv, uint32_t dataLen,
     unsigned char *cipherText, uint32_t cipherTextLen)
 {
     if ((dataLen + OVERHEAD_LEN) > cipherTextLen) {
         COMM_LOGE(COMM_ADAPTER, "Encrypt invalid para.");
         return SOFTBUS_ENCRYPT_ERR;
     }
-    if (memcpy_s(cipherText, cipherTextLen - dataLen, cipherkey->iv, GCM_IV_LEN) != EOK) {
+    if (memcpy_s(cipherText, cipherTextLen - dataLen, iv, GCM_IV_LEN) != EOK) {
         COMM_LOGE(COMM_ADAPTER, "EVP memcpy iv fail.");
         return SOFTBUS_ENCRYPT_ERR;
     }
@@ -122,104 +122,124 @@ static int32_t PackIvAndTag(EVP_CIPHER_CTX *ctx, const AesGcmCipherKey *cipherke
     return SOFTBUS_OK;
 }
 
-static int32_t SslAesGcmEncrypt(const AesGcmCipherKey *cipherkey, const unsigned char *plainText,
+/* ctx must already hold the key, only the iv is set here so the key schedule is reused. */
+static int32_t SslAesGcmSeal(EVP_CIPHER_CTX *ctx, const unsigned char *iv, const unsigned char *plainText,
     uint32_t plainTextSize, unsigned char *cipherText, uint32_t cipherTextLen)
 {
-    if ((cipherkey == NULL) || (plainText == NULL) || (plainTextSize == 0) || cipherText == NULL ||
-        (cipherTextLen < plainTextSize + OVERHEAD_LEN)) {
-        COMM_LOGE(COMM_ADAPTER, "Encrypt invalid para.");
-        return SOFTBUS_INVALID_PARAM;
-    }
-
     int32_t outlen = 0;
     int32_t outbufLen;
-    EVP_CIPHER_CTX *ctx = NULL;
-    int32_t ret = OpensslEvpInit(&ctx, cipherkey->keyLen, true);
-    if (ret != SOFTBUS_OK) {
-        COMM_LOGE(COMM_ADAPTER, "OpensslEvpInit fail.");
-        return SOFTBUS_DECRYPT_ERR;
-    }
-    ret = EVP_EncryptInit_ex(ctx, NULL, NULL, cipherkey->key, cipherkey->iv);
+    int32_t ret = EVP_EncryptInit_ex(ctx, NULL, NULL, NULL, iv);
     if (ret != 1) {
         COMM_LOGE(COMM_ADAPTER, "EVP_EncryptInit_ex fail.");
-        EVP_CIPHER_CTX_free(ctx);
         return SOFTBUS_DECRYPT_ERR;
     }
     ret = EVP_EncryptUpdate(ctx, cipherText + GCM_IV_LEN, (int32_t *)&outbufLen, plainText, plainTextSize);
     if (ret != 1) {
         COMM_LOGE(COMM_ADAPTER, "EVP_EncryptUpdate fail.");
-        EVP_CIPHER_CTX_free(ctx);
         return SOFTBUS_DECRYPT_ERR;
     }
     outlen += outbufLen;
     ret = EVP_EncryptFinal_ex(ctx, cipherText + GCM_IV_LEN + outbufLen, (int32_t *)&outbufLen);
     if (ret != 1) {
         COMM_LOGE(COMM_ADAPTER, "EVP_EncryptFinal_ex fail.");
-        EVP_CIPHER_CTX_free(ctx);
         return SOFTBUS_DECRYPT_ERR;
     }
     outlen += outbufLen;
-    ret = PackIvAndTag(ctx, cipherkey, outlen, cipherText, cipherTextLen);
+    ret = PackIvAndTag(ctx, iv, outlen, cipherText, cipherTextLen);
     if (ret != SOFTBUS_OK) {
         COMM_LOGE(COMM_ADAPTER, "pack iv and tag fail.");
-        EVP_CIPHER_CTX_free(ctx);
         return SOFTBUS_DECRYPT_ERR;
     }
-    EVP_CIPHER_CTX_free(ctx);
     return (outlen + OVERHEAD_LEN);
 }
 
-static int32_t SslAesGcmDecrypt(const AesGcmCipherKey *cipherkey, const unsigned char *cipherText,
-    uint32_t cipherTextSize, unsigned char *plain, uint32_t plainLen)
+/* ctx must already hold the key, the iv is taken from the head of cipherText. */
+static int32_t SslAesGcmOpen(EVP_CIPHER_CTX *ctx, const unsigned char *cipherText, uint32_t cipherTextSize,
+    unsigned char *plain, uint32_t plainLen)
 {
-    if ((cipherkey == NULL) || (cipherText == NULL) || (cipherTextSize <= OVERHEAD_LEN) || plain == NULL ||
-        (plainLen < cipherTextSize - OVERHEAD_LEN)) {
-        COMM_LOGE(COMM_ADAPTER, "Decrypt invalid para.");
-        return SOFTBUS_INVALID_PARAM;
-    }
-
     int32_t outLen = 0;
-    EVP_CIPHER_CTX *ctx = NULL;
-    int32_t ret = OpensslEvpInit(&ctx, cipherkey->keyLen, false);
-    if (ret != SOFTBUS_OK) {
-        COMM_LOGE(COMM_ADAPTER, "OpensslEvpInit fail.");
-        return SOFTBUS_DECRYPT_ERR;
-    }
-    ret = EVP_DecryptInit_ex(ctx, NULL, NULL, cipherkey->key, cipherkey->iv);
+    int32_t ret = EVP_DecryptInit_ex(ctx, NULL, NULL, NULL, cipherText);
     if (ret != 1) {
         COMM_LOGE(COMM_ADAPTER, "EVP_EncryptInit_ex fail.");
-        goto EXIT;
+        return SOFTBUS_DECRYPT_ERR;
     }
     ret = EVP_CIPHER_CTX_ctrl(ctx, EVP_CTRL_GCM_SET_TAG, TAG_LEN, (void *)(cipherText + (cipherTextSize - TAG_LEN)));
     if (ret != 1) {
         COMM_LOGE(COMM_ADAPTER, "EVP_DecryptUpdate fail.");
-        goto EXIT;
+        return SOFTBUS_DECRYPT_ERR;
     }
     ret = EVP_DecryptUpdate(ctx, plain, (int32_t *)&plainLen, cipherText + GCM_IV_LEN, cipherTextSize - OVERHEAD_LEN);
     if (ret != 1) {
         COMM_LOGE(COMM_ADAPTER, "EVP_DecryptUpdate fail.");
-        goto EXIT;
+        return SOFTBUS_DECRYPT_ERR;
     }
     if (plainLen > INT32_MAX) {
         COMM_LOGE(COMM_ADAPTER, "PlainLen convert overflow.");
-        goto EXIT;
+        return SOFTBUS_DECRYPT_ERR;
     }
     outLen += (int32_t)plainLen;
     ret = EVP_DecryptFinal_ex(ctx, plain + plainLen, (int32_t *)&plainLen);
     if (ret != 1) {
         COMM_LOGE(COMM_ADAPTER, "EVP_DecryptFinal_ex fail.");
-        goto EXIT;
+        return SOFTBUS_DECRYPT_ERR;
     }
     if ((int32_t)plainLen > INT32_MAX - outLen) {
         COMM_LOGE(COMM_ADAPTER, "outLen convert overflow.");
-        goto EXIT;
+        return SOFTBUS_DECRYPT_ERR;
     }
     outLen += (int32_t)plainLen;
-    EVP_CIPHER_CTX_free(ctx);
     return outLen;
-EXIT:
+}
+
+static EVP_CIPHER_CTX *OpensslEvpInitWithKey(const unsigned char *key, uint32_t keyLen, bool mode)
+{
+    EVP_CIPHER_CTX *ctx = NULL;
+    if (OpensslEvpInit(&ctx, keyLen, mode) != SOFTBUS_OK) {
+        COMM_LOGE(COMM_ADAPTER, "OpensslEvpInit fail.");
+        return NULL;
+    }
+    int32_t ret = mode ? EVP_EncryptInit_ex(ctx, NULL, NULL, key, NULL) :
+        EVP_DecryptInit_ex(ctx, NULL, NULL, key, NULL);
+    if (ret != 1) {
+        COMM_LOGE(COMM_ADAPTER, "EVP init key fail.");
+        EVP_CIPHER_CTX_free(ctx);
+        return NULL;
+    }
+    return ctx;
+}
+
+static int32_t SslAesGcmEncrypt(const AesGcmCipherKey *cipherkey, const unsigned char *plainText,
+    uint32_t plainTextSize, unsigned char *cipherText, uint32_t cipherTextLen)
+{
+    if ((cipherkey == NULL) || (plainText == NULL) || (plainTextSize == 0) || cipherText == NULL ||
+        (cipherTextLen < plainTextSize + OVERHEAD_LEN)) {
+        COMM_LOGE(COMM_ADAPTER, "Encrypt invalid para.");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    EVP_CIPHER_CTX *ctx = OpensslEvpInitWithKey(cipherkey->key, cipherkey->keyLen, true);
+    if (ctx == NULL) {
+        return SOFTBUS_DECRYPT_ERR;
+    }
+    int32_t ret = SslAesGcmSeal(ctx, cipherkey->iv, plainText, plainTextSize, cipherText, cipherTextLen);
     EVP_CIPHER_CTX_free(ctx);
-    return SOFTBUS_DECRYPT_ERR;
+    return ret;
+}
+
+static int32_t SslAesGcmDecrypt(const AesGcmCipherKey *cipherkey, const unsigned char *cipherText,
+    uint32_t cipherTextSize, unsigned char *plain, uint32_t plainLen)
+{
+    if ((cipherkey == NULL) || (cipherText == NULL) || (cipherTextSize <= OVERHEAD_LEN) || plain == NULL ||
+        (plainLen < cipherTextSize - OVERHEAD_LEN)) {
+        COMM_LOGE(COMM_ADAPTER, "Decrypt invalid para.");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    EVP_CIPHER_CTX *ctx = OpensslEvpInitWithKey(cipherkey->key, cipherkey->keyLen, false);
+    if (ctx == NULL) {
+        return SOFTBUS_DECRYPT_ERR;
+    }
+    int32_t ret = SslAesGcmOpen(ctx, cipherText, cipherTextSize, plain, plainLen);
+    EVP_CIPHER_CTX_free(ctx);
+    return ret;
 }
 
 static int32_t HandleError(EVP_CIPHER_CTX *ctx, const char *buf)
@@ -463,6 +483,79 @@ int32_t SoftBusDecryptDataWithSeq(AesGcmCipherKey *cipherKey, const unsigned cha
     return SoftBusDecryptData(cipherKey, input, inLen, decryptData, decryptLen);
 }
 
+struct SoftBusGcmCipherCtx {
+    EVP_CIPHER_CTX *encryptCtx;
+    EVP_CIPHER_CTX *decryptCtx;
+};
+
+SoftBusGcmCipherCtx *SoftBusCreateGcmCipherCtx(const unsigned char *key, uint32_t keyLen)
+{
+    if (key == NULL || GetGcmAlgorithmByKeyLen(keyLen) == NULL) {
+        COMM_LOGE(COMM_ADAPTER, "invalid param, keyLen=%{public}u", keyLen);
+        return NULL;
+    }
+    SoftBusGcmCipherCtx *cipherCtx = (SoftBusGcmCipherCtx *)SoftBusCalloc(sizeof(SoftBusGcmCipherCtx));
+    if (cipherCtx == NULL) {
+        COMM_LOGE(COMM_ADAPTER, "malloc cipher ctx fail.");
+        return NULL;
+    }
+    cipherCtx->encryptCtx = OpensslEvpInitWithKey(key, keyLen, true);
+    cipherCtx->decryptCtx = OpensslEvpInitWithKey(key, keyLen, false);
+    if (cipherCtx->encryptCtx == NULL || cipherCtx->decryptCtx == NULL) {
+        SoftBusDestroyGcmCipherCtx(cipherCtx);
+        return NULL;
+    }
+    return cipherCtx;
+}
+
+void SoftBusDestroyGcmCipherCtx(SoftBusGcmCipherCtx *cipherCtx)
+{
+    if (cipherCtx == NULL) {
+        return;
+    }
+    /* EVP_CIPHER_CTX_free cleanses the key schedule */
+    EVP_CIPHER_CTX_free(cipherCtx->encryptCtx);
+    EVP_CIPHER_CTX_free(cipherCtx->decryptCtx);
+    SoftBusFree(cipherCtx);
+}
+
+int32_t SoftBusEncryptDataWithCtx(SoftBusGcmCipherCtx *cipherCtx, const unsigned char *input, uint32_t inLen,
+    unsigned char *encryptData, uint32_t *encryptLen, int32_t seqNum)
+{
+    if (cipherCtx == NULL || input == NULL || inLen == 0 || encryptData == NULL || encryptLen == NULL ||
+        inLen >= UINT32_MAX - OVERHEAD_LEN) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    unsigned char iv[GCM_IV_LEN] = { 0 };
+    if (SoftBusGenerateRandomArray(iv, sizeof(iv)) != SOFTBUS_OK) {
+        COMM_LOGE(COMM_ADAPTER, "generate random iv error.");
+        return SOFTBUS_ENCRYPT_ERR;
+    }
+    if (memcpy_s(iv, sizeof(int32_t), &seqNum, sizeof(int32_t)) != EOK) {
+        return SOFTBUS_ENCRYPT_ERR;
+    }
+    int32_t result = SslAesGcmSeal(cipherCtx->encryptCtx, iv, input, inLen, encryptData, inLen + OVERHEAD_LEN);
+    if (result <= 0) {
+        return SOFTBUS_ENCRYPT_ERR;
+    }
+    *encryptLen = (uint32_t)result;
+    return SOFTBUS_OK;
+}
+
+int32_t SoftBusDecryptDataWithCtx(SoftBusGcmCipherCtx *cipherCtx, const unsigned char *input, uint32_t inLen,
+    unsigned char *decryptData, uint32_t *decryptLen)
+{
+    if (cipherCtx == NULL || input == NULL || inLen <= OVERHEAD_LEN || decryptData == NULL || decryptLen == NULL) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    int32_t result = SslAesGcmOpen(cipherCtx->decryptCtx, input, inLen, decryptData, inLen - OVERHEAD_LEN);
+    if (result <= 0) {
+        return SOFTBUS_DECRYPT_ERR;
+    }
+    *decryptLen = (uint32_t)result;
+    return SOFTBUS_OK;
+}
+
 uint32_t SoftBusCryptoRand(void)
 {
     int32_t fd = SoftBusOpenFile("/dev/urandom", SOFTBUS_O_RDONLY);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -26,6 +26,7 @@
 #define MAX_NR_IOVCNT       20
 #define MAX_UDP_PAYLOAD     65507
 #define MAX_SEND_COUNT      1
+#define MAX_UDP_SEND_COUNT  MAX_NR_IOVCNT /* udp frames handed to one batch transmit */
 
 static inline uint32_t GetIovListSize(void)
 {
@@ -123,17 +124,109 @@ static void UdpSendFileDataSuccess(DFileSession *session, PeerInfo *peerInfo, Li
     NSTACKX_ATOM_FETCH_INC(&session->totalSendBlocks);
 }
 
+/* udp gso cuts one buffer into mss sized datagrams, only the last one may be shorter */
+static bool IsGsoBatch(const struct iovec *iov, uint32_t cnt)
+{
+    if (cnt < 2 || iov[cnt - 1].iov_len > iov[0].iov_len) {
+        return false;
+    }
+    size_t total = iov[cnt - 1].iov_len;
+    for (uint32_t i = 0; i < cnt - 1; i++) {
+        if (iov[i].iov_len != iov[0].iov_len) {
+            return false;
+        }
+        total += iov[i].iov_len;
+    }
+    return total <= MAX_UDP_PAYLOAD;
+}
+
+static int32_t UdpSendFileDataFrameBatch(DFileSession *session, PeerInfo *peerInfo, List *head)
+{
+    struct iovec iov[MAX_UDP_SEND_COUNT];
+    uint32_t cnt = 0;
+    uint32_t sent;
+    List *p = NULL;
+    FileDataFrameZS *f = NULL;
+    int32_t ret;
+    Socket *socket = session->socket[peerInfo->socketIndex];
+
+    LIST_FOR_EACH(p, head) {
+        if (cnt == MAX_UDP_SEND_COUNT) {
+            break;
+        }
+        f = (FileDataFrameZS *)(void *)((BlockFrame *)p)->fileDataFrame;
+        iov[cnt].iov_base = f;
+        iov[cnt].iov_len = ntohs(f->header.length) + DFILE_FRAME_HEADER_LEN;
+        cnt++;
+    }
+
+    bool gso = CapsGSO(session) && !peerInfo->gsoDisabled && IsGsoBatch(iov, cnt);
+    if (gso) {
+        ret = SocketSendEx(socket, (uint16_t)iov[0].iov_len, iov, cnt);
+        if (ret == NSTACKX_EFAILED && (errno == EIO || errno == EINVAL)) {
+            /* the device or its driver can not offload udp segmentation, send the frames as plain datagrams */
+            DFILE_LOGE(TAG, "udp gso send failed errno %d, fall back to batch send", errno);
+            peerInfo->gsoDisabled = NSTACKX_TRUE;
+            gso = false;
+        }
+    }
+    if (gso) {
+        sent = (ret > 0) ? cnt : 0;
+    } else {
+        ret = SocketSendBatch(socket, iov, cnt);
+        sent = (ret > 0) ? (uint32_t)ret : 0;
+    }
+
+    for (uint32_t i = 0; i < sent; i++) {
+        p = ListGetFront(head);
+        f = (FileDataFrameZS *)(void *)((BlockFrame *)p)->fileDataFrame;
+        UdpSendFileDataSuccess(session, peerInfo, p, f, (BlockFrame *)p);
+    }
+    if (ret == NSTACKX_EAGAIN || (ret > 0 && sent < cnt)) {
+        /* the frames not sent stay in head and go back to the unsent list */
+        NSTACKX_ATOM_FETCH_INC(&peerInfo->eAgainCount);
+        return NSTACKX_EAGAIN;
+    }
+    if (ret <= 0) {
+        DFILE_LOGE(TAG, "socket sendto failed");
+        return NSTACKX_EFAILED;
+    }
+    return (int32_t)sent;
+}
+
+static int32_t UdpSendFileDataFrame(DFileSession *session, PeerInfo *peerInfo, List *head, uint32_t tid)
+{
+    int32_t ret = NSTACKX_EOK;
+
+    while (!ListIsEmpty(head)) {
+        ret = UdpSendFileDataFrameBatch(session, peerInfo, head);
+        if (ret == NSTACKX_EAGAIN) {
+            return ret;
+        }
+        if (ret < 0) {
+            break;
+        }
+    }
+
+    DestroyIovList(head, session, tid);
+
+    return ret;
+}
+
 static int32_t SendFileDataFrame(DFileSession *session, PeerInfo *peerInfo, List *head, uint32_t tid)
 {
     List *p = NULL;
     List *n = NULL;
     BlockFrame *block = NULL;
     FileDataFrameZS *f = NULL;
-    int32_t ret;
+    int32_t ret = NSTACKX_EOK;
     uint16_t len;
     Socket *socket = session->socket[0];
 
-    if (CapsTcp(session) && (session->sessionType == DFILE_SESSION_TYPE_SERVER)) {
+    if (!CapsTcp(session)) {
+        return UdpSendFileDataFrame(session, peerInfo, head, tid);
+    }
+    if (session->sessionType == DFILE_SESSION_TYPE_SERVER) {
         socket = session->acceptSocket;
     }
 
@@ -141,24 +234,11 @@ static int32_t SendFileDataFrame(DFileSession *session, PeerInfo *peerInfo, List
         block = (BlockFrame *)p;
         f = (FileDataFrameZS *)(void *)block->fileDataFrame;
         len = ntohs(f->header.length) + DFILE_FRAME_HEADER_LEN;
-        if (CapsTcp(session)) {
-            ret = TcpSendFileDataFrame(socket, peerInfo, p, block, len);
-            if (ret == NSTACKX_EFAILED) {
-                break;
-            } else if (ret == NSTACKX_EAGAIN) {
-                return ret;
-            }
-        } else {
-            ret = SocketSend(session->socket[peerInfo->socketIndex], (void *)f, len);
-            if (ret > 0) {
-                UdpSendFileDataSuccess(session, peerInfo, p, f, block);
-            } else if (ret == NSTACKX_EAGAIN) {
-                NSTACKX_ATOM_FETCH_INC(&peerInfo->eAgainCount);
-                return ret;
-            } else {
-                DFILE_LOGE(TAG, "socket sendto failed");
-                break;
-            }
+        ret = TcpSendFileDataFrame(socket, peerInfo, p, block, len);
+        if (ret == NSTACKX_EFAILED) {
+            break;
+        } else if (ret == NSTACKX_EAGAIN) {
+            return ret;
         }
     }
 
@@ -189,12 +269,29 @@ static int32_t CheckUnsentList(List *unsent, List *head, int32_t maxCount)
     return cnt;
 }
 
-static int32_t GetMaxSendCount(void)
+/* puts the frames of an EAGAIN batch back in front of the ones still waiting in unsent, keeping their order */
+static void ReturnUnsentFrames(List *tmpq, List *unsent)
+{
+    if (ListIsEmpty(tmpq)) {
+        return;
+    }
+    if (!ListIsEmpty(unsent)) {
+        ListInsertNewHead(tmpq, unsent);
+    }
+    ListMove(tmpq, unsent);
+}
+
+static int32_t GetMaxSendCount(const DFileSession *session, const PeerInfo *peerInfo)
 {
-    return MAX_SEND_COUNT;
+    if (CapsTcp(session) || peerInfo->intervalSendCount >= (uint16_t)peerInfo->amendSendRate) {
+        return MAX_SEND_COUNT;
+    }
+    /* a udp batch stops at the send rate left in this interval */
+    uint32_t rateLeft = (uint16_t)peerInfo->amendSendRate - peerInfo->intervalSendCount;
+    return (rateLeft < MAX_UDP_SEND_COUNT) ? (int32_t)rateLeft : MAX_UDP_SEND_COUNT;
 }
 
-static int32_t DoSendDataFrame(DFileSession *session, List *head, int32_t count, uint32_t tid, uint8_t socketIndex)
+static int32_t DoSendDataFrame(DFileSession *session, List *unsent, List *head, uint32_t tid, uint8_t socketIndex)
 {
     BlockFrame *block = NULL;
     int32_t ret;
@@ -202,15 +299,22 @@ static int32_t DoSendDataFrame(DFileSession *session, List *head, int32_t count,
     if (!peerInfo) {
         return NSTACKX_EFAILED;
     }
-    int32_t maxCount = GetMaxSendCount();
+    int32_t maxCount = GetMaxSendCount(session, peerInfo);
+    int32_t count;
     int32_t flag;
     do {
+        /* frames left by an earlier EAGAIN go out before any newly read one */
+        count = CheckUnsentList(unsent, head, maxCount);
         while (count < maxCount && FileManagerHasPendingData(session->fileManager)) {
             ret = FileManagerFileRead(session->fileManager, tid, &block, maxCount - count);
             if (ret < 0) {
                 DFILE_LOGE(TAG, "FileManagerFileRead failed %d", ret);
                 break;
             }
+            if (ret == 0 && count > 0) {
+                /* send the frames already read instead of waiting for a full batch */
+                break;
+            }
             if (ret == 0) {
                 NSTACKX_ATOM_FETCH_INC(&session->sendBlockListEmptyTimes);
                 (void)usleep(WAIT_DATA_FRAME_WAIT_US);
@@ -234,8 +338,7 @@ static int32_t DoSendDataFrame(DFileSession *session, List *head, int32_t count,
             break;
         }
 
-        count = 0;
-        maxCount = GetMaxSendCount();
+        maxCount = GetMaxSendCount(session, peerInfo);
         flag = CapsTcp(session) ? (session->sendRemain ? 0 : 1) :
             (peerInfo->intervalSendCount < (uint16_t)peerInfo->amendSendRate && !session->closeFlag);
     } while (flag && (session->stopSendCnt[tid] == 0));
@@ -307,11 +410,10 @@ int32_t SendDataFrame(DFileSession *session, List *unsent, uint32_t tid, uint8_t
 
     CheckSendByBackPress(session, tid, socketIndex);
 
-    int32_t maxCount = GetMaxSendCount();
-    int32_t count = CheckUnsentList(unsent, &tmpq, maxCount);
-    ret = DoSendDataFrame(session, &tmpq, count, tid, socketIndex);
+    ListInitHead(&tmpq);
+    ret = DoSendDataFrame(session, unsent, &tmpq, tid, socketIndex);
     if (ret == NSTACKX_EAGAIN) {
-        ListMove(&tmpq, unsent);
+        ReturnUnsentFrames(&tmpq, unsent);
     }
     return ret;
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -244,6 +244,7 @@ typedef struct PeerInfo {
     uint8_t gotWifiRate;
     uint16_t sendAckNum;
     uint32_t eAgainCount;
+    uint8_t gsoDisabled; /* udp gso failed with EIO or EINVAL on this peer, its batches go by sendmmsg */
     struct timespec measureBefore;
     struct timespec ackDropTimer;
     uint32_t maxRetryCountPerSec;
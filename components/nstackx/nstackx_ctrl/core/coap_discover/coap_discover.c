@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -21,6 +21,7 @@
 
 #include "coap_app.h"
 #include "coap_client.h"
+#include "coap_msgid_window.h"
 #include "nstackx_dfinder_log.h"
 #include "nstackx_dfinder_mgt_msg_log.h"
 #include "nstackx_util.h"
@@ -38,21 +39,8 @@
 
 #define COAP_RECV_COUNT_INTERVAL 1000
 #define COAP_DISVOCER_MAX_RATE 200
-#define COAP_MSGID_SURVIVAL_SECONDS 100
-#define COAP_MAX_MSGID_RESERVE_NUM 100
 #define MULTICAST_ADDR "ff02::1"
 
-typedef struct {
-    coap_mid_t msgId;
-    struct timespec recvTime;
-} MsgIdRecord;
-
-typedef struct {
-    MsgIdRecord msgIdRecord[COAP_MAX_MSGID_RESERVE_NUM];
-    uint32_t startIdx;
-    uint32_t endIdx;
-} MsgIdList;
-
 static int g_resourceFlags = COAP_RESOURCE_FLAGS_NOTIFY_CON;
 static uint32_t g_coapMaxDiscoverCount = COAP_DEFAULT_DISCOVER_COUNT;
 static uint32_t g_coapDiscoverType = COAP_BROADCAST_TYPE_DEFAULT;
@@ -67,7 +55,7 @@ static uint32_t *g_coapIntervalArr = NULL;
 static uint32_t g_coapDiscoverTargetCount;
 static Timer *g_recvRecountTimer = NULL;
 static uint32_t g_recvDiscoverMsgNum;
-static MsgIdList *g_msgIdList = NULL;
+static CoapMsgIdWindow *g_msgIdWindow = NULL;
 static atomic_uint_fast8_t g_subscribeCount;
 
 static uint16_t *g_notificationIntervals = NULL;
@@ -420,94 +408,26 @@ static void HndPostServiceDiscover(coap_resource_t *resource, coap_session_t *se
     }
 }
 
-static void DeleteOverTimeMsgIdRecord(MsgIdList *msgIdList, struct timespec *curTime)
+static uint8_t RefreshMsgIdList(const coap_address_t *addr, coap_mid_t msgId)
 {
-    uint32_t i = msgIdList->startIdx;
-    if (msgIdList->startIdx >= COAP_MAX_MSGID_RESERVE_NUM || msgIdList->endIdx >= COAP_MAX_MSGID_RESERVE_NUM) {
-        return;
-    }
-    uint32_t cycleTimes = 0;
-    while (NSTACKX_TRUE) {
-        if (curTime->tv_sec - msgIdList->msgIdRecord[i].recvTime.tv_sec < COAP_MSGID_SURVIVAL_SECONDS) {
-            return;
-        }
-        if (i == msgIdList->endIdx) {
-            msgIdList->startIdx = COAP_MAX_MSGID_RESERVE_NUM;
-            msgIdList->endIdx = COAP_MAX_MSGID_RESERVE_NUM;
-            return;
-        }
-        msgIdList->startIdx = (msgIdList->startIdx + 1) % COAP_MAX_MSGID_RESERVE_NUM;
-        i = msgIdList->startIdx;
-        if (cycleTimes > COAP_MAX_MSGID_RESERVE_NUM) {
-            IncStatistics(STATS_DROP_MSG_ID);
-            DFINDER_LOGE(TAG, "cycle too many times, error must occurred and init msgList");
-            msgIdList->startIdx = COAP_MAX_MSGID_RESERVE_NUM;
-            msgIdList->endIdx = COAP_MAX_MSGID_RESERVE_NUM;
-            break;
-        }
-        cycleTimes++;
+    if (g_msgIdWindow == NULL) {
+        return NSTACKX_TRUE;
     }
-}
-
-static void AddMsgIdRecord(MsgIdList *msgIdList, coap_mid_t msgId, struct timespec *curTime)
-{
-    int32_t ret;
-    uint32_t idx;
-    if (msgIdList->endIdx == COAP_MAX_MSGID_RESERVE_NUM) {
-        msgIdList->endIdx = 0;
-        msgIdList->startIdx = 0;
-        idx = 0;
+    CoapMsgIdKey key;
+    (void)memset_s(&key, sizeof(key), 0, sizeof(key));
+    key.msgId = (uint16_t)msgId;
+    if (addr->addr.sa.sa_family == AF_INET) {
+        key.af = AF_INET;
+        key.port = addr->addr.sin.sin_port;
+        key.addr.in = addr->addr.sin.sin_addr;
     } else {
-        idx = (msgIdList->endIdx + 1) % COAP_MAX_MSGID_RESERVE_NUM;
-        if (idx == msgIdList->startIdx) {
-            msgIdList->startIdx = (msgIdList->startIdx + 1) % COAP_MAX_MSGID_RESERVE_NUM;
-        }
+        key.af = AF_INET6;
+        key.port = addr->addr.sin6.sin6_port;
+        key.addr.in6 = addr->addr.sin6.sin6_addr;
     }
-    msgIdList->msgIdRecord[idx].msgId = msgId;
-    ret = memcpy_s(&msgIdList->msgIdRecord[idx].recvTime, sizeof(struct timespec), curTime, sizeof(struct timespec));
-    if (ret != NSTACKX_EOK) {
-        DFINDER_LOGE(TAG, "set msg id time error");
-        return;
-    }
-    msgIdList->endIdx = idx;
-}
-
-static uint8_t RefreshMsgIdList(coap_mid_t msgId)
-{
     struct timespec curTime;
-    uint32_t i;
-    if (g_msgIdList == NULL) {
-        return NSTACKX_TRUE;
-    }
     ClockGetTime(CLOCK_MONOTONIC, &curTime);
-    DeleteOverTimeMsgIdRecord(g_msgIdList, &curTime);
-    if (g_msgIdList->startIdx >= COAP_MAX_MSGID_RESERVE_NUM || g_msgIdList->endIdx >= COAP_MAX_MSGID_RESERVE_NUM) {
-        AddMsgIdRecord(g_msgIdList, msgId, &curTime);
-        return NSTACKX_TRUE;
-    }
-    i = g_msgIdList->startIdx;
-    uint32_t cycleTimes = 0;
-    while (NSTACKX_TRUE) {
-        if (g_msgIdList->msgIdRecord[i].msgId == msgId) {
-            (void)memcpy_s(&g_msgIdList->msgIdRecord[i].recvTime, sizeof(struct timespec), &curTime,
-                           sizeof(struct timespec));
-            return NSTACKX_FALSE;
-        }
-        if (i == g_msgIdList->endIdx) {
-            break;
-        }
-        i = (i + 1) % COAP_MAX_MSGID_RESERVE_NUM;
-        if (cycleTimes > COAP_MAX_MSGID_RESERVE_NUM) {
-            IncStatistics(STATS_DROP_MSG_ID);
-            DFINDER_LOGE(TAG, "cycle too many times, error must occurred and init msgList");
-            g_msgIdList->startIdx = COAP_MAX_MSGID_RESERVE_NUM;
-            g_msgIdList->endIdx = COAP_MAX_MSGID_RESERVE_NUM;
-            break;
-        }
-        cycleTimes++;
-    }
-    AddMsgIdRecord(g_msgIdList, msgId, &curTime);
-    return NSTACKX_TRUE;
+    return CoapMsgIdWindowRefresh(g_msgIdWindow, &key, (uint64_t)curTime.tv_sec) ? NSTACKX_TRUE : NSTACKX_FALSE;
 }
 
 static uint16_t GetServiceMsgFrameLen(const uint8_t *frame, uint16_t size)
@@ -622,7 +542,13 @@ static int32_t HndPostServiceMsgEx(coap_resource_t *resource, coap_session_t *se
         return NSTACKX_EFAILED;
     }
 
-    if (!RefreshMsgIdList(coap_pdu_get_mid(request))) {
+    const coap_address_t *addPtr = coap_session_get_addr_remote(session);
+    if (addPtr == NULL) {
+        DFINDER_LOGE(TAG, "coap session get remote addr failed");
+        return NSTACKX_EFAILED;
+    }
+
+    if (!RefreshMsgIdList(addPtr, coap_pdu_get_mid(request))) {
         DFINDER_LOGE(TAG, "repeated msg id");
         return NSTACKX_EFAILED;
     }
@@ -633,12 +559,6 @@ static int32_t HndPostServiceMsgEx(coap_resource_t *resource, coap_session_t *se
         DFINDER_LOGD(TAG, "parse service msg frame error");
         return NSTACKX_EFAILED;
     }
-    const coap_address_t *addPtr = coap_session_get_addr_remote(session);
-    if (addPtr == NULL) {
-        DFINDER_LOGE(TAG, "coap session get remote addr failed");
-        free(msg);
-        return NSTACKX_EFAILED;
-    }
     char srcIp[NSTACKX_MAX_IP_STRING_LEN] = {0};
     if (inet_ntop(AF_INET, &((addPtr->addr).sin.sin_addr), srcIp, sizeof(srcIp)) == NULL) {
         free(msg);
@@ -1258,9 +1178,12 @@ int32_t CoapDiscoverInit(EpollDesc epollfd)
         return NSTACKX_EFAILED;
     }
 
-    g_msgIdList = (MsgIdList *)calloc(1U, sizeof(MsgIdList));
-    if (g_msgIdList == NULL) {
-        DFINDER_LOGE(TAG, "message Id record list calloc error");
+    g_msgIdWindow = (CoapMsgIdWindow *)calloc(1U, sizeof(CoapMsgIdWindow));
+    if (g_msgIdWindow == NULL ||
+        CoapMsgIdWindowInit(g_msgIdWindow, COAP_MSGID_WINDOW_CAPACITY, COAP_MSGID_SURVIVAL_SECONDS) != NSTACKX_EOK) {
+        DFINDER_LOGE(TAG, "message Id window init error");
+        free(g_msgIdWindow);
+        g_msgIdWindow = NULL;
         TimerDelete(g_discoverTimer);
         g_discoverTimer = NULL;
         TimerDelete(g_recvRecountTimer);
@@ -1270,8 +1193,6 @@ int32_t CoapDiscoverInit(EpollDesc epollfd)
         return NSTACKX_EFAILED;
     }
 
-    g_msgIdList->startIdx = COAP_MAX_MSGID_RESERVE_NUM;
-    g_msgIdList->endIdx = COAP_MAX_MSGID_RESERVE_NUM;
     g_userRequest = NSTACKX_FALSE;
     g_forceUpdate = NSTACKX_FALSE;
     g_recvDiscoverMsgNum = 0;
@@ -1295,9 +1216,10 @@ void CoapDiscoverDeinit(void)
         TimerDelete(g_notificationTimer);
         g_notificationTimer = NULL;
     }
-    if (g_msgIdList != NULL) {
-        free(g_msgIdList);
-        g_msgIdList = NULL;
+    if (g_msgIdWindow != NULL) {
+        CoapMsgIdWindowDeinit(g_msgIdWindow);
+        free(g_msgIdWindow);
+        g_msgIdWindow = NULL;
     }
     if (g_coapIntervalArr != NULL) {
         free(g_coapIntervalArr);
@@ -0,0 +1,227 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "coap_msgid_window.h"
+#include <stdlib.h>
+#include <securec.h>
+
+#include "nstackx_dfinder_log.h"
+#include "nstackx_error.h"
+#include "nstackx_statistics.h"
+
+#define TAG "nStackXCoAP"
+
+#define COAP_MSGID_WINDOW_MAX_CAPACITY (1U << 16)
+#define FNV_OFFSET_BASIS 2166136261U
+#define FNV_PRIME 16777619U
+
+static uint32_t HashBytes(uint32_t hash, const void *data, size_t len)
+{
+    const uint8_t *ptr = (const uint8_t *)data;
+    for (size_t i = 0; i < len; i++) {
+        hash ^= ptr[i];
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static inline size_t GetAddrLen(uint8_t af)
+{
+    return (af == AF_INET) ? sizeof(struct in_addr) : sizeof(struct in6_addr);
+}
+
+static uint32_t HashKey(const CoapMsgIdKey *key)
+{
+    uint32_t hash = HashBytes(FNV_OFFSET_BASIS, &key->af, sizeof(key->af));
+    hash = HashBytes(hash, &key->port, sizeof(key->port));
+    hash = HashBytes(hash, &key->msgId, sizeof(key->msgId));
+    return HashBytes(hash, &key->addr, GetAddrLen(key->af));
+}
+
+static bool IsKeyEqual(const CoapMsgIdKey *a, const CoapMsgIdKey *b)
+{
+    return a->af == b->af && a->port == b->port && a->msgId == b->msgId &&
+        memcmp(&a->addr, &b->addr, GetAddrLen(a->af)) == 0;
+}
+
+static uint32_t RoundUpPowerOfTwo(uint32_t value)
+{
+    uint32_t size = 1;
+    while (size < value) {
+        size <<= 1;
+    }
+    return size;
+}
+
+int32_t CoapMsgIdWindowInit(CoapMsgIdWindow *window, uint32_t capacity, uint32_t survivalSeconds)
+{
+    if (window == NULL || capacity == 0 || capacity > COAP_MSGID_WINDOW_MAX_CAPACITY || survivalSeconds == 0) {
+        DFINDER_LOGE(TAG, "invalid msg id window param, capacity %u", capacity);
+        return NSTACKX_EINVAL;
+    }
+    (void)memset_s(window, sizeof(CoapMsgIdWindow), 0, sizeof(CoapMsgIdWindow));
+    uint32_t hashSize = RoundUpPowerOfTwo(capacity);
+    window->hashHead = (uint32_t *)malloc(hashSize * sizeof(uint32_t));
+    window->entry = (CoapMsgIdEntry *)calloc(capacity, sizeof(CoapMsgIdEntry));
+    if (window->hashHead == NULL || window->entry == NULL) {
+        DFINDER_LOGE(TAG, "msg id window malloc failed");
+        CoapMsgIdWindowDeinit(window);
+        return NSTACKX_ENOMEM;
+    }
+    /* all bits set is COAP_MSGID_WINDOW_INVALID_IDX */
+    (void)memset_s(window->hashHead, hashSize * sizeof(uint32_t), 0xFF, hashSize * sizeof(uint32_t));
+    (void)memset_s(window->bucketHead, sizeof(window->bucketHead), 0xFF, sizeof(window->bucketHead));
+    (void)memset_s(window->bucketTail, sizeof(window->bucketTail), 0xFF, sizeof(window->bucketTail));
+    for (uint32_t i = 0; i < capacity; i++) {
+        window->entry[i].next = (i + 1 < capacity) ? (i + 1) : COAP_MSGID_WINDOW_INVALID_IDX;
+    }
+    window->capacity = capacity;
+    window->hashMask = hashSize - 1;
+    window->bucketSeconds = (survivalSeconds + COAP_MSGID_WINDOW_BUCKET_NUM - 1) / COAP_MSGID_WINDOW_BUCKET_NUM;
+    window->freeHead = 0;
+    return NSTACKX_EOK;
+}
+
+void CoapMsgIdWindowDeinit(CoapMsgIdWindow *window)
+{
+    if (window == NULL) {
+        return;
+    }
+    free(window->hashHead);
+    free(window->entry);
+    (void)memset_s(window, sizeof(CoapMsgIdWindow), 0, sizeof(CoapMsgIdWindow));
+}
+
+static void BucketAppend(CoapMsgIdWindow *window, uint32_t idx, uint8_t bucket)
+{
+    CoapMsgIdEntry *entry = &window->entry[idx];
+    entry->bucket = bucket;
+    entry->next = COAP_MSGID_WINDOW_INVALID_IDX;
+    entry->prev = window->bucketTail[bucket];
+    if (entry->prev == COAP_MSGID_WINDOW_INVALID_IDX) {
+        window->bucketHead[bucket] = idx;
+    } else {
+        window->entry[entry->prev].next = idx;
+    }
+    window->bucketTail[bucket] = idx;
+}
+
+static void BucketUnlink(CoapMsgIdWindow *window, uint32_t idx)
+{
+    CoapMsgIdEntry *entry = &window->entry[idx];
+    if (entry->prev == COAP_MSGID_WINDOW_INVALID_IDX) {
+        window->bucketHead[entry->bucket] = entry->next;
+    } else {
+        window->entry[entry->prev].next = entry->next;
+    }
+    if (entry->next == COAP_MSGID_WINDOW_INVALID_IDX) {
+        window->bucketTail[entry->bucket] = entry->prev;
+    } else {
+        window->entry[entry->next].prev = entry->prev;
+    }
+}
+
+static void HashUnlink(CoapMsgIdWindow *window, uint32_t idx)
+{
+    uint32_t *link = &window->hashHead[window->entry[idx].hash & window->hashMask];
+    while (*link != COAP_MSGID_WINDOW_INVALID_IDX) {
+        if (*link == idx) {
+            *link = window->entry[idx].hashNext;
+            return;
+        }
+        link = &window->entry[*link].hashNext;
+    }
+}
+
+static void RemoveEntry(CoapMsgIdWindow *window, uint32_t idx)
+{
+    HashUnlink(window, idx);
+    BucketUnlink(window, idx);
+    window->entry[idx].next = window->freeHead;
+    window->freeHead = idx;
+    window->num--;
+}
+
+/* entering a tick expires the whole bucket it reuses, those entries were last seen a full window ago */
+static void AdvanceTick(CoapMsgIdWindow *window, uint64_t nowSeconds)
+{
+    uint64_t tick = nowSeconds / window->bucketSeconds;
+    if (tick <= window->curTick) {
+        return;
+    }
+    uint64_t steps = tick - window->curTick;
+    if (steps > COAP_MSGID_WINDOW_BUCKET_NUM) {
+        steps = COAP_MSGID_WINDOW_BUCKET_NUM;
+    }
+    for (uint64_t i = 1; i <= steps; i++) {
+        uint8_t bucket = (uint8_t)((window->curTick + i) % COAP_MSGID_WINDOW_BUCKET_NUM);
+        while (window->bucketHead[bucket] != COAP_MSGID_WINDOW_INVALID_IDX) {
+            RemoveEntry(window, window->bucketHead[bucket]);
+            window->expireNum++;
+        }
+    }
+    window->curTick = tick;
+}
+
+static void EvictOldest(CoapMsgIdWindow *window)
+{
+    for (uint32_t i = 1; i <= COAP_MSGID_WINDOW_BUCKET_NUM; i++) {
+        uint8_t bucket = (uint8_t)((window->curTick + i) % COAP_MSGID_WINDOW_BUCKET_NUM);
+        if (window->bucketHead[bucket] != COAP_MSGID_WINDOW_INVALID_IDX) {
+            RemoveEntry(window, window->bucketHead[bucket]);
+            window->evictNum++;
+            IncStatistics(STATS_DROP_MSG_ID);
+            return;
+        }
+    }
+}
+
+bool CoapMsgIdWindowRefresh(CoapMsgIdWindow *window, const CoapMsgIdKey *key, uint64_t nowSeconds)
+{
+    if (window == NULL || key == NULL || window->entry == NULL) {
+        return NSTACKX_TRUE;
+    }
+    AdvanceTick(window, nowSeconds);
+    uint8_t bucket = (uint8_t)(window->curTick % COAP_MSGID_WINDOW_BUCKET_NUM);
+    uint32_t hash = HashKey(key);
+    uint32_t slot = hash & window->hashMask;
+    for (uint32_t idx = window->hashHead[slot]; idx != COAP_MSGID_WINDOW_INVALID_IDX;
+        idx = window->entry[idx].hashNext) {
+        CoapMsgIdEntry *entry = &window->entry[idx];
+        if (entry->hash != hash || !IsKeyEqual(&entry->key, key)) {
+            continue;
+        }
+        if (entry->bucket != bucket) {
+            BucketUnlink(window, idx);
+            BucketAppend(window, idx, bucket);
+        }
+        window->repeatNum++;
+        return NSTACKX_FALSE;
+    }
+
+    if (window->freeHead == COAP_MSGID_WINDOW_INVALID_IDX) {
+        EvictOldest(window);
+    }
+    uint32_t idx = window->freeHead;
+    CoapMsgIdEntry *entry = &window->entry[idx];
+    window->freeHead = entry->next;
+    entry->key = *key;
+    entry->hash = hash;
+    entry->hashNext = window->hashHead[slot];
+    window->hashHead[slot] = idx;
+    BucketAppend(window, idx, bucket);
+    window->num++;
+    return NSTACKX_TRUE;
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -32,6 +32,30 @@
 
 static const int DEVICE_TYPE_DEFAULT = 0;
 
+#define SERVICE_DISCOVER_CACHE_NUM 16
+/* ,"seqNo":65535} and the terminating null */
+#define SEQUENCE_NUMBER_SUFFIX_LEN 32
+
+/*
+ * Serialized discover payload of one (iface, broadcast/unicast, business type) without the sequence number,
+ * the closing brace is cut so the current sequence number is appended at send time.
+ * Only used from the event thread.
+ */
+typedef struct {
+    uint8_t isUsed;
+    uint8_t af;
+    uint8_t isBroadcast;
+    uint8_t businessType;
+    uint32_t version;
+    char localIpStr[NSTACKX_MAX_IP_STRING_LEN];
+    char serviceData[NSTACKX_MAX_SERVICE_DATA_LEN];
+    char *prefix;
+    size_t prefixLen;
+} ServiceDiscoverCache;
+
+static ServiceDiscoverCache g_serviceDiscoverCache[SERVICE_DISCOVER_CACHE_NUM];
+static uint32_t g_serviceDiscoverCacheVictim = 0;
+
 static int32_t AddDeviceType(cJSON *data, const DeviceInfo *deviceInfo)
 {
     cJSON *item = NULL;
@@ -439,7 +463,7 @@ static int JsonAddStr(cJSON *data, const char *key, const char *value)
     return NSTACKX_EOK;
 }
 
-static char *PrepareServiceDiscoverEx(const struct DiscoverInfo *info)
+static char *PrepareServiceDiscoverEx(const struct DiscoverInfo *info, uint8_t addSequenceNumber)
 {
     cJSON *data = cJSON_CreateObject();
     if (data == NULL) {
@@ -453,7 +477,7 @@ static char *PrepareServiceDiscoverEx(const struct DiscoverInfo *info)
         (JsonAddStr(data, JSON_DEVICE_WLAN_IP, info->localIpStr) != NSTACKX_EOK) ||
         (AddCapabilityBitmapData(data, info, deviceInfo) != NSTACKX_EOK) ||
         (AddBusinessJsonData(data, deviceInfo, info->isBroadcast, info->businessType) != NSTACKX_EOK) ||
-        (AddSequenceNumber(data, info->af, info->isBroadcast) != NSTACKX_EOK)) {
+        (addSequenceNumber && AddSequenceNumber(data, info->af, info->isBroadcast) != NSTACKX_EOK)) {
         DFINDER_LOGE(TAG, "Add json data failed");
         goto L_END_JSON;
     }
@@ -490,6 +514,116 @@ L_END_JSON:
     return formatString;
 }
 
+static inline const char *GetDiscoverServiceData(const struct DiscoverInfo *info)
+{
+    return (info->serviceData == NULL) ? "" : info->serviceData;
+}
+
+static bool IsServiceDiscoverCacheable(const struct DiscoverInfo *info)
+{
+    /* a per request capability override is rare, it is serialized in full */
+    if (info->responseSettings != NULL && info->responseSettings->capBitmapNum != 0) {
+        return false;
+    }
+    return strlen(info->localIpStr) < NSTACKX_MAX_IP_STRING_LEN &&
+        strlen(GetDiscoverServiceData(info)) < NSTACKX_MAX_SERVICE_DATA_LEN;
+}
+
+static bool IsServiceDiscoverCacheMatch(const ServiceDiscoverCache *cache, const struct DiscoverInfo *info)
+{
+    return cache->isUsed && cache->af == info->af && cache->isBroadcast == info->isBroadcast &&
+        cache->businessType == info->businessType && strcmp(cache->localIpStr, info->localIpStr) == 0 &&
+        strcmp(cache->serviceData, GetDiscoverServiceData(info)) == 0;
+}
+
+static ServiceDiscoverCache *GetServiceDiscoverCache(const struct DiscoverInfo *info)
+{
+    ServiceDiscoverCache *unused = NULL;
+    for (uint32_t i = 0; i < SERVICE_DISCOVER_CACHE_NUM; i++) {
+        ServiceDiscoverCache *cache = &g_serviceDiscoverCache[i];
+        if (IsServiceDiscoverCacheMatch(cache, info)) {
+            return cache;
+        }
+        if (!cache->isUsed && unused == NULL) {
+            unused = cache;
+        }
+    }
+    if (unused != NULL) {
+        return unused;
+    }
+    ServiceDiscoverCache *victim = &g_serviceDiscoverCache[g_serviceDiscoverCacheVictim];
+    g_serviceDiscoverCacheVictim = (g_serviceDiscoverCacheVictim + 1) % SERVICE_DISCOVER_CACHE_NUM;
+    return victim;
+}
+
+static void ResetServiceDiscoverCache(ServiceDiscoverCache *cache)
+{
+    if (cache->prefix != NULL) {
+        cJSON_free(cache->prefix);
+    }
+    (void)memset_s(cache, sizeof(ServiceDiscoverCache), 0, sizeof(ServiceDiscoverCache));
+}
+
+static int32_t UpdateServiceDiscoverCache(ServiceDiscoverCache *cache, const struct DiscoverInfo *info,
+    uint32_t version)
+{
+    ResetServiceDiscoverCache(cache);
+    char *str = PrepareServiceDiscoverEx(info, NSTACKX_FALSE);
+    if (str == NULL) {
+        return NSTACKX_EFAILED;
+    }
+    size_t len = strlen(str);
+    if (len == 0 || str[len - 1] != '}') {
+        DFINDER_LOGE(TAG, "unexpected service discover payload");
+        cJSON_free(str);
+        return NSTACKX_EFAILED;
+    }
+    (void)strcpy_s(cache->localIpStr, sizeof(cache->localIpStr), info->localIpStr);
+    (void)strcpy_s(cache->serviceData, sizeof(cache->serviceData), GetDiscoverServiceData(info));
+    cache->af = info->af;
+    cache->isBroadcast = info->isBroadcast;
+    cache->businessType = info->businessType;
+    cache->version = version;
+    cache->prefix = str;
+    cache->prefixLen = len - 1;
+    cache->isUsed = NSTACKX_TRUE;
+    return NSTACKX_EOK;
+}
+
+static char *PrepareServiceDiscoverFromCache(const struct DiscoverInfo *info)
+{
+    /* read the version before serializing, a change racing with the build leaves the entry stale */
+    uint32_t version = GetLocalDeviceInfoVersion();
+    ServiceDiscoverCache *cache = GetServiceDiscoverCache(info);
+    if ((!cache->isUsed || cache->version != version) &&
+        UpdateServiceDiscoverCache(cache, info, version) != NSTACKX_EOK) {
+        return NULL;
+    }
+
+    size_t size = cache->prefixLen + SEQUENCE_NUMBER_SUFFIX_LEN;
+    char *str = (char *)cJSON_malloc(size);
+    if (str == NULL) {
+        DFINDER_LOGE(TAG, "malloc service discover payload failed");
+        return NULL;
+    }
+    if (memcpy_s(str, size, cache->prefix, cache->prefixLen) != EOK ||
+        sprintf_s(str + cache->prefixLen, size - cache->prefixLen, ",\"%s\":%hu}", JSON_SEQUENCE_NUMBER,
+        GetSequenceNumber(info->af, info->isBroadcast)) < 0) {
+        DFINDER_LOGE(TAG, "append sequence number failed");
+        cJSON_free(str);
+        return NULL;
+    }
+    return str;
+}
+
+void ClearServiceDiscoverCache(void)
+{
+    for (uint32_t i = 0; i < SERVICE_DISCOVER_CACHE_NUM; i++) {
+        ResetServiceDiscoverCache(&g_serviceDiscoverCache[i]);
+    }
+    g_serviceDiscoverCacheVictim = 0;
+}
+
 char *PrepareServiceDiscover(const struct DiscoverInfo *info)
 {
     if (info == NULL || info->localIpStr == NULL) {
@@ -497,7 +631,8 @@ char *PrepareServiceDiscover(const struct DiscoverInfo *info)
         return NULL;
     }
 
-    char *str = PrepareServiceDiscoverEx(info);
+    char *str = IsServiceDiscoverCacheable(info) ? PrepareServiceDiscoverFromCache(info) :
+        PrepareServiceDiscoverEx(info, NSTACKX_TRUE);
     if (str == NULL) {
         DFINDER_LOGE(TAG, "prepare service discover ex failed");
         IncStatistics(STATS_PREPARE_SD_MSG_FAILED);
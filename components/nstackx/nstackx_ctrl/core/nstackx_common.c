@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -2100,7 +2100,8 @@ static void GetDeviceListInner(void *argument)
 {
     GetDeviceListMessage *message = argument;
 
-    GetDeviceList(message->deviceList, message->deviceCountPtr, true);
+    // only copy on the event thread, the caller thread builds the notify info
+    (void)GetDeviceListSnapshot(&message->snapshot, &message->snapshotNum, message->maxDeviceNum, true);
     SemPost(&message->wait);
 }
 #endif
@@ -2109,8 +2110,8 @@ int32_t NSTACKX_GetDeviceList(NSTACKX_DeviceInfo *deviceList, uint32_t *deviceCo
 {
 #ifdef DFINDER_SAVE_DEVICE_LIST
     GetDeviceListMessage message = {
-        .deviceList = deviceList,
-        .deviceCountPtr = deviceCountPtr,
+        .snapshot = NULL,
+        .snapshotNum = 0,
     };
     if (g_nstackInitState != NSTACKX_INIT_STATE_DONE) {
         DFINDER_LOGE(TAG, "NSTACKX_Ctrl is not initiated yet");
@@ -2124,6 +2125,7 @@ int32_t NSTACKX_GetDeviceList(NSTACKX_DeviceInfo *deviceList, uint32_t *deviceCo
         GetDeviceList(deviceList, deviceCountPtr, true);
         return NSTACKX_EOK;
     }
+    message.maxDeviceNum = *deviceCountPtr;
     if (SemInit(&message.wait, 0, 0)) {
         return NSTACKX_EFAILED;
     }
@@ -2134,6 +2136,7 @@ int32_t NSTACKX_GetDeviceList(NSTACKX_DeviceInfo *deviceList, uint32_t *deviceCo
     }
     SemWait(&message.wait);
     SemDestroy(&message.wait);
+    GetDeviceListSnapshotToDeviceInfo(message.snapshot, message.snapshotNum, deviceList, deviceCountPtr);
     return NSTACKX_EOK;
 #else
     (void)deviceList;
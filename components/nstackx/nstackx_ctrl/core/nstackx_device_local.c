@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -27,6 +27,7 @@
 #include "nstackx_device_remote.h"
 #include "nstackx_list.h"
 #include "nstackx_inet.h"
+#include "json_payload.h"
 
 #define TAG "LOCALDEVICE"
 enum {
@@ -80,6 +81,18 @@ static pthread_mutex_t g_serviceDataLock = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t g_businessDataLock = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t g_extendServiceDataLock = PTHREAD_MUTEX_INITIALIZER;
 static pthread_mutex_t g_deviceInfoLock = PTHREAD_MUTEX_INITIALIZER;
+/* bumped after every write of the local device info, failed ones included, stale discover payloads are rebuilt */
+static atomic_t g_localDeviceInfoVersion = 0;
+
+static inline void LocalDeviceInfoChanged(void)
+{
+    (void)NSTACKX_ATOM_FETCH_INC(&g_localDeviceInfoVersion);
+}
+
+uint32_t GetLocalDeviceInfoVersion(void)
+{
+    return (uint32_t)NSTACKX_ATOM_FETCH(&g_localDeviceInfoVersion);
+}
 
 static void LocalDeviceTimeout(void *data)
 {
@@ -137,6 +150,7 @@ void LocalDeviceDeinit(void)
         g_localDevice.timer = NULL;
     }
 
+    ClearServiceDiscoverCache();
     g_localDevice.inited = NSTACKX_FALSE;
 }
 
@@ -545,7 +559,10 @@ int RegisterLocalDeviceV2(const NSTACKX_LocalDeviceInfoV2 *devInfo, int register
         RemoveSpecifiedLocalIface(devInfo->localIfInfo, devInfo->ifNums);
     }
 
-    if (CopyDeviceInfoV2(devInfo) != NSTACKX_EOK) {
+    int ret = CopyDeviceInfoV2(devInfo);
+    /* a failed copy may leave the device id or name half written, so bump on every path */
+    LocalDeviceInfoChanged();
+    if (ret != NSTACKX_EOK) {
         if (PthreadMutexUnlock(&g_deviceInfoLock) != 0) {
             DFINDER_LOGE(TAG, "failed to unlock");
         }
@@ -584,6 +601,7 @@ void ConfigureLocalDeviceName(const char *localDeviceName)
             DFINDER_LOGE(TAG, "config device name failed and cannot restore!");
         }
     }
+    LocalDeviceInfoChanged();
 }
 
 void SetLocalDeviceHash(uint64_t deviceHash)
@@ -594,6 +612,7 @@ void SetLocalDeviceHash(uint64_t deviceHash)
         "%ju", deviceHash) == -1) {
         DFINDER_LOGE(TAG, "set device hash error");
     }
+    LocalDeviceInfoChanged();
 }
 
 int SetLocalDeviceCapability(uint32_t capabilityBitmapNum, uint32_t capabilityBitmap[])
@@ -610,6 +629,7 @@ int SetLocalDeviceCapability(uint32_t capabilityBitmapNum, uint32_t capabilityBi
         if (memcpy_s(g_localDevice.deviceInfo.capabilityBitmap, sizeof(g_localDevice.deviceInfo.capabilityBitmap),
             capabilityBitmap, sizeof(uint32_t) * capabilityBitmapNum) != EOK) {
             DFINDER_LOGE(TAG, "capabilityBitmap copy error");
+            LocalDeviceInfoChanged();
             if (PthreadMutexUnlock(&g_capabilityLock) != 0) {
                 DFINDER_LOGE(TAG, "failed to unlock");
             }
@@ -618,6 +638,7 @@ int SetLocalDeviceCapability(uint32_t capabilityBitmapNum, uint32_t capabilityBi
     }
 
     g_localDevice.deviceInfo.capabilityBitmapNum = capabilityBitmapNum;
+    LocalDeviceInfoChanged();
     if (PthreadMutexUnlock(&g_capabilityLock) != 0) {
         DFINDER_LOGE(TAG, "failed to unlock");
         return NSTACKX_EFAILED;
@@ -631,7 +652,9 @@ int32_t SetLocalDeviceServiceData(const char *serviceData)
         DFINDER_LOGE(TAG, "failed to lock");
         return NSTACKX_EFAILED;
     }
-    if (strcpy_s(g_localDevice.deviceInfo.serviceData, NSTACKX_MAX_SERVICE_DATA_LEN, serviceData) != EOK) {
+    int ret = strcpy_s(g_localDevice.deviceInfo.serviceData, NSTACKX_MAX_SERVICE_DATA_LEN, serviceData);
+    LocalDeviceInfoChanged();
+    if (ret != EOK) {
         DFINDER_LOGE(TAG, "serviceData copy error");
         if (PthreadMutexUnlock(&g_serviceDataLock) != 0) {
             DFINDER_LOGE(TAG, "failed to unlock");
@@ -705,6 +728,9 @@ int32_t SetLocalDeviceServiceDataV2(const struct NSTACKX_ServiceData *param, uin
             ret = NSTACKX_EOK;
         }
     }
+    if (ret == NSTACKX_EOK) {
+        LocalDeviceInfoChanged();
+    }
     if (PthreadMutexUnlock(&g_serviceDataLock) != 0) {
         DFINDER_LOGE(TAG, "failed to unlock");
         return NSTACKX_EFAILED;
@@ -715,6 +741,7 @@ int32_t SetLocalDeviceServiceDataV2(const struct NSTACKX_ServiceData *param, uin
 void SetLocalDeviceBusinessType(uint8_t businessType)
 {
     g_localDevice.deviceInfo.businessType = businessType;
+    LocalDeviceInfoChanged();
 }
 
 uint8_t GetLocalDeviceBusinessType(void)
@@ -736,6 +763,7 @@ int SetLocalDeviceBusinessData(const char *data, bool unicast)
         ret = strcpy_s(g_localDevice.deviceInfo.businessData.businessDataBroadcast,
             NSTACKX_MAX_BUSINESS_DATA_LEN, data);
     }
+    LocalDeviceInfoChanged();
 
     if (ret != EOK) {
         DFINDER_LOGE(TAG, "businessData copy error, unicast: %d", unicast);
@@ -770,6 +798,7 @@ uint8_t GetLocalDeviceMode(void)
 void SetLocalDeviceMode(uint8_t mode)
 {
     g_localDevice.deviceInfo.mode = mode;
+    LocalDeviceInfoChanged();
 }
 
 #ifndef DFINDER_USE_MINI_NSTACKX
@@ -779,8 +808,10 @@ int32_t SetLocalDeviceExtendServiceData(const char *extendServiceData)
         DFINDER_LOGE(TAG, "failed to lock");
         return NSTACKX_EFAILED;
     }
-    if (strcpy_s(g_localDevice.deviceInfo.extendServiceData, NSTACKX_MAX_EXTEND_SERVICE_DATA_LEN,
-        extendServiceData) != EOK) {
+    int ret = strcpy_s(g_localDevice.deviceInfo.extendServiceData, NSTACKX_MAX_EXTEND_SERVICE_DATA_LEN,
+        extendServiceData);
+    LocalDeviceInfoChanged();
+    if (ret != EOK) {
         DFINDER_LOGE(TAG, "extendServiceData copy error");
         if (PthreadMutexUnlock(&g_extendServiceDataLock) != 0) {
             DFINDER_LOGE(TAG, "failed to unlock");
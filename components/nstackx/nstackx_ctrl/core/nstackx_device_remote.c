@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -34,6 +34,11 @@
 
 #define TAG "REMOTEDEVICE"
 #define REPORT_INTERVAL 1000 /* 1 SECOND */
+/* power of two, deviceId lookups run for every received discover or notify message */
+#define REMOTE_DEVICE_BUCKET_NUM 512
+#define REMOTE_DEVICE_BUCKET_MASK (REMOTE_DEVICE_BUCKET_NUM - 1)
+#define FNV_OFFSET_BASIS 2166136261U
+#define FNV_PRIME 16777619U
 struct RxIface_;
 struct RemoteDevice_;
 typedef struct RemoteNode_ {
@@ -56,25 +61,46 @@ typedef struct RxIface_ {
 
 typedef struct RemoteDevice_ {
     List node;
+    List hashNode;
+    uint32_t hash;
     char deviceId[NSTACKX_MAX_DEVICE_ID_LEN];
     List rxIfaceList;
 } RemoteDevice;
 
-static List *g_remoteDeviceList;
-static List *g_remoteDeviceListBackup;
+typedef struct {
+    List deviceList;
+    List bucket[REMOTE_DEVICE_BUCKET_NUM];
+} RemoteDeviceTable;
+
+static RemoteDeviceTable *g_remoteDeviceTable;
+static RemoteDeviceTable *g_remoteDeviceTableBackup;
 static List *g_remoteDeviceOrderedList;
 static uint32_t g_remoteNodeCount;
 static atomic_uint_fast32_t g_agingTime;
 static struct timespec g_lastReportedTime;
+
+static RemoteDeviceTable *CreateRemoteDeviceTable(void)
+{
+    RemoteDeviceTable *table = (RemoteDeviceTable *)malloc(sizeof(RemoteDeviceTable));
+    if (table == NULL) {
+        return NULL;
+    }
+    ListInitHead(&table->deviceList);
+    for (uint32_t i = 0; i < REMOTE_DEVICE_BUCKET_NUM; i++) {
+        ListInitHead(&table->bucket[i]);
+    }
+    return table;
+}
+
 int32_t RemoteDeviceListInit(void)
 {
-    g_remoteDeviceList = (List *)malloc(sizeof(List));
-    if (g_remoteDeviceList == NULL) {
+    g_remoteDeviceTable = CreateRemoteDeviceTable();
+    if (g_remoteDeviceTable == NULL) {
         DFINDER_LOGE(TAG, "malloc remote device list failed");
         goto FAIL;
     }
-    g_remoteDeviceListBackup = (List *)malloc(sizeof(List));
-    if (g_remoteDeviceListBackup == NULL) {
+    g_remoteDeviceTableBackup = CreateRemoteDeviceTable();
+    if (g_remoteDeviceTableBackup == NULL) {
         DFINDER_LOGE(TAG, "malloc remote device backup list failed");
         goto FAIL;
     }
@@ -83,18 +109,16 @@ int32_t RemoteDeviceListInit(void)
         DFINDER_LOGE(TAG, "malloc remote device ordered list failed");
         goto FAIL;
     }
-    ListInitHead(g_remoteDeviceList);
-    ListInitHead(g_remoteDeviceListBackup);
     ListInitHead(g_remoteDeviceOrderedList);
     g_remoteNodeCount = 0;
     return NSTACKX_EOK;
 
 FAIL:
-    free(g_remoteDeviceList);
-    g_remoteDeviceList = NULL;
+    free(g_remoteDeviceTable);
+    g_remoteDeviceTable = NULL;
 
-    free(g_remoteDeviceListBackup);
-    g_remoteDeviceListBackup = NULL;
+    free(g_remoteDeviceTableBackup);
+    g_remoteDeviceTableBackup = NULL;
 
     return NSTACKX_EFAILED;
 }
@@ -135,6 +159,7 @@ void DestroyRemoteDevice(RemoteDevice *device)
         DestroyRxIface(rxIface);
     }
     ListRemoveNode(&device->node);
+    ListRemoveNode(&device->hashNode);
     free(device);
 }
 
@@ -146,15 +171,15 @@ static void DestroyRemoteNodeAndDevice(RxIface *rxIface, RemoteNode *node)
     }
 }
 
-static void ClearRemoteDeviceList(List *list)
+static void ClearRemoteDeviceList(RemoteDeviceTable *table)
 {
-    if (list == NULL) {
+    if (table == NULL) {
         return;
     }
     List *pos = NULL;
     List *tmp = NULL;
     RemoteDevice *device = NULL;
-    LIST_FOR_EACH_SAFE(pos, tmp, list) {
+    LIST_FOR_EACH_SAFE(pos, tmp, &table->deviceList) {
         device = (RemoteDevice *)pos;
         DestroyRemoteDevice(device);
     }
@@ -162,12 +187,12 @@ static void ClearRemoteDeviceList(List *list)
 
 void RemoteDeviceListDeinit(void)
 {
-    ClearRemoteDeviceList(g_remoteDeviceList);
-    free(g_remoteDeviceList);
-    g_remoteDeviceList = NULL;
-    ClearRemoteDeviceList(g_remoteDeviceListBackup);
-    free(g_remoteDeviceListBackup);
-    g_remoteDeviceListBackup = NULL;
+    ClearRemoteDeviceList(g_remoteDeviceTable);
+    free(g_remoteDeviceTable);
+    g_remoteDeviceTable = NULL;
+    ClearRemoteDeviceList(g_remoteDeviceTableBackup);
+    free(g_remoteDeviceTableBackup);
+    g_remoteDeviceTableBackup = NULL;
     free(g_remoteDeviceOrderedList);
     g_remoteDeviceOrderedList = NULL;
     g_remoteNodeCount = 0;
@@ -175,31 +200,53 @@ void RemoteDeviceListDeinit(void)
 
 void ClearRemoteDeviceListBackup(void)
 {
-    ClearRemoteDeviceList(g_remoteDeviceListBackup);
+    ClearRemoteDeviceList(g_remoteDeviceTableBackup);
 }
 
 void BackupRemoteDeviceList(void)
 {
-    ClearRemoteDeviceList(g_remoteDeviceListBackup);
-    List *tmp = g_remoteDeviceListBackup;
-    g_remoteDeviceListBackup = g_remoteDeviceList;
-    g_remoteDeviceList = tmp;
+    ClearRemoteDeviceList(g_remoteDeviceTableBackup);
+    RemoteDeviceTable *tmp = g_remoteDeviceTableBackup;
+    g_remoteDeviceTableBackup = g_remoteDeviceTable;
+    g_remoteDeviceTable = tmp;
     g_remoteNodeCount = 0;
 }
 
-static RemoteDevice *FindRemoteDevice(List *list, const char *deviceId)
+static uint32_t RemoteDeviceIdHash(const char *deviceId)
 {
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for (const uint8_t *p = (const uint8_t *)deviceId; *p != '\0'; p++) {
+        hash ^= *p;
+        hash *= FNV_PRIME;
+    }
+    return hash;
+}
+
+static __inline RemoteDevice *HashNodeEntry(List *node)
+{
+    return (RemoteDevice *)((char *)(node) - (uintptr_t)(&(((RemoteDevice *)0)->hashNode)));
+}
+
+static RemoteDevice *FindRemoteDevice(RemoteDeviceTable *table, const char *deviceId)
+{
+    uint32_t hash = RemoteDeviceIdHash(deviceId);
     List *pos = NULL;
     RemoteDevice *device = NULL;
-    LIST_FOR_EACH(pos, list) {
-        device = (RemoteDevice *)pos;
-        if (strcmp(device->deviceId, deviceId) == 0) {
+    LIST_FOR_EACH(pos, &table->bucket[hash & REMOTE_DEVICE_BUCKET_MASK]) {
+        device = HashNodeEntry(pos);
+        if (device->hash == hash && strcmp(device->deviceId, deviceId) == 0) {
             return device;
         }
     }
     return NULL;
 }
 
+static void AddRemoteDeviceToTable(RemoteDeviceTable *table, RemoteDevice *device)
+{
+    ListInsertTail(&table->deviceList, &device->node);
+    ListInsertTail(&table->bucket[device->hash & REMOTE_DEVICE_BUCKET_MASK], &device->hashNode);
+}
+
 static RxIface *FindRxIface(const RemoteDevice* device, const NSTACKX_InterfaceInfo *interfaceInfo)
 {
     List *pos = NULL;
@@ -243,6 +290,7 @@ static RemoteDevice *CreateRemoteDevice(const char *deviceId)
         free(device);
         return NULL;
     }
+    device->hash = RemoteDeviceIdHash(deviceId);
     ListInitHead(&(device->rxIfaceList));
     return device;
 }
@@ -667,13 +715,13 @@ int32_t UpdateRemoteNodeByDeviceInfo(const char *deviceId, const NSTACKX_Interfa
         return NSTACKX_EFAILED;
     }
 
-    RemoteDevice *device = FindRemoteDevice(g_remoteDeviceList, deviceId);
+    RemoteDevice *device = FindRemoteDevice(g_remoteDeviceTable, deviceId);
     if (device == NULL) {
         device = CreateRemoteDevice(deviceId);
         if (device == NULL) {
             return NSTACKX_EFAILED;
         }
-        ListInsertTail(g_remoteDeviceList, &(device->node));
+        AddRemoteDeviceToTable(g_remoteDeviceTable, device);
     }
 
     RxIface *rxIface = FindRxIface(device, interfaceInfo);
@@ -716,84 +764,106 @@ FAIL_AND_FREE:
 
     if (ListIsEmpty(&device->rxIfaceList)) {
         ListRemoveNode(&device->node);
+        ListRemoveNode(&device->hashNode);
         free(device);
     }
     return NSTACKX_EFAILED;
 }
 
-static int32_t CopyRemoteNodeToDeviceInfo(DeviceInfo *deviceInfo, NSTACKX_DeviceInfo *deviceList,
-    uint32_t *count, bool doFilter)
+static bool IsRemoteNodeToReport(const DeviceInfo *deviceInfo, bool doFilter)
 {
     if (doFilter && !MatchDeviceFilter(deviceInfo)) {
         DFINDER_LOGI(TAG, "Filter device");
-        return NSTACKX_EOK;
+        return false;
     }
 
     if (GetIsNotifyPerDevice() == true && deviceInfo->update != NSTACKX_TRUE) {
-        return NSTACKX_EOK;
+        return false;
     }
+    return true;
+}
 
-    if (GetNotifyDeviceInfo(&deviceList[*count], deviceInfo) != NSTACKX_EOK) {
-        DFINDER_LOGE(TAG, "GetNotifyDeviceInfo failed");
-        return NSTACKX_EFAILED;
+static uint32_t CountRemoteNodes(void)
+{
+    uint32_t count = 0;
+    List *pos = NULL;
+    LIST_FOR_EACH(pos, &g_remoteDeviceTable->deviceList) {
+        List *ifacePos = NULL;
+        LIST_FOR_EACH(ifacePos, &((RemoteDevice *)pos)->rxIfaceList) {
+            count += ((RxIface *)ifacePos)->remoteNodeCnt;
+        }
     }
-
-    deviceList[*count].update = deviceInfo->update;
-    deviceInfo->update = NSTACKX_FALSE;
-    ++(*count);
-    return NSTACKX_EOK;
+    return count;
 }
 
-static int32_t CopyRemoteNodeListToDeviceInfo(List *rxIfaceList, NSTACKX_DeviceInfo *deviceList,
-    uint32_t maxDeviceNum, uint32_t *deviceCountPtr, bool doFilter)
+static void CopyRemoteNodeListToSnapshot(List *remoteNodeList, DeviceInfo *snapshot, uint32_t maxNum,
+    uint32_t *count, bool doFilter)
 {
     List *pos = NULL;
-    RemoteNode *remoteNode = NULL;
-    int32_t ret;
-    LIST_FOR_EACH(pos, rxIfaceList) {
-        if (*deviceCountPtr >= maxDeviceNum) {
-            break;
+    LIST_FOR_EACH(pos, remoteNodeList) {
+        if (*count >= maxNum) {
+            return;
         }
-        remoteNode = (RemoteNode *)pos;
-        ret = CopyRemoteNodeToDeviceInfo(&(remoteNode->deviceInfo), deviceList, deviceCountPtr, doFilter);
-        if (ret != NSTACKX_EOK) {
-            DFINDER_LOGE(TAG, "copy remote node to deviceinfo failed");
-            return NSTACKX_EFAILED;
+        DeviceInfo *deviceInfo = &((RemoteNode *)pos)->deviceInfo;
+        if (!IsRemoteNodeToReport(deviceInfo, doFilter)) {
+            continue;
         }
+        (void)memcpy_s(&snapshot[*count], sizeof(DeviceInfo), deviceInfo, sizeof(DeviceInfo));
+        deviceInfo->update = NSTACKX_FALSE;
+        ++(*count);
     }
-    return NSTACKX_EOK;
 }
 
-static int32_t CopyRxIfaceListToDeviceInfo(List *rxIfaceList, NSTACKX_DeviceInfo *deviceList,
-    uint32_t maxDeviceNum, uint32_t *deviceCountPtr, bool doFilter)
+/*
+ * Copy the reportable nodes as they are. Building the notify info formats json for every device,
+ * GetDeviceListSnapshotToDeviceInfo does that work off the event thread.
+ */
+int32_t GetDeviceListSnapshot(DeviceInfo **snapshot, uint32_t *snapshotNum, uint32_t maxDeviceNum, bool doFilter)
 {
+    *snapshot = NULL;
+    *snapshotNum = 0;
+    if (g_remoteDeviceTable == NULL) {
+        return NSTACKX_EOK;
+    }
+    uint32_t maxNum = CountRemoteNodes();
+    if (maxNum > maxDeviceNum) {
+        maxNum = maxDeviceNum;
+    }
+    if (maxNum == 0) {
+        return NSTACKX_EOK;
+    }
+    DeviceInfo *list = (DeviceInfo *)malloc(sizeof(DeviceInfo) * maxNum);
+    if (list == NULL) {
+        DFINDER_LOGE(TAG, "malloc device list snapshot failed");
+        return NSTACKX_ENOMEM;
+    }
+    uint32_t count = 0;
     List *pos = NULL;
-    RxIface *rxIface = NULL;
-    LIST_FOR_EACH(pos, rxIfaceList) {
-        rxIface = (RxIface *)pos;
-        if (CopyRemoteNodeListToDeviceInfo(&rxIface->remoteNodeList, deviceList, maxDeviceNum,
-            deviceCountPtr, doFilter) != NSTACKX_EOK) {
-            DFINDER_LOGE(TAG, "copy remote node list to deviceinfo failed");
-            return NSTACKX_EFAILED;
+    LIST_FOR_EACH(pos, &g_remoteDeviceTable->deviceList) {
+        List *ifacePos = NULL;
+        LIST_FOR_EACH(ifacePos, &((RemoteDevice *)pos)->rxIfaceList) {
+            CopyRemoteNodeListToSnapshot(&((RxIface *)ifacePos)->remoteNodeList, list, maxNum, &count, doFilter);
         }
     }
+    *snapshot = list;
+    *snapshotNum = count;
     return NSTACKX_EOK;
 }
 
-static int32_t CopyRemoteDeviceListToDeviceInfo(NSTACKX_DeviceInfo *deviceList, uint32_t maxDeviceNum,
-    uint32_t *deviceCountPtr, bool doFilter)
+void GetDeviceListSnapshotToDeviceInfo(DeviceInfo *snapshot, uint32_t snapshotNum,
+    NSTACKX_DeviceInfo *deviceList, uint32_t *deviceListLen)
 {
-    List *pos = NULL;
-    RemoteDevice *device = NULL;
-    LIST_FOR_EACH(pos, g_remoteDeviceList) {
-        device = (RemoteDevice *)pos;
-        if (CopyRxIfaceListToDeviceInfo(&device->rxIfaceList, deviceList, maxDeviceNum,
-            deviceCountPtr, doFilter) != NSTACKX_EOK) {
-            DFINDER_LOGE(TAG, "copy rxIface list to deviceinfo failed");
-            return NSTACKX_EFAILED;
+    uint32_t count = 0;
+    for (uint32_t i = 0; i < snapshotNum && count < *deviceListLen; i++) {
+        if (GetNotifyDeviceInfo(&deviceList[count], &snapshot[i]) != NSTACKX_EOK) {
+            DFINDER_LOGE(TAG, "GetNotifyDeviceInfo failed");
+            break;
         }
+        deviceList[count].update = snapshot[i].update;
+        ++count;
     }
-    return NSTACKX_EOK;
+    *deviceListLen = count;
+    free(snapshot);
 }
 
 static void DestroyRxIfaceByIfnameInner(RemoteDevice *device, const char *ifName)
@@ -812,13 +882,13 @@ static void DestroyRxIfaceByIfnameInner(RemoteDevice *device, const char *ifName
 
 void DestroyRxIfaceByIfname(const char *ifName)
 {
-    if (g_remoteDeviceList == NULL) {
+    if (g_remoteDeviceTable == NULL) {
         return;
     }
     List *pos = NULL;
     List *tmp = NULL;
     RemoteDevice *device = NULL;
-    LIST_FOR_EACH_SAFE(pos, tmp, g_remoteDeviceList) {
+    LIST_FOR_EACH_SAFE(pos, tmp, &g_remoteDeviceTable->deviceList) {
         device = (RemoteDevice *)pos;
         DestroyRxIfaceByIfnameInner(device, ifName);
     }
@@ -855,9 +925,9 @@ static RxIface *GetRemoteDevcieFirstRxIface(RemoteDevice *device)
     return NULL;
 }
 
-const struct in_addr *GetRemoteDeviceIpInner(List *list, const char *deviceId)
+static const struct in_addr *GetRemoteDeviceIpInner(RemoteDeviceTable *table, const char *deviceId)
 {
-    RemoteDevice *device = FindRemoteDevice(list, deviceId);
+    RemoteDevice *device = FindRemoteDevice(table, deviceId);
     if (device == NULL || ListIsEmpty(&device->rxIfaceList)) {
         return NULL;
     }
@@ -878,11 +948,11 @@ const struct in_addr *GetRemoteDeviceIpInner(List *list, const char *deviceId)
 const struct in_addr *GetRemoteDeviceIp(const char *deviceId)
 {
     const struct in_addr *remoteIp;
-    remoteIp = GetRemoteDeviceIpInner(g_remoteDeviceList, deviceId);
+    remoteIp = GetRemoteDeviceIpInner(g_remoteDeviceTable, deviceId);
     if (remoteIp != NULL) {
         return remoteIp;
     }
-    return GetRemoteDeviceIpInner(g_remoteDeviceListBackup, deviceId);
+    return GetRemoteDeviceIpInner(g_remoteDeviceTableBackup, deviceId);
 }
 
 #ifdef NSTACKX_DFINDER_HIDUMP
@@ -916,7 +986,7 @@ int DumpRemoteDevice(char *buf, size_t len)
 {
     List *pos = NULL;
     size_t index = 0;
-    LIST_FOR_EACH(pos, g_remoteDeviceList) {
+    LIST_FOR_EACH(pos, &g_remoteDeviceTable->deviceList) {
         RemoteDevice *device = (RemoteDevice *)pos;
         int ret = DumpRemoteNode(device, buf + index, len - index);
         if (ret < 0 || (size_t)ret > len - index) {
@@ -942,9 +1012,12 @@ void GetDeviceList(NSTACKX_DeviceInfo *deviceList, uint32_t *deviceListLen, bool
         return;
     }
 
-    uint32_t maxDeviceNum = *deviceListLen;
-    uint32_t count = 0;
-    (void)CopyRemoteDeviceListToDeviceInfo(deviceList, maxDeviceNum, &count, doFilter);
-    *deviceListLen = count;
+    DeviceInfo *snapshot = NULL;
+    uint32_t snapshotNum = 0;
+    if (GetDeviceListSnapshot(&snapshot, &snapshotNum, *deviceListLen, doFilter) != NSTACKX_EOK) {
+        *deviceListLen = 0;
+        return;
+    }
+    GetDeviceListSnapshotToDeviceInfo(snapshot, snapshotNum, deviceList, deviceListLen);
 }
 #endif /* END OF DFINDER_SAVE_DEVICE_LIST */
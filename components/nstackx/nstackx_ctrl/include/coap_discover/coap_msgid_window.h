@@ -0,0 +1,81 @@
+/*
+ * Copyright (C) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef COAP_MSGID_WINDOW_H
+#define COAP_MSGID_WINDOW_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "nstackx_inet.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define COAP_MSGID_WINDOW_BUCKET_NUM 10
+/* a message id of a peer is caught as a repeat for this long */
+#define COAP_MSGID_SURVIVAL_SECONDS 100
+/* sized for 1000 peers each sending 3 message ids within the survival time, with room left over */
+#define COAP_MSGID_WINDOW_CAPACITY 4096
+#define COAP_MSGID_WINDOW_INVALID_IDX UINT32_MAX
+
+typedef struct {
+    uint8_t af;
+    uint16_t port;
+    uint16_t msgId;
+    union InetAddr addr;
+} CoapMsgIdKey;
+
+typedef struct {
+    CoapMsgIdKey key;
+    uint32_t hash;
+    uint32_t hashNext;
+    uint32_t prev;
+    uint32_t next;
+    uint8_t bucket;
+} CoapMsgIdEntry;
+
+/*
+ * Recently seen (peer, message id) pairs. Entries sit in the time bucket of their last receive and a whole
+ * bucket expires at once, so an entry lives between survival - survival / COAP_MSGID_WINDOW_BUCKET_NUM and
+ * survival seconds. When every entry is taken the oldest one is evicted and counted.
+ * Only used from the event thread, there is no lock.
+ */
+typedef struct {
+    uint32_t capacity;
+    uint32_t hashMask;
+    uint32_t bucketSeconds;
+    uint32_t num;
+    uint32_t freeHead;
+    uint64_t curTick;
+    uint32_t *hashHead;
+    CoapMsgIdEntry *entry;
+    uint32_t bucketHead[COAP_MSGID_WINDOW_BUCKET_NUM];
+    uint32_t bucketTail[COAP_MSGID_WINDOW_BUCKET_NUM];
+    uint64_t repeatNum;
+    uint64_t expireNum;
+    uint64_t evictNum;
+} CoapMsgIdWindow;
+
+int32_t CoapMsgIdWindowInit(CoapMsgIdWindow *window, uint32_t capacity, uint32_t survivalSeconds);
+void CoapMsgIdWindowDeinit(CoapMsgIdWindow *window);
+/* returns true when the pair was not seen within the window, a repeat only refreshes its receive time */
+bool CoapMsgIdWindowRefresh(CoapMsgIdWindow *window, const CoapMsgIdKey *key, uint64_t nowSeconds);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* COAP_MSGID_WINDOW_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -54,7 +54,9 @@ struct DiscoverInfo {
     const NSTACKX_ResponseSettings *responseSettings;
 };
 
+/* the returned payload is released by cJSON_free */
 char *PrepareServiceDiscover(const struct DiscoverInfo *info);
+void ClearServiceDiscoverCache(void);
 int32_t ParseServiceDiscover(const uint8_t *buf, struct DeviceInfo *deviceInfo, char **remoteUrlPtr);
 char *PrepareServiceNotification(void);
 int32_t ParseServiceNotification(const uint8_t *buf, NSTACKX_NotificationConfig *config);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -23,16 +23,17 @@
 extern "C" {
 #endif
 
+struct DeviceInfo;
+
 #ifdef DFINDER_SAVE_DEVICE_LIST
 typedef struct {
-    NSTACKX_DeviceInfo *deviceList;
-    uint32_t *deviceCountPtr;
+    uint32_t maxDeviceNum;
+    struct DeviceInfo *snapshot;
+    uint32_t snapshotNum;
     sem_t wait;
 } GetDeviceListMessage;
 #endif
 
-struct DeviceInfo;
-
 #ifdef DFINDER_SUPPORT_COVERITY_TAINTED_SET
 void Coverity_Tainted_Set(void *buf);
 #else
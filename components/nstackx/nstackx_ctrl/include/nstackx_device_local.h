@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -47,6 +47,7 @@ int SetLocalDeviceBusinessData(const char *data, bool unicast);
 int32_t LocalizeNotificationMsg(const char *msg);
 uint8_t GetLocalDeviceMode(void);
 void SetLocalDeviceMode(uint8_t mode);
+uint32_t GetLocalDeviceInfoVersion(void);
 
 #ifndef DFINDER_USE_MINI_NSTACKX
 int32_t SetLocalDeviceExtendServiceData(const char *extendServiceData);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -33,6 +33,10 @@ int32_t UpdateRemoteNodeByDeviceInfo(const char *deviceId, const NSTACKX_Interfa
     const DeviceInfo *deviceInfo, int8_t *updated);
 
 void GetDeviceList(NSTACKX_DeviceInfo *deviceList, uint32_t *deviceCountPtr, bool doFilter);
+int32_t GetDeviceListSnapshot(DeviceInfo **snapshot, uint32_t *snapshotNum, uint32_t maxDeviceNum, bool doFilter);
+/* fill the notify device list from a snapshot and free the snapshot */
+void GetDeviceListSnapshotToDeviceInfo(DeviceInfo *snapshot, uint32_t snapshotNum,
+    NSTACKX_DeviceInfo *deviceList, uint32_t *deviceListLen);
 void SetDeviceListAgingTime(uint32_t agingTime);
 void RemoveOldestNodesWithCount(uint32_t diffNum);
 uint32_t GetRemoteNodeCount(void);
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -18,6 +18,8 @@
 
 #include "nstackx_common_header.h"
 
+#define NSTACKX_SEND_BATCH_MAX 64 /* datagrams sent by one SocketSendBatch call at most */
+
 typedef enum SocketProtocol {
     NSTACKX_PROTOCOL_TCP = 0,
     NSTACKX_PROTOCOL_UDP,
@@ -44,6 +46,7 @@ void CloseSocket(Socket *socket);
 Socket *AcceptSocket(Socket *serverSocket);
 int32_t SocketSend(const Socket *socket, const uint8_t *buffer, size_t length);
 int32_t SocketSendEx(const Socket *socket, uint16_t mss, const struct iovec *iov, uint32_t cnt);
+int32_t SocketSendBatch(const Socket *socket, const struct iovec *iov, uint32_t cnt);
 void CheckGSOSupport(void);
 int32_t SocketRecv(Socket *socket, uint8_t *buffer, size_t length, struct sockaddr_in *srcAddr,
                    const socklen_t *addrLen);
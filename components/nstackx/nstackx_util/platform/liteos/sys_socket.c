@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -117,3 +117,24 @@ int32_t SocketSendEx(const Socket *s, uint16_t mss, const struct iovec *iov, uin
     return ret;
 }
 
+/* no sendmmsg here, sends iov[i] as datagram i one by one and returns the number of leading datagrams sent */
+int32_t SocketSendBatch(const Socket *s, const struct iovec *iov, uint32_t cnt)
+{
+    uint32_t sent = 0;
+
+    if (!IsSocketValid(s) || iov == NULL || cnt == 0) {
+        LOGE(TAG, "invalid socket input\n");
+        return NSTACKX_EFAILED;
+    }
+    if (cnt > NSTACKX_SEND_BATCH_MAX) {
+        cnt = NSTACKX_SEND_BATCH_MAX;
+    }
+    while (sent < cnt) {
+        if (sendto(s->sockfd, iov[sent].iov_base, iov[sent].iov_len, 0, (struct sockaddr *)&s->dstAddr,
+            sizeof(struct sockaddr_in)) <= 0) {
+            break;
+        }
+        sent++;
+    }
+    return (sent > 0) ? (int32_t)sent : CheckSocketError();
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (C) 2021 Huawei Device Co., Ltd.
+ * Copyright (C) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -97,6 +97,34 @@ int32_t SocketSendEx(const Socket *s, uint16_t mss, const struct iovec *iov, uin
 
     return ret;
 }
+
+/* sends iov[i] as datagram i and returns the number of leading datagrams sent */
+int32_t SocketSendBatch(const Socket *s, const struct iovec *iov, uint32_t cnt)
+{
+    struct mmsghdr msgs[NSTACKX_SEND_BATCH_MAX];
+
+    if (!IsSocketValid(s) || iov == NULL || cnt == 0) {
+        LOGE(TAG, "invalid socket input\n");
+        return NSTACKX_EFAILED;
+    }
+    if (cnt > NSTACKX_SEND_BATCH_MAX) {
+        cnt = NSTACKX_SEND_BATCH_MAX;
+    }
+    (void)memset_s(msgs, sizeof(msgs), 0, sizeof(struct mmsghdr) * cnt);
+    for (uint32_t i = 0; i < cnt; i++) {
+        msgs[i].msg_hdr.msg_name = (struct sockaddr *)&s->dstAddr;
+        msgs[i].msg_hdr.msg_namelen = sizeof(struct sockaddr_in);
+        msgs[i].msg_hdr.msg_iov = (struct iovec *)&iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+
+    int32_t ret = (int32_t)sendmmsg(s->sockfd, msgs, cnt, 0);
+    if (ret <= 0) {
+        ret = CheckSocketError();
+    }
+    return ret;
+}
+
 #ifndef NSTACKX_WITH_LINUX
 static int32_t SendUdpSegment(struct sockaddr_in *sa)
 {
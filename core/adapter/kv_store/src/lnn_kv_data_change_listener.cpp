@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,7 +15,9 @@
 
 #include "lnn_kv_data_change_listener.h"
 
+#include <securec.h>
 #include <thread>
+#include <unordered_set>
 
 #include "anonymizer.h"
 #include "lnn_kv_adapter_wrapper.h"
@@ -25,6 +27,61 @@
 namespace OHOS {
 namespace {
 std::mutex g_LnnKvDataChangeListenerMutex;
+
+// a whole device info record is a json object, a field record is "value#stateVersion#timestamp"
+bool IsDeviceInfoRecord(const std::string &value)
+{
+    return !value.empty() && value.front() == '{';
+}
+
+char *CopyToSoftBusStr(const std::string &str)
+{
+    char *copy = static_cast<char *>(SoftBusCalloc(str.length() + 1));
+    if (copy == nullptr) {
+        return nullptr;
+    }
+    if (strcpy_s(copy, str.length() + 1, str.c_str()) != EOK) {
+        SoftBusFree(copy);
+        return nullptr;
+    }
+    return copy;
+}
+
+// the batch takes over the key and value arrays
+void SyncFieldRecordsToCache(const std::vector<DistributedKv::Entry> &records)
+{
+    if (records.empty()) {
+        return;
+    }
+    const char **keys = static_cast<const char **>(SoftBusCalloc(sizeof(char *) * records.size()));
+    const char **values = static_cast<const char **>(SoftBusCalloc(sizeof(char *) * records.size()));
+    if (keys == nullptr || values == nullptr) {
+        LNN_LOGE(LNN_LEDGER, "calloc field records fail");
+        SoftBusFree(keys);
+        SoftBusFree(values);
+        return;
+    }
+    int32_t num = 0;
+    for (const auto &item : records) {
+        char *key = CopyToSoftBusStr(item.key.ToString());
+        char *value = CopyToSoftBusStr(item.value.ToString());
+        if (key == nullptr || value == nullptr) {
+            LNN_LOGE(LNN_LEDGER, "copy field record fail");
+            SoftBusFree(key);
+            SoftBusFree(value);
+            continue;
+        }
+        keys[num] = key;
+        values[num] = value;
+        num++;
+    }
+    if (num == 0) {
+        SoftBusFree(keys);
+        SoftBusFree(values);
+        return;
+    }
+    (void)LnnDBDataUpdateChangeSyncToCache(keys, values, num);
+}
 } // namespace
 
 KvDataChangeListener::KvDataChangeListener(const std::string &appId, const std::string &storeId)
@@ -48,13 +105,21 @@ void KvDataChangeListener::OnChange(const DistributedKv::DataOrigin &origin, Key
         changeKeys.insert(changeKeys.end(), keys[ChangeOp::OP_INSERT].begin(), keys[ChangeOp::OP_INSERT].end());
         changeKeys.insert(changeKeys.end(), keys[ChangeOp::OP_UPDATE].begin(), keys[ChangeOp::OP_UPDATE].end());
         std::vector<DistributedKv::Entry> changeRecords = ConvertCloudChangeDataToEntries(changeKeys);
+        std::unordered_set<std::string> updateKeys(keys[ChangeOp::OP_UPDATE].begin(), keys[ChangeOp::OP_UPDATE].end());
 
         LNN_LOGI(LNN_LEDGER, "Handle kv data change! changeRecords=%{public}zu", changeRecords.size());
+        // field updates of a login burst are applied per device in one batch
+        std::vector<DistributedKv::Entry> fieldRecords;
         for (const auto &item : changeRecords) {
             std::string dbKey = item.key.ToString();
             std::string dbValue = item.value.ToString();
+            if (updateKeys.count(dbKey) != 0 && !IsDeviceInfoRecord(dbValue)) {
+                fieldRecords.emplace_back(item);
+                continue;
+            }
             LnnDBDataChangeSyncToCacheInner(dbKey.c_str(), dbValue.c_str());
         }
+        SyncFieldRecordsToCache(fieldRecords);
     };
     std::thread(autoSyncTask).detach();
 }
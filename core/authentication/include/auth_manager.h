@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -55,6 +55,10 @@ typedef struct {
     int32_t credIdType;
     bool isCreatedSessionKey;
     ListNode node;
+    /* authId index and handle refcount, protected by auth lock */
+    ListNode idNode;
+    uint32_t refCount;
+    bool isRemoved;
 } AuthManager;
 
 typedef struct {
@@ -80,6 +84,15 @@ AuthManager *GetAuthManagerByConnInfo(const AuthConnInfo *connInfo, bool isServe
 void RemoveAuthSessionKeyByIndex(int64_t authId, int32_t index, AuthLinkType type);
 void DelAuthManager(AuthManager *auth, int32_t type);
 void DelDupAuthManager(AuthManager *auth);
+/*
+ * Read-only handle without copy, only fields fixed at creation (authId, isServer, udid, version) may be read.
+ * Note: must call PutAuthManagerRef to release.
+ */
+const AuthManager *GetAuthManagerRef(int64_t authId);
+void PutAuthManagerRef(const AuthManager *auth);
+/* copy out a session key under auth lock, return SOFTBUS_AUTH_NOT_FOUND if authId not exist */
+int32_t AuthManagerPeekLatestSessionKey(int64_t authId, AuthLinkType type, int32_t *index, SessionKey *key);
+int32_t AuthManagerPeekSessionKeyByIndex(int64_t authId, int32_t index, AuthLinkType type, SessionKey *key);
 void RemoveAuthManagerByAuthId(AuthHandle authHandle);
 int32_t AuthDeviceGetPreferConnInfo(const char *uuid, AuthConnInfo *connInfo);
 int32_t AuthDeviceGetPreferConnInfoWithoutSle(const char *uuid, AuthConnInfo *connInfo);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -40,6 +40,9 @@ int32_t AddSessionKey(SessionKeyList *list, int32_t index, const SessionKey *key
 int32_t SetSessionKeyAvailable(SessionKeyList *list, int32_t index);
 int32_t GetLatestSessionKey(const SessionKeyList *list, AuthLinkType type, int32_t *index, SessionKey *key);
 int32_t GetSessionKeyByIndex(const SessionKeyList *list, int32_t index, AuthLinkType type, SessionKey *key);
+/* same as the Get version but leave the use time of the key untouched */
+int32_t PeekLatestSessionKey(const SessionKeyList *list, AuthLinkType type, int32_t *index, SessionKey *key);
+int32_t PeekSessionKeyByIndex(const SessionKeyList *list, int32_t index, AuthLinkType type, SessionKey *key);
 int32_t SetSessionKeyAuthLinkType(const SessionKeyList *list, int32_t index, AuthLinkType type);
 bool CheckSessionKeyListExistType(const SessionKeyList *list, AuthLinkType type);
 bool CheckSessionKeyListHasOldKey(const SessionKeyList *list, AuthLinkType type);
@@ -57,6 +60,15 @@ int32_t EncryptData(const SessionKeyList *list, AuthLinkType type, const InDataI
 int32_t DecryptData(const SessionKeyList *list, AuthLinkType type, const InDataInfo *inDataInfo,
     uint8_t *outData, uint32_t *outLen);
 
+/* encrypt and decrypt with the cipher ctx cached for (authId, index), rebuilt if the key changed */
+int32_t InitSessionKeyCipherCache(void);
+void DeinitSessionKeyCipherCache(void);
+void ClearSessionKeyCipherCache(int64_t authId);
+int32_t EncryptDataByKey(int64_t authId, int32_t index, const SessionKey *key, const InDataInfo *inDataInfo,
+    uint8_t *outData, uint32_t *outLen);
+int32_t DecryptDataByKey(int64_t authId, int32_t index, const SessionKey *key, const InDataInfo *inDataInfo,
+    uint8_t *outData, uint32_t *outLen);
+
 void ScheduleUpdateSessionKey(AuthHandle authHandle, uint64_t delatMs);
 void CancelUpdateSessionKey(int64_t authId);
 
@@ -29,6 +29,8 @@ extern "C" {
 
 char *PackDeviceInfoMessage(const AuthConnInfo *connInfo, SoftBusVersion version, bool isMetaAuth,
     const char *remoteUuid, const AuthSessionInfo *info);
+int32_t PackDeviceInfoTlvMessage(const AuthConnInfo *connInfo, SoftBusVersion version, const char *remoteUuid,
+    const AuthSessionInfo *info, uint8_t **data, uint32_t *len);
 int32_t UnpackDeviceInfoMessage(const DevInfoData *devInfo, NodeInfo *nodeInfo, bool isMetaAuth,
     const AuthSessionInfo *info);
 
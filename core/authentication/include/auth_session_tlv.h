@@ -0,0 +1,62 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef AUTH_SESSION_TLV_H
+#define AUTH_SESSION_TLV_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "auth_interface_struct.h"
+#include "lnn_node_info_struct.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+#define DEVICE_INFO_TLV_VERSION 1
+
+#define DEFAULT_NODE_WEIGHT    100
+#define DEFAULT_WIFI_BUFF_SIZE 32768 // 32k
+#define DEFAULT_BR_BUFF_SIZE   4096  // 4k
+#define DEFAULT_STATIC_NET_CAP 0x3F
+
+typedef struct {
+    SoftBusVersion version;
+    bool isMetaAuth;
+    const char *deviceName;  // NULL means deviceInfo.deviceName
+    const char *unifiedName; // NULL means deviceInfo.unifiedName
+} DevInfoTlvOption;
+
+/*
+ * device info frame: | magic(1) | version(1) | tlv length(2) | tlv members | json extension |
+ * the tlv members carry the common node info, the json extension carries the remaining fields and ends with '\0'.
+ */
+bool IsDeviceInfoTlvFrame(const uint8_t *data, uint32_t len);
+// note: the memory of frame need be released by calling SoftBusFree().
+int32_t PackDeviceInfoTlvFrame(const NodeInfo *info, const DevInfoTlvOption *option, const char *jsonExt,
+    uint8_t **frame, uint32_t *frameLen);
+// note: jsonExt points into frame, no need to be released.
+int32_t UnpackDeviceInfoTlvFrame(const uint8_t *frame, uint32_t frameLen, const DevInfoTlvOption *option,
+    NodeInfo *info, const char **jsonExt, uint32_t *jsonExtLen);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif
+#endif
+#endif /* AUTH_SESSION_TLV_H */
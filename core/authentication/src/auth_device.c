@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -33,6 +33,7 @@
 #include "lnn_net_builder.h"
 #include "legacy/softbus_adapter_hitrace.h"
 #include "softbus_adapter_mem.h"
+#include "softbus_adapter_socket.h"
 
 #define DELAY_AUTH_TIME                    (8 * 1000L)
 
@@ -219,18 +220,23 @@ int32_t AuthDeviceEncrypt(AuthHandle *authHandle, const uint8_t *inData, uint32_
         AUTH_LOGE(AUTH_KEY, "invalid param");
         return SOFTBUS_INVALID_PARAM;
     }
-    AuthManager *auth = GetAuthManagerByAuthId(authHandle->authId);
-    if (auth == NULL) {
+    int32_t index = 0;
+    SessionKey sessionKey;
+    (void)memset_s(&sessionKey, sizeof(SessionKey), 0, sizeof(SessionKey));
+    int32_t ret = AuthManagerPeekLatestSessionKey(authHandle->authId, (AuthLinkType)authHandle->type, &index,
+        &sessionKey);
+    if (ret == SOFTBUS_AUTH_NOT_FOUND) {
         return SOFTBUS_AUTH_NOT_FOUND;
     }
     InDataInfo inDataInfo = { .inData = inData, .inLen = inLen };
-    if (EncryptData(&auth->sessionKeyList, (AuthLinkType)authHandle->type, &inDataInfo, outData,
-        outLen) != SOFTBUS_OK) {
+    if (ret == SOFTBUS_OK) {
+        ret = EncryptDataByKey(authHandle->authId, index, &sessionKey, &inDataInfo, outData, outLen);
+    }
+    (void)memset_s(&sessionKey, sizeof(SessionKey), 0, sizeof(SessionKey));
+    if (ret != SOFTBUS_OK) {
         AUTH_LOGE(AUTH_KEY, "auth encrypt fail");
-        DelDupAuthManager(auth);
         return SOFTBUS_ENCRYPT_ERR;
     }
-    DelDupAuthManager(auth);
     return SOFTBUS_OK;
 }
 
@@ -242,18 +248,33 @@ int32_t AuthDeviceDecrypt(AuthHandle *authHandle, const uint8_t *inData, uint32_
         AUTH_LOGE(AUTH_KEY, "invalid param");
         return SOFTBUS_INVALID_PARAM;
     }
-    AuthManager *auth = GetAuthManagerByAuthId(authHandle->authId);
-    if (auth == NULL) {
+    if (inLen <= ENCRYPT_OVER_HEAD_LEN) {
+        const AuthManager *auth = GetAuthManagerRef(authHandle->authId);
+        if (auth == NULL) {
+            return SOFTBUS_AUTH_NOT_FOUND;
+        }
+        PutAuthManagerRef(auth);
+        AUTH_LOGE(AUTH_KEY, "auth decrypt data too short, authId=%{public}" PRId64, authHandle->authId);
+        return SOFTBUS_ENCRYPT_ERR;
+    }
+    /* unpack key index */
+    int32_t index = (int32_t)SoftBusLtoHl(*(uint32_t *)inData);
+    SessionKey sessionKey;
+    (void)memset_s(&sessionKey, sizeof(SessionKey), 0, sizeof(SessionKey));
+    int32_t ret = AuthManagerPeekSessionKeyByIndex(authHandle->authId, index, (AuthLinkType)authHandle->type,
+        &sessionKey);
+    if (ret == SOFTBUS_AUTH_NOT_FOUND) {
         return SOFTBUS_AUTH_NOT_FOUND;
     }
     InDataInfo inDataInfo = { .inData = inData, .inLen = inLen };
-    if (DecryptData(&auth->sessionKeyList, (AuthLinkType)authHandle->type, &inDataInfo, outData,
-        outLen) != SOFTBUS_OK) {
+    if (ret == SOFTBUS_OK) {
+        ret = DecryptDataByKey(authHandle->authId, index, &sessionKey, &inDataInfo, outData, outLen);
+    }
+    (void)memset_s(&sessionKey, sizeof(SessionKey), 0, sizeof(SessionKey));
+    if (ret != SOFTBUS_OK) {
         AUTH_LOGE(AUTH_KEY, "auth decrypt fail, authId=%{public}" PRId64, authHandle->authId);
-        DelDupAuthManager(auth);
         return SOFTBUS_ENCRYPT_ERR;
     }
-    DelDupAuthManager(auth);
     return SOFTBUS_OK;
 }
 
@@ -282,12 +303,12 @@ int32_t AuthDeviceGetServerSide(int64_t authId, bool *isServer)
         AUTH_LOGE(AUTH_CONN, "isServer is null");
         return SOFTBUS_INVALID_PARAM;
     }
-    AuthManager *auth = GetAuthManagerByAuthId(authId);
+    const AuthManager *auth = GetAuthManagerRef(authId);
     if (auth == NULL) {
         return SOFTBUS_AUTH_NOT_FOUND;
     }
     *isServer = auth->isServer;
-    DelDupAuthManager(auth);
+    PutAuthManagerRef(auth);
     return SOFTBUS_OK;
 }
 
@@ -316,12 +337,12 @@ int32_t AuthDeviceGetVersion(int64_t authId, SoftBusVersion *version)
         AUTH_LOGE(AUTH_CONN, "version is null");
         return SOFTBUS_INVALID_PARAM;
     }
-    AuthManager *auth = GetAuthManagerByAuthId(authId);
+    const AuthManager *auth = GetAuthManagerRef(authId);
     if (auth == NULL) {
         return SOFTBUS_AUTH_NOT_FOUND;
     }
     *version = auth->version;
-    DelDupAuthManager(auth);
+    PutAuthManagerRef(auth);
     return SOFTBUS_OK;
 }
 
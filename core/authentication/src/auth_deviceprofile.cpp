@@ -354,7 +354,8 @@ bool IsPotentialTrustedDeviceDp(const char *deviceIdHash, bool isOnlyPointToPoin
     }
     InsertNotTrustDevice(deviceIdHash);
     LNN_LOGI(LNN_STATE, "device is not trusted in dp, deviceIdHash=%{public}s, callCount=%{public}u",
-        AnonymizeWrapper(anonyDeviceIdHash), callCount++);
+        AnonymizeWrapper(anonyDeviceIdHash), callCount);
+    callCount++;
     AnonymizeFree(anonyDeviceIdHash);
     return false;
 }
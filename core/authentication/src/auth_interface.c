@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -595,10 +595,9 @@ int32_t AuthEncrypt(AuthHandle *authHandle, const uint8_t *inData, uint32_t inLe
         AUTH_LOGE(AUTH_KEY, "authHandle is null");
         return SOFTBUS_INVALID_PARAM;
     }
-    AuthManager *auth = GetAuthManagerByAuthId(authHandle->authId);
-    if (auth != NULL) {
-        DelDupAuthManager(auth);
-        return AuthDeviceEncrypt(authHandle, inData, inLen, outData, outLen);
+    int32_t ret = AuthDeviceEncrypt(authHandle, inData, inLen, outData, outLen);
+    if (ret != SOFTBUS_AUTH_NOT_FOUND) {
+        return ret;
     }
     return AuthMetaEncryptPacked(authHandle->authId, inData, inLen, outData, outLen);
 }
@@ -609,10 +608,9 @@ int32_t AuthDecrypt(AuthHandle *authHandle, const uint8_t *inData, uint32_t inLe
         AUTH_LOGE(AUTH_KEY, "authHandle is null");
         return SOFTBUS_INVALID_PARAM;
     }
-    AuthManager *auth = GetAuthManagerByAuthId(authHandle->authId);
-    if (auth != NULL) {
-        DelDupAuthManager(auth);
-        return AuthDeviceDecrypt(authHandle, inData, inLen, outData, outLen);
+    int32_t ret = AuthDeviceDecrypt(authHandle, inData, inLen, outData, outLen);
+    if (ret != SOFTBUS_AUTH_NOT_FOUND) {
+        return ret;
     }
     return AuthMetaDecryptPacked(authHandle->authId, inData, inLen, outData, outLen);
 }
@@ -658,10 +656,9 @@ int32_t AuthGetVersion(int64_t authId, SoftBusVersion *version)
 
 int32_t AuthGetServerSide(int64_t authId, bool *isServer)
 {
-    AuthManager *auth = GetAuthManagerByAuthId(authId);
-    if (auth != NULL) {
-        DelDupAuthManager(auth);
-        return AuthDeviceGetServerSide(authId, isServer);
+    int32_t ret = AuthDeviceGetServerSide(authId, isServer);
+    if (ret != SOFTBUS_AUTH_NOT_FOUND) {
+        return ret;
     }
     return AuthMetaGetServerSidePacked(authId, isServer);
 }
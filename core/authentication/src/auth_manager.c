@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -44,17 +44,36 @@
 #define DELAY_REG_DP_TIME                  10000
 #define RETRY_TIMES                        5
 #define RECV_DATA_WAIT_TIME                100
+#define AUTH_ID_INDEX_SIZE                 64
 
 static ListNode g_authClientList = { &g_authClientList, &g_authClientList };
 static ListNode g_authServerList = { &g_authServerList, &g_authServerList };
+/* authId -> AuthManager, every manager in the lists above is also linked here by idNode */
+static ListNode g_authIdIndex[AUTH_ID_INDEX_SIZE];
 static AuthTransCallback g_transCallback = { 0 };
 
+static ListNode *GetAuthIdBucket(int64_t authId)
+{
+    ListNode *bucket = &g_authIdIndex[(uint64_t)authId % AUTH_ID_INDEX_SIZE];
+    if (bucket->next == NULL) {
+        ListInit(bucket);
+    }
+    return bucket;
+}
+
+static void InitAuthIdIndex(void)
+{
+    for (uint32_t i = 0; i < AUTH_ID_INDEX_SIZE; i++) {
+        ListInit(&g_authIdIndex[i]);
+    }
+}
+
 /* Auth Manager */
 AuthManager *NewAuthManager(int64_t authSeq, const AuthSessionInfo *info)
 {
     AUTH_CHECK_AND_RETURN_RET_LOGE(info != NULL, NULL, AUTH_FSM, "info is null");
     AUTH_CHECK_AND_RETURN_RET_LOGE(CheckAuthConnInfoType(&info->connInfo), NULL, AUTH_FSM, "connInfo type error");
-    AuthManager *auth = (AuthManager *)SoftBusCalloc(sizeof(AuthManager));
+    AuthManager *auth = (AuthManager *)SoftBusCallocByModule(SOFTBUS_MEM_MODULE_AUTH, sizeof(AuthManager));
     if (auth == NULL) {
         AUTH_LOGW(AUTH_FSM, "malloc AuthManager fail");
         return NULL;
@@ -77,6 +96,7 @@ AuthManager *NewAuthManager(int64_t authSeq, const AuthSessionInfo *info)
     } else {
         ListTailInsert(&g_authClientList, &auth->node);
     }
+    ListTailInsert(GetAuthIdBucket(auth->authId), &auth->idNode);
     char *anonyUuid = NULL;
     Anonymize(auth->uuid, &anonyUuid);
     AUTH_LOGI(AUTH_FSM, "create auth manager, uuid=%{public}s, side=%{public}s, authId=%{public}" PRId64,
@@ -93,6 +113,8 @@ static AuthManager *DupAuthManager(const AuthManager *auth)
         return NULL;
     }
     ListInit(&newAuth->node);
+    ListInit(&newAuth->idNode);
+    newAuth->refCount = 0;
     ListInit(&newAuth->sessionKeyList);
     if (DupSessionKeyList(&auth->sessionKeyList, &newAuth->sessionKeyList)) {
         AUTH_LOGE(AUTH_FSM, "auth manager dup session key fail. authId=%{public}" PRId64 "", auth->authId);
@@ -132,6 +154,7 @@ void DelAuthManager(AuthManager *auth, int32_t type)
                 continue;
             }
             ClearSessionkeyByAuthLinkType(auth->authId, &auth->sessionKeyList, (AuthLinkType)type);
+            ClearSessionKeyCipherCache(auth->authId);
             AUTH_LOGI(AUTH_FSM, "only clear connInfo, udid=%{public}s, side=%{public}s, type=%{public}d,"
                 " authId=%{public}" PRId64, AnonymizeWrapper(anonyUdid),
                 GetAuthSideStr(auth->isServer), type, auth->authId);
@@ -143,8 +166,15 @@ void DelAuthManager(AuthManager *auth, int32_t type)
         AnonymizeWrapper(anonyUdid), GetAuthSideStr(auth->isServer), auth->authId);
     AnonymizeFree(anonyUdid);
     ListDelete(&auth->node);
+    ListDelete(&auth->idNode);
     CancelUpdateSessionKey(auth->authId);
     DestroySessionKeyList(&auth->sessionKeyList);
+    ClearSessionKeyCipherCache(auth->authId);
+    if (auth->refCount > 0) {
+        /* freed by the last PutAuthManagerRef */
+        auth->isRemoved = true;
+        return;
+    }
     SoftBusFree(auth);
 }
 
@@ -199,12 +229,7 @@ static AuthManager *FindNormalizedKeyAuthManagerByUdid(const char *udid, bool is
 static AuthManager *FindAuthManagerByAuthId(int64_t authId)
 {
     AuthManager *item = NULL;
-    LIST_FOR_EACH_ENTRY(item, &g_authClientList, AuthManager, node) {
-        if (item->authId == authId) {
-            return item;
-        }
-    }
-    LIST_FOR_EACH_ENTRY(item, &g_authServerList, AuthManager, node) {
+    LIST_FOR_EACH_ENTRY(item, GetAuthIdBucket(authId), AuthManager, idNode) {
         if (item->authId == authId) {
             return item;
         }
@@ -291,6 +316,7 @@ void RemoveAuthSessionKeyByIndex(int64_t authId, int32_t index, AuthLinkType typ
         return;
     }
     RemoveSessionkeyByIndex(&auth->sessionKeyList, index, type);
+    ClearSessionKeyCipherCache(authId);
     char udid[UDID_BUF_LEN] = { 0 };
     (void)memcpy_s(udid, UDID_BUF_LEN, auth->udid, UDID_BUF_LEN);
     bool isListEmpty = IsListEmpty(&auth->sessionKeyList);
@@ -453,6 +479,71 @@ AuthManager *GetAuthManagerByAuthId(int64_t authId)
     return newAuth;
 }
 
+const AuthManager *GetAuthManagerRef(int64_t authId)
+{
+    if (!RequireAuthLock()) {
+        return NULL;
+    }
+    AuthManager *item = FindAuthManagerByAuthId(authId);
+    if (item == NULL) {
+        AUTH_LOGI(AUTH_FSM, "auth manager not found. authId=%{public}" PRId64 "", authId);
+        ReleaseAuthLock();
+        return NULL;
+    }
+    item->refCount++;
+    ReleaseAuthLock();
+    return item;
+}
+
+void PutAuthManagerRef(const AuthManager *auth)
+{
+    AUTH_CHECK_AND_RETURN_LOGE(auth != NULL, AUTH_FSM, "auth is null");
+    if (!RequireAuthLock()) {
+        return;
+    }
+    AuthManager *item = (AuthManager *)auth;
+    if (item->refCount > 0) {
+        item->refCount--;
+    }
+    bool needFree = item->isRemoved && item->refCount == 0;
+    ReleaseAuthLock();
+    if (needFree) {
+        SoftBusFree(item);
+    }
+}
+
+int32_t AuthManagerPeekLatestSessionKey(int64_t authId, AuthLinkType type, int32_t *index, SessionKey *key)
+{
+    if (!RequireAuthLock()) {
+        return SOFTBUS_LOCK_ERR;
+    }
+    AuthManager *auth = FindAuthManagerByAuthId(authId);
+    if (auth == NULL) {
+        ReleaseAuthLock();
+        AUTH_LOGI(AUTH_KEY, "auth manager not found. authId=%{public}" PRId64 "", authId);
+        return SOFTBUS_AUTH_NOT_FOUND;
+    }
+    int32_t ret = PeekLatestSessionKey(&auth->sessionKeyList, type, index, key);
+    ReleaseAuthLock();
+    return ret;
+}
+
+int32_t AuthManagerPeekSessionKeyByIndex(int64_t authId, int32_t index, AuthLinkType type, SessionKey *key)
+{
+    if (!RequireAuthLock()) {
+        return SOFTBUS_LOCK_ERR;
+    }
+    AuthManager *auth = FindAuthManagerByAuthId(authId);
+    if (auth == NULL) {
+        ReleaseAuthLock();
+        AUTH_LOGI(AUTH_KEY, "auth manager not found. authId=%{public}" PRId64 "", authId);
+        return SOFTBUS_AUTH_NOT_FOUND;
+    }
+    int32_t ret = PeekSessionKeyByIndex(&auth->sessionKeyList, index, type, key);
+    ReleaseAuthLock();
+    return ret;
+}
+
 AuthManager *GetAuthManagerByConnInfo(const AuthConnInfo *connInfo, bool isServer)
 {
     AUTH_CHECK_AND_RETURN_RET_LOGE(connInfo != NULL, NULL, AUTH_FSM, "info is null");
@@ -2406,10 +2497,16 @@ int32_t AuthDeviceInit(const AuthTransCallback *callback)
     g_transCallback = *callback;
     ListInit(&g_authClientList);
     ListInit(&g_authServerList);
+    InitAuthIdIndex();
     if (AuthCommonInit() != SOFTBUS_OK) {
         AUTH_LOGE(AUTH_INIT, "AuthCommonInit fail");
         return SOFTBUS_AUTH_COMM_INIT_FAIL;
     }
+    if (InitSessionKeyCipherCache() != SOFTBUS_OK) {
+        AUTH_LOGE(AUTH_INIT, "init cipher cache fail");
+        AuthCommonDeinit();
+        return SOFTBUS_AUTH_INIT_FAIL;
+    }
 
     AuthConnListener connListener = {
         .onConnectResult = OnConnectResult,
@@ -2418,6 +2515,7 @@ int32_t AuthDeviceInit(const AuthTransCallback *callback)
     };
     if (AuthConnInit(&connListener) != SOFTBUS_OK) {
         AUTH_LOGE(AUTH_INIT, "AuthConnInit fail");
+        DeinitSessionKeyCipherCache();
         AuthCommonDeinit();
         return SOFTBUS_AUTH_CONN_INIT_FAIL;
     }
@@ -2439,6 +2537,7 @@ void AuthDeviceDeinit(void)
     ClearAuthRequest();
     AuthConnDeinit();
     AuthSessionFsmExit();
+    DeinitSessionKeyCipherCache();
     AuthCommonDeinit();
     AUTH_LOGI(AUTH_INIT, "auth deinit succ");
 }
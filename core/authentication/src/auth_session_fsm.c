@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -272,7 +272,7 @@ static int32_t FillSessionInfoModule(uint32_t requestId, AuthSessionInfo *info)
 
 static AuthFsm *CreateAuthFsm(AuthFsmParam *authFsmParam, const AuthConnInfo *connInfo)
 {
-    AuthFsm *authFsm = (AuthFsm *)SoftBusCalloc(sizeof(AuthFsm));
+    AuthFsm *authFsm = (AuthFsm *)SoftBusCallocByModule(SOFTBUS_MEM_MODULE_AUTH, sizeof(AuthFsm));
     if (authFsm == NULL) {
         AUTH_LOGE(AUTH_FSM, "malloc AuthFsm fail");
         return NULL;
@@ -352,7 +352,8 @@ static void DestroyAuthFsm(AuthFsm *authFsm)
 static void AuthFsmDeinitCallback(FsmStateMachine *fsm)
 {
     static uint32_t callCount = 0;
-    AUTH_LOGI(AUTH_FSM, "auth fsm deinit callback enter, callCount=%{public}u", callCount++);
+    AUTH_LOGI(AUTH_FSM, "auth fsm deinit callback enter, callCount=%{public}u", callCount);
+    callCount++;
     if (fsm == NULL) {
         AUTH_LOGE(AUTH_FSM, "fsm is null");
         return;
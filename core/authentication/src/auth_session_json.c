@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -25,6 +25,7 @@
 #include "auth_identity_service_adapter.h"
 #include "auth_log.h"
 #include "auth_pre_link.h"
+#include "auth_session_tlv.h"
 #include "bus_center_manager.h"
 #include "g_enhance_lnn_func.h"
 #include "g_enhance_auth_func_pack.h"
@@ -52,6 +53,9 @@
 #define SOFTBUS_VERSION_TAG   "softbusVersion"
 #define AUTH_VERSION_TAG      "authVersion"
 #define SUPPORT_INFO_COMPRESS "supportInfoCompress"
+#define DEVICE_INFO_TLV_VERSION_TAG "devInfoTlvVersion"
+#define COMPRESS_DICT_VERSION_TAG "compressDictVersion"
+#define COMPRESS_DICT_VERSION 1
 #define IS_NORMALIZED         "isNormalized"
 #define NORMALIZED_DATA       "normalizedData"
 #define EXCHANGE_ID_TYPE      "exchangeIdType"
@@ -166,10 +170,7 @@
 #define LOCAL_FLAGS (HAS_CTRL_CHANNEL | HAS_P2P_AUTH_V2 | HAS_SUPPRESS_STRATEGY | HAS_WAIT_TCP_TX_DONE)
 #define LONG_TO_STRING_MAX_LEN           21
 #define DEFAULT_BATTERY_LEVEL            100
-#define DEFAULT_NODE_WEIGHT              100
 #define BASE64_OFFLINE_CODE_LEN          16
-#define DEFAULT_WIFI_BUFF_SIZE           32768 // 32k
-#define DEFAULT_BR_BUFF_SIZE             4096  // 4k
 #define DEFAULT_BLE_TIMESTAMP            (roundl(pow(2, 63)) - 1)
 #define BT_DISC_TYPE_MAX_LEN             7 // br, ble,...
 #define BT_MAC_LEN                       18
@@ -177,7 +178,6 @@
 #define PARSE_UNCOMPRESS_STRING_BUFF_LEN 6 // "true" or "false"
 #define TRUE_STRING_TAG                  "true"
 #define FALSE_STRING_TAG                 "false"
-#define DEFAULT_STATIC_NET_CAP           0x3F
 
 /* fast_auth */
 #define ACCOUNT_HASH      "accountHash"
@@ -1457,6 +1457,7 @@ static void PackCompressInfo(JsonObj *obj, const NodeInfo *info)
     if (info != NULL) {
         if (IsFeatureSupport(info->feature, BIT_INFO_COMPRESS)) {
             JSON_AddStringToObject(obj, SUPPORT_INFO_COMPRESS, TRUE_STRING_TAG);
+            (void)JSON_AddInt32ToObject(obj, COMPRESS_DICT_VERSION_TAG, COMPRESS_DICT_VERSION);
         } else {
             JSON_AddStringToObject(obj, SUPPORT_INFO_COMPRESS, FALSE_STRING_TAG);
         }
@@ -1863,6 +1864,7 @@ char *PackDeviceIdJson(const AuthSessionInfo *info, int64_t authSeq)
         return NULL;
     }
     PackCompressInfo(obj, nodeInfo);
+    (void)JSON_AddInt32ToObject(obj, DEVICE_INFO_TLV_VERSION_TAG, DEVICE_INFO_TLV_VERSION);
     PackFastAuth(obj, (AuthSessionInfo *)info);
     PackUserId(obj, JudgeDeviceTypeAndGetOsAccountIds(), (NodeInfo *)&info->nodeInfo);
     if ((PackNormalizedData(info, obj, nodeInfo, authSeq) != SOFTBUS_OK) || (PackExternalAuthInfo(obj) != SOFTBUS_OK)) {
@@ -2109,7 +2111,13 @@ int32_t UnpackDeviceIdJson(const char *msg, uint32_t len, AuthSessionInfo *info,
         char compressParse[PARSE_UNCOMPRESS_STRING_BUFF_LEN] = { 0 };
         OptString(obj, SUPPORT_INFO_COMPRESS, compressParse, PARSE_UNCOMPRESS_STRING_BUFF_LEN, FALSE_STRING_TAG);
         SetCompressFlag(compressParse, &info->isSupportCompress);
+        int32_t compressDictVersion = 0;
+        OptInt(obj, COMPRESS_DICT_VERSION_TAG, &compressDictVersion, 0);
+        info->isSupportCompressDict = info->isSupportCompress && (compressDictVersion >= COMPRESS_DICT_VERSION);
     }
+    int32_t devInfoTlvVersion = 0;
+    OptInt(obj, DEVICE_INFO_TLV_VERSION_TAG, &devInfoTlvVersion, 0);
+    info->isSupportDeviceInfoTlv = (devInfoTlvVersion >= DEVICE_INFO_TLV_VERSION);
     UnPackAuthPreLinkNode(obj, info);
     UnpackSKId(obj, info);
     OptInt(obj, AUTH_MODULE, (int32_t *)&info->module, AUTH_MODULE_LNN);
@@ -2123,12 +2131,10 @@ int32_t UnpackDeviceIdJson(const char *msg, uint32_t len, AuthSessionInfo *info,
     return SOFTBUS_OK;
 }
 
-static void GetAndSetLocalUnifiedName(JsonObj *json)
+static void GetAndSetLocalUnifiedNameInner(char *unified, uint32_t len)
 {
-    char unified[DEVICE_NAME_BUF_LEN] = { 0 };
-    if (LnnGetUnifiedDeviceName(unified, DEVICE_NAME_BUF_LEN) != SOFTBUS_OK) {
+    if (LnnGetUnifiedDeviceName(unified, len) != SOFTBUS_OK) {
         AUTH_LOGE(AUTH_FSM, "get defaultDeviceName fail");
-        (void)JSON_AddStringToObject(json, UNIFIED_DEVICE_NAME, unified);
         return;
     }
     if (strlen(unified) != 0) {
@@ -2140,6 +2146,12 @@ static void GetAndSetLocalUnifiedName(JsonObj *json)
         AUTH_LOGI(AUTH_FSM, "unifed length is not zero, unified=%{public}s", AnonymizeWrapper(anonyUniFiedName));
         AnonymizeFree(anonyUniFiedName);
     }
+}
+
+static void GetAndSetLocalUnifiedName(JsonObj *json)
+{
+    char unified[DEVICE_NAME_BUF_LEN] = { 0 };
+    GetAndSetLocalUnifiedNameInner(unified, DEVICE_NAME_BUF_LEN);
     (void)JSON_AddStringToObject(json, UNIFIED_DEVICE_NAME, unified);
 }
 
@@ -2469,7 +2481,6 @@ static int32_t PackCommonEx(JsonObj *json, const NodeInfo *info)
         !JSON_AddInt32ToObject(json, NODE_WEIGHT, info->masterWeight) ||
         !JSON_AddInt64ToObject(json, ACCOUNT_ID, info->accountId) ||
         !JSON_AddStringToObject(json, ACCOUNT_UID, info->accountUid) ||
-        !JSON_AddBoolToObject(json, DISTRIBUTED_SWITCH, true) ||
         !JSON_AddInt64ToObject(json, BLE_TIMESTAMP, info->bleStartTimestamp) ||
         !JSON_AddInt32ToObject(json, WIFI_BUFF_SIZE, info->wifiBuffSize) ||
         !JSON_AddInt32ToObject(json, BR_BUFF_SIZE, info->brBuffSize) ||
@@ -2502,6 +2513,29 @@ static void PackSparkCheck(JsonObj *json, const NodeInfo *info)
     (void)memset_s(sparkCheck, SPARK_CHECK_STR_LEN, 0, SPARK_CHECK_STR_LEN);
 }
 
+/* fields kept in json when the common info is carried by the device info tlv */
+static void PackCommonExtension(JsonObj *json, const NodeInfo *info)
+{
+    if (!JSON_AddBoolToObject(json, DISTRIBUTED_SWITCH, true)) {
+        AUTH_LOGE(AUTH_FSM, "pack distributed switch fail.");
+    }
+    PackCommonFastAuth(json, info);
+    if (!PackCipherKeySyncMsgPacked(json)) {
+        AUTH_LOGE(AUTH_FSM, "PackCipherKeySyncMsg fail.");
+    }
+    if (PackCipherRpaInfo(json, info) != SOFTBUS_OK) {
+        AUTH_LOGE(AUTH_FSM, "pack CipherRpaInfo of device key fail.");
+    }
+#ifdef DISABLE_IDENTITY_SERVICE
+    int32_t authVersion = AUTH_VERSION_INVALID;
+#else
+    int32_t authVersion = AUTH_VERSION_VALUE;
+#endif
+    if (!JSON_AddInt32ToObject(json, AUTH_VERSION_TAG, authVersion)) {
+        AUTH_LOGE(AUTH_FSM, "pack authVersion fail.");
+    }
+}
+
 static int32_t PackCommon(JsonObj *json, const NodeInfo *info, SoftBusVersion version, bool isMetaAuth)
 {
     if (version >= SOFTBUS_NEW_V1) {
@@ -2531,26 +2565,12 @@ static int32_t PackCommon(JsonObj *json, const NodeInfo *info, SoftBusVersion ve
     }
     PackOsInfo(json, info);
     PackDeviceVersion(json, info);
-    PackCommonFastAuth(json, info);
-    if (!PackCipherKeySyncMsgPacked(json)) {
-        AUTH_LOGE(AUTH_FSM, "PackCipherKeySyncMsg fail.");
-    }
     PackCommP2pInfo(json, info);
-    if (PackCipherRpaInfo(json, info) != SOFTBUS_OK) {
-        AUTH_LOGE(AUTH_FSM, "pack CipherRpaInfo of device key fail.");
-    }
     if (!JSON_AddInt32ToObject(json, DEVICE_SECURITY_LEVEL, info->deviceSecurityLevel)) {
         AUTH_LOGE(AUTH_FSM, "pack deviceSecurityLevel fail.");
     }
-#ifdef DISABLE_IDENTITY_SERVICE
-    int32_t authVersion = AUTH_VERSION_INVALID;
-#else
-    int32_t authVersion = AUTH_VERSION_VALUE;
-#endif
-    if (!JSON_AddInt32ToObject(json, AUTH_VERSION_TAG, authVersion)) {
-        AUTH_LOGE(AUTH_FSM, "pack authVersion fail.");
-    }
     PackSparkCheck(json, info);
+    PackCommonExtension(json, info);
     return SOFTBUS_OK;
 }
 
@@ -2652,7 +2672,7 @@ static void ParseCommonJsonOptInfo(const JsonObj *json, NodeInfo *info)
         (void)JSON_GetInt32FromOject(json, CONN_CAP, (int32_t *)&info->netCapacity);
     }
     OptInt(json, WIFI_BUFF_SIZE, &info->wifiBuffSize, DEFAULT_WIFI_BUFF_SIZE);
-    OptInt(json, BR_BUFF_SIZE, &info->wifiBuffSize, DEFAULT_BR_BUFF_SIZE);
+    OptInt(json, BR_BUFF_SIZE, &info->brBuffSize, DEFAULT_BR_BUFF_SIZE);
     OptInt64(json, FEATURE, (int64_t *)&info->feature, 0);
     OptInt64(json, CONN_SUB_FEATURE, (int64_t *)&info->connSubFeature, 0);
     OptInt(json, STATE_VERSION_CHANGE_REASON, (int32_t *)&info->stateVersionReason, 0);
@@ -2707,6 +2727,14 @@ static void UnpackSparkCheck(const JsonObj *json, NodeInfo *info)
     (void)memset_s(sparkCheck, SPARK_CHECK_STR_LEN, 0, SPARK_CHECK_STR_LEN);
 }
 
+static void UnpackCommonExtension(const JsonObj *json, NodeInfo *info)
+{
+    // MetaNodeInfoOfEar
+    OptString(json, EXTDATA, info->extData, EXTDATA_LEN, "");
+    ProcessCipherKeySyncInfoPacked(json, info->deviceInfo.deviceUdid);
+    UnpackCipherRpaInfo(json, info);
+}
+
 static void UnpackCommon(const JsonObj *json, NodeInfo *info, SoftBusVersion version, bool isMetaAuth)
 {
     if (version >= SOFTBUS_NEW_V1) {
@@ -2723,14 +2751,12 @@ static void UnpackCommon(const JsonObj *json, NodeInfo *info, SoftBusVersion ver
         }
     }
     ParseCommonJsonInfo(json, info, isMetaAuth);
-    // MetaNodeInfoOfEar
-    OptString(json, EXTDATA, info->extData, EXTDATA_LEN, "");
     if (version == SOFTBUS_OLD_V1) {
         if (strcpy_s(info->networkId, NETWORK_ID_BUF_LEN, info->uuid) != EOK) {
             AUTH_LOGE(AUTH_FSM, "v1 version strcpy networkid fail");
         }
     }
-    ProcessCipherKeySyncInfoPacked(json, info->deviceInfo.deviceUdid);
+    UnpackCommonExtension(json, info);
 
     // unpack p2p info
     OptInt(json, P2P_ROLE, &info->p2pInfo.p2pRole, -1);
@@ -2739,8 +2765,6 @@ static void UnpackCommon(const JsonObj *json, NodeInfo *info, SoftBusVersion ver
     OptInt(json, STA_FREQUENCY, &info->p2pInfo.staFrequency, -1);
     OptString(json, P2P_MAC_ADDR, info->p2pInfo.p2pMac, MAC_LEN, "");
     OptString(json, HML_MAC, info->wifiDirectAddr, MAC_LEN, "");
-
-    UnpackCipherRpaInfo(json, info);
     OptInt(json, DEVICE_SECURITY_LEVEL, &info->deviceSecurityLevel, 0);
     UnpackSparkCheck(json, info);
 }
@@ -2790,8 +2814,7 @@ static void AddDiscoveryType(JsonObj *json, const char *remoteUuid)
     JSON_AddStringToObject(json, DISCOVERY_TYPE, discTypeStr);
 }
 
-static int32_t PackBt(
-    JsonObj *json, const NodeInfo *info, SoftBusVersion version, bool isMetaAuth, const char *remoteUuid)
+static int32_t PackBtLinkInfo(JsonObj *json, const char *remoteUuid)
 {
     if (!JSON_AddInt32ToObject(json, CODE, CODE_VERIFY_BT)) {
         AUTH_LOGE(AUTH_FSM, "add bt info fail");
@@ -2812,6 +2835,15 @@ static int32_t PackBt(
         !JSON_AddInt32ToObject(json, BLE_MAC_REFRESH_SWITCH, bleMacRefreshSwitch)) {
         AUTH_LOGI(AUTH_FSM, "add ble conn close delay time or refresh switch fail");
     }
+    return SOFTBUS_OK;
+}
+
+static int32_t PackBt(
+    JsonObj *json, const NodeInfo *info, SoftBusVersion version, bool isMetaAuth, const char *remoteUuid)
+{
+    if (PackBtLinkInfo(json, remoteUuid) != SOFTBUS_OK) {
+        return SOFTBUS_AUTH_PACK_DEVINFO_FAIL;
+    }
     if (PackCommon(json, info, version, isMetaAuth) != SOFTBUS_OK) {
         AUTH_LOGE(AUTH_FSM, "PackCommon fail");
         return SOFTBUS_AUTH_PACK_DEVINFO_FAIL;
@@ -2828,7 +2860,7 @@ static int32_t SetDiscType(uint32_t *discType, const char *discStr)
     return SOFTBUS_OK;
 }
 
-static int32_t UnpackBt(const JsonObj *json, NodeInfo *info, SoftBusVersion version, bool isMetaAuth)
+static void UnpackBtLinkInfo(const JsonObj *json, NodeInfo *info)
 {
     char discTypeStr[BT_DISC_TYPE_MAX_LEN] = { 0 };
     if (!JSON_GetInt64FromOject(json, TRANSPORT_PROTOCOL, (int64_t *)&info->supportedProtocols)) {
@@ -2840,12 +2872,16 @@ static int32_t UnpackBt(const JsonObj *json, NodeInfo *info, SoftBusVersion vers
     OptInt(json, STATE_VERSION, &info->stateVersion, 0);
     OptInt(json, BLE_CONN_CLOSE_DELAY_TIME, &info->bleConnCloseDelayTime, BLE_CONNECTION_CLOSE_DELAY);
     OptInt(json, BLE_MAC_REFRESH_SWITCH, &info->bleMacRefreshSwitch, BLE_MAC_AUTO_REFRESH_SWITCH);
+}
+
+static int32_t UnpackBt(const JsonObj *json, NodeInfo *info, SoftBusVersion version, bool isMetaAuth)
+{
+    UnpackBtLinkInfo(json, info);
     UnpackCommon(json, info, version, isMetaAuth);
     return SOFTBUS_OK;
 }
 
-static int32_t PackWiFi(
-    JsonObj *json, const NodeInfo *info, SoftBusVersion version, bool isMetaAuth, int32_t ifnameIdx)
+static int32_t PackWiFiLinkInfo(JsonObj *json, const NodeInfo *info, int32_t ifnameIdx)
 {
     AUTH_LOGD(AUTH_FSM, "devIp=%{public}zu", strlen(info->connectInfo.ifInfo[ifnameIdx].deviceIp));
     if (!JSON_AddInt32ToObject(json, CODE, CODE_VERIFY_IP) || !JSON_AddInt32ToObject(json, BUS_MAX_VERSION, BUS_V2) ||
@@ -2868,6 +2904,16 @@ static int32_t PackWiFi(
         return SOFTBUS_ENCRYPT_ERR;
     }
     (void)JSON_AddStringToObject(json, BLE_OFFLINE_CODE, offlineCode);
+    return SOFTBUS_OK;
+}
+
+static int32_t PackWiFi(
+    JsonObj *json, const NodeInfo *info, SoftBusVersion version, bool isMetaAuth, int32_t ifnameIdx)
+{
+    int32_t ret = PackWiFiLinkInfo(json, info, ifnameIdx);
+    if (ret != SOFTBUS_OK) {
+        return ret;
+    }
     if (PackCommon(json, info, version, isMetaAuth) != SOFTBUS_OK) {
         AUTH_LOGE(AUTH_FSM, "PackCommon fail");
         return SOFTBUS_AUTH_PACK_DEVINFO_FAIL;
@@ -2894,8 +2940,7 @@ static int32_t CheckBusVersion(const JsonObj *json)
     return maxVersion;
 }
 
-static int32_t UnpackWiFi(
-    const JsonObj *json, NodeInfo *info, SoftBusVersion version, bool isMetaAuth, int32_t ifnameIdx)
+static int32_t UnpackWiFiLinkInfo(const JsonObj *json, NodeInfo *info, int32_t ifnameIdx)
 {
     if (CheckBusVersion(json) < 0) {
         return SOFTBUS_AUTH_UNPACK_DEVINFO_FAIL;
@@ -2917,6 +2962,16 @@ static int32_t UnpackWiFi(
     if (len != OFFLINE_CODE_BYTE_SIZE) {
         AUTH_LOGE(AUTH_FSM, "base64Decode data err");
     }
+    return SOFTBUS_OK;
+}
+
+static int32_t UnpackWiFi(
+    const JsonObj *json, NodeInfo *info, SoftBusVersion version, bool isMetaAuth, int32_t ifnameIdx)
+{
+    int32_t ret = UnpackWiFiLinkInfo(json, info, ifnameIdx);
+    if (ret != SOFTBUS_OK) {
+        return ret;
+    }
     UnpackCommon(json, info, version, isMetaAuth);
     return SOFTBUS_OK;
 }
@@ -3153,6 +3208,18 @@ static int32_t PackUserIdCheckSum(JsonObj *json, const NodeInfo *nodeInfo)
     return SOFTBUS_OK;
 }
 
+static int32_t PackDeviceInfoTail(const AuthConnInfo *connInfo, JsonObj *json, const NodeInfo *nodeInfo,
+    const char *remoteUuid, bool isMetaAuth, const AuthSessionInfo *info)
+{
+    PackWifiDirectInfo(connInfo, json, nodeInfo, remoteUuid, isMetaAuth);
+    PackServiceFindCap(json, nodeInfo);
+    if (PackCertificateInfo(json, info) != SOFTBUS_OK) {
+        AUTH_LOGE(AUTH_FSM, "packCertificateInfo fail");
+        return SOFTBUS_AUTH_PACK_DEVINFO_FAIL;
+    }
+    return PackUserIdCheckSum(json, nodeInfo);
+}
+
 char *PackDeviceInfoMessage(const AuthConnInfo *connInfo, SoftBusVersion version, bool isMetaAuth,
     const char *remoteUuid, const AuthSessionInfo *info)
 {
@@ -3187,18 +3254,43 @@ char *PackDeviceInfoMessage(const AuthConnInfo *connInfo, SoftBusVersion version
         JSON_Delete(json);
         return NULL;
     }
-    PackWifiDirectInfo(connInfo, json, nodeInfo, remoteUuid, isMetaAuth);
-    PackServiceFindCap(json, nodeInfo);
-    if (PackCertificateInfo(json, info) != SOFTBUS_OK) {
-        AUTH_LOGE(AUTH_FSM, "packCertificateInfo fail");
+    if (PackDeviceInfoTail(connInfo, json, nodeInfo, remoteUuid, isMetaAuth, info) != SOFTBUS_OK) {
         JSON_Delete(json);
         return NULL;
     }
-    ret = PackUserIdCheckSum(json, nodeInfo);
+    char *msg = JSON_PrintUnformatted(json);
+    if (msg == NULL) {
+        AUTH_LOGE(AUTH_FSM, "JSON_PrintUnformatted fail");
+    }
+    JSON_Delete(json);
+    return msg;
+}
+
+static char *PackDeviceInfoExtJson(const AuthConnInfo *connInfo, const NodeInfo *nodeInfo, const char *remoteUuid,
+    const AuthSessionInfo *info)
+{
+    JsonObj *json = JSON_CreateObject();
+    if (json == NULL) {
+        AUTH_LOGE(AUTH_FSM, "create cjson fail");
+        return NULL;
+    }
+    int32_t ret;
+    if (connInfo->type == AUTH_LINK_TYPE_WIFI || connInfo->type == AUTH_LINK_TYPE_SESSION_KEY ||
+        connInfo->type == AUTH_LINK_TYPE_USB) {
+        int32_t ifIdx = (connInfo->type == AUTH_LINK_TYPE_USB) ? USB_IF : WLAN_IF;
+        ret = PackWiFiLinkInfo(json, nodeInfo, ifIdx);
+    } else {
+        ret = PackBtLinkInfo(json, remoteUuid);
+    }
     if (ret != SOFTBUS_OK) {
         JSON_Delete(json);
         return NULL;
     }
+    PackCommonExtension(json, nodeInfo);
+    if (PackDeviceInfoTail(connInfo, json, nodeInfo, remoteUuid, false, info) != SOFTBUS_OK) {
+        JSON_Delete(json);
+        return NULL;
+    }
     char *msg = JSON_PrintUnformatted(json);
     if (msg == NULL) {
         AUTH_LOGE(AUTH_FSM, "JSON_PrintUnformatted fail");
@@ -3207,6 +3299,49 @@ char *PackDeviceInfoMessage(const AuthConnInfo *connInfo, SoftBusVersion version
     return msg;
 }
 
+int32_t PackDeviceInfoTlvMessage(const AuthConnInfo *connInfo, SoftBusVersion version, const char *remoteUuid,
+    const AuthSessionInfo *info, uint8_t **data, uint32_t *len)
+{
+    AUTH_CHECK_AND_RETURN_RET_LOGE(connInfo != NULL && data != NULL && len != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM,
+        "invalid param");
+    if (version < SOFTBUS_NEW_V1) {
+        AUTH_LOGE(AUTH_FSM, "tlv not support, version=%{public}d", version);
+        return SOFTBUS_AUTH_PACK_DEVINFO_FAIL;
+    }
+    AUTH_LOGI(AUTH_FSM, "connType=%{public}d", connInfo->type);
+    UpdateLocalNetBrMac();
+    const NodeInfo *nodeInfo = LnnGetLocalNodeInfo();
+    if (nodeInfo == NULL) {
+        AUTH_LOGE(AUTH_FSM, "local info is null");
+        return SOFTBUS_AUTH_PACK_DEVINFO_FAIL;
+    }
+    char deviceName[DEVICE_NAME_BUF_LEN] = { 0 };
+    if (LnnGetLocalStrInfo(STRING_KEY_DEV_NAME, deviceName, sizeof(deviceName)) != SOFTBUS_OK &&
+        strcpy_s(deviceName, sizeof(deviceName), LnnGetDeviceName(&nodeInfo->deviceInfo)) != EOK) {
+        AUTH_LOGE(AUTH_FSM, "get device name fail");
+    }
+    char unifiedName[DEVICE_NAME_BUF_LEN] = { 0 };
+    if (strlen(nodeInfo->deviceInfo.unifiedName) == 0) {
+        GetAndSetLocalUnifiedNameInner(unifiedName, sizeof(unifiedName));
+    }
+    DevInfoTlvOption option = {
+        .version = version,
+        .isMetaAuth = false,
+        .deviceName = deviceName,
+        .unifiedName = (strlen(nodeInfo->deviceInfo.unifiedName) == 0) ? unifiedName : NULL,
+    };
+    char *jsonExt = PackDeviceInfoExtJson(connInfo, nodeInfo, remoteUuid, info);
+    if (jsonExt == NULL) {
+        return SOFTBUS_AUTH_PACK_DEVINFO_FAIL;
+    }
+    int32_t ret = PackDeviceInfoTlvFrame(nodeInfo, &option, jsonExt, data, len);
+    JSON_Free(jsonExt);
+    if (ret != SOFTBUS_OK) {
+        AUTH_LOGE(AUTH_FSM, "pack device info tlv fail, ret=%{public}d", ret);
+    }
+    return ret;
+}
+
 static void UpdatePeerDeviceName(NodeInfo *peerNodeInfo)
 {
     const NodeInfo *localInfo = LnnGetLocalNodeInfo();
@@ -3354,20 +3489,70 @@ static bool IsInvalidDeviceInfo(JsonObj *obj, NodeInfo *nodeInfo, const AuthSess
     return false;
 }
 
+static JsonObj *UnpackDeviceInfoTlvMsgInner(
+    const DevInfoData *devInfo, NodeInfo *nodeInfo, bool isMetaAuth, int32_t *ret)
+{
+    if (devInfo->version < SOFTBUS_NEW_V1) {
+        AUTH_LOGE(AUTH_FSM, "tlv not support, version=%{public}d", devInfo->version);
+        *ret = SOFTBUS_AUTH_UNPACK_DEVINFO_FAIL;
+        return NULL;
+    }
+    DevInfoTlvOption option = { .version = devInfo->version, .isMetaAuth = isMetaAuth };
+    const char *jsonExt = NULL;
+    uint32_t jsonExtLen = 0;
+    *ret = UnpackDeviceInfoTlvFrame((const uint8_t *)devInfo->msg, devInfo->len, &option, nodeInfo, &jsonExt,
+        &jsonExtLen);
+    if (*ret != SOFTBUS_OK) {
+        AUTH_LOGE(AUTH_FSM, "unpack device info tlv fail, ret=%{public}d", *ret);
+        return NULL;
+    }
+    JsonObj *json = JSON_Parse(jsonExt, jsonExtLen);
+    if (json == NULL) {
+        AUTH_LOGE(AUTH_FSM, "parse cjson fail");
+        *ret = SOFTBUS_PARSE_JSON_ERR;
+        return NULL;
+    }
+    /* protocols and ble timestamp are carried by tlv, keep them over the defaults of link info */
+    if (devInfo->linkType == AUTH_LINK_TYPE_WIFI || devInfo->linkType == AUTH_LINK_TYPE_SESSION_KEY ||
+        devInfo->linkType == AUTH_LINK_TYPE_USB) {
+        int32_t ifIdx = (devInfo->linkType == AUTH_LINK_TYPE_USB) ? USB_IF : WLAN_IF;
+        uint64_t supportedProtocols = nodeInfo->supportedProtocols;
+        *ret = UnpackWiFiLinkInfo(json, nodeInfo, ifIdx);
+        nodeInfo->supportedProtocols = supportedProtocols;
+    } else {
+        uint64_t supportedProtocols = nodeInfo->supportedProtocols;
+        int64_t bleStartTimestamp = nodeInfo->bleStartTimestamp;
+        UnpackBtLinkInfo(json, nodeInfo);
+        nodeInfo->supportedProtocols = supportedProtocols;
+        nodeInfo->bleStartTimestamp = bleStartTimestamp;
+        *ret = SOFTBUS_OK;
+    }
+    UnpackCommonExtension(json, nodeInfo);
+    return json;
+}
+
 int32_t UnpackDeviceInfoMessage(
     const DevInfoData *devInfo, NodeInfo *nodeInfo, bool isMetaAuth, const AuthSessionInfo *info)
 {
     AUTH_CHECK_AND_RETURN_RET_LOGE(devInfo != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "devInfo is NULL");
     AUTH_CHECK_AND_RETURN_RET_LOGE(nodeInfo != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "nodeInfo is NULL");
     AUTH_LOGI(AUTH_FSM, "connType=%{public}d", devInfo->linkType);
-    JsonObj *json = JSON_Parse(devInfo->msg, devInfo->len);
-    if (json == NULL) {
-        AUTH_LOGE(AUTH_FSM, "parse cjson fail");
-        return SOFTBUS_PARSE_JSON_ERR;
-    }
     int32_t ret;
+    JsonObj *json = NULL;
+    if (IsDeviceInfoTlvFrame((const uint8_t *)devInfo->msg, devInfo->len)) {
+        json = UnpackDeviceInfoTlvMsgInner(devInfo, nodeInfo, isMetaAuth, &ret);
+        if (json == NULL) {
+            return ret;
+        }
+    } else {
+        json = JSON_Parse(devInfo->msg, devInfo->len);
+        if (json == NULL) {
+            AUTH_LOGE(AUTH_FSM, "parse cjson fail");
+            return SOFTBUS_PARSE_JSON_ERR;
+        }
+        ret = UnpackDeviceInfoMsgInner(json, devInfo, nodeInfo, isMetaAuth);
+    }
     int32_t target = 0;
-    ret = UnpackDeviceInfoMsgInner(json, devInfo, nodeInfo, isMetaAuth);
     UnpackWifiDirectInfo(json, nodeInfo, isMetaAuth);
     nodeInfo->isSupportSv = false;
     if (JSON_GetInt32FromOject(json, STATE_VERSION, &target)) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -23,9 +23,11 @@
 #include "auth_session_fsm.h"
 #include "softbus_adapter_mem.h"
 #include "softbus_adapter_socket.h"
+#include "softbus_adapter_thread.h"
 
 #define SESSION_KEY_MAX_NUM   10
 #define LAST_USE_THRESHOLD_MS (30 * 1000L) /* 30s */
+#define CIPHER_CACHE_SIZE     64
 
 typedef struct {
     int32_t index;
@@ -38,6 +40,23 @@ typedef struct {
     bool isOldKey;
 } SessionKeyItem;
 
+typedef struct {
+    int64_t authId;
+    int32_t index;
+    SessionKey key;
+    SoftBusGcmCipherCtx *cipherCtx;
+} CipherCacheItem;
+
+/* direct-mapped by (authId, index), a ctx is taken out of its slot while in use */
+static CipherCacheItem g_cipherCache[CIPHER_CACHE_SIZE];
+/* the lock is kept for the process lifetime, so a lookup racing with deinit still finds it valid */
+static SoftBusMutex g_cipherCacheLock;
+static bool g_isCipherCacheLockInit = false;
+/* only read and written under g_cipherCacheLock */
+static bool g_isCipherCacheInit = false;
+/* bumped on every clear, so a ctx taken before the clear is not put back */
+static uint32_t g_cipherCacheGeneration = 0;
+
 static void RemoveOldKey(SessionKeyList *list)
 {
     uint32_t num = 0;
@@ -275,19 +294,8 @@ int32_t AddSessionKey(SessionKeyList *list, int32_t index, const SessionKey *key
     return SOFTBUS_OK;
 }
 
-int32_t GetLatestSessionKey(const SessionKeyList *list, AuthLinkType type, int32_t *index, SessionKey *key)
+static SessionKeyItem *FindLatestSessionKey(const SessionKeyList *list, AuthLinkType type)
 {
-    AUTH_CHECK_AND_RETURN_RET_LOGE(list != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "list is NULL");
-    AUTH_CHECK_AND_RETURN_RET_LOGE(index != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "index is NULL");
-    AUTH_CHECK_AND_RETURN_RET_LOGE(key != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "key is NULL");
-    if (type < AUTH_LINK_TYPE_WIFI || type >= AUTH_LINK_TYPE_MAX) {
-        AUTH_LOGE(AUTH_FSM, "type error");
-        return SOFTBUS_INVALID_PARAM;
-    }
-    if (IsListEmpty((const ListNode *)list)) {
-        AUTH_LOGE(AUTH_FSM, "session key list is empty");
-        return SOFTBUS_LIST_EMPTY;
-    }
     SessionKeyItem *item = NULL;
     SessionKeyItem *latestKey = NULL;
     uint64_t latestTime = 0;
@@ -300,6 +308,23 @@ int32_t GetLatestSessionKey(const SessionKeyList *list, AuthLinkType type, int32
             latestKey = item;
         }
     }
+    return latestKey;
+}
+
+int32_t GetLatestSessionKey(const SessionKeyList *list, AuthLinkType type, int32_t *index, SessionKey *key)
+{
+    AUTH_CHECK_AND_RETURN_RET_LOGE(list != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "list is NULL");
+    AUTH_CHECK_AND_RETURN_RET_LOGE(index != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "index is NULL");
+    AUTH_CHECK_AND_RETURN_RET_LOGE(key != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "key is NULL");
+    if (type < AUTH_LINK_TYPE_WIFI || type >= AUTH_LINK_TYPE_MAX) {
+        AUTH_LOGE(AUTH_FSM, "type error");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    if (IsListEmpty((const ListNode *)list)) {
+        AUTH_LOGE(AUTH_FSM, "session key list is empty");
+        return SOFTBUS_LIST_EMPTY;
+    }
+    SessionKeyItem *latestKey = FindLatestSessionKey(list, type);
     if (latestKey == NULL) {
         AUTH_LOGE(AUTH_FSM, "invalid session key item, type=%{public}d", type);
         DumpSessionkeyList(list);
@@ -317,6 +342,28 @@ int32_t GetLatestSessionKey(const SessionKeyList *list, AuthLinkType type, int32
     return SOFTBUS_OK;
 }
 
+int32_t PeekLatestSessionKey(const SessionKeyList *list, AuthLinkType type, int32_t *index, SessionKey *key)
+{
+    AUTH_CHECK_AND_RETURN_RET_LOGE(list != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "list is NULL");
+    AUTH_CHECK_AND_RETURN_RET_LOGE(index != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "index is NULL");
+    AUTH_CHECK_AND_RETURN_RET_LOGE(key != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "key is NULL");
+    if (type < AUTH_LINK_TYPE_WIFI || type >= AUTH_LINK_TYPE_MAX) {
+        AUTH_LOGE(AUTH_FSM, "type error");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    SessionKeyItem *latestKey = FindLatestSessionKey(list, type);
+    if (latestKey == NULL) {
+        AUTH_LOGE(AUTH_FSM, "invalid session key item, type=%{public}d", type);
+        return SOFTBUS_AUTH_SESSION_KEY_INVALID;
+    }
+    if (memcpy_s(key, sizeof(SessionKey), &latestKey->key, sizeof(latestKey->key)) != EOK) {
+        AUTH_LOGE(AUTH_FSM, "copy session key fail.");
+        return SOFTBUS_MEM_ERR;
+    }
+    *index = latestKey->index;
+    return SOFTBUS_OK;
+}
+
 int32_t SetSessionKeyAuthLinkType(const SessionKeyList *list, int32_t index, AuthLinkType type)
 {
     CHECK_NULL_PTR_RETURN_VALUE(list, SOFTBUS_INVALID_PARAM);
@@ -367,6 +414,29 @@ int32_t GetSessionKeyByIndex(const SessionKeyList *list, int32_t index, AuthLink
     return SOFTBUS_AUTH_NOT_FOUND;
 }
 
+int32_t PeekSessionKeyByIndex(const SessionKeyList *list, int32_t index, AuthLinkType type, SessionKey *key)
+{
+    AUTH_CHECK_AND_RETURN_RET_LOGE(list != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "list is NULL");
+    AUTH_CHECK_AND_RETURN_RET_LOGE(key != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "key is NULL");
+    if (type < AUTH_LINK_TYPE_WIFI || type >= AUTH_LINK_TYPE_MAX) {
+        AUTH_LOGE(AUTH_FSM, "type error");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    SessionKeyItem *item = NULL;
+    LIST_FOR_EACH_ENTRY(item, (const ListNode *)list, SessionKeyItem, node) {
+        if (item->index != index) {
+            continue;
+        }
+        if (memcpy_s(key, sizeof(SessionKey), &item->key, sizeof(item->key)) != EOK) {
+            AUTH_LOGE(AUTH_FSM, "get session key fail, index=%{public}d", index);
+            return SOFTBUS_MEM_ERR;
+        }
+        return SOFTBUS_OK;
+    }
+    AUTH_LOGE(AUTH_FSM, "session key not found, index=%{public}d", index);
+    return SOFTBUS_AUTH_SESSION_KEY_NOT_FOUND;
+}
+
 void RemoveSessionkeyByIndex(SessionKeyList *list, int32_t index, AuthLinkType type)
 {
     AUTH_CHECK_AND_RETURN_LOGE(list != NULL, AUTH_FSM, "list is NULL");
@@ -414,6 +484,34 @@ void ClearSessionkeyByAuthLinkType(int64_t authId, SessionKeyList *list, AuthLin
     }
 }
 
+static int32_t EncryptDataByKeyInner(int32_t index, const SessionKey *key, const InDataInfo *inDataInfo,
+    uint8_t *outData, uint32_t *outLen)
+{
+    AesGcmCipherKey cipherKey = { .keyLen = key->len };
+    if (memcpy_s(cipherKey.key, SESSION_KEY_LENGTH, key->value, key->len) != EOK) {
+        AUTH_LOGE(AUTH_FSM, "set key fail");
+        return SOFTBUS_MEM_ERR;
+    }
+    int32_t ret = SoftBusEncryptDataWithSeq(
+        &cipherKey, inDataInfo->inData, inDataInfo->inLen, outData + ENCRYPT_INDEX_LEN, outLen, index);
+    (void)memset_s(&cipherKey, sizeof(AesGcmCipherKey), 0, sizeof(AesGcmCipherKey));
+    return ret;
+}
+
+static int32_t DecryptDataByKeyInner(int32_t index, const SessionKey *key, const InDataInfo *inDataInfo,
+    uint8_t *outData, uint32_t *outLen)
+{
+    AesGcmCipherKey cipherKey = { .keyLen = key->len };
+    if (memcpy_s(cipherKey.key, SESSION_KEY_LENGTH, key->value, key->len) != EOK) {
+        AUTH_LOGE(AUTH_FSM, "set key fail");
+        return SOFTBUS_MEM_ERR;
+    }
+    int32_t ret = SoftBusDecryptDataWithSeq(&cipherKey, inDataInfo->inData + ENCRYPT_INDEX_LEN,
+        inDataInfo->inLen - ENCRYPT_INDEX_LEN, outData, outLen, index);
+    (void)memset_s(&cipherKey, sizeof(AesGcmCipherKey), 0, sizeof(AesGcmCipherKey));
+    return ret;
+}
+
 int32_t EncryptData(
     const SessionKeyList *list, AuthLinkType type, const InDataInfo *inDataInfo, uint8_t *outData, uint32_t *outLen)
 {
@@ -432,16 +530,11 @@ int32_t EncryptData(
     }
     /* pack key index */
     *(uint32_t *)outData = SoftBusHtoLl((uint32_t)index);
-    AesGcmCipherKey cipherKey = { .keyLen = sessionKey.len };
-    if (memcpy_s(cipherKey.key, SESSION_KEY_LENGTH, sessionKey.value, sessionKey.len) != EOK) {
-        AUTH_LOGE(AUTH_FSM, "set key fail");
-        (void)memset_s(&sessionKey, sizeof(SessionKey), 0, sizeof(SessionKey));
+    int32_t ret = EncryptDataByKeyInner(index, &sessionKey, inDataInfo, outData, outLen);
+    (void)memset_s(&sessionKey, sizeof(SessionKey), 0, sizeof(SessionKey));
+    if (ret == SOFTBUS_MEM_ERR) {
         return SOFTBUS_MEM_ERR;
     }
-    (void)memset_s(&sessionKey, sizeof(SessionKey), 0, sizeof(SessionKey));
-    int32_t ret = SoftBusEncryptDataWithSeq(
-        &cipherKey, inDataInfo->inData, inDataInfo->inLen, outData + ENCRYPT_INDEX_LEN, outLen, index);
-    (void)memset_s(&cipherKey, sizeof(AesGcmCipherKey), 0, sizeof(AesGcmCipherKey));
     if (ret != SOFTBUS_OK) {
         AUTH_LOGE(AUTH_FSM, "SoftBusEncryptDataWithSeq fail=%{public}d", ret);
         return SOFTBUS_ENCRYPT_ERR;
@@ -465,16 +558,11 @@ int32_t DecryptData(
         AUTH_LOGE(AUTH_FSM, "get key fail");
         return SOFTBUS_DECRYPT_ERR;
     }
-    AesGcmCipherKey cipherKey = { .keyLen = sessionKey.len };
-    if (memcpy_s(cipherKey.key, SESSION_KEY_LENGTH, sessionKey.value, sessionKey.len) != EOK) {
-        AUTH_LOGE(AUTH_FSM, "set key fail");
-        (void)memset_s(&sessionKey, sizeof(SessionKey), 0, sizeof(SessionKey));
+    int32_t ret = DecryptDataByKeyInner(index, &sessionKey, inDataInfo, outData, outLen);
+    (void)memset_s(&sessionKey, sizeof(SessionKey), 0, sizeof(SessionKey));
+    if (ret == SOFTBUS_MEM_ERR) {
         return SOFTBUS_MEM_ERR;
     }
-    (void)memset_s(&sessionKey, sizeof(SessionKey), 0, sizeof(SessionKey));
-    int32_t ret = SoftBusDecryptDataWithSeq(&cipherKey, inDataInfo->inData + ENCRYPT_INDEX_LEN,
-        inDataInfo->inLen - ENCRYPT_INDEX_LEN, outData, outLen, index);
-    (void)memset_s(&cipherKey, sizeof(AesGcmCipherKey), 0, sizeof(AesGcmCipherKey));
     if (ret != SOFTBUS_OK) {
         AUTH_LOGE(AUTH_FSM, "SoftBusDecryptDataWithSeq fail=%{public}d", ret);
         return SOFTBUS_DECRYPT_ERR;
@@ -530,6 +618,180 @@ int32_t DecryptInner(
     return SOFTBUS_OK;
 }
 
+int32_t InitSessionKeyCipherCache(void)
+{
+    if (!g_isCipherCacheLockInit) {
+        if (SoftBusMutexInit(&g_cipherCacheLock, NULL) != SOFTBUS_OK) {
+            AUTH_LOGE(AUTH_INIT, "cipher cache mutex init fail");
+            return SOFTBUS_LOCK_ERR;
+        }
+        g_isCipherCacheLockInit = true;
+    }
+    if (SoftBusMutexLock(&g_cipherCacheLock) != SOFTBUS_OK) {
+        AUTH_LOGE(AUTH_INIT, "cipher cache lock fail");
+        return SOFTBUS_LOCK_ERR;
+    }
+    if (!g_isCipherCacheInit) {
+        (void)memset_s(g_cipherCache, sizeof(g_cipherCache), 0, sizeof(g_cipherCache));
+        g_isCipherCacheInit = true;
+    }
+    (void)SoftBusMutexUnlock(&g_cipherCacheLock);
+    return SOFTBUS_OK;
+}
+
+static void ClearCipherCacheItem(CipherCacheItem *item)
+{
+    SoftBusDestroyGcmCipherCtx(item->cipherCtx);
+    (void)memset_s(item, sizeof(CipherCacheItem), 0, sizeof(CipherCacheItem));
+}
+
+/* a ctx checked out by a running lookup is not in its slot, and the generation bump makes its put back free it */
+void DeinitSessionKeyCipherCache(void)
+{
+    if (!g_isCipherCacheLockInit) {
+        return;
+    }
+    if (SoftBusMutexLock(&g_cipherCacheLock) != SOFTBUS_OK) {
+        AUTH_LOGE(AUTH_INIT, "cipher cache lock fail");
+        return;
+    }
+    for (uint32_t i = 0; i < CIPHER_CACHE_SIZE; i++) {
+        ClearCipherCacheItem(&g_cipherCache[i]);
+    }
+    g_cipherCacheGeneration++;
+    g_isCipherCacheInit = false;
+    (void)SoftBusMutexUnlock(&g_cipherCacheLock);
+}
+
+void ClearSessionKeyCipherCache(int64_t authId)
+{
+    if (!g_isCipherCacheLockInit) {
+        return;
+    }
+    if (SoftBusMutexLock(&g_cipherCacheLock) != SOFTBUS_OK) {
+        AUTH_LOGE(AUTH_KEY, "cipher cache lock fail");
+        return;
+    }
+    for (uint32_t i = 0; i < CIPHER_CACHE_SIZE; i++) {
+        if (g_cipherCache[i].cipherCtx != NULL && g_cipherCache[i].authId == authId) {
+            ClearCipherCacheItem(&g_cipherCache[i]);
+        }
+    }
+    g_cipherCacheGeneration++;
+    (void)SoftBusMutexUnlock(&g_cipherCacheLock);
+}
+
+static uint32_t GetCipherCacheSlot(int64_t authId, int32_t index)
+{
+    return (uint32_t)(((uint64_t)authId + (uint32_t)index) % CIPHER_CACHE_SIZE);
+}
+
+static bool IsCipherCacheHit(const CipherCacheItem *item, int64_t authId, int32_t index, const SessionKey *key)
+{
+    return item->cipherCtx != NULL && item->authId == authId && item->index == index &&
+        item->key.len == key->len && memcmp(item->key.value, key->value, key->len) == 0;
+}
+
+/* take the cached ctx out of its slot, or build a new one on miss */
+static SoftBusGcmCipherCtx *TakeCipherCtx(int64_t authId, int32_t index, const SessionKey *key, uint32_t *generation)
+{
+    if (key->len > SESSION_KEY_LENGTH || !g_isCipherCacheLockInit ||
+        SoftBusMutexLock(&g_cipherCacheLock) != SOFTBUS_OK) {
+        return NULL;
+    }
+    if (!g_isCipherCacheInit) {
+        (void)SoftBusMutexUnlock(&g_cipherCacheLock);
+        return NULL;
+    }
+    SoftBusGcmCipherCtx *cipherCtx = NULL;
+    CipherCacheItem *item = &g_cipherCache[GetCipherCacheSlot(authId, index)];
+    if (IsCipherCacheHit(item, authId, index, key)) {
+        cipherCtx = item->cipherCtx;
+        item->cipherCtx = NULL;
+    }
+    *generation = g_cipherCacheGeneration;
+    (void)SoftBusMutexUnlock(&g_cipherCacheLock);
+    if (cipherCtx == NULL) {
+        cipherCtx = SoftBusCreateGcmCipherCtx(key->value, key->len);
+    }
+    return cipherCtx;
+}
+
+static void PutBackCipherCtx(
+    int64_t authId, int32_t index, const SessionKey *key, SoftBusGcmCipherCtx *cipherCtx, uint32_t generation)
+{
+    if (SoftBusMutexLock(&g_cipherCacheLock) != SOFTBUS_OK) {
+        SoftBusDestroyGcmCipherCtx(cipherCtx);
+        return;
+    }
+    if (generation != g_cipherCacheGeneration) {
+        (void)SoftBusMutexUnlock(&g_cipherCacheLock);
+        SoftBusDestroyGcmCipherCtx(cipherCtx);
+        return;
+    }
+    CipherCacheItem *item = &g_cipherCache[GetCipherCacheSlot(authId, index)];
+    SoftBusGcmCipherCtx *evicted = item->cipherCtx;
+    item->authId = authId;
+    item->index = index;
+    item->key = *key;
+    item->cipherCtx = cipherCtx;
+    (void)SoftBusMutexUnlock(&g_cipherCacheLock);
+    SoftBusDestroyGcmCipherCtx(evicted);
+}
+
+int32_t EncryptDataByKey(int64_t authId, int32_t index, const SessionKey *key, const InDataInfo *inDataInfo,
+    uint8_t *outData, uint32_t *outLen)
+{
+    if (key == NULL || inDataInfo == NULL || inDataInfo->inData == NULL || inDataInfo->inLen == 0 ||
+        outData == NULL || outLen == NULL || *outLen < (inDataInfo->inLen + ENCRYPT_OVER_HEAD_LEN)) {
+        AUTH_LOGE(AUTH_FSM, "invalid param");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    /* pack key index */
+    *(uint32_t *)outData = SoftBusHtoLl((uint32_t)index);
+    int32_t ret;
+    uint32_t generation = 0;
+    SoftBusGcmCipherCtx *cipherCtx = TakeCipherCtx(authId, index, key, &generation);
+    if (cipherCtx == NULL) {
+        ret = EncryptDataByKeyInner(index, key, inDataInfo, outData, outLen);
+    } else {
+        ret = SoftBusEncryptDataWithCtx(
+            cipherCtx, inDataInfo->inData, inDataInfo->inLen, outData + ENCRYPT_INDEX_LEN, outLen, index);
+        PutBackCipherCtx(authId, index, key, cipherCtx, generation);
+    }
+    if (ret != SOFTBUS_OK) {
+        AUTH_LOGE(AUTH_FSM, "encrypt fail=%{public}d, authId=%{public}" PRId64, ret, authId);
+        return SOFTBUS_ENCRYPT_ERR;
+    }
+    *outLen += ENCRYPT_INDEX_LEN;
+    return SOFTBUS_OK;
+}
+
+int32_t DecryptDataByKey(int64_t authId, int32_t index, const SessionKey *key, const InDataInfo *inDataInfo,
+    uint8_t *outData, uint32_t *outLen)
+{
+    if (key == NULL || inDataInfo == NULL || inDataInfo->inData == NULL || outData == NULL || outLen == NULL ||
+        inDataInfo->inLen <= ENCRYPT_OVER_HEAD_LEN || *outLen < (inDataInfo->inLen - ENCRYPT_OVER_HEAD_LEN)) {
+        AUTH_LOGE(AUTH_FSM, "invalid param");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    int32_t ret;
+    uint32_t generation = 0;
+    SoftBusGcmCipherCtx *cipherCtx = TakeCipherCtx(authId, index, key, &generation);
+    if (cipherCtx == NULL) {
+        ret = DecryptDataByKeyInner(index, key, inDataInfo, outData, outLen);
+    } else {
+        ret = SoftBusDecryptDataWithCtx(cipherCtx, inDataInfo->inData + ENCRYPT_INDEX_LEN,
+            inDataInfo->inLen - ENCRYPT_INDEX_LEN, outData, outLen);
+        PutBackCipherCtx(authId, index, key, cipherCtx, generation);
+    }
+    if (ret != SOFTBUS_OK) {
+        AUTH_LOGE(AUTH_FSM, "decrypt fail=%{public}d, authId=%{public}" PRId64, ret, authId);
+        return SOFTBUS_DECRYPT_ERR;
+    }
+    return SOFTBUS_OK;
+}
+
 /* For Debug */
 void DumpSessionkeyList(const SessionKeyList *list)
 {
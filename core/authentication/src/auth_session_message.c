@@ -194,39 +194,60 @@ static void DfxRecordLnnPostDeviceInfoStart(int64_t authSeq, const AuthSessionIn
     LNN_EVENT(EVENT_SCENE_JOIN_LNN, EVENT_STAGE_AUTH_DEVICE_INFO_POST, extra);
 }
 
-static void SetCompressFlagByAuthInfo(
-    const AuthSessionInfo *info, char *msg, int32_t *compressFlag, uint8_t **compressData, uint32_t *compressLen)
+static void SetCompressFlagByAuthInfo(const AuthSessionInfo *info, uint8_t *msg, uint32_t msgLen,
+    int32_t *compressFlag, uint8_t **compressData, uint32_t *compressLen)
 {
     if ((info->connInfo.type != AUTH_LINK_TYPE_WIFI && info->connInfo.type != AUTH_LINK_TYPE_USB) &&
         info->isSupportCompress) {
-        AUTH_LOGD(AUTH_FSM, "before compress, datalen=%{public}zu", strlen(msg) + 1);
-        if (DataCompress((uint8_t *)msg, strlen(msg) + 1, compressData, compressLen) != SOFTBUS_OK) {
+        AUTH_LOGD(AUTH_FSM, "before compress, datalen=%{public}u", msgLen);
+        CompressDictType dictType = info->isSupportCompressDict ? COMPRESS_DICT_DEVICE_INFO : COMPRESS_DICT_NONE;
+        if (DataCompressWithDict(dictType, msg, msgLen, compressData, compressLen) != SOFTBUS_OK) {
             *compressFlag = FLAG_UNCOMPRESS_DEVICE_INFO;
         } else {
             *compressFlag = FLAG_COMPRESS_DEVICE_INFO;
             AUTH_LOGD(AUTH_FSM, "deviceInfo compress finish");
         }
-        AUTH_LOGI(AUTH_FSM, "before compress, datalen=%{public}zu,"
-            " after compress, datalen=%{public}u", strlen(msg) + 1, *compressLen);
+        AUTH_LOGI(AUTH_FSM, "before compress, datalen=%{public}u,"
+            " after compress, datalen=%{public}u", msgLen, *compressLen);
     }
 }
 
-static void SetIndataInfo(InDataInfo *inDataInfo, uint8_t *compressData, uint32_t compressLen, char *msg)
+static void SetIndataInfo(
+    InDataInfo *inDataInfo, uint8_t *compressData, uint32_t compressLen, uint8_t *msg, uint32_t msgLen)
 {
     if ((compressData != NULL) && (compressLen != 0)) {
         inDataInfo->inData = compressData;
         inDataInfo->inLen = compressLen;
     } else {
-        inDataInfo->inData = (uint8_t *)msg;
-        inDataInfo->inLen = strlen(msg) + 1;
+        inDataInfo->inData = msg;
+        inDataInfo->inLen = msgLen;
     }
 }
 
+static uint8_t *PackDeviceInfoData(const AuthSessionInfo *info, uint32_t *len)
+{
+    uint8_t *data = NULL;
+    if (info->isSupportDeviceInfoTlv && info->version >= SOFTBUS_NEW_V1) {
+        if (PackDeviceInfoTlvMessage(&(info->connInfo), info->version, info->uuid, info, &data, len) == SOFTBUS_OK) {
+            AUTH_LOGI(AUTH_FSM, "pack device info tlv, len=%{public}u", *len);
+            return data;
+        }
+        AUTH_LOGW(AUTH_FSM, "pack device info tlv fail, fallback to json");
+    }
+    char *msg = PackDeviceInfoMessage(&(info->connInfo), info->version, false, info->uuid, info);
+    if (msg == NULL) {
+        return NULL;
+    }
+    *len = strlen(msg) + 1;
+    return (uint8_t *)msg;
+}
+
 int32_t PostDeviceInfoMessage(int64_t authSeq, const AuthSessionInfo *info)
 {
     DfxRecordLnnPostDeviceInfoStart(authSeq, info);
     AUTH_CHECK_AND_RETURN_RET_LOGE(info != NULL, SOFTBUS_INVALID_PARAM, AUTH_FSM, "info is NULL");
-    char *msg = PackDeviceInfoMessage(&(info->connInfo), info->version, false, info->uuid, info);
+    uint32_t msgLen = 0;
+    uint8_t *msg = PackDeviceInfoData(info, &msgLen);
     if (msg == NULL) {
         AUTH_LOGE(AUTH_FSM, "pack device info fail");
         return SOFTBUS_AUTH_PACK_DEVINFO_FAIL;
@@ -234,20 +255,20 @@ int32_t PostDeviceInfoMessage(int64_t authSeq, const AuthSessionInfo *info)
     int32_t compressFlag = FLAG_UNCOMPRESS_DEVICE_INFO;
     uint8_t *compressData = NULL;
     uint32_t compressLen = 0;
-    SetCompressFlagByAuthInfo(info, msg, &compressFlag, &compressData, &compressLen);
+    SetCompressFlagByAuthInfo(info, msg, msgLen, &compressFlag, &compressData, &compressLen);
     InDataInfo inDataInfo = { 0 };
     uint8_t *data = NULL;
     uint32_t dataLen = 0;
-    SetIndataInfo(&inDataInfo, compressData, compressLen, msg);
+    SetIndataInfo(&inDataInfo, compressData, compressLen, msg, msgLen);
     SessionKeyList sessionKeyList;
     GetDumpSessionKeyList(authSeq, info, &sessionKeyList);
     if (EncryptInner(&sessionKeyList, info->connInfo.type, &inDataInfo, &data, &dataLen) != SOFTBUS_OK) {
         AUTH_LOGE(AUTH_FSM, "encrypt device info fail");
-        JSON_Free(msg);
+        SoftBusFree(msg);
         SoftBusFree(compressData);
         return SOFTBUS_ENCRYPT_ERR;
     }
-    JSON_Free(msg);
+    SoftBusFree(msg);
     SoftBusFree(compressData);
     DestroySessionKeyList(&sessionKeyList);
     if ((info->connInfo.type == AUTH_LINK_TYPE_WIFI || info->connInfo.type == AUTH_LINK_TYPE_USB) && info->isServer) {
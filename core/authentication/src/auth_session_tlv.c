@@ -0,0 +1,497 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "auth_session_tlv.h"
+
+#include <securec.h>
+#include <stddef.h>
+
+#include "auth_log.h"
+#include "softbus_adapter_mem.h"
+#include "softbus_adapter_socket.h"
+#include "softbus_error_code.h"
+#include "softbus_tlv_utils.h"
+#include "softbus_utils.h"
+
+#define DEV_INFO_TLV_MAGIC       0xD7
+#define DEV_INFO_TLV_HEAD_LEN    4
+#define DEV_INFO_TLV_MAGIC_POS   0
+#define DEV_INFO_TLV_VERSION_POS 1
+#define DEV_INFO_TLV_LENGTH_POS  2
+#define DEV_INFO_TLV_NUMBER_MAX  8
+
+#define FIELD_FLAG_CUSTOM_PACK 0x01 // value is produced by PackCustomMembers
+#define FIELD_FLAG_KEEP        0x02 // always packed, value is untouched when absent
+#define FIELD_FLAG_META        0x04 // only exchanged in meta auth
+
+/* type values are on the wire, append new types before DEV_INFO_TLV_BUTT and never reorder */
+typedef enum {
+    DEV_INFO_TLV_SW_VERSION = 1,
+    DEV_INFO_TLV_MASTER_UDID,
+    DEV_INFO_TLV_NODE_ADDR,
+    DEV_INFO_TLV_DEVICE_NAME,
+    DEV_INFO_TLV_UNIFIED_NAME,
+    DEV_INFO_TLV_UNIFIED_DEFAULT_NAME,
+    DEV_INFO_TLV_NICK_NAME,
+    DEV_INFO_TLV_NETWORK_ID,
+    DEV_INFO_TLV_DEVICE_TYPE_ID,
+    DEV_INFO_TLV_DEVICE_UDID,
+    DEV_INFO_TLV_PRODUCT_ID,
+    DEV_INFO_TLV_MODEL_NAME,
+    DEV_INFO_TLV_DEVICE_UUID,
+    DEV_INFO_TLV_VERSION_TYPE,
+    DEV_INFO_TLV_NET_CAP,
+    DEV_INFO_TLV_STATIC_NET_CAP,
+    DEV_INFO_TLV_AUTH_CAP,
+    DEV_INFO_TLV_HB_CAP,
+    DEV_INFO_TLV_DATA_CHANGE_FLAG,
+    DEV_INFO_TLV_IS_CHARGING,
+    DEV_INFO_TLV_REMAIN_POWER,
+    DEV_INFO_TLV_BLE_P2P,
+    DEV_INFO_TLV_TRANSPORT_PROTOCOL,
+    DEV_INFO_TLV_IS_SUPPORT_IPV6,
+    DEV_INFO_TLV_PKG_VERSION,
+    DEV_INFO_TLV_WIFI_VERSION,
+    DEV_INFO_TLV_BLE_VERSION,
+    DEV_INFO_TLV_BT_MAC,
+    DEV_INFO_TLV_BLE_MAC,
+    DEV_INFO_TLV_IS_SCREENON,
+    DEV_INFO_TLV_NODE_WEIGHT,
+    DEV_INFO_TLV_ACCOUNT_ID,
+    DEV_INFO_TLV_ACCOUNT_UID,
+    DEV_INFO_TLV_BLE_TIMESTAMP,
+    DEV_INFO_TLV_WIFI_BUFF_SIZE,
+    DEV_INFO_TLV_BR_BUFF_SIZE,
+    DEV_INFO_TLV_FEATURE,
+    DEV_INFO_TLV_CONN_SUB_FEATURE,
+    DEV_INFO_TLV_SLE_RANGE_CAP,
+    DEV_INFO_TLV_SLE_MAC,
+    DEV_INFO_TLV_OS_TYPE,
+    DEV_INFO_TLV_OS_VERSION,
+    DEV_INFO_TLV_DEVICE_VERSION,
+    DEV_INFO_TLV_STATE_VERSION_REASON,
+    DEV_INFO_TLV_P2P_ROLE,
+    DEV_INFO_TLV_P2P_MAC,
+    DEV_INFO_TLV_HML_MAC,
+    DEV_INFO_TLV_WIFI_CFG,
+    DEV_INFO_TLV_CHAN_LIST_5G,
+    DEV_INFO_TLV_STA_FREQUENCY,
+    DEV_INFO_TLV_DEVICE_SECURITY_LEVEL,
+    DEV_INFO_TLV_SPARK_CHECK,
+    DEV_INFO_TLV_BUTT,
+} DevInfoTlvType;
+
+typedef enum {
+    FIELD_KIND_STRING = 1,
+    FIELD_KIND_NUMBER,
+    FIELD_KIND_BYTES,
+} DevInfoFieldKind;
+
+typedef struct {
+    uint8_t kind;
+    uint8_t flags;
+    uint16_t size;
+    uint32_t offset;
+    int64_t defValue;
+} DevInfoTlvField;
+
+#define NODE_FIELD(fieldKind, fieldFlags, member, def)                                             \
+    {                                                                                              \
+        .kind = (fieldKind), .flags = (fieldFlags), .size = sizeof(((NodeInfo *)0)->member),       \
+        .offset = offsetof(NodeInfo, member), .defValue = (def)                                    \
+    }
+#define NODE_STRING(member, flags) NODE_FIELD(FIELD_KIND_STRING, flags, member, 0)
+#define NODE_NUMBER(member, flags, def) NODE_FIELD(FIELD_KIND_NUMBER, flags, member, def)
+#define NODE_BYTES(member) NODE_FIELD(FIELD_KIND_BYTES, 0, member, 0)
+
+static const DevInfoTlvField g_devInfoFields[DEV_INFO_TLV_BUTT] = {
+    [DEV_INFO_TLV_SW_VERSION] = NODE_STRING(softBusVersion, 0),
+    [DEV_INFO_TLV_MASTER_UDID] = NODE_STRING(masterUdid, 0),
+    [DEV_INFO_TLV_NODE_ADDR] = NODE_STRING(nodeAddress, 0),
+    [DEV_INFO_TLV_DEVICE_NAME] = NODE_STRING(deviceInfo.deviceName, FIELD_FLAG_CUSTOM_PACK),
+    [DEV_INFO_TLV_UNIFIED_NAME] = NODE_STRING(deviceInfo.unifiedName, FIELD_FLAG_CUSTOM_PACK),
+    [DEV_INFO_TLV_UNIFIED_DEFAULT_NAME] = NODE_STRING(deviceInfo.unifiedDefaultName, 0),
+    [DEV_INFO_TLV_NICK_NAME] = NODE_STRING(deviceInfo.nickName, 0),
+    [DEV_INFO_TLV_NETWORK_ID] = NODE_STRING(networkId, 0),
+    [DEV_INFO_TLV_DEVICE_TYPE_ID] = NODE_NUMBER(deviceInfo.deviceTypeId, 0, 0),
+    [DEV_INFO_TLV_DEVICE_UDID] = NODE_STRING(deviceInfo.deviceUdid, 0),
+    [DEV_INFO_TLV_PRODUCT_ID] = NODE_STRING(deviceInfo.productId, 0),
+    [DEV_INFO_TLV_MODEL_NAME] = NODE_STRING(deviceInfo.modelName, 0),
+    [DEV_INFO_TLV_DEVICE_UUID] = NODE_STRING(uuid, FIELD_FLAG_META),
+    [DEV_INFO_TLV_VERSION_TYPE] = NODE_STRING(versionType, 0),
+    [DEV_INFO_TLV_NET_CAP] = NODE_NUMBER(netCapacity, 0, 0),
+    [DEV_INFO_TLV_STATIC_NET_CAP] = NODE_NUMBER(staticNetCap, 0, DEFAULT_STATIC_NET_CAP),
+    [DEV_INFO_TLV_AUTH_CAP] = NODE_NUMBER(authCapacity, 0, 0),
+    [DEV_INFO_TLV_HB_CAP] = NODE_NUMBER(heartbeatCapacity, 0, 0),
+    [DEV_INFO_TLV_DATA_CHANGE_FLAG] = NODE_NUMBER(dataChangeFlag, 0, 0),
+    [DEV_INFO_TLV_IS_CHARGING] = NODE_NUMBER(batteryInfo.isCharging, 0, 0),
+    [DEV_INFO_TLV_REMAIN_POWER] = NODE_NUMBER(batteryInfo.batteryLevel, 0, 0),
+    [DEV_INFO_TLV_BLE_P2P] = NODE_NUMBER(isBleP2p, 0, 0),
+    [DEV_INFO_TLV_TRANSPORT_PROTOCOL] = NODE_NUMBER(supportedProtocols, FIELD_FLAG_KEEP, 0),
+    [DEV_INFO_TLV_IS_SUPPORT_IPV6] = NODE_NUMBER(isSupportIpv6, FIELD_FLAG_CUSTOM_PACK, 0),
+    [DEV_INFO_TLV_PKG_VERSION] = NODE_STRING(pkgVersion, 0),
+    [DEV_INFO_TLV_WIFI_VERSION] = NODE_NUMBER(wifiVersion, 0, 0),
+    [DEV_INFO_TLV_BLE_VERSION] = NODE_NUMBER(bleVersion, 0, 0),
+    [DEV_INFO_TLV_BT_MAC] = NODE_STRING(connectInfo.macAddr, FIELD_FLAG_CUSTOM_PACK),
+    [DEV_INFO_TLV_BLE_MAC] = NODE_STRING(connectInfo.bleMacAddr, 0),
+    [DEV_INFO_TLV_IS_SCREENON] = NODE_NUMBER(isScreenOn, 0, 0),
+    [DEV_INFO_TLV_NODE_WEIGHT] = NODE_NUMBER(masterWeight, 0, DEFAULT_NODE_WEIGHT),
+    [DEV_INFO_TLV_ACCOUNT_ID] = NODE_NUMBER(accountId, 0, 0),
+    [DEV_INFO_TLV_ACCOUNT_UID] = NODE_STRING(accountUid, 0),
+    [DEV_INFO_TLV_BLE_TIMESTAMP] = NODE_NUMBER(bleStartTimestamp, FIELD_FLAG_KEEP, 0),
+    [DEV_INFO_TLV_WIFI_BUFF_SIZE] = NODE_NUMBER(wifiBuffSize, 0, DEFAULT_WIFI_BUFF_SIZE),
+    [DEV_INFO_TLV_BR_BUFF_SIZE] = NODE_NUMBER(brBuffSize, 0, DEFAULT_BR_BUFF_SIZE),
+    [DEV_INFO_TLV_FEATURE] = NODE_NUMBER(feature, 0, 0),
+    [DEV_INFO_TLV_CONN_SUB_FEATURE] = NODE_NUMBER(connSubFeature, 0, 0),
+    [DEV_INFO_TLV_SLE_RANGE_CAP] = NODE_NUMBER(sleRangeCapacity, 0, 0),
+    [DEV_INFO_TLV_SLE_MAC] = NODE_STRING(connectInfo.sleMacAddr, 0),
+    [DEV_INFO_TLV_OS_TYPE] = NODE_NUMBER(deviceInfo.osType, 0, -1),
+    [DEV_INFO_TLV_OS_VERSION] = NODE_STRING(deviceInfo.osVersion, 0),
+    [DEV_INFO_TLV_DEVICE_VERSION] = NODE_STRING(deviceInfo.deviceVersion, 0),
+    [DEV_INFO_TLV_STATE_VERSION_REASON] = NODE_NUMBER(stateVersionReason, 0, 0),
+    [DEV_INFO_TLV_P2P_ROLE] = NODE_NUMBER(p2pInfo.p2pRole, 0, -1),
+    [DEV_INFO_TLV_P2P_MAC] = NODE_STRING(p2pInfo.p2pMac, 0),
+    [DEV_INFO_TLV_HML_MAC] = NODE_STRING(wifiDirectAddr, 0),
+    [DEV_INFO_TLV_WIFI_CFG] = NODE_STRING(p2pInfo.wifiCfg, 0),
+    [DEV_INFO_TLV_CHAN_LIST_5G] = NODE_STRING(p2pInfo.chanList5g, 0),
+    [DEV_INFO_TLV_STA_FREQUENCY] = NODE_NUMBER(p2pInfo.staFrequency, 0, -1),
+    [DEV_INFO_TLV_DEVICE_SECURITY_LEVEL] = NODE_NUMBER(deviceSecurityLevel, 0, 0),
+    [DEV_INFO_TLV_SPARK_CHECK] = NODE_BYTES(sparkCheck),
+};
+
+static bool IsFieldEnabled(const DevInfoTlvField *field, const DevInfoTlvOption *option)
+{
+    if (field->kind == 0) {
+        return false;
+    }
+    return (field->flags & FIELD_FLAG_META) == 0 || option->isMetaAuth;
+}
+
+static void WriteNumber(uint8_t *buf, uint32_t size, uint64_t value)
+{
+    uint8_t value8 = (uint8_t)value;
+    uint16_t value16 = (uint16_t)value;
+    uint32_t value32 = (uint32_t)value;
+    switch (size) {
+        case sizeof(uint8_t):
+            (void)memcpy_s(buf, size, &value8, sizeof(value8));
+            break;
+        case sizeof(uint16_t):
+            (void)memcpy_s(buf, size, &value16, sizeof(value16));
+            break;
+        case sizeof(uint32_t):
+            (void)memcpy_s(buf, size, &value32, sizeof(value32));
+            break;
+        case sizeof(uint64_t):
+            (void)memcpy_s(buf, size, &value, sizeof(value));
+            break;
+        default:
+            break;
+    }
+}
+
+static uint64_t ReadNumber(const uint8_t *buf, uint32_t size)
+{
+    uint8_t value8 = 0;
+    uint16_t value16 = 0;
+    uint32_t value32 = 0;
+    uint64_t value64 = 0;
+    switch (size) {
+        case sizeof(uint8_t):
+            (void)memcpy_s(&value8, sizeof(value8), buf, size);
+            return value8;
+        case sizeof(uint16_t):
+            (void)memcpy_s(&value16, sizeof(value16), buf, size);
+            return value16;
+        case sizeof(uint32_t):
+            (void)memcpy_s(&value32, sizeof(value32), buf, size);
+            return value32;
+        case sizeof(uint64_t):
+            (void)memcpy_s(&value64, sizeof(value64), buf, size);
+            return value64;
+        default:
+            return 0;
+    }
+}
+
+static int32_t AddNumberMember(TlvObject *tlv, uint32_t type, const uint8_t *field, uint32_t size)
+{
+    uint64_t value = ReadNumber(field, size);
+    switch (size) {
+        case sizeof(uint8_t):
+            return AddTlvMemberU8(tlv, type, (uint8_t)value);
+        case sizeof(uint16_t):
+            return AddTlvMemberU16(tlv, type, (uint16_t)value);
+        case sizeof(uint32_t):
+            return AddTlvMemberU32(tlv, type, (uint32_t)value);
+        case sizeof(uint64_t):
+            return AddTlvMemberU64(tlv, type, value);
+        default:
+            return SOFTBUS_INVALID_PARAM;
+    }
+}
+
+static int32_t AddStringMember(TlvObject *tlv, uint32_t type, const char *str, uint32_t size)
+{
+    uint32_t len = strnlen(str, size);
+    if (len == size) {
+        AUTH_LOGE(AUTH_FSM, "string not terminated, type=%{public}u", type);
+        return SOFTBUS_INVALID_PARAM;
+    }
+    if (len == 0) {
+        return SOFTBUS_OK;
+    }
+    return AddTlvMember(tlv, type, len, (const uint8_t *)str);
+}
+
+static int32_t PackTableMember(TlvObject *tlv, uint32_t type, const DevInfoTlvField *field, const NodeInfo *info)
+{
+    const uint8_t *value = (const uint8_t *)info + field->offset;
+    uint8_t defValue[DEV_INFO_TLV_NUMBER_MAX] = { 0 };
+    switch (field->kind) {
+        case FIELD_KIND_STRING:
+            return AddStringMember(tlv, type, (const char *)value, field->size);
+        case FIELD_KIND_NUMBER:
+            WriteNumber(defValue, field->size, (uint64_t)field->defValue);
+            if ((field->flags & FIELD_FLAG_KEEP) == 0 && memcmp(value, defValue, field->size) == 0) {
+                return SOFTBUS_OK;
+            }
+            return AddNumberMember(tlv, type, value, field->size);
+        case FIELD_KIND_BYTES:
+            return AddTlvMember(tlv, type, field->size, value);
+        default:
+            return SOFTBUS_INVALID_PARAM;
+    }
+}
+
+static int32_t PackCustomMembers(TlvObject *tlv, const NodeInfo *info, const DevInfoTlvOption *option)
+{
+    const char *deviceName = (option->deviceName != NULL) ? option->deviceName : info->deviceInfo.deviceName;
+    const char *unifiedName = (option->unifiedName != NULL) ? option->unifiedName : info->deviceInfo.unifiedName;
+    char btMacUpper[MAC_LEN] = { 0 };
+    if (StringToUpperCase(info->connectInfo.macAddr, btMacUpper, MAC_LEN) != SOFTBUS_OK &&
+        strcpy_s(btMacUpper, MAC_LEN, info->connectInfo.macAddr) != EOK) {
+        AUTH_LOGE(AUTH_FSM, "btMac cpy fail");
+        return SOFTBUS_MEM_ERR;
+    }
+    if (AddStringMember(tlv, DEV_INFO_TLV_DEVICE_NAME, deviceName, DEVICE_NAME_BUF_LEN) != SOFTBUS_OK ||
+        AddStringMember(tlv, DEV_INFO_TLV_UNIFIED_NAME, unifiedName, DEVICE_NAME_BUF_LEN) != SOFTBUS_OK ||
+        AddStringMember(tlv, DEV_INFO_TLV_BT_MAC, btMacUpper, MAC_LEN) != SOFTBUS_OK ||
+        AddTlvMemberU8(tlv, DEV_INFO_TLV_IS_SUPPORT_IPV6, true) != SOFTBUS_OK) {
+        return SOFTBUS_AUTH_PACK_DEVINFO_FAIL;
+    }
+    return SOFTBUS_OK;
+}
+
+static int32_t PackDeviceInfoTlv(const NodeInfo *info, const DevInfoTlvOption *option, uint8_t **body,
+    uint32_t *bodyLen)
+{
+    TlvObject *tlv = CreateTlvObject(UINT8_T, UINT16_T);
+    if (tlv == NULL) {
+        AUTH_LOGE(AUTH_FSM, "create tlv object fail");
+        return SOFTBUS_MALLOC_ERR;
+    }
+    int32_t ret = PackCustomMembers(tlv, info, option);
+    for (uint32_t type = 0; type < DEV_INFO_TLV_BUTT && ret == SOFTBUS_OK; type++) {
+        const DevInfoTlvField *field = &g_devInfoFields[type];
+        if (!IsFieldEnabled(field, option) || (field->flags & FIELD_FLAG_CUSTOM_PACK) != 0) {
+            continue;
+        }
+        ret = PackTableMember(tlv, type, field, info);
+        if (ret != SOFTBUS_OK) {
+            AUTH_LOGE(AUTH_FSM, "pack member fail, type=%{public}u, ret=%{public}d", type, ret);
+        }
+    }
+    if (ret == SOFTBUS_OK) {
+        ret = GetTlvBinary(tlv, body, bodyLen);
+    }
+    DestroyTlvObject(tlv);
+    if (ret != SOFTBUS_OK) {
+        return ret;
+    }
+    if (*bodyLen >= MAX_TLV_BINARY_LENGTH) {
+        AUTH_LOGE(AUTH_FSM, "tlv too long, len=%{public}u", *bodyLen);
+        SoftBusFree(*body);
+        *body = NULL;
+        return SOFTBUS_AUTH_PACK_DEVINFO_FAIL;
+    }
+    return SOFTBUS_OK;
+}
+
+bool IsDeviceInfoTlvFrame(const uint8_t *data, uint32_t len)
+{
+    return data != NULL && len > DEV_INFO_TLV_HEAD_LEN && data[DEV_INFO_TLV_MAGIC_POS] == DEV_INFO_TLV_MAGIC &&
+        data[DEV_INFO_TLV_VERSION_POS] != 0;
+}
+
+int32_t PackDeviceInfoTlvFrame(const NodeInfo *info, const DevInfoTlvOption *option, const char *jsonExt,
+    uint8_t **frame, uint32_t *frameLen)
+{
+    if (info == NULL || option == NULL || jsonExt == NULL || frame == NULL || frameLen == NULL) {
+        AUTH_LOGE(AUTH_FSM, "invalid param");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    uint8_t *body = NULL;
+    uint32_t bodyLen = 0;
+    int32_t ret = PackDeviceInfoTlv(info, option, &body, &bodyLen);
+    if (ret != SOFTBUS_OK) {
+        return ret;
+    }
+    uint32_t extLen = strlen(jsonExt) + 1;
+    uint32_t len = DEV_INFO_TLV_HEAD_LEN + bodyLen + extLen;
+    uint8_t *buf = (uint8_t *)SoftBusMalloc(len);
+    if (buf == NULL) {
+        AUTH_LOGE(AUTH_FSM, "malloc frame fail");
+        SoftBusFree(body);
+        return SOFTBUS_MALLOC_ERR;
+    }
+    uint16_t netBodyLen = SoftBusHtoLs((uint16_t)bodyLen);
+    buf[DEV_INFO_TLV_MAGIC_POS] = DEV_INFO_TLV_MAGIC;
+    buf[DEV_INFO_TLV_VERSION_POS] = DEVICE_INFO_TLV_VERSION;
+    if (memcpy_s(buf + DEV_INFO_TLV_LENGTH_POS, len - DEV_INFO_TLV_LENGTH_POS, &netBodyLen, sizeof(netBodyLen)) !=
+        EOK || memcpy_s(buf + DEV_INFO_TLV_HEAD_LEN, len - DEV_INFO_TLV_HEAD_LEN, body, bodyLen) != EOK ||
+        memcpy_s(buf + DEV_INFO_TLV_HEAD_LEN + bodyLen, extLen, jsonExt, extLen) != EOK) {
+        AUTH_LOGE(AUTH_FSM, "memcpy frame fail");
+        SoftBusFree(body);
+        SoftBusFree(buf);
+        return SOFTBUS_MEM_ERR;
+    }
+    SoftBusFree(body);
+    *frame = buf;
+    *frameLen = len;
+    return SOFTBUS_OK;
+}
+
+static void SetFieldDefaults(NodeInfo *info, const DevInfoTlvOption *option)
+{
+    for (uint32_t type = 0; type < DEV_INFO_TLV_BUTT; type++) {
+        const DevInfoTlvField *field = &g_devInfoFields[type];
+        if (!IsFieldEnabled(field, option) || (field->flags & FIELD_FLAG_KEEP) != 0) {
+            continue;
+        }
+        uint8_t *value = (uint8_t *)info + field->offset;
+        if (field->kind == FIELD_KIND_STRING) {
+            value[0] = '\0';
+        } else if (field->kind == FIELD_KIND_NUMBER) {
+            WriteNumber(value, field->size, (uint64_t)field->defValue);
+        }
+    }
+}
+
+static void UnpackTableMember(const TlvMember *member, NodeInfo *info, const DevInfoTlvOption *option)
+{
+    if (member->type >= DEV_INFO_TLV_BUTT || !IsFieldEnabled(&g_devInfoFields[member->type], option)) {
+        // unknown types come from newer peers, skip them
+        return;
+    }
+    const DevInfoTlvField *field = &g_devInfoFields[member->type];
+    uint8_t *value = (uint8_t *)info + field->offset;
+    switch (field->kind) {
+        case FIELD_KIND_STRING:
+            if (member->length >= field->size || memcpy_s(value, field->size, member->value, member->length) != EOK) {
+                AUTH_LOGW(AUTH_FSM, "invalid string, type=%{public}u, len=%{public}u", member->type, member->length);
+                return;
+            }
+            value[member->length] = '\0';
+            break;
+        case FIELD_KIND_NUMBER:
+            if (member->length != field->size) {
+                AUTH_LOGW(AUTH_FSM, "invalid number, type=%{public}u, len=%{public}u", member->type, member->length);
+                return;
+            }
+            if (field->size == sizeof(uint16_t)) {
+                WriteNumber(value, field->size, SoftBusLtoHs((uint16_t)ReadNumber(member->value, field->size)));
+            } else if (field->size == sizeof(uint32_t)) {
+                WriteNumber(value, field->size, SoftBusLtoHl((uint32_t)ReadNumber(member->value, field->size)));
+            } else if (field->size == sizeof(uint64_t)) {
+                WriteNumber(value, field->size, SoftBusLtoHll(ReadNumber(member->value, field->size)));
+            } else {
+                // single byte fields are bool
+                WriteNumber(value, field->size, ReadNumber(member->value, field->size) != 0);
+            }
+            break;
+        case FIELD_KIND_BYTES:
+            if (member->length != field->size || memcpy_s(value, field->size, member->value, member->length) != EOK) {
+                AUTH_LOGW(AUTH_FSM, "invalid bytes, type=%{public}u, len=%{public}u", member->type, member->length);
+            }
+            break;
+        default:
+            break;
+    }
+}
+
+static int32_t UnpackDeviceInfoTlv(const uint8_t *body, uint32_t bodyLen, const DevInfoTlvOption *option,
+    NodeInfo *info)
+{
+    TlvObject *tlv = CreateTlvObject(UINT8_T, UINT16_T);
+    if (tlv == NULL) {
+        AUTH_LOGE(AUTH_FSM, "create tlv object fail");
+        return SOFTBUS_MALLOC_ERR;
+    }
+    int32_t ret = SetTlvBinary(tlv, body, bodyLen);
+    if (ret != SOFTBUS_OK) {
+        AUTH_LOGE(AUTH_FSM, "parse tlv fail, ret=%{public}d", ret);
+        DestroyTlvObject(tlv);
+        return SOFTBUS_AUTH_UNPACK_DEVINFO_FAIL;
+    }
+    SetFieldDefaults(info, option);
+    TlvMember *member = NULL;
+    TLV_FOR_EACH_ENTRY(member, tlv, TlvMember, node) {
+        UnpackTableMember(member, info, option);
+    }
+    DestroyTlvObject(tlv);
+    if (info->deviceInfo.osType == -1 && info->authCapacity != 0) {
+        info->deviceInfo.osType = OH_OS_TYPE;
+    }
+    if (option->version >= SOFTBUS_NEW_V1 && strlen(info->nodeAddress) == 0) {
+        (void)strcpy_s(info->nodeAddress, sizeof(info->nodeAddress), NODE_ADDR_LOOPBACK);
+    }
+    return SOFTBUS_OK;
+}
+
+int32_t UnpackDeviceInfoTlvFrame(const uint8_t *frame, uint32_t frameLen, const DevInfoTlvOption *option,
+    NodeInfo *info, const char **jsonExt, uint32_t *jsonExtLen)
+{
+    if (option == NULL || info == NULL || jsonExt == NULL || jsonExtLen == NULL ||
+        !IsDeviceInfoTlvFrame(frame, frameLen)) {
+        AUTH_LOGE(AUTH_FSM, "invalid param");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    uint16_t bodyLen = 0;
+    if (memcpy_s(&bodyLen, sizeof(bodyLen), frame + DEV_INFO_TLV_LENGTH_POS, sizeof(bodyLen)) != EOK) {
+        return SOFTBUS_MEM_ERR;
+    }
+    bodyLen = SoftBusLtoHs(bodyLen);
+    if (bodyLen == 0 || (uint32_t)bodyLen >= frameLen - DEV_INFO_TLV_HEAD_LEN) {
+        AUTH_LOGE(AUTH_FSM, "invalid tlv len=%{public}u, frameLen=%{public}u", bodyLen, frameLen);
+        return SOFTBUS_AUTH_UNPACK_DEVINFO_FAIL;
+    }
+    const uint8_t *ext = frame + DEV_INFO_TLV_HEAD_LEN + bodyLen;
+    uint32_t extLen = frameLen - DEV_INFO_TLV_HEAD_LEN - bodyLen;
+    if (ext[extLen - 1] != '\0') {
+        AUTH_LOGE(AUTH_FSM, "json extension not terminated");
+        return SOFTBUS_AUTH_UNPACK_DEVINFO_FAIL;
+    }
+    if (frame[DEV_INFO_TLV_VERSION_POS] != DEVICE_INFO_TLV_VERSION) {
+        AUTH_LOGI(AUTH_FSM, "peer tlv version=%{public}u", frame[DEV_INFO_TLV_VERSION_POS]);
+    }
+    int32_t ret = UnpackDeviceInfoTlv(frame + DEV_INFO_TLV_HEAD_LEN, bodyLen, option, info);
+    if (ret != SOFTBUS_OK) {
+        return ret;
+    }
+    *jsonExt = (const char *)ext;
+    *jsonExtLen = extLen;
+    return SOFTBUS_OK;
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef LNN_HEARTBEAT_DEADLINE_H
+#define LNN_HEARTBEAT_DEADLINE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "common_list.h"
+#include "lnn_heartbeat_utils_struct.h"
+#include "softbus_adapter_thread.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define HB_DEADLINE_BUCKET_NUM      64
+#define HB_DEADLINE_EXPIRED_MAX_NUM 16
+
+typedef struct {
+    char networkId[NETWORK_ID_BUF_LEN];
+    ConnectionAddrType addrType;
+    LnnHeartbeatType hbType;
+    uint64_t checkDelay;
+    uint64_t deadline;
+} LnnHbDeadlineInfo;
+
+/* set when the caller has to post the check timer, the timer hands timerSeq back when it fires */
+typedef struct {
+    bool needArm;
+    uint32_t timerSeq;
+    uint64_t delayMillis;
+} LnnHbDeadlineTimer;
+
+/* offline deadlines keyed by networkId and addrType, a single timer is kept on the earliest one */
+typedef struct {
+    SoftBusMutex lock;
+    bool isTimerArmed;
+    uint32_t timerSeq;
+    uint64_t timerDeadline;
+    uint32_t num;
+    ListNode bucket[HB_DEADLINE_BUCKET_NUM];
+} LnnHbDeadlineTable;
+
+int32_t LnnInitHbDeadlineTable(LnnHbDeadlineTable *table);
+void LnnDeinitHbDeadlineTable(LnnHbDeadlineTable *table);
+void LnnClearHbDeadlineTable(LnnHbDeadlineTable *table);
+/* add a peer or move its deadline in place, only a deadline earlier than the armed timer needs a new timer */
+int32_t LnnSetHbDeadline(LnnHbDeadlineTable *table, const LnnHbDeadlineInfo *info, uint64_t nowTime,
+    LnnHbDeadlineTimer *timer);
+void LnnRemoveHbDeadline(LnnHbDeadlineTable *table, const char *networkId, ConnectionAddrType addrType);
+/* take at most maxNum expired peers out when timer timerSeq fires, returns the taken count */
+uint32_t LnnPopExpiredHbDeadline(LnnHbDeadlineTable *table, uint32_t timerSeq, uint64_t nowTime,
+    LnnHbDeadlineInfo *expired, uint32_t maxNum, LnnHbDeadlineTimer *timer);
+/* forget timer timerSeq when it could not be posted, so the next deadline arms a new one */
+void LnnCancelHbDeadlineTimer(LnnHbDeadlineTable *table, uint32_t timerSeq);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* LNN_HEARTBEAT_DEADLINE_H */
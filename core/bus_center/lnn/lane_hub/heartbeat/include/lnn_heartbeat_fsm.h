@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,7 @@
 #ifndef LNN_HEARTBEAT_FSM_H
 #define LNN_HEARTBEAT_FSM_H
 
+#include "lnn_heartbeat_deadline.h"
 #include "lnn_heartbeat_medium_mgr.h"
 #include "lnn_state_machine.h"
 
@@ -48,6 +49,7 @@ typedef enum {
     EVENT_HB_UPDATE_SEND_INFO,
     EVENT_HB_SCREEN_OFF_CHECK_STATUS,
     EVENT_HB_CHECK_SLE_DEV_STATUS,
+    EVENT_HB_CHECK_OFFLINE_DEADLINE,
     EVENT_HB_MAX,
 } LnnHeartbeatEventType;
 
@@ -60,6 +62,7 @@ typedef struct {
 
     ListNode node;
     FsmStateMachine fsm;
+    LnnHbDeadlineTable deadlineTable;
 } LnnHeartbeatFsm;
 
 typedef struct {
@@ -115,6 +118,8 @@ int32_t LnnPostScreenOffCheckDevMsgToHbFsm(
     LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *para, uint64_t delayMillis);
 int32_t LnnPostSleCheckDevStatusMsgToHbFsm(
     LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *para, uint64_t delayMillis);
+int32_t LnnSetOfflineDeadlineToHbFsm(
+    LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *para, uint64_t delayMillis);
 
 void LnnRemoveSendEndMsg(LnnHeartbeatFsm *hbFsm, LnnProcessSendOnceMsgPara *msg, bool wakeupFlag, bool *isRemoved);
 void LnnRemoveCheckDevStatusMsg(LnnHeartbeatFsm *hbFsm, LnnCheckDevStatusMsgPara *msgPara);
@@ -122,6 +127,7 @@ void LnnRemoveScreenOffCheckStatusMsg(LnnHeartbeatFsm *hbFsm, LnnCheckDevStatusM
 void LnnRemoveProcessSendOnceMsg(
     LnnHeartbeatFsm *hbFsm, LnnHeartbeatType hbType, LnnHeartbeatStrategyType strategyType);
 void LnnRemoveSleCheckStatusMsg(LnnHeartbeatFsm *hbFsm, LnnCheckDevStatusMsgPara *msgPara);
+void LnnRemoveOfflineDeadlineFromHbFsm(LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *msgPara);
 
 LnnHeartbeatFsm *LnnCreateHeartbeatFsm(void);
 void LnnDestroyHeartbeatFsm(LnnHeartbeatFsm *hbFsm);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -1224,7 +1224,6 @@ int32_t LnnOfflineTimingByHeartbeat(const char *networkId, ConnectionAddrType ad
     (void)SoftBusGetTime(&time);
     uint64_t timeStamp = (uint64_t)time.sec * HB_TIME_FACTOR + (uint64_t)time.usec / HB_TIME_FACTOR;
     LnnSetDLHeartbeatTimestamp(networkId, timeStamp);
-    (void)LnnStopOfflineTimingStrategy(networkId, addrType);
     if (LnnStartOfflineTimingStrategy(networkId, addrType) != SOFTBUS_OK) {
         LNN_LOGE(LNN_HEART_BEAT, "ctrl start offline timing strategy fail");
         return SOFTBUS_NETWORK_HB_START_STRATEGY_FAIL;
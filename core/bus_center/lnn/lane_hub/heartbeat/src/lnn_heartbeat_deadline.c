@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "lnn_heartbeat_deadline.h"
+
+#include <securec.h>
+
+#include "lnn_log.h"
+#include "softbus_adapter_mem.h"
+#include "softbus_error_code.h"
+
+#define FNV_OFFSET_BASIS 2166136261U
+#define FNV_PRIME        16777619U
+
+typedef struct {
+    ListNode node;
+    LnnHbDeadlineInfo info;
+} HbDeadlineEntry;
+
+static uint32_t HashDeadlineKey(const char *networkId, ConnectionAddrType addrType)
+{
+    uint32_t digest = FNV_OFFSET_BASIS;
+    for (uint32_t i = 0; i < NETWORK_ID_BUF_LEN && networkId[i] != '\0'; i++) {
+        digest = (digest ^ (uint8_t)networkId[i]) * FNV_PRIME;
+    }
+    digest = (digest ^ (uint32_t)addrType) * FNV_PRIME;
+    return digest & (HB_DEADLINE_BUCKET_NUM - 1);
+}
+
+static HbDeadlineEntry *FindDeadlineEntryLocked(ListNode *bucket, const char *networkId,
+    ConnectionAddrType addrType)
+{
+    HbDeadlineEntry *entry = NULL;
+    LIST_FOR_EACH_ENTRY(entry, bucket, HbDeadlineEntry, node) {
+        if (entry->info.addrType == addrType && strncmp(entry->info.networkId, networkId, NETWORK_ID_BUF_LEN) == 0) {
+            return entry;
+        }
+    }
+    return NULL;
+}
+
+static void ArmTimerLocked(LnnHbDeadlineTable *table, uint64_t deadline, uint64_t nowTime, LnnHbDeadlineTimer *timer)
+{
+    if (table->isTimerArmed && table->timerDeadline <= deadline) {
+        return;
+    }
+    table->isTimerArmed = true;
+    table->timerSeq++;
+    table->timerDeadline = deadline;
+    timer->needArm = true;
+    timer->timerSeq = table->timerSeq;
+    timer->delayMillis = (deadline > nowTime) ? (deadline - nowTime) : 0;
+}
+
+int32_t LnnInitHbDeadlineTable(LnnHbDeadlineTable *table)
+{
+    LNN_CHECK_AND_RETURN_RET_LOGE(table != NULL, SOFTBUS_INVALID_PARAM, LNN_HEART_BEAT, "invalid param");
+    (void)memset_s(table, sizeof(LnnHbDeadlineTable), 0, sizeof(LnnHbDeadlineTable));
+    for (uint32_t i = 0; i < HB_DEADLINE_BUCKET_NUM; i++) {
+        ListInit(&table->bucket[i]);
+    }
+    if (SoftBusMutexInit(&table->lock, NULL) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_HEART_BEAT, "init deadline table lock fail");
+        return SOFTBUS_LOCK_ERR;
+    }
+    return SOFTBUS_OK;
+}
+
+void LnnClearHbDeadlineTable(LnnHbDeadlineTable *table)
+{
+    LNN_CHECK_AND_RETURN_LOGE(table != NULL, LNN_HEART_BEAT, "invalid param");
+    if (SoftBusMutexLock(&table->lock) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_HEART_BEAT, "lock deadline table fail");
+        return;
+    }
+    HbDeadlineEntry *entry = NULL;
+    HbDeadlineEntry *next = NULL;
+    for (uint32_t i = 0; i < HB_DEADLINE_BUCKET_NUM; i++) {
+        LIST_FOR_EACH_ENTRY_SAFE(entry, next, &table->bucket[i], HbDeadlineEntry, node) {
+            ListDelete(&entry->node);
+            SoftBusFree(entry);
+        }
+    }
+    table->num = 0;
+    table->isTimerArmed = false;
+    (void)SoftBusMutexUnlock(&table->lock);
+}
+
+void LnnDeinitHbDeadlineTable(LnnHbDeadlineTable *table)
+{
+    LNN_CHECK_AND_RETURN_LOGE(table != NULL, LNN_HEART_BEAT, "invalid param");
+    LnnClearHbDeadlineTable(table);
+    (void)SoftBusMutexDestroy(&table->lock);
+}
+
+int32_t LnnSetHbDeadline(LnnHbDeadlineTable *table, const LnnHbDeadlineInfo *info, uint64_t nowTime,
+    LnnHbDeadlineTimer *timer)
+{
+    LNN_CHECK_AND_RETURN_RET_LOGE(table != NULL && info != NULL && timer != NULL, SOFTBUS_INVALID_PARAM,
+        LNN_HEART_BEAT, "invalid param");
+    timer->needArm = false;
+    ListNode *bucket = &table->bucket[HashDeadlineKey(info->networkId, info->addrType)];
+    if (SoftBusMutexLock(&table->lock) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_HEART_BEAT, "lock deadline table fail");
+        return SOFTBUS_LOCK_ERR;
+    }
+    HbDeadlineEntry *entry = FindDeadlineEntryLocked(bucket, info->networkId, info->addrType);
+    if (entry == NULL) {
+        entry = (HbDeadlineEntry *)SoftBusCalloc(sizeof(HbDeadlineEntry));
+        if (entry == NULL) {
+            LNN_LOGE(LNN_HEART_BEAT, "malloc deadline entry fail");
+            (void)SoftBusMutexUnlock(&table->lock);
+            return SOFTBUS_MALLOC_ERR;
+        }
+        ListTailInsert(bucket, &entry->node);
+        table->num++;
+    }
+    entry->info = *info;
+    ArmTimerLocked(table, info->deadline, nowTime, timer);
+    (void)SoftBusMutexUnlock(&table->lock);
+    return SOFTBUS_OK;
+}
+
+void LnnRemoveHbDeadline(LnnHbDeadlineTable *table, const char *networkId, ConnectionAddrType addrType)
+{
+    LNN_CHECK_AND_RETURN_LOGE(table != NULL && networkId != NULL, LNN_HEART_BEAT, "invalid param");
+    ListNode *bucket = &table->bucket[HashDeadlineKey(networkId, addrType)];
+    if (SoftBusMutexLock(&table->lock) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_HEART_BEAT, "lock deadline table fail");
+        return;
+    }
+    HbDeadlineEntry *entry = FindDeadlineEntryLocked(bucket, networkId, addrType);
+    if (entry != NULL) {
+        ListDelete(&entry->node);
+        SoftBusFree(entry);
+        table->num--;
+    }
+    (void)SoftBusMutexUnlock(&table->lock);
+}
+
+uint32_t LnnPopExpiredHbDeadline(LnnHbDeadlineTable *table, uint32_t timerSeq, uint64_t nowTime,
+    LnnHbDeadlineInfo *expired, uint32_t maxNum, LnnHbDeadlineTimer *timer)
+{
+    LNN_CHECK_AND_RETURN_RET_LOGE(table != NULL && expired != NULL && maxNum != 0 && timer != NULL, 0,
+        LNN_HEART_BEAT, "invalid param");
+    timer->needArm = false;
+    if (SoftBusMutexLock(&table->lock) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_HEART_BEAT, "lock deadline table fail");
+        return 0;
+    }
+    if (table->isTimerArmed && table->timerSeq == timerSeq) {
+        table->isTimerArmed = false;
+    }
+    uint32_t num = 0;
+    bool hasNext = false;
+    uint64_t nextDeadline = 0;
+    HbDeadlineEntry *entry = NULL;
+    HbDeadlineEntry *next = NULL;
+    for (uint32_t i = 0; i < HB_DEADLINE_BUCKET_NUM; i++) {
+        LIST_FOR_EACH_ENTRY_SAFE(entry, next, &table->bucket[i], HbDeadlineEntry, node) {
+            if (entry->info.deadline <= nowTime && num < maxNum) {
+                expired[num++] = entry->info;
+                ListDelete(&entry->node);
+                SoftBusFree(entry);
+                table->num--;
+                continue;
+            }
+            // an expired peer left over by maxNum makes the next timer fire at once
+            if (!hasNext || entry->info.deadline < nextDeadline) {
+                nextDeadline = entry->info.deadline;
+                hasNext = true;
+            }
+        }
+    }
+    if (hasNext) {
+        ArmTimerLocked(table, nextDeadline, nowTime, timer);
+    }
+    (void)SoftBusMutexUnlock(&table->lock);
+    return num;
+}
+
+void LnnCancelHbDeadlineTimer(LnnHbDeadlineTable *table, uint32_t timerSeq)
+{
+    LNN_CHECK_AND_RETURN_LOGE(table != NULL, LNN_HEART_BEAT, "invalid param");
+    if (SoftBusMutexLock(&table->lock) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_HEART_BEAT, "lock deadline table fail");
+        return;
+    }
+    if (table->isTimerArmed && table->timerSeq == timerSeq) {
+        table->isTimerArmed = false;
+    }
+    (void)SoftBusMutexUnlock(&table->lock);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -57,6 +57,7 @@ static int32_t OnUpdateSendInfo(FsmStateMachine *fsm, int32_t msgType, void *par
 static int32_t OnScreeOffCheckDevStatus(FsmStateMachine *fsm, int32_t msgType, void *para);
 static int32_t OnReStartHbProcess(FsmStateMachine *fsm, int32_t msgType, void *para);
 static int32_t OnCheckSleDevStatus(FsmStateMachine *fsm, int32_t msgType, void *para);
+static int32_t OnCheckOfflineDeadline(FsmStateMachine *fsm, int32_t msgType, void *para);
 
 static LnnHeartbeatStateHandler g_hbNoneStateHandler[] = {
     {EVENT_HB_CHECK_DEV_STATUS, OnCheckDevStatus},
@@ -66,6 +67,7 @@ static LnnHeartbeatStateHandler g_hbNoneStateHandler[] = {
     {EVENT_HB_AS_NORMAL_NODE, OnTransHbFsmState},
     {EVENT_HB_IN_NONE_STATE, OnTransHbFsmState},
     {EVENT_HB_SCREEN_OFF_CHECK_STATUS, OnScreeOffCheckDevStatus},
+    {EVENT_HB_CHECK_OFFLINE_DEADLINE, OnCheckOfflineDeadline},
 };
 
 static LnnHeartbeatStateHandler g_normalNodeHandler[] = {
@@ -82,6 +84,7 @@ static LnnHeartbeatStateHandler g_normalNodeHandler[] = {
     {EVENT_HB_SCREEN_OFF_CHECK_STATUS, OnScreeOffCheckDevStatus},
     {EVENT_HB_START_PROCESS, OnReStartHbProcess},
     {EVENT_HB_CHECK_SLE_DEV_STATUS, OnCheckSleDevStatus},
+    {EVENT_HB_CHECK_OFFLINE_DEADLINE, OnCheckOfflineDeadline},
 };
 
 static LnnHeartbeatStateHandler g_masterNodeHandler[] = {
@@ -98,6 +101,7 @@ static LnnHeartbeatStateHandler g_masterNodeHandler[] = {
     {EVENT_HB_SCREEN_OFF_CHECK_STATUS, OnScreeOffCheckDevStatus},
     {EVENT_HB_START_PROCESS, OnReStartHbProcess},
     {EVENT_HB_CHECK_SLE_DEV_STATUS, OnCheckSleDevStatus},
+    {EVENT_HB_CHECK_OFFLINE_DEADLINE, OnCheckOfflineDeadline},
 };
 
 static LnnHeartbeatFsmHandler g_hbFsmHandler[] = {
@@ -165,6 +169,11 @@ static void FreeUnhandledHbMessage(int32_t msgType, void *para)
         /* this event use pointer to transfer parameters */
         return;
     }
+    if (msgType == EVENT_HB_CHECK_DEV_STATUS || msgType == EVENT_HB_SCREEN_OFF_CHECK_STATUS ||
+        msgType == EVENT_HB_CHECK_SLE_DEV_STATUS || msgType == EVENT_HB_CHECK_OFFLINE_DEADLINE) {
+        /* the parameters of these events are copied into the message and released with it */
+        return;
+    }
     if (para != NULL) {
         SoftBusFree(para);
     }
@@ -230,14 +239,10 @@ static int32_t RemoveCheckDevStatusMsg(FsmCtrlMsgObj *ctrlMsgObj, SoftBusMessage
         return 1;
     }
     if (!delMsgPara->hasNetworkId && msgPara->hbType == delMsgPara->hbType) {
-        SoftBusFree(msgPara);
-        msgPara = NULL;
         return 0;
     }
     if (delMsgPara->hasNetworkId && msgPara->hbType == delMsgPara->hbType &&
         strcmp(msgPara->networkId, delMsgPara->networkId) == 0) {
-        SoftBusFree(msgPara);
-        msgPara = NULL;
         return 0;
     }
     return 1;
@@ -342,14 +347,10 @@ static int32_t RemoveScreenOffCheckStatus(FsmCtrlMsgObj *ctrlMsgObj, SoftBusMess
         return SOFTBUS_NETWORK_HB_REMOVE_MSG_FAIL;
     }
     if (!delMsgPara->hasNetworkId && msgPara->hbType == delMsgPara->hbType) {
-        SoftBusFree(msgPara);
-        msgPara = NULL;
         return SOFTBUS_OK;
     }
     if (delMsgPara->hasNetworkId && msgPara->hbType == delMsgPara->hbType &&
         strcmp(msgPara->networkId, delMsgPara->networkId) == 0) {
-        SoftBusFree(msgPara);
-        msgPara = NULL;
         return SOFTBUS_OK;
     }
     return SOFTBUS_NETWORK_HB_REMOVE_MSG_FAIL;
@@ -368,8 +369,6 @@ static int32_t RemoveCheckSleDevStatusMsg(FsmCtrlMsgObj *ctrlMsgObj, SoftBusMess
     }
     if (delMsgPara->hasNetworkId && msgPara->hbType == delMsgPara->hbType &&
         strcmp(msgPara->networkId, delMsgPara->networkId) == 0) {
-        SoftBusFree(msgPara);
-        msgPara = NULL;
         return SOFTBUS_OK;
     }
     return SOFTBUS_NETWORK_HB_REMOVE_MSG_FAIL;
@@ -627,6 +626,12 @@ static int32_t OnSendOneHbBegin(FsmStateMachine *fsm, int32_t msgType, void *par
     return ret;
 }
 
+static void ClearOfflineDeadline(LnnHeartbeatFsm *hbFsm)
+{
+    LnnClearHbDeadlineTable(&hbFsm->deadlineTable);
+    (void)LnnFsmRemoveMessage(&hbFsm->fsm, EVENT_HB_CHECK_OFFLINE_DEADLINE);
+}
+
 static int32_t OnSendOneHbEnd(FsmStateMachine *fsm, int32_t msgType, void *para)
 {
     (void)msgType;
@@ -646,6 +651,7 @@ static int32_t OnSendOneHbEnd(FsmStateMachine *fsm, int32_t msgType, void *para)
             LNN_LOGE(LNN_HEART_BEAT, "send once end to manager fail");
             (void)LnnFsmRemoveMessage(fsm, EVENT_HB_SEND_ONE_END);
             (void)LnnFsmRemoveMessage(fsm, EVENT_HB_CHECK_DEV_STATUS);
+            ClearOfflineDeadline(TO_HEARTBEAT_FSM(fsm));
             break;
         }
         ret = SOFTBUS_OK;
@@ -708,6 +714,7 @@ static int32_t OnStopHbByType(FsmStateMachine *fsm, int32_t msgType, void *para)
         LnnHeartbeatFsm *hbFsm = TO_HEARTBEAT_FSM(fsm);
         if ((*hbType & HEARTBEAT_TYPE_BLE_V0) != 0) {
             LnnFsmRemoveMessage(&hbFsm->fsm, EVENT_HB_CHECK_DEV_STATUS);
+            ClearOfflineDeadline(hbFsm);
             LnnRemoveProcessSendOnceMsg(hbFsm, HEARTBEAT_TYPE_BLE_V0, STRATEGY_HB_SEND_SINGLE);
             LnnRemoveProcessSendOnceMsg(hbFsm, HEARTBEAT_TYPE_BLE_V0, STRATEGY_HB_SEND_ADJUSTABLE_PERIOD);
             LnnFsmRemoveMessage(&hbFsm->fsm, EVENT_HB_SEND_ONE_BEGIN);
@@ -1050,10 +1057,59 @@ static int32_t OnCheckDevStatus(FsmStateMachine *fsm, int32_t msgType, void *par
         SoftBusFree(info);
         ret = SOFTBUS_OK;
     } while (false);
-    SoftBusFree(msgPara);
     return ret;
 }
 
+static void PostOfflineDeadlineTimer(LnnHeartbeatFsm *hbFsm, const LnnHbDeadlineTimer *timer)
+{
+    if (!timer->needArm) {
+        return;
+    }
+    /* the seq is copied into the message, so removing the pending message never frees a fake pointer */
+    if (LnnFsmPostMessageCopy(&hbFsm->fsm, EVENT_HB_CHECK_OFFLINE_DEADLINE, &timer->timerSeq,
+        sizeof(timer->timerSeq), timer->delayMillis) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_HEART_BEAT, "post offline deadline msg to hbFsm fail");
+        LnnCancelHbDeadlineTimer(&hbFsm->deadlineTable, timer->timerSeq);
+    }
+}
+
+static int32_t OnCheckOfflineDeadline(FsmStateMachine *fsm, int32_t msgType, void *para)
+{
+    (void)msgType;
+    if (!CheckHbFsmStateMsgArgs(fsm)) {
+        LNN_LOGE(LNN_HEART_BEAT, "check offline deadline get invalid fsm");
+        return SOFTBUS_NETWORK_HB_CHECK_DEV_STATUS_ERROR;
+    }
+    if (para == NULL) {
+        LNN_LOGE(LNN_HEART_BEAT, "check offline deadline get invalid para");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    LnnHeartbeatFsm *hbFsm = TO_HEARTBEAT_FSM(fsm);
+    LnnHbDeadlineInfo expired[HB_DEADLINE_EXPIRED_MAX_NUM];
+    LnnHbDeadlineTimer timer = { 0 };
+    uint32_t num = LnnPopExpiredHbDeadline(&hbFsm->deadlineTable, *(const uint32_t *)para, SoftBusGetTimeMs(),
+        expired, HB_DEADLINE_EXPIRED_MAX_NUM, &timer);
+    if (GetScreenState() == SOFTBUS_SCREEN_OFF) {
+        LNN_LOGI(LNN_HEART_BEAT, "screen if off, dont need hb check");
+        num = 0;
+    }
+    for (uint32_t i = 0; i < num; ++i) {
+        LnnCheckDevStatusMsgPara msgPara = {
+            .hasNetworkId = true,
+            .hbType = expired[i].hbType,
+            .addrType = expired[i].addrType,
+            .checkDelay = expired[i].checkDelay,
+        };
+        if (strcpy_s((char *)msgPara.networkId, NETWORK_ID_BUF_LEN, expired[i].networkId) != EOK) {
+            LNN_LOGE(LNN_HEART_BEAT, "check offline deadline strcpy_s networkId fail");
+            continue;
+        }
+        CheckDevStatusByNetworkId(hbFsm, msgPara.networkId, &msgPara);
+    }
+    PostOfflineDeadlineTimer(hbFsm, &timer);
+    return SOFTBUS_OK;
+}
+
 static int32_t OnScreeOffCheckDevStatus(FsmStateMachine *fsm, int32_t msgType, void *para)
 {
     (void)msgType;
@@ -1097,7 +1153,6 @@ static int32_t OnScreeOffCheckDevStatus(FsmStateMachine *fsm, int32_t msgType, v
         }
         SoftBusFree(info);
     } while (false);
-    SoftBusFree(msgPara);
     return ret;
 }
 
@@ -1170,7 +1225,6 @@ static int32_t OnCheckSleDevStatus(FsmStateMachine *fsm, int32_t msgType, void *
         }
         CheckSleDevStatus(hbFsm, msgPara->networkId, msgPara->hbType, nowTime);
     } while (false);
-    SoftBusFree(msgPara);
     return ret;
 }
 
@@ -1181,6 +1235,7 @@ void LnnDestroyHeartbeatFsm(LnnHeartbeatFsm *hbFsm)
     }
     // Destroy by LnnDeinitLnnLooper
     LNN_LOGI(LNN_HEART_BEAT, "destroy heartbeat fsmId=%{public}u", hbFsm->id);
+    LnnDeinitHbDeadlineTable(&hbFsm->deadlineTable);
     SoftBusFree(hbFsm);
 }
 
@@ -1215,6 +1270,9 @@ static int32_t InitHeartbeatFsm(LnnHeartbeatFsm *hbFsm)
     for (int32_t i = 0; i < STATE_HB_INDEX_MAX; ++i) {
         LnnFsmAddState(&hbFsm->fsm, &g_hbState[i]);
     }
+    /* only one pending role switch matters, a repost replaces it instead of queueing another loop */
+    (void)LnnFsmSetCoalescable(&hbFsm->fsm, EVENT_HB_AS_MASTER_NODE);
+    (void)LnnFsmSetCoalescable(&hbFsm->fsm, EVENT_HB_AS_NORMAL_NODE);
     return SOFTBUS_OK;
 }
 
@@ -1228,6 +1286,11 @@ LnnHeartbeatFsm *LnnCreateHeartbeatFsm(void)
         return NULL;
     }
     ListInit(&hbFsm->node);
+    if (LnnInitHbDeadlineTable(&hbFsm->deadlineTable) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_HEART_BEAT, "init deadline table fail");
+        SoftBusFree(hbFsm);
+        return NULL;
+    }
     if (InitHeartbeatFsm(hbFsm) != SOFTBUS_OK) {
         LNN_LOGE(LNN_HEART_BEAT, "init fsm fail");
         LnnDestroyHeartbeatFsm(hbFsm);
@@ -1420,8 +1483,6 @@ int32_t LnnPostSetMediumParamMsgToHbFsm(LnnHeartbeatFsm *hbFsm, const LnnHeartbe
 int32_t LnnPostCheckDevStatusMsgToHbFsm(LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *para,
     uint64_t delayMillis)
 {
-    LnnCheckDevStatusMsgPara *dupPara = NULL;
-
     if (hbFsm == NULL) {
         LNN_LOGE(LNN_HEART_BEAT, "post check dev status msg get invalid param");
         return SOFTBUS_INVALID_PARAM;
@@ -1429,30 +1490,60 @@ int32_t LnnPostCheckDevStatusMsgToHbFsm(LnnHeartbeatFsm *hbFsm, const LnnCheckDe
     if (para == NULL) {
         return LnnFsmPostMessageDelay(&hbFsm->fsm, EVENT_HB_CHECK_DEV_STATUS, NULL, delayMillis);
     }
-    dupPara = (LnnCheckDevStatusMsgPara *)SoftBusCalloc(sizeof(LnnCheckDevStatusMsgPara));
-    if (dupPara == NULL) {
-        LNN_LOGE(LNN_HEART_BEAT, "post check dev status msg malloc msgPara fail");
-        return SOFTBUS_MALLOC_ERR;
-    }
-    if (memcpy_s(dupPara, sizeof(LnnCheckDevStatusMsgPara), para, sizeof(LnnCheckDevStatusMsgPara)) != EOK) {
+    LnnCheckDevStatusMsgPara msgPara;
+    if (memcpy_s(&msgPara, sizeof(LnnCheckDevStatusMsgPara), para, sizeof(LnnCheckDevStatusMsgPara)) != EOK) {
         LNN_LOGE(LNN_HEART_BEAT, "post check dev status msg memcpy_s msgPara fail");
-        SoftBusFree(dupPara);
         return SOFTBUS_MEM_ERR;
     }
-    dupPara->checkDelay = delayMillis;
-    if (LnnFsmPostMessageDelay(&hbFsm->fsm, EVENT_HB_CHECK_DEV_STATUS, (void *)dupPara, delayMillis) != SOFTBUS_OK) {
+    msgPara.checkDelay = delayMillis;
+    if (LnnFsmPostMessageCopy(&hbFsm->fsm, EVENT_HB_CHECK_DEV_STATUS, &msgPara, sizeof(LnnCheckDevStatusMsgPara),
+        delayMillis) != SOFTBUS_OK) {
         LNN_LOGE(LNN_HEART_BEAT, "post check dev status msg to hbFsm fail");
-        SoftBusFree(dupPara);
         return SOFTBUS_NETWORK_POST_MSG_DELAY_FAIL;
     }
     return SOFTBUS_OK;
 }
 
+int32_t LnnSetOfflineDeadlineToHbFsm(LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *para,
+    uint64_t delayMillis)
+{
+    if (hbFsm == NULL || para == NULL) {
+        LNN_LOGE(LNN_HEART_BEAT, "set offline deadline get invalid param");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    LnnHbDeadlineInfo info = {
+        .addrType = para->addrType,
+        .hbType = para->hbType,
+        .checkDelay = delayMillis,
+    };
+    if (strcpy_s(info.networkId, NETWORK_ID_BUF_LEN, para->networkId) != EOK) {
+        LNN_LOGE(LNN_HEART_BEAT, "set offline deadline strcpy_s networkId fail");
+        return SOFTBUS_STRCPY_ERR;
+    }
+    uint64_t nowTime = SoftBusGetTimeMs();
+    info.deadline = nowTime + delayMillis;
+    LnnHbDeadlineTimer timer = { 0 };
+    int32_t ret = LnnSetHbDeadline(&hbFsm->deadlineTable, &info, nowTime, &timer);
+    if (ret != SOFTBUS_OK) {
+        LNN_LOGE(LNN_HEART_BEAT, "set offline deadline fail, ret=%{public}d", ret);
+        return ret;
+    }
+    PostOfflineDeadlineTimer(hbFsm, &timer);
+    return SOFTBUS_OK;
+}
+
+void LnnRemoveOfflineDeadlineFromHbFsm(LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *msgPara)
+{
+    if (hbFsm == NULL || msgPara == NULL) {
+        LNN_LOGE(LNN_HEART_BEAT, "remove offline deadline get invalid param");
+        return;
+    }
+    LnnRemoveHbDeadline(&hbFsm->deadlineTable, msgPara->networkId, msgPara->addrType);
+}
+
 int32_t LnnPostScreenOffCheckDevMsgToHbFsm(LnnHeartbeatFsm *hbFsm,
     const LnnCheckDevStatusMsgPara *para, uint64_t delayMillis)
 {
-    LnnCheckDevStatusMsgPara *dupPara = NULL;
-
     if (hbFsm == NULL) {
         LNN_LOGE(LNN_HEART_BEAT, "post check dev status msg get invalid param");
         return SOFTBUS_INVALID_PARAM;
@@ -1460,20 +1551,9 @@ int32_t LnnPostScreenOffCheckDevMsgToHbFsm(LnnHeartbeatFsm *hbFsm,
     if (para == NULL) {
         return LnnFsmPostMessageDelay(&hbFsm->fsm, EVENT_HB_SCREEN_OFF_CHECK_STATUS, NULL, delayMillis);
     }
-    dupPara = (LnnCheckDevStatusMsgPara *)SoftBusCalloc(sizeof(LnnCheckDevStatusMsgPara));
-    if (dupPara == NULL) {
-        LNN_LOGE(LNN_HEART_BEAT, "post check dev status msg malloc msgPara fail");
-        return SOFTBUS_MALLOC_ERR;
-    }
-    if (memcpy_s(dupPara, sizeof(LnnCheckDevStatusMsgPara), para, sizeof(LnnCheckDevStatusMsgPara)) != EOK) {
-        LNN_LOGE(LNN_HEART_BEAT, "post check dev status msg memcpy_s msgPara fail");
-        SoftBusFree(dupPara);
-        return SOFTBUS_MEM_ERR;
-    }
-    if (LnnFsmPostMessageDelay(&hbFsm->fsm, EVENT_HB_SCREEN_OFF_CHECK_STATUS,
-        (void *)dupPara, delayMillis) != SOFTBUS_OK) {
+    if (LnnFsmPostMessageCopy(&hbFsm->fsm, EVENT_HB_SCREEN_OFF_CHECK_STATUS, para, sizeof(LnnCheckDevStatusMsgPara),
+        delayMillis) != SOFTBUS_OK) {
         LNN_LOGE(LNN_HEART_BEAT, "post check dev status msg to hbFsm fail");
-        SoftBusFree(dupPara);
         return SOFTBUS_NETWORK_POST_MSG_DELAY_FAIL;
     }
     return SOFTBUS_OK;
@@ -1495,17 +1575,9 @@ int32_t LnnPostSleCheckDevStatusMsgToHbFsm(
         LNN_LOGE(LNN_HEART_BEAT, "post sle check dev status msg get invalid param");
         return SOFTBUS_INVALID_PARAM;
     }
-    LnnCheckDevStatusMsgPara *dupPara = (LnnCheckDevStatusMsgPara *)SoftBusCalloc(sizeof(LnnCheckDevStatusMsgPara));
-    LNN_CHECK_AND_RETURN_RET_LOGE(dupPara != NULL, SOFTBUS_MALLOC_ERR, LNN_HEART_BEAT, "malloc fail");
-    if (memcpy_s(dupPara, sizeof(LnnCheckDevStatusMsgPara), para, sizeof(LnnCheckDevStatusMsgPara)) != EOK) {
-        LNN_LOGE(LNN_HEART_BEAT, "post sle check dev status msg memcpy_s msgPara fail");
-        SoftBusFree(dupPara);
-        return SOFTBUS_MEM_ERR;
-    }
-    if (LnnFsmPostMessageDelay(
-        &hbFsm->fsm, EVENT_HB_CHECK_SLE_DEV_STATUS, (void *)dupPara, delayMillis) != SOFTBUS_OK) {
+    if (LnnFsmPostMessageCopy(&hbFsm->fsm, EVENT_HB_CHECK_SLE_DEV_STATUS, para, sizeof(LnnCheckDevStatusMsgPara),
+        delayMillis) != SOFTBUS_OK) {
         LNN_LOGE(LNN_HEART_BEAT, "post sle check dev status msg to hbFsm fail");
-        SoftBusFree(dupPara);
         return SOFTBUS_NETWORK_POST_MSG_DELAY_FAIL;
     }
     return SOFTBUS_OK;
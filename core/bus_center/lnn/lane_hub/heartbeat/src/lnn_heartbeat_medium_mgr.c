@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -306,11 +306,6 @@ static int32_t HbUpdateOfflineTimingByRecvInfo(
         AnonymizeFree(anonyNetworkId);
         return SOFTBUS_NETWORK_NOT_SUPPORT;
     }
-    if (LnnStopOfflineTimingStrategy(networkId, type) != SOFTBUS_OK) {
-        LNN_LOGE(LNN_HEART_BEAT, "remove offline check err, networkId=%{public}s", AnonymizeWrapper(anonyNetworkId));
-        AnonymizeFree(anonyNetworkId);
-        return SOFTBUS_NETWORK_HB_STOP_STRATEGY_FAIL;
-    }
     if (LnnStartOfflineTimingStrategy(networkId, type) != SOFTBUS_OK) {
         LNN_LOGE(LNN_HEART_BEAT, "set new offline check err, networkId=%{public}s", AnonymizeWrapper(anonyNetworkId));
         AnonymizeFree(anonyNetworkId);
@@ -379,30 +374,26 @@ static bool HbIsRepeatedJoinLnnRequest(LnnHeartbeatRecvInfo *storedInfo, uint64_
 
 static bool HbIsNeedReAuth(const NodeInfo *nodeInfo, const char *newAccountHash)
 {
-    char *anonyNetworkId = NULL;
-    Anonymize(nodeInfo->networkId, &anonyNetworkId);
+    ANONYMIZE_BUF(anonyNetworkId);
     LNN_LOGI(LNN_HEART_BEAT,
         "peer networkId=%{public}s, accountHash:%{public}02X%{public}02X->%{public}02X%{public}02X",
-        AnonymizeWrapper(anonyNetworkId), nodeInfo->accountHash[0], nodeInfo->accountHash[1],
+        ANONYMIZE(anonyNetworkId, nodeInfo->networkId), nodeInfo->accountHash[0], nodeInfo->accountHash[1],
         newAccountHash[0], newAccountHash[1]);
-    AnonymizeFree(anonyNetworkId);
     return memcmp(nodeInfo->accountHash, newAccountHash, HB_SHORT_ACCOUNT_HASH_LEN) != 0;
 }
 
 static void HbDumpRecvDeviceInfo(
     const DeviceInfo *device, int32_t weight, int32_t masterWeight, LnnHeartbeatType hbType, uint64_t nowTime)
 {
-    char *anonyUdid = NULL;
+    ANONYMIZE_BUF(anonyUdid);
     const char *devTypeStr = LnnConvertIdToDeviceType((uint16_t)device->devType);
-    Anonymize(device->devId, &anonyUdid);
     LNN_LOGI(LNN_HEART_BEAT,
         "heartbeat(HB) OnTock, udidHash=%{public}s, accountHash=%{public}02X%{public}02X, hbType=%{public}d, "
         "devTypeStr=%{public}s, peerWeight=%{public}d, masterWeight=%{public}d, devTypeHex=%{public}02X, "
         "ConnectionAddrType=%{public}d, nowTime=%{public}" PRIu64,
-        AnonymizeWrapper(anonyUdid), device->accountHash[0], device->accountHash[1],
+        ANONYMIZE(anonyUdid, device->devId), device->accountHash[0], device->accountHash[1],
         hbType, devTypeStr != NULL ? devTypeStr : "", weight,
         masterWeight, device->devType, device->addr[0].type, nowTime);
-    AnonymizeFree(anonyUdid);
 }
 
 static bool IsLocalSupportBleDirectOnline()
@@ -778,23 +769,19 @@ static int32_t HbAddAsyncProcessCallbackDelay(DeviceInfo *device, bool *IsRestri
 
 static void ProcessUdidAnonymize(char *devId)
 {
-    char *anonyUdid = NULL;
-    Anonymize(devId, &anonyUdid);
+    ANONYMIZE_BUF(anonyUdid);
     LNN_LOGD(LNN_HEART_BEAT, "recv but ignore repeated join lnn request, udidHash=%{public}s",
-        AnonymizeWrapper(anonyUdid));
-    AnonymizeFree(anonyUdid);
+        ANONYMIZE(anonyUdid, devId));
 }
 
 static int32_t SoftBusNetNodeResult(DeviceInfo *device, HbRespData *hbResp,
     LnnConnectCondition *connectCondition, LnnHeartbeatRecvInfo *storedInfo, uint64_t nowTime)
 {
-    char *anonyUdid = NULL;
-    Anonymize(device->devId, &anonyUdid);
+    ANONYMIZE_BUF(anonyUdid);
     LNN_LOGI(LNN_HEART_BEAT,
         "heartbeat(HB) find device, udidHash=%{public}s, ConnectionAddrType=%{public}02X, isConnect=%{public}d, "
-        "connectReason=%{public}u", AnonymizeWrapper(anonyUdid),
+        "connectReason=%{public}u", ANONYMIZE(anonyUdid, device->devId),
         device->addr[0].type, connectCondition->isConnect, connectCondition->connectReason);
-    AnonymizeFree(anonyUdid);
 
     LnnDfxDeviceInfoReport info;
     (void)memset_s(&info, sizeof(LnnDfxDeviceInfoReport), 0, sizeof(LnnDfxDeviceInfoReport));
@@ -1098,36 +1085,33 @@ static bool IsNeedTriggerSparkGroup(const NodeInfo *remoteInfo, LnnHeartbeatRecv
         LNN_LOGD(LNN_HEART_BEAT, "sle not enable");
         return false;
     }
-    char *anonyNetworkId = NULL;
-    Anonymize(remoteInfo->networkId, &anonyNetworkId);
+    ANONYMIZE_BUF(anonyNetworkId);
     int32_t oldTriggerCnt = storedInfo->triggerSparkCount;
     if (!LnnHasDiscoveryType(remoteInfo, DISCOVERY_TYPE_BLE)) {
-        LNN_LOGW(LNN_HEART_BEAT, "target dev ble not online, networkId=%{public}s", AnonymizeWrapper(anonyNetworkId));
-        AnonymizeFree(anonyNetworkId);
+        LNN_LOGW(LNN_HEART_BEAT, "target dev ble not online, networkId=%{public}s",
+            ANONYMIZE(anonyNetworkId, remoteInfo->networkId));
         return false;
     }
     if (oldTriggerCnt > SLE_JOIN_SPARK_TIMES) {
         LNN_LOGD(LNN_HEART_BEAT, "target dev has exceeded limt, TriggerCnt=%{public}d, networkId=%{public}s",
-            oldTriggerCnt, AnonymizeWrapper(anonyNetworkId));
-        AnonymizeFree(anonyNetworkId);
+            oldTriggerCnt, ANONYMIZE(anonyNetworkId, remoteInfo->networkId));
         return false;
     }
     if (QueryControlPlaneNodeValidPacked(remoteInfo->networkId) == SOFTBUS_OK) {
         LNN_LOGW(LNN_HEART_BEAT, "target node has exit spark group, networkId=%{public}s",
-            AnonymizeWrapper(anonyNetworkId));
-        AnonymizeFree(anonyNetworkId);
+            ANONYMIZE(anonyNetworkId, remoteInfo->networkId));
         return false;
     }
     if ((storedInfo->triggerSparkTime != 0) &&
         (nowTime - storedInfo->triggerSparkTime <= LOW_FREQ_CYCLE * HB_TIME_FACTOR)) {
-        LNN_LOGD(LNN_HEART_BEAT, "need trigger spark group, networkId=%{public}s", AnonymizeWrapper(anonyNetworkId));
-        AnonymizeFree(anonyNetworkId);
+        LNN_LOGD(LNN_HEART_BEAT, "need trigger spark group, networkId=%{public}s",
+            ANONYMIZE(anonyNetworkId, remoteInfo->networkId));
         return true;
     }
     storedInfo->triggerSparkCount++;
     storedInfo->triggerSparkTime = nowTime;
-    LNN_LOGW(LNN_HEART_BEAT, "try trigger spark, networkId=%{public}s", AnonymizeWrapper(anonyNetworkId));
-    AnonymizeFree(anonyNetworkId);
+    LNN_LOGW(LNN_HEART_BEAT, "try trigger spark, networkId=%{public}s",
+        ANONYMIZE(anonyNetworkId, remoteInfo->networkId));
     return true;
 }
 
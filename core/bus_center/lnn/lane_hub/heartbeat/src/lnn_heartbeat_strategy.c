@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -1002,6 +1002,10 @@ int32_t LnnStartOfflineTimingStrategy(const char *networkId, ConnectionAddrType
         LNN_LOGD(LNN_HEART_BEAT, "%{public}s support burst, dont't need post offline info",
             AnonymizeWrapper(anonyNetworkId));
         AnonymizeFree(anonyNetworkId);
+        msgPara.addrType = addrType;
+        if (strcpy_s((char *)msgPara.networkId, NETWORK_ID_BUF_LEN, networkId) == EOK) {
+            LnnRemoveOfflineDeadlineFromHbFsm(g_hbFsm, &msgPara);
+        }
         return SOFTBUS_OK;
     }
     if (strcpy_s((char *)msgPara.networkId, NETWORK_ID_BUF_LEN, networkId) != EOK) {
@@ -1015,7 +1019,7 @@ int32_t LnnStartOfflineTimingStrategy(const char *networkId, ConnectionAddrType
         return SOFTBUS_NETWORK_HB_GET_GEAR_MODE_FAIL;
     }
     uint64_t delayMillis = (uint64_t)mode.cycle * HB_TIME_FACTOR + HB_NOTIFY_DEV_LOST_DELAY_LEN;
-    return LnnPostCheckDevStatusMsgToHbFsm(g_hbFsm, &msgPara, delayMillis);
+    return LnnSetOfflineDeadlineToHbFsm(g_hbFsm, &msgPara, delayMillis);
 }
 
 int32_t LnnStopOfflineTimingStrategy(const char *networkId, ConnectionAddrType addrType)
@@ -1032,6 +1036,7 @@ int32_t LnnStopOfflineTimingStrategy(const char *networkId, ConnectionAddrType a
         return SOFTBUS_MEM_ERR;
     }
     msgPara.hasNetworkId = true;
+    LnnRemoveOfflineDeadlineFromHbFsm(g_hbFsm, &msgPara);
     LnnRemoveCheckDevStatusMsg(g_hbFsm, &msgPara);
     return SOFTBUS_OK;
 }
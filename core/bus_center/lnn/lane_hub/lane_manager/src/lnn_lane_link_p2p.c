@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -72,6 +72,8 @@ typedef struct {
     AuthChannel auth;
     P2pRequestInfo p2pInfo;
     ProxyChannelInfo proxyChannelInfo;
+    uint32_t guideIdx;
+    bool isGuideRacing;
 } P2pLinkReqList;
 
 typedef struct {
@@ -117,6 +119,7 @@ typedef enum {
     MSG_TYPE_GUIDE_CHANNEL_TRIGGER,
     MSG_TYPE_GUIDE_CHANNEL_SELECT,
     MSG_TYPE_RECONNECT_WITHOUT_GUIDE_CHANGE,
+    MSG_TYPE_GUIDE_CHANNEL_RACE,
     MSG_TYPE_GUIDE_CHANNEL_BUTT,
 } GuideMsgType;
 
@@ -133,11 +136,20 @@ typedef struct {
     uint32_t guideNum;
     uint32_t guideIdx;
     int32_t firstGuideErrCode;
+    uint32_t raceNum; // leading guide channels opened concurrently, 0 means one after another
+    uint32_t racingNum;
+    uint32_t raceWinIdx;
+    bool isRaceWon;
     LaneLinkCb callback;
     ListNode node;
     LinkRequest request;
 } WdGuideInfo;
 
+typedef struct {
+    uint32_t laneReqId;
+    LaneLinkType linkType;
+} GuideRaceMsgInfo;
+
 static ListNode *g_p2pLinkList = NULL; // process p2p link request
 static ListNode *g_p2pLinkedList = NULL; // process p2p unlink request
 static ListNode *g_guideInfoList = NULL;
@@ -155,6 +167,8 @@ static SoftBusMutex g_rawLinkLock;
 #define RAW_LINK_CHECK_NUM             (10)
 #define WIFIDIRECT_RECONNECT_TIMES     (1)
 #define WIFIDIRECT_RECONNECT_DELAY     (3000)
+#define GUIDE_CHANNEL_RACE_NUM_MAX     (2)
+#define GUIDE_CHANNEL_RACE_DELAY       (300)
 
 #define DFX_RECORD_LNN_LANE_SELECT_END(laneReqId, lnnConnReqId)                    \
     do {                                                                           \
@@ -826,6 +840,14 @@ static void DelGuideInfoItem(uint32_t laneReqId, LaneLinkType linkType)
     LinkUnlock();
 }
 
+static uint32_t GetCurrentGuideIdx(const WdGuideInfo *guideInfo)
+{
+    if (guideInfo->isRaceWon && guideInfo->guideIdx < guideInfo->raceNum) {
+        return guideInfo->raceWinIdx;
+    }
+    return guideInfo->guideIdx;
+}
+
 static int32_t GetCurrentGuideType(uint32_t laneReqId, LaneLinkType linkType, WdGuideType *guideType)
 {
     WdGuideInfo guideInfo = { 0 };
@@ -833,7 +855,7 @@ static int32_t GetCurrentGuideType(uint32_t laneReqId, LaneLinkType linkType, Wd
         LNN_LOGE(LNN_LANE, "get guide channel info fail.");
         return SOFTBUS_LANE_NOT_FOUND;
     }
-    *guideType = guideInfo.guideList[guideInfo.guideIdx];
+    *guideType = guideInfo.guideList[GetCurrentGuideIdx(&guideInfo)];
     return SOFTBUS_OK;
 }
 
@@ -1450,6 +1472,23 @@ static int32_t PostDelayReconnectDeviceMessage(uint32_t p2pRequestId)
     return SOFTBUS_OK;
 }
 
+static int32_t PostGuideChannelRaceMessage(uint32_t laneReqId, LaneLinkType linkType, uint64_t delayMillis)
+{
+    LNN_LOGI(LNN_LANE, "post guide channel race msg, delay=%{public}" PRIu64 "ms.", delayMillis);
+    SoftBusMessage *msg = (SoftBusMessage *)SoftBusCalloc(sizeof(SoftBusMessage));
+    if (msg == NULL) {
+        LNN_LOGE(LNN_LANE, "create handler msg failed");
+        return SOFTBUS_MALLOC_ERR;
+    }
+    msg->what = MSG_TYPE_GUIDE_CHANNEL_RACE;
+    msg->arg1 = laneReqId;
+    msg->arg2 = linkType;
+    msg->handler = &g_guideChannelHandler;
+    msg->obj = NULL;
+    g_guideChannelHandler.looper->PostMessageDelay(g_guideChannelHandler.looper, msg, delayMillis);
+    return SOFTBUS_OK;
+}
+
 static bool GuideNodeIsExist(uint32_t laneReqId, LaneLinkType linkType)
 {
     if (LinkLock() != 0) {
@@ -1506,6 +1545,51 @@ FAIL:
     callback.onLaneLinkFail(laneReqId, reason, linkType);
 }
 
+static void RecordFirstGuideErrCodeWithoutLock(WdGuideInfo *guideItem, uint32_t guideIdx, int32_t reason)
+{
+    if (guideItem != NULL && guideIdx == 0) {
+        guideItem->firstGuideErrCode = reason;
+    }
+}
+
+static void HandleGuideChannelRaceFail(uint32_t laneReqId, LaneLinkType linkType, uint32_t guideIdx,
+    AuthLinkType authType, int32_t reason)
+{
+    if (LinkLock() != 0) {
+        LNN_LOGE(LNN_LANE, "lock fail, handle guide channel race fail.");
+        return;
+    }
+    WdGuideInfo *guideInfoNode = GetGuideNodeWithoutLock(laneReqId, linkType);
+    if (guideInfoNode == NULL) {
+        LinkUnlock();
+        LNN_LOGI(LNN_LANE, "lane link has finished, ignore guide race fail, laneReqId=%{public}u", laneReqId);
+        return;
+    }
+    if (guideInfoNode->racingNum > 0) {
+        guideInfoNode->racingNum--;
+    }
+    // the first guide error decides the lane fail reason, keep it even when a later racer wins
+    RecordFirstGuideErrCodeWithoutLock(guideInfoNode, guideIdx, reason);
+    bool isRaceWon = guideInfoNode->isRaceWon;
+    bool hasNextRacer = guideInfoNode->guideIdx + 1 < guideInfoNode->raceNum;
+    uint32_t racingNum = guideInfoNode->racingNum;
+    LinkUnlock();
+    if (isRaceWon) {
+        LNN_LOGI(LNN_LANE, "guide race has been won, ignore loser fail, laneReqId=%{public}u", laneReqId);
+        return;
+    }
+    // no need to wait out the stagger delay once a racer has failed
+    if (hasNextRacer && PostGuideChannelRaceMessage(laneReqId, linkType, 0) == SOFTBUS_OK) {
+        return;
+    }
+    if (racingNum > 0) {
+        LNN_LOGI(LNN_LANE, "wait other guide racers, laneReqId=%{public}u, racingNum=%{public}u",
+            laneReqId, racingNum);
+        return;
+    }
+    HandleGuideChannelRetry(laneReqId, linkType, authType, reason);
+}
+
 static void HandleGuideChannelAsyncFail(AsyncResultType type, uint32_t requestId, int32_t reason)
 {
     P2pLinkReqList p2pLinkReqInfo;
@@ -1519,6 +1603,12 @@ static void HandleGuideChannelAsyncFail(AsyncResultType type, uint32_t requestId
     uint32_t laneReqId = p2pLinkReqInfo.laneRequestInfo.laneReqId;
     LaneLinkType linkType = p2pLinkReqInfo.laneRequestInfo.linkType;
     AuthLinkType authType = (AuthLinkType)p2pLinkReqInfo.auth.authHandle.type;
+    if (p2pLinkReqInfo.isGuideRacing) {
+        LNN_LOGI(LNN_LANE, "guide racer fail, type=%{public}d, laneReqId=%{public}u, guideIdx=%{public}u",
+            type, laneReqId, p2pLinkReqInfo.guideIdx);
+        HandleGuideChannelRaceFail(laneReqId, linkType, p2pLinkReqInfo.guideIdx, authType, reason);
+        return;
+    }
     if (reuseOnly && !GuideNodeIsExist(laneReqId, linkType)) {
         LNN_LOGI(LNN_LANE, "reuse fail, post guide channel select msg, laneReqId=%{public}u, linkType=%{public}d",
             laneReqId, linkType);
@@ -1678,8 +1768,8 @@ static void UpdateFirstGuideChannelErrCode(uint32_t p2pRequestId, int32_t reason
     }
     WdGuideInfo *guideItem = GetGuideNodeWithoutLock(reqInfo.laneRequestInfo.laneReqId,
         reqInfo.laneRequestInfo.linkType);
-    if (guideItem != NULL && guideItem->guideIdx == 0) {
-        guideItem->firstGuideErrCode = reason;
+    if (guideItem != NULL) {
+        RecordFirstGuideErrCodeWithoutLock(guideItem, GetCurrentGuideIdx(guideItem), reason);
     }
     LinkUnlock();
 }
@@ -1738,6 +1828,117 @@ static void OnWifiDirectConnectFailure(uint32_t p2pRequestId, int32_t reason)
     NotifyLinkFail(ASYNC_RESULT_P2P, p2pRequestId, reason);
 }
 
+static bool TryWinGuideChannelRaceWithoutLock(P2pLinkReqList *reqItem)
+{
+    if (!reqItem->isGuideRacing) {
+        return true;
+    }
+    reqItem->isGuideRacing = false;
+    WdGuideInfo *guideInfoNode = GetGuideNodeWithoutLock(reqItem->laneRequestInfo.laneReqId,
+        reqItem->laneRequestInfo.linkType);
+    if (guideInfoNode == NULL) {
+        return false;
+    }
+    if (guideInfoNode->racingNum > 0) {
+        guideInfoNode->racingNum--;
+    }
+    if (guideInfoNode->isRaceWon) {
+        return false;
+    }
+    guideInfoNode->isRaceWon = true;
+    guideInfoNode->raceWinIdx = reqItem->guideIdx;
+    // stop racing the guide channels not started yet, a retry continues after the started ones
+    guideInfoNode->raceNum = guideInfoNode->guideIdx + 1;
+    return true;
+}
+
+static uint32_t TakeGuideRaceLosersWithoutLock(const P2pLinkReqList *winner, uint32_t *channelReqIds, uint32_t num)
+{
+    WdGuideInfo *guideInfoNode = GetGuideNodeWithoutLock(winner->laneRequestInfo.laneReqId,
+        winner->laneRequestInfo.linkType);
+    uint32_t loserNum = 0;
+    P2pLinkReqList *item = NULL;
+    P2pLinkReqList *next = NULL;
+    LIST_FOR_EACH_ENTRY_SAFE(item, next, g_p2pLinkList, P2pLinkReqList, node) {
+        if (item == winner || !item->isGuideRacing || loserNum >= num ||
+            item->laneRequestInfo.laneReqId != winner->laneRequestInfo.laneReqId ||
+            item->laneRequestInfo.linkType != winner->laneRequestInfo.linkType) {
+            continue;
+        }
+        // an opening auth conn has no cancel hook, it is closed as soon as it opens
+        if (item->proxyChannelInfo.requestId == (uint32_t)INVALID_CHANNEL_ID) {
+            continue;
+        }
+        channelReqIds[loserNum++] = item->proxyChannelInfo.requestId;
+        if (guideInfoNode != NULL && guideInfoNode->racingNum > 0) {
+            guideInfoNode->racingNum--;
+        }
+        ListDelete(&item->node);
+        SoftBusFree(item);
+    }
+    return loserNum;
+}
+
+static int32_t RemoveGuideChannelRace(const SoftBusMessage *msg, void *data)
+{
+    GuideRaceMsgInfo *info = (GuideRaceMsgInfo *)data;
+    if (msg->what != MSG_TYPE_GUIDE_CHANNEL_RACE || msg->arg1 != info->laneReqId || msg->arg2 != info->linkType) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    LNN_LOGI(LNN_LANE, "remove guide channel race msg succ, laneReqId=%{public}u", info->laneReqId);
+    return SOFTBUS_OK;
+}
+
+static void CancelGuideRaceLosers(uint32_t laneReqId, LaneLinkType linkType, const uint32_t *channelReqIds,
+    uint32_t num)
+{
+    GuideRaceMsgInfo info = {
+        .laneReqId = laneReqId,
+        .linkType = linkType,
+    };
+    g_guideChannelHandler.looper->RemoveMessageCustom(g_guideChannelHandler.looper, &g_guideChannelHandler,
+        RemoveGuideChannelRace, &info);
+    for (uint32_t i = 0; i < num; i++) {
+        LNN_LOGI(LNN_LANE, "cancel guide race loser, laneReqId=%{public}u, channelRequestId=%{public}u",
+            laneReqId, channelReqIds[i]);
+        (void)TransProxyPipelineCancelChannel((int32_t)channelReqIds[i]);
+    }
+}
+
+static bool IsGuideChannelRaceWinner(AsyncResultType type, uint32_t requestId)
+{
+    if (LinkLock() != 0) {
+        LNN_LOGE(LNN_LANE, "lock fail");
+        return true;
+    }
+    bool isWinner = true;
+    bool isRaceDecided = false;
+    uint32_t laneReqId = 0;
+    LaneLinkType linkType = LANE_LINK_TYPE_BUTT;
+    uint32_t loserReqIds[GUIDE_CHANNEL_RACE_NUM_MAX] = { 0 };
+    uint32_t loserNum = 0;
+    P2pLinkReqList *item = NULL;
+    LIST_FOR_EACH_ENTRY(item, g_p2pLinkList, P2pLinkReqList, node) {
+        if ((type == ASYNC_RESULT_AUTH && item->auth.requestId == requestId) ||
+            (type == ASYNC_RESULT_CHANNEL && item->proxyChannelInfo.requestId == requestId)) {
+            isRaceDecided = item->isGuideRacing;
+            isWinner = TryWinGuideChannelRaceWithoutLock(item);
+            isRaceDecided = isRaceDecided && isWinner;
+            break;
+        }
+    }
+    if (isRaceDecided) {
+        laneReqId = item->laneRequestInfo.laneReqId;
+        linkType = item->laneRequestInfo.linkType;
+        loserNum = TakeGuideRaceLosersWithoutLock(item, loserReqIds, GUIDE_CHANNEL_RACE_NUM_MAX);
+    }
+    LinkUnlock();
+    if (isRaceDecided) {
+        CancelGuideRaceLosers(laneReqId, linkType, loserReqIds, loserNum);
+    }
+    return isWinner;
+}
+
 static void OnAuthConnOpened(uint32_t authRequestId, AuthHandle authHandle)
 {
     LNN_LOGI(LNN_LANE, "auth opened with authRequestId=%{public}u, authId=%{public}" PRId64 "",
@@ -1746,6 +1947,12 @@ static void OnAuthConnOpened(uint32_t authRequestId, AuthHandle authHandle)
         LNN_LOGE(LNN_LANE, "authHandle type error");
         return;
     }
+    if (!IsGuideChannelRaceWinner(ASYNC_RESULT_AUTH, authRequestId)) {
+        LNN_LOGI(LNN_LANE, "guide race lost, close auth conn, authRequestId=%{public}u", authRequestId);
+        AuthCloseConn(authHandle);
+        (void)DelP2pLinkReqByReqId(ASYNC_RESULT_AUTH, authRequestId);
+        return;
+    }
     struct WifiDirectConnectCallback callback = {
         .onConnectSuccess = OnWifiDirectConnectSuccess,
         .onConnectFailure = OnWifiDirectConnectFailure,
@@ -1832,6 +2039,11 @@ static int32_t AddP2pLinkReqItem(AsyncResultType type, uint32_t requestId, uint3
         LNN_LOGE(LNN_LANE, "lock fail, add conn request fail");
         return SOFTBUS_LOCK_ERR;
     }
+    WdGuideInfo *guideInfoNode = GetGuideNodeWithoutLock(laneReqId, request->linkType);
+    if (guideInfoNode != NULL) {
+        item->guideIdx = guideInfoNode->guideIdx;
+        item->isGuideRacing = guideInfoNode->guideIdx < guideInfoNode->raceNum;
+    }
     ListTailInsert(g_p2pLinkList, &item->node);
     LinkUnlock();
     return SOFTBUS_OK;
@@ -1893,6 +2105,12 @@ static int32_t OpenAuthToDisconnP2p(const char *networkId, int32_t linkId)
 static void OnProxyChannelOpened(int32_t channelRequestId, int32_t channelId)
 {
     LNN_LOGI(LNN_LANE, "proxy opened. channelRequestId=%{public}d, channelId=%{public}d", channelRequestId, channelId);
+    if (!IsGuideChannelRaceWinner(ASYNC_RESULT_CHANNEL, (uint32_t)channelRequestId)) {
+        LNN_LOGI(LNN_LANE, "guide race lost, close proxy channel, channelRequestId=%{public}d", channelRequestId);
+        TransProxyPipelineCloseChannel(channelId);
+        (void)DelP2pLinkReqByReqId(ASYNC_RESULT_CHANNEL, (uint32_t)channelRequestId);
+        return;
+    }
     struct WifiDirectConnectInfo info;
     (void)memset_s(&info, sizeof(info), 0, sizeof(info));
     info.requestId = GetWifiDirectManager()->getRequestId();
@@ -2664,12 +2882,57 @@ static int32_t LnnSelectDirectLink(uint32_t laneReqId, LaneLinkType linkType)
     return g_channelTable[guideType](&guideInfo.request, laneReqId, &guideInfo.callback);
 }
 
+static bool IsGuideChannelRaceable(WdGuideType guideType)
+{
+    return guideType == LANE_ACTIVE_AUTH_NEGO || guideType == LANE_ACTIVE_BR_NEGO ||
+        guideType == LANE_PROXY_AUTH_NEGO || guideType == LANE_NEW_AUTH_NEGO;
+}
+
+static uint32_t GetGuideChannelRaceNum(const WdGuideType *guideList, uint32_t guideNum)
+{
+    uint32_t raceNum = 0;
+    while (raceNum < guideNum && raceNum < GUIDE_CHANNEL_RACE_NUM_MAX && IsGuideChannelRaceable(guideList[raceNum])) {
+        raceNum++;
+    }
+    return raceNum > 1 ? raceNum : 0;
+}
+
+static bool GetGuideChannelRaceState(uint32_t laneReqId, LaneLinkType linkType, uint32_t *guideIdx,
+    bool *hasNextRacer)
+{
+    *hasNextRacer = false;
+    if (LinkLock() != 0) {
+        LNN_LOGE(LNN_LANE, "lock fail, get guide channel race state fail.");
+        return false;
+    }
+    bool isRacing = false;
+    WdGuideInfo *guideInfoNode = GetGuideNodeWithoutLock(laneReqId, linkType);
+    if (guideInfoNode != NULL && !guideInfoNode->isRaceWon && guideInfoNode->guideIdx < guideInfoNode->raceNum) {
+        isRacing = true;
+        *guideIdx = guideInfoNode->guideIdx;
+        *hasNextRacer = guideInfoNode->guideIdx + 1 < guideInfoNode->raceNum;
+    }
+    LinkUnlock();
+    return isRacing;
+}
+
 static void BuildGuideChannel(uint32_t laneReqId, LaneLinkType linkType)
 {
+    uint32_t guideIdx = 0;
+    bool hasNextRacer = false;
+    bool isRacing = GetGuideChannelRaceState(laneReqId, linkType, &guideIdx, &hasNextRacer);
     int32_t ret = LnnSelectDirectLink(laneReqId, linkType);
     if (ret != SOFTBUS_OK) {
         LNN_LOGE(LNN_LANE, "handle guide channel sync fail, laneReqId=%{public}u", laneReqId);
+        if (isRacing) {
+            HandleGuideChannelRaceFail(laneReqId, linkType, guideIdx, AUTH_LINK_TYPE_MAX, ret);
+            return;
+        }
         HandleGuideChannelRetry(laneReqId, linkType, AUTH_LINK_TYPE_MAX, ret);
+        return;
+    }
+    if (hasNextRacer) {
+        (void)PostGuideChannelRaceMessage(laneReqId, linkType, GUIDE_CHANNEL_RACE_DELAY);
     }
 }
 
@@ -2701,6 +2964,10 @@ static int32_t SelectGuideChannel(const LinkRequest *request, uint32_t laneReqId
     guideInfo.guideNum = guideChannelNum;
     guideInfo.guideIdx = 0;
     guideInfo.firstGuideErrCode = SOFTBUS_OK;
+    guideInfo.raceNum = GetGuideChannelRaceNum(guideChannelList, guideChannelNum);
+    guideInfo.racingNum = guideInfo.raceNum > 0 ? 1 : 0;
+    guideInfo.raceWinIdx = 0;
+    guideInfo.isRaceWon = false;
     if (AddGuideInfoItem(&guideInfo) != SOFTBUS_OK) {
         LNN_LOGE(LNN_LANE, "add guide channel info fail.");
         return SOFTBUS_LANE_LIST_ERR;
@@ -2717,6 +2984,27 @@ static void GuideChannelTrigger(SoftBusMessage *msg)
     BuildGuideChannel(laneReqId, linkType);
 }
 
+static void GuideChannelRace(SoftBusMessage *msg)
+{
+    uint32_t laneReqId = (uint32_t)msg->arg1;
+    LaneLinkType linkType = (LaneLinkType)msg->arg2;
+    if (LinkLock() != 0) {
+        LNN_LOGE(LNN_LANE, "lock fail, handle guide channel race fail.");
+        return;
+    }
+    WdGuideInfo *guideInfoNode = GetGuideNodeWithoutLock(laneReqId, linkType);
+    if (guideInfoNode == NULL || guideInfoNode->isRaceWon || guideInfoNode->guideIdx + 1 >= guideInfoNode->raceNum) {
+        LinkUnlock();
+        LNN_LOGI(LNN_LANE, "no guide channel left to race, laneReqId=%{public}u", laneReqId);
+        return;
+    }
+    guideInfoNode->guideIdx++;
+    guideInfoNode->racingNum++;
+    LinkUnlock();
+    LNN_LOGI(LNN_LANE, "handle guide channel race msg, laneReqId=%{public}u", laneReqId);
+    BuildGuideChannel(laneReqId, linkType);
+}
+
 static int32_t GetRequest(P2pLinkReqList *p2pLinkReqInfo, LinkRequest *request)
 {
     if (strcpy_s(request->peerNetworkId, sizeof(request->peerNetworkId),
@@ -2896,7 +3184,7 @@ static int32_t GenerateWifiDirectInfo(const P2pLinkReqList *reqInfo, struct Wifi
         LNN_LOGE(LNN_LANE, "get guide channel info fail.");
         return SOFTBUS_LANE_NOT_FOUND;
     }
-    WdGuideType guideType = guideInfo.guideList[guideInfo.guideIdx];
+    WdGuideType guideType = guideInfo.guideList[GetCurrentGuideIdx(&guideInfo)];
     if (guideType == LANE_ACTIVE_AUTH_NEGO || guideType == LANE_PROXY_AUTH_NEGO ||
         guideType == LANE_ACTIVE_AUTH_TRIGGER) {
         if (LnnGetRemoteStrInfo(reqInfo->laneRequestInfo.networkId, STRING_KEY_WIFIDIRECT_ADDR,
@@ -2964,6 +3252,9 @@ static void GuideChannelMsgHandler(SoftBusMessage *msg)
         case MSG_TYPE_RECONNECT_WITHOUT_GUIDE_CHANGE:
             WifiDirectReconnectDeviceAsync(msg);
             break;
+        case MSG_TYPE_GUIDE_CHANNEL_RACE:
+            GuideChannelRace(msg);
+            break;
         default:
             LNN_LOGE(LNN_LANE, "msg type=%{public}d cannot found", msg->what);
             break;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -1150,10 +1150,8 @@ static int64_t GetTimeInterval(uint64_t curTime, uint64_t lastTime)
 
 static int32_t AllowSelectNoCapLink(const char *networkId)
 {
-    char *anonyNetworkId = NULL;
-    Anonymize(networkId, &anonyNetworkId);
-    LNN_LOGI(LNN_LANE, "networkId=%{public}s", AnonymizeWrapper(anonyNetworkId));
-    AnonymizeFree(anonyNetworkId);
+    ANONYMIZE_BUF(anonyNetworkId);
+    LNN_LOGI(LNN_LANE, "networkId=%{public}s", ANONYMIZE(anonyNetworkId, networkId));
     char udid[UDID_BUF_LEN] = {0};
     int32_t ret = LnnGetRemoteStrInfo(networkId, STRING_KEY_DEV_UDID, udid, sizeof(udid));
     if (ret != SOFTBUS_OK) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -38,6 +38,7 @@ int32_t LnnDBDataChangeSyncToCache(const char *key, const char *value, ChangeTyp
 int32_t SyncLedgerInfoToCloud(
     NodeInfo *info, const UserInfo *userInfo, bool isAckSeq, char *peerudid, bool isMainScreenUserId);
 int32_t LnnDBDataAddChangeSyncToCache(const char **key, const char **value, int32_t keySize);
+int32_t LnnDBDataUpdateChangeSyncToCache(const char **key, const char **value, int32_t keySize);
 int32_t LnnDBDataChangeSyncToCacheInner(const char *key, const char *value);
 int32_t LnnSetCloudAbility(const bool isEnableCloud, uint32_t filterMode);
 #ifdef __cplusplus
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -19,12 +19,22 @@
 #include <stdint.h>
 
 #include "lnn_sync_info_manager_struct.h"
+#include "softbus_bus_center.h"
 #include "softbus_common.h"
 
 #ifdef __cplusplus
 extern "C" {
 #endif
 
+typedef bool (*LnnSyncInfoPeerFilter)(const NodeBasicInfo *peer, void *para);
+
+typedef struct {
+    const NodeBasicInfo *peers;
+    int32_t peerNum;
+    LnnSyncInfoPeerFilter filter; /* NULL sends to every peer */
+    void *para;
+} LnnSyncInfoPeerList;
+
 int32_t LnnInitSyncInfoManager(void);
 void LnnDeinitSyncInfoManager(void);
 
@@ -33,6 +43,9 @@ int32_t LnnUnregSyncInfoHandler(LnnSyncInfoType type, LnnSyncInfoMsgHandler hand
 
 int32_t LnnSendSyncInfoMsg(LnnSyncInfoType type, const char *networkId,
     const uint8_t *msg, uint32_t len, LnnSyncInfoMsgComplete complete);
+/* the message is framed once and shared by all peers, only peers without an opened channel get a copy */
+int32_t LnnSendSyncInfoMsgToPeers(LnnSyncInfoType type, const LnnSyncInfoPeerList *peerList,
+    const uint8_t *msg, uint32_t len);
 int32_t LnnSendP2pSyncInfoMsg(const char *networkId, uint32_t netCapability);
 int32_t LnnSendWifiOfflineInfoMsg(void);
 void LnnSendAsyncInfoMsg(void *param);
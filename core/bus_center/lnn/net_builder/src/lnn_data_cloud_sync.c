@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,7 @@
 #include "lnn_data_cloud_sync.h"
 
 #include <securec.h>
+#include <stdlib.h>
 
 #include "anonymizer.h"
 #include "bus_center_manager.h"
@@ -55,6 +56,16 @@ typedef struct {
     uint64_t timestamp;
 } CloudSyncValue;
 
+/* one parsed kv of a batch, index is its position in the batch */
+typedef struct {
+    int32_t index;
+    bool isApplied;
+    char deviceUdid[UDID_BUF_LEN];
+    char fieldName[FIELDNAME_MAX_LEN];
+    char trueValue[SPLIT_MAX_LEN];
+    CloudSyncValue parseValue;
+} CloudSyncField;
+
 static int32_t DBCipherInfoSyncToCache(
     NodeInfo *cacheInfo, char *fieldName, const char *value, size_t valueLength, const char *udid)
 {
@@ -446,54 +457,181 @@ static int32_t SplitString(char splitKey[SPLIT_KEY_NUM][SPLIT_MAX_LEN], char spl
     return SOFTBUS_OK;
 }
 
-static int32_t HandleDBAddChangeInternal(const char *key, const char *value, NodeInfo *cacheInfo)
+static bool IsIgnoreUpdate(
+    int32_t oldStateVersion, uint64_t oldTimestamp, int32_t newStateVersion, uint64_t newTimestamp)
 {
-    LNN_LOGD(LNN_BUILDER, "enter.");
-    if (key == NULL || value == NULL) {
+    bool isIgnore = oldTimestamp > newTimestamp || (oldTimestamp == 0 && oldStateVersion > newStateVersion);
+    if (isIgnore) {
+        LNN_LOGE(LNN_BUILDER,
+            "fail: sync info is older, oldCacheInfo.stateVersion=%{public}d, oldTimestamp=%{public}" PRIu64
+            ", newSyncInfo.stateVersion=%{public}d, newTimestamp=%{public}" PRIu64 "",
+            oldStateVersion, oldTimestamp, newStateVersion, newTimestamp);
+    }
+    return isIgnore;
+}
+
+static int32_t ParseCloudSyncField(const char *key, const char *value, CloudSyncField *field)
+{
+    if (key == NULL || value == NULL || field == NULL) {
         LNN_LOGE(LNN_BUILDER, "fail:invalid param");
         return SOFTBUS_INVALID_PARAM;
     }
-    int32_t ret = SOFTBUS_OK;
     int64_t accountId = 0;
-    char deviceUdid[UDID_BUF_LEN] = { 0 };
-    char fieldName[FIELDNAME_MAX_LEN] = { 0 };
-    CloudSyncValue parseValue = { 0 };
     char splitKey[SPLIT_KEY_NUM][SPLIT_MAX_LEN] = { 0 };
     char splitValue[SPLIT_VALUE_NUM][SPLIT_MAX_LEN] = { 0 };
-    ret = SplitString(splitKey, splitValue, key, value, &parseValue);
-    if (ret != SOFTBUS_OK) {
+    if (SplitString(splitKey, splitValue, key, value, &field->parseValue) != SOFTBUS_OK) {
         LNN_LOGE(LNN_BUILDER, "split string error");
-        return ret;
+        return SOFTBUS_SPLIT_STRING_FAIL;
     }
-    ret = GetInfoFromSplitKey(splitKey, &accountId, deviceUdid, fieldName);
+    int32_t ret = GetInfoFromSplitKey(splitKey, &accountId, field->deviceUdid, field->fieldName);
     if (ret != SOFTBUS_OK) {
         LNN_LOGE(LNN_BUILDER, "get info from splitkey error");
         return ret;
     }
-    char trueValue[SPLIT_MAX_LEN] = { 0 };
-    if (strcpy_s(trueValue, SPLIT_MAX_LEN, splitValue[0]) != EOK) {
+    if (strcpy_s(field->trueValue, SPLIT_MAX_LEN, splitValue[0]) != EOK) {
         LNN_LOGE(LNN_BUILDER, "fail:strcpy_s true value fail.");
+        (void)memset_s(splitValue, sizeof(splitValue), 0, sizeof(splitValue));
         return SOFTBUS_STRCPY_ERR;
     }
-    NodeInfo localCacheInfo = { 0 };
-    ret = LnnGetLocalCacheNodeInfoPacked(&localCacheInfo);
-    if (ret != SOFTBUS_OK) {
-        LNN_LOGE(LNN_BUILDER, "get local cache node info fail");
+    (void)memset_s(splitValue, sizeof(splitValue), 0, sizeof(splitValue));
+    return SOFTBUS_OK;
+}
+
+static int CompareCloudSyncField(const void *a, const void *b)
+{
+    const CloudSyncField *fieldA = (const CloudSyncField *)a;
+    const CloudSyncField *fieldB = (const CloudSyncField *)b;
+    int ret = strcmp(fieldA->deviceUdid, fieldB->deviceUdid);
+    if (ret != 0) {
         return ret;
     }
-    if (strcmp(deviceUdid, localCacheInfo.deviceInfo.deviceUdid) == 0) {
+    return fieldA->index - fieldB->index;
+}
+
+static void FreeCloudSyncFields(CloudSyncField *fields, int32_t num)
+{
+    (void)memset_s(fields, sizeof(CloudSyncField) * num, 0, sizeof(CloudSyncField) * num);
+    SoftBusFree(fields);
+}
+
+/*
+ * parse every kv of a batch once and group the fields by udid, fields of one device keep their kv order,
+ * a malformed kv is skipped so it does not cost the rest of the batch
+ */
+static int32_t ParseCloudSyncFields(const char **key, const char **value, int32_t keySize, CloudSyncField **fields,
+    int32_t *fieldNum)
+{
+    if (keySize <= 0) {
+        LNN_LOGE(LNN_BUILDER, "invalid keySize=%{public}d", keySize);
+        return SOFTBUS_INVALID_PARAM;
+    }
+    CloudSyncField *parsed = (CloudSyncField *)SoftBusCalloc(sizeof(CloudSyncField) * keySize);
+    if (parsed == NULL) {
+        LNN_LOGE(LNN_BUILDER, "calloc cloud sync fields fail");
+        return SOFTBUS_MALLOC_ERR;
+    }
+    int32_t num = 0;
+    for (int32_t i = 0; i < keySize; i++) {
+        if (ParseCloudSyncField(key[i], value[i], &parsed[num]) != SOFTBUS_OK) {
+            LNN_LOGE(LNN_BUILDER, "parse cloud sync field fail, skip index=%{public}d", i);
+            (void)memset_s(&parsed[num], sizeof(CloudSyncField), 0, sizeof(CloudSyncField));
+            continue;
+        }
+        parsed[num].index = i;
+        num++;
+    }
+    if (num == 0) {
+        LNN_LOGE(LNN_BUILDER, "no valid cloud sync field in batch, keySize=%{public}d", keySize);
+        FreeCloudSyncFields(parsed, keySize);
+        return SOFTBUS_SPLIT_STRING_FAIL;
+    }
+    qsort(parsed, num, sizeof(CloudSyncField), CompareCloudSyncField);
+    *fields = parsed;
+    *fieldNum = num;
+    return SOFTBUS_OK;
+}
+
+static int32_t GetCloudSyncDeviceFieldNum(const CloudSyncField *fields, int32_t start, int32_t keySize)
+{
+    int32_t end = start + 1;
+    while (end < keySize && strcmp(fields[end].deviceUdid, fields[start].deviceUdid) == 0) {
+        end++;
+    }
+    return end - start;
+}
+
+static int32_t HandleDBAddChangeInternal(CloudSyncField *field, const NodeInfo *localCacheInfo, NodeInfo *cacheInfo)
+{
+    LNN_LOGD(LNN_BUILDER, "enter.");
+    if (field == NULL || localCacheInfo == NULL || cacheInfo == NULL) {
+        LNN_LOGE(LNN_BUILDER, "fail:invalid param");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    if (strcmp(field->deviceUdid, localCacheInfo->deviceInfo.deviceUdid) == 0) {
         return SOFTBUS_OK;
     }
-    ret = DBDataChangeBatchSyncToCacheInternal(cacheInfo, fieldName, trueValue, strlen(trueValue), deviceUdid);
+    int32_t ret = DBDataChangeBatchSyncToCacheInternal(
+        cacheInfo, field->fieldName, field->trueValue, strlen(field->trueValue), field->deviceUdid);
     if (ret != SOFTBUS_OK) {
         LNN_LOGE(LNN_BUILDER, "fail:DB data change batch sync to cache fail");
         return ret;
     }
-    cacheInfo->localStateVersion = localCacheInfo.stateVersion;
-    cacheInfo->updateTimestamp = parseValue.timestamp;
+    cacheInfo->localStateVersion = localCacheInfo->stateVersion;
+    cacheInfo->updateTimestamp = field->parseValue.timestamp;
     return SOFTBUS_OK;
 }
 
+static int32_t SaveDBAddChangeToLedger(NodeInfo *cacheInfo)
+{
+    char udidHash[UDID_HASH_HEX_LEN + 1] = { 0 };
+    if (LnnGenerateHexStringHash((const unsigned char *)cacheInfo->deviceInfo.deviceUdid, udidHash,
+        UDID_HASH_HEX_LEN) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "Generate UDID HexStringHash fail");
+        return SOFTBUS_NETWORK_GENERATE_STR_HASH_ERR;
+    }
+    NodeInfo oldCacheInfo = { 0 };
+    if (LnnRetrieveDeviceInfoPacked(udidHash, &oldCacheInfo) == SOFTBUS_OK &&
+        IsIgnoreUpdate(oldCacheInfo.stateVersion, oldCacheInfo.updateTimestamp, cacheInfo->stateVersion,
+            cacheInfo->updateTimestamp)) {
+        return SOFTBUS_KV_IGNORE_OLD_DEVICE_INFO;
+    }
+    (void)LnnSaveRemoteDeviceInfoPacked(cacheInfo);
+    char *anonyUdid = NULL;
+    Anonymize(cacheInfo->deviceInfo.deviceUdid, &anonyUdid);
+    LNN_LOGI(LNN_BUILDER,
+        "success. udid=%{public}s, stateVersion=%{public}d, localStateVersion=%{public}d, updateTimestamp=%{public}"
+        "" PRIu64, AnonymizeWrapper(anonyUdid), cacheInfo->stateVersion, cacheInfo->localStateVersion,
+        cacheInfo->updateTimestamp);
+    AnonymizeFree(anonyUdid);
+    int32_t ret = LnnUpdateDistributedNodeInfo(cacheInfo, cacheInfo->deviceInfo.deviceUdid);
+    if (ret != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "fail:Cache info add sync to Ledger fail");
+        return ret;
+    }
+    return SOFTBUS_OK;
+}
+
+/* all fields of one device go into one cache info, which is saved and put to the ledger once */
+static int32_t HandleDBAddChangeDevice(CloudSyncField *fields, int32_t num, const NodeInfo *localCacheInfo)
+{
+    if (strcmp(fields[0].deviceUdid, localCacheInfo->deviceInfo.deviceUdid) == 0) {
+        return SOFTBUS_OK;
+    }
+    NodeInfo cacheInfo = { 0 };
+    int32_t ret = SOFTBUS_OK;
+    for (int32_t i = 0; i < num; i++) {
+        ret = HandleDBAddChangeInternal(&fields[i], localCacheInfo, &cacheInfo);
+        if (ret != SOFTBUS_OK) {
+            LNN_LOGE(LNN_BUILDER, "fail:handle db data add change internal fail");
+            (void)memset_s(&cacheInfo, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+            return ret;
+        }
+    }
+    ret = SaveDBAddChangeToLedger(&cacheInfo);
+    (void)memset_s(&cacheInfo, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+    return ret;
+}
+
 static int32_t SetDBNameDataToDLedger(NodeInfo *cacheInfo, char *deviceUdid, char *fieldName)
 {
     if (strcmp(fieldName, DEVICE_INFO_DEVICE_NAME) == 0) {
@@ -587,19 +725,6 @@ static void UpdateInfoToLedger(NodeInfo *cacheInfo, char *deviceUdid, char *fiel
     }
 }
 
-static bool IsIgnoreUpdate(
-    int32_t oldStateVersion, uint64_t oldTimestamp, int32_t newStateVersion, uint64_t newTimestamp)
-{
-    bool isIgnore = oldTimestamp > newTimestamp || (oldTimestamp == 0 && oldStateVersion > newStateVersion);
-    if (isIgnore) {
-        LNN_LOGE(LNN_BUILDER,
-            "fail: sync info is older, oldCacheInfo.stateVersion=%{public}d, oldTimestamp=%{public}" PRIu64
-            ", newSyncInfo.stateVersion=%{public}d, newTimestamp=%{public}" PRIu64 "",
-            oldStateVersion, oldTimestamp, newStateVersion, newTimestamp);
-    }
-    return isIgnore;
-}
-
 static int32_t HandleDBUpdateInternal(
     char *deviceUdid, char *fieldName, char *trueValue, const CloudSyncValue *parseValue, int32_t localStateVersion)
 {
@@ -651,44 +776,102 @@ static int32_t HandleDBUpdateChangeInternal(const char *key, const char *value)
         LNN_LOGE(LNN_BUILDER, "fail:invalid param.");
         return SOFTBUS_INVALID_PARAM;
     }
-    int32_t ret = SOFTBUS_OK;
-    int64_t accountId = 0;
-    char deviceUdid[UDID_BUF_LEN] = { 0 };
-    char fieldName[FIELDNAME_MAX_LEN] = { 0 };
-    CloudSyncValue parseValue = { 0 };
-    char splitKey[SPLIT_KEY_NUM][SPLIT_MAX_LEN] = { 0 };
-    char splitValue[SPLIT_VALUE_NUM][SPLIT_MAX_LEN] = { 0 };
-    if (SplitString(splitKey, splitValue, key, value, &parseValue) != SOFTBUS_OK) {
-        LNN_LOGE(LNN_BUILDER, "split string error");
-        return SOFTBUS_SPLIT_STRING_FAIL;
-    }
-    ret = GetInfoFromSplitKey(splitKey, &accountId, deviceUdid, fieldName);
+    CloudSyncField field = { 0 };
+    int32_t ret = ParseCloudSyncField(key, value, &field);
     if (ret != SOFTBUS_OK) {
-        LNN_LOGE(LNN_BUILDER, "get info from splitkey error");
         return ret;
     }
     NodeInfo localCacheInfo = { 0 };
     ret = LnnGetLocalCacheNodeInfoPacked(&localCacheInfo);
     if (ret != SOFTBUS_OK) {
         LNN_LOGE(LNN_BUILDER, "get local cache node info fail");
+        (void)memset_s(&field, sizeof(CloudSyncField), 0, sizeof(CloudSyncField));
         return ret;
     }
-    if (strcmp(deviceUdid, localCacheInfo.deviceInfo.deviceUdid) == 0) {
+    if (strcmp(field.deviceUdid, localCacheInfo.deviceInfo.deviceUdid) == 0) {
+        (void)memset_s(&field, sizeof(CloudSyncField), 0, sizeof(CloudSyncField));
         return SOFTBUS_OK;
     }
-    char trueValue[SPLIT_MAX_LEN] = { 0 };
-    if (strcpy_s(trueValue, SPLIT_MAX_LEN, splitValue[0]) != EOK) {
-        LNN_LOGE(LNN_BUILDER, "fail:strcpy_s true value fail.");
-        return SOFTBUS_STRCPY_ERR;
-    }
-    ret = HandleDBUpdateInternal(deviceUdid, fieldName, trueValue, &parseValue, localCacheInfo.stateVersion);
+    ret = HandleDBUpdateInternal(
+        field.deviceUdid, field.fieldName, field.trueValue, &field.parseValue, localCacheInfo.stateVersion);
     if (ret != SOFTBUS_OK) {
         LNN_LOGE(LNN_BUILDER, "handle DB update change internal fail");
-        (void)memset_s(trueValue, strlen(trueValue), 0, strlen(trueValue));
+        (void)memset_s(&field, sizeof(CloudSyncField), 0, sizeof(CloudSyncField));
         return ret;
     }
-    PrintDeviceUdidAndTrueValue(deviceUdid, fieldName, trueValue, parseValue.stateVersion);
-    (void)memset_s(trueValue, strlen(trueValue), 0, strlen(trueValue));
+    PrintDeviceUdidAndTrueValue(field.deviceUdid, field.fieldName, field.trueValue, field.parseValue.stateVersion);
+    (void)memset_s(&field, sizeof(CloudSyncField), 0, sizeof(CloudSyncField));
+    return SOFTBUS_OK;
+}
+
+/* a field written several times in the batch is set to the ledger once, from its final cache value */
+static bool IsCloudSyncFieldAppliedBefore(const CloudSyncField *fields, int32_t index)
+{
+    for (int32_t i = 0; i < index; i++) {
+        if (fields[i].isApplied && strcmp(fields[i].fieldName, fields[index].fieldName) == 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+/*
+ * fields of one device are applied to its cache info in kv order like single updates would, then each
+ * changed field is set to the ledger once and the cache info is saved once
+ */
+static int32_t HandleDBUpdateChangeDevice(CloudSyncField *fields, int32_t num, int32_t localStateVersion)
+{
+    char *deviceUdid = fields[0].deviceUdid;
+    char udidHash[UDID_HASH_HEX_LEN + 1] = { 0 };
+    if (LnnGenerateHexStringHash((const unsigned char *)deviceUdid, udidHash, UDID_HASH_HEX_LEN) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "Generate UDID HexStringHash fail");
+        return SOFTBUS_NETWORK_GENERATE_STR_HASH_ERR;
+    }
+    NodeInfo cacheInfo = { 0 };
+    if (LnnRetrieveDeviceInfoPacked(udidHash, &cacheInfo) != SOFTBUS_OK) {
+        LNN_LOGI(LNN_BUILDER, "no this device info in deviceCacheInfoMap, ignore update");
+        return SOFTBUS_OK;
+    }
+    int32_t oldStateVersion = cacheInfo.stateVersion;
+    int32_t updateNum = 0;
+    for (int32_t i = 0; i < num; i++) {
+        fields[i].isApplied = false;
+        if (IsIgnoreUpdate(cacheInfo.stateVersion, cacheInfo.updateTimestamp, fields[i].parseValue.stateVersion,
+            fields[i].parseValue.timestamp)) {
+            continue;
+        }
+        updateNum++;
+        cacheInfo.stateVersion = fields[i].parseValue.stateVersion;
+        if (DBDataChangeBatchSyncToCacheInternal(&cacheInfo, fields[i].fieldName, fields[i].trueValue,
+            strlen(fields[i].trueValue), deviceUdid) != SOFTBUS_OK) {
+            LNN_LOGE(LNN_BUILDER, "fail:DB data change sync to cache fail");
+            continue;
+        }
+        fields[i].isApplied = true;
+    }
+    if (updateNum == 0) {
+        (void)memset_s(&cacheInfo, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+        return SOFTBUS_OK;
+    }
+    for (int32_t i = 0; i < num; i++) {
+        if (!fields[i].isApplied || IsCloudSyncFieldAppliedBefore(fields, i)) {
+            continue;
+        }
+        if (SetDBDataToDistributedLedger(&cacheInfo, deviceUdid, strlen(deviceUdid), fields[i].fieldName) !=
+            SOFTBUS_OK) {
+            LNN_LOGE(LNN_BUILDER, "set DB data to distributedLedger fail");
+        }
+    }
+    LNN_LOGI(LNN_BUILDER, "update peer stateVersion=%{public}d->%{public}d, localStateVersion=%{public}d->%{public}d",
+        oldStateVersion, cacheInfo.stateVersion, cacheInfo.localStateVersion, localStateVersion);
+    cacheInfo.localStateVersion = localStateVersion;
+    (void)LnnSaveRemoteDeviceInfoPacked(&cacheInfo);
+    char *anonyDeviceUdid = NULL;
+    Anonymize(deviceUdid, &anonyDeviceUdid);
+    LNN_LOGI(LNN_BUILDER, "deviceUdid=%{public}s update %{public}d of %{public}d fields success",
+        AnonymizeWrapper(anonyDeviceUdid), updateNum, num);
+    AnonymizeFree(anonyDeviceUdid);
+    (void)memset_s(&cacheInfo, sizeof(NodeInfo), 0, sizeof(NodeInfo));
     return SOFTBUS_OK;
 }
 
@@ -768,45 +951,67 @@ int32_t LnnDBDataAddChangeSyncToCache(const char **key, const char **value, int3
     if (ret != SOFTBUS_OK) {
         return ret;
     }
-    NodeInfo cacheInfo = { 0 };
-    for (int32_t i = 0; i < keySize; i++) {
-        ret = HandleDBAddChangeInternal(key[i], value[i], &cacheInfo);
-        if (ret != SOFTBUS_OK) {
-            LNN_LOGE(LNN_BUILDER, "fail:handle db data add change internal fail");
-            FreeKeyAndValue(key, value, keySize);
-            (void)memset_s(&cacheInfo, sizeof(NodeInfo), 0, sizeof(NodeInfo));
-            return ret;
+    CloudSyncField *fields = NULL;
+    int32_t fieldNum = 0;
+    ret = ParseCloudSyncFields(key, value, keySize, &fields, &fieldNum);
+    FreeKeyAndValue(key, value, keySize);
+    if (ret != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "fail:handle db data add change internal fail");
+        return ret;
+    }
+    NodeInfo localCacheInfo = { 0 };
+    ret = LnnGetLocalCacheNodeInfoPacked(&localCacheInfo);
+    if (ret != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "get local cache node info fail");
+        FreeCloudSyncFields(fields, keySize);
+        return ret;
+    }
+    int32_t result = SOFTBUS_OK;
+    for (int32_t start = 0, num = 0; start < fieldNum; start += num) {
+        num = GetCloudSyncDeviceFieldNum(fields, start, fieldNum);
+        ret = HandleDBAddChangeDevice(&fields[start], num, &localCacheInfo);
+        if (ret != SOFTBUS_OK && result == SOFTBUS_OK) {
+            result = ret;
         }
     }
-    FreeKeyAndValue(key, value, keySize);
-    char udidHash[UDID_HASH_HEX_LEN + 1] = { 0 };
-    if (LnnGenerateHexStringHash((const unsigned char *)cacheInfo.deviceInfo.deviceUdid, udidHash, UDID_HASH_HEX_LEN) !=
-        SOFTBUS_OK) {
-        LNN_LOGE(LNN_BUILDER, "Generate UDID HexStringHash fail");
-        return SOFTBUS_NETWORK_GENERATE_STR_HASH_ERR;
+    FreeCloudSyncFields(fields, keySize);
+    return result;
+}
+
+int32_t LnnDBDataUpdateChangeSyncToCache(const char **key, const char **value, int32_t keySize)
+{
+    int32_t ret = CheckParamValidity(key, value, keySize);
+    if (ret != SOFTBUS_OK) {
+        return ret;
     }
-    NodeInfo oldCacheInfo = { 0 };
-    if (LnnRetrieveDeviceInfoPacked(udidHash, &oldCacheInfo) == SOFTBUS_OK &&
-        IsIgnoreUpdate(oldCacheInfo.stateVersion, oldCacheInfo.updateTimestamp, cacheInfo.stateVersion,
-            cacheInfo.updateTimestamp)) {
-        return SOFTBUS_KV_IGNORE_OLD_DEVICE_INFO;
+    CloudSyncField *fields = NULL;
+    int32_t fieldNum = 0;
+    ret = ParseCloudSyncFields(key, value, keySize, &fields, &fieldNum);
+    FreeKeyAndValue(key, value, keySize);
+    if (ret != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "fail:handle db data update change internal fail");
+        return ret;
     }
-    (void)LnnSaveRemoteDeviceInfoPacked(&cacheInfo);
-    char *anonyUdid = NULL;
-    Anonymize(cacheInfo.deviceInfo.deviceUdid, &anonyUdid);
-    LNN_LOGI(LNN_BUILDER,
-        "success. udid=%{public}s, stateVersion=%{public}d, localStateVersion=%{public}d, updateTimestamp=%{public}"
-        "" PRIu64, AnonymizeWrapper(anonyUdid), cacheInfo.stateVersion, cacheInfo.localStateVersion,
-        cacheInfo.updateTimestamp);
-    AnonymizeFree(anonyUdid);
-    ret = LnnUpdateDistributedNodeInfo(&cacheInfo, cacheInfo.deviceInfo.deviceUdid);
+    NodeInfo localCacheInfo = { 0 };
+    ret = LnnGetLocalCacheNodeInfoPacked(&localCacheInfo);
     if (ret != SOFTBUS_OK) {
-        LNN_LOGE(LNN_BUILDER, "fail:Cache info add sync to Ledger fail");
-        (void)memset_s(&cacheInfo, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+        LNN_LOGE(LNN_BUILDER, "get local cache node info fail");
+        FreeCloudSyncFields(fields, keySize);
         return ret;
     }
-    (void)memset_s(&cacheInfo, sizeof(NodeInfo), 0, sizeof(NodeInfo));
-    return SOFTBUS_OK;
+    int32_t result = SOFTBUS_OK;
+    for (int32_t start = 0, num = 0; start < fieldNum; start += num) {
+        num = GetCloudSyncDeviceFieldNum(fields, start, fieldNum);
+        if (strcmp(fields[start].deviceUdid, localCacheInfo.deviceInfo.deviceUdid) == 0) {
+            continue;
+        }
+        ret = HandleDBUpdateChangeDevice(&fields[start], num, localCacheInfo.stateVersion);
+        if (ret != SOFTBUS_OK && result == SOFTBUS_OK) {
+            result = ret;
+        }
+    }
+    FreeCloudSyncFields(fields, keySize);
+    return result;
 }
 
 static void PrintSyncNodeInfoEx(const NodeInfo *cacheInfo)
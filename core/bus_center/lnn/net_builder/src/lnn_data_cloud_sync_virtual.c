@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -73,6 +73,14 @@ int32_t LnnDBDataAddChangeSyncToCache(const char **key, const char **value, int3
     return SOFTBUS_NOT_IMPLEMENT;
 }
 
+int32_t LnnDBDataUpdateChangeSyncToCache(const char **key, const char **value, int32_t keySize)
+{
+    (void)key;
+    (void)value;
+    (void)keySize;
+    return SOFTBUS_NOT_IMPLEMENT;
+}
+
 int32_t LnnDBDataChangeSyncToCacheInner(const char *key, const char *value)
 {
     (void)key;
@@ -198,7 +198,7 @@ static uint8_t *ConvertCapabilityToMsg(uint32_t localCapability)
     return arr;
 }
 
-static bool IsNeedToSend(NodeInfo *nodeInfo, uint32_t type)
+static bool IsNeedToSend(const NodeInfo *nodeInfo, uint32_t type)
 {
     if ((type & (1 << (uint32_t)DISCOVERY_TYPE_BR)) && (LnnHasDiscoveryType(nodeInfo, DISCOVERY_TYPE_BR))) {
         return true;
@@ -212,65 +212,57 @@ static bool IsNeedToSend(NodeInfo *nodeInfo, uint32_t type)
     }
 }
 
-static int32_t SendCapabilityMsg(NodeInfo nodeInfo, NodeBasicInfo netInfo, uint8_t *msg, uint32_t type)
+/* returns true when the peer takes the capability sync info msg instead of a ble heartbeat */
+static bool SendCapabilityMsg(const NodeInfo *nodeInfo, uint32_t type)
 {
-    int32_t ret = SOFTBUS_OK;
     int32_t localDevTypeId = 0;
     if (LnnGetLocalNumInfo(NUM_KEY_DEV_TYPE_ID, &localDevTypeId) != SOFTBUS_OK) {
         LNN_LOGE(LNN_BUILDER, "get local dev type id failed");
-        return SOFTBUS_NETWORK_GET_LOCAL_NODE_INFO_ERR;
-    }
-    if (type == ((1 << (uint32_t)DISCOVERY_TYPE_BLE) | (1 << (uint32_t)DISCOVERY_TYPE_BR))) {
-        if (((localDevTypeId == TYPE_WATCH_ID || nodeInfo.deviceInfo.deviceTypeId == TYPE_WATCH_ID) ||
-            (localDevTypeId == TYPE_GLASS_ID || nodeInfo.deviceInfo.deviceTypeId == TYPE_GLASS_ID)) &&
-            LnnHasDiscoveryType(&nodeInfo, DISCOVERY_TYPE_BR)) {
-            ret = LnnSendSyncInfoMsg(LNN_INFO_TYPE_CAPABILITY, netInfo.networkId, msg, MSG_LEN, NULL);
-        } else {
-            ret = LnnStartHbByTypeAndStrategy(HEARTBEAT_TYPE_BLE_V0, STRATEGY_HB_SEND_SINGLE, false);
-        }
-    } else {
-        ret = LnnSendSyncInfoMsg(LNN_INFO_TYPE_CAPABILITY, netInfo.networkId, msg, MSG_LEN, NULL);
+        return false;
     }
-    return ret;
+    if (type != ((1 << (uint32_t)DISCOVERY_TYPE_BLE) | (1 << (uint32_t)DISCOVERY_TYPE_BR))) {
+        return true;
+    }
+    if (((localDevTypeId == TYPE_WATCH_ID || nodeInfo->deviceInfo.deviceTypeId == TYPE_WATCH_ID) ||
+        (localDevTypeId == TYPE_GLASS_ID || nodeInfo->deviceInfo.deviceTypeId == TYPE_GLASS_ID)) &&
+        LnnHasDiscoveryType(nodeInfo, DISCOVERY_TYPE_BR)) {
+        return true;
+    }
+    int32_t ret = LnnStartHbByTypeAndStrategy(HEARTBEAT_TYPE_BLE_V0, STRATEGY_HB_SEND_SINGLE, false);
+    LNN_LOGI(LNN_BUILDER, "sync cap info by heartbeat ret=%{public}d, type=%{public}u", ret, type);
+    return false;
 }
 
-static void DoSendCapability(NodeInfo nodeInfo, NodeBasicInfo netInfo, uint8_t *msg, uint32_t netCapability,
+/* returns true when the peer takes the capability sync info msg */
+static bool DoSendCapability(const NodeInfo *nodeInfo, const NodeBasicInfo *netInfo, uint32_t netCapability,
     uint32_t type)
 {
-    int32_t ret = SOFTBUS_OK;
-    if (IsNeedToSend(&nodeInfo, type)) {
-        if (!IsFeatureSupport(nodeInfo.feature, BIT_CLOUD_SYNC_DEVICE_INFO)) {
-            ret = LnnSendSyncInfoMsg(LNN_INFO_TYPE_CAPABILITY, netInfo.networkId, msg, MSG_LEN, NULL);
-        } else {
-            ret = SendCapabilityMsg(nodeInfo, netInfo, msg, type);
+    if (IsNeedToSend(nodeInfo, type)) {
+        if (!IsFeatureSupport(nodeInfo->feature, BIT_CLOUD_SYNC_DEVICE_INFO)) {
+            return true;
         }
-        char *anonyNetworkId = NULL;
-        Anonymize(netInfo.networkId, &anonyNetworkId);
-        LNN_LOGE(LNN_BUILDER,
-            "sync cap info ret=%{public}d, peerNetworkId=%{public}s, type=%{public}u.",
-            ret, AnonymizeWrapper(anonyNetworkId), type);
-        AnonymizeFree(anonyNetworkId);
-    } else if ((type & (1 << (uint32_t)DISCOVERY_TYPE_WIFI)) != 0 && !LnnHasCapability(netCapability, BIT_BLE)) {
-        LnnSendP2pSyncInfoMsg(netInfo.networkId, netCapability);
+        return SendCapabilityMsg(nodeInfo, type);
     }
+    if ((type & (1 << (uint32_t)DISCOVERY_TYPE_WIFI)) != 0 && !LnnHasCapability(netCapability, BIT_BLE)) {
+        LnnSendP2pSyncInfoMsg(netInfo->networkId, netCapability);
+    }
+    return false;
 }
 
-static void SendSleCapabilityToRemote(NodeInfo *nodeInfo, NodeBasicInfo netInfo, uint8_t *msg, uint32_t netCapability)
+/* returns true when the peer takes the capability sync info msg */
+static bool SendSleCapabilityToRemote(const NodeInfo *nodeInfo, const NodeBasicInfo *netInfo,
+    uint32_t netCapability)
 {
-    int32_t ret = SOFTBUS_OK;
     if (LnnHasDiscoveryType(nodeInfo, DISCOVERY_TYPE_BLE) || LnnHasDiscoveryType(nodeInfo, DISCOVERY_TYPE_BR)) {
-        ret = LnnStartHbByTypeAndStrategy(HEARTBEAT_TYPE_BLE_V0, STRATEGY_HB_SEND_SINGLE, false);
-    } else if (LnnHasDiscoveryType(nodeInfo, DISCOVERY_TYPE_WIFI)) {
-        ret = LnnSendSyncInfoMsg(LNN_INFO_TYPE_CAPABILITY, netInfo.networkId, msg, MSG_LEN, NULL);
-    } else {
-        LnnSendP2pSyncInfoMsg(netInfo.networkId, netCapability);
+        int32_t ret = LnnStartHbByTypeAndStrategy(HEARTBEAT_TYPE_BLE_V0, STRATEGY_HB_SEND_SINGLE, false);
+        LNN_LOGI(LNN_BUILDER, "sync sle cap info by heartbeat ret=%{public}d", ret);
+        return false;
     }
-    char *anonyNetworkId = NULL;
-    Anonymize(netInfo.networkId, &anonyNetworkId);
-    LNN_LOGE(LNN_BUILDER,
-        "sync cap info ret=%{public}d, peerNetworkId=%{public}s.",
-        ret, AnonymizeWrapper(anonyNetworkId));
-    AnonymizeFree(anonyNetworkId);
+    if (LnnHasDiscoveryType(nodeInfo, DISCOVERY_TYPE_WIFI)) {
+        return true;
+    }
+    LnnSendP2pSyncInfoMsg(netInfo->networkId, netCapability);
+    return false;
 }
 
 static void SendNetCapabilityToRemote(uint32_t netCapability, uint32_t type, bool isSyncSle)
@@ -293,6 +285,7 @@ static void SendNetCapabilityToRemote(uint32_t netCapability, uint32_t type, boo
     }
     NodeInfo nodeInfo;
     (void)memset_s(&nodeInfo, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+    int32_t sendNum = 0;
     for (int32_t i = 0; i < infoNum; i++) {
         if (LnnIsLSANode(&netInfo[i])) {
             continue;
@@ -300,12 +293,23 @@ static void SendNetCapabilityToRemote(uint32_t netCapability, uint32_t type, boo
         if (LnnGetRemoteNodeInfoById(netInfo[i].networkId, CATEGORY_NETWORK_ID, &nodeInfo) != SOFTBUS_OK) {
             continue;
         }
-        if (!isSyncSle) {
-            DoSendCapability(nodeInfo, netInfo[i], msg, netCapability, type);
-        } else {
-            SendSleCapabilityToRemote(&nodeInfo, netInfo[i], msg, netCapability);
+        bool needMsg = isSyncSle ? SendSleCapabilityToRemote(&nodeInfo, &netInfo[i], netCapability) :
+            DoSendCapability(&nodeInfo, &netInfo[i], netCapability, type);
+        // peers taking the msg are packed to the front, the msg is then framed once for all of them
+        if (needMsg && sendNum != i) {
+            netInfo[sendNum] = netInfo[i];
         }
-    }
+        sendNum += needMsg ? 1 : 0;
+    }
+    LnnSyncInfoPeerList peerList = {
+        .peers = netInfo,
+        .peerNum = sendNum,
+        .filter = NULL,
+        .para = NULL,
+    };
+    int32_t ret = LnnSendSyncInfoMsgToPeers(LNN_INFO_TYPE_CAPABILITY, &peerList, msg, MSG_LEN);
+    LNN_LOGI(LNN_BUILDER, "sync cap info ret=%{public}d, peerNum=%{public}d, type=%{public}u, sle=%{public}d",
+        ret, sendNum, type, isSyncSle);
     SoftBusFree(netInfo);
     SoftBusFree(msg);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,7 +16,6 @@
 #include "lnn_p2p_info.h"
 
 
-#include "anonymizer.h"
 #include "bus_center_manager.h"
 #include "g_enhance_lnn_func_pack.h"
 #include "lnn_async_callback_utils.h"
@@ -176,10 +175,14 @@ static bool IsNeedSyncP2pInfo(const NodeInfo *localInfo, const NodeBasicInfo *in
     return false;
 }
 
+static bool FilterP2pInfoPeer(const NodeBasicInfo *peer, void *para)
+{
+    return !LnnIsLSANode(peer) && IsNeedSyncP2pInfo((const NodeInfo *)para, peer);
+}
+
 static void ProcessSyncP2pInfo(void *para)
 {
     (void)para;
-    int32_t i;
     int32_t infoNum = 0;
     uint32_t len;
     NodeBasicInfo *info = NULL;
@@ -204,27 +207,36 @@ static void ProcessSyncP2pInfo(void *para)
         return;
     }
     len = strlen(msg) + 1; /* add 1 for '\0' */
-    for (i = 0; i < infoNum; i++) {
-        if (LnnIsLSANode(&info[i])) {
-            continue;
-        }
-        if (IsNeedSyncP2pInfo(localInfo, &info[i]) &&
-            LnnSendSyncInfoMsg(LNN_INFO_TYPE_P2P_INFO, info[i].networkId, (uint8_t *)msg, len, NULL) != SOFTBUS_OK) {
-            char *anonyDeviceName = NULL;
-            AnonymizeDeviceName(info[i].deviceName, &anonyDeviceName);
-            LNN_LOGE(LNN_BUILDER, "sync p2p info fail. deviceName=%{public}s", AnonymizeWrapper(anonyDeviceName));
-            AnonymizeFree(anonyDeviceName);
-        }
+    LnnSyncInfoPeerList peerList = {
+        .peers = info,
+        .peerNum = infoNum,
+        .filter = FilterP2pInfoPeer,
+        .para = (void *)localInfo,
+    };
+    if (LnnSendSyncInfoMsgToPeers(LNN_INFO_TYPE_P2P_INFO, &peerList, (uint8_t *)msg, len) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "sync p2p info to some peers fail");
     }
     cJSON_free(msg);
     SoftBusFree(info);
     LNN_LOGI(LNN_BUILDER, "sync p2p info done");
 }
 
+static bool FilterWifiDirectAddrPeer(const NodeBasicInfo *peer, void *para)
+{
+    (void)para;
+    if (LnnIsLSANode(peer)) {
+        return false;
+    }
+    int32_t osType = 0;
+    if (LnnGetOsTypeByNetworkId(peer->networkId, &osType) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "get remote osType fail");
+    }
+    return osType != OH_OS_TYPE;
+}
+
 static void ProcessSyncWifiDirectAddr(void *para)
 {
     (void)para;
-    int32_t i;
     int32_t infoNum = 0;
     uint32_t len;
     NodeBasicInfo *info = NULL;
@@ -248,23 +260,14 @@ static void ProcessSyncWifiDirectAddr(void *para)
         return;
     }
     len = strlen(msg) + 1; /* add 1 for '\0' */
-    for (i = 0; i < infoNum; i++) {
-        if (LnnIsLSANode(&info[i])) {
-            continue;
-        }
-        int32_t osType = 0;
-        if (LnnGetOsTypeByNetworkId(info[i].networkId, &osType) != SOFTBUS_OK) {
-            LNN_LOGE(LNN_BUILDER, "get remote osType fail");
-        }
-        if (osType != OH_OS_TYPE &&
-            LnnSendSyncInfoMsg(LNN_INFO_TYPE_WIFI_DIRECT, info[i].networkId, (uint8_t *)msg, len, NULL)
-            != SOFTBUS_OK) {
-            char *anonyNetworkId = NULL;
-            Anonymize(info[i].networkId, &anonyNetworkId);
-            LNN_LOGE(LNN_BUILDER, "sync wifidirect addr fail. anonyNetworkId=%{public}s",
-                AnonymizeWrapper(anonyNetworkId));
-            AnonymizeFree(anonyNetworkId);
-        }
+    LnnSyncInfoPeerList peerList = {
+        .peers = info,
+        .peerNum = infoNum,
+        .filter = FilterWifiDirectAddrPeer,
+        .para = NULL,
+    };
+    if (LnnSendSyncInfoMsgToPeers(LNN_INFO_TYPE_WIFI_DIRECT, &peerList, (uint8_t *)msg, len) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "sync wifidirect addr to some peers fail");
     }
     cJSON_free(msg);
     SoftBusFree(info);
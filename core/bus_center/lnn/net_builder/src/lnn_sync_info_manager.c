@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -33,6 +33,8 @@
 
 #define MSG_HEAD_LEN 4
 #define MAX_SYNC_INFO_MSG_LEN 4096
+#define SYNC_INFO_BATCH_ITEM_HEAD_LEN 4
+#define SYNC_INFO_BATCH_MIN_NUM 2
 #define UNUSED_CHANNEL_CLOSED_DELAY (60 * 1000)
 #define TIME_CONVERSION_UNIT 1000
 #define CHANNEL_NAME "com.huawei.hwddmp.service.DeviceInfoSynchronize"
@@ -172,6 +174,52 @@ static SyncInfoMsg *CreateSyncInfoMsg(LnnSyncInfoType type, const uint8_t *msg,
     return syncMsg;
 }
 
+static LnnSyncInfoType GetSyncInfoMsgType(const SyncInfoMsg *msg)
+{
+    return (LnnSyncInfoType)(*(const int32_t *)msg->data);
+}
+
+/* only the newest value of these types matters to the peer */
+static bool IsLatestValueSyncInfo(LnnSyncInfoType type)
+{
+    switch (type) {
+        case LNN_INFO_TYPE_CAPABILITY:
+        case LNN_INFO_TYPE_DEVICE_NAME:
+        case LNN_INFO_TYPE_BATTERY_INFO:
+        case LNN_INFO_TYPE_SCREEN_STATUS:
+        case LNN_INFO_TYPE_P2P_INFO:
+        case LNN_INFO_TYPE_WIFI_DIRECT:
+        case LNN_INFO_TYPE_NICK_NAME:
+        case LNN_INFO_TYPE_SLE_MAC:
+            return true;
+        default:
+            return false;
+    }
+}
+
+/* a queued message of a latest value type is superseded by the new one instead of being sent stale */
+static void EnqueueSyncInfoMsg(SyncChannelInfo *info, SyncInfoMsg *msg)
+{
+    LnnSyncInfoType type = GetSyncInfoMsgType(msg);
+    SyncInfoMsg *item = NULL;
+    SyncInfoMsg *next = NULL;
+
+    if (IsLatestValueSyncInfo(type)) {
+        LIST_FOR_EACH_ENTRY_SAFE(item, next, &info->syncMsgList, SyncInfoMsg, node) {
+            if (GetSyncInfoMsgType(item) != type) {
+                continue;
+            }
+            LNN_LOGD(LNN_BUILDER, "replace queued sync info msg. type=%{public}d", type);
+            ListDelete(&item->node);
+            if (item->complete != NULL) {
+                item->complete(type, info->networkId, &item->data[MSG_HEAD_LEN], item->dataLen - MSG_HEAD_LEN);
+            }
+            SoftBusFree(item);
+        }
+    }
+    ListTailInsert(&info->syncMsgList, &msg->node);
+}
+
 static void SendSyncInfoMsgOnly(const char *networkId, int32_t clientChannelId, SyncInfoMsg *msg)
 {
     LNN_LOGI(LNN_BUILDER, "only send sync info");
@@ -320,11 +368,91 @@ static SyncChannelInfo *DumpSyncChannelInfo(const SyncChannelInfo *info)
     return newInfo;
 }
 
+static bool IsSyncInfoBatchSupported(const char *networkId)
+{
+    uint64_t local = 0;
+    uint64_t remote = 0;
+    if (LnnGetLocalNumU64Info(NUM_KEY_FEATURE_CAPA, &local) != SOFTBUS_OK ||
+        LnnGetRemoteNumU64Info(networkId, NUM_KEY_FEATURE_CAPA, &remote) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "get feature cap fail");
+        return false;
+    }
+    return IsFeatureSupport(local, BIT_SUPPORT_SYNC_INFO_BATCH) &&
+        IsFeatureSupport(remote, BIT_SUPPORT_SYNC_INFO_BATCH);
+}
+
+/*
+ * each packed message keeps its own frame, prefixed by the frame length: [len][type][payload].
+ * packing stops at the first message that does not fit, so the list order is kept on the wire.
+ */
+static uint32_t PackSyncInfoBatch(ListNode *list, ListNode *packed, uint8_t *frame, uint32_t *frameLen)
+{
+    SyncInfoMsg *msg = NULL;
+    SyncInfoMsg *msgNext = NULL;
+    uint32_t offset = MSG_HEAD_LEN;
+    uint32_t num = 0;
+
+    *(int32_t *)frame = LNN_INFO_TYPE_BATCH;
+    LIST_FOR_EACH_ENTRY_SAFE(msg, msgNext, list, SyncInfoMsg, node) {
+        if (offset + SYNC_INFO_BATCH_ITEM_HEAD_LEN + msg->dataLen > MAX_SYNC_INFO_MSG_LEN) {
+            break;
+        }
+        if (memcpy_s(frame + offset, MAX_SYNC_INFO_MSG_LEN - offset, &msg->dataLen,
+            SYNC_INFO_BATCH_ITEM_HEAD_LEN) != EOK ||
+            memcpy_s(frame + offset + SYNC_INFO_BATCH_ITEM_HEAD_LEN,
+            MAX_SYNC_INFO_MSG_LEN - offset - SYNC_INFO_BATCH_ITEM_HEAD_LEN, msg->data, msg->dataLen) != EOK) {
+            LNN_LOGE(LNN_BUILDER, "pack sync info batch fail");
+            break;
+        }
+        offset += SYNC_INFO_BATCH_ITEM_HEAD_LEN + msg->dataLen;
+        ListDelete(&msg->node);
+        ListTailInsert(packed, &msg->node);
+        num++;
+    }
+    *frameLen = offset;
+    return num;
+}
+
+static void SendSyncInfoBatchFromList(SyncChannelInfo *info)
+{
+    uint8_t *frame = (uint8_t *)SoftBusMalloc(MAX_SYNC_INFO_MSG_LEN);
+    if (frame == NULL) {
+        LNN_LOGE(LNN_BUILDER, "malloc sync info batch fail");
+        return;
+    }
+    while (!IsListEmpty(&info->syncMsgList)) {
+        ListNode packed;
+        ListInit(&packed);
+        uint32_t frameLen = 0;
+        uint32_t num = PackSyncInfoBatch(&info->syncMsgList, &packed, frame, &frameLen);
+        if (num < SYNC_INFO_BATCH_MIN_NUM) {
+            // the head either stands alone before an oversized message or is oversized itself
+            if (num != 0) {
+                ListNode *lone = GET_LIST_HEAD(&packed);
+                ListDelete(lone);
+                ListNodeInsert(&info->syncMsgList, lone);
+            }
+            SendSyncInfoMsg(info, LIST_ENTRY(GET_LIST_HEAD(&info->syncMsgList), SyncInfoMsg, node));
+            continue;
+        }
+        LNN_LOGI(LNN_BUILDER, "send sync info batch. num=%{public}u, len=%{public}u", num, frameLen);
+        if (TransSendNetworkingMessage(info->clientChannelId, (char *)frame, frameLen, CONN_HIGH) != SOFTBUS_OK) {
+            LNN_LOGE(LNN_BUILDER, "trans send data fail");
+        }
+        SoftBusGetTime(&info->accessTime);
+        ClearSyncInfoMsg(info, &packed);
+    }
+    SoftBusFree(frame);
+}
+
 static void SendSyncInfoMsgFromList(SyncChannelInfo *info)
 {
     SyncInfoMsg *msg = NULL;
     SyncInfoMsg *msgNext = NULL;
 
+    if (IsSyncInfoBatchSupported(info->networkId)) {
+        SendSyncInfoBatchFromList(info);
+    }
     LIST_FOR_EACH_ENTRY_SAFE(msg, msgNext, &info->syncMsgList, SyncInfoMsg, node) {
         SendSyncInfoMsg(info, msg);
     }
@@ -485,6 +613,41 @@ static void OnChannelClosed(int32_t channelId)
     (void)SoftBusMutexUnlock(&g_syncInfoManager.lock);
 }
 
+static void DispatchSyncInfoBatch(const char *networkId, const uint8_t *data, uint32_t len)
+{
+    uint32_t offset = 0;
+    uint32_t itemLen = 0;
+    int32_t type = 0;
+    LnnSyncInfoMsgHandler handler = NULL;
+
+    while (len - offset > SYNC_INFO_BATCH_ITEM_HEAD_LEN) {
+        if (memcpy_s(&itemLen, sizeof(itemLen), data + offset, SYNC_INFO_BATCH_ITEM_HEAD_LEN) != EOK) {
+            return;
+        }
+        offset += SYNC_INFO_BATCH_ITEM_HEAD_LEN;
+        if (itemLen <= MSG_HEAD_LEN || itemLen > len - offset ||
+            memcpy_s(&type, sizeof(type), data + offset, MSG_HEAD_LEN) != EOK) {
+            LNN_LOGE(LNN_BUILDER, "invalid sync info batch item. len=%{public}u", itemLen);
+            return;
+        }
+        if (type < 0 || type >= LNN_INFO_TYPE_COUNT || type == LNN_INFO_TYPE_BATCH) {
+            LNN_LOGE(LNN_BUILDER, "received batch item is exception, type=%{public}d", type);
+            offset += itemLen;
+            continue;
+        }
+        if (SoftBusMutexLock(&g_syncInfoManager.lock) != SOFTBUS_OK) {
+            LNN_LOGE(LNN_BUILDER, "sync info lock fail");
+            return;
+        }
+        handler = g_syncInfoManager.handlers[type];
+        (void)SoftBusMutexUnlock(&g_syncInfoManager.lock);
+        if (handler != NULL) {
+            handler((LnnSyncInfoType)type, networkId, data + offset + MSG_HEAD_LEN, itemLen - MSG_HEAD_LEN);
+        }
+        offset += itemLen;
+    }
+}
+
 static void OnMessageReceived(int32_t channelId, const char *data, uint32_t len)
 {
     SyncChannelInfo *info = NULL;
@@ -519,7 +682,7 @@ static void OnMessageReceived(int32_t channelId, const char *data, uint32_t len)
         return;
     }
     handler = g_syncInfoManager.handlers[type];
-    if (handler == NULL) {
+    if (handler == NULL && type != LNN_INFO_TYPE_BATCH) {
         (void)SoftBusMutexUnlock(&g_syncInfoManager.lock);
         return;
     }
@@ -530,6 +693,10 @@ static void OnMessageReceived(int32_t channelId, const char *data, uint32_t len)
     }
     SoftBusGetTime(&info->accessTime);
     (void)SoftBusMutexUnlock(&g_syncInfoManager.lock);
+    if (type == LNN_INFO_TYPE_BATCH) {
+        DispatchSyncInfoBatch(networkId, (const uint8_t *)&data[MSG_HEAD_LEN], len - MSG_HEAD_LEN);
+        return;
+    }
     handler(type, networkId, (const uint8_t *)&data[MSG_HEAD_LEN], len - MSG_HEAD_LEN);
 }
 
@@ -911,7 +1078,7 @@ void LnnDeinitSyncInfoManager(void)
 
 int32_t LnnRegSyncInfoHandler(LnnSyncInfoType type, LnnSyncInfoMsgHandler handler)
 {
-    if (type >= LNN_INFO_TYPE_COUNT || handler == NULL) {
+    if (type >= LNN_INFO_TYPE_COUNT || type == LNN_INFO_TYPE_BATCH || handler == NULL) {
         LNN_LOGE(LNN_BUILDER, "invalid sync info hander reg param. type=%{public}d", type);
         return SOFTBUS_INVALID_PARAM;
     }
@@ -1004,7 +1171,7 @@ static int32_t SendSyncInfoByNewChannel(const char *networkId, SyncInfoMsg *msg)
         }
         ListNodeInsert(&g_syncInfoManager.channelInfoList, &info->node);
     } else {
-        ListTailInsert(&item->syncMsgList, &msg->node);
+        EnqueueSyncInfoMsg(item, msg);
         ResetSendSyncInfo(item, info, msg);
         SoftBusFree(info);
     }
@@ -1035,15 +1202,14 @@ static int32_t TrySendSyncInfoMsg(const char *networkId, SyncInfoMsg *msg)
         "send sync info by alread exists channel. channelId=%{public}d, networkId=%{public}s",
         info->clientChannelId, AnonymizeWrapper(anonyNetworkId));
     AnonymizeFree(anonyNetworkId);
-    ListTailInsert(&info->syncMsgList, &msg->node);
     if (info->isClientOpened) {
         SoftBusGetTime(&info->accessTime);
-        ListDelete(&msg->node);
         int32_t id = info->clientChannelId;
         (void)SoftBusMutexUnlock(&g_syncInfoManager.lock);
         SendSyncInfoMsgOnly(networkId, id, msg);
         return SOFTBUS_OK;
     }
+    EnqueueSyncInfoMsg(info, msg);
     (void)SoftBusMutexUnlock(&g_syncInfoManager.lock);
     return SOFTBUS_OK;
 }
@@ -1183,7 +1349,7 @@ int32_t LnnSendSyncInfoMsg(LnnSyncInfoType type, const char *networkId,
     int32_t rc;
 
     LNN_LOGI(LNN_BUILDER, "send sync info msg for type=%{public}d, len=%{public}d", type, len);
-    if (type >= LNN_INFO_TYPE_COUNT || networkId == NULL || msg == NULL) {
+    if (type >= LNN_INFO_TYPE_COUNT || type == LNN_INFO_TYPE_BATCH || networkId == NULL || msg == NULL) {
         LNN_LOGE(LNN_BUILDER, "invalid sync info msg param");
         return SOFTBUS_INVALID_PARAM;
     }
@@ -1205,6 +1371,71 @@ int32_t LnnSendSyncInfoMsg(LnnSyncInfoType type, const char *networkId,
     return rc;
 }
 
+static int32_t SendSharedSyncInfoMsg(const char *networkId, SyncInfoMsg *shared)
+{
+    if (IsNeedSyncByAuth(networkId) && TrySendSyncInfoMsgByAuth(networkId, shared) == SOFTBUS_OK) {
+        return SOFTBUS_OK;
+    }
+    if (SoftBusMutexLock(&g_syncInfoManager.lock) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "send sync info lock fail");
+        return SOFTBUS_LOCK_ERR;
+    }
+    SyncChannelInfo *info = FindSyncChannelInfoByNetworkId(networkId);
+    if (info != NULL && info->clientChannelId != INVALID_CHANNEL_ID && info->isClientOpened) {
+        SoftBusGetTime(&info->accessTime);
+        int32_t id = info->clientChannelId;
+        (void)SoftBusMutexUnlock(&g_syncInfoManager.lock);
+        return TransSendNetworkingMessage(id, (char *)shared->data, shared->dataLen, CONN_HIGH);
+    }
+    (void)SoftBusMutexUnlock(&g_syncInfoManager.lock);
+    SyncInfoMsg *syncMsg = DumpMsgExcludeListNode(shared);
+    if (syncMsg == NULL) {
+        return SOFTBUS_MALLOC_ERR;
+    }
+    ListInit(&syncMsg->node);
+    int32_t rc = TrySendSyncInfoMsg(networkId, syncMsg);
+    if (rc != SOFTBUS_OK) {
+        SoftBusFree(syncMsg);
+    }
+    return rc;
+}
+
+int32_t LnnSendSyncInfoMsgToPeers(LnnSyncInfoType type, const LnnSyncInfoPeerList *peerList,
+    const uint8_t *msg, uint32_t len)
+{
+    if (type >= LNN_INFO_TYPE_COUNT || type == LNN_INFO_TYPE_BATCH || peerList == NULL || msg == NULL ||
+        (peerList->peers == NULL && peerList->peerNum != 0)) {
+        LNN_LOGE(LNN_BUILDER, "invalid sync info msg param");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    SyncInfoMsg *shared = CreateSyncInfoMsg(type, msg, len, NULL);
+    if (shared == NULL) {
+        return SOFTBUS_MEM_ERR;
+    }
+    int32_t ret = SOFTBUS_OK;
+    int32_t sendNum = 0;
+    for (int32_t i = 0; i < peerList->peerNum; i++) {
+        const NodeBasicInfo *peer = &peerList->peers[i];
+        if (peerList->filter != NULL && !peerList->filter(peer, peerList->para)) {
+            continue;
+        }
+        sendNum++;
+        int32_t rc = SendSharedSyncInfoMsg(peer->networkId, shared);
+        if (rc != SOFTBUS_OK) {
+            char *anonyNetworkId = NULL;
+            Anonymize(peer->networkId, &anonyNetworkId);
+            LNN_LOGE(LNN_BUILDER, "send sync info msg fail. type=%{public}d, networkId=%{public}s, rc=%{public}d",
+                type, AnonymizeWrapper(anonyNetworkId), rc);
+            AnonymizeFree(anonyNetworkId);
+            ret = rc;
+        }
+    }
+    SoftBusFree(shared);
+    LNN_LOGI(LNN_BUILDER, "send sync info msg to peers. type=%{public}d, len=%{public}u, peerNum=%{public}d",
+        type, len, sendNum);
+    return ret;
+}
+
 static void FillAuthdataInfo(AuthTransData *dataInfo, char *msg)
 {
     dataInfo->module = MODULE_P2P_NETWORKING_SYNC;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -27,7 +27,7 @@ int32_t LnnSetFeatureCapability(uint64_t *feature, FeatureCapability capaBit)
         LNN_LOGE(LNN_LEDGER, "in para error");
         return SOFTBUS_INVALID_PARAM;
     }
-    *feature = (*feature) | (1 << (uint64_t)capaBit);
+    *feature = (*feature) | ((uint64_t)1 << capaBit);
     return SOFTBUS_OK;
 }
 
@@ -37,13 +37,13 @@ int32_t LnnClearFeatureCapability(uint64_t *feature, FeatureCapability capaBit)
         LNN_LOGE(LNN_LEDGER, "in para error");
         return SOFTBUS_INVALID_PARAM;
     }
-    *feature = (*feature) & (~(1 << (uint64_t)capaBit));
+    *feature = (*feature) & (~((uint64_t)1 << capaBit));
     return SOFTBUS_OK;
 }
 
 bool IsFeatureSupport(uint64_t feature, FeatureCapability capaBit)
 {
-    return ((feature & (1 << (uint64_t)capaBit)) != 0);
+    return ((feature & ((uint64_t)1 << capaBit)) != 0);
 }
 
 uint64_t LnnGetFeatureCapabilty(void)
@@ -84,6 +84,7 @@ uint64_t LnnGetFeatureCapabilty(void)
         LNN_LOGI(LNN_LEDGER, "set feature BIT_SUPPORT_SPARK_GROUP_CAPABILITY configValue=%{public}" PRIu64,
             configValue);
     }
+    LnnSetFeatureCapability(&configValue, BIT_SUPPORT_SYNC_INFO_BATCH);
     LNN_LOGI(LNN_LEDGER, "lnn feature configValue=%{public}" PRIu64, configValue);
     return configValue;
 }
\ No newline at end of file
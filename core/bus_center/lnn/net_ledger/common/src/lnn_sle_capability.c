@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -79,6 +79,12 @@ int32_t SetSleAddrToLocalLedger(void)
     return SOFTBUS_OK;
 }
 
+static bool FilterSleInfoPeer(const NodeBasicInfo *peer, void *para)
+{
+    (void)para;
+    return !LnnIsLSANode(peer);
+}
+
 void LnnSendSleInfoForAllNode(void)
 {
     cJSON *json = cJSON_CreateObject();
@@ -111,19 +117,15 @@ void LnnSendSleInfoForAllNode(void)
         return;
     }
     LNN_LOGI(LNN_BUILDER, "online nodes count=%{public}d", infoNum);
-    for (int32_t i = 0; i < infoNum; ++i) {
-        if (LnnIsLSANode(&info[i])) {
-            continue;
-        }
-        char *anonyNetworkId = NULL;
-        Anonymize(info[i].networkId, &anonyNetworkId);
-        LNN_LOGI(LNN_BUILDER, "sync slecap and slemac to networkId=%{public}s", AnonymizeWrapper(anonyNetworkId));
-        if (LnnSendSyncInfoMsg(LNN_INFO_TYPE_SLE_MAC, info[i].networkId,
-            (const uint8_t *)data, strlen(data) + 1, NULL) != SOFTBUS_OK) {
-            LNN_LOGE(LNN_BUILDER, "sync slecap and slemac failed. networkId=%{public}s",
-                AnonymizeWrapper(anonyNetworkId));
-        }
-        AnonymizeFree(anonyNetworkId);
+    LnnSyncInfoPeerList peerList = {
+        .peers = info,
+        .peerNum = infoNum,
+        .filter = FilterSleInfoPeer,
+        .para = NULL,
+    };
+    if (LnnSendSyncInfoMsgToPeers(LNN_INFO_TYPE_SLE_MAC, &peerList,
+        (const uint8_t *)data, strlen(data) + 1) != SOFTBUS_OK) {
+        LNN_LOGE(LNN_BUILDER, "sync slecap and slemac to some peers failed");
     }
     cJSON_free(data);
     SoftBusFree(info);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -478,11 +478,9 @@ int32_t LnnGetRemoteNodeInfoById(const char *id, IdCategory type, NodeInfo *info
     NodeInfo *nodeInfo = LnnGetNodeInfoById(id, type);
     if (nodeInfo == NULL) {
         (void)SoftBusMutexUnlock(&g_distributedNetLedger.lock);
-        char *anonyId = NULL;
-        Anonymize(id, &anonyId);
+        ANONYMIZE_BUF(anonyId);
         LNN_LOGI(LNN_LEDGER, "can not find target node, id=%{public}s, type=%{public}d",
-            AnonymizeWrapper(anonyId), type);
-        AnonymizeFree(anonyId);
+            ANONYMIZE(anonyId, id), type);
         return SOFTBUS_NETWORK_GET_NODE_INFO_ERR;
     }
     if (memcpy_s(info, sizeof(NodeInfo), nodeInfo, sizeof(NodeInfo)) != EOK) {
@@ -2287,14 +2285,11 @@ int32_t LnnGetOnlineNodeByUdidHash(const char *recvUdidHash, NodeInfo *outNode)
         }
         if (memcmp(shortUdidHash, recvUdidHash, SHORT_UDID_HASH_LEN) == 0 &&
             memcpy_s(outNode, sizeof(NodeInfo), &nodeInfo, sizeof(NodeInfo)) == EOK) {
-            char *anoyUdid = NULL;
-            char *anoyUdidHash = NULL;
-            Anonymize(outNode->deviceInfo.deviceUdid, &anoyUdid);
-            Anonymize((const char *)shortUdidHash, &anoyUdidHash);
+            ANONYMIZE_BUF(anoyUdid);
+            ANONYMIZE_BUF(anoyUdidHash);
             LNN_LOGI(LNN_LEDGER, "node is online. nodeUdid=%{public}s, shortUdidHash=%{public}s",
-                AnonymizeWrapper(anoyUdid), AnonymizeWrapper(anoyUdidHash));
-            AnonymizeFree(anoyUdid);
-            AnonymizeFree(anoyUdidHash);
+                ANONYMIZE(anoyUdid, outNode->deviceInfo.deviceUdid),
+                ANONYMIZE(anoyUdidHash, (const char *)shortUdidHash));
             SoftBusFree(info);
             return SOFTBUS_OK;
         }
@@ -2319,11 +2314,9 @@ void LnnRefreshDeviceOnlineStateAndDevIdInfo(const char *pkgName, DeviceInfo *de
     (void)pkgName;
     RefreshDeviceOnlineStateInfo(device, additions);
     if (device->devId[0] != '\0') {
-        char *anoyUdidHash = NULL;
-        Anonymize(device->devId, &anoyUdidHash);
+        ANONYMIZE_BUF(anoyUdidHash);
         LNN_LOGI(LNN_LEDGER, "device found. medium=%{public}d, udidhash=%{public}s, onlineStatus=%{public}d",
-            additions->medium, AnonymizeWrapper(anoyUdidHash), device->isOnline);
-        AnonymizeFree(anoyUdidHash);
+            additions->medium, ANONYMIZE(anoyUdidHash, device->devId), device->isOnline);
     }
 }
 
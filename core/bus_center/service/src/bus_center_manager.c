@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -30,6 +30,7 @@
 #include "lnn_ohos_account_adapter.h"
 #include "auth_pre_link.h"
 #include "legacy/softbus_adapter_xcollie.h"
+#include "softbus_adapter_mem.h"
 #include "softbus_feature_config.h"
 #include "softbus_permission.h"
 
@@ -298,6 +299,7 @@ int32_t LnnInitLnnLooper(void)
         LNN_LOGE(LNN_LANE, "init laneLooper fail");
         return SOFTBUS_LOOPER_ERR;
     }
+    SetLooperMemModule(looper, SOFTBUS_MEM_MODULE_LNN);
     SetLooper(LOOP_TYPE_LNN, looper);
     LNN_LOGI(LNN_LANE, "init laneLooper success");
     return SOFTBUS_OK;
@@ -319,6 +321,7 @@ int32_t LnnInitLaneLooper(void)
         LNN_LOGE(LNN_LANE, "init lane looper fail");
         return SOFTBUS_LOOPER_ERR;
     }
+    SetLooperMemModule(looper, SOFTBUS_MEM_MODULE_LNN);
     SetLooper(LOOP_TYPE_LANE, looper);
     LNN_LOGI(LNN_LANE, "init laneLooper success");
     return SOFTBUS_OK;
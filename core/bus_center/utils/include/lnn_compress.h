@@ -22,7 +22,15 @@
 extern "C" {
 #endif /* __cplusplus */
 
+typedef enum {
+    COMPRESS_DICT_NONE = 0,
+    COMPRESS_DICT_DEVICE_INFO,
+    COMPRESS_DICT_BUTT,
+} CompressDictType;
+
 int32_t DataCompress(uint8_t *in, uint32_t inLen, uint8_t **out, uint32_t *outLen);
+/* the output of a dictionary type other than COMPRESS_DICT_NONE can only be decompressed by peers that know it */
+int32_t DataCompressWithDict(CompressDictType dictType, uint8_t *in, uint32_t inLen, uint8_t **out, uint32_t *outLen);
 int32_t DataDecompress(uint8_t *in, uint32_t inLen, uint8_t **out, uint32_t *outLen);
 
 #ifdef __cplusplus
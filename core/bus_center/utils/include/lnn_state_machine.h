@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -24,6 +24,11 @@
 extern "C" {
 #endif
 
+typedef struct {
+    uint64_t allocAvoided;
+    uint64_t mergedNum;
+} FsmMsgStats;
+
 int32_t LnnFsmInit(FsmStateMachine *fsm, SoftBusLooper *looper, char *name, FsmDeinitCallback cb);
 int32_t LnnFsmDeinit(FsmStateMachine *fsm);
 
@@ -34,6 +39,12 @@ int32_t LnnFsmStop(FsmStateMachine *fsm);
 
 int32_t LnnFsmPostMessage(FsmStateMachine *fsm, uint32_t msgType, void *data);
 int32_t LnnFsmPostMessageDelay(FsmStateMachine *fsm, uint32_t msgType, void *data, uint64_t delayMillis);
+/* para is copied into the message, the state process func must not free or keep it */
+int32_t LnnFsmPostMessageCopy(FsmStateMachine *fsm, uint32_t msgType, const void *para, uint32_t len,
+    uint64_t delayMillis);
+/* a pending message of a coalescable type is replaced by the next one posted, call it after LnnFsmInit */
+int32_t LnnFsmSetCoalescable(FsmStateMachine *fsm, uint32_t msgType);
+void LnnFsmGetMsgStats(FsmMsgStats *stats);
 
 int32_t LnnFsmRemoveMessageByType(FsmStateMachine *fsm, int32_t what);
 
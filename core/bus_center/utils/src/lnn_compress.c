@@ -15,7 +15,9 @@
 
 #include "lnn_compress.h"
 
+#include <pthread.h>
 #include <securec.h>
+#include <stdbool.h>
 #include <zlib.h>
 
 #include "lnn_log.h"
@@ -24,54 +26,208 @@
 
 #define CHUNK 4096
 #define GZIP_ENCODING 16
+#define AUTO_HEADER_DETECT 32
 #define MAX_WBITS 15
 #define Z_MEM_LEVEL 8
 
-/* compress data by GZIP  */
-int32_t DataCompress(uint8_t *in, uint32_t inLen, uint8_t **out, uint32_t *outLen)
+typedef struct {
+    z_stream deflateStrm[COMPRESS_DICT_BUTT];
+    bool deflateInited[COMPRESS_DICT_BUTT];
+    z_stream inflateStrm;
+    bool inflateInited;
+    bool registered;
+} CompressStreamCache;
+
+/*
+ * built from the device info json: the keys in the order PackCommon emits them, with the most common values
+ * ahead. the dictionary is identified on the wire by its adler32, so never change it in place, add a new type.
+ */
+static const char g_deviceInfoDict[] =
+    "\"00:00:00:00:00:00\",\"OpenHarmony\",\"HarmonyOS\",\"hm.1.0.0\","
+    "\"36##40##44##48##149##153##157##161##165\"\"SW_VERSION\":\"MASTER_UDID\":\"MASTER_WEIGHT\":"
+    "\"NODE_ADDR\":\"DEVICE_NAME\":\"UNIFIED_DEVICE_NAME\":\"UNIFIED_DEFAULT_DEVICE_NAME\":"
+    "\"SETTINGS_NICK_NAME\":\"NETWORK_ID\":\"DEVICE_TYPE\":\"DEVICE_UDID\":\"PRODUCT_ID\":"
+    "\"MODEL_NAME\":\"DEVICE_UUID\":\"VERSION_TYPE\":\"CONN_CAP\":\"NEW_CONN_CAP\":"
+    "\"STATIC_NET_CAP\":\"AUTH_CAP\":\"HB_CAP\":\"NODE_DATA_CHANGE_FLAG\":\"IS_CHARGING\":"
+    "\"BATTERY_LEAVEL\":\"REMAIN_POWER\":\"BLE_P2P\":\"TRANSPORT_PROTOCOL\":\"PKG_VERSION\":"
+    "\"WIFI_VERSION\":\"BLE_VERSION\":\"BT_MAC\":\"BLE_MAC\":\"IS_SCREENON\":\"NODE_WEIGHT\":"
+    "\"ACCOUNT_ID\":\"ACCOUNT_UID\":\"DISTRIBUTED_SWITCH\":\"BLE_TIMESTAMP\":\"WIFI_BUFF_SIZE\":"
+    "\"BR_BUFF_SIZE\":\"FEATURE\":\"CONN_SUB_FEATURE\":\"OS_TYPE\":\"OS_VERSION\":\"DEVICE_VERSION\":"
+    "\"STATE_VERSION\":\"STATE_VERSION_CHANGE_REASON\":\"DEVICE_SECURITY_LEVEL\":"
+    "\"SLE_RANGE_CAP\":\"SLE_MAC\":\"SPARK_CHECK\":\"P2P_ROLE\":\"WIFI_CFG\":\"CHAN_LIST_5G\":"
+    "\"STA_FREQUENCY\":\"P2P_MAC_ADDR\":\"HML_MAC\":\"IRK\":\"PUB_MAC\":\"BROADCAST_CIPHER_KEY\":"
+    "\"BROADCAST_CIPHER_IV\":\"STATIC_CAP\":\"STATIC_CAP_LEN\":\"PTK\":\"USERID_CHECKSUM\":"
+    "\"USERID\":\"AUTH_START_STATE\":\"BLE_CONN_CLOSE_DELAY_TIME\":\"BLE_MAC_REFRESH_SWITCH\":"
+    "\"SERVICE_FIND_CAP\":\"authVersion\":\"EXTDATA\":";
+
+static __thread CompressStreamCache g_streamCache;
+static pthread_key_t g_streamCacheKey;
+static pthread_once_t g_streamCacheOnce = PTHREAD_ONCE_INIT;
+static bool g_streamCacheKeyValid = false;
+
+static void ReleaseStreamCache(void *arg)
 {
-    if ((in == NULL) || (inLen == 0) || (out == NULL) || (outLen == NULL)) {
+    CompressStreamCache *cache = (CompressStreamCache *)arg;
+    if (cache == NULL) {
+        return;
+    }
+    for (int32_t i = 0; i < COMPRESS_DICT_BUTT; i++) {
+        if (cache->deflateInited[i]) {
+            (void)deflateEnd(&cache->deflateStrm[i]);
+            cache->deflateInited[i] = false;
+        }
+    }
+    if (cache->inflateInited) {
+        (void)inflateEnd(&cache->inflateStrm);
+        cache->inflateInited = false;
+    }
+}
+
+static void CreateStreamCacheKey(void)
+{
+    g_streamCacheKeyValid = (pthread_key_create(&g_streamCacheKey, ReleaseStreamCache) == 0);
+}
+
+/* the streams of a thread are kept until the thread exits, then released by the key destructor */
+static bool RegisterStreamCache(void)
+{
+    if (g_streamCache.registered) {
+        return true;
+    }
+    (void)pthread_once(&g_streamCacheOnce, CreateStreamCacheKey);
+    if (!g_streamCacheKeyValid || pthread_setspecific(g_streamCacheKey, &g_streamCache) != 0) {
+        return false;
+    }
+    g_streamCache.registered = true;
+    return true;
+}
+
+static const uint8_t *GetDict(CompressDictType dictType, uint32_t *dictLen)
+{
+    switch (dictType) {
+        case COMPRESS_DICT_DEVICE_INFO:
+            *dictLen = sizeof(g_deviceInfoDict) - 1;
+            return (const uint8_t *)g_deviceInfoDict;
+        default:
+            *dictLen = 0;
+            return NULL;
+    }
+}
+
+static int32_t SetDeflateDict(z_stream *strm, CompressDictType dictType)
+{
+    uint32_t dictLen = 0;
+    const uint8_t *dict = GetDict(dictType, &dictLen);
+    if (dict == NULL) {
+        return Z_OK;
+    }
+    return deflateSetDictionary(strm, dict, dictLen);
+}
+
+static int32_t InitDeflateStream(z_stream *strm, CompressDictType dictType)
+{
+    (void)memset_s(strm, sizeof(z_stream), 0, sizeof(z_stream));
+    strm->zalloc = Z_NULL;
+    strm->zfree = Z_NULL;
+    strm->opaque = Z_NULL;
+    // the preset dictionary needs the zlib header, plain data keeps the gzip header old peers expect
+    int32_t windowBits = (dictType == COMPRESS_DICT_NONE) ? (MAX_WBITS | GZIP_ENCODING) : MAX_WBITS;
+    return deflateInit2(strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, windowBits, Z_MEM_LEVEL, Z_DEFAULT_STRATEGY);
+}
+
+static void PutDeflateStream(z_stream *strm, CompressDictType dictType, bool isCached)
+{
+    if (isCached) {
+        g_streamCache.deflateInited[dictType] = (deflateReset(strm) == Z_OK);
+        if (!g_streamCache.deflateInited[dictType]) {
+            (void)deflateEnd(strm);
+        }
+        return;
+    }
+    (void)deflateEnd(strm);
+}
+
+static int32_t GetDeflateStream(z_stream *local, CompressDictType dictType, z_stream **strm, bool *isCached)
+{
+    *isCached = RegisterStreamCache();
+    *strm = *isCached ? &g_streamCache.deflateStrm[dictType] : local;
+    if (!*isCached || !g_streamCache.deflateInited[dictType]) {
+        int32_t ret = InitDeflateStream(*strm, dictType);
+        if (ret != Z_OK) {
+            LNN_LOGE(LNN_STATE, "deflateInit2 fail, ret=%{public}d", ret);
+            return SOFTBUS_DEFLATE_FAIL;
+        }
+        if (*isCached) {
+            g_streamCache.deflateInited[dictType] = true;
+        }
+    }
+    int32_t ret = SetDeflateDict(*strm, dictType);
+    if (ret != Z_OK) {
+        LNN_LOGE(LNN_STATE, "deflateSetDictionary fail, ret=%{public}d", ret);
+        PutDeflateStream(*strm, dictType, *isCached);
+        return SOFTBUS_DEFLATE_FAIL;
+    }
+    return SOFTBUS_OK;
+}
+
+int32_t DataCompressWithDict(CompressDictType dictType, uint8_t *in, uint32_t inLen, uint8_t **out, uint32_t *outLen)
+{
+    if ((in == NULL) || (inLen == 0) || (out == NULL) || (outLen == NULL) ||
+        (dictType < COMPRESS_DICT_NONE) || (dictType >= COMPRESS_DICT_BUTT)) {
         LNN_LOGE(LNN_STATE, "param invalid");
         return SOFTBUS_INVALID_PARAM;
     }
-    z_stream strm;
-    int32_t ret = SOFTBUS_OK;
     uint32_t tmpLen = compressBound(inLen);
     *out = SoftBusCalloc(tmpLen);
     if (*out == NULL) {
         LNN_LOGE(LNN_STATE, "malloc fail.");
         return SOFTBUS_MALLOC_ERR;
     }
-
-    strm.zalloc = Z_NULL;
-    strm.zfree = Z_NULL;
-    strm.opaque = Z_NULL;
-    ret = deflateInit2(&strm, Z_DEFAULT_COMPRESSION, Z_DEFLATED, MAX_WBITS | GZIP_ENCODING, Z_MEM_LEVEL,
-        Z_DEFAULT_STRATEGY);
-    if (ret != Z_OK) {
+    z_stream local;
+    z_stream *strm = NULL;
+    bool isCached = false;
+    int32_t ret = GetDeflateStream(&local, dictType, &strm, &isCached);
+    if (ret != SOFTBUS_OK) {
         SoftBusFree(*out);
         *out = NULL;
-        LNN_LOGE(LNN_STATE, "deflateInit2 fail, ret=%{public}d", ret);
-        return SOFTBUS_DEFLATE_FAIL;
+        return ret;
     }
-
-    strm.avail_in = inLen;
-    strm.next_in = in;
-    strm.avail_out = tmpLen;
-    strm.next_out = *out;
-    ret = deflate(&strm, Z_FINISH);
+    strm->avail_in = inLen;
+    strm->next_in = in;
+    strm->avail_out = tmpLen;
+    strm->next_out = *out;
+    ret = deflate(strm, Z_FINISH);
     if (ret != Z_STREAM_END) {
-        deflateEnd(&strm);
+        PutDeflateStream(strm, dictType, isCached);
         SoftBusFree(*out);
         *out = NULL;
         LNN_LOGE(LNN_STATE, "deflate fail, ret=%{public}d", ret);
         return SOFTBUS_DEFLATE_FAIL;
     }
-    *outLen = strm.total_out;
-    deflateEnd(&strm);
+    *outLen = strm->total_out;
+    PutDeflateStream(strm, dictType, isCached);
     return SOFTBUS_OK;
 }
 
+int32_t DataCompress(uint8_t *in, uint32_t inLen, uint8_t **out, uint32_t *outLen)
+{
+    return DataCompressWithDict(COMPRESS_DICT_NONE, in, inLen, out, outLen);
+}
+
+/* a zlib stream asks for its preset dictionary by adler32, look it up among the known ones */
+static int32_t SetInflateDict(z_stream *strm)
+{
+    for (int32_t i = COMPRESS_DICT_NONE + 1; i < COMPRESS_DICT_BUTT; i++) {
+        uint32_t dictLen = 0;
+        const uint8_t *dict = GetDict((CompressDictType)i, &dictLen);
+        if (dict != NULL && adler32(adler32(0L, Z_NULL, 0), dict, dictLen) == strm->adler) {
+            return inflateSetDictionary(strm, dict, dictLen);
+        }
+    }
+    LNN_LOGE(LNN_STATE, "unknown dictionary");
+    return Z_DATA_ERROR;
+}
+
 static int32_t PerformInflate(z_stream *strm, uint8_t *in, uint32_t inLen, uint8_t **out, uint32_t *outLen)
 {
     int32_t ret = SOFTBUS_OK;
@@ -107,6 +263,12 @@ static int32_t PerformInflate(z_stream *strm, uint8_t *in, uint32_t inLen, uint8
         }
         strm->next_out = buffer + *outLen;
         ret = inflate(strm, Z_NO_FLUSH);
+        if (ret == Z_NEED_DICT) {
+            ret = SetInflateDict(strm);
+            if (ret == Z_OK) {
+                ret = inflate(strm, Z_NO_FLUSH);
+            }
+        }
         if (ret != Z_OK && ret != Z_STREAM_END) {
             SoftBusFree(buffer);
             LNN_LOGE(LNN_STATE, "inflate fail, ret=%{public}d", ret);
@@ -123,28 +285,43 @@ static int32_t PerformInflate(z_stream *strm, uint8_t *in, uint32_t inLen, uint8
     return SOFTBUS_OK;
 }
 
-/* decompress data by GZIP */
+static int32_t InitInflateStream(z_stream *strm)
+{
+    (void)memset_s(strm, sizeof(z_stream), 0, sizeof(z_stream));
+    strm->zalloc = Z_NULL;
+    strm->zfree = Z_NULL;
+    strm->opaque = Z_NULL;
+    strm->avail_in = 0;
+    strm->next_in = Z_NULL;
+    // accept both the gzip header of plain data and the zlib header of dictionary data
+    return inflateInit2(strm, MAX_WBITS | AUTO_HEADER_DETECT);
+}
+
 int32_t DataDecompress(uint8_t *in, uint32_t inLen, uint8_t **out, uint32_t *outLen)
 {
     if ((in == NULL) || (inLen == 0) || (out == NULL) || (outLen == NULL)) {
         LNN_LOGE(LNN_STATE, "param invalid");
         return SOFTBUS_INVALID_PARAM;
     }
-    z_stream strm;
-    strm.zalloc = Z_NULL;
-    strm.zfree = Z_NULL;
-    strm.opaque = Z_NULL;
-    strm.avail_in = 0;
-    strm.next_in = Z_NULL;
-    int32_t ret = inflateInit2(&strm, MAX_WBITS | GZIP_ENCODING);
-    if (ret != Z_OK) {
-        LNN_LOGE(LNN_STATE, "inflateInit2 fail, ret=%{public}d", ret);
-        return SOFTBUS_INFLATE_FAIL;
+    z_stream local;
+    bool isCached = RegisterStreamCache();
+    z_stream *strm = isCached ? &g_streamCache.inflateStrm : &local;
+    if (!isCached || !g_streamCache.inflateInited) {
+        int32_t ret = InitInflateStream(strm);
+        if (ret != Z_OK) {
+            LNN_LOGE(LNN_STATE, "inflateInit2 fail, ret=%{public}d", ret);
+            return SOFTBUS_INFLATE_FAIL;
+        }
+        g_streamCache.inflateInited = isCached;
     }
-    ret = PerformInflate(&strm, in, inLen, out, outLen);
+    int32_t ret = PerformInflate(strm, in, inLen, out, outLen);
     if (ret != SOFTBUS_OK) {
         LNN_LOGE(LNN_STATE, "performInflate fail, ret=%{public}d", ret);
     }
-    inflateEnd(&strm);
+    if (isCached && inflateReset(strm) == Z_OK) {
+        return ret;
+    }
+    (void)inflateEnd(strm);
+    g_streamCache.inflateInited = false;
     return ret;
-}
\ No newline at end of file
+}
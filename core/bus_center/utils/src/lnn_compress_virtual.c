@@ -23,6 +23,11 @@ int32_t DataCompress(uint8_t *in, uint32_t inLen, uint8_t **out, uint32_t *outLe
     return SOFTBUS_OK;
 }
 
+int32_t DataCompressWithDict(CompressDictType dictType, uint8_t *in, uint32_t inLen, uint8_t **out, uint32_t *outLen)
+{
+    return SOFTBUS_OK;
+}
+
 /* decompress data by GZIP */
 int32_t DataDecompress(uint8_t *in, uint32_t inLen, uint8_t **out, uint32_t *outLen)
 {
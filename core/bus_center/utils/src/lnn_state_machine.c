@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,13 +15,17 @@
 
 #include "lnn_state_machine.h"
 
-
+#include <pthread.h>
 #include <securec.h>
+#include <stddef.h>
 
 #include "lnn_log.h"
 #include "softbus_adapter_mem.h"
 #include "softbus_def.h"
 
+#define FSM_MSG_POOL_MAX_NUM  32
+#define FSM_MSG_OLD_ALLOC_NUM 2
+
 static bool IsDuplicateState(FsmStateMachine *fsm, FsmState *state)
 {
     struct ListNode *item = NULL;
@@ -34,13 +38,75 @@ static bool IsDuplicateState(FsmStateMachine *fsm, FsmState *state)
     return false;
 }
 
-static void FreeFsmHandleMsg(SoftBusMessage *msg)
+/* message, control object and inline parameter are allocated as one block */
+typedef struct FsmHandleMsg {
+    SoftBusMessage msg;
+    FsmCtrlMsgObj ctrlMsgObj;
+    struct FsmHandleMsg *next;
+    union {
+        uint64_t align;
+        uint8_t data[FSM_MSG_INLINE_PARA_LEN];
+    } para;
+} FsmHandleMsg;
+
+typedef struct {
+    int32_t msgType;
+    uint32_t mergedNum;
+} FsmCoalescePara;
+
+static pthread_mutex_t g_fsmMsgPoolLock = PTHREAD_MUTEX_INITIALIZER;
+static FsmHandleMsg *g_fsmMsgPool = NULL;
+static uint32_t g_fsmMsgPoolNum = 0;
+static FsmMsgStats g_fsmMsgStats = { 0 };
+
+static FsmHandleMsg *AllocFsmHandleMsg(uint32_t avoidedNum)
 {
-    if (msg != NULL) {
-        if (msg->obj != NULL) {
-            SoftBusFree(msg->obj);
+    FsmHandleMsg *handleMsg = NULL;
+
+    (void)pthread_mutex_lock(&g_fsmMsgPoolLock);
+    if (g_fsmMsgPool != NULL) {
+        handleMsg = g_fsmMsgPool;
+        g_fsmMsgPool = handleMsg->next;
+        g_fsmMsgPoolNum--;
+    }
+    (void)pthread_mutex_unlock(&g_fsmMsgPoolLock);
+    /* the old path allocated the message and its control object apart */
+    if (handleMsg != NULL) {
+        avoidedNum += FSM_MSG_OLD_ALLOC_NUM;
+    } else {
+        handleMsg = (FsmHandleMsg *)SoftBusMalloc(sizeof(FsmHandleMsg));
+        if (handleMsg == NULL) {
+            return NULL;
         }
-        SoftBusFree(msg);
+        avoidedNum += FSM_MSG_OLD_ALLOC_NUM - 1;
+    }
+    (void)memset_s(handleMsg, offsetof(FsmHandleMsg, para), 0, offsetof(FsmHandleMsg, para));
+    (void)pthread_mutex_lock(&g_fsmMsgPoolLock);
+    g_fsmMsgStats.allocAvoided += avoidedNum;
+    (void)pthread_mutex_unlock(&g_fsmMsgPoolLock);
+    return handleMsg;
+}
+
+static void FreeFsmHandleMsg(SoftBusMessage *msg)
+{
+    if (msg == NULL) {
+        return;
+    }
+    FsmHandleMsg *handleMsg = (FsmHandleMsg *)msg;
+    if (handleMsg->ctrlMsgObj.isParaOwned && handleMsg->ctrlMsgObj.obj != (void *)handleMsg->para.data) {
+        SoftBusFree(handleMsg->ctrlMsgObj.obj);
+    }
+    handleMsg->ctrlMsgObj.obj = NULL;
+    (void)pthread_mutex_lock(&g_fsmMsgPoolLock);
+    if (g_fsmMsgPoolNum < FSM_MSG_POOL_MAX_NUM) {
+        handleMsg->next = g_fsmMsgPool;
+        g_fsmMsgPool = handleMsg;
+        g_fsmMsgPoolNum++;
+        handleMsg = NULL;
+    }
+    (void)pthread_mutex_unlock(&g_fsmMsgPoolLock);
+    if (handleMsg != NULL) {
+        SoftBusFree(handleMsg);
     }
 }
 
@@ -49,41 +115,68 @@ static void FreeFsmHandleMsgObj(FsmCtrlMsgObj *ctrlMsgObj)
     if (ctrlMsgObj == NULL) {
         return;
     }
-    if (ctrlMsgObj->obj != NULL) {
+    /* an owned parameter is released together with its message */
+    if (ctrlMsgObj->obj != NULL && !ctrlMsgObj->isParaOwned) {
         SoftBusFree(ctrlMsgObj->obj);
         ctrlMsgObj->obj = NULL;
     }
 }
 
-static SoftBusMessage *CreateFsmHandleMsg(FsmStateMachine *fsm,
-    int32_t what, uint64_t arg1, uint64_t arg2, void *obj)
+static int32_t CopyFsmHandleMsgPara(FsmHandleMsg *handleMsg, const void *para, uint32_t len)
 {
-    SoftBusMessage *msg = NULL;
-    FsmCtrlMsgObj *ctrlMsgObj = NULL;
+    void *obj = (void *)handleMsg->para.data;
 
-    msg = SoftBusCalloc(sizeof(*msg));
-    if (msg == NULL) {
-        LNN_LOGE(LNN_STATE, "calloc msg failed");
+    if (len > FSM_MSG_INLINE_PARA_LEN) {
+        obj = SoftBusMalloc(len);
+        if (obj == NULL) {
+            LNN_LOGE(LNN_STATE, "malloc msg para failed, len=%{public}u", len);
+            return SOFTBUS_MALLOC_ERR;
+        }
+    }
+    if (memcpy_s(obj, len, para, len) != EOK) {
+        LNN_LOGE(LNN_STATE, "copy msg para failed");
+        if (obj != (void *)handleMsg->para.data) {
+            SoftBusFree(obj);
+        }
+        return SOFTBUS_MEM_ERR;
+    }
+    handleMsg->ctrlMsgObj.obj = obj;
+    handleMsg->ctrlMsgObj.isParaOwned = true;
+    return SOFTBUS_OK;
+}
+
+static SoftBusMessage *CreateFsmHandleMsgWithPara(FsmStateMachine *fsm,
+    int32_t what, uint64_t arg1, uint64_t arg2, void *obj, const void *para, uint32_t len)
+{
+    bool isCopyPara = (para != NULL && len != 0);
+    /* the old path also allocated a copy of the parameter before posting */
+    FsmHandleMsg *handleMsg = AllocFsmHandleMsg((isCopyPara && len <= FSM_MSG_INLINE_PARA_LEN) ? 1 : 0);
+    if (handleMsg == NULL) {
+        LNN_LOGE(LNN_STATE, "malloc msg failed");
         return NULL;
     }
+    SoftBusMessage *msg = &handleMsg->msg;
     msg->what = what;
     msg->arg1 = arg1;
     msg->arg2 = arg2;
     msg->handler = &fsm->handler;
     msg->FreeMessage = FreeFsmHandleMsg;
-
-    ctrlMsgObj = SoftBusMalloc(sizeof(*ctrlMsgObj));
-    if (ctrlMsgObj == NULL) {
-        LNN_LOGE(LNN_STATE, "calloc ctrl msg obj failed");
-        SoftBusFree(msg);
+    handleMsg->ctrlMsgObj.fsm = fsm;
+    handleMsg->ctrlMsgObj.obj = obj;
+    if (isCopyPara && CopyFsmHandleMsgPara(handleMsg, para, len) != SOFTBUS_OK) {
+        FreeFsmHandleMsg(msg);
         return NULL;
     }
-    ctrlMsgObj->fsm = fsm;
-    ctrlMsgObj->obj = obj;
-    msg->obj = ctrlMsgObj;
+    msg->obj = &handleMsg->ctrlMsgObj;
     return msg;
 }
 
+static SoftBusMessage *CreateFsmHandleMsg(FsmStateMachine *fsm,
+    int32_t what, uint64_t arg1, uint64_t arg2, void *obj)
+{
+    return CreateFsmHandleMsgWithPara(fsm, what, arg1, arg2, obj, NULL, 0);
+}
+
 static void ProcessStartMessage(SoftBusMessage *msg)
 {
     FsmCtrlMsgObj *ctrlMsgObj = msg->obj;
@@ -252,6 +345,43 @@ static int32_t RemoveMessageFunc(const SoftBusMessage *msg, void *para)
     return 1;
 }
 
+/* remove message when return 0, else return 1 */
+static int32_t CoalesceMessageFunc(const SoftBusMessage *msg, void *para)
+{
+    FsmCoalescePara *coalescePara = (FsmCoalescePara *)para;
+
+    if (msg == NULL || coalescePara == NULL) {
+        return 1;
+    }
+    if (msg->what == FSM_CTRL_MSG_DATA && (int32_t)msg->arg1 == coalescePara->msgType) {
+        FreeFsmHandleMsgObj((FsmCtrlMsgObj *)msg->obj);
+        coalescePara->mergedNum++;
+        return 0;
+    }
+    return 1;
+}
+
+/* drop the pending message of a coalescable type, the one about to be posted takes its place */
+static void CoalescePendingMessage(FsmStateMachine *fsm, uint32_t msgType)
+{
+    if (msgType >= FSM_MSG_COALESCE_TYPE_MAX || (fsm->coalesceMask & (1U << msgType)) == 0 ||
+        fsm->looper->RemoveMessageCustom == NULL) {
+        return;
+    }
+    FsmCoalescePara coalescePara = {
+        .msgType = (int32_t)msgType,
+        .mergedNum = 0,
+    };
+    fsm->looper->RemoveMessageCustom(fsm->looper, &fsm->handler, CoalesceMessageFunc, &coalescePara);
+    if (coalescePara.mergedNum == 0) {
+        return;
+    }
+    LNN_LOGD(LNN_STATE, "merge fsm data msgType=%{public}u, num=%{public}u", msgType, coalescePara.mergedNum);
+    (void)pthread_mutex_lock(&g_fsmMsgPoolLock);
+    g_fsmMsgStats.mergedNum += coalescePara.mergedNum;
+    (void)pthread_mutex_unlock(&g_fsmMsgPoolLock);
+}
+
 int32_t LnnFsmInit(FsmStateMachine *fsm, SoftBusLooper *looper, char *name, FsmDeinitCallback cb)
 {
     if (fsm == NULL || name == NULL) {
@@ -316,9 +446,22 @@ int32_t LnnFsmPostMessage(FsmStateMachine *fsm, uint32_t msgType, void *data)
     if (fsm == NULL || fsm->looper == NULL) {
         return SOFTBUS_INVALID_PARAM;
     }
+    CoalescePendingMessage(fsm, msgType);
     return PostMessageToFsm(fsm, FSM_CTRL_MSG_DATA, msgType, 0, data);
 }
 
+static int32_t PostDelayMessageToFsm(FsmStateMachine *fsm, SoftBusMessage *msg, uint64_t delayMillis)
+{
+    if (fsm->looper->PostMessageDelay == NULL) {
+        LNN_LOGE(LNN_STATE, "PostMessageDelay is null");
+        FreeFsmHandleMsg(msg);
+        return SOFTBUS_INVALID_PARAM;
+    }
+    CoalescePendingMessage(fsm, (uint32_t)msg->arg1);
+    fsm->looper->PostMessageDelay(fsm->looper, msg, delayMillis);
+    return SOFTBUS_OK;
+}
+
 int32_t LnnFsmPostMessageDelay(FsmStateMachine *fsm, uint32_t msgType,
     void *data, uint64_t delayMillis)
 {
@@ -332,15 +475,44 @@ int32_t LnnFsmPostMessageDelay(FsmStateMachine *fsm, uint32_t msgType,
         LNN_LOGE(LNN_STATE, "create fsm handle msg fail");
         return SOFTBUS_MALLOC_ERR;
     }
-    if (fsm->looper->PostMessageDelay == NULL) {
-        LNN_LOGE(LNN_STATE, "PostMessageDelay is null");
-        FreeFsmHandleMsg(msg);
+    return PostDelayMessageToFsm(fsm, msg, delayMillis);
+}
+
+int32_t LnnFsmPostMessageCopy(FsmStateMachine *fsm, uint32_t msgType, const void *para, uint32_t len,
+    uint64_t delayMillis)
+{
+    SoftBusMessage *msg = NULL;
+
+    if (fsm == NULL || fsm->looper == NULL) {
         return SOFTBUS_INVALID_PARAM;
     }
-    fsm->looper->PostMessageDelay(fsm->looper, msg, delayMillis);
+    msg = CreateFsmHandleMsgWithPara(fsm, FSM_CTRL_MSG_DATA, msgType, 0, NULL, para, len);
+    if (msg == NULL) {
+        LNN_LOGE(LNN_STATE, "create fsm handle msg fail");
+        return SOFTBUS_MALLOC_ERR;
+    }
+    return PostDelayMessageToFsm(fsm, msg, delayMillis);
+}
+
+int32_t LnnFsmSetCoalescable(FsmStateMachine *fsm, uint32_t msgType)
+{
+    if (fsm == NULL || msgType >= FSM_MSG_COALESCE_TYPE_MAX) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    fsm->coalesceMask |= (1U << msgType);
     return SOFTBUS_OK;
 }
 
+void LnnFsmGetMsgStats(FsmMsgStats *stats)
+{
+    if (stats == NULL) {
+        return;
+    }
+    (void)pthread_mutex_lock(&g_fsmMsgPoolLock);
+    *stats = g_fsmMsgStats;
+    (void)pthread_mutex_unlock(&g_fsmMsgPoolLock);
+}
+
 int32_t LnnFsmRemoveMessageByType(FsmStateMachine *fsm, int32_t what)
 {
     if (fsm == NULL || fsm->looper == NULL || fsm->looper->RemoveMessage == NULL) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -33,6 +33,7 @@ struct SoftBusLooper {
     SoftBusLooperContext *context;
     MsgQueue *queue;
     bool dumpable;
+    int32_t memModule; // SoftBusMemModule the messages of this looper allocate as
     void (*PostMessage)(const SoftBusLooper *looper, SoftBusMessage *msg);
     void (*PostMessageDelay)(const SoftBusLooper *looper, SoftBusMessage *msg, uint64_t delayMillis);
     void (*RemoveMessage)(const SoftBusLooper *looper, const SoftBusHandler *handler, int32_t what);
@@ -85,6 +86,8 @@ void DestroyLooper(SoftBusLooper *looper);
 
 void SetLooperDumpable(SoftBusLooper *looper, bool dumpable);
 
+void SetLooperMemModule(SoftBusLooper *looper, int32_t memModule);
+
 #ifdef __cplusplus
 }
 #endif
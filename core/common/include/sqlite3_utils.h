@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -38,17 +38,26 @@ extern "C" {
 #define LNN_DEFAULT_USERID 100
 #define LNN_INT32_NUM_STR_MAX_LEN 11
 
+typedef enum {
+    TABLE_TRUSTED_DEV_INFO,
+    TABLE_NAME_ID_MAX,
+} TableNameID;
+
+/* statements kept prepared per table for the lifetime of a {@link DbContext} */
+typedef enum {
+    DB_STMT_INSERT = 0,
+    DB_STMT_SEARCH_BY_KEY,
+    DB_STMT_REMOVE_BY_KEY,
+    DB_STMT_TYPE_MAX,
+} DbStmtType;
+
 typedef struct {
     sqlite3 *db;
     sqlite3_stmt *stmt;
     uint32_t state;
+    sqlite3_stmt *stmtCache[TABLE_NAME_ID_MAX][DB_STMT_TYPE_MAX];
 } DbContext;
 
-typedef enum {
-    TABLE_TRUSTED_DEV_INFO,
-    TABLE_NAME_ID_MAX,
-} TableNameID;
-
 typedef struct {
     char accountHexHash[SHA_256_HEX_HASH_LEN + LNN_INT32_NUM_STR_MAX_LEN + 1];
     char udid[UDID_BUF_LEN];
@@ -74,10 +83,19 @@ int32_t RemoveAllRecord(DbContext *ctx, TableNameID id);
 int32_t GetRecordNumByKey(DbContext *ctx, TableNameID id, uint8_t *data);
 int32_t QueryRecordByKey(DbContext *ctx, TableNameID id, uint8_t *data, uint8_t **replyInfo, int infoNum);
 
+/*
+ * data points to num records of the table, e.g. {@link TrustedDevInfoRecord}. All rows go in one transaction
+ * which is rolled back if any row fails; inside a transaction opened by the caller, the caller closes it.
+ */
+int32_t InsertRecords(DbContext *ctx, TableNameID id, uint8_t *data, uint32_t num);
+int32_t RemoveRecordsByKey(DbContext *ctx, TableNameID id, uint8_t *data, uint32_t num);
+
 int32_t OpenTransaction(DbContext *ctx);
 int32_t CloseTransaction(DbContext *ctx, CloseTransactionType type);
 int32_t EncryptedDb(DbContext *ctx, const uint8_t *password, uint32_t len);
 int32_t UpdateDbPassword(DbContext *ctx, const uint8_t *password, uint32_t len);
+/* switch the journal to WAL so readers do not block the writer; call after {@link EncryptedDb} if any */
+int32_t EnableDbWalMode(DbContext *ctx);
 
 int32_t BindParaInt(DbContext *ctx, int32_t idx, int32_t value);
 int32_t BindParaInt64(DbContext *ctx, int32_t idx, int64_t value);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -166,6 +166,8 @@ static void *LoopTask(void *arg)
                 "LoopTask HandleMessage message. name=%{public}s, handle=%{public}s, what=%{public}" PRId32,
                 context->name, msg->handler ? msg->handler->name : "null", msg->what);
         }
+        // the looper thread only runs this looper, its allocations are all counted to the looper module
+        (void)SoftBusSetMemModule((SoftBusMemModule)looper->memModule);
         (void)SoftBusMutexUnlock(&context->lock);
 
         if (msg->handler != NULL && msg->handler->HandleMessage != NULL) {
@@ -436,6 +438,22 @@ void SetLooperDumpable(SoftBusLooper *looper, bool dumpable)
     (void)SoftBusMutexUnlock(&looper->context->lock);
 }
 
+void SetLooperMemModule(SoftBusLooper *looper, int32_t memModule)
+{
+    if (looper == NULL || looper->context == NULL) {
+        COMM_LOGE(COMM_UTILS, "looper param is invalid");
+        return;
+    }
+
+    if (SoftBusMutexLock(&looper->context->lock) != SOFTBUS_OK) {
+        COMM_LOGE(COMM_UTILS, "lock looper context failed.");
+        return;
+    }
+
+    looper->memModule = memModule;
+    (void)SoftBusMutexUnlock(&looper->context->lock);
+}
+
 SoftBusLooper *CreateNewLooper(const char *name)
 {
     if (g_looperCnt >= MAX_LOOPER_CNT) {
@@ -594,6 +612,7 @@ int LooperInit(void)
         COMM_LOGE(COMM_UTILS, "init connection looper fail.");
         return SOFTBUS_ERR;
     }
+    SetLooperMemModule(connLooper, SOFTBUS_MEM_MODULE_CONN);
     SetLooper(LOOP_TYPE_CONN, connLooper);
 
     COMM_LOGD(COMM_UTILS, "init looper success.");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -263,7 +263,10 @@ static int32_t SubmitMsgToFfrt(SoftBusMessageNode *msgNode, const SoftBusLooper
         SoftBusMessage *currentMsg = currentMsgNode->msg;
         if (currentMsg->handler != nullptr && currentMsg->handler->HandleMessage != nullptr) {
             DumpMsgInfo(currentMsg);
+            // ffrt workers are shared by all loopers, so the module is only set around the handler
+            SoftBusMemModule prevModule = SoftBusSetMemModule(static_cast<SoftBusMemModule>(looper->memModule));
             currentMsg->handler->HandleMessage(currentMsg);
+            (void)SoftBusSetMemModule(prevModule);
         } else {
             COMM_LOGE(COMM_UTILS, "handler is null when handle msg, name=%{public}s", looper->context->name);
         }
@@ -493,6 +496,17 @@ void SetLooperDumpable(SoftBusLooper *looper, bool dumpable)
     looper->dumpable = dumpable;
     looper->context->mtx->unlock();
 }
+
+void SetLooperMemModule(SoftBusLooper *looper, int32_t memModule)
+{
+    if (looper == nullptr || looper->context == nullptr) {
+        COMM_LOGE(COMM_UTILS, "looper param is invalid");
+        return;
+    }
+    looper->context->mtx->lock();
+    looper->memModule = memModule;
+    looper->context->mtx->unlock();
+}
 /* create new ffrt queue depend on create new context success */
 static int32_t CreateNewFfrtQueue(FfrtMsgQueue **ffrtQueue, const char *name, const SoftBusLooperContext *context)
 {
@@ -652,6 +666,7 @@ int LooperInit(void)
         COMM_LOGE(COMM_UTILS, "init connection looper fail.");
         return SOFTBUS_LOOPER_ERR;
     }
+    SetLooperMemModule(connLooper, SOFTBUS_MEM_MODULE_CONN);
     SetLooper(LOOP_TYPE_CONN, connLooper);
 
     COMM_LOGD(COMM_UTILS, "init looper success.");
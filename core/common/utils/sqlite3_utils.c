@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -27,6 +27,7 @@
 /* The index of database context state */
 #define DB_STATE_QUERYING    (0x1)
 #define DB_STATE_TRANSACTION (0x1 << 1)
+#define DB_STATE_CACHED_STMT (0x1 << 2)
 
 typedef int32_t (*BindParaCb)(DbContext *ctx, int32_t paraNum, uint8_t *data);
 typedef int32_t (*QueryDataCb)(DbContext *ctx, uint8_t *data, int32_t idx);
@@ -37,6 +38,7 @@ typedef struct {
     const char *sqlForInsert;
     const char *sqlForSearchByKey;
     const char *sqlForRemoveByKey;
+    uint32_t recordSize;
     BindParaCb insertCb;
     BindParaCb searchCb;
     BindParaCb removeCb;
@@ -50,6 +52,9 @@ typedef struct {
 #define SQL_COMMIT_TRANSACTION    "COMMIT TRANSACTION"
 #define SQL_ROLLBACK_TRANSACTION  "ROLLBACK TRANSACTION"
 #define SQL_SEARCH_IF_TABLE_EXIST "SELECT * FROM sqlite_master WHERE type ='table' AND name = '%s'"
+#define SQL_ENABLE_WAL_MODE       "PRAGMA journal_mode=WAL"
+#define JOURNAL_MODE_WAL          "wal"
+#define JOURNAL_MODE_LEN          16
 
 /**
  * @brief The SQL statement of TrustedDeviceInfo table.
@@ -80,6 +85,7 @@ static SqliteManager g_sqliteMgr[TABLE_NAME_ID_MAX] = {
         .sqlForInsert = SQL_INSERT_TRUSTED_DEV_INFO,
         .sqlForSearchByKey = SQL_SEARCH_TRUSTED_DEV_INFO_BY_ID,
         .sqlForRemoveByKey = SQL_REMOVE_TRUSTED_DEV_INFO_BY_ID,
+        .recordSize = sizeof(TrustedDevInfoRecord),
         .insertCb = BindInsertTrustedDevInfoCb,
         .searchCb = BindSelectTrustedDevInfoCb,
         .removeCb = BindInsertTrustedDevInfoCb,
@@ -126,20 +132,55 @@ static int32_t BindSelectTrustedDevInfoCb(DbContext *ctx, int32_t paraNum, uint8
     return BindParaText(ctx, idx, (char *)data, strlen((char *)data));
 }
 
-static int32_t ExecuteSql(DbContext *ctx, const char *sql, uint32_t len, BindParaCb cb, uint8_t *data)
+/* cached statements go back to the cache reset and unbound, others are finalized */
+static void ReleaseStmt(DbContext *ctx)
 {
-    int32_t paraNum;
-    int32_t rc;
+    if ((ctx->state & DB_STATE_CACHED_STMT) != 0) {
+        (void)sqlite3_reset(ctx->stmt);
+        (void)sqlite3_clear_bindings(ctx->stmt);
+        ctx->state &= ~DB_STATE_CACHED_STMT;
+    } else {
+        (void)sqlite3_finalize(ctx->stmt);
+    }
+    ctx->stmt = NULL;
+}
 
-    if (sql == NULL || sql[0] == '\0') {
-        COMM_LOGE(COMM_UTILS, "execute sql get invalid param");
-        return SQLITE_ERROR;
+static void FinalizeCachedStmt(DbContext *ctx, TableNameID id)
+{
+    for (int32_t type = 0; type < DB_STMT_TYPE_MAX; type++) {
+        if (ctx->stmtCache[id][type] != NULL) {
+            (void)sqlite3_finalize(ctx->stmtCache[id][type]);
+            ctx->stmtCache[id][type] = NULL;
+        }
     }
-    rc = sqlite3_prepare_v2(ctx->db, sql, len, &ctx->stmt, NULL);
-    if (rc != SQLITE_OK || ctx->stmt == NULL) {
-        COMM_LOGE(COMM_UTILS, "sqlite3_prepare_v2 failed, errmsg=%{public}s", sqlite3_errmsg(ctx->db));
-        return sqlite3_errcode(ctx->db);
+}
+
+static void FinalizeAllCachedStmt(DbContext *ctx)
+{
+    for (int32_t id = 0; id < TABLE_NAME_ID_MAX; id++) {
+        FinalizeCachedStmt(ctx, (TableNameID)id);
     }
+}
+
+static const char *GetCachedStmtSql(TableNameID id, DbStmtType type)
+{
+    switch (type) {
+        case DB_STMT_INSERT:
+            return g_sqliteMgr[id].sqlForInsert;
+        case DB_STMT_SEARCH_BY_KEY:
+            return g_sqliteMgr[id].sqlForSearchByKey;
+        case DB_STMT_REMOVE_BY_KEY:
+            return g_sqliteMgr[id].sqlForRemoveByKey;
+        default:
+            return NULL;
+    }
+}
+
+static int32_t StepSql(DbContext *ctx, BindParaCb cb, uint8_t *data)
+{
+    int32_t paraNum;
+    int32_t rc;
+
     paraNum = sqlite3_bind_parameter_count(ctx->stmt);
     if (paraNum <= 0) {
         rc = sqlite3_step(ctx->stmt);
@@ -150,15 +191,13 @@ static int32_t ExecuteSql(DbContext *ctx, const char *sql, uint32_t len, BindPar
     }
     if (cb == NULL) {
         COMM_LOGE(COMM_UTILS, "need cd for binding parameter");
-        (void)sqlite3_finalize(ctx->stmt);
-        ctx->stmt = NULL;
+        ReleaseStmt(ctx);
         return SQLITE_ERROR;
     }
     rc = cb(ctx, paraNum, data);
     if (rc != SQLITE_OK) {
         COMM_LOGE(COMM_UTILS, "binding parameter cd fail");
-        (void)sqlite3_finalize(ctx->stmt);
-        ctx->stmt = NULL;
+        ReleaseStmt(ctx);
         return sqlite3_errcode(ctx->db);
     }
     rc = sqlite3_step(ctx->stmt);
@@ -168,14 +207,53 @@ static int32_t ExecuteSql(DbContext *ctx, const char *sql, uint32_t len, BindPar
     return rc;
 }
 
-static int32_t QueryData(DbContext *ctx, const char *sql, uint32_t len, BindParaCb cb, uint8_t *data)
+static int32_t ExecuteSql(DbContext *ctx, const char *sql, uint32_t len, BindParaCb cb, uint8_t *data)
+{
+    int32_t rc;
+
+    if (sql == NULL || sql[0] == '\0') {
+        COMM_LOGE(COMM_UTILS, "execute sql get invalid param");
+        return SQLITE_ERROR;
+    }
+    rc = sqlite3_prepare_v2(ctx->db, sql, len, &ctx->stmt, NULL);
+    if (rc != SQLITE_OK || ctx->stmt == NULL) {
+        COMM_LOGE(COMM_UTILS, "sqlite3_prepare_v2 failed, errmsg=%{public}s", sqlite3_errmsg(ctx->db));
+        return sqlite3_errcode(ctx->db);
+    }
+    return StepSql(ctx, cb, data);
+}
+
+/* the statement is compiled on first use and then only reset and rebound until the table or database goes */
+static int32_t ExecuteCachedSql(DbContext *ctx, TableNameID id, DbStmtType type, BindParaCb cb, uint8_t *data)
 {
     int32_t rc;
+    sqlite3_stmt **cache = &ctx->stmtCache[id][type];
 
-    rc = ExecuteSql(ctx, sql, len, cb, data);
+    if (*cache == NULL) {
+        const char *sql = GetCachedStmtSql(id, type);
+        if (sql == NULL || sql[0] == '\0') {
+            COMM_LOGE(COMM_UTILS, "execute cached sql get invalid param");
+            return SQLITE_ERROR;
+        }
+        rc = sqlite3_prepare_v2(ctx->db, sql, strlen(sql), cache, NULL);
+        if (rc != SQLITE_OK || *cache == NULL) {
+            COMM_LOGE(COMM_UTILS, "sqlite3_prepare_v2 failed, errmsg=%{public}s", sqlite3_errmsg(ctx->db));
+            *cache = NULL;
+            return sqlite3_errcode(ctx->db);
+        }
+    }
+    ctx->stmt = *cache;
+    ctx->state |= DB_STATE_CACHED_STMT;
+    return StepSql(ctx, cb, data);
+}
+
+static int32_t QueryData(DbContext *ctx, TableNameID id, DbStmtType type, BindParaCb cb, uint8_t *data)
+{
+    int32_t rc;
+
+    rc = ExecuteCachedSql(ctx, id, type, cb, data);
     if (rc != SQLITE_ROW) {
-        (void)sqlite3_finalize(ctx->stmt);
-        ctx->stmt = NULL;
+        ReleaseStmt(ctx);
     } else {
         ctx->state |= DB_STATE_QUERYING;
     }
@@ -190,8 +268,7 @@ static int32_t QueryDataNext(DbContext *ctx)
     rc = sqlite3_step(ctx->stmt);
     if (rc != SQLITE_ROW) {
         ctx->state &= ~DB_STATE_QUERYING;
-        (void)sqlite3_finalize(ctx->stmt);
-        ctx->stmt = NULL;
+        ReleaseStmt(ctx);
     }
     COMM_LOGD(COMM_UTILS, "QueryDataNext done, state=%{public}d", ctx->state);
     return rc;
@@ -257,6 +334,7 @@ int32_t CloseDatabase(DbContext *ctx)
         COMM_LOGE(COMM_UTILS, "invalid parameters");
         return SOFTBUS_INVALID_PARAM;
     }
+    FinalizeAllCachedStmt(ctx);
     (void)sqlite3_close_v2(ctx->db);
     SoftBusFree(ctx);
     return SOFTBUS_OK;
@@ -298,6 +376,7 @@ int32_t DeleteTable(DbContext *ctx, TableNameID id)
         COMM_LOGE(COMM_UTILS, "sprintf_s sql fail");
         return SOFTBUS_ERR;
     }
+    FinalizeCachedStmt(ctx, id);
     rc = ExecuteSql(ctx, sql, strlen(sql), NULL, NULL);
     if (rc != SQLITE_DONE) {
         COMM_LOGE(COMM_UTILS, "delete table fail");
@@ -305,8 +384,7 @@ int32_t DeleteTable(DbContext *ctx, TableNameID id)
     } else {
         rc = SOFTBUS_OK;
     }
-    (void)sqlite3_finalize(ctx->stmt);
-    ctx->stmt = NULL;
+    ReleaseStmt(ctx);
     return rc;
 }
 
@@ -329,8 +407,7 @@ int32_t CheckTableExist(DbContext *ctx, TableNameID id, bool *isExist)
     if (rc == SQLITE_ROW && sqlite3_column_count(ctx->stmt) != 0) {
         *isExist = true;
     }
-    (void)sqlite3_finalize(ctx->stmt);
-    ctx->stmt = NULL;
+    ReleaseStmt(ctx);
     return SOFTBUS_OK;
 }
 
@@ -342,16 +419,14 @@ int32_t InsertRecord(DbContext *ctx, TableNameID id, uint8_t *data)
         COMM_LOGE(COMM_UTILS, "invalid parameters");
         return SOFTBUS_INVALID_PARAM;
     }
-    rc = ExecuteSql(
-        ctx, g_sqliteMgr[id].sqlForInsert, strlen(g_sqliteMgr[id].sqlForInsert), g_sqliteMgr[id].insertCb, data);
+    rc = ExecuteCachedSql(ctx, id, DB_STMT_INSERT, g_sqliteMgr[id].insertCb, data);
     if (rc != SQLITE_DONE) {
         COMM_LOGE(COMM_UTILS, "insert data failed");
         rc = SOFTBUS_ERR;
     } else {
         rc = SOFTBUS_OK;
     }
-    (void)sqlite3_finalize(ctx->stmt);
-    ctx->stmt = NULL;
+    ReleaseStmt(ctx);
     COMM_LOGD(COMM_UTILS, "insert data done");
     return rc;
 }
@@ -364,20 +439,71 @@ int32_t RemoveRecordByKey(DbContext *ctx, TableNameID id, uint8_t *data)
         COMM_LOGE(COMM_UTILS, "invalid parameters");
         return SOFTBUS_INVALID_PARAM;
     }
-    rc = ExecuteSql(ctx, g_sqliteMgr[id].sqlForRemoveByKey, strlen(g_sqliteMgr[id].sqlForRemoveByKey),
-        g_sqliteMgr[id].removeCb, data);
+    rc = ExecuteCachedSql(ctx, id, DB_STMT_REMOVE_BY_KEY, g_sqliteMgr[id].removeCb, data);
     if (rc != SQLITE_DONE) {
         COMM_LOGE(COMM_UTILS, "remove data failed");
         rc = SOFTBUS_ERR;
     } else {
         rc = SOFTBUS_OK;
     }
-    (void)sqlite3_finalize(ctx->stmt);
-    ctx->stmt = NULL;
+    ReleaseStmt(ctx);
     COMM_LOGD(COMM_UTILS, "remove data done");
     return rc;
 }
 
+static int32_t ExecuteBatchRecords(DbContext *ctx, TableNameID id, DbStmtType type, uint8_t *data, uint32_t num)
+{
+    int32_t rc;
+    int32_t ret = SOFTBUS_OK;
+    BindParaCb cb = (type == DB_STMT_INSERT) ? g_sqliteMgr[id].insertCb : g_sqliteMgr[id].removeCb;
+    bool isOwnTransaction = (ctx->state & DB_STATE_TRANSACTION) == 0;
+
+    if (isOwnTransaction && OpenTransaction(ctx) != SOFTBUS_OK) {
+        COMM_LOGE(COMM_UTILS, "open batch transaction failed");
+        return SOFTBUS_ERR;
+    }
+    for (uint32_t i = 0; i < num; i++) {
+        rc = ExecuteCachedSql(ctx, id, type, cb, data + (size_t)i * g_sqliteMgr[id].recordSize);
+        ReleaseStmt(ctx);
+        if (rc != SQLITE_DONE) {
+            COMM_LOGE(COMM_UTILS, "batch execute failed, index=%{public}u, num=%{public}u", i, num);
+            ret = SOFTBUS_ERR;
+            break;
+        }
+    }
+    if (!isOwnTransaction) {
+        return ret;
+    }
+    rc = CloseTransaction(ctx, ret == SOFTBUS_OK ? CLOSE_TRANS_COMMIT : CLOSE_TRANS_ROLLBACK);
+    return ret == SOFTBUS_OK ? rc : ret;
+}
+
+int32_t InsertRecords(DbContext *ctx, TableNameID id, uint8_t *data, uint32_t num)
+{
+    int32_t rc;
+
+    if (!CheckDbContextParam(ctx) || data == NULL || num == 0) {
+        COMM_LOGE(COMM_UTILS, "invalid parameters");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    rc = ExecuteBatchRecords(ctx, id, DB_STMT_INSERT, data, num);
+    COMM_LOGD(COMM_UTILS, "insert batch data done, num=%{public}u", num);
+    return rc;
+}
+
+int32_t RemoveRecordsByKey(DbContext *ctx, TableNameID id, uint8_t *data, uint32_t num)
+{
+    int32_t rc;
+
+    if (!CheckDbContextParam(ctx) || data == NULL || num == 0) {
+        COMM_LOGE(COMM_UTILS, "invalid parameters");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    rc = ExecuteBatchRecords(ctx, id, DB_STMT_REMOVE_BY_KEY, data, num);
+    COMM_LOGD(COMM_UTILS, "remove batch data done, num=%{public}u", num);
+    return rc;
+}
+
 int32_t RemoveAllRecord(DbContext *ctx, TableNameID id)
 {
     int32_t rc;
@@ -399,8 +525,7 @@ int32_t RemoveAllRecord(DbContext *ctx, TableNameID id)
     } else {
         rc = SOFTBUS_OK;
     }
-    (void)sqlite3_finalize(ctx->stmt);
-    ctx->stmt = NULL;
+    ReleaseStmt(ctx);
     COMM_LOGD(COMM_UTILS, "remove data done");
     return rc;
 }
@@ -414,8 +539,7 @@ int32_t GetRecordNumByKey(DbContext *ctx, TableNameID id, uint8_t *data)
         COMM_LOGE(COMM_UTILS, "invalid parameters");
         return 0;
     }
-    rc = QueryData(ctx, g_sqliteMgr[id].sqlForSearchByKey, strlen(g_sqliteMgr[id].sqlForSearchByKey),
-        g_sqliteMgr[id].searchCb, data);
+    rc = QueryData(ctx, id, DB_STMT_SEARCH_BY_KEY, g_sqliteMgr[id].searchCb, data);
     if (rc != SQLITE_ROW) {
         COMM_LOGE(COMM_UTILS, "find no match data");
         return 0;
@@ -441,8 +565,7 @@ int32_t QueryRecordByKey(DbContext *ctx, TableNameID id, uint8_t *data,
         COMM_LOGE(COMM_UTILS, "invalid parameters");
         return SOFTBUS_INVALID_PARAM;
     }
-    rc = QueryData(ctx, g_sqliteMgr[id].sqlForSearchByKey, strlen(g_sqliteMgr[id].sqlForSearchByKey),
-        g_sqliteMgr[id].searchCb, data);
+    rc = QueryData(ctx, id, DB_STMT_SEARCH_BY_KEY, g_sqliteMgr[id].searchCb, data);
     if (rc != SQLITE_ROW) {
         return SOFTBUS_ERR;
     }
@@ -456,8 +579,7 @@ int32_t QueryRecordByKey(DbContext *ctx, TableNameID id, uint8_t *data,
     if (rc != SQLITE_DONE) {
         if (rc == SQLITE_ROW) {
             ctx->state &= ~DB_STATE_QUERYING;
-            (void)sqlite3_finalize(ctx->stmt);
-            ctx->stmt = NULL;
+            ReleaseStmt(ctx);
         }
         COMM_LOGE(COMM_UTILS, "QueryData failed");
         return SOFTBUS_ERR;
@@ -485,8 +607,7 @@ int32_t OpenTransaction(DbContext *ctx)
         ctx->state |= DB_STATE_TRANSACTION;
         rc = SOFTBUS_OK;
     }
-    (void)sqlite3_finalize(ctx->stmt);
-    ctx->stmt = NULL;
+    ReleaseStmt(ctx);
     return rc;
 }
 
@@ -514,8 +635,7 @@ int32_t CloseTransaction(DbContext *ctx, CloseTransactionType type)
         rc = SOFTBUS_OK;
     }
     ctx->state &= ~DB_STATE_TRANSACTION;
-    (void)sqlite3_finalize(ctx->stmt);
-    ctx->stmt = NULL;
+    ReleaseStmt(ctx);
     return rc;
 }
 
@@ -543,6 +663,7 @@ int32_t UpdateDbPassword(DbContext *ctx, const uint8_t *password, uint32_t len)
         COMM_LOGE(COMM_UTILS, "invalid parameters");
         return SOFTBUS_INVALID_PARAM;
     }
+    FinalizeAllCachedStmt(ctx);
     rc = sqlite3_rekey(ctx->db, password, len);
     if (rc != SQLITE_OK) {
         COMM_LOGE(COMM_UTILS, "update key failed: errmsg=%{public}s", sqlite3_errmsg(ctx->db));
@@ -551,6 +672,28 @@ int32_t UpdateDbPassword(DbContext *ctx, const uint8_t *password, uint32_t len)
     return SOFTBUS_OK;
 }
 
+int32_t EnableDbWalMode(DbContext *ctx)
+{
+    int32_t rc;
+    char mode[JOURNAL_MODE_LEN] = { 0 };
+
+    if (!CheckDbContextParam(ctx)) {
+        COMM_LOGE(COMM_UTILS, "invalid parameters");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    rc = ExecuteSql(ctx, SQL_ENABLE_WAL_MODE, strlen(SQL_ENABLE_WAL_MODE), NULL, NULL);
+    if (rc == SQLITE_ROW && sqlite3_column_type(ctx->stmt, 0) == SQLITE_TEXT) {
+        (void)strcpy_s(mode, sizeof(mode), (const char *)sqlite3_column_text(ctx->stmt, 0));
+    }
+    ReleaseStmt(ctx);
+    // the journal mode stays unchanged on a file system without shared memory support
+    if (strcmp(mode, JOURNAL_MODE_WAL) != 0) {
+        COMM_LOGE(COMM_UTILS, "enable wal mode failed, mode=%{public}s", mode);
+        return SOFTBUS_ERR;
+    }
+    return SOFTBUS_OK;
+}
+
 int32_t BindParaInt(DbContext *ctx, int32_t idx, int32_t value)
 {
     int32_t rc;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -208,7 +208,7 @@ static SoftbusListenerNode *CreateSpecifiedListenerModule(ListenerModule module)
 
 static int32_t AddFdNode(ListNode *fdList, int32_t fd, uint32_t event)
 {
-    struct FdNode *fdNode = (struct FdNode *)SoftBusCalloc(sizeof(struct FdNode));
+    struct FdNode *fdNode = (struct FdNode *)SoftBusCallocByModule(SOFTBUS_MEM_MODULE_CONN, sizeof(struct FdNode));
     CONN_CHECK_AND_RETURN_RET_LOGE(fdNode != NULL, SOFTBUS_MALLOC_ERR, CONN_COMMON, "calloc fdNode fail");
     ListInit(&fdNode->node);
     fdNode->fd = fd;
@@ -792,7 +792,7 @@ int32_t AddTrigger(ListenerModule module, int32_t fd, TriggerType trigger)
             break;
         }
 
-        struct FdNode *fdNode = (struct FdNode *)SoftBusCalloc(sizeof(struct FdNode));
+        struct FdNode *fdNode = (struct FdNode *)SoftBusCallocByModule(SOFTBUS_MEM_MODULE_CONN, sizeof(struct FdNode));
         if (fdNode == NULL) {
             CONN_LOGE(CONN_COMMON, "calloc fail, module=%{public}d, fd=%{public}d, trigger=%{public}d",
                 module, fd, trigger);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -146,7 +146,7 @@ static uint32_t EpollEventToTriggerEvent(uint32_t epollEvent)
 static void SetReadyFdEvent(struct epoll_event *events, int32_t nEvents, ListNode *out)
 {
     for (int32_t i = 0; i < nEvents; i++) {
-        struct FdNode *fdNode = (struct FdNode *)SoftBusCalloc(sizeof(struct FdNode));
+        struct FdNode *fdNode = (struct FdNode *)SoftBusCallocByModule(SOFTBUS_MEM_MODULE_CONN, sizeof(struct FdNode));
         if (fdNode == NULL) {
             CONN_LOGE(CONN_COMMON, "calloc fd node fail, fd=%{public}d", events[i].data.fd);
             continue;
@@ -16,28 +16,165 @@
 #ifndef INFO_CONTAINER_H
 #define INFO_CONTAINER_H
 
+#include <array>
+#include <bitset>
 #include <map>
+#include <utility>
 
 #include "conn_log.h"
 #include "serializable.h"
 
 namespace OHOS::SoftBus {
+/*
+ * Maps every key of a container to a fixed slot. Each key enum specializes this next to its definition, the slot
+ * order must follow the key order so that marshalling keeps the same attribute order as before.
+ */
+template<typename Key>
+struct InfoContainerKeyTraits;
+
+template<typename Key, Key LAST_KEY>
+struct DenseInfoContainerKeyTraits {
+    static constexpr size_t SLOT_COUNT = static_cast<size_t>(LAST_KEY) + 1;
+
+    static constexpr size_t ToSlot(Key key)
+    {
+        return static_cast<size_t>(key);
+    }
+
+    static constexpr Key FromSlot(size_t slot)
+    {
+        return static_cast<Key>(slot);
+    }
+};
+
+/* flat array of values indexed by key slot, with presence bits kept for marshalling */
+template<typename Key>
+class InfoSlots {
+public:
+    using KeyTraits = InfoContainerKeyTraits<Key>;
+    static constexpr size_t SLOT_COUNT = KeyTraits::SLOT_COUNT;
+
+    class ConstIterator {
+    public:
+        ConstIterator(const InfoSlots *slots, size_t slot) : slots_(slots), slot_(slot)
+        {
+            SkipAbsent();
+        }
+
+        std::pair<Key, const std::any &> operator*() const
+        {
+            return { KeyTraits::FromSlot(slot_), slots_->values_[slot_] };
+        }
+
+        ConstIterator &operator++()
+        {
+            ++slot_;
+            SkipAbsent();
+            return *this;
+        }
+
+        bool operator==(const ConstIterator &other) const
+        {
+            return slot_ == other.slot_;
+        }
+
+        bool operator!=(const ConstIterator &other) const
+        {
+            return slot_ != other.slot_;
+        }
+
+    private:
+        void SkipAbsent()
+        {
+            while (slot_ < SLOT_COUNT && !slots_->presence_.test(slot_)) {
+                ++slot_;
+            }
+        }
+
+        const InfoSlots *slots_;
+        size_t slot_;
+    };
+
+    template<typename T>
+    bool Assign(Key key, T &&value)
+    {
+        size_t slot = KeyTraits::ToSlot(key);
+        if (slot >= SLOT_COUNT) {
+            return false;
+        }
+        values_[slot] = std::forward<T>(value);
+        presence_.set(slot);
+        return true;
+    }
+
+    const std::any *Find(Key key) const
+    {
+        size_t slot = KeyTraits::ToSlot(key);
+        if (slot >= SLOT_COUNT || !presence_.test(slot)) {
+            return nullptr;
+        }
+        return &values_[slot];
+    }
+
+    bool Contains(Key key) const
+    {
+        return Find(key) != nullptr;
+    }
+
+    void Erase(Key key)
+    {
+        size_t slot = KeyTraits::ToSlot(key);
+        if (slot >= SLOT_COUNT) {
+            return;
+        }
+        values_[slot].reset();
+        presence_.reset(slot);
+    }
+
+    size_t Size() const
+    {
+        return presence_.count();
+    }
+
+    bool Empty() const
+    {
+        return presence_.none();
+    }
+
+    ConstIterator begin() const
+    {
+        return ConstIterator(this, 0);
+    }
+
+    ConstIterator end() const
+    {
+        return ConstIterator(this, SLOT_COUNT);
+    }
+
+private:
+    std::array<std::any, SLOT_COUNT> values_;
+    std::bitset<SLOT_COUNT> presence_;
+};
+
 template<typename Key>
 class InfoContainer {
 protected:
-    void Set(Key key, const std::any &value)
+    template<typename T>
+    void Set(Key key, T &&value)
     {
-        values_[key] = value;
+        if (!values_.Assign(key, std::forward<T>(value))) {
+            CONN_LOGE(CONN_WIFI_DIRECT, "key=%{public}d out of range", static_cast<int>(key));
+        }
     }
 
     template<typename T>
     T Get(Key key, const T &defaultValue) const
     {
-        const auto it = values_.find(key);
-        if (it == values_.end()) {
+        const auto value = values_.Find(key);
+        if (value == nullptr) {
             return defaultValue;
         }
-        auto ptr = std::any_cast<T>(&it->second);
+        auto ptr = std::any_cast<T>(value);
         if (ptr == nullptr) {
             CONN_LOGE(CONN_WIFI_DIRECT, "Warning! Type conversion failure is not allowed! Pls check type!");
             return defaultValue;
@@ -45,10 +182,37 @@ protected:
         return *ptr;
     }
 
+    static const Serializable::ValueType *FindValueType(Key key)
+    {
+        static const auto slotTypes = BuildSlotTypeTable();
+        size_t slot = InfoContainerKeyTraits<Key>::ToSlot(key);
+        if (slot >= InfoSlots<Key>::SLOT_COUNT || !slotTypes.first.test(slot)) {
+            return nullptr;
+        }
+        return &slotTypes.second[slot];
+    }
+
     using KeyTypeTable = std::map<Key, Serializable::ValueType>;
 
     static KeyTypeTable keyTypeTable_;
-    std::map<Key, std::any> values_;
+    InfoSlots<Key> values_;
+
+private:
+    using SlotTypeTable = std::pair<std::bitset<InfoSlots<Key>::SLOT_COUNT>,
+        std::array<Serializable::ValueType, InfoSlots<Key>::SLOT_COUNT>>;
+
+    static SlotTypeTable BuildSlotTypeTable()
+    {
+        SlotTypeTable table {};
+        for (const auto &[key, type] : keyTypeTable_) {
+            size_t slot = InfoContainerKeyTraits<Key>::ToSlot(key);
+            if (slot < InfoSlots<Key>::SLOT_COUNT) {
+                table.first.set(slot);
+                table.second[slot] = type;
+            }
+        }
+        return table;
+    }
 };
 }
 #endif
@@ -59,6 +59,9 @@ enum class InnerLinKey {
     GROUP_NAME = 29,
 };
 
+template<>
+struct InfoContainerKeyTraits<InnerLinKey> : DenseInfoContainerKeyTraits<InnerLinKey, InnerLinKey::GROUP_NAME> {};
+
 struct LinkIdStruct {
     int id;
     int pid;
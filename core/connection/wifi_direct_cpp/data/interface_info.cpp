@@ -76,7 +76,11 @@ int InterfaceInfo::Marshalling(WifiDirectProtocol &protocol, std::vector<uint8_t
 {
     ProtocolType protocolType = protocol.GetType();
     for (const auto &[key, value] : values_) {
-        auto type = keyTypeTable_[key];
+        const auto *valueType = FindValueType(key);
+        if (valueType == nullptr) {
+            continue;
+        }
+        auto type = *valueType;
         if (protocolType == ProtocolType::TLV &&
             (key == InterfaceInfoKey::DYNAMIC_MAC || key == InterfaceInfoKey::BASE_MAC)) {
             auto macString = std::any_cast<const std::string>(value);
@@ -132,11 +136,12 @@ int InterfaceInfo::Unmarshalling(WifiDirectProtocol &protocol, const std::vector
 
     protocol.SetInput(input);
     while (protocol.Read(key, data, size)) {
-        if (keyTypeTable_.find(static_cast<InterfaceInfoKey>(key)) == keyTypeTable_.end()) {
+        const auto *valueType = FindValueType(static_cast<InterfaceInfoKey>(key));
+        if (valueType == nullptr) {
             continue;
         }
 
-        auto type = keyTypeTable_[InterfaceInfoKey(key)];
+        auto type = *valueType;
         auto keyValue = static_cast<InterfaceInfoKey>(key);
         if (protocolType == ProtocolType::TLV &&
             (keyValue == InterfaceInfoKey::DYNAMIC_MAC || keyValue == InterfaceInfoKey::BASE_MAC)) {
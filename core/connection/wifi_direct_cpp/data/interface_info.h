@@ -59,6 +59,10 @@ enum class InterfaceInfoKey {
     NEED_KEEP_P2P_GROUP = 32,
 };
 
+template<>
+struct InfoContainerKeyTraits<InterfaceInfoKey>
+    : DenseInfoContainerKeyTraits<InterfaceInfoKey, InterfaceInfoKey::NEED_KEEP_P2P_GROUP> {};
+
 class InterfaceInfo : public Serializable, public InfoContainer<InterfaceInfoKey> {
 public:
     enum InterfaceType {
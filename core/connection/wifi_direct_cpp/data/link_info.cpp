@@ -61,7 +61,11 @@ LinkInfo::LinkInfo(const std::string &localInterface, const std::string &remoteI
 int LinkInfo::Marshalling(WifiDirectProtocol &protocol, std::vector<uint8_t> &output) const
 {
     for (const auto &[key, value] : values_) {
-        auto type = keyTypeTable_[key];
+        const auto *valueType = FindValueType(key);
+        if (valueType == nullptr) {
+            continue;
+        }
+        auto type = *valueType;
         switch (type) {
             case Serializable::ValueType::BOOL: {
                 uint8_t data = std::any_cast<bool>(value);
@@ -103,8 +107,11 @@ int LinkInfo::Unmarshalling(WifiDirectProtocol &protocol, const std::vector<uint
 
     protocol.SetInput(input);
     while (protocol.Read(key, data, size)) {
-        auto valueType = keyTypeTable_[LinkInfoKey(key)];
-        switch (valueType) {
+        const auto *valueType = FindValueType(LinkInfoKey(key));
+        if (valueType == nullptr) {
+            continue;
+        }
+        switch (*valueType) {
             case Serializable::ValueType::BOOL: {
                 // Consistent with where data is added, use the uint8_t type
                 if (size >= sizeof(uint8_t)) {
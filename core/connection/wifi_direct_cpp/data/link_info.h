@@ -56,6 +56,9 @@ enum class LinkInfoKey {
     IS_DBAC = 28,
 };
 
+template<>
+struct InfoContainerKeyTraits<LinkInfoKey> : DenseInfoContainerKeyTraits<LinkInfoKey, LinkInfoKey::IS_DBAC> {};
+
 class LinkInfo : public Serializable, public InfoContainer<LinkInfoKey> {
 public:
     enum class LinkMode {
@@ -165,7 +165,11 @@ int NegotiateMessage::Marshalling(WifiDirectProtocol &protocol, std::vector<uint
         if (keyIgnoreTable_.find(key) != keyIgnoreTable_.end()) {
             continue;
         }
-        auto type = keyTypeTable_[key];
+        const auto *valueType = FindValueType(key);
+        if (valueType == nullptr) {
+            continue;
+        }
+        auto type = *valueType;
         switch (type) {
             case Serializable::ValueType::BOOL: {
                 uint8_t data = std::any_cast<bool>(value);
@@ -263,12 +267,12 @@ int NegotiateMessage::Unmarshalling(WifiDirectProtocol &protocol, const std::vec
 
     protocol.SetInput(input);
     while (protocol.Read(key, data, size)) {
-        if (keyTypeTable_.find(static_cast<NegotiateMessageKey>(key)) == keyTypeTable_.end()) {
+        const auto *type = FindValueType(static_cast<NegotiateMessageKey>(key));
+        if (type == nullptr) {
             continue;
         }
 
-        auto type = keyTypeTable_[static_cast<NegotiateMessageKey>(key)];
-        switch (Serializable::ValueType(type)) {
+        switch (*type) {
             case Serializable::ValueType::BOOL: {
                 // Consistent with where data is added, use the uint8_t type
                 if (size >= sizeof(uint8_t)) {
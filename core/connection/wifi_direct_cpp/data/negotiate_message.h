@@ -136,6 +136,36 @@ enum class NegotiateMessageKey {
     INTERFACE_NAME = 220,
 };
 
+/* keys are split into the v2/v3 range and the old p2p range, both ranges are packed into one slot array */
+template<>
+struct InfoContainerKeyTraits<NegotiateMessageKey> {
+    static constexpr size_t NEW_KEY_COUNT = static_cast<size_t>(NegotiateMessageKey::REMOTE_NETWORK_ID) + 1;
+    static constexpr size_t LEGACY_KEY_BEGIN = static_cast<size_t>(NegotiateMessageKey::GC_CHANNEL_LIST);
+    static constexpr size_t LEGACY_KEY_COUNT =
+        static_cast<size_t>(NegotiateMessageKey::INTERFACE_NAME) - LEGACY_KEY_BEGIN + 1;
+    static constexpr size_t SLOT_COUNT = NEW_KEY_COUNT + LEGACY_KEY_COUNT;
+
+    static constexpr size_t ToSlot(NegotiateMessageKey key)
+    {
+        auto value = static_cast<size_t>(key);
+        if (value < NEW_KEY_COUNT) {
+            return value;
+        }
+        if (value >= LEGACY_KEY_BEGIN && value < LEGACY_KEY_BEGIN + LEGACY_KEY_COUNT) {
+            return NEW_KEY_COUNT + value - LEGACY_KEY_BEGIN;
+        }
+        return SLOT_COUNT;
+    }
+
+    static constexpr NegotiateMessageKey FromSlot(size_t slot)
+    {
+        if (slot < NEW_KEY_COUNT) {
+            return static_cast<NegotiateMessageKey>(slot);
+        }
+        return static_cast<NegotiateMessageKey>(slot - NEW_KEY_COUNT + LEGACY_KEY_BEGIN);
+    }
+};
+
 class NegotiateMessage : public Serializable, public InfoContainer<NegotiateMessageKey> {
 public:
     NegotiateMessage();
@@ -42,12 +42,12 @@ int WifiConfigInfo::Unmarshalling(WifiDirectProtocol &protocol, const std::vecto
 
     protocol.SetInput(input);
     while (protocol.Read(key, data, size)) {
-        if (keyTypeTable_.find(static_cast<WifiConfigInfoKey>(key)) == keyTypeTable_.end()) {
+        const auto *type = FindValueType(static_cast<WifiConfigInfoKey>(key));
+        if (type == nullptr) {
             continue;
         }
 
-        auto type = keyTypeTable_[static_cast<WifiConfigInfoKey>(key)];
-        switch (Serializable::ValueType(type)) {
+        switch (*type) {
             case Serializable::ValueType::INTERFACE_INFO_ARRAY:
                 UnmarshallingInterfaceArray(protocol, data, size);
                 break;
@@ -76,7 +76,11 @@ void WifiConfigInfo::MarshallingInterfaceArray(WifiDirectProtocol &protocol) con
 int WifiConfigInfo::Marshalling(WifiDirectProtocol &protocol, std::vector<uint8_t> &output) const
 {
     for (const auto &[key, value] : values_) {
-        auto type = keyTypeTable_[key];
+        const auto *valueType = FindValueType(key);
+        if (valueType == nullptr) {
+            continue;
+        }
+        auto type = *valueType;
         switch (type) {
             case Serializable::ValueType::INTERFACE_INFO_ARRAY:
                 MarshallingInterfaceArray(protocol);
@@ -44,6 +44,10 @@ enum class WifiConfigInfoKey {
     WC_KEY_MAX,
 };
 
+template<>
+struct InfoContainerKeyTraits<WifiConfigInfoKey>
+    : DenseInfoContainerKeyTraits<WifiConfigInfoKey, WifiConfigInfoKey::INTERFACE_INFO_ARRAY> {};
+
 class WifiConfigInfo : public Serializable, public InfoContainer<WifiConfigInfoKey> {
 public:
     WifiConfigInfo() = default;
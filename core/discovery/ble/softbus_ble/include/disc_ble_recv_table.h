@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DISC_BLE_RECV_TABLE_H
+#define DISC_BLE_RECV_TABLE_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#include "disc_ble_utils_struct.h"
+#include "disc_manager_struct.h"
+
+#ifdef __cplusplus
+#if __cplusplus
+extern "C" {
+#endif
+#endif
+
+#define RECV_TABLE_SIZE             256
+#define RECV_PAYLOAD_MAX_LEN        (ADV_DATA_MAX_LEN + REAL_RESP_DATA_MAX_LEN)
+#define RECV_CAP_BIT_NUM            32
+
+typedef struct {
+    uint64_t hash;
+    uint64_t expireTime;
+    uint32_t capBitMap[CAPABILITY_NUM];
+    uint16_t payloadLen;
+    bool isUsed;
+    bool needBrMac;
+    uint8_t actionKey[SHA_HASH_LEN]; /* sha-256 of the payload, handed to the action module */
+    uint8_t payload[RECV_PAYLOAD_MAX_LEN];
+} RecvMessage;
+
+/* received passive packets waiting for a reply, keyed by a seeded hash of adv and rsp payload */
+typedef struct {
+    uint64_t seed[2];
+    uint32_t num;
+    uint32_t numNeedBrMac;
+    uint32_t aggregateCap[CAPABILITY_NUM];
+    uint16_t capCount[CAPABILITY_NUM][RECV_CAP_BIT_NUM];
+    RecvMessage slot[RECV_TABLE_SIZE];
+} RecvTable;
+
+int32_t DiscBleRecvTableInit(RecvTable *table);
+void DiscBleRecvTableClear(RecvTable *table);
+uint64_t DiscBleRecvTableHash(const RecvTable *table, const uint8_t *payload, uint16_t len);
+/* add or refresh a packet, isNew tells whether the packet was not in the table yet */
+int32_t DiscBleRecvTableAdd(RecvTable *table, const RecvMessage *msg, bool *isNew);
+/* copy the action key of a packet already in the table, SOFTBUS_NOT_FIND when it has to be computed */
+int32_t DiscBleRecvTableGetActionKey(const RecvTable *table, const RecvMessage *msg, uint8_t *key, uint32_t len);
+/* remove expired packets, returns the removed count and the earliest remaining expire time or 0 */
+uint32_t DiscBleRecvTableExpire(RecvTable *table, uint64_t now, uint64_t *nextExpireTime);
+
+#ifdef __cplusplus
+#if __cplusplus
+}
+#endif /* __cplusplus */
+#endif /* __cplusplus */
+#endif /* DISC_BLE_RECV_TABLE_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -24,6 +24,7 @@
 #include "broadcast_dfx_event.h"
 #include "common_list.h"
 #include "disc_ble_constant.h"
+#include "disc_ble_recv_table.h"
 #include "disc_ble_utils.h"
 #include "disc_event.h"
 #include "disc_log.h"
@@ -167,16 +168,8 @@ typedef struct {
 } ScanSetting;
 
 typedef struct {
-    ListNode node;
-    uint32_t capBitMap[CAPABILITY_NUM];
-    char key[SHA_HASH_LEN];
-    bool needBrMac;
-} RecvMessage;
-
-typedef struct {
-    uint32_t numNeedBrMac;
-    uint32_t numNeedResp;
-    ListNode node;
+    bool isSweepPosted;
+    RecvTable table;
     SoftBusMutex lock;
 } RecvMessageInfo;
 
@@ -254,9 +247,8 @@ static const int g_bleTransCapabilityMap[CAPABILITY_MAX_BITNUM] = {
 };
 
 static SoftBusMessage *CreateBleHandlerMsg(int32_t what, uint64_t arg1, uint64_t arg2, void *obj);
-static int32_t AddRecvMessage(const char *key, const uint32_t *capBitMap, bool needBrMac);
+static int32_t AddRecvMessage(const RecvMessage *recvMsg);
 static int32_t MatchRecvMessage(const uint32_t *publishInfoMap, uint32_t *capBitMap, uint32_t len);
-static RecvMessage *GetRecvMessage(const char *key);
 static int32_t StartAdvertiser(int32_t adv);
 static int32_t StopAdvertiser(int32_t adv);
 static int32_t UpdateAdvertiser(int32_t adv);
@@ -453,23 +445,41 @@ static int32_t ScanFilter(const BroadcastReportInfo *reportInfo)
     return SOFTBUS_OK;
 }
 
-static int32_t SoftbusBleGeneratePacketHash(char *key, const BroadcastReportInfo *reportInfo)
+static int32_t SoftbusBleBuildRecvMessage(RecvMessage *recvMsg, const BroadcastReportInfo *reportInfo)
 {
-    DISC_CHECK_AND_RETURN_RET_LOGE(key != NULL && reportInfo != NULL, SOFTBUS_INVALID_PARAM, DISC_BLE, "invalid param");
-    uint8_t payload[ADV_DATA_MAX_LEN + REAL_RESP_DATA_MAX_LEN];
+    DISC_CHECK_AND_RETURN_RET_LOGE(recvMsg != NULL && reportInfo != NULL, SOFTBUS_INVALID_PARAM,
+        DISC_BLE, "invalid param");
     uint16_t advLen = reportInfo->packet.bcData.payloadLen;
     uint16_t rspLen = reportInfo->packet.rspData.payloadLen;
 
     DISC_CHECK_AND_RETURN_RET_LOGE(advLen > 0 && advLen <= ADV_DATA_MAX_LEN, SOFTBUS_INVALID_PARAM,
         DISC_BLE, "invalid advLen");
-    errno_t ret = memcpy_s(payload, sizeof(payload), reportInfo->packet.bcData.payload, advLen);
+    errno_t ret = memcpy_s(recvMsg->payload, sizeof(recvMsg->payload), reportInfo->packet.bcData.payload, advLen);
     DISC_CHECK_AND_RETURN_RET_LOGE(ret == EOK, SOFTBUS_MEM_ERR, DISC_BLE, "memcpy adv fail");
+    recvMsg->payloadLen = advLen;
 
     if (rspLen > 0 && rspLen <= REAL_RESP_DATA_MAX_LEN) {
-        ret = memcpy_s(payload + advLen, REAL_RESP_DATA_MAX_LEN, reportInfo->packet.rspData.payload, rspLen);
+        ret = memcpy_s(recvMsg->payload + advLen, REAL_RESP_DATA_MAX_LEN, reportInfo->packet.rspData.payload, rspLen);
         DISC_CHECK_AND_RETURN_RET_LOGE(ret == EOK, SOFTBUS_MEM_ERR, DISC_BLE, "memcpy rsp fail");
+        recvMsg->payloadLen += rspLen;
+    }
+    // the seed is fixed after init, hashing needs no lock
+    recvMsg->hash = DiscBleRecvTableHash(&g_recvMessageInfo.table, recvMsg->payload, recvMsg->payloadLen);
+    return SOFTBUS_OK;
+}
+
+// the action module keys its state by the sha-256 of the packet, a repeated packet reuses the key of its table entry
+static int32_t GetPacketActionKey(RecvMessage *recvMsg)
+{
+    DISC_CHECK_AND_RETURN_RET_LOGE(SoftBusMutexLock(&g_recvMessageInfo.lock) == SOFTBUS_OK, SOFTBUS_LOCK_ERR,
+        DISC_BLE, "lock failed");
+    int32_t ret = DiscBleRecvTableGetActionKey(&g_recvMessageInfo.table, recvMsg, recvMsg->actionKey,
+        sizeof(recvMsg->actionKey));
+    (void)SoftBusMutexUnlock(&g_recvMessageInfo.lock);
+    if (ret != SOFTBUS_NOT_FIND) {
+        return ret;
     }
-    return SoftBusGenerateStrHash(payload, advLen + rspLen, (unsigned char *)key);
+    return SoftBusGenerateStrHash(recvMsg->payload, recvMsg->payloadLen, recvMsg->actionKey);
 }
 
 static void ProcessDisConPacket(const BroadcastReportInfo *reportInfo, DeviceInfo *foundInfo)
@@ -483,20 +493,27 @@ static void ProcessDisConPacket(const BroadcastReportInfo *reportInfo, DeviceInf
     DISC_CHECK_AND_RETURN_LOGE(ret == SOFTBUS_OK, DISC_BLE, "GetDeviceInfoFromDisAdvData fail, ret=%{public}d", ret);
     DISC_CHECK_AND_RETURN_LOGE(SoftBusMutexLock(&g_bleInfoLock) == SOFTBUS_OK, DISC_BLE, "lock fail");
     if ((foundInfo->capabilityBitmap[0] & g_bleInfoManager[BLE_PUBLISH | BLE_PASSIVE].capBitMap[0]) == 0x0) {
-        DISC_LOGD(DISC_BLE, "don't match passive publish capBitMap, callCount=%{public}u", callCount++);
+        DISC_LOGD(DISC_BLE, "don't match passive publish capBitMap, callCount=%{public}u", callCount);
+        callCount++;
         (void)SoftBusMutexUnlock(&g_bleInfoLock);
         return;
     }
     (void)SoftBusMutexUnlock(&g_bleInfoLock);
 
-    char key[SHA_HASH_LEN] = {0};
-    ret = SoftbusBleGeneratePacketHash(key, reportInfo);
-    DISC_CHECK_AND_RETURN_LOGE(ret == SOFTBUS_OK, DISC_BLE, "generate packetHash fail, ret=%{public}d", ret);
-    if (DistActionProcessConPacketPacked(&device, (const uint8_t *)key, SHA_HASH_LEN)) {
+    RecvMessage recvMsg = { 0 };
+    ret = SoftbusBleBuildRecvMessage(&recvMsg, reportInfo);
+    DISC_CHECK_AND_RETURN_LOGE(ret == SOFTBUS_OK, DISC_BLE, "build recv message fail, ret=%{public}d", ret);
+    ret = GetPacketActionKey(&recvMsg);
+    DISC_CHECK_AND_RETURN_LOGE(ret == SOFTBUS_OK, DISC_BLE, "get packet action key fail, ret=%{public}d", ret);
+    if (DistActionProcessConPacketPacked(&device, recvMsg.actionKey, SHA_HASH_LEN)) {
         DISC_LOGD(DISC_BLE, "both support action, no need ble reply");
         return;
     }
-    if (AddRecvMessage(key, foundInfo->capabilityBitmap, true) == SOFTBUS_OK) {
+    for (uint32_t index = 0; index < CAPABILITY_NUM; index++) {
+        recvMsg.capBitMap[index] = foundInfo->capabilityBitmap[index];
+    }
+    recvMsg.needBrMac = true;
+    if (AddRecvMessage(&recvMsg) == SOFTBUS_OK) {
         ReplyPassiveNonBroadcast();
     }
 }
@@ -626,7 +643,8 @@ static void ProcessDisNonPacket(const BroadcastReportInfo *reportInfo, char rssi
         Anonymize(foundInfo->addr[0].info.ble.bleMac, &anonyLocalBleMac);
         DISC_LOGI(DISC_BLE, "start report found device, addrNum=%{public}u, addr[0].type=%{public}u,"
             "capabilityBitmap=%{public}u, bleMac=%{public}s, callCount=%{public}u", foundInfo->addrNum,
-            foundInfo->addr[0].type, foundInfo->capabilityBitmap[0], AnonymizeWrapper(anonyLocalBleMac), callCount++);
+            foundInfo->addr[0].type, foundInfo->capabilityBitmap[0], AnonymizeWrapper(anonyLocalBleMac), callCount);
+        callCount++;
         AnonymizeFree(anonyLocalBleMac);
         if (!ReportOnDeviceFoundNonPacket(foundInfo, &add)) {
             return;
@@ -976,7 +994,7 @@ static void AssembleCustData(DeviceInfo *info, BroadcastData *broadcastData)
 static void AssembleNonOptionalTlv(DeviceInfo *info, BroadcastData *broadcastData)
 {
     DISC_CHECK_AND_RETURN_LOGE(SoftBusMutexLock(&g_recvMessageInfo.lock) == SOFTBUS_OK, DISC_BLE, "lock failed");
-    if (g_recvMessageInfo.numNeedBrMac > 0) {
+    if (g_recvMessageInfo.table.numNeedBrMac > 0) {
         SoftBusBtAddr addr;
         if (SoftBusGetBrState() == BR_ENABLE && SoftBusGetBtMacAddr(&addr) == SOFTBUS_OK) {
             (void)AssembleTLV(broadcastData, TLV_TYPE_BR_MAC, (const void *)&addr.addr, BT_ADDR_LEN);
@@ -2094,83 +2112,28 @@ static int32_t ReplyPassiveNonBroadcast(void)
     return SOFTBUS_OK;
 }
 
-static int32_t MessageRemovePredicate(const SoftBusMessage *msg, void *args)
-{
-    DISC_LOGD(DISC_BLE, "enter");
-    uintptr_t key = (uintptr_t)args;
-    if (msg->what == PROCESS_TIME_OUT && msg->arg1 == key) {
-        DISC_LOGD(DISC_BLE, "find key");
-        return 0;
-    }
-    DISC_LOGW(DISC_BLE, "not find key");
-    return 1;
-}
-
-static RecvMessage *GetRecvMessage(const char *key)
-{
-    RecvMessage *msg = NULL;
-    LIST_FOR_EACH_ENTRY(msg, &g_recvMessageInfo.node, RecvMessage, node) {
-        if (memcmp((void *)key, (void *)msg->key, SHA_HASH_LEN) == 0) {
-            return msg;
-        }
-    }
-    return NULL;
-}
-
 static int32_t MatchRecvMessage(const uint32_t *publishInfoMap, uint32_t *capBitMap, uint32_t len)
 {
     DISC_CHECK_AND_RETURN_RET_LOGE(SoftBusMutexLock(&g_recvMessageInfo.lock) == SOFTBUS_OK,
         SOFTBUS_LOCK_ERR, DISC_BLE, "lock fail");
-    RecvMessage *msg = NULL;
-    DISC_LOGI(DISC_BLE, "recv message cnt=%{public}d", g_recvMessageInfo.numNeedResp);
-    LIST_FOR_EACH_ENTRY(msg, &g_recvMessageInfo.node, RecvMessage, node) {
-        for (uint32_t index = 0; index < len; index++) {
-            capBitMap[index] |= msg->capBitMap[index] & publishInfoMap[index];
-        }
+    DISC_LOGI(DISC_BLE, "recv message cnt=%{public}u", g_recvMessageInfo.table.num);
+    for (uint32_t index = 0; index < len && index < CAPABILITY_NUM; index++) {
+        capBitMap[index] |= g_recvMessageInfo.table.aggregateCap[index] & publishInfoMap[index];
     }
     (void)SoftBusMutexUnlock(&g_recvMessageInfo.lock);
     return SOFTBUS_OK;
 }
 
-static void StartTimeout(const char *key)
+/* one sweep message serves the whole table, a repeated packet only moves its expire time */
+static void StartSweepTimeout(uint64_t delayMillis)
 {
-    DISC_LOGD(DISC_BLE, "enter");
-    DISC_CHECK_AND_RETURN_LOGE(SoftBusMutexLock(&g_recvMessageInfo.lock) == SOFTBUS_OK, DISC_BLE, "lock fail");
-    if (GetRecvMessage(key) == NULL) {
-        DISC_LOGE(DISC_BLE, "key is not exists");
-        SoftBusMutexUnlock(&g_recvMessageInfo.lock);
+    if (g_recvMessageInfo.isSweepPosted) {
         return;
     }
-    SoftBusMutexUnlock(&g_recvMessageInfo.lock);
-    SoftBusMessage *msg = CreateBleHandlerMsg(PROCESS_TIME_OUT, (uintptr_t)key, 0, NULL);
+    SoftBusMessage *msg = CreateBleHandlerMsg(PROCESS_TIME_OUT, 0, 0, NULL);
     DISC_CHECK_AND_RETURN_LOGE(msg != NULL, DISC_BLE, "malloc msg fail");
-    g_discBleHandler.looper->PostMessageDelay(g_discBleHandler.looper, msg, BLE_MSG_TIME_OUT);
-}
-
-static void RemoveTimeout(const char *key)
-{
-    DISC_LOGD(DISC_BLE, "enter");
-    DISC_CHECK_AND_RETURN_LOGE(SoftBusMutexLock(&g_recvMessageInfo.lock) == SOFTBUS_OK, DISC_BLE, "lock fail");
-    if (GetRecvMessage(key) == NULL) {
-        DISC_LOGI(DISC_BLE, "key is not in recv message");
-        SoftBusMutexUnlock(&g_recvMessageInfo.lock);
-        return;
-    }
-    SoftBusMutexUnlock(&g_recvMessageInfo.lock);
-    g_discBleHandler.looper->RemoveMessageCustom(g_discBleHandler.looper, &g_discBleHandler, MessageRemovePredicate,
-                                                 (void *)key);
-}
-
-static uint32_t RecvMsgAggregateCap(void)
-{
-    RecvMessage *msg = NULL;
-    uint32_t revMessageCap = 0;
-    LIST_FOR_EACH_ENTRY(msg, &g_recvMessageInfo.node, RecvMessage, node) {
-        for (uint32_t index = 0; index < CAPABILITY_NUM; index++) {
-            revMessageCap = msg->capBitMap[index] | revMessageCap;
-        }
-    }
-    return revMessageCap;
+    g_discBleHandler.looper->PostMessageDelay(g_discBleHandler.looper, msg, delayMillis);
+    g_recvMessageInfo.isSweepPosted = true;
 }
 
 static void DfxRecordAddRecvMsgEnd(const uint32_t *capBitMap, int32_t reason)
@@ -2187,96 +2150,63 @@ static void DfxRecordAddRecvMsgEnd(const uint32_t *capBitMap, int32_t reason)
     DISC_EVENT(EVENT_SCENE_BLE, EVENT_STAGE_SCAN_RECV, extra);
 }
 
-static int32_t AddRecvMessage(const char *key, const uint32_t *capBitMap, bool needBrMac)
+static int32_t AddRecvMessage(const RecvMessage *recvMsg)
 {
     DISC_LOGD(DISC_BLE, "enter");
     if (SoftBusMutexLock(&g_recvMessageInfo.lock) != SOFTBUS_OK) {
-        DfxRecordAddRecvMsgEnd(capBitMap, SOFTBUS_LOCK_ERR);
+        DfxRecordAddRecvMsgEnd(recvMsg->capBitMap, SOFTBUS_LOCK_ERR);
         DISC_LOGE(DISC_BLE, "lock fail");
         return SOFTBUS_LOCK_ERR;
     }
-    uint32_t oldAggregateCap = RecvMsgAggregateCap();
-    RecvMessage *recvMsg = GetRecvMessage(key);
-    if (recvMsg == NULL) {
+    uint32_t oldAggregateCap[CAPABILITY_NUM] = {0};
+    for (uint32_t index = 0; index < CAPABILITY_NUM; index++) {
+        oldAggregateCap[index] = g_recvMessageInfo.table.aggregateCap[index];
+    }
+    RecvMessage msg = *recvMsg;
+    msg.expireTime = SoftBusGetSysTimeMs() + BLE_MSG_TIME_OUT;
+    bool isNew = false;
+    int32_t ret = DiscBleRecvTableAdd(&g_recvMessageInfo.table, &msg, &isNew);
+    if (ret != SOFTBUS_OK) {
+        DfxRecordAddRecvMsgEnd(recvMsg->capBitMap, ret);
+        DISC_LOGE(DISC_BLE, "add recv msg fail, ret=%{public}d", ret);
+        SoftBusMutexUnlock(&g_recvMessageInfo.lock);
+        return ret;
+    }
+    if (isNew) {
         DISC_LOGI(DISC_BLE, "key is not exit");
-        recvMsg = (RecvMessage *)SoftBusCalloc(sizeof(RecvMessage));
-        if (recvMsg == NULL) {
-            DfxRecordAddRecvMsgEnd(capBitMap, SOFTBUS_MALLOC_ERR);
-            DISC_LOGE(DISC_BLE, "malloc recv msg fail");
-            SoftBusMutexUnlock(&g_recvMessageInfo.lock);
-            return SOFTBUS_MALLOC_ERR;
-        }
-        if (memcpy_s(&recvMsg->key, SHA_HASH_LEN, key, SHA_HASH_LEN) != EOK) {
-            DfxRecordAddRecvMsgEnd(capBitMap, SOFTBUS_MEM_ERR);
-            DISC_LOGE(DISC_BLE, "copy key to create recv msg fail");
-            SoftBusFree(recvMsg);
-            SoftBusMutexUnlock(&g_recvMessageInfo.lock);
-            return SOFTBUS_MEM_ERR;
-        }
-        for (uint32_t index = 0; index < CAPABILITY_NUM; index++) {
-            recvMsg->capBitMap[index] = capBitMap[index];
-        }
-        recvMsg->needBrMac = needBrMac;
-        g_recvMessageInfo.numNeedBrMac++;
-        g_recvMessageInfo.numNeedResp++;
-        ListTailInsert(&g_recvMessageInfo.node, &recvMsg->node);
-        uint32_t newAggregateCap = RecvMsgAggregateCap();
-        if (oldAggregateCap != newAggregateCap) {
+        if (memcmp(oldAggregateCap, g_recvMessageInfo.table.aggregateCap, sizeof(oldAggregateCap)) != 0) {
             UpdateInfoManager(NON_ADV_ID, true);
         }
-    } else {
-        RemoveTimeout(recvMsg->key);
     }
-    StartTimeout(recvMsg->key);
+    StartSweepTimeout(BLE_MSG_TIME_OUT);
     SoftBusMutexUnlock(&g_recvMessageInfo.lock);
-    DfxRecordAddRecvMsgEnd(capBitMap, SOFTBUS_OK);
+    DfxRecordAddRecvMsgEnd(recvMsg->capBitMap, SOFTBUS_OK);
     return SOFTBUS_OK;
 }
 
-static void RemoveRecvMessage(uint64_t key)
-{
-    DISC_LOGD(DISC_BLE, "enter");
-    DISC_CHECK_AND_RETURN_LOGE(SoftBusMutexLock(&g_recvMessageInfo.lock) == SOFTBUS_OK, DISC_BLE, "lock fail");
-
-    RecvMessage *msg = GetRecvMessage((char *)(uintptr_t)key);
-    if (msg == NULL) {
-        DISC_LOGE(DISC_BLE, "not find message");
-        SoftBusMutexUnlock(&g_recvMessageInfo.lock);
-        return;
-    }
-
-    if (g_discBleHandler.looper && g_discBleHandler.looper->RemoveMessageCustom) {
-        g_discBleHandler.looper->RemoveMessageCustom(g_discBleHandler.looper, &g_discBleHandler,
-            MessageRemovePredicate, (void *)key);
-    }
-    if (msg->needBrMac) {
-        g_recvMessageInfo.numNeedBrMac--;
-    }
-    g_recvMessageInfo.numNeedResp--;
-    ListDelete(&msg->node);
-    SoftBusFree(msg);
-    SoftBusMutexUnlock(&g_recvMessageInfo.lock);
-}
-
 static void ClearRecvMessage(void)
 {
-    ListNode *head = &(g_recvMessageInfo.node);
-    while (!IsListEmpty(head)) {
-        RecvMessage *msg = LIST_ENTRY(head->next, RecvMessage, node);
-        ListDelete(&msg->node);
-        if (g_discBleHandler.looper && g_discBleHandler.looper->RemoveMessageCustom) {
-            g_discBleHandler.looper->RemoveMessageCustom(g_discBleHandler.looper, &g_discBleHandler,
-                MessageRemovePredicate, (void *)msg->key);
-        }
-        SoftBusFree(msg);
+    DiscBleRecvTableClear(&g_recvMessageInfo.table);
+    if (g_recvMessageInfo.isSweepPosted && g_discBleHandler.looper && g_discBleHandler.looper->RemoveMessage) {
+        g_discBleHandler.looper->RemoveMessage(g_discBleHandler.looper, &g_discBleHandler, PROCESS_TIME_OUT);
     }
+    g_recvMessageInfo.isSweepPosted = false;
 }
 
 static void ProcessTimeout(SoftBusMessage *msg)
 {
+    (void)msg;
     DISC_LOGD(DISC_BLE, "enter");
-    RemoveRecvMessage(msg->arg1);
-    if (g_bleAdvertiser[NON_ADV_ID].isAdvertising) {
+    DISC_CHECK_AND_RETURN_LOGE(SoftBusMutexLock(&g_recvMessageInfo.lock) == SOFTBUS_OK, DISC_BLE, "lock fail");
+    g_recvMessageInfo.isSweepPosted = false;
+    uint64_t now = SoftBusGetSysTimeMs();
+    uint64_t nextExpireTime = 0;
+    uint32_t removed = DiscBleRecvTableExpire(&g_recvMessageInfo.table, now, &nextExpireTime);
+    if (nextExpireTime != 0) {
+        StartSweepTimeout(nextExpireTime - now);
+    }
+    SoftBusMutexUnlock(&g_recvMessageInfo.lock);
+    if (removed != 0 && g_bleAdvertiser[NON_ADV_ID].isAdvertising) {
         UpdateAdvertiser(NON_ADV_ID);
     }
 }
@@ -2287,7 +2217,7 @@ static void OnBrStateChanged(SoftBusMessage *msg)
     DISC_LOGD(DISC_BLE, "enter");
     if (g_bleAdvertiser[NON_ADV_ID].isAdvertising) {
         DISC_CHECK_AND_RETURN_LOGE(SoftBusMutexLock(&g_recvMessageInfo.lock) == SOFTBUS_OK, DISC_BLE, "lock fail");
-        uint32_t numNeedBrMac = g_recvMessageInfo.numNeedBrMac;
+        uint32_t numNeedBrMac = g_recvMessageInfo.table.numNeedBrMac;
         SoftBusMutexUnlock(&g_recvMessageInfo.lock);
 
         if (numNeedBrMac > 0) {
@@ -2624,7 +2554,6 @@ DiscoveryBleDispatcherInterface *DiscSoftBusBleInit(DiscInnerCallback *callback)
     DISC_CHECK_AND_RETURN_RET_LOGE(callback != NULL && callback->OnDeviceFound != NULL, NULL,
         DISC_INIT, "callback invalid.");
 
-    ListInit(&g_recvMessageInfo.node);
     g_discBleInnerCb = callback;
 
     SoftBusMutexAttr mutexAttr = {
@@ -2636,6 +2565,11 @@ DiscoveryBleDispatcherInterface *DiscSoftBusBleInit(DiscInnerCallback *callback)
         DISC_LOGE(DISC_INIT, "init ble lock fail");
         return NULL;
     }
+    if (DiscBleRecvTableInit(&g_recvMessageInfo.table) != SOFTBUS_OK) {
+        DiscSoftBusBleDeinit();
+        DISC_LOGE(DISC_INIT, "init recv table fail");
+        return NULL;
+    }
 
     DiscBleInitPublish();
     DiscBleInitSubscribe();
@@ -2679,8 +2613,6 @@ static void RecvMessageDeinit(void)
         SoftBusMutexUnlock(&g_recvMessageInfo.lock);
         (void)SoftBusMutexDestroy(&g_recvMessageInfo.lock);
     }
-    g_recvMessageInfo.numNeedBrMac = 0;
-    g_recvMessageInfo.numNeedResp = 0;
 }
 
 static void AdvertiserDeinit(void)
@@ -2787,13 +2719,14 @@ static int32_t RecvMessageInfoDump(int fd)
 {
     DISC_CHECK_AND_RETURN_RET_LOGE(SoftBusMutexLock(&g_recvMessageInfo.lock) == SOFTBUS_OK,
         SOFTBUS_LOCK_ERR, DISC_BLE, "lock fail.");
-    ListNode *item = NULL;
     SOFTBUS_DPRINTF(fd, "\n-----------------RecvMessage Info-------------------\n");
-    SOFTBUS_DPRINTF(fd, "RecvMessageInfo numNeedBrMac           : %u\n", g_recvMessageInfo.numNeedBrMac);
-    SOFTBUS_DPRINTF(fd, "RecvMessageInfo numNeedResp            : %u\n", g_recvMessageInfo.numNeedResp);
-    LIST_FOR_EACH(item, &g_recvMessageInfo.node)
-    {
-        RecvMessage *recvNode = LIST_ENTRY(item, RecvMessage, node);
+    SOFTBUS_DPRINTF(fd, "RecvMessageInfo numNeedBrMac           : %u\n", g_recvMessageInfo.table.numNeedBrMac);
+    SOFTBUS_DPRINTF(fd, "RecvMessageInfo numNeedResp            : %u\n", g_recvMessageInfo.table.num);
+    for (uint32_t index = 0; index < RECV_TABLE_SIZE; index++) {
+        const RecvMessage *recvNode = &g_recvMessageInfo.table.slot[index];
+        if (!recvNode->isUsed) {
+            continue;
+        }
         SOFTBUS_DPRINTF(fd, "RecvMessage capBitMap                  : %u\n", recvNode->capBitMap[0]);
         SOFTBUS_DPRINTF(fd, "needBrMac                              : %d\n", recvNode->needBrMac);
     }
@@ -0,0 +1,243 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "disc_ble_recv_table.h"
+
+#include "disc_log.h"
+#include "securec.h"
+#include "softbus_adapter_crypto.h"
+#include "softbus_error_code.h"
+
+#define RECV_TABLE_MASK             (RECV_TABLE_SIZE - 1)
+/* keep probe sequences short, a packet flood beyond this load is not replied */
+#define RECV_TABLE_MAX_NUM          (RECV_TABLE_SIZE * 3 / 4)
+
+#define SIP_INIT_V0                 0x736f6d6570736575ULL
+#define SIP_INIT_V1                 0x646f72616e646f6dULL
+#define SIP_INIT_V2                 0x6c7967656e657261ULL
+#define SIP_INIT_V3                 0x7465646279746573ULL
+#define SIP_FINAL_XOR               0xff
+#define SIP_FINAL_ROUNDS            3
+#define SIP_BLOCK_LEN               8
+#define SIP_LEN_SHIFT               56
+#define BITS_PER_BYTE               8
+
+typedef struct {
+    uint64_t v0;
+    uint64_t v1;
+    uint64_t v2;
+    uint64_t v3;
+} SipState;
+
+static inline uint64_t RotateLeft(uint64_t x, uint32_t bits)
+{
+    return (x << bits) | (x >> (64 - bits));
+}
+
+static void SipRound(SipState *s)
+{
+    s->v0 += s->v1;
+    s->v1 = RotateLeft(s->v1, 13);
+    s->v1 ^= s->v0;
+    s->v0 = RotateLeft(s->v0, 32);
+    s->v2 += s->v3;
+    s->v3 = RotateLeft(s->v3, 16);
+    s->v3 ^= s->v2;
+    s->v0 += s->v3;
+    s->v3 = RotateLeft(s->v3, 21);
+    s->v3 ^= s->v0;
+    s->v2 += s->v1;
+    s->v1 = RotateLeft(s->v1, 17);
+    s->v1 ^= s->v2;
+    s->v2 = RotateLeft(s->v2, 32);
+}
+
+static uint64_t LoadLe64(const uint8_t *data, uint32_t len)
+{
+    uint64_t value = 0;
+    for (uint32_t i = 0; i < len; i++) {
+        value |= (uint64_t)data[i] << (i * BITS_PER_BYTE);
+    }
+    return value;
+}
+
+/* SipHash-1-3, the seed is random per process so remote peers can not aim packets at one probe chain */
+uint64_t DiscBleRecvTableHash(const RecvTable *table, const uint8_t *payload, uint16_t len)
+{
+    SipState s = {
+        .v0 = SIP_INIT_V0 ^ table->seed[0],
+        .v1 = SIP_INIT_V1 ^ table->seed[1],
+        .v2 = SIP_INIT_V2 ^ table->seed[0],
+        .v3 = SIP_INIT_V3 ^ table->seed[1],
+    };
+    uint32_t offset = 0;
+    for (; offset + SIP_BLOCK_LEN <= len; offset += SIP_BLOCK_LEN) {
+        uint64_t m = LoadLe64(payload + offset, SIP_BLOCK_LEN);
+        s.v3 ^= m;
+        SipRound(&s);
+        s.v0 ^= m;
+    }
+    uint64_t last = ((uint64_t)len << SIP_LEN_SHIFT) | LoadLe64(payload + offset, len - offset);
+    s.v3 ^= last;
+    SipRound(&s);
+    s.v0 ^= last;
+    s.v2 ^= SIP_FINAL_XOR;
+    for (uint32_t i = 0; i < SIP_FINAL_ROUNDS; i++) {
+        SipRound(&s);
+    }
+    return s.v0 ^ s.v1 ^ s.v2 ^ s.v3;
+}
+
+static void AccountCapBitMap(RecvTable *table, const uint32_t *capBitMap, bool isAdd)
+{
+    for (uint32_t index = 0; index < CAPABILITY_NUM; index++) {
+        for (uint32_t pos = 0; pos < RECV_CAP_BIT_NUM; pos++) {
+            if ((capBitMap[index] & (1U << pos)) == 0) {
+                continue;
+            }
+            if (isAdd) {
+                if (table->capCount[index][pos]++ == 0) {
+                    table->aggregateCap[index] |= (1U << pos);
+                }
+            } else if (table->capCount[index][pos] != 0 && --table->capCount[index][pos] == 0) {
+                table->aggregateCap[index] &= ~(1U << pos);
+            }
+        }
+    }
+}
+
+static int32_t FindSlot(const RecvTable *table, const RecvMessage *msg, uint32_t *index)
+{
+    uint32_t pos = (uint32_t)msg->hash & RECV_TABLE_MASK;
+    for (uint32_t i = 0; i < RECV_TABLE_SIZE; i++) {
+        const RecvMessage *slot = &table->slot[pos];
+        if (!slot->isUsed) {
+            *index = pos;
+            return SOFTBUS_NOT_FIND;
+        }
+        if (slot->hash == msg->hash && slot->payloadLen == msg->payloadLen &&
+            memcmp(slot->payload, msg->payload, msg->payloadLen) == 0) {
+            *index = pos;
+            return SOFTBUS_OK;
+        }
+        pos = (pos + 1) & RECV_TABLE_MASK;
+    }
+    return SOFTBUS_NO_RESOURCE_ERR;
+}
+
+/* backward shift deletion keeps every probe chain intact without tombstones */
+static void RemoveSlot(RecvTable *table, uint32_t index)
+{
+    RecvMessage *slot = &table->slot[index];
+    AccountCapBitMap(table, slot->capBitMap, false);
+    if (slot->needBrMac) {
+        table->numNeedBrMac--;
+    }
+    table->num--;
+
+    uint32_t hole = index;
+    uint32_t next = index;
+    while (true) {
+        next = (next + 1) & RECV_TABLE_MASK;
+        if (!table->slot[next].isUsed) {
+            break;
+        }
+        uint32_t home = (uint32_t)table->slot[next].hash & RECV_TABLE_MASK;
+        if (((next - home) & RECV_TABLE_MASK) >= ((next - hole) & RECV_TABLE_MASK)) {
+            table->slot[hole] = table->slot[next];
+            hole = next;
+        }
+    }
+    table->slot[hole].isUsed = false;
+}
+
+int32_t DiscBleRecvTableAdd(RecvTable *table, const RecvMessage *msg, bool *isNew)
+{
+    DISC_CHECK_AND_RETURN_RET_LOGE(table != NULL && msg != NULL && isNew != NULL &&
+        msg->payloadLen <= RECV_PAYLOAD_MAX_LEN, SOFTBUS_INVALID_PARAM, DISC_BLE, "invalid param");
+    uint32_t index = 0;
+    int32_t ret = FindSlot(table, msg, &index);
+    if (ret == SOFTBUS_OK) {
+        table->slot[index].expireTime = msg->expireTime;
+        *isNew = false;
+        return SOFTBUS_OK;
+    }
+    DISC_CHECK_AND_RETURN_RET_LOGW(ret == SOFTBUS_NOT_FIND && table->num < RECV_TABLE_MAX_NUM,
+        SOFTBUS_NO_RESOURCE_ERR, DISC_BLE, "recv table is full, num=%{public}u", table->num);
+    table->slot[index] = *msg;
+    table->slot[index].isUsed = true;
+    AccountCapBitMap(table, msg->capBitMap, true);
+    if (msg->needBrMac) {
+        table->numNeedBrMac++;
+    }
+    table->num++;
+    *isNew = true;
+    return SOFTBUS_OK;
+}
+
+int32_t DiscBleRecvTableGetActionKey(const RecvTable *table, const RecvMessage *msg, uint8_t *key, uint32_t len)
+{
+    DISC_CHECK_AND_RETURN_RET_LOGE(table != NULL && msg != NULL && key != NULL && len == SHA_HASH_LEN &&
+        msg->payloadLen <= RECV_PAYLOAD_MAX_LEN, SOFTBUS_INVALID_PARAM, DISC_BLE, "invalid param");
+    uint32_t index = 0;
+    if (FindSlot(table, msg, &index) != SOFTBUS_OK) {
+        return SOFTBUS_NOT_FIND;
+    }
+    if (memcpy_s(key, len, table->slot[index].actionKey, sizeof(table->slot[index].actionKey)) != EOK) {
+        DISC_LOGE(DISC_BLE, "copy action key fail");
+        return SOFTBUS_MEM_ERR;
+    }
+    return SOFTBUS_OK;
+}
+
+uint32_t DiscBleRecvTableExpire(RecvTable *table, uint64_t now, uint64_t *nextExpireTime)
+{
+    DISC_CHECK_AND_RETURN_RET_LOGE(table != NULL && nextExpireTime != NULL, 0, DISC_BLE, "invalid param");
+    uint32_t removed = 0;
+    uint64_t next = 0;
+    for (uint32_t index = 0; index < RECV_TABLE_SIZE && table->num != 0;) {
+        RecvMessage *slot = &table->slot[index];
+        if (slot->isUsed && slot->expireTime <= now) {
+            // a shifted entry lands on this index, look at it again
+            RemoveSlot(table, index);
+            removed++;
+            continue;
+        }
+        if (slot->isUsed && (next == 0 || slot->expireTime < next)) {
+            next = slot->expireTime;
+        }
+        index++;
+    }
+    *nextExpireTime = next;
+    return removed;
+}
+
+void DiscBleRecvTableClear(RecvTable *table)
+{
+    DISC_CHECK_AND_RETURN_LOGE(table != NULL, DISC_BLE, "invalid param");
+    uint64_t seed[2] = { table->seed[0], table->seed[1] };
+    (void)memset_s(table, sizeof(RecvTable), 0, sizeof(RecvTable));
+    table->seed[0] = seed[0];
+    table->seed[1] = seed[1];
+}
+
+int32_t DiscBleRecvTableInit(RecvTable *table)
+{
+    DISC_CHECK_AND_RETURN_RET_LOGE(table != NULL, SOFTBUS_INVALID_PARAM, DISC_BLE, "invalid param");
+    (void)memset_s(table, sizeof(RecvTable), 0, sizeof(RecvTable));
+    int32_t ret = SoftBusGenerateRandomArray((unsigned char *)table->seed, sizeof(table->seed));
+    DISC_CHECK_AND_RETURN_RET_LOGE(ret == SOFTBUS_OK, ret, DISC_BLE, "generate recv table seed fail");
+    return SOFTBUS_OK;
+}
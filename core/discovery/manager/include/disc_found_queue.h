@@ -0,0 +1,53 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DISC_FOUND_QUEUE_H
+#define DISC_FOUND_QUEUE_H
+
+#include <stdint.h>
+
+#include "disc_manager_struct.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* max pending reports per subscriber package, the oldest report is dropped on overflow */
+#define DISC_FOUND_QUEUE_MAX        32
+/* an identical report of the same device to the same subscribe id inside the window is dropped */
+#define DISC_FOUND_DEDUP_WINDOW_MS  1000
+
+typedef int32_t (*DiscFoundDeliverFunc)(const char *packageName, const DeviceInfo *device,
+    const InnerDeviceInfoAddtions *additions, int32_t subscribeId);
+
+int32_t DiscFoundQueueInit(void);
+void DiscFoundQueueDeinit(void);
+
+/* queue a report for one subscriber, never calls the deliver func, safe under the discovery list lock */
+int32_t DiscFoundQueuePush(const char *packageName, int32_t subscribeId, int32_t pid, DiscFoundDeliverFunc deliver,
+    const DeviceInfo *device, const InnerDeviceInfoAddtions *additions);
+/* hand the queued reports to the delivery worker, must be called without the discovery list lock */
+void DiscFoundQueueSchedule(void);
+/*
+ * drop pending reports and dedup records of a subscriber, subscribeId -1 matches every subscribe id of the pid,
+ * returns after a report of the subscriber being delivered has been handed over
+ */
+void DiscFoundQueueRemove(const char *packageName, int32_t subscribeId, int32_t pid);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* DISC_FOUND_QUEUE_H */
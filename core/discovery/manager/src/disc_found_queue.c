@@ -0,0 +1,507 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "disc_found_queue.h"
+
+#include "common_list.h"
+#include "disc_log.h"
+#include "message_handler.h"
+#include "securec.h"
+#include "softbus_adapter_mem.h"
+#include "softbus_adapter_thread.h"
+#include "softbus_adapter_timer.h"
+#include "softbus_def.h"
+#include "softbus_error_code.h"
+
+#define MSG_DRAIN_FOUND_QUEUE    1
+#define DISC_FOUND_RECORD_MAX    64
+#define FNV_OFFSET_BASIS         2166136261U
+#define FNV_PRIME                16777619U
+
+typedef struct {
+    ListNode node;
+    char packageName[PKG_NAME_SIZE_MAX];
+    int32_t subscribeId;
+    int32_t pid;
+    DiscFoundDeliverFunc deliver;
+    DeviceInfo device;
+    InnerDeviceInfoAddtions additions;
+} FoundEvent;
+
+typedef struct {
+    ListNode node;
+    int32_t subscribeId;
+    int32_t pid;
+    char devId[DISC_MAX_DEVICE_ID_LEN];
+    uint32_t digest;
+    uint64_t pushTime;
+} FoundRecord;
+
+typedef struct {
+    ListNode node;
+    char packageName[PKG_NAME_SIZE_MAX];
+    uint32_t eventNum;
+    ListNode eventList;
+    uint32_t recordNum;
+    ListNode recordList;
+    uint32_t dropCount;
+} FoundQueue;
+
+static SoftBusMutex g_foundQueueLock;
+static ListNode g_foundQueueList = { &g_foundQueueList, &g_foundQueueList };
+static SoftBusHandler g_foundHandler = { 0 };
+/* reports popped from the queues and not delivered yet, still dropped by a remove */
+static ListNode g_deliverList = { &g_deliverList, &g_deliverList };
+/* the report being delivered outside the lock, a remove of its subscriber waits on g_deliverCond */
+static FoundEvent *g_deliveringEvent = NULL;
+static SoftBusThread g_deliveringThread = 0;
+static SoftBusCond g_deliverCond;
+static bool g_isDrainPosted = false;
+static bool g_isInited = false;
+
+static uint32_t DigestBytes(uint32_t digest, const void *data, uint32_t len)
+{
+    const uint8_t *bytes = (const uint8_t *)data;
+    for (uint32_t i = 0; i < len; i++) {
+        digest = (digest ^ bytes[i]) * FNV_PRIME;
+    }
+    return digest;
+}
+
+static uint32_t DigestString(uint32_t digest, const char *str, uint32_t maxLen)
+{
+    return DigestBytes(digest, str, strnlen(str, maxLen));
+}
+
+/* only the union member of the address type is hashed, the rest of the union and the padding are not set */
+static uint32_t DigestAddr(uint32_t digest, const ConnectionAddr *addr)
+{
+    digest = DigestBytes(digest, &addr->type, sizeof(addr->type));
+    switch (addr->type) {
+        case CONNECTION_ADDR_BR:
+            digest = DigestString(digest, addr->info.br.brMac, BT_MAC_LEN);
+            break;
+        case CONNECTION_ADDR_BLE:
+            digest = DigestBytes(digest, &addr->info.ble.protocol, sizeof(addr->info.ble.protocol));
+            digest = DigestString(digest, addr->info.ble.bleMac, BT_MAC_LEN);
+            digest = DigestBytes(digest, addr->info.ble.udidHash, UDID_HASH_LEN);
+            digest = DigestBytes(digest, &addr->info.ble.psm, sizeof(addr->info.ble.psm));
+            digest = DigestBytes(digest, &addr->info.ble.priority, sizeof(addr->info.ble.priority));
+            break;
+        case CONNECTION_ADDR_WLAN:
+        case CONNECTION_ADDR_ETH:
+        case CONNECTION_ADDR_NCM:
+            digest = DigestString(digest, addr->info.ip.ip, IP_STR_MAX_LEN);
+            digest = DigestBytes(digest, &addr->info.ip.port, sizeof(addr->info.ip.port));
+            digest = DigestBytes(digest, addr->info.ip.udidHash, UDID_HASH_LEN);
+            break;
+        default:
+            break;
+    }
+    digest = DigestString(digest, addr->peerUid, MAX_ACCOUNT_HASH_LEN);
+    digest = DigestBytes(digest, &addr->deviceKeyId.hasDeviceKeyId, sizeof(addr->deviceKeyId.hasDeviceKeyId));
+    digest = DigestBytes(digest, &addr->deviceKeyId.localDeviceKeyId, sizeof(addr->deviceKeyId.localDeviceKeyId));
+    digest = DigestBytes(digest, &addr->deviceKeyId.remoteDeviceKeyId, sizeof(addr->deviceKeyId.remoteDeviceKeyId));
+    return DigestBytes(digest, &addr->deviceTypeId, sizeof(addr->deviceTypeId));
+}
+
+/* hashed field by field, the structs carry padding bytes the reporting media do not clear */
+static uint32_t GetReportDigest(const DeviceInfo *device, const InnerDeviceInfoAddtions *additions)
+{
+    uint32_t digest = FNV_OFFSET_BASIS;
+    digest = DigestString(digest, device->devId, DISC_MAX_DEVICE_ID_LEN);
+    digest = DigestString(digest, device->accountHash, MAX_ACCOUNT_HASH_LEN);
+    digest = DigestBytes(digest, &device->devType, sizeof(device->devType));
+    digest = DigestString(digest, device->devName, DISC_MAX_DEVICE_NAME_LEN);
+    digest = DigestBytes(digest, &device->isOnline, sizeof(device->isOnline));
+    uint32_t addrNum = device->addrNum < CONNECTION_ADDR_MAX ? device->addrNum : CONNECTION_ADDR_MAX;
+    digest = DigestBytes(digest, &addrNum, sizeof(addrNum));
+    for (uint32_t i = 0; i < addrNum; i++) {
+        digest = DigestAddr(digest, &device->addr[i]);
+    }
+    uint32_t bitmapNum = device->capabilityBitmapNum < DISC_MAX_CAPABILITY_NUM ?
+        device->capabilityBitmapNum : DISC_MAX_CAPABILITY_NUM;
+    digest = DigestBytes(digest, &bitmapNum, sizeof(bitmapNum));
+    digest = DigestBytes(digest, device->capabilityBitmap, bitmapNum * sizeof(device->capabilityBitmap[0]));
+    digest = DigestString(digest, device->custData, DISC_MAX_CUST_DATA_LEN);
+    digest = DigestBytes(digest, &device->range, sizeof(device->range));
+    return DigestBytes(digest, &additions->medium, sizeof(additions->medium));
+}
+
+static bool IsSameDevice(int32_t subscribeId, int32_t pid, const char *devId, const FoundEvent *event)
+{
+    return subscribeId == event->subscribeId && pid == event->pid &&
+        strncmp(devId, event->device.devId, DISC_MAX_DEVICE_ID_LEN) == 0;
+}
+
+static bool IsSameRecord(int32_t subscribeId, int32_t pid, const char *devId, const FoundRecord *record)
+{
+    return subscribeId == record->subscribeId && pid == record->pid &&
+        strncmp(devId, record->devId, DISC_MAX_DEVICE_ID_LEN) == 0;
+}
+
+/* subscribeId -1 matches every subscribe id of the pid */
+static bool IsRemovedSubscriber(int32_t subscribeId, int32_t pid, int32_t removeId, int32_t removePid)
+{
+    return pid == removePid && (removeId < 0 || subscribeId == removeId);
+}
+
+static FoundQueue *GetFoundQueue(const char *packageName, bool isCreate)
+{
+    FoundQueue *queue = NULL;
+    LIST_FOR_EACH_ENTRY(queue, &g_foundQueueList, FoundQueue, node) {
+        if (strcmp(queue->packageName, packageName) == 0) {
+            return queue;
+        }
+    }
+    if (!isCreate) {
+        return NULL;
+    }
+    queue = (FoundQueue *)SoftBusCalloc(sizeof(FoundQueue));
+    DISC_CHECK_AND_RETURN_RET_LOGE(queue != NULL, NULL, DISC_CONTROL, "calloc found queue fail");
+    if (strcpy_s(queue->packageName, sizeof(queue->packageName), packageName) != EOK) {
+        DISC_LOGE(DISC_CONTROL, "copy packageName fail");
+        SoftBusFree(queue);
+        return NULL;
+    }
+    ListInit(&queue->eventList);
+    ListInit(&queue->recordList);
+    ListTailInsert(&g_foundQueueList, &queue->node);
+    return queue;
+}
+
+static void FreeFoundQueue(FoundQueue *queue)
+{
+    FoundEvent *event = NULL;
+    FoundEvent *nextEvent = NULL;
+    LIST_FOR_EACH_ENTRY_SAFE(event, nextEvent, &queue->eventList, FoundEvent, node) {
+        ListDelete(&event->node);
+        SoftBusFree(event);
+    }
+    FoundRecord *record = NULL;
+    FoundRecord *nextRecord = NULL;
+    LIST_FOR_EACH_ENTRY_SAFE(record, nextRecord, &queue->recordList, FoundRecord, node) {
+        ListDelete(&record->node);
+        SoftBusFree(record);
+    }
+    ListDelete(&queue->node);
+    SoftBusFree(queue);
+}
+
+/* returns true when the same report was already queued inside the dedup window */
+static bool UpdateFoundRecord(FoundQueue *queue, int32_t subscribeId, int32_t pid, const DeviceInfo *device,
+    uint32_t digest)
+{
+    uint64_t now = SoftBusGetSysTimeMs();
+    FoundRecord *record = NULL;
+    LIST_FOR_EACH_ENTRY(record, &queue->recordList, FoundRecord, node) {
+        if (!IsSameRecord(subscribeId, pid, device->devId, record)) {
+            continue;
+        }
+        if (record->digest == digest && now - record->pushTime < DISC_FOUND_DEDUP_WINDOW_MS) {
+            return true;
+        }
+        record->digest = digest;
+        record->pushTime = now;
+        ListDelete(&record->node);
+        ListTailInsert(&queue->recordList, &record->node);
+        return false;
+    }
+    if (queue->recordNum >= DISC_FOUND_RECORD_MAX) {
+        record = LIST_ENTRY(queue->recordList.next, FoundRecord, node);
+        ListDelete(&record->node);
+        queue->recordNum--;
+    } else {
+        record = (FoundRecord *)SoftBusCalloc(sizeof(FoundRecord));
+        DISC_CHECK_AND_RETURN_RET_LOGE(record != NULL, false, DISC_CONTROL, "calloc found record fail");
+    }
+    record->subscribeId = subscribeId;
+    record->pid = pid;
+    if (strncpy_s(record->devId, sizeof(record->devId), device->devId, DISC_MAX_DEVICE_ID_LEN - 1) != EOK) {
+        DISC_LOGW(DISC_CONTROL, "copy devId fail");
+    }
+    record->digest = digest;
+    record->pushTime = now;
+    ListTailInsert(&queue->recordList, &record->node);
+    queue->recordNum++;
+    return false;
+}
+
+/* a pending report of the same device is replaced in place, the subscriber only needs the latest one */
+static FoundEvent *GetPendingEvent(FoundQueue *queue, int32_t subscribeId, int32_t pid, const DeviceInfo *device)
+{
+    FoundEvent *event = NULL;
+    LIST_FOR_EACH_ENTRY(event, &queue->eventList, FoundEvent, node) {
+        if (IsSameDevice(subscribeId, pid, device->devId, event)) {
+            return event;
+        }
+    }
+    if (queue->eventNum >= DISC_FOUND_QUEUE_MAX) {
+        event = LIST_ENTRY(queue->eventList.next, FoundEvent, node);
+        ListDelete(&event->node);
+        queue->eventNum--;
+        if (queue->dropCount++ == 0) {
+            DISC_LOGW(DISC_CONTROL, "found queue full, drop oldest report. packageName=%{public}s",
+                queue->packageName);
+        }
+    } else {
+        event = (FoundEvent *)SoftBusCalloc(sizeof(FoundEvent));
+        DISC_CHECK_AND_RETURN_RET_LOGE(event != NULL, NULL, DISC_CONTROL, "calloc found event fail");
+    }
+    ListTailInsert(&queue->eventList, &event->node);
+    queue->eventNum++;
+    return event;
+}
+
+int32_t DiscFoundQueuePush(const char *packageName, int32_t subscribeId, int32_t pid, DiscFoundDeliverFunc deliver,
+    const DeviceInfo *device, const InnerDeviceInfoAddtions *additions)
+{
+    DISC_CHECK_AND_RETURN_RET_LOGE(packageName != NULL && deliver != NULL && device != NULL && additions != NULL,
+        SOFTBUS_INVALID_PARAM, DISC_CONTROL, "invalid param");
+    DISC_CHECK_AND_RETURN_RET_LOGE(g_isInited, SOFTBUS_NO_INIT, DISC_CONTROL, "found queue is not inited");
+    uint32_t digest = GetReportDigest(device, additions);
+    DISC_CHECK_AND_RETURN_RET_LOGE(SoftBusMutexLock(&g_foundQueueLock) == SOFTBUS_OK, SOFTBUS_LOCK_ERR,
+        DISC_CONTROL, "lock fail");
+    FoundQueue *queue = GetFoundQueue(packageName, true);
+    if (queue == NULL) {
+        (void)SoftBusMutexUnlock(&g_foundQueueLock);
+        return SOFTBUS_MALLOC_ERR;
+    }
+    if (UpdateFoundRecord(queue, subscribeId, pid, device, digest)) {
+        (void)SoftBusMutexUnlock(&g_foundQueueLock);
+        return SOFTBUS_OK;
+    }
+    FoundEvent *event = GetPendingEvent(queue, subscribeId, pid, device);
+    if (event == NULL) {
+        (void)SoftBusMutexUnlock(&g_foundQueueLock);
+        return SOFTBUS_MALLOC_ERR;
+    }
+    (void)memcpy_s(event->packageName, sizeof(event->packageName), queue->packageName, sizeof(queue->packageName));
+    event->subscribeId = subscribeId;
+    event->pid = pid;
+    event->deliver = deliver;
+    event->device = *device;
+    event->additions = *additions;
+    (void)SoftBusMutexUnlock(&g_foundQueueLock);
+    return SOFTBUS_OK;
+}
+
+/* take the head report of every queue so one slow subscriber costs the others at most one callback per round */
+static uint32_t PopFoundEvents(ListNode *batch)
+{
+    uint32_t num = 0;
+    FoundQueue *queue = NULL;
+    LIST_FOR_EACH_ENTRY(queue, &g_foundQueueList, FoundQueue, node) {
+        if (queue->eventNum == 0) {
+            continue;
+        }
+        FoundEvent *event = LIST_ENTRY(queue->eventList.next, FoundEvent, node);
+        ListDelete(&event->node);
+        queue->eventNum--;
+        if (queue->eventNum == 0 && queue->dropCount != 0) {
+            DISC_LOGW(DISC_CONTROL, "found queue drained. packageName=%{public}s, dropCount=%{public}u",
+                queue->packageName, queue->dropCount);
+            queue->dropCount = 0;
+        }
+        ListTailInsert(batch, &event->node);
+        num++;
+    }
+    return num;
+}
+
+/* reports are taken one by one under the lock, so a remove drops the ones of its subscriber still waiting */
+static void DrainFoundQueue(void)
+{
+    while (true) {
+        if (SoftBusMutexLock(&g_foundQueueLock) != SOFTBUS_OK) {
+            DISC_LOGE(DISC_CONTROL, "lock fail");
+            return;
+        }
+        if (IsListEmpty(&g_deliverList) && PopFoundEvents(&g_deliverList) == 0) {
+            g_isDrainPosted = false;
+            (void)SoftBusMutexUnlock(&g_foundQueueLock);
+            return;
+        }
+        FoundEvent *event = LIST_ENTRY(g_deliverList.next, FoundEvent, node);
+        ListDelete(&event->node);
+        g_deliveringEvent = event;
+        g_deliveringThread = SoftBusThreadGetSelf();
+        (void)SoftBusMutexUnlock(&g_foundQueueLock);
+
+        (void)event->deliver(event->packageName, &event->device, &event->additions, event->subscribeId);
+
+        if (SoftBusMutexLock(&g_foundQueueLock) != SOFTBUS_OK) {
+            DISC_LOGE(DISC_CONTROL, "lock fail");
+            return;
+        }
+        g_deliveringEvent = NULL;
+        (void)SoftBusCondBroadcast(&g_deliverCond);
+        (void)SoftBusMutexUnlock(&g_foundQueueLock);
+        SoftBusFree(event);
+    }
+}
+
+static void HandleFoundMessage(SoftBusMessage *msg)
+{
+    DISC_CHECK_AND_RETURN_LOGE(msg != NULL, DISC_CONTROL, "msg is null");
+    if (msg->what == MSG_DRAIN_FOUND_QUEUE) {
+        DrainFoundQueue();
+    }
+}
+
+static bool HasPendingEvent(void)
+{
+    FoundQueue *queue = NULL;
+    LIST_FOR_EACH_ENTRY(queue, &g_foundQueueList, FoundQueue, node) {
+        if (queue->eventNum != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+void DiscFoundQueueSchedule(void)
+{
+    DISC_CHECK_AND_RETURN_LOGE(g_isInited, DISC_CONTROL, "found queue is not inited");
+    DISC_CHECK_AND_RETURN_LOGE(SoftBusMutexLock(&g_foundQueueLock) == SOFTBUS_OK, DISC_CONTROL, "lock fail");
+    if (g_isDrainPosted || !HasPendingEvent()) {
+        (void)SoftBusMutexUnlock(&g_foundQueueLock);
+        return;
+    }
+    g_isDrainPosted = true;
+    (void)SoftBusMutexUnlock(&g_foundQueueLock);
+
+    SoftBusMessage *msg = MallocMessage();
+    if (msg == NULL) {
+        DISC_LOGW(DISC_CONTROL, "malloc msg fail, deliver in caller");
+        DrainFoundQueue();
+        return;
+    }
+    msg->what = MSG_DRAIN_FOUND_QUEUE;
+    msg->handler = &g_foundHandler;
+    g_foundHandler.looper->PostMessage(g_foundHandler.looper, msg);
+}
+
+static void RemoveDeliverEvents(const char *packageName, int32_t subscribeId, int32_t pid)
+{
+    FoundEvent *event = NULL;
+    FoundEvent *nextEvent = NULL;
+    LIST_FOR_EACH_ENTRY_SAFE(event, nextEvent, &g_deliverList, FoundEvent, node) {
+        if (strcmp(event->packageName, packageName) == 0 &&
+            IsRemovedSubscriber(event->subscribeId, event->pid, subscribeId, pid)) {
+            ListDelete(&event->node);
+            SoftBusFree(event);
+        }
+    }
+}
+
+static void RemoveQueueEvents(FoundQueue *queue, int32_t subscribeId, int32_t pid)
+{
+    FoundEvent *event = NULL;
+    FoundEvent *nextEvent = NULL;
+    LIST_FOR_EACH_ENTRY_SAFE(event, nextEvent, &queue->eventList, FoundEvent, node) {
+        if (IsRemovedSubscriber(event->subscribeId, event->pid, subscribeId, pid)) {
+            ListDelete(&event->node);
+            SoftBusFree(event);
+            queue->eventNum--;
+        }
+    }
+    FoundRecord *record = NULL;
+    FoundRecord *nextRecord = NULL;
+    LIST_FOR_EACH_ENTRY_SAFE(record, nextRecord, &queue->recordList, FoundRecord, node) {
+        if (IsRemovedSubscriber(record->subscribeId, record->pid, subscribeId, pid)) {
+            ListDelete(&record->node);
+            SoftBusFree(record);
+            queue->recordNum--;
+        }
+    }
+    if (queue->eventNum == 0 && queue->recordNum == 0) {
+        FreeFoundQueue(queue);
+    }
+}
+
+/* a callback that stops its own discovery runs on the delivering thread and must not wait for itself */
+static void WaitDeliveringEvent(const char *packageName, int32_t subscribeId, int32_t pid)
+{
+    while (g_deliveringEvent != NULL && g_deliveringThread != SoftBusThreadGetSelf() &&
+        (packageName == NULL || (strcmp(g_deliveringEvent->packageName, packageName) == 0 &&
+        IsRemovedSubscriber(g_deliveringEvent->subscribeId, g_deliveringEvent->pid, subscribeId, pid)))) {
+        if (SoftBusCondWait(&g_deliverCond, &g_foundQueueLock, NULL) != SOFTBUS_OK) {
+            DISC_LOGE(DISC_CONTROL, "wait delivering report fail");
+            return;
+        }
+    }
+}
+
+void DiscFoundQueueRemove(const char *packageName, int32_t subscribeId, int32_t pid)
+{
+    DISC_CHECK_AND_RETURN_LOGE(packageName != NULL, DISC_CONTROL, "packageName is null");
+    DISC_CHECK_AND_RETURN_LOGW(g_isInited, DISC_CONTROL, "found queue is not inited");
+    DISC_CHECK_AND_RETURN_LOGE(SoftBusMutexLock(&g_foundQueueLock) == SOFTBUS_OK, DISC_CONTROL, "lock fail");
+    RemoveDeliverEvents(packageName, subscribeId, pid);
+    FoundQueue *queue = GetFoundQueue(packageName, false);
+    if (queue != NULL) {
+        RemoveQueueEvents(queue, subscribeId, pid);
+    }
+    WaitDeliveringEvent(packageName, subscribeId, pid);
+    (void)SoftBusMutexUnlock(&g_foundQueueLock);
+}
+
+int32_t DiscFoundQueueInit(void)
+{
+    DISC_CHECK_AND_RETURN_RET_LOGW(!g_isInited, SOFTBUS_OK, DISC_INIT, "found queue already inited");
+    /* loopers are never given back to the pool, keep the first one for every later init */
+    if (g_foundHandler.looper == NULL) {
+        SoftBusLooper *looper = CreateNewLooper("Disc_Found_Lp");
+        DISC_CHECK_AND_RETURN_RET_LOGE(looper != NULL, SOFTBUS_LOOPER_ERR, DISC_INIT, "create found looper fail");
+        if (SoftBusMutexInit(&g_foundQueueLock, NULL) != SOFTBUS_OK) {
+            DISC_LOGE(DISC_INIT, "init found queue lock fail");
+            DestroyLooper(looper);
+            return SOFTBUS_LOCK_ERR;
+        }
+        if (SoftBusCondInit(&g_deliverCond) != SOFTBUS_OK) {
+            DISC_LOGE(DISC_INIT, "init found queue cond fail");
+            (void)SoftBusMutexDestroy(&g_foundQueueLock);
+            DestroyLooper(looper);
+            return SOFTBUS_LOCK_ERR;
+        }
+        SetLooperMemModule(looper, SOFTBUS_MEM_MODULE_DISC);
+        g_foundHandler.name = (char *)"disc_found_handler";
+        g_foundHandler.HandleMessage = HandleFoundMessage;
+        g_foundHandler.looper = looper;
+    }
+    g_isInited = true;
+    return SOFTBUS_OK;
+}
+
+void DiscFoundQueueDeinit(void)
+{
+    DISC_CHECK_AND_RETURN_LOGW(g_isInited, DISC_INIT, "found queue is not inited");
+    DISC_CHECK_AND_RETURN_LOGE(SoftBusMutexLock(&g_foundQueueLock) == SOFTBUS_OK, DISC_INIT, "lock fail");
+    g_isInited = false;
+    FoundEvent *event = NULL;
+    FoundEvent *nextEvent = NULL;
+    LIST_FOR_EACH_ENTRY_SAFE(event, nextEvent, &g_deliverList, FoundEvent, node) {
+        ListDelete(&event->node);
+        SoftBusFree(event);
+    }
+    FoundQueue *queue = NULL;
+    FoundQueue *nextQueue = NULL;
+    LIST_FOR_EACH_ENTRY_SAFE(queue, nextQueue, &g_foundQueueList, FoundQueue, node) {
+        FreeFoundQueue(queue);
+    }
+    WaitDeliveringEvent(NULL, -1, 0);
+    (void)SoftBusMutexUnlock(&g_foundQueueLock);
+}
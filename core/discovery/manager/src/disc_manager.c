@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -22,6 +22,7 @@
 #include "disc_ble_dispatcher.h"
 #include "disc_coap.h"
 #include "disc_event.h"
+#include "disc_found_queue.h"
 #include "disc_log.h"
 #include "disc_mgr_config.h"
 #include "disc_nfc_dispatcher.h"
@@ -404,8 +405,9 @@ static void InnerDeviceFound(DiscInfo *infoNode, const DeviceInfo *device,
 {
     if (infoNode->item != NULL && infoNode->item->callback.serverCb.OnServerDeviceFound != NULL &&
         !IsInnerModule(infoNode)) {
-        (void)infoNode->item->callback.serverCb.OnServerDeviceFound(infoNode->item->packageName,
-            device, additions, infoNode->id);
+        /* the client callback is an ipc, it is delivered by the found queue after the list lock is released */
+        (void)DiscFoundQueuePush(infoNode->item->packageName, infoNode->id, infoNode->pid,
+            infoNode->item->callback.serverCb.OnServerDeviceFound, device, additions);
         return;
     }
 
@@ -434,7 +436,7 @@ static void DiscOnDeviceFound(const DeviceInfo *device, const InnerDeviceInfoAdd
 
         if (SoftBusMutexLock(&(g_discoveryInfoList->lock)) != SOFTBUS_OK) {
             DISC_LOGE(DISC_CONTROL, "lock fail");
-            return;
+            break;
         }
         DiscInfo *infoNode = NULL;
         LIST_FOR_EACH_ENTRY(infoNode, &(g_capabilityList[tmp]), DiscInfo, capNode) {
@@ -444,6 +446,7 @@ static void DiscOnDeviceFound(const DeviceInfo *device, const InnerDeviceInfoAdd
         }
         (void)SoftBusMutexUnlock(&(g_discoveryInfoList->lock));
     }
+    DiscFoundQueueSchedule();
 }
 
 static int32_t CheckPublishInfo(const PublishInfo *info)
@@ -984,6 +987,7 @@ static int32_t InnerStopDiscovery(const char *packageName, int32_t subscribeId,
             ret = SOFTBUS_DISCOVER_MANAGER_INFO_NOT_DELETE;
             break;
         }
+        DiscFoundQueueRemove(packageName, subscribeId, infoNode->pid);
         if (DiscIsOsAccountConstraint()) {
             DISC_LOGW(DISC_CONTROL, "disc stop discovery constraint");
             FreeDiscInfo(infoNode, type);
@@ -1392,6 +1396,7 @@ static void RemoveDiscInfoForPublish(const char *pkgName, int32_t pid)
 static void RemoveDiscInfoForDiscovery(const char *pkgName, int32_t pid)
 {
     RemoveDiscInfoByPackageName(g_discoveryInfoList, SUBSCRIBE_SERVICE, pkgName, pid);
+    DiscFoundQueueRemove(pkgName, -1, pid);
 }
 
 void DiscMgrDeathCallback(const char *pkgName, int32_t pid)
@@ -1529,6 +1534,8 @@ void DiscConstraintEventDeInit(void)
 int32_t DiscMgrInit(void)
 {
     DISC_CHECK_AND_RETURN_RET_LOGE(g_isInited == false, SOFTBUS_OK, DISC_INIT, "already inited");
+    DISC_CHECK_AND_RETURN_RET_LOGE(DiscFoundQueueInit() == SOFTBUS_OK, SOFTBUS_DISCOVER_MANAGER_INIT_FAIL, DISC_INIT,
+        "init found queue fail");
 
     g_discMgrMediumCb.OnDeviceFound = DiscOnDeviceFound;
 
@@ -1538,13 +1545,17 @@ int32_t DiscMgrInit(void)
     g_discNfcInterface = DiscNfcDispatcherInit(&g_discMgrMediumCb);
 
     g_publishInfoList = CreateSoftBusList();
-    DISC_CHECK_AND_RETURN_RET_LOGE(g_publishInfoList != NULL, SOFTBUS_DISCOVER_MANAGER_INIT_FAIL, DISC_INIT,
-        "init publish info list fail");
+    if (g_publishInfoList == NULL) {
+        DISC_LOGE(DISC_INIT, "init publish info list fail");
+        DiscFoundQueueDeinit();
+        return SOFTBUS_DISCOVER_MANAGER_INIT_FAIL;
+    }
     g_discoveryInfoList = CreateSoftBusList();
     if (g_discoveryInfoList == NULL) {
         DISC_LOGE(DISC_INIT, "init discovery Info List fail");
         DestroySoftBusList(g_publishInfoList);
         g_publishInfoList = NULL;
+        DiscFoundQueueDeinit();
         return SOFTBUS_DISCOVER_MANAGER_INIT_FAIL;
     }
 
@@ -1572,6 +1583,7 @@ void DiscMgrDeinit(void)
     DiscBleDeinit();
     DiscUsbDispatcherDeinit();
     DiscNfcDispatcherDeinit();
+    DiscFoundQueueDeinit();
 
     g_isInited = false;
     DISC_LOGI(DISC_INIT, "disc manager deinit success");
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -41,6 +41,7 @@
 #include "lnn_init_monitor.h"
 #include "lnn_sle_monitor.h"
 #include "softbus_adapter_bt_common.h"
+#include "softbus_adapter_mem.h"
 #include "softbus_disc_server.h"
 #include "softbus_feature_config.h"
 #include "legacy/softbus_hidumper_interface.h"
@@ -84,6 +85,7 @@ static void ServerModuleDeinit(void)
     DeinitSoftbusSysEvt();
     DeinitDdos();
     LnnDeinitSle();
+    SoftBusMemTrim();
 }
 
 bool GetServerIsInit(void)
@@ -222,6 +224,7 @@ static int32_t InitServicesAndModules(void)
 static void ReclaimMemForSoftBus(void *para)
 {
     (void)para;
+    SoftBusMemTrim();
     int32_t softBusPid = getpid();
     COMM_CHECK_AND_RETURN_LOGE(softBusPid > 0, COMM_SVC, "get softbus pid invalid!");
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,11 +16,12 @@
 #ifndef SOFTBUS_SERVER_STUB_H_
 #define SOFTBUS_SERVER_STUB_H_
 
-#include <map>
+#include <array>
 #include <set>
 #include "if_softbus_server.h"
 #include "iremote_stub.h"
 #include "bus_center_manager.h"
+#include "softbus_server_ipc_interface_code.h"
 
 namespace OHOS {
 class SoftBusServerStub : public IRemoteStub<ISoftBusServer> {
@@ -115,8 +116,9 @@ private:
 
     using SoftbusServerStubFunc =
         int32_t (SoftBusServerStub::*)(MessageParcel &data, MessageParcel &reply);
-    std::map<uint32_t, SoftbusServerStubFunc> memberFuncMap_;
-    std::map<uint32_t, const char*> memberPermissionMap_;
+    // indexed by ipc code, codes outside the table have no handler and need no permission
+    std::array<SoftbusServerStubFunc, SOFTBUS_FUNC_ID_BUIT> memberFuncMap_ {};
+    std::array<const char*, SOFTBUS_FUNC_ID_BUIT> memberPermissionMap_ {};
     std::set<uint32_t> memberConstraintSet_;
 };
 } // namespace OHOS
@@ -15,6 +15,8 @@
 
 #include "softbus_server_stub.h"
 
+#include <map>
+
 #include "lnn_ohos_account_adapter.h"
 #include "securec.h"
 
@@ -323,11 +325,10 @@ void SoftBusServerStub::InitMemberConstraintSet()
 
 int32_t SoftBusServerStub::CheckPermission(uint32_t code)
 {
-    auto itPerm = memberPermissionMap_.find(code);
-    if (itPerm == memberPermissionMap_.end()) {
+    if (code >= memberPermissionMap_.size()) {
         return SOFTBUS_OK;
     }
-    const char *permission = itPerm->second;
+    const char *permission = memberPermissionMap_[code];
     uint32_t callingTokenId = IPCSkeleton::GetCallingTokenID();
     if ((permission != nullptr) &&
         (!SoftBusCheckIsAccessAndRecordAccessToken(callingTokenId, permission))) {
@@ -387,9 +388,8 @@ int32_t SoftBusServerStub::OnRemoteRequest(
         return ret;
     }
 
-    const auto &itFunc = memberFuncMap_.find(code);
-    if (itFunc != memberFuncMap_.end()) {
-        auto memberFunc = itFunc->second;
+    if (code < memberFuncMap_.size()) {
+        auto memberFunc = memberFuncMap_[code];
         if (memberFunc != nullptr) {
             return (this->*memberFunc)(data, reply);
         }
@@ -36,6 +36,7 @@ void TransFreeLanePendingDeinit(void);
 int32_t TransGetConnectOptByConnInfo(const LaneConnInfo *info, ConnectOption *connOpt);
 int32_t TransGetLaneInfo(const SessionParam *param, LaneConnInfo *connInfo, uint32_t *laneHandle);
 int32_t TransAsyncGetLaneInfo(const SessionParam *param, uint32_t *laneHandle, const AppInfo *appInfo);
+int32_t TransAsyncGetLaneInfoByOption(const SessionParam *param, uint32_t *laneHandle, const AppInfo *appInfo);
 int32_t TransGetLaneInfoByOption(const LaneRequestOption *requestOption, LaneConnInfo *connInfo,
     uint32_t *laneHandle, NetWorkingChannelInfo *info);
 bool TransGetAuthTypeByNetWorkId(const char *peerNetWorkId);
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef TRANS_OPEN_TRACE_H
+#define TRANS_OPEN_TRACE_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TRANS_OPEN_TRACE_INVALID_ID 0
+#define TRANS_OPEN_TRACE_RING_NUM   8
+#define TRANS_OPEN_TRACE_RING_SIZE  256
+#define TRANS_OPEN_TRACE_BIND_NUM   64
+
+/* phase boundaries of a socket open on the initiator side, in the order they are crossed */
+typedef enum {
+    TRANS_OPEN_PHASE_START = 0,       /* TransOpenChannel entry */
+    TRANS_OPEN_PHASE_LANE_REQUEST,    /* lane request is posted */
+    TRANS_OPEN_PHASE_LANE_ALLOCED,    /* lane select and link build are done */
+    TRANS_OPEN_PHASE_CHANNEL_CONNECT, /* channel auth and handshake start */
+    TRANS_OPEN_PHASE_CONN_CONNECTED,  /* physical connection of a proxy channel is up */
+    TRANS_OPEN_PHASE_CHANNEL_OPENED,  /* handshake is done and the client is notified to call OnBind */
+    TRANS_OPEN_PHASE_FAILED,
+    TRANS_OPEN_PHASE_BUTT,
+} TransOpenPhase;
+
+/* ids a trace is carried across once the open leaves the calling thread */
+typedef enum {
+    TRANS_OPEN_TRACE_KEY_LANE_HANDLE = 0,
+    TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+    TRANS_OPEN_TRACE_KEY_REQUEST_ID,
+    TRANS_OPEN_TRACE_KEY_BUTT,
+} TransOpenTraceKeyType;
+
+/* channel ids of different channel types can be equal, so CHANNEL_ID keys carry the type */
+static inline int64_t TransOpenTraceChannelKey(int32_t channelType, int32_t channelId)
+{
+    return (int64_t)(((uint64_t)(uint32_t)channelType << 32) | (uint32_t)channelId);
+}
+
+typedef struct {
+    uint32_t traceId;
+    uint32_t phaseMask;
+    uint64_t phaseTimeUs[TRANS_OPEN_PHASE_BUTT];
+} TransOpenSpan;
+
+typedef struct {
+    uint32_t count;
+    uint64_t p50Us;
+    uint64_t p90Us;
+    uint64_t p99Us;
+    uint64_t maxUs;
+} TransOpenPhaseStat;
+
+/* phase[i] is the time spent from the previous recorded phase up to phase i */
+typedef struct {
+    uint32_t openedNum;
+    uint32_t failedNum;
+    TransOpenPhaseStat phase[TRANS_OPEN_PHASE_BUTT];
+    TransOpenPhaseStat total;
+} TransOpenTraceSummary;
+
+int32_t TransOpenTraceInit(void);
+void TransOpenTraceDeinit(void);
+void TransOpenTraceClear(void);
+
+/* start a trace, record TRANS_OPEN_PHASE_START and make it current on this thread */
+uint32_t TransOpenTraceBegin(void);
+void TransOpenTraceSetCurrent(uint32_t traceId);
+uint32_t TransOpenTraceGetCurrent(void);
+
+/*
+ * bind an id to the trace before the id is published: the lane callback, connect result or peer reply
+ * may come back on another thread before the open returns the id to the trace owner.
+ */
+void TransOpenTraceBind(uint32_t traceId, TransOpenTraceKeyType keyType, int64_t key);
+uint32_t TransOpenTraceGetIdByKey(TransOpenTraceKeyType keyType, int64_t key);
+
+/* CHANNEL_OPENED and FAILED end the trace and drop its key bindings */
+void TransOpenTraceRecord(uint32_t traceId, TransOpenPhase phase);
+void TransOpenTraceRecordByKey(TransOpenTraceKeyType keyType, int64_t key, TransOpenPhase phase);
+
+int32_t TransOpenTraceGetSpan(uint32_t traceId, TransOpenSpan *span);
+int32_t TransOpenTraceGetSummary(TransOpenTraceSummary *summary);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* TRANS_OPEN_TRACE_H */
@@ -44,6 +44,7 @@
 #include "trans_lane_manager.h"
 #include "trans_log.h"
 #include "trans_network_statistics.h"
+#include "trans_open_trace.h"
 #include "trans_session_manager.h"
 #include "trans_uk_manager.h"
 #include "trans_udp_channel_manager.h"
@@ -60,6 +61,7 @@
 #define SESSION_NAME_DSL2_RE "com.*security.devicesec"
 #define DB_MAGIC_BW 0x5A5A5A5A   // p2preuse, wifi and br link
 #define MESH_MAGIC_BW 0xA5A5A5A5 // wifi and br link
+#define TRANS_LANE_PENDING_BUCKET_NUM 64 // must be a power of 2
 
 typedef struct {
     bool bSucc;
@@ -74,6 +76,7 @@ typedef struct {
     int64_t timeStart;
     SoftBusCond cond;
     ListNode node;
+    ListNode hashNode;
     SessionParam param;
     LaneConnInfo connInfo;
 } TransReqLaneItem;
@@ -92,6 +95,54 @@ static SoftBusList *g_freeLanePendingList = NULL;
 
 static SoftBusList *g_asyncReqLanePendingList = NULL;
 
+// laneHandle index of the pending lists above, guarded by the lock of the list it indexes
+static ListNode g_reqLanePendingBucket[TRANS_LANE_PENDING_BUCKET_NUM];
+static ListNode g_asyncReqLanePendingBucket[TRANS_LANE_PENDING_BUCKET_NUM];
+
+static void InitReqLanePendingBucket(ListNode *bucket)
+{
+    for (uint32_t i = 0; i < TRANS_LANE_PENDING_BUCKET_NUM; i++) {
+        ListInit(&bucket[i]);
+    }
+}
+
+static ListNode *GetReqLanePendingBucket(uint32_t laneHandle, bool isAsync)
+{
+    ListNode *bucket = isAsync ? g_asyncReqLanePendingBucket : g_reqLanePendingBucket;
+    return &bucket[laneHandle & (TRANS_LANE_PENDING_BUCKET_NUM - 1)];
+}
+
+/* the caller holds the lock of the pending list */
+static void AddReqLaneItemLocked(SoftBusList *pendingList, TransReqLaneItem *item, bool isAsync)
+{
+    ListInit(&(item->node));
+    ListAdd(&(pendingList->list), &(item->node));
+    ListInit(&(item->hashNode));
+    ListAdd(GetReqLanePendingBucket(item->laneHandle, isAsync), &(item->hashNode));
+    pendingList->cnt++;
+}
+
+/* the caller holds the lock of the pending list */
+static void DelReqLaneItemLocked(SoftBusList *pendingList, TransReqLaneItem *item)
+{
+    ListDelete(&(item->node));
+    ListDelete(&(item->hashNode));
+    pendingList->cnt--;
+}
+
+/* the caller holds the lock of the pending list */
+static TransReqLaneItem *GetReqLaneItemLocked(uint32_t laneHandle, bool isAsync)
+{
+    ListNode *bucket = GetReqLanePendingBucket(laneHandle, isAsync);
+    TransReqLaneItem *item = NULL;
+    LIST_FOR_EACH_ENTRY(item, bucket, TransReqLaneItem, hashNode) {
+        if (item->laneHandle == laneHandle) {
+            return item;
+        }
+    }
+    return NULL;
+}
+
 int32_t TransReqLanePendingInit(void)
 {
     g_reqLanePendingList = CreateSoftBusList();
@@ -99,6 +150,7 @@ int32_t TransReqLanePendingInit(void)
         TRANS_LOGE(TRANS_INIT, "g_reqLanePendingList is null.");
         return SOFTBUS_MALLOC_ERR;
     }
+    InitReqLanePendingBucket(g_reqLanePendingBucket);
     return SOFTBUS_OK;
 }
 
@@ -109,6 +161,7 @@ int32_t TransAsyncReqLanePendingInit(void)
         TRANS_LOGE(TRANS_INIT, "g_asyncReqLanePendingList is null.");
         return SOFTBUS_MALLOC_ERR;
     }
+    InitReqLanePendingBucket(g_asyncReqLanePendingBucket);
     return SOFTBUS_OK;
 }
 
@@ -168,6 +221,7 @@ void TransReqLanePendingDeinit(void)
         ListDelete(&item->node);
         SoftBusFree(item);
     }
+    InitReqLanePendingBucket(g_reqLanePendingBucket);
     (void)SoftBusMutexUnlock(&g_reqLanePendingList->lock);
     DestroySoftBusList(g_reqLanePendingList);
     g_reqLanePendingList = NULL;
@@ -193,6 +247,7 @@ void TransAsyncReqLanePendingDeinit(void)
         ClearSessionParamMemory(&(item->param));
         SoftBusFree(item);
     }
+    InitReqLanePendingBucket(g_asyncReqLanePendingBucket);
     (void)SoftBusMutexUnlock(&g_asyncReqLanePendingList->lock);
     DestroySoftBusList(g_asyncReqLanePendingList);
     g_asyncReqLanePendingList = NULL;
@@ -245,30 +300,26 @@ static int32_t TransDelLaneReqFromPendingList(uint32_t laneHandle, bool isAsync)
         return SOFTBUS_LOCK_ERR;
     }
 
-    TransReqLaneItem *laneItem = NULL;
-    TransReqLaneItem *next = NULL;
-    LIST_FOR_EACH_ENTRY_SAFE(laneItem, next, &(pendingList->list), TransReqLaneItem, node) {
-        if (laneItem->laneHandle == laneHandle) {
-            if (!isAsync) {
-                (void)SoftBusCondDestroy(&laneItem->cond);
-            }
-            if (laneItem->isNetWorkingChannel) {
-                DestroyNetworkingReqItemParam(laneItem);
-            }
-            ListDelete(&(laneItem->node));
-            TRANS_LOGI(TRANS_SVC, "delete laneHandle=%{public}u", laneItem->laneHandle);
-            pendingList->cnt--;
-            if (isAsync) {
-                ClearSessionParamMemory(&(laneItem->param));
-            }
-            SoftBusFree(laneItem);
-            (void)SoftBusMutexUnlock(&(pendingList->lock));
-            return SOFTBUS_OK;
-        }
+    TransReqLaneItem *laneItem = GetReqLaneItemLocked(laneHandle, isAsync);
+    if (laneItem == NULL) {
+        (void)SoftBusMutexUnlock(&(pendingList->lock));
+        TRANS_LOGE(TRANS_SVC, "trans lane request not found, laneHandle=%{public}u", laneHandle);
+        return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    }
+    if (!isAsync) {
+        (void)SoftBusCondDestroy(&laneItem->cond);
+    }
+    if (laneItem->isNetWorkingChannel) {
+        DestroyNetworkingReqItemParam(laneItem);
     }
+    DelReqLaneItemLocked(pendingList, laneItem);
+    TRANS_LOGI(TRANS_SVC, "delete laneHandle=%{public}u", laneItem->laneHandle);
+    if (isAsync) {
+        ClearSessionParamMemory(&(laneItem->param));
+    }
+    SoftBusFree(laneItem);
     (void)SoftBusMutexUnlock(&(pendingList->lock));
-    TRANS_LOGE(TRANS_SVC, "trans lane request not found, laneHandle=%{public}u", laneHandle);
-    return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 static int32_t TransAddLaneReqFromPendingList(uint32_t laneHandle)
@@ -300,9 +351,7 @@ static int32_t TransAddLaneReqFromPendingList(uint32_t laneHandle)
         TRANS_LOGE(TRANS_SVC, "cond init failed.");
         return SOFTBUS_TRANS_INIT_FAILED;
     }
-    ListInit(&(item->node));
-    ListAdd(&(g_reqLanePendingList->list), &(item->node));
-    g_reqLanePendingList->cnt++;
+    AddReqLaneItemLocked(g_reqLanePendingList, item, false);
     (void)SoftBusMutexUnlock(&g_reqLanePendingList->lock);
 
     TRANS_LOGI(TRANS_SVC, "add tran request to pending laneHandle=%{public}u", laneHandle);
@@ -446,9 +495,7 @@ static int32_t TransAddAsyncLaneReqFromPendingList(
         TRANS_LOGE(TRANS_SVC, "lock failed.");
         return SOFTBUS_LOCK_ERR;
     }
-    ListInit(&(item->node));
-    ListAdd(&(g_asyncReqLanePendingList->list), &(item->node));
-    g_asyncReqLanePendingList->cnt++;
+    AddReqLaneItemLocked(g_asyncReqLanePendingList, item, true);
     (void)SoftBusMutexUnlock(&g_asyncReqLanePendingList->lock);
     TRANS_LOGI(TRANS_SVC, "add async request to pending list laneHandle=%{public}u, socket=%{public}d", laneHandle,
         param->sessionId);
@@ -466,23 +513,21 @@ static int32_t TransGetLaneReqItemByLaneHandle(uint32_t laneHandle, bool *bSucc,
         TRANS_LOGE(TRANS_SVC, "lock failed.");
         return SOFTBUS_LOCK_ERR;
     }
-    TransReqLaneItem *item = NULL;
-    LIST_FOR_EACH_ENTRY(item, &(g_reqLanePendingList->list), TransReqLaneItem, node) {
-        if (item->laneHandle == laneHandle) {
-            *bSucc = item->bSucc;
-            *errCode = item->errCode;
-            if (memcpy_s(connInfo, sizeof(LaneConnInfo), &(item->connInfo), sizeof(LaneConnInfo)) != EOK) {
-                (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-                TRANS_LOGE(TRANS_SVC, "memcpy_s connInfo failed");
-                return SOFTBUS_MEM_ERR;
-            }
-            (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-            return SOFTBUS_OK;
-        }
+    TransReqLaneItem *item = GetReqLaneItemLocked(laneHandle, false);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
+        TRANS_LOGE(TRANS_SVC, "trans lane request not found. laneHandle=%{public}u", laneHandle);
+        return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    }
+    *bSucc = item->bSucc;
+    *errCode = item->errCode;
+    if (memcpy_s(connInfo, sizeof(LaneConnInfo), &(item->connInfo), sizeof(LaneConnInfo)) != EOK) {
+        (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
+        TRANS_LOGE(TRANS_SVC, "memcpy_s connInfo failed");
+        return SOFTBUS_MEM_ERR;
     }
     (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-    TRANS_LOGE(TRANS_SVC, "trans lane request not found. laneHandle=%{public}u", laneHandle);
-    return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 static int32_t TransGetChannelIdByLaneHandle(uint32_t laneHandle, int32_t *channelId, bool *isNetWorkingChannel,
@@ -496,28 +541,26 @@ static int32_t TransGetChannelIdByLaneHandle(uint32_t laneHandle, int32_t *chann
         TRANS_LOGE(TRANS_SVC, "lock failed.");
         return SOFTBUS_LOCK_ERR;
     }
-    TransReqLaneItem *item = NULL;
-    LIST_FOR_EACH_ENTRY(item, &(g_reqLanePendingList->list), TransReqLaneItem, node) {
-        if (item->laneHandle == laneHandle) {
-            *channelId = item->channelId;
-            *isNetWorkingChannel = item->isNetWorkingChannel;
-            if (item->isNetWorkingChannel == false) {
-                (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-                return SOFTBUS_OK;
-            }
-            if (memcpy_s(sessionName, SESSION_NAME_SIZE_MAX, item->param.sessionName, SESSION_NAME_SIZE_MAX) != EOK ||
-                memcpy_s(peerNetworkId, NETWORK_ID_BUF_LEN, item->param.peerDeviceId, NETWORK_ID_BUF_LEN) != EOK) {
-                (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-                TRANS_LOGE(TRANS_SVC, "memcpy_s sessionName and networkId failed, laneHandle=%{public}u", laneHandle);
-                return SOFTBUS_MEM_ERR;
-            }
-            (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-            return SOFTBUS_OK;
-        }
+    TransReqLaneItem *item = GetReqLaneItemLocked(laneHandle, false);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
+        TRANS_LOGE(TRANS_SVC, "trans lane request not found. laneHandle=%{public}u", laneHandle);
+        return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    }
+    *channelId = item->channelId;
+    *isNetWorkingChannel = item->isNetWorkingChannel;
+    if (item->isNetWorkingChannel == false) {
+        (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
+        return SOFTBUS_OK;
+    }
+    if (memcpy_s(sessionName, SESSION_NAME_SIZE_MAX, item->param.sessionName, SESSION_NAME_SIZE_MAX) != EOK ||
+        memcpy_s(peerNetworkId, NETWORK_ID_BUF_LEN, item->param.peerDeviceId, NETWORK_ID_BUF_LEN) != EOK) {
+        (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
+        TRANS_LOGE(TRANS_SVC, "memcpy_s sessionName and networkId failed, laneHandle=%{public}u", laneHandle);
+        return SOFTBUS_MEM_ERR;
     }
     (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-    TRANS_LOGE(TRANS_SVC, "trans lane request not found. laneHandle=%{public}u", laneHandle);
-    return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 static int32_t TransAddInfoByLaneHandle(NetWorkingChannelInfo *info, const char *networkId, uint32_t laneHandle)
@@ -530,45 +573,43 @@ static int32_t TransAddInfoByLaneHandle(NetWorkingChannelInfo *info, const char
         TRANS_LOGE(TRANS_SVC, "lock failed.");
         return SOFTBUS_LOCK_ERR;
     }
-    TransReqLaneItem *item = NULL;
-    LIST_FOR_EACH_ENTRY(item, &(g_reqLanePendingList->list), TransReqLaneItem, node) {
-        if (item->laneHandle == laneHandle) {
-            item->channelId = info->channelId;
-            item->isNetWorkingChannel = info->isNetWorkingChannel;
-            if (!info->isNetWorkingChannel) {
-                (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-                return SOFTBUS_OK;
-            }
-            char *getSessionName = (char *)SoftBusCalloc(sizeof(char) * SESSION_NAME_SIZE_MAX);
-            if (getSessionName == NULL) {
-                TRANS_LOGE(TRANS_SVC, "calloc sessionName fail. laneHandle=%{public}u", laneHandle);
-                (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-                return SOFTBUS_MALLOC_ERR;
-            }
-            char *getNetworkId = (char *)SoftBusCalloc(sizeof(char) * NETWORK_ID_BUF_LEN);
-            if (getNetworkId == NULL) {
-                SoftBusFree((void *)(getSessionName));
-                TRANS_LOGE(TRANS_SVC, "calloc networkId fail. laneHandle=%{public}u", laneHandle);
-                (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-                return SOFTBUS_MALLOC_ERR;
-            }
-            if (memcpy_s(getSessionName, SESSION_NAME_SIZE_MAX, info->sessionName, SESSION_NAME_SIZE_MAX) != EOK ||
-                memcpy_s(getNetworkId, NETWORK_ID_BUF_LEN, networkId, NETWORK_ID_BUF_LEN) != EOK) {
-                SoftBusFree((void *)(getNetworkId));
-                SoftBusFree((void *)(getSessionName));
-                (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-                TRANS_LOGE(TRANS_SVC, "memcpy_s sessionName and networkId failed, laneHandle=%{public}u", laneHandle);
-                return SOFTBUS_MEM_ERR;
-            }
-            item->param.sessionName = getSessionName;
-            item->param.peerDeviceId = getNetworkId;
-            (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-            return SOFTBUS_OK;
-        }
+    TransReqLaneItem *item = GetReqLaneItemLocked(laneHandle, false);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
+        TRANS_LOGE(TRANS_SVC, "trans lane request not found. laneHandle=%{public}u", laneHandle);
+        return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    }
+    item->channelId = info->channelId;
+    item->isNetWorkingChannel = info->isNetWorkingChannel;
+    if (!info->isNetWorkingChannel) {
+        (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
+        return SOFTBUS_OK;
+    }
+    char *getSessionName = (char *)SoftBusCalloc(sizeof(char) * SESSION_NAME_SIZE_MAX);
+    if (getSessionName == NULL) {
+        TRANS_LOGE(TRANS_SVC, "calloc sessionName fail. laneHandle=%{public}u", laneHandle);
+        (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
+        return SOFTBUS_MALLOC_ERR;
     }
+    char *getNetworkId = (char *)SoftBusCalloc(sizeof(char) * NETWORK_ID_BUF_LEN);
+    if (getNetworkId == NULL) {
+        SoftBusFree((void *)(getSessionName));
+        TRANS_LOGE(TRANS_SVC, "calloc networkId fail. laneHandle=%{public}u", laneHandle);
+        (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
+        return SOFTBUS_MALLOC_ERR;
+    }
+    if (memcpy_s(getSessionName, SESSION_NAME_SIZE_MAX, info->sessionName, SESSION_NAME_SIZE_MAX) != EOK ||
+        memcpy_s(getNetworkId, NETWORK_ID_BUF_LEN, networkId, NETWORK_ID_BUF_LEN) != EOK) {
+        SoftBusFree((void *)(getNetworkId));
+        SoftBusFree((void *)(getSessionName));
+        (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
+        TRANS_LOGE(TRANS_SVC, "memcpy_s sessionName and networkId failed, laneHandle=%{public}u", laneHandle);
+        return SOFTBUS_MEM_ERR;
+    }
+    item->param.sessionName = getSessionName;
+    item->param.peerDeviceId = getNetworkId;
     (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
-    TRANS_LOGE(TRANS_SVC, "trans lane request not found. laneHandle=%{public}u", laneHandle);
-    return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 static int32_t TransGetLaneReqItemParamByLaneHandle(uint32_t laneHandle,
@@ -587,31 +628,29 @@ static int32_t TransGetLaneReqItemParamByLaneHandle(uint32_t laneHandle,
         return SOFTBUS_LOCK_ERR;
     }
 
-    TransReqLaneItem *item = NULL;
-    LIST_FOR_EACH_ENTRY(item, &(g_asyncReqLanePendingList->list), TransReqLaneItem, node) {
-        if (item->laneHandle == laneHandle) {
-            *callingTokenId = item->callingTokenId;
-            if (firstTokenId != NULL) {
-                *firstTokenId = item->firstTokenId;
-            }
-            *timeStart = item->timeStart;
-            if (memcpy_s(reqLane, sizeof(TransReqLaneItem), item, sizeof(TransReqLaneItem)) != EOK) {
-                (void)SoftBusMutexUnlock(&(g_asyncReqLanePendingList->lock));
-                TRANS_LOGE(TRANS_SVC, "copy session param failed.");
-                return SOFTBUS_MEM_ERR;
-            }
-            if (CopySessionParam(&(item->param), &(reqLane->param)) != SOFTBUS_OK) {
-                (void)SoftBusMutexUnlock(&(g_asyncReqLanePendingList->lock));
-                TRANS_LOGE(TRANS_SVC, "copy session calloc param failed.");
-                return SOFTBUS_MEM_ERR;
-            }
-            (void)SoftBusMutexUnlock(&(g_asyncReqLanePendingList->lock));
-            return SOFTBUS_OK;
-        }
+    TransReqLaneItem *item = GetReqLaneItemLocked(laneHandle, true);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&(g_asyncReqLanePendingList->lock));
+        TRANS_LOGE(TRANS_SVC, "trans lane request not found. laneHandle=%{public}u", laneHandle);
+        return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    }
+    *callingTokenId = item->callingTokenId;
+    if (firstTokenId != NULL) {
+        *firstTokenId = item->firstTokenId;
+    }
+    *timeStart = item->timeStart;
+    if (memcpy_s(reqLane, sizeof(TransReqLaneItem), item, sizeof(TransReqLaneItem)) != EOK) {
+        (void)SoftBusMutexUnlock(&(g_asyncReqLanePendingList->lock));
+        TRANS_LOGE(TRANS_SVC, "copy session param failed.");
+        return SOFTBUS_MEM_ERR;
+    }
+    if (CopySessionParam(&(item->param), &(reqLane->param)) != SOFTBUS_OK) {
+        (void)SoftBusMutexUnlock(&(g_asyncReqLanePendingList->lock));
+        TRANS_LOGE(TRANS_SVC, "copy session calloc param failed.");
+        return SOFTBUS_MEM_ERR;
     }
     (void)SoftBusMutexUnlock(&(g_asyncReqLanePendingList->lock));
-    TRANS_LOGE(TRANS_SVC, "trans lane request not found. laneHandle=%{public}u", laneHandle);
-    return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 static int32_t TransUpdateLaneConnInfoByLaneHandle(uint32_t laneHandle, bool bSucc, const LaneConnInfo *connInfo,
@@ -627,27 +666,25 @@ static int32_t TransUpdateLaneConnInfoByLaneHandle(uint32_t laneHandle, bool bSu
         return SOFTBUS_LOCK_ERR;
     }
 
-    TransReqLaneItem *item = NULL;
-    LIST_FOR_EACH_ENTRY(item, &(pendingList->list), TransReqLaneItem, node) {
-        if (item->laneHandle == laneHandle) {
-            item->bSucc = bSucc;
-            item->errCode = errCode;
-            if ((connInfo != NULL) &&
-                (memcpy_s(&(item->connInfo), sizeof(LaneConnInfo), connInfo, sizeof(LaneConnInfo)) != EOK)) {
-                (void)SoftBusMutexUnlock(&(pendingList->lock));
-                return SOFTBUS_MEM_ERR;
-            }
-            item->isFinished = true;
-            if (!isAsync && !(item->isNetWorkingChannel)) {
-                (void)SoftBusCondSignal(&item->cond);
-            }
-            (void)SoftBusMutexUnlock(&(pendingList->lock));
-            return SOFTBUS_OK;
-        }
+    TransReqLaneItem *item = GetReqLaneItemLocked(laneHandle, isAsync);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&(pendingList->lock));
+        TRANS_LOGE(TRANS_SVC, "trans lane request not found. laneHandle=%{public}u", laneHandle);
+        return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    }
+    item->bSucc = bSucc;
+    item->errCode = errCode;
+    if ((connInfo != NULL) &&
+        (memcpy_s(&(item->connInfo), sizeof(LaneConnInfo), connInfo, sizeof(LaneConnInfo)) != EOK)) {
+        (void)SoftBusMutexUnlock(&(pendingList->lock));
+        return SOFTBUS_MEM_ERR;
+    }
+    item->isFinished = true;
+    if (!isAsync && !(item->isNetWorkingChannel)) {
+        (void)SoftBusCondSignal(&item->cond);
     }
     (void)SoftBusMutexUnlock(&(pendingList->lock));
-    TRANS_LOGE(TRANS_SVC, "trans lane request not found. laneHandle=%{public}u", laneHandle);
-    return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 static int32_t TransProxyGetAppInfo(const char *sessionName, const char *peerNetworkId, AppInfo *appInfo)
@@ -772,6 +809,7 @@ static void TransAsyncOpenChannelProc(uint32_t laneHandle, SessionParam *param,
     TransOpenChannelSetModule(transInfo.channelType, &connOpt);
     TRANS_LOGI(TRANS_SVC, "laneHandle=%{public}u, channelType=%{public}u, linkedChannelId=%{public}d",
         laneHandle, transInfo.channelType, appInfo->linkedChannelId);
+    TransOpenTraceRecord(TransOpenTraceGetCurrent(), TRANS_OPEN_PHASE_CHANNEL_CONNECT);
     ret = TransOpenChannelProc((ChannelType)transInfo.channelType, appInfo, &connOpt, &(transInfo.channelId));
     (void)memset_s(appInfo->sessionKey, sizeof(appInfo->sessionKey), 0, sizeof(appInfo->sessionKey));
     (void)memset_s(appInfo->sinkSessionKey, sizeof(appInfo->sinkSessionKey), 0, sizeof(appInfo->sinkSessionKey));
@@ -780,6 +818,8 @@ static void TransAsyncOpenChannelProc(uint32_t laneHandle, SessionParam *param,
         RecordFailOpenSessionKpi(appInfo, connInnerInfo, appInfo->timeStart);
         goto EXIT_ERR;
     }
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(transInfo.channelType, transInfo.channelId));
     TransUpdateSocketChannelInfoBySession(
         param->sessionName, param->sessionId, transInfo.channelId, transInfo.channelType);
     ret = ClientIpcSetChannelInfo(
@@ -799,6 +839,7 @@ static void TransAsyncOpenChannelProc(uint32_t laneHandle, SessionParam *param,
     AddChannelStatisticsInfo(transInfo.channelId, transInfo.channelType);
     return;
 EXIT_ERR:
+    TransOpenTraceRecord(TransOpenTraceGetCurrent(), TRANS_OPEN_PHASE_FAILED);
     TransBuildTransOpenChannelEndEvent(extra, &transInfo, appInfo->timeStart, ret);
     TRANS_EVENT(EVENT_SCENE_OPEN_CHANNEL, EVENT_STAGE_OPEN_CHANNEL_END, *extra);
     TransAlarmExtra extraAlarm;
@@ -872,12 +913,13 @@ static void UpdateChannelCancelEncryption(const SessionParam *param, LaneLinkTyp
     }
 }
 
-static void TransOnAsyncLaneSuccess(uint32_t laneHandle, const LaneConnInfo *connInfo)
+/* isQosLane tells how to free the lane when its request item is already gone */
+static void TransOnAsyncLaneSuccessProc(uint32_t laneHandle, const LaneConnInfo *connInfo, bool isQosLane)
 {
     TRANS_LOGI(TRANS_SVC, "request success. laneHandle=%{public}u", laneHandle);
     TransReqLaneItem reqLane;
     (void)memset_s(&reqLane, sizeof(TransReqLaneItem), 0, sizeof(TransReqLaneItem));
-    reqLane.param.isQosLane = true;
+    reqLane.param.isQosLane = isQosLane;
     uint64_t callingTokenId = TOKENID_NOT_SET;
     uint64_t firstTokenId = TOKENID_NOT_SET;
     int64_t timeStart = 0;
@@ -887,7 +929,7 @@ static void TransOnAsyncLaneSuccess(uint32_t laneHandle, const LaneConnInfo *con
         TRANS_LOGE(TRANS_SVC, "get lane req item failed. laneHandle=%{public}u, ret=%{public}d", laneHandle, ret);
         (void)TransDeleteSocketChannelInfoBySession(reqLane.param.sessionName, reqLane.param.sessionId);
         (void)TransDelLaneReqFromPendingList(laneHandle, true);
-        TransFreeLane(laneHandle, true, true);
+        TransFreeLane(laneHandle, isQosLane, true);
         return;
     }
     LaneTransType transType = (LaneTransType)TransGetLaneTransTypeBySession(&reqLane.param);
@@ -904,7 +946,7 @@ static void TransOnAsyncLaneSuccess(uint32_t laneHandle, const LaneConnInfo *con
         TRANS_LOGE(TRANS_SVC, "malloc appInfo failed");
         (void)TransDeleteSocketChannelInfoBySession(reqLane.param.sessionName, reqLane.param.sessionId);
         (void)TransDelLaneReqFromPendingList(laneHandle, true);
-        TransFreeLane(laneHandle, true, true);
+        TransFreeLane(laneHandle, reqLane.param.isQosLane, true);
         ClearSessionParamMemory(&(reqLane.param));
         return;
     }
@@ -912,7 +954,7 @@ static void TransOnAsyncLaneSuccess(uint32_t laneHandle, const LaneConnInfo *con
     if (ret != SOFTBUS_OK) {
         TRANS_LOGE(TRANS_SVC, "CreateAppInfoByParam failed");
         TransFreeAppInfo(appInfo);
-        TransFreeLane(laneHandle, true, true);
+        TransFreeLane(laneHandle, reqLane.param.isQosLane, true);
         ClearSessionParamMemory(&(reqLane.param));
         return;
     }
@@ -932,6 +974,26 @@ static void TransOnAsyncLaneSuccess(uint32_t laneHandle, const LaneConnInfo *con
     ClearSessionParamMemory(&(reqLane.param));
 }
 
+static void TransOnAsyncLaneSuccessInner(uint32_t laneHandle, const LaneConnInfo *connInfo, bool isQosLane)
+{
+    uint32_t traceId = TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_LANE_HANDLE, laneHandle);
+    TransOpenTraceRecord(traceId, TRANS_OPEN_PHASE_LANE_ALLOCED);
+    TransOpenTraceSetCurrent(traceId);
+    TransOnAsyncLaneSuccessProc(laneHandle, connInfo, isQosLane);
+    TransOpenTraceSetCurrent(TRANS_OPEN_TRACE_INVALID_ID);
+}
+
+static void TransOnAsyncLaneSuccess(uint32_t laneHandle, const LaneConnInfo *connInfo)
+{
+    TransOnAsyncLaneSuccessInner(laneHandle, connInfo, true);
+}
+
+/* lanes of legacy OpenSession come from LnnRequestLane and are freed by LnnFreeLane */
+static void TransOnAsyncLegacyLaneSuccess(uint32_t laneHandle, const LaneConnInfo *connInfo)
+{
+    TransOnAsyncLaneSuccessInner(laneHandle, connInfo, false);
+}
+
 static void TransBuildLaneAllocFailEvent(
     TransEventExtra *extra, TransInfo *transInfo, const AppInfo *appInfo, const SessionParam *param, int32_t reason)
 {
@@ -945,6 +1007,7 @@ static void TransBuildLaneAllocFailEvent(
 static void TransOnAsyncLaneFail(uint32_t laneHandle, int32_t reason)
 {
     SoftBusHitraceChainBegin("TransOnAsyncLaneFail");
+    TransOpenTraceRecordByKey(TRANS_OPEN_TRACE_KEY_LANE_HANDLE, laneHandle, TRANS_OPEN_PHASE_FAILED);
     TRANS_LOGI(TRANS_SVC, "request failed, laneHandle=%{public}u, reason=%{public}d", laneHandle, reason);
     TransReqLaneItem reqLane;
     (void)memset_s(&reqLane, sizeof(TransReqLaneItem), 0, sizeof(TransReqLaneItem));
@@ -1484,15 +1547,8 @@ static int32_t TransWaitingRequestCallback(uint32_t laneHandle)
         TRANS_LOGE(TRANS_SVC, "lock failed.");
         return SOFTBUS_LOCK_ERR;
     }
-    bool isFound = false;
-    TransReqLaneItem *item = NULL;
-    LIST_FOR_EACH_ENTRY(item, &(g_reqLanePendingList->list), TransReqLaneItem, node) {
-        if (item->laneHandle == laneHandle) {
-            isFound = true;
-            break;
-        }
-    }
-    if (!isFound) {
+    TransReqLaneItem *item = GetReqLaneItemLocked(laneHandle, false);
+    if (item == NULL) {
         (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
         TRANS_LOGI(TRANS_SVC, "not found laneHandle in pending. laneHandle=%{public}u", laneHandle);
         return SOFTBUS_NOT_FIND;
@@ -1640,6 +1696,7 @@ int32_t TransAsyncGetLaneInfoByQos(const SessionParam *param, const LaneAllocInf
     TRANS_CHECK_AND_RETURN_RET_LOGE(GetLaneManager()->lnnGetLaneHandle != NULL, SOFTBUS_TRANS_GET_LANE_INFO_ERR,
         TRANS_SVC, "lnnGetLaneHandle is null");
     *laneHandle = GetLaneManager()->lnnGetLaneHandle(LANE_TYPE_TRANS);
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_LANE_HANDLE, *laneHandle);
     TransUpdateSocketChannelLaneInfoBySession(
         param->sessionName, param->sessionId, *laneHandle, param->isQosLane, param->isAsync);
     int32_t ret = TransAddAsyncLaneReqFromPendingList(*laneHandle, param, appInfo);
@@ -1781,6 +1838,7 @@ int32_t TransAsyncGetLaneInfoByExt(const SessionParam *param, uint32_t *laneHand
     TRANS_CHECK_AND_RETURN_RET_LOGE(GetLaneManager()->lnnGetLaneHandle != NULL, SOFTBUS_TRANS_GET_LANE_INFO_ERR,
         TRANS_SVC, "lnnGetLaneHandle is null");
     *laneHandle = GetLaneManager()->lnnGetLaneHandle(LANE_TYPE_TRANS);
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_LANE_HANDLE, *laneHandle);
     TransUpdateSocketChannelLaneInfoBySession(
         param->sessionName, param->sessionId, *laneHandle, param->isQosLane, param->isAsync);
     ret = TransAddAsyncLaneReqFromPendingList(*laneHandle, param, appInfo);
@@ -1815,6 +1873,50 @@ int32_t TransAsyncGetLaneInfoByExt(const SessionParam *param, uint32_t *laneHand
     return SOFTBUS_OK;
 }
 
+int32_t TransAsyncGetLaneInfoByOption(const SessionParam *param, uint32_t *laneHandle, const AppInfo *appInfo)
+{
+    if (param == NULL || laneHandle == NULL || appInfo == NULL) {
+        TRANS_LOGE(TRANS_SVC, "async get lane info param error.");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    CoreSessionState state = CORE_SESSION_STATE_INIT;
+    (void)TransGetSocketChannelStateBySession(param->sessionName, param->sessionId, &state);
+    TRANS_CHECK_AND_RETURN_RET_LOGW(state != CORE_SESSION_STATE_CANCELLING, SOFTBUS_TRANS_STOP_BIND_BY_CANCEL,
+        TRANS_SVC, "cancel state, return cancel code.");
+    LaneRequestOption requestOption;
+    (void)memset_s(&requestOption, sizeof(LaneRequestOption), 0, sizeof(LaneRequestOption));
+    int32_t ret = GetRequestOptionBySessionParam(param, &requestOption);
+    TRANS_CHECK_AND_RETURN_RET_LOGE(
+        ret == SOFTBUS_OK, ret, TRANS_SVC, "get request option failed ret=%{public}d", ret);
+    TRANS_CHECK_AND_RETURN_RET_LOGE(
+        GetLaneManager() != NULL, SOFTBUS_TRANS_GET_LANE_INFO_ERR, TRANS_SVC, "GetLaneManager is null");
+    TRANS_CHECK_AND_RETURN_RET_LOGE(GetLaneManager()->lnnGetLaneHandle != NULL, SOFTBUS_TRANS_GET_LANE_INFO_ERR,
+        TRANS_SVC, "lnnGetLaneHandle is null");
+    *laneHandle = GetLaneManager()->lnnGetLaneHandle(LANE_TYPE_TRANS);
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_LANE_HANDLE, *laneHandle);
+    TransUpdateSocketChannelLaneInfoBySession(
+        param->sessionName, param->sessionId, *laneHandle, param->isQosLane, param->isAsync);
+    ret = TransAddAsyncLaneReqFromPendingList(*laneHandle, param, appInfo);
+    if (ret != SOFTBUS_OK) {
+        TRANS_LOGE(
+            TRANS_SVC, "add laneHandle=%{public}u to async pending list failed, ret=%{public}d", *laneHandle, ret);
+        return ret;
+    }
+    TransSetSocketChannelStateBySession(param->sessionName, param->sessionId, CORE_SESSION_STATE_WAIT_LANE);
+    // the lane result continues the open on the lane callback thread instead of waking up a parked ipc thread
+    ILaneListener listener;
+    listener.onLaneRequestSuccess = TransOnAsyncLegacyLaneSuccess;
+    listener.onLaneRequestFail = TransOnAsyncLaneFail;
+    ret = LnnRequestLane(*laneHandle, &requestOption, &listener);
+    if (ret != SOFTBUS_OK) {
+        TRANS_LOGE(TRANS_SVC, "trans request lane failed, ret=%{public}d", ret);
+        (void)TransDelLaneReqFromPendingList(*laneHandle, true);
+        return ret;
+    }
+    TRANS_LOGI(TRANS_SVC, "add laneHandle to async pending. laneHandle=%{public}u", *laneHandle);
+    return SOFTBUS_OK;
+}
+
 int32_t TransAsyncGetLaneInfo(const SessionParam *param, uint32_t *laneHandle, const AppInfo *appInfo)
 {
     if (param == NULL || laneHandle == NULL || appInfo == NULL) {
@@ -0,0 +1,466 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "trans_open_trace.h"
+
+#include <securec.h>
+#include <stdatomic.h>
+#include <stdbool.h>
+#include <stdlib.h>
+
+#include "legacy/softbus_hidumper_trans.h"
+#include "softbus_adapter_mem.h"
+#include "softbus_adapter_thread.h"
+#include "softbus_adapter_timer.h"
+#include "softbus_error_code.h"
+#include "softbus_log.h"
+#include "trans_log.h"
+
+#define CMD_OPEN_TRACE       "open_trace"
+#define US_PER_SECOND        1000000LL
+#define PERCENT_BASE         100
+#define PERCENT_50           50
+#define PERCENT_90           90
+#define PERCENT_99           99
+#define INVALID_RING_INDEX   (-1)
+#define TRACE_EVENT_BUF_SIZE (TRANS_OPEN_TRACE_RING_NUM * TRANS_OPEN_TRACE_RING_SIZE)
+
+/* seq is zero while the slot is being written and the ring position plus one once it is complete */
+typedef struct {
+    atomic_uint_fast64_t seq;
+    uint32_t traceId;
+    uint32_t phase;
+    uint64_t timeUs;
+} TraceEventSlot;
+
+typedef struct {
+    atomic_uint_fast64_t head;
+    TraceEventSlot slot[TRANS_OPEN_TRACE_RING_SIZE];
+} TraceRing;
+
+typedef struct {
+    uint32_t traceId;
+    uint32_t phase;
+    uint64_t timeUs;
+} TraceEvent;
+
+typedef struct {
+    bool isUsed;
+    TransOpenTraceKeyType keyType;
+    int64_t key;
+    uint32_t traceId;
+} TraceBinding;
+
+static const char *g_phaseName[TRANS_OPEN_PHASE_BUTT] = {
+    [TRANS_OPEN_PHASE_START] = "start",
+    [TRANS_OPEN_PHASE_LANE_REQUEST] = "lane_request",
+    [TRANS_OPEN_PHASE_LANE_ALLOCED] = "lane_alloced",
+    [TRANS_OPEN_PHASE_CHANNEL_CONNECT] = "channel_connect",
+    [TRANS_OPEN_PHASE_CONN_CONNECTED] = "conn_connected",
+    [TRANS_OPEN_PHASE_CHANNEL_OPENED] = "channel_opened",
+    [TRANS_OPEN_PHASE_FAILED] = "failed",
+};
+
+static TraceRing g_traceRing[TRANS_OPEN_TRACE_RING_NUM];
+static atomic_uint g_traceSeq = 0;
+static atomic_uint g_ringSeq = 0;
+static atomic_bool g_isTraceInit = false;
+static __thread int32_t g_ringIndex = INVALID_RING_INDEX;
+static __thread uint32_t g_curTraceId = TRANS_OPEN_TRACE_INVALID_ID;
+
+static SoftBusMutex g_bindLock;
+static TraceBinding g_binding[TRANS_OPEN_TRACE_BIND_NUM];
+static uint32_t g_bindCursor = 0;
+
+static uint64_t GetTraceTimeUs(void)
+{
+    SoftBusSysTime now = { 0 };
+    (void)SoftBusGetTime(&now);
+    return (uint64_t)(now.sec * US_PER_SECOND + now.usec);
+}
+
+/* threads are spread over the rings once, a ring shared by several threads stays safe by reserving slots */
+static TraceRing *GetThreadRing(void)
+{
+    if (g_ringIndex == INVALID_RING_INDEX) {
+        g_ringIndex = (int32_t)(atomic_fetch_add_explicit(&g_ringSeq, 1, memory_order_relaxed) %
+            TRANS_OPEN_TRACE_RING_NUM);
+    }
+    return &g_traceRing[g_ringIndex];
+}
+
+static void UnbindTrace(uint32_t traceId)
+{
+    if (SoftBusMutexLock(&g_bindLock) != SOFTBUS_OK) {
+        TRANS_LOGE(TRANS_SVC, "lock failed");
+        return;
+    }
+    for (uint32_t i = 0; i < TRANS_OPEN_TRACE_BIND_NUM; i++) {
+        if (g_binding[i].isUsed && g_binding[i].traceId == traceId) {
+            g_binding[i].isUsed = false;
+        }
+    }
+    (void)SoftBusMutexUnlock(&g_bindLock);
+}
+
+static uint32_t SnapshotTraceEvents(TraceEvent *events, uint32_t maxNum)
+{
+    uint32_t num = 0;
+    for (uint32_t i = 0; i < TRANS_OPEN_TRACE_RING_NUM; i++) {
+        for (uint32_t j = 0; j < TRANS_OPEN_TRACE_RING_SIZE && num < maxNum; j++) {
+            TraceEventSlot *slot = &g_traceRing[i].slot[j];
+            uint64_t seq = atomic_load_explicit(&slot->seq, memory_order_acquire);
+            if (seq == 0) {
+                continue;
+            }
+            TraceEvent event = { .traceId = slot->traceId, .phase = slot->phase, .timeUs = slot->timeUs };
+            atomic_thread_fence(memory_order_acquire);
+            // a writer took the slot over while it was copied
+            if (atomic_load_explicit(&slot->seq, memory_order_relaxed) != seq) {
+                continue;
+            }
+            events[num++] = event;
+        }
+    }
+    return num;
+}
+
+static int32_t CompareTraceEvent(const void *a, const void *b)
+{
+    const TraceEvent *left = (const TraceEvent *)a;
+    const TraceEvent *right = (const TraceEvent *)b;
+    if (left->traceId != right->traceId) {
+        return (left->traceId < right->traceId) ? -1 : 1;
+    }
+    if (left->timeUs != right->timeUs) {
+        return (left->timeUs < right->timeUs) ? -1 : 1;
+    }
+    return 0;
+}
+
+static int32_t CompareSample(const void *a, const void *b)
+{
+    uint64_t left = *(const uint64_t *)a;
+    uint64_t right = *(const uint64_t *)b;
+    if (left == right) {
+        return 0;
+    }
+    return (left < right) ? -1 : 1;
+}
+
+/* events of one trace are contiguous after sorting, the first time a phase is crossed wins */
+static uint32_t BuildSpan(const TraceEvent *events, uint32_t num, uint32_t begin, TransOpenSpan *span)
+{
+    (void)memset_s(span, sizeof(TransOpenSpan), 0, sizeof(TransOpenSpan));
+    span->traceId = events[begin].traceId;
+    uint32_t end = begin;
+    for (; end < num && events[end].traceId == span->traceId; end++) {
+        uint32_t bit = 1U << events[end].phase;
+        if ((span->phaseMask & bit) == 0) {
+            span->phaseMask |= bit;
+            span->phaseTimeUs[events[end].phase] = events[end].timeUs;
+        }
+    }
+    return end;
+}
+
+static bool HasPhase(const TransOpenSpan *span, TransOpenPhase phase)
+{
+    return (span->phaseMask & (1U << phase)) != 0;
+}
+
+static uint64_t GetSpanSample(const TransOpenSpan *span, TransOpenPhase phase)
+{
+    if (phase == TRANS_OPEN_PHASE_START) {
+        return span->phaseTimeUs[TRANS_OPEN_PHASE_CHANNEL_OPENED] - span->phaseTimeUs[TRANS_OPEN_PHASE_START];
+    }
+    uint64_t prevTimeUs = span->phaseTimeUs[TRANS_OPEN_PHASE_START];
+    for (int32_t i = (int32_t)phase - 1; i > TRANS_OPEN_PHASE_START; i--) {
+        if (HasPhase(span, (TransOpenPhase)i)) {
+            prevTimeUs = span->phaseTimeUs[i];
+            break;
+        }
+    }
+    return (span->phaseTimeUs[phase] > prevTimeUs) ? (span->phaseTimeUs[phase] - prevTimeUs) : 0;
+}
+
+static uint64_t GetPercentile(const uint64_t *samples, uint32_t count, uint32_t percent)
+{
+    uint32_t rank = (count * percent + PERCENT_BASE - 1) / PERCENT_BASE;
+    return samples[(rank == 0) ? 0 : (rank - 1)];
+}
+
+/* TRANS_OPEN_PHASE_START collects the total open time of every opened trace */
+static void FillPhaseStat(const TraceEvent *events, uint32_t num, TransOpenPhase phase, uint64_t *samples,
+    TransOpenPhaseStat *stat)
+{
+    uint32_t count = 0;
+    TransOpenSpan span;
+    for (uint32_t i = 0; i < num;) {
+        i = BuildSpan(events, num, i, &span);
+        if (!HasPhase(&span, TRANS_OPEN_PHASE_START) || !HasPhase(&span, TRANS_OPEN_PHASE_CHANNEL_OPENED) ||
+            !HasPhase(&span, phase)) {
+            continue;
+        }
+        samples[count++] = GetSpanSample(&span, phase);
+    }
+    (void)memset_s(stat, sizeof(TransOpenPhaseStat), 0, sizeof(TransOpenPhaseStat));
+    if (count == 0) {
+        return;
+    }
+    qsort(samples, count, sizeof(uint64_t), CompareSample);
+    stat->count = count;
+    stat->p50Us = GetPercentile(samples, count, PERCENT_50);
+    stat->p90Us = GetPercentile(samples, count, PERCENT_90);
+    stat->p99Us = GetPercentile(samples, count, PERCENT_99);
+    stat->maxUs = samples[count - 1];
+}
+
+static void CountEndedTrace(const TraceEvent *events, uint32_t num, TransOpenTraceSummary *summary)
+{
+    TransOpenSpan span;
+    for (uint32_t i = 0; i < num;) {
+        i = BuildSpan(events, num, i, &span);
+        if (!HasPhase(&span, TRANS_OPEN_PHASE_START)) {
+            continue;
+        }
+        if (HasPhase(&span, TRANS_OPEN_PHASE_CHANNEL_OPENED)) {
+            summary->openedNum++;
+        } else if (HasPhase(&span, TRANS_OPEN_PHASE_FAILED)) {
+            summary->failedNum++;
+        }
+    }
+}
+
+static int32_t TransOpenTraceShowInfo(int32_t fd)
+{
+    TransOpenTraceSummary summary;
+    int32_t ret = TransOpenTraceGetSummary(&summary);
+    if (ret != SOFTBUS_OK) {
+        TRANS_LOGE(TRANS_SVC, "get open trace summary failed. ret=%{public}d", ret);
+        return ret;
+    }
+    SOFTBUS_DPRINTF(fd, "OpenedNum             : %u\n", summary.openedNum);
+    SOFTBUS_DPRINTF(fd, "FailedNum             : %u\n", summary.failedNum);
+    SOFTBUS_DPRINTF(fd, "%-20s %8s %12s %12s %12s %12s\n", "Phase", "Count", "P50(us)", "P90(us)", "P99(us)",
+        "Max(us)");
+    for (uint32_t i = TRANS_OPEN_PHASE_LANE_REQUEST; i <= TRANS_OPEN_PHASE_CHANNEL_OPENED; i++) {
+        const TransOpenPhaseStat *stat = &summary.phase[i];
+        SOFTBUS_DPRINTF(fd, "%-20s %8u %12llu %12llu %12llu %12llu\n", g_phaseName[i], stat->count,
+            (unsigned long long)stat->p50Us, (unsigned long long)stat->p90Us, (unsigned long long)stat->p99Us,
+            (unsigned long long)stat->maxUs);
+    }
+    SOFTBUS_DPRINTF(fd, "%-20s %8u %12llu %12llu %12llu %12llu\n", "total", summary.total.count,
+        (unsigned long long)summary.total.p50Us, (unsigned long long)summary.total.p90Us,
+        (unsigned long long)summary.total.p99Us, (unsigned long long)summary.total.maxUs);
+    return SOFTBUS_OK;
+}
+
+int32_t TransOpenTraceInit(void)
+{
+    if (atomic_load(&g_isTraceInit)) {
+        TRANS_LOGI(TRANS_INIT, "trans open trace has init.");
+        return SOFTBUS_OK;
+    }
+    if (SoftBusMutexInit(&g_bindLock, NULL) != SOFTBUS_OK) {
+        TRANS_LOGE(TRANS_INIT, "trans open trace init lock failed.");
+        return SOFTBUS_LOCK_ERR;
+    }
+    atomic_store(&g_isTraceInit, true);
+    TransOpenTraceClear();
+    return SoftBusRegTransVarDump(CMD_OPEN_TRACE, TransOpenTraceShowInfo);
+}
+
+void TransOpenTraceDeinit(void)
+{
+    if (!atomic_exchange(&g_isTraceInit, false)) {
+        return;
+    }
+    (void)SoftBusMutexDestroy(&g_bindLock);
+}
+
+void TransOpenTraceClear(void)
+{
+    if (!atomic_load(&g_isTraceInit)) {
+        return;
+    }
+    for (uint32_t i = 0; i < TRANS_OPEN_TRACE_RING_NUM; i++) {
+        atomic_store(&g_traceRing[i].head, 0);
+        for (uint32_t j = 0; j < TRANS_OPEN_TRACE_RING_SIZE; j++) {
+            atomic_store(&g_traceRing[i].slot[j].seq, 0);
+        }
+    }
+    if (SoftBusMutexLock(&g_bindLock) != SOFTBUS_OK) {
+        TRANS_LOGE(TRANS_SVC, "lock failed");
+        return;
+    }
+    (void)memset_s(g_binding, sizeof(g_binding), 0, sizeof(g_binding));
+    g_bindCursor = 0;
+    (void)SoftBusMutexUnlock(&g_bindLock);
+}
+
+uint32_t TransOpenTraceBegin(void)
+{
+    if (!atomic_load_explicit(&g_isTraceInit, memory_order_relaxed)) {
+        return TRANS_OPEN_TRACE_INVALID_ID;
+    }
+    uint32_t traceId = atomic_fetch_add_explicit(&g_traceSeq, 1, memory_order_relaxed) + 1;
+    if (traceId == TRANS_OPEN_TRACE_INVALID_ID) {
+        traceId = atomic_fetch_add_explicit(&g_traceSeq, 1, memory_order_relaxed) + 1;
+    }
+    TransOpenTraceRecord(traceId, TRANS_OPEN_PHASE_START);
+    g_curTraceId = traceId;
+    return traceId;
+}
+
+void TransOpenTraceSetCurrent(uint32_t traceId)
+{
+    g_curTraceId = traceId;
+}
+
+uint32_t TransOpenTraceGetCurrent(void)
+{
+    return g_curTraceId;
+}
+
+void TransOpenTraceBind(uint32_t traceId, TransOpenTraceKeyType keyType, int64_t key)
+{
+    if (traceId == TRANS_OPEN_TRACE_INVALID_ID || keyType >= TRANS_OPEN_TRACE_KEY_BUTT ||
+        !atomic_load_explicit(&g_isTraceInit, memory_order_relaxed)) {
+        return;
+    }
+    if (SoftBusMutexLock(&g_bindLock) != SOFTBUS_OK) {
+        TRANS_LOGE(TRANS_SVC, "lock failed");
+        return;
+    }
+    TraceBinding *target = NULL;
+    for (uint32_t i = 0; i < TRANS_OPEN_TRACE_BIND_NUM; i++) {
+        if (g_binding[i].isUsed && g_binding[i].keyType == keyType && g_binding[i].key == key) {
+            target = &g_binding[i];
+            break;
+        }
+        if (!g_binding[i].isUsed && target == NULL) {
+            target = &g_binding[i];
+        }
+    }
+    // an open that never ended gives its slot up to the oldest-first cursor
+    if (target == NULL) {
+        target = &g_binding[g_bindCursor];
+        g_bindCursor = (g_bindCursor + 1) % TRANS_OPEN_TRACE_BIND_NUM;
+    }
+    target->isUsed = true;
+    target->keyType = keyType;
+    target->key = key;
+    target->traceId = traceId;
+    (void)SoftBusMutexUnlock(&g_bindLock);
+}
+
+uint32_t TransOpenTraceGetIdByKey(TransOpenTraceKeyType keyType, int64_t key)
+{
+    if (!atomic_load_explicit(&g_isTraceInit, memory_order_relaxed)) {
+        return TRANS_OPEN_TRACE_INVALID_ID;
+    }
+    if (SoftBusMutexLock(&g_bindLock) != SOFTBUS_OK) {
+        TRANS_LOGE(TRANS_SVC, "lock failed");
+        return TRANS_OPEN_TRACE_INVALID_ID;
+    }
+    uint32_t traceId = TRANS_OPEN_TRACE_INVALID_ID;
+    for (uint32_t i = 0; i < TRANS_OPEN_TRACE_BIND_NUM; i++) {
+        if (g_binding[i].isUsed && g_binding[i].keyType == keyType && g_binding[i].key == key) {
+            traceId = g_binding[i].traceId;
+            break;
+        }
+    }
+    (void)SoftBusMutexUnlock(&g_bindLock);
+    return traceId;
+}
+
+void TransOpenTraceRecord(uint32_t traceId, TransOpenPhase phase)
+{
+    if (traceId == TRANS_OPEN_TRACE_INVALID_ID || phase >= TRANS_OPEN_PHASE_BUTT ||
+        !atomic_load_explicit(&g_isTraceInit, memory_order_relaxed)) {
+        return;
+    }
+    TraceRing *ring = GetThreadRing();
+    uint64_t pos = atomic_fetch_add_explicit(&ring->head, 1, memory_order_relaxed);
+    TraceEventSlot *slot = &ring->slot[pos % TRANS_OPEN_TRACE_RING_SIZE];
+    atomic_store_explicit(&slot->seq, 0, memory_order_relaxed);
+    atomic_thread_fence(memory_order_release);
+    slot->traceId = traceId;
+    slot->phase = (uint32_t)phase;
+    slot->timeUs = GetTraceTimeUs();
+    atomic_store_explicit(&slot->seq, pos + 1, memory_order_release);
+    if (phase == TRANS_OPEN_PHASE_CHANNEL_OPENED || phase == TRANS_OPEN_PHASE_FAILED) {
+        UnbindTrace(traceId);
+    }
+}
+
+void TransOpenTraceRecordByKey(TransOpenTraceKeyType keyType, int64_t key, TransOpenPhase phase)
+{
+    TransOpenTraceRecord(TransOpenTraceGetIdByKey(keyType, key), phase);
+}
+
+int32_t TransOpenTraceGetSpan(uint32_t traceId, TransOpenSpan *span)
+{
+    if (traceId == TRANS_OPEN_TRACE_INVALID_ID || span == NULL) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    TraceEvent *events = (TraceEvent *)SoftBusCalloc(sizeof(TraceEvent) * TRACE_EVENT_BUF_SIZE);
+    if (events == NULL) {
+        TRANS_LOGE(TRANS_SVC, "malloc trace events failed");
+        return SOFTBUS_MALLOC_ERR;
+    }
+    uint32_t num = SnapshotTraceEvents(events, TRACE_EVENT_BUF_SIZE);
+    uint32_t matchNum = 0;
+    for (uint32_t i = 0; i < num; i++) {
+        if (events[i].traceId == traceId) {
+            events[matchNum++] = events[i];
+        }
+    }
+    if (matchNum == 0) {
+        SoftBusFree(events);
+        return SOFTBUS_NOT_FIND;
+    }
+    qsort(events, matchNum, sizeof(TraceEvent), CompareTraceEvent);
+    (void)BuildSpan(events, matchNum, 0, span);
+    SoftBusFree(events);
+    return SOFTBUS_OK;
+}
+
+int32_t TransOpenTraceGetSummary(TransOpenTraceSummary *summary)
+{
+    if (summary == NULL) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    (void)memset_s(summary, sizeof(TransOpenTraceSummary), 0, sizeof(TransOpenTraceSummary));
+    TraceEvent *events = (TraceEvent *)SoftBusCalloc(sizeof(TraceEvent) * TRACE_EVENT_BUF_SIZE);
+    uint64_t *samples = (uint64_t *)SoftBusCalloc(sizeof(uint64_t) * TRACE_EVENT_BUF_SIZE);
+    if (events == NULL || samples == NULL) {
+        TRANS_LOGE(TRANS_SVC, "malloc trace summary buffer failed");
+        SoftBusFree(events);
+        SoftBusFree(samples);
+        return SOFTBUS_MALLOC_ERR;
+    }
+    uint32_t num = SnapshotTraceEvents(events, TRACE_EVENT_BUF_SIZE);
+    qsort(events, num, sizeof(TraceEvent), CompareTraceEvent);
+    CountEndedTrace(events, num, summary);
+    for (uint32_t i = TRANS_OPEN_PHASE_LANE_REQUEST; i <= TRANS_OPEN_PHASE_CHANNEL_OPENED; i++) {
+        FillPhaseStat(events, num, (TransOpenPhase)i, samples, &summary->phase[i]);
+    }
+    FillPhaseStat(events, num, TRANS_OPEN_PHASE_START, samples, &summary->total);
+    SoftBusFree(events);
+    SoftBusFree(samples);
+    return SOFTBUS_OK;
+}
@@ -34,6 +34,7 @@
 #include "trans_event.h"
 #include "trans_lane_manager.h"
 #include "trans_log.h"
+#include "trans_open_trace.h"
 #include "trans_session_manager.h"
 #include "trans_tcp_direct_sessionconn.h"
 #include "trans_udp_channel_manager.h"
@@ -130,6 +131,11 @@ static int32_t TransServerOnChannelOpened(const char *pkgName, int32_t pid, cons
     if (channel->channelType == CHANNEL_TYPE_TCP_DIRECT && ret != SOFTBUS_OK) {
         (void)TransDelTcpChannelInfoByChannelId(channel->channelId);
     }
+    if (!channel->isServer) {
+        TransOpenTraceRecordByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+            TransOpenTraceChannelKey(channel->channelType, channel->channelId),
+            (ret == SOFTBUS_OK) ? TRANS_OPEN_PHASE_CHANNEL_OPENED : TRANS_OPEN_PHASE_FAILED);
+    }
     return ret;
 }
 
@@ -165,6 +171,8 @@ static int32_t TransServerOnChannelOpenFailed(const char *pkgName, int32_t pid,
     if (pkgName == NULL) {
         return SOFTBUS_INVALID_PARAM;
     }
+    TransOpenTraceRecordByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(channelType, channelId), TRANS_OPEN_PHASE_FAILED);
     if (TransLaneMgrDelLane(channelId, channelType, true) != SOFTBUS_OK) {
         TRANS_LOGW(TRANS_CTRL, "delete lane object failed.");
     }
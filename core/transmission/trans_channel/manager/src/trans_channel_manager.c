@@ -53,6 +53,7 @@
 #include "trans_link_listener.h"
 #include "trans_log.h"
 #include "trans_network_statistics.h"
+#include "trans_open_trace.h"
 #include "trans_session_manager.h"
 #include "trans_split_serviceid.h"
 #include "trans_tcp_direct_manager.h"
@@ -312,6 +313,9 @@ int32_t TransChannelInit(void)
     ret = TransChannelResultLoopInit();
     TRANS_CHECK_AND_RETURN_RET_LOGE(ret == SOFTBUS_OK, ret, TRANS_INIT, "trans channel result loop init failed.");
 
+    ret = TransOpenTraceInit();
+    TRANS_CHECK_AND_RETURN_RET_LOGE(ret == SOFTBUS_OK, ret, TRANS_INIT, "trans open trace init failed.");
+
     ReqLinkListener();
     ret = SoftBusMutexInit(&g_myIdLock, NULL);
     TRANS_CHECK_AND_RETURN_RET_LOGE(ret == SOFTBUS_OK, ret, TRANS_INIT, "init lock failed.");
@@ -334,6 +338,7 @@ void TransChannelDeinit(void)
     TransFreeLanePendingDeinit();
     TransBindRequestManagerDeinit();
     TransUkRequestMgrDeinit();
+    TransOpenTraceDeinit();
     SoftBusMutexDestroy(&g_myIdLock);
 }
 
@@ -408,7 +413,7 @@ static int32_t TransCheckBlockStatus(const SessionParam *param, TransInfo *trans
     return SOFTBUS_OK;
 }
 
-int32_t TransOpenChannel(const SessionParam *param, TransInfo *transInfo)
+static int32_t TransOpenChannelInner(const SessionParam *param, TransInfo *transInfo)
 {
     SoftBusHitraceChainBegin("TransOpenChannel");
     int32_t ret = TransCheckBlockStatus(param, transInfo);
@@ -479,8 +484,12 @@ int32_t TransOpenChannel(const SessionParam *param, TransInfo *transInfo)
     TransSetQosInfo(param->qos, param->qosCount, &extra);
     extra.sessionId = param->sessionId;
     TRANS_EVENT(EVENT_SCENE_OPEN_CHANNEL, EVENT_STAGE_OPEN_CHANNEL_START, extra);
-    if (param->isQosLane) {
-        ret = TransAsyncGetLaneInfo(param, &laneHandle, appInfo);
+    TransOpenTraceRecord(TransOpenTraceGetCurrent(), TRANS_OPEN_PHASE_LANE_REQUEST);
+    transInfo->channelId = INVALID_CHANNEL_ID;
+    transInfo->channelType = CHANNEL_TYPE_BUTT;
+    if (param->isQosLane || param->isAsync) {
+        ret = param->isQosLane ? TransAsyncGetLaneInfo(param, &laneHandle, appInfo) :
+            TransAsyncGetLaneInfoByOption(param, &laneHandle, appInfo);
         if (ret != SOFTBUS_OK) {
             Anonymize(param->sessionName, &tmpName);
             TRANS_LOGE(TRANS_CTRL, "Async get Lane failed, sessionName=%{public}s, sessionId=%{public}d",
@@ -495,8 +504,6 @@ int32_t TransOpenChannel(const SessionParam *param, TransInfo *transInfo)
         SoftBusHitraceChainEnd();
         return ret;
     }
-    transInfo->channelId = INVALID_CHANNEL_ID;
-    transInfo->channelType = CHANNEL_TYPE_BUTT;
     LaneConnInfo connInfo;
     ConnectOption connOpt;
     (void)memset_s(&connOpt, sizeof(ConnectOption), 0, sizeof(ConnectOption));
@@ -505,6 +512,8 @@ int32_t TransOpenChannel(const SessionParam *param, TransInfo *transInfo)
         SoftbusReportTransErrorEvt(SOFTBUS_TRANS_GET_LANE_INFO_ERR);
         goto EXIT_ERR;
     }
+    TransOpenTraceRecord(TransOpenTraceGetCurrent(), TRANS_OPEN_PHASE_LANE_ALLOCED);
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_LANE_HANDLE, laneHandle);
     Anonymize(param->sessionName, &tmpName);
     TRANS_LOGI(TRANS_CTRL,
         "sessionName=%{public}s, socket=%{public}d, laneHandle=%{public}u, linkType=%{public}u.",
@@ -527,6 +536,7 @@ int32_t TransOpenChannel(const SessionParam *param, TransInfo *transInfo)
         goto EXIT_CANCEL;
     }
     TransSetSocketChannelStateBySession(param->sessionName, param->sessionId, CORE_SESSION_STATE_LAN_COMPLETE);
+    TransOpenTraceRecord(TransOpenTraceGetCurrent(), TRANS_OPEN_PHASE_CHANNEL_CONNECT);
     ret = TransOpenChannelProc((ChannelType)transInfo->channelType, appInfo, &connOpt, &(transInfo->channelId));
     (void)memset_s(appInfo->sessionKey, sizeof(appInfo->sessionKey), 0, sizeof(appInfo->sessionKey));
     (void)memset_s(appInfo->sinkSessionKey, sizeof(appInfo->sinkSessionKey), 0, sizeof(appInfo->sinkSessionKey));
@@ -536,6 +546,8 @@ int32_t TransOpenChannel(const SessionParam *param, TransInfo *transInfo)
             appInfo->linkType, SOFTBUS_EVT_OPEN_SESSION_FAIL, GetSoftbusRecordTimeMillis() - appInfo->timeStart);
         goto EXIT_ERR;
     }
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(transInfo->channelType, transInfo->channelId));
     if (TransUpdateSocketChannelInfoBySession(
         param->sessionName, param->sessionId, transInfo->channelId, transInfo->channelType) != SOFTBUS_OK) {
         SoftbusRecordOpenSessionKpi(appInfo->myData.pkgName, appInfo->linkType, SOFTBUS_EVT_OPEN_SESSION_FAIL,
@@ -585,6 +597,17 @@ EXIT_CANCEL:
     return SOFTBUS_TRANS_STOP_BIND_BY_CANCEL;
 }
 
+int32_t TransOpenChannel(const SessionParam *param, TransInfo *transInfo)
+{
+    uint32_t traceId = TransOpenTraceBegin();
+    int32_t ret = TransOpenChannelInner(param, transInfo);
+    if (ret != SOFTBUS_OK) {
+        TransOpenTraceRecord(traceId, TRANS_OPEN_PHASE_FAILED);
+    }
+    TransOpenTraceSetCurrent(TRANS_OPEN_TRACE_INVALID_ID);
+    return ret;
+}
+
 static void TransOpenChannelSecondDFXEvent(SessionParam *param, AppInfo *appInfo)
 {
     if (param == NULL || appInfo == NULL) {
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,6 +16,7 @@
 #ifndef SOFTBUS_PROXYCHANNEL_LISTENER_H
 #define SOFTBUS_PROXYCHANNEL_LISTENER_H
 #include "softbus_app_info.h"
+#include "softbus_proxychannel_message_struct.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -26,6 +27,7 @@ int32_t OnProxyChannelBind(int32_t channelId, const AppInfo *appInfo);
 int32_t OnProxyChannelOpenFailed(int32_t channelId, const AppInfo *appInfo, int32_t errCode);
 int32_t OnProxyChannelClosed(int32_t channelId, const AppInfo *appInfo);
 int32_t OnProxyChannelMsgReceived(int32_t channelId, const AppInfo *appInfo, const char *data, uint32_t len);
+int32_t OnProxyChannelDataReceived(const ProxyChannelRecvInfo *recvInfo, const char *data, uint32_t len);
 
 #ifdef __cplusplus
 }
@@ -49,6 +49,8 @@ void TransProxyOnMessageReceived(const ProxyMessage *msg);
 int32_t TransProxyGetChannelCapaByChanId(int32_t channelId, uint32_t *channelCapability);
 int32_t TransProxyGetSessionKeyByChanId(int32_t channelId, char *sessionKey, uint32_t sessionKeySize);
 int32_t TransProxyGetSendMsgChanInfo(int32_t channelId, ProxyChannelInfo *chanInfo);
+int32_t TransProxyGetSendMsgInfo(int32_t channelId, ProxyChannelSendInfo *sendInfo);
+void TransProxyFillSendMsgInfo(const ProxyChannelInfo *chan, ProxyChannelSendInfo *sendInfo);
 
 int32_t TransProxyCreateChanInfo(ProxyChannelInfo *chan, int32_t channelId, const AppInfo *appInfo);
 void TransProxyChanProcessByReqId(int32_t reqId, uint32_t connId, int32_t errCode);
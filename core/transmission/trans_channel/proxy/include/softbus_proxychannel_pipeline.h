@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -34,6 +34,7 @@ int32_t TransProxyPipelineGetChannelIdByNetworkId(const char *networkId);
 int32_t TransProxyPipelineGetUuidByChannelId(int32_t channelId, char *uuid, uint32_t uuidLen);
 int32_t TransProxyPipelineCloseChannel(int32_t channelId);
 int32_t TransProxyPipelineCloseChannelDelay(int32_t channelId);
+int32_t TransProxyPipelineCancelChannel(int32_t requestId);
 int32_t TransProxyPipelineInit(void);
 int32_t TransProxyReuseByChannelId(int32_t channelId);
 
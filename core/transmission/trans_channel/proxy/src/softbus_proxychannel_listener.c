@@ -364,21 +364,17 @@ int32_t OnProxyChannelClosed(int32_t channelId, const AppInfo *appInfo)
     return ret;
 }
 
-int32_t OnProxyChannelMsgReceived(int32_t channelId, const AppInfo *appInfo, const char *data,
-    uint32_t len)
+static int32_t DispatchProxyChannelMsg(AppType appType, const char *pkgName, const char *sessionName,
+    int32_t pid, int32_t channelId, const char *data, uint32_t len)
 {
     int32_t ret = SOFTBUS_OK;
-    if (appInfo == NULL || data == NULL || len == 0) {
-        return SOFTBUS_INVALID_PARAM;
-    }
-
-    switch (appInfo->appType) {
+    switch (appType) {
         case APP_TYPE_NORMAL:
         case APP_TYPE_AUTH:
-            TransOnNormalMsgReceived(appInfo->myData.pkgName, appInfo->myData.pid, channelId, data, len);
+            TransOnNormalMsgReceived(pkgName, pid, channelId, data, len);
             break;
         case APP_TYPE_INNER:
-            NotifyNetworkingMsgReceived(appInfo->myData.sessionName, channelId, data, len);
+            NotifyNetworkingMsgReceived(sessionName, channelId, data, len);
             break;
         default:
             ret = SOFTBUS_TRANS_PROXY_ERROR_APP_TYPE;
@@ -387,6 +383,25 @@ int32_t OnProxyChannelMsgReceived(int32_t channelId, const AppInfo *appInfo, con
     return ret;
 }
 
+int32_t OnProxyChannelMsgReceived(int32_t channelId, const AppInfo *appInfo, const char *data,
+    uint32_t len)
+{
+    if (appInfo == NULL || data == NULL || len == 0) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    return DispatchProxyChannelMsg(appInfo->appType, appInfo->myData.pkgName, appInfo->myData.sessionName,
+        appInfo->myData.pid, channelId, data, len);
+}
+
+int32_t OnProxyChannelDataReceived(const ProxyChannelRecvInfo *recvInfo, const char *data, uint32_t len)
+{
+    if (recvInfo == NULL || data == NULL || len == 0) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    return DispatchProxyChannelMsg(recvInfo->appType, recvInfo->pkgName, recvInfo->sessionName,
+        recvInfo->pid, recvInfo->channelId, data, len);
+}
+
 static int32_t TransGetConnectOption(const char *sessionName, const char *peerNetworkId,
     const LanePreferredLinkList *preferred, int32_t channelId)
 {
@@ -68,7 +68,11 @@
 #define PROXY_CHANNEL_TCP_IDLE_TIMEOUT 43200 // tcp 24 hour
 #define PROXY_CHANNEL_CLIENT           0
 #define PROXY_CHANNEL_SERVER           1
+#define PROXY_CHANNEL_BUCKET_NUM       256 // must be a power of 2
 static SoftBusList *g_proxyChannelList = NULL;
+// channelId and (myId, peerId) indexes of g_proxyChannelList, guarded by its lock
+static ListNode g_proxyChannelIdBucket[PROXY_CHANNEL_BUCKET_NUM];
+static ListNode g_proxyChannelPairBucket[PROXY_CHANNEL_BUCKET_NUM];
 
 typedef struct {
     int32_t channelType;
@@ -101,6 +105,85 @@ void ReleaseProxyChannelLock(void)
     (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
 }
 
+static void InitProxyChannelBucket(void)
+{
+    for (uint32_t i = 0; i < PROXY_CHANNEL_BUCKET_NUM; i++) {
+        ListInit(&g_proxyChannelIdBucket[i]);
+        ListInit(&g_proxyChannelPairBucket[i]);
+    }
+}
+
+static ListNode *GetProxyChannelIdBucket(int32_t channelId)
+{
+    ListNode *head = &g_proxyChannelIdBucket[(uint32_t)channelId & (PROXY_CHANNEL_BUCKET_NUM - 1)];
+    if (head->next == NULL) {
+        ListInit(head);
+    }
+    return head;
+}
+
+/* the peerId of a channel changes on handshake ack, so the pair index is keyed by myId only */
+static ListNode *GetProxyChannelPairBucket(int16_t myId)
+{
+    ListNode *head = &g_proxyChannelPairBucket[(uint16_t)myId & (PROXY_CHANNEL_BUCKET_NUM - 1)];
+    if (head->next == NULL) {
+        ListInit(head);
+    }
+    return head;
+}
+
+/* the caller holds the lock of g_proxyChannelList */
+static void AddProxyChanLocked(ProxyChannelInfo *chan)
+{
+    if (IsListEmpty(&(g_proxyChannelList->list))) {
+        // the list may have been recreated without TransProxyManagerInitInner, drop what the indexes still hold
+        InitProxyChannelBucket();
+    }
+    ListAdd(&(g_proxyChannelList->list), &(chan->node));
+    ListInit(&(chan->idHashNode));
+    ListAdd(GetProxyChannelIdBucket(chan->channelId), &(chan->idHashNode));
+    ListInit(&(chan->pairHashNode));
+    ListAdd(GetProxyChannelPairBucket(chan->myId), &(chan->pairHashNode));
+}
+
+/* the caller holds the lock of g_proxyChannelList */
+static void DelProxyChanLocked(ProxyChannelInfo *chan)
+{
+    ListDelete(&(chan->node));
+    ListDelete(&(chan->idHashNode));
+    ListDelete(&(chan->pairHashNode));
+}
+
+/* the caller holds the lock of g_proxyChannelList */
+static ProxyChannelInfo *GetProxyChanByIdLocked(int32_t channelId)
+{
+    ProxyChannelInfo *item = NULL;
+    if (IsListEmpty(&(g_proxyChannelList->list))) {
+        return NULL;
+    }
+    LIST_FOR_EACH_ENTRY(item, GetProxyChannelIdBucket(channelId), ProxyChannelInfo, idHashNode) {
+        if (item->channelId == channelId) {
+            return item;
+        }
+    }
+    return NULL;
+}
+
+/* the caller holds the lock of g_proxyChannelList */
+static ProxyChannelInfo *GetProxyChanByPairLocked(int16_t myId, int16_t peerId)
+{
+    ProxyChannelInfo *item = NULL;
+    if (IsListEmpty(&(g_proxyChannelList->list))) {
+        return NULL;
+    }
+    LIST_FOR_EACH_ENTRY(item, GetProxyChannelPairBucket(myId), ProxyChannelInfo, pairHashNode) {
+        if ((item->myId == myId) && (item->peerId == peerId)) {
+            return item;
+        }
+    }
+    return NULL;
+}
+
 static bool ChanIsEqual(ProxyChannelInfo *a, ProxyChannelInfo *b)
 {
     if ((a->myId == b->myId) &&
@@ -419,7 +502,7 @@ static int32_t TransProxyAddChanItem(ProxyChannelInfo *chan)
     TRANS_CHECK_AND_RETURN_RET_LOGE(
         SoftBusMutexLock(&g_proxyChannelList->lock) == SOFTBUS_OK, SOFTBUS_LOCK_ERR, TRANS_CTRL, "lock mutex fail!");
 
-    ListAdd(&(g_proxyChannelList->list), &(chan->node));
+    AddProxyChanLocked(chan);
     g_proxyChannelList->cnt++;
     (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
     return SOFTBUS_OK;
@@ -548,7 +631,7 @@ void TransProxyDelChanByReqId(int32_t reqId, int32_t errCode)
         if ((item->reqId == reqId) &&
             (item->status == PROXY_CHANNEL_STATUS_PYH_CONNECTING)) {
             ReleaseProxyChannelId(item->channelId);
-            ListDelete(&(item->node));
+            DelProxyChanLocked(item);
             g_proxyChannelList->cnt--;
             TRANS_LOGI(TRANS_CTRL, "del channelId by reqId. channelId=%{public}d", item->channelId);
             SoftBusFree((void *)item->appInfo.fastTransData);
@@ -573,7 +656,7 @@ void TransProxyDelChanByChanId(int32_t chanlId)
     LIST_FOR_EACH_ENTRY_SAFE(item, nextNode, &g_proxyChannelList->list, ProxyChannelInfo, node) {
         if (item->channelId == chanlId) {
             ReleaseProxyChannelId(item->channelId);
-            ListDelete(&(item->node));
+            DelProxyChanLocked(item);
             if (item->appInfo.fastTransData != NULL) {
                 SoftBusFree((void *)item->appInfo.fastTransData);
             }
@@ -675,7 +758,7 @@ void TransProxyDelByConnId(uint32_t connId)
     ListInit(&proxyChannelList);
     LIST_FOR_EACH_ENTRY_SAFE(removeNode, nextNode, &g_proxyChannelList->list, ProxyChannelInfo, node) {
         if (removeNode->connId == connId) {
-            ListDelete(&(removeNode->node));
+            DelProxyChanLocked(removeNode);
             g_proxyChannelList->cnt--;
             ListAdd(&proxyChannelList, &removeNode->node);
             TRANS_LOGI(TRANS_CTRL, "trans proxy del channel by connId=%{public}d", connId);
@@ -704,7 +787,7 @@ static int32_t TransProxyDelByChannelId(int32_t channelId, ProxyChannelInfo *cha
             if (removeNode->appInfo.fastTransData != NULL) {
                 SoftBusFree((void *)removeNode->appInfo.fastTransData);
             }
-            ListDelete(&(removeNode->node));
+            DelProxyChanLocked(removeNode);
             SoftBusFree(removeNode);
             g_proxyChannelList->cnt--;
             (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
@@ -734,7 +817,7 @@ int32_t TransPagingResetChan(ProxyChannelInfo *chanInfo)
                 return SOFTBUS_MEM_ERR;
             }
             ReleaseProxyChannelId(removeNode->channelId);
-            ListDelete(&(removeNode->node));
+            DelProxyChanLocked(removeNode);
             SoftBusFree(removeNode);
             g_proxyChannelList->cnt--;
             (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
@@ -768,7 +851,7 @@ static int32_t TransProxyResetChan(ProxyChannelInfo *chanInfo)
             if (removeNode->appInfo.fastTransData != NULL) {
                 SoftBusFree((void *)removeNode->appInfo.fastTransData);
             }
-            ListDelete(&(removeNode->node));
+            DelProxyChanLocked(removeNode);
             SoftBusFree(removeNode);
             g_proxyChannelList->cnt--;
             (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
@@ -781,31 +864,32 @@ static int32_t TransProxyResetChan(ProxyChannelInfo *chanInfo)
     return SOFTBUS_TRANS_NODE_NOT_FOUND;
 }
 
-static int32_t TransProxyGetRecvMsgChanInfo(int16_t myId, int16_t peerId, ProxyChannelInfo *chanInfo)
+static int32_t TransProxyGetRecvMsgInfo(int16_t myId, int16_t peerId, ProxyChannelRecvInfo *recvInfo)
 {
-    ProxyChannelInfo *item = NULL;
-
     TRANS_CHECK_AND_RETURN_RET_LOGE(
         g_proxyChannelList != NULL, SOFTBUS_NO_INIT, TRANS_CTRL, "g_proxyChannelList is null");
     TRANS_CHECK_AND_RETURN_RET_LOGE(
         SoftBusMutexLock(&g_proxyChannelList->lock) == SOFTBUS_OK, SOFTBUS_LOCK_ERR, TRANS_CTRL, "lock mutex fail!");
 
-    LIST_FOR_EACH_ENTRY(item, &g_proxyChannelList->list, ProxyChannelInfo, node) {
-        if ((item->myId == myId) && (item->peerId == peerId)) {
-            if (item->status == PROXY_CHANNEL_STATUS_COMPLETED) {
-                item->timeout = 0;
-            }
-            if (memcpy_s(chanInfo, sizeof(ProxyChannelInfo), item, sizeof(ProxyChannelInfo)) != EOK) {
-                (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-                TRANS_LOGE(TRANS_SVC, "memcpy_s failed");
-                return SOFTBUS_MEM_ERR;
-            }
-            (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-            return SOFTBUS_OK;
-        }
+    ProxyChannelInfo *item = GetProxyChanByPairLocked(myId, peerId);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+        return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    }
+    if (item->status == PROXY_CHANNEL_STATUS_COMPLETED) {
+        item->timeout = 0;
+    }
+    recvInfo->channelId = item->channelId;
+    recvInfo->pid = item->appInfo.myData.pid;
+    recvInfo->appType = item->appInfo.appType;
+    if (strcpy_s(recvInfo->pkgName, sizeof(recvInfo->pkgName), item->appInfo.myData.pkgName) != EOK ||
+        strcpy_s(recvInfo->sessionName, sizeof(recvInfo->sessionName), item->appInfo.myData.sessionName) != EOK) {
+        (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+        TRANS_LOGE(TRANS_SVC, "strcpy_s failed");
+        return SOFTBUS_STRCPY_ERR;
     }
     (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-    return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 static int32_t TransProxyKeepAliveChan(ProxyChannelInfo *chanInfo)
@@ -838,29 +922,61 @@ static int32_t TransProxyKeepAliveChan(ProxyChannelInfo *chanInfo)
 
 int32_t TransProxyGetSendMsgChanInfo(int32_t channelId, ProxyChannelInfo *chanInfo)
 {
-    ProxyChannelInfo *item = NULL;
+    TRANS_CHECK_AND_RETURN_RET_LOGE(
+        g_proxyChannelList != NULL, SOFTBUS_NO_INIT, TRANS_CTRL, "g_proxyChannelList is null");
+    TRANS_CHECK_AND_RETURN_RET_LOGE(
+        SoftBusMutexLock(&g_proxyChannelList->lock) == SOFTBUS_OK, SOFTBUS_LOCK_ERR, TRANS_CTRL, "lock mutex fail!");
+
+    ProxyChannelInfo *item = GetProxyChanByIdLocked(channelId);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+        return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    }
+    if (item->status == PROXY_CHANNEL_STATUS_COMPLETED) {
+        item->timeout = 0;
+    }
+    if (memcpy_s(chanInfo, sizeof(ProxyChannelInfo), item, sizeof(ProxyChannelInfo)) != EOK) {
+        (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+        TRANS_LOGE(TRANS_SVC, "memcpy_s failed");
+        return SOFTBUS_MEM_ERR;
+    }
+    (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+    return SOFTBUS_OK;
+}
+
+void TransProxyFillSendMsgInfo(const ProxyChannelInfo *chan, ProxyChannelSendInfo *sendInfo)
+{
+    if (chan == NULL || sendInfo == NULL) {
+        return;
+    }
+    sendInfo->status = chan->status;
+    sendInfo->myId = chan->myId;
+    sendInfo->peerId = chan->peerId;
+    sendInfo->connId = chan->connId;
+    sendInfo->pid = chan->appInfo.myData.pid;
+    sendInfo->appType = chan->appInfo.appType;
+    sendInfo->businessType = chan->appInfo.businessType;
+}
 
+int32_t TransProxyGetSendMsgInfo(int32_t channelId, ProxyChannelSendInfo *sendInfo)
+{
+    TRANS_CHECK_AND_RETURN_RET_LOGE(sendInfo != NULL, SOFTBUS_INVALID_PARAM, TRANS_CTRL, "sendInfo is null");
     TRANS_CHECK_AND_RETURN_RET_LOGE(
         g_proxyChannelList != NULL, SOFTBUS_NO_INIT, TRANS_CTRL, "g_proxyChannelList is null");
     TRANS_CHECK_AND_RETURN_RET_LOGE(
         SoftBusMutexLock(&g_proxyChannelList->lock) == SOFTBUS_OK, SOFTBUS_LOCK_ERR, TRANS_CTRL, "lock mutex fail!");
 
-    LIST_FOR_EACH_ENTRY(item, &g_proxyChannelList->list, ProxyChannelInfo, node) {
-        if (item->channelId == channelId) {
-            if (item->status == PROXY_CHANNEL_STATUS_COMPLETED) {
-                item->timeout = 0;
-            }
-            if (memcpy_s(chanInfo, sizeof(ProxyChannelInfo), item, sizeof(ProxyChannelInfo)) != EOK) {
-                (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-                TRANS_LOGE(TRANS_SVC, "memcpy_s failed");
-                return SOFTBUS_MEM_ERR;
-            }
-            (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-            return SOFTBUS_OK;
-        }
+    ProxyChannelInfo *item = GetProxyChanByIdLocked(channelId);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+        return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    }
+    if (item->status == PROXY_CHANNEL_STATUS_COMPLETED) {
+        item->timeout = 0;
     }
+    TransProxyFillSendMsgInfo(item, sendInfo);
     (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-    return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 int32_t TransProxyGetAuthId(int32_t channelId, AuthHandle *authHandle)
@@ -872,15 +988,14 @@ int32_t TransProxyGetAuthId(int32_t channelId, AuthHandle *authHandle)
         g_proxyChannelList != NULL, SOFTBUS_NO_INIT, TRANS_CTRL, "g_proxyChannelList is null");
     TRANS_CHECK_AND_RETURN_RET_LOGE(
         SoftBusMutexLock(&g_proxyChannelList->lock) == SOFTBUS_OK, SOFTBUS_LOCK_ERR, TRANS_CTRL, "lock mutex fail!");
-    LIST_FOR_EACH_ENTRY(item, &g_proxyChannelList->list, ProxyChannelInfo, node) {
-        if (item->channelId == channelId) {
-            *authHandle = item->authHandle;
-            (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-            return SOFTBUS_OK;
-        }
+    item = GetProxyChanByIdLocked(channelId);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+        return SOFTBUS_TRANS_NODE_NOT_FOUND;
     }
+    *authHandle = item->authHandle;
     (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-    return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 int32_t TransProxyGetChannelCapaByChanId(int32_t channelId, uint32_t *channelCapability)
@@ -892,19 +1007,18 @@ int32_t TransProxyGetChannelCapaByChanId(int32_t channelId, uint32_t *channelCap
         g_proxyChannelList != NULL, SOFTBUS_NO_INIT, TRANS_CTRL, "g_proxyChannelList is null");
     TRANS_CHECK_AND_RETURN_RET_LOGE(
         SoftBusMutexLock(&g_proxyChannelList->lock) == SOFTBUS_OK, SOFTBUS_LOCK_ERR, TRANS_CTRL, "lock mutex fail!");
-    LIST_FOR_EACH_ENTRY(item, &g_proxyChannelList->list, ProxyChannelInfo, node) {
-        if (item->channelId == channelId) {
-            if (item->status == PROXY_CHANNEL_STATUS_COMPLETED) {
-                item->timeout = 0;
-            }
-            *channelCapability = item->appInfo.channelCapability;
-            (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-            return SOFTBUS_OK;
-        }
+    item = GetProxyChanByIdLocked(channelId);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+        TRANS_LOGE(TRANS_CTRL, "not found ChannelCapability by channelId=%{public}d", channelId);
+        return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
     }
+    if (item->status == PROXY_CHANNEL_STATUS_COMPLETED) {
+        item->timeout = 0;
+    }
+    *channelCapability = item->appInfo.channelCapability;
     (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-    TRANS_LOGE(TRANS_CTRL, "not found ChannelCapability by channelId=%{public}d", channelId);
-    return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 int32_t TransProxyGetSessionKeyByChanId(int32_t channelId, char *sessionKey, uint32_t sessionKeySize)
@@ -916,24 +1030,22 @@ int32_t TransProxyGetSessionKeyByChanId(int32_t channelId, char *sessionKey, uin
         g_proxyChannelList != NULL, SOFTBUS_NO_INIT, TRANS_CTRL, "g_proxyChannelList is null");
     TRANS_CHECK_AND_RETURN_RET_LOGE(
         SoftBusMutexLock(&g_proxyChannelList->lock) == SOFTBUS_OK, SOFTBUS_LOCK_ERR, TRANS_CTRL, "lock mutex fail!");
-    LIST_FOR_EACH_ENTRY(item, &g_proxyChannelList->list, ProxyChannelInfo, node) {
-        if (item->channelId == channelId) {
-            if (item->status == PROXY_CHANNEL_STATUS_COMPLETED) {
-                item->timeout = 0;
-            }
-            if (memcpy_s(sessionKey, sessionKeySize, item->appInfo.sessionKey,
-                sizeof(item->appInfo.sessionKey)) != EOK) {
-                TRANS_LOGE(TRANS_CTRL, "memcpy_s fail!");
-                (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-                return SOFTBUS_MEM_ERR;
-            }
-            (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-            return SOFTBUS_OK;
-        }
+    item = GetProxyChanByIdLocked(channelId);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+        TRANS_LOGE(TRANS_CTRL, "not found ChannelInfo by channelId=%{public}d", channelId);
+        return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
+    }
+    if (item->status == PROXY_CHANNEL_STATUS_COMPLETED) {
+        item->timeout = 0;
+    }
+    if (memcpy_s(sessionKey, sessionKeySize, item->appInfo.sessionKey, sizeof(item->appInfo.sessionKey)) != EOK) {
+        TRANS_LOGE(TRANS_CTRL, "memcpy_s fail!");
+        (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+        return SOFTBUS_MEM_ERR;
     }
     (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-    TRANS_LOGE(TRANS_CTRL, "not found ChannelInfo by channelId=%{public}d", channelId);
-    return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 void TransProxyProcessErrMsg(ProxyChannelInfo *info, int32_t errCode)
@@ -2017,24 +2129,14 @@ void TransProxyProcessKeepAliveAck(const ProxyMessage *msg)
 
 void TransProxyProcessDataRecv(const ProxyMessage *msg)
 {
-    ProxyChannelInfo *info = (ProxyChannelInfo *)SoftBusCalloc(sizeof(ProxyChannelInfo));
-    if (info == NULL) {
-        TRANS_LOGE(TRANS_CTRL, "ProxyProcessDataRecv calloc failed.");
-        return;
-    }
-
-    if (TransProxyGetRecvMsgChanInfo(msg->msgHead.myId, msg->msgHead.peerId, info) != SOFTBUS_OK) {
+    ProxyChannelRecvInfo info;
+    if (TransProxyGetRecvMsgInfo(msg->msgHead.myId, msg->msgHead.peerId, &info) != SOFTBUS_OK) {
         TRANS_LOGE(TRANS_CTRL, "data recv get info fail myChannelId=%{public}d, peerChannelId=%{public}d",
             msg->msgHead.myId, msg->msgHead.peerId);
-        SoftBusFree(info);
         return;
     }
 
-    OnProxyChannelMsgReceived(info->channelId, &(info->appInfo), msg->data, msg->dataLen);
-    (void)memset_s(info->appInfo.sessionKey, sizeof(info->appInfo.sessionKey), 0, sizeof(info->appInfo.sessionKey));
-    (void)memset_s(info->appInfo.sinkSessionKey, sizeof(info->appInfo.sinkSessionKey), 0,
-        sizeof(info->appInfo.sinkSessionKey));
-    SoftBusFree(info);
+    (void)OnProxyChannelDataReceived(&info, msg->data, msg->dataLen);
 }
 
 void TransProxyOnMessageReceived(const ProxyMessage *msg)
@@ -2318,7 +2420,7 @@ void TransProxyTimerProc(void)
                     PROXY_CHANNEL_STATUS_HANDSHAKE_TIMEOUT : PROXY_CHANNEL_STATUS_CONNECTING_TIMEOUT;
                 TRANS_LOGE(TRANS_CTRL, "handshake is timeout. channelId=%{public}d", removeNode->myId);
                 ReleaseProxyChannelId(removeNode->channelId);
-                ListDelete(&(removeNode->node));
+                DelProxyChanLocked(removeNode);
                 ListAdd(&proxyProcList, &(removeNode->node));
                 g_proxyChannelList->cnt--;
             }
@@ -2328,7 +2430,7 @@ void TransProxyTimerProc(void)
                 removeNode->status = PROXY_CHANNEL_STATUS_TIMEOUT;
                 TRANS_LOGE(TRANS_CTRL, "keepalvie is timeout. channelId=%{public}d", removeNode->myId);
                 ReleaseProxyChannelId(removeNode->channelId);
-                ListDelete(&(removeNode->node));
+                DelProxyChanLocked(removeNode);
                 ListAdd(&proxyProcList, &(removeNode->node));
                 g_proxyChannelList->cnt--;
             }
@@ -2477,6 +2579,7 @@ static int32_t TransProxyManagerInitInner(const IServerChannelCallBack *cb)
         TRANS_LOGE(TRANS_INIT, "proxy manager init inner failed");
         return SOFTBUS_MALLOC_ERR;
     }
+    InitProxyChannelBucket();
     return SOFTBUS_OK;
 }
 
@@ -2560,12 +2663,13 @@ static void TransProxyManagerDeinitInner(void)
     ProxyChannelInfo *nextNode = NULL;
     LIST_FOR_EACH_ENTRY_SAFE(item, nextNode, &g_proxyChannelList->list, ProxyChannelInfo, node) {
         ReleaseProxyChannelId(item->channelId);
-        ListDelete(&(item->node));
+        DelProxyChanLocked(item);
         if (item->appInfo.fastTransData != NULL) {
             SoftBusFree((void *)item->appInfo.fastTransData);
         }
         SoftBusFree(item);
     }
+    InitProxyChannelBucket();
     (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
 
     DestroySoftBusList(g_proxyChannelList);
@@ -2621,7 +2725,7 @@ void TransProxyDeathCallback(const char *pkgName, int32_t pid)
     LIST_FOR_EACH_ENTRY_SAFE(item, nextNode, &g_proxyChannelList->list, ProxyChannelInfo, node) {
         if ((strcmp(item->appInfo.myData.pkgName, pkgName) == 0) && (item->appInfo.myData.pid == pid)) {
             ReleaseProxyChannelId(item->channelId);
-            ListDelete(&(item->node));
+            DelProxyChanLocked(item);
             g_proxyChannelList->cnt--;
             ListAdd(&destroyList, &(item->node));
             TRANS_LOGI(TRANS_CTRL, "add channelId=%{public}d", item->channelId);
@@ -2649,7 +2753,7 @@ void TransProxyCloseChannelByRequestId(uint32_t requestId)
         if (item->reqId == (int32_t)requestId && item->status != PROXY_CHANNEL_STATUS_COMPLETED &&
             item->isFork != true) {
             ReleaseProxyChannelId(item->channelId);
-            ListDelete(&(item->node));
+            DelProxyChanLocked(item);
             g_proxyChannelList->cnt--;
             ListAdd(&destroyList, &(item->node));
             TRANS_LOGI(TRANS_CTRL, "add destroy channelId=%{public}d", item->channelId);
@@ -2699,22 +2803,19 @@ int32_t TransProxyGetConnIdByChanId(int32_t channelId, int32_t *connId)
     TRANS_CHECK_AND_RETURN_RET_LOGE(
         SoftBusMutexLock(&g_proxyChannelList->lock) == SOFTBUS_OK, SOFTBUS_LOCK_ERR, TRANS_CTRL, "lock mutex fail!");
 
-    LIST_FOR_EACH_ENTRY(item, &g_proxyChannelList->list, ProxyChannelInfo, node) {
-        if (item->channelId == channelId) {
-            if (item->status == PROXY_CHANNEL_STATUS_COMPLETED ||
-                item->status == PROXY_CHANNEL_STATUS_KEEPLIVEING) {
-                *connId = (int32_t)item->connId;
-                (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-                return SOFTBUS_OK;
-            } else {
-                TRANS_LOGE(TRANS_CTRL, "g_proxyChannel status error");
-                (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-                return SOFTBUS_TRANS_PROXY_CHANNLE_STATUS_INVALID;
-            }
-        }
+    item = GetProxyChanByIdLocked(channelId);
+    if (item == NULL) {
+        (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+        return SOFTBUS_TRANS_NODE_NOT_FOUND;
     }
+    if (item->status != PROXY_CHANNEL_STATUS_COMPLETED && item->status != PROXY_CHANNEL_STATUS_KEEPLIVEING) {
+        TRANS_LOGE(TRANS_CTRL, "g_proxyChannel status error");
+        (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+        return SOFTBUS_TRANS_PROXY_CHANNLE_STATUS_INVALID;
+    }
+    *connId = (int32_t)item->connId;
     (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
-    return SOFTBUS_TRANS_NODE_NOT_FOUND;
+    return SOFTBUS_OK;
 }
 
 int32_t TransProxyGetProxyChannelInfoByChannelId(int32_t channelId, ProxyChannelInfo *chan)
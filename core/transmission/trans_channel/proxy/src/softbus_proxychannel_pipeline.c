@@ -325,6 +325,37 @@ int32_t TransProxyPipelineCloseChannel(int32_t channelId)
     return SOFTBUS_OK;
 }
 
+int32_t TransProxyPipelineCancelChannel(int32_t requestId)
+{
+    TRANS_LOGI(TRANS_CTRL, "enter, reqId=%{public}d", requestId);
+    TRANS_CHECK_AND_RETURN_RET_LOGW(SoftBusMutexLock(&g_manager.channels->lock) == SOFTBUS_OK,
+        SOFTBUS_LOCK_ERR, TRANS_CTRL, "lock failed");
+
+    struct PipelineChannelItem *target = SearchChannelItemUnsafe(&requestId, CompareByRequestId);
+    if (target == NULL) {
+        SoftBusMutexUnlock(&g_manager.channels->lock);
+        TRANS_LOGI(TRANS_CTRL, "channel not found, reqId=%{public}d", requestId);
+        return SOFTBUS_OK;
+    }
+    int32_t channelId = target->channelId;
+    if (target->ref > 1) {
+        target->ref--;
+        SoftBusMutexUnlock(&g_manager.channels->lock);
+        TRANS_LOGI(TRANS_CTRL, "channelId=%{public}d, ref=%{public}d", channelId, target->ref);
+        return SOFTBUS_OK;
+    }
+    // no open callback is reported once the item is gone, a late open closes the channel by itself
+    ListDelete(&target->node);
+    g_manager.channels->cnt -= 1;
+    SoftBusFree(target);
+    SoftBusMutexUnlock(&g_manager.channels->lock);
+    if (channelId == INVALID_CHANNEL_ID) {
+        return SOFTBUS_OK;
+    }
+    TRANS_LOGW(TRANS_CTRL, "cancel reqId=%{public}d, close channelId=%{public}d", requestId, channelId);
+    return TransCloseNetWorkingChannel(channelId);
+}
+
 int32_t TransProxyPipelineCloseChannelDelay(int32_t channelId)
 {
 #define DELAY_CLOSE_CHANNEL_MS 3000
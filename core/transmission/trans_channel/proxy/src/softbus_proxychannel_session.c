@@ -35,6 +35,8 @@
 
 int32_t TransProxyTransDataSendMsg(ProxyChannelInfo *chanInfo, const unsigned char *payLoad,
     int32_t payLoadLen, ProxyPacketType flag);
+static int32_t TransProxySendDataMsg(const ProxyChannelSendInfo *info, const unsigned char *payLoad,
+    int32_t payLoadLen, ProxyPacketType flag);
 
 int32_t NotifyClientMsgReceived(const char *pkgName, int32_t pid, int32_t channelId, TransReceiveData *receiveData)
 {
@@ -100,26 +102,15 @@ static int32_t TransProxyPostPacketData(int32_t channelId, const unsigned char *
         TRANS_LOGE(TRANS_MSG, "invalid param");
         return SOFTBUS_INVALID_PARAM;
     }
-    ProxyChannelInfo *chanInfo = (ProxyChannelInfo *)SoftBusCalloc(sizeof(ProxyChannelInfo));
-    if (chanInfo == NULL) {
-        TRANS_LOGE(TRANS_MSG, "malloc in channelId=%{public}d", channelId);
-        return SOFTBUS_MALLOC_ERR;
-    }
-    if (TransProxyGetSendMsgChanInfo(channelId, chanInfo) != SOFTBUS_OK) {
-        SoftBusFree(chanInfo);
+    ProxyChannelSendInfo sendInfo;
+    if (TransProxyGetSendMsgInfo(channelId, &sendInfo) != SOFTBUS_OK) {
         TRANS_LOGE(TRANS_MSG, "can not find proxy channel channelId=%{public}d", channelId);
         return SOFTBUS_TRANS_PROXY_CHANNEL_NOT_FOUND;
     }
-    (void)memset_s(chanInfo->appInfo.sessionKey, sizeof(chanInfo->appInfo.sessionKey), 0,
-        sizeof(chanInfo->appInfo.sessionKey));
-    (void)memset_s(chanInfo->appInfo.sinkSessionKey, sizeof(chanInfo->appInfo.sinkSessionKey), 0,
-        sizeof(chanInfo->appInfo.sinkSessionKey));
-    int32_t ret = TransProxyTransDataSendMsg(chanInfo, data, len, flags);
+    int32_t ret = TransProxySendDataMsg(&sendInfo, data, len, flags);
     if (ret != SOFTBUS_OK) {
         TRANS_LOGE(TRANS_MSG, "send msg fail, len=%{public}u, flags=%{public}d, ret=%{public}d", len, flags, ret);
     }
-
-    SoftBusFree(chanInfo);
     return ret;
 }
 
@@ -168,7 +159,7 @@ static char *TransProxyPackAppNormalMsg(const ProxyMessageHead *msg, const char
     return buf;
 }
 
-static char *TransProxyPackD2DMsg(const ProxyChannelInfo *info, const char *payLoad, int32_t dataLen, int32_t *outlen)
+static char *TransProxyPackD2DMsg(const ProxyChannelSendInfo *info, const char *payLoad, int32_t dataLen, int32_t *outlen)
 {
     ProxyMessageShortHead msgHead = { 0 };
     msgHead.type = (PROXYCHANNEL_MSG_TYPE_D2D & FOUR_BIT_MASK) | (VERSION << VERSION_SHIFT);
@@ -201,12 +192,11 @@ static char *TransProxyPackD2DMsg(const ProxyChannelInfo *info, const char *payL
 }
 
 static int32_t TransProxyTransNormalMsg(
-    const ProxyChannelInfo *info, const char *payLoad, int32_t payLoadLen, ProxyPacketType flag)
+    const ProxyChannelSendInfo *info, const char *payLoad, int32_t payLoadLen, ProxyPacketType flag)
 {
     char *buf = NULL;
     int32_t bufLen = 0;
-    if (info->appInfo.businessType == BUSINESS_TYPE_D2D_MESSAGE ||
-        info->appInfo.businessType == BUSINESS_TYPE_D2D_VOICE) {
+    if (info->businessType == BUSINESS_TYPE_D2D_MESSAGE || info->businessType == BUSINESS_TYPE_D2D_VOICE) {
         buf = TransProxyPackD2DMsg(info, payLoad, payLoadLen, &bufLen);
         if (buf == NULL) {
             TRANS_LOGE(TRANS_MSG, "proxy pack msg error");
@@ -224,7 +214,7 @@ static int32_t TransProxyTransNormalMsg(
         }
     }
     int32_t ret = TransProxyTransSendMsg(
-        info->connId, (uint8_t *)buf, (uint32_t)bufLen, ProxyTypeToConnPri(flag), info->appInfo.myData.pid);
+        info->connId, (uint8_t *)buf, (uint32_t)bufLen, ProxyTypeToConnPri(flag), info->pid);
     if (ret == SOFTBUS_CONNECTION_ERR_SENDQUEUE_FULL) {
         TRANS_LOGE(TRANS_MSG, "proxy send queue full.");
         return SOFTBUS_CONNECTION_ERR_SENDQUEUE_FULL;
@@ -236,18 +226,14 @@ static int32_t TransProxyTransNormalMsg(
     return SOFTBUS_OK;
 }
 
-int32_t TransProxyTransDataSendMsg(ProxyChannelInfo *info, const unsigned char *payLoad,
+static int32_t TransProxySendDataMsg(const ProxyChannelSendInfo *info, const unsigned char *payLoad,
     int32_t payLoadLen, ProxyPacketType flag)
 {
-    if (info == NULL || payLoad == NULL) {
-        TRANS_LOGE(TRANS_MSG, "param invalid");
-        return SOFTBUS_INVALID_PARAM;
-    }
     if ((info->status != PROXY_CHANNEL_STATUS_COMPLETED && info->status != PROXY_CHANNEL_STATUS_KEEPLIVEING)) {
         TRANS_LOGE(TRANS_MSG, "status is err status=%{public}d", info->status);
         return SOFTBUS_TRANS_PROXY_CHANNLE_STATUS_INVALID;
     }
-    if (info->appInfo.appType == APP_TYPE_INNER) {
+    if (info->appType == APP_TYPE_INNER) {
         TRANS_LOGE(TRANS_MSG, "err app type Inner");
         return SOFTBUS_TRANS_PROXY_ERROR_APP_TYPE;
     }
@@ -255,6 +241,18 @@ int32_t TransProxyTransDataSendMsg(ProxyChannelInfo *info, const unsigned char *
     return TransProxyTransNormalMsg(info, (const char *)payLoad, payLoadLen, flag);
 }
 
+int32_t TransProxyTransDataSendMsg(ProxyChannelInfo *info, const unsigned char *payLoad,
+    int32_t payLoadLen, ProxyPacketType flag)
+{
+    if (info == NULL || payLoad == NULL) {
+        TRANS_LOGE(TRANS_MSG, "param invalid");
+        return SOFTBUS_INVALID_PARAM;
+    }
+    ProxyChannelSendInfo sendInfo;
+    TransProxyFillSendMsgInfo(info, &sendInfo);
+    return TransProxySendDataMsg(&sendInfo, payLoad, payLoadLen, flag);
+}
+
 int32_t TransOnNormalMsgReceived(const char *pkgName, int32_t pid, int32_t channelId, const char *data, uint32_t len)
 {
     if (data == NULL || pkgName == NULL) {
@@ -42,6 +42,7 @@
 #include "trans_channel_manager.h"
 #include "trans_event.h"
 #include "trans_log.h"
+#include "trans_open_trace.h"
 
 #define ID_OFFSET (1)
 
@@ -703,6 +704,7 @@ static void TransOnConnectSucceed(uint32_t requestId, uint32_t connectionId, con
     TRANS_EVENT(EVENT_SCENE_OPEN_CHANNEL, EVENT_STAGE_START_CONNECT, extra);
     TRANS_LOGI(TRANS_CTRL,
         "Connect Success requestId=%{public}u, connId=%{public}u", requestId, connectionId);
+    TransOpenTraceRecordByKey(TRANS_OPEN_TRACE_KEY_REQUEST_ID, requestId, TRANS_OPEN_PHASE_CONN_CONNECTED);
     int32_t ret = TransSetConnStateByReqId(requestId, connectionId, PROXY_CHANNEL_STATUS_PYH_CONNECTED);
     TransProxyChanProcessByReqId((int32_t)requestId, connectionId, ret);
     SoftBusHitraceChainEnd();
@@ -819,6 +821,9 @@ static int32_t TransProxyOpenNewConnChannel(ListenerModule moduleId, const Conne
     TRANS_LOGI(TRANS_CTRL,
         "SoftBusHiTraceChainBegin: set hiTraceId=%{public}" PRIu64, (uint64_t)(channelId + ID_OFFSET));
     uint32_t requestId = ConnGetNewRequestId(MODULE_PROXY_CHANNEL);
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(CHANNEL_TYPE_PROXY, channelId));
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_REQUEST_ID, requestId);
     ProxyChannelInfo channelInfo = {
         .channelId = channelId,
         .reqId = (int32_t)requestId,
@@ -329,7 +329,7 @@ int32_t TransTdcPostBytes(int32_t channelId, TdcPacketHead *packetHead, const ch
         SoftBusFree(buffer);
         return SOFTBUS_ENCRYPT_ERR;
     }
-    SessionConn *conn = (SessionConn *)SoftBusCalloc(sizeof(SessionConn));
+    SessionConn *conn = (SessionConn *)SoftBusCallocByModule(SOFTBUS_MEM_MODULE_TRANS, sizeof(SessionConn));
     if (conn == NULL) {
         TRANS_LOGE(TRANS_BYTES, "malloc conn fail");
         SoftBusFree(buffer);
@@ -793,7 +793,7 @@ static void OpenDataBusRequestOutSessionName(const char *mySessionName, const ch
 
 static SessionConn *GetSessionConnFromDataBusRequest(int32_t channelId, const cJSON *request, uint32_t flags)
 {
-    SessionConn *conn = (SessionConn *)SoftBusCalloc(sizeof(SessionConn));
+    SessionConn *conn = (SessionConn *)SoftBusCallocByModule(SOFTBUS_MEM_MODULE_TRANS, sizeof(SessionConn));
     TRANS_CHECK_AND_RETURN_RET_LOGE(conn != NULL, NULL, TRANS_CTRL, "conn calloc failed");
     if (GetSessionConnById(channelId, conn) != SOFTBUS_OK) {
         SoftBusFree(conn);
@@ -41,6 +41,7 @@
 #include "trans_channel_common.h"
 #include "trans_lane_pending_ctl.h"
 #include "trans_log.h"
+#include "trans_open_trace.h"
 #include "trans_tcp_direct_json.h"
 #include "trans_tcp_direct_listener.h"
 #include "trans_tcp_direct_message.h"
@@ -1500,6 +1501,8 @@ int32_t OpenP2pDirectChannel(const AppInfo *appInfo, const ConnectOption *connIn
         conn->appInfo.keyType = conn->isMeta ? KEY_TYPE_META : KEY_TYPE_NORMAL;
     }
 
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(CHANNEL_TYPE_TCP_DIRECT, conn->channelId));
     ret = TransTdcAddSessionConn(conn);
     if (ret != SOFTBUS_OK) {
         goto EXIT_ERR;
@@ -149,7 +149,7 @@ SessionConn *GetSessionConnByReq(int64_t req)
 
 SessionConn *CreateNewSessinConn(ListenerModule module, bool isServerSid)
 {
-    SessionConn *conn = (SessionConn *)SoftBusCalloc(sizeof(SessionConn));
+    SessionConn *conn = (SessionConn *)SoftBusCallocByModule(SOFTBUS_MEM_MODULE_TRANS, sizeof(SessionConn));
     if (conn == NULL) {
         return NULL;
     }
@@ -25,6 +25,7 @@
 #include "softbus_error_code.h"
 #include "softbus_socket.h"
 #include "trans_log.h"
+#include "trans_open_trace.h"
 #include "trans_tcp_direct_message.h"
 #include "trans_tcp_direct_p2p.h"
 #include "trans_tcp_direct_sessionconn.h"
@@ -155,6 +156,8 @@ int32_t OpenTcpDirectChannel(const AppInfo *appInfo, const ConnectOption *connIn
     }
     newConn->appInfo.fd = fd;
 
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(CHANNEL_TYPE_TCP_DIRECT, newchannelId));
     int32_t ret = AddTcpConnAndSessionInfo(newchannelId, fd, newConn, module);
     if (ret != SOFTBUS_OK) {
         ConnShutdownSocket(fd);
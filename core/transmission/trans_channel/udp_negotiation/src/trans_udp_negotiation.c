@@ -46,6 +46,7 @@
 #include "trans_lane_manager.h"
 #include "trans_lane_pending_ctl.h"
 #include "trans_log.h"
+#include "trans_open_trace.h"
 #include "trans_session_manager.h"
 #include "trans_split_serviceid.h"
 #include "trans_udp_channel_manager.h"
@@ -1349,6 +1350,8 @@ int32_t TransOpenUdpChannel(AppInfo *appInfo, const ConnectOption *connOpt, int3
     }
     newChannel->seq = GenerateSeq(false);
     newChannel->status = UDP_CHANNEL_STATUS_INIT;
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(CHANNEL_TYPE_UDP, id));
     int32_t ret = TransAddUdpChannel(newChannel);
     if (ret != SOFTBUS_OK) {
         // fastTransData is always NULL in the UDP channel, no need to free
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,30 +15,33 @@
 
 #include "anonymizer.h"
 
-#include <locale.h>
 #include <securec.h>
 #include <stdbool.h>
 #include <stdint.h>
-#include <wchar.h>
+#include <stdlib.h>
 
 #include "comm_log.h"
-#include "softbus_error_code.h"
 
 #define COMMON_STRING_MAX_LEN 128
-#define WIDE_CHAR_MAX_LEN 8
+#define ANONYMIZE_FIXED_MAX_LEN 12
 #define HALF_STR_NUM 2
 #define NUM_CIDR_MAX 32
 #define NUM_LEN_CIDR_MAX 2
 
+typedef struct {
+    char *buf;
+    uint32_t bufLen;
+    uint32_t pos;
+} AnonymizeOutput;
+
 typedef struct {
     bool (*Matcher)(const char *, uint32_t);
-    int32_t (*Anonymizer)(const char *, uint32_t, char **);
+    void (*Anonymizer)(const char *, uint32_t, AnonymizeOutput *);
 } AnonymizeHandler;
 
 typedef struct {
     uint32_t plainPrefixPos;
     uint32_t plainSuffixPos;
-    uint32_t len;
 } AnonymizeParam;
 
 static const char SYMBOL_ANONYMIZE = '*';
@@ -212,194 +215,202 @@ static bool MatchCommString(const char *str, uint32_t len)
     return len <= COMMON_STRING_MAX_LEN;
 }
 
-static char *MallocStr(uint32_t len)
+static inline bool IsUtf8Tail(unsigned char chr)
+{
+    return (chr & 0xC0) == 0x80;
+}
+
+/* returns the byte length of the utf-8 char at str, or 0 for an invalid or truncated sequence */
+static uint32_t GetUtf8CharLen(const unsigned char *str, uint32_t remain)
+{
+    static const unsigned char MAX_ASCII = 0x7F;
+    static const unsigned char MIN_LEAD_TWO = 0xC2;
+    static const unsigned char MIN_LEAD_THREE = 0xE0;
+    static const unsigned char MIN_LEAD_FOUR = 0xF0;
+    static const unsigned char MAX_LEAD_FOUR = 0xF4;
+    static const unsigned char LEAD_SURROGATE = 0xED;
+    static const unsigned char MIN_TAIL_NOT_OVERLONG_THREE = 0xA0;
+    static const unsigned char MAX_TAIL_NOT_SURROGATE = 0x9F;
+    static const unsigned char MIN_TAIL_NOT_OVERLONG_FOUR = 0x90;
+    static const unsigned char MAX_TAIL_IN_RANGE_FOUR = 0x8F;
+
+    unsigned char lead = str[0];
+    uint32_t charLen = 0;
+    if (lead <= MAX_ASCII) {
+        return 1;
+    } else if (lead < MIN_LEAD_TWO) {
+        return 0;
+    } else if (lead < MIN_LEAD_THREE) {
+        charLen = 2; // 2: two bytes char
+    } else if (lead < MIN_LEAD_FOUR) {
+        charLen = 3; // 3: three bytes char
+    } else if (lead <= MAX_LEAD_FOUR) {
+        charLen = 4; // 4: four bytes char
+    } else {
+        return 0;
+    }
+    if (charLen > remain) {
+        return 0;
+    }
+    for (uint32_t i = 1; i < charLen; ++i) {
+        if (!IsUtf8Tail(str[i])) {
+            return 0;
+        }
+    }
+    if ((lead == MIN_LEAD_THREE && str[1] < MIN_TAIL_NOT_OVERLONG_THREE) ||
+        (lead == LEAD_SURROGATE && str[1] > MAX_TAIL_NOT_SURROGATE) ||
+        (lead == MIN_LEAD_FOUR && str[1] < MIN_TAIL_NOT_OVERLONG_FOUR) ||
+        (lead == MAX_LEAD_FOUR && str[1] > MAX_TAIL_IN_RANGE_FOUR)) {
+        return 0;
+    }
+    return charLen;
+}
+
+/* returns the number of utf-8 chars in str, or 0 if str is not valid utf-8 */
+static uint32_t GetUtf8StrLen(const char *str, uint32_t len)
 {
-    char *str = (char *)malloc(sizeof(char) * (len + 1));
-    if (str != NULL) {
-        str[len] = '\0';
+    uint32_t charNum = 0;
+    for (uint32_t pos = 0; pos < len; ++charNum) {
+        uint32_t charLen = GetUtf8CharLen((const unsigned char *)str + pos, len - pos);
+        if (charLen == 0) {
+            return 0;
+        }
+        pos += charLen;
     }
-    return str;
+    return charNum;
 }
 
-static int32_t CopyStr(const char *str, char **copy)
+static inline uint32_t GetRemainLen(const AnonymizeOutput *out)
 {
-    uint32_t len = strlen(str);
-    *copy = MallocStr(len);
-    COMM_CHECK_AND_RETURN_RET_LOGE(*copy != NULL, SOFTBUS_MALLOC_ERR, COMM_DFX, "malloc failed");
+    return out->bufLen - 1 - out->pos; // 1: reserved for '\0'
+}
 
-    errno_t ret = memcpy_s(*copy, len, str, len);
-    COMM_CHECK_AND_RETURN_RET_LOGE(ret == EOK, SOFTBUS_STRCPY_ERR, COMM_DFX, "memcpy failed");
+/* the output is cut short when the buffer is full, returns false if bytes are truncated */
+static bool AppendBytes(AnonymizeOutput *out, const char *bytes, uint32_t len)
+{
+    uint32_t copyLen = len < GetRemainLen(out) ? len : GetRemainLen(out);
+    if (copyLen > 0 && memcpy_s(out->buf + out->pos, out->bufLen - out->pos, bytes, copyLen) != EOK) {
+        return false;
+    }
+    out->pos += copyLen;
+    return copyLen == len;
+}
 
-    return SOFTBUS_OK;
+static inline bool AppendSymbol(AnonymizeOutput *out, char symbol, uint32_t num)
+{
+    for (uint32_t i = 0; i < num; ++i) {
+        if (!AppendBytes(out, &symbol, 1)) {
+            return false;
+        }
+    }
+    return true;
 }
 
-static int32_t AnonymizeIpAddr(const char *str, uint32_t len, char **anonymized)
+static inline void CopyStr(const char *str, AnonymizeOutput *out)
 {
-    int32_t ret = CopyStr(str, anonymized);
-    COMM_CHECK_AND_RETURN_RET_LOGE(ret == SOFTBUS_OK, ret, COMM_DFX, "copy ip addr failed");
-    COMM_CHECK_AND_RETURN_RET_LOGE(len != 0, SOFTBUS_INVALID_PARAM, COMM_DFX, "len is invalid");
+    (void)AppendBytes(out, str, strlen(str));
+}
 
+static void AnonymizeIpAddr(const char *str, uint32_t len, AnonymizeOutput *out)
+{
+    uint32_t plainLen = 1;
     for (uint32_t i = len - 1; i > 0; --i) {
-        if (IsDot((*anonymized)[i])) {
+        if (IsDot(str[i])) {
+            plainLen = i + 1;
             break;
         }
-        (*anonymized)[i] = SYMBOL_ANONYMIZE;
     }
-    return SOFTBUS_OK;
+    if (AppendBytes(out, str, plainLen)) {
+        (void)AppendSymbol(out, SYMBOL_ANONYMIZE, len - plainLen);
+    }
 }
 
-static int32_t AnonymizeMacAddr(const char *str, uint32_t len, char **anonymized)
+static void AnonymizeMacAddr(const char *str, uint32_t len, AnonymizeOutput *out)
 {
     static const uint32_t ANONYMIZE_POSITIONS[] = {9, 10, 12, 13};
 
-    int32_t ret = CopyStr(str, anonymized);
-    COMM_CHECK_AND_RETURN_RET_LOGE(ret == SOFTBUS_OK, ret, COMM_DFX, "copy mac addr failed");
-
+    /* mask while appending so that a truncated output never leaks the plain chars */
+    uint32_t plainPos = 0;
     for (uint32_t i = 0; i < sizeof(ANONYMIZE_POSITIONS) / sizeof(ANONYMIZE_POSITIONS[0]); ++i) {
-        (*anonymized)[ANONYMIZE_POSITIONS[i]] = SYMBOL_ANONYMIZE;
+        if (!AppendBytes(out, str + plainPos, ANONYMIZE_POSITIONS[i] - plainPos) ||
+            !AppendSymbol(out, SYMBOL_ANONYMIZE, 1)) {
+            return;
+        }
+        plainPos = ANONYMIZE_POSITIONS[i] + 1;
     }
-    return SOFTBUS_OK;
+    (void)AppendBytes(out, str + plainPos, len - plainPos);
 }
 
-static int32_t AnonymizeUdidStr(const char *str, uint32_t len, char **anonymized)
+static void AnonymizeUdidStr(const char *str, uint32_t len, AnonymizeOutput *out)
 {
-    static const uint32_t ANONYMIZE_UDID_LEN = 12;
-    static const uint32_t ANONYMIZE_POSITIONS[] = {5, 6};
+    static const uint32_t ANONYMIZE_NUM = 2;
     static const uint32_t UNANONYMIZE_UDID_LEN = 5;
-    static const uint32_t UNANONYMIZE_SUFFIX_POS = ANONYMIZE_UDID_LEN - UNANONYMIZE_UDID_LEN;
-    static const uint32_t UNANONYMIZE_SUFFIX_OFFSET = 64 - UNANONYMIZE_UDID_LEN;
-
-    (void)len;
-    *anonymized = MallocStr(ANONYMIZE_UDID_LEN);
-    COMM_CHECK_AND_RETURN_RET_LOGE(*anonymized != NULL, SOFTBUS_MALLOC_ERR, COMM_DFX, "malloc failed");
-
-    errno_t ret = memcpy_s(*anonymized, ANONYMIZE_UDID_LEN, str, UNANONYMIZE_UDID_LEN);
-    COMM_CHECK_AND_RETURN_RET_LOGE(ret == EOK, SOFTBUS_STRCPY_ERR, COMM_DFX, "memcpy failed");
-    ret = memcpy_s(*anonymized + UNANONYMIZE_SUFFIX_POS, ANONYMIZE_UDID_LEN - UNANONYMIZE_SUFFIX_POS,
-        str + UNANONYMIZE_SUFFIX_OFFSET, UNANONYMIZE_UDID_LEN);
-    COMM_CHECK_AND_RETURN_RET_LOGE(ret == EOK, SOFTBUS_STRCPY_ERR, COMM_DFX, "memcpy failed");
-
-    for (uint32_t i = 0; i < sizeof(ANONYMIZE_POSITIONS) / sizeof(ANONYMIZE_POSITIONS[0]); ++i) {
-        (*anonymized)[ANONYMIZE_POSITIONS[i]] = SYMBOL_ANONYMIZE;
-    }
-    return SOFTBUS_OK;
-}
-
-static int32_t SetLocale(char **localeBefore)
-{
-    *localeBefore = setlocale(LC_CTYPE, NULL);
-    if (*localeBefore == NULL) {
-        COMM_LOGW(COMM_DFX, "get locale failed");
-    }
 
-    char *localeAfter = setlocale(LC_CTYPE, "C.UTF-8");
-    return (localeAfter != NULL) ? SOFTBUS_OK : SOFTBUS_LOCALE_ERR;
-}
-
-static void RestoreLocale(const char *localeBefore)
-{
-    if (setlocale(LC_CTYPE, localeBefore) == NULL) {
-        COMM_LOGW(COMM_DFX, "restore locale failed");
+    if (AppendBytes(out, str, UNANONYMIZE_UDID_LEN) && AppendSymbol(out, SYMBOL_ANONYMIZE, ANONYMIZE_NUM)) {
+        (void)AppendBytes(out, str + len - UNANONYMIZE_UDID_LEN, UNANONYMIZE_UDID_LEN);
     }
 }
 
-static int32_t AnonymizeWideStrToByteStr(const wchar_t *wideStr, uint32_t wideStrLen, const AnonymizeParam *param,
-    char **anonymized)
+static void AnonymizeUtf8Str(const char *str, uint32_t len, const AnonymizeParam *param, AnonymizeOutput *out)
 {
-    COMM_CHECK_AND_RETURN_RET_LOGE(wideStrLen != 0, SOFTBUS_INVALID_PARAM, COMM_DFX, "wideStrLen is 0");
-    COMM_CHECK_AND_RETURN_RET_LOGE(param->len != 0, SOFTBUS_INVALID_PARAM, COMM_DFX, "len is 0");
-    uint32_t len = param->len;
-    *anonymized = MallocStr(len);
-    COMM_CHECK_AND_RETURN_RET_LOGE(*anonymized != NULL, SOFTBUS_MALLOC_ERR, COMM_DFX, "malloc failed");
-
-    char multiByteChar[WIDE_CHAR_MAX_LEN] = {0};
-    uint32_t multiByteStrIndex = 0;
-    uint32_t wideStrIndex = 0;
-    errno_t ret = EOK;
-    for (; wideStrIndex < param->plainPrefixPos && multiByteStrIndex < len; ++wideStrIndex) {
-        int32_t multiByteCharLen = wctomb(multiByteChar, wideStr[wideStrIndex]);
-        COMM_CHECK_AND_RETURN_RET_LOGE(multiByteCharLen > 0, SOFTBUS_WIDECHAR_ERR, COMM_DFX, "convert prefix failed");
-        ret = memcpy_s(*anonymized + multiByteStrIndex, len - multiByteStrIndex, multiByteChar, multiByteCharLen);
-        COMM_CHECK_AND_RETURN_RET_LOGE(ret == EOK, SOFTBUS_MEM_ERR, COMM_DFX, "copy prefix failed");
-        multiByteStrIndex += (uint32_t)multiByteCharLen;
-    }
-
-    for (; wideStrIndex < param->plainSuffixPos && multiByteStrIndex < len; ++wideStrIndex) {
-        (*anonymized)[multiByteStrIndex++] = SYMBOL_ANONYMIZE;
-    }
-
-    for (; wideStrIndex < wideStrLen && multiByteStrIndex < len; ++wideStrIndex) {
-        int32_t multiByteCharLen = wctomb(multiByteChar, wideStr[wideStrIndex]);
-        COMM_CHECK_AND_RETURN_RET_LOGE(multiByteCharLen > 0, SOFTBUS_WIDECHAR_ERR, COMM_DFX, "convert suffix failed");
-        ret = memcpy_s(*anonymized + multiByteStrIndex, len - multiByteStrIndex, multiByteChar, multiByteCharLen);
-        COMM_CHECK_AND_RETURN_RET_LOGE(ret == EOK, SOFTBUS_MEM_ERR, COMM_DFX, "copy prefix failed");
-        multiByteStrIndex += (uint32_t)multiByteCharLen;
+    uint32_t pos = 0;
+    for (uint32_t charIndex = 0; pos < len; ++charIndex) {
+        uint32_t charLen = GetUtf8CharLen((const unsigned char *)str + pos, len - pos);
+        if (charLen == 0) {
+            return;
+        }
+        bool isAnonymized = charIndex >= param->plainPrefixPos && charIndex < param->plainSuffixPos;
+        uint32_t appendLen = isAnonymized ? 1 : charLen;
+        if (appendLen > GetRemainLen(out)) {
+            return;
+        }
+        (void)(isAnonymized ? AppendSymbol(out, SYMBOL_ANONYMIZE, 1) : AppendBytes(out, str + pos, charLen));
+        pos += charLen;
     }
-
-    uint32_t endPos = multiByteStrIndex < len ? multiByteStrIndex : len;
-    (*anonymized)[endPos] = '\0';
-    return SOFTBUS_OK;
 }
 
-static int32_t AnonymizeCommString(const char *str, uint32_t len, char **anonymized)
+static void AnonymizeCommString(const char *str, uint32_t len, AnonymizeOutput *out)
 {
     static const uint32_t ANONYMIZE_LEN_RATIO = 2; // anonymize half str
     static const uint32_t ANONYMIZE_POS_RATIO = 4; // start from 1/4 pos
 
-    char *localeBefore = NULL;
-    int32_t ret = SetLocale(&localeBefore);
-    COMM_CHECK_AND_RETURN_RET_LOGE(ret == SOFTBUS_OK, ret, COMM_DFX, "get locale failed");
-
-    wchar_t wideStr[COMMON_STRING_MAX_LEN] = {0};
-    uint32_t wideStrLen = (uint32_t)mbstowcs(wideStr, str, len);
-    if (wideStrLen == 0 || wideStrLen > len) {
-        COMM_LOGW(COMM_DFX, "convert wide str failed");
-        RestoreLocale(localeBefore);
-        return CopyStr(str, anonymized);
+    uint32_t charNum = GetUtf8StrLen(str, len);
+    if (charNum == 0) {
+        COMM_LOGW(COMM_DFX, "invalid utf-8 str");
+        CopyStr(str, out);
+        return;
     }
-    uint32_t anonymizedNum = (wideStrLen + ANONYMIZE_LEN_RATIO - 1) / ANONYMIZE_LEN_RATIO; // +ratio-1 for round up
-    uint32_t plainPrefixPos = wideStrLen / ANONYMIZE_POS_RATIO;
+    uint32_t anonymizedNum = (charNum + ANONYMIZE_LEN_RATIO - 1) / ANONYMIZE_LEN_RATIO; // +ratio-1 for round up
+    uint32_t plainPrefixPos = charNum / ANONYMIZE_POS_RATIO;
     AnonymizeParam param = {
         .plainPrefixPos = plainPrefixPos,
         .plainSuffixPos = plainPrefixPos + anonymizedNum,
-        .len = len,
     };
-
-    ret = AnonymizeWideStrToByteStr(wideStr, wideStrLen, &param, anonymized);
-    RestoreLocale(localeBefore);
-    COMM_CHECK_AND_RETURN_RET_LOGE(ret == SOFTBUS_OK, ret, COMM_DFX, "anonymize multi byte str failed");
-    return ret;
+    AnonymizeUtf8Str(str, len, &param, out);
 }
 
-static int32_t AnonymizeHalfStr(const char *str, uint32_t len, char **anonymized)
+static void AnonymizeHalfStr(const char *str, uint32_t len, AnonymizeOutput *out)
 {
     uint32_t plainTextLen = len / HALF_STR_NUM;
     uint32_t plainTextOffset = len - plainTextLen;
-    uint32_t anonymizeLen = 1 + plainTextLen;
-
-    *anonymized = MallocStr(anonymizeLen);
-    COMM_CHECK_AND_RETURN_RET_LOGE(*anonymized != NULL, SOFTBUS_MALLOC_ERR, COMM_DFX, "malloc failed");
 
-    if (plainTextLen > 0) {
-        errno_t ret = memcpy_s(*anonymized + 1, plainTextLen, str + plainTextOffset, plainTextLen);
-        COMM_CHECK_AND_RETURN_RET_LOGE(ret == EOK, SOFTBUS_STRCPY_ERR, COMM_DFX, "memcpy failed");
+    if (AppendSymbol(out, SYMBOL_ANONYMIZE, 1)) {
+        (void)AppendBytes(out, str + plainTextOffset, plainTextLen);
     }
-
-    (*anonymized)[0] = SYMBOL_ANONYMIZE;
-    return SOFTBUS_OK;
 }
 
-static int32_t AnonymizeEmpty(const char *str, uint32_t len, char **anonymized)
+static void AnonymizeEmpty(const char *str, uint32_t len, AnonymizeOutput *out)
 {
     (void)str;
     (void)len;
-    return CopyStr("EMPTY", anonymized);
+    CopyStr("EMPTY", out);
 }
 
-static int32_t AnonymizeInner(const char *str, char **anonymized)
+static void AnonymizeInner(const char *str, AnonymizeOutput *out)
 {
     if (str == NULL) {
-        return CopyStr("NULL", anonymized);
+        CopyStr("NULL", out);
+        return;
     }
 
     static const AnonymizeHandler ANONYMIZE_HANDLER[] = {
@@ -413,70 +424,89 @@ static int32_t AnonymizeInner(const char *str, char **anonymized)
     uint32_t len = strlen(str);
     for (uint32_t i = 0; i < sizeof(ANONYMIZE_HANDLER) / sizeof(AnonymizeHandler); ++i) {
         if (ANONYMIZE_HANDLER[i].Matcher(str, len)) {
-            return ANONYMIZE_HANDLER[i].Anonymizer(str, len, anonymized);
+            ANONYMIZE_HANDLER[i].Anonymizer(str, len, out);
+            return;
         }
     }
-    return AnonymizeHalfStr(str, len, anonymized);
+    AnonymizeHalfStr(str, len, out);
 }
 
-static int32_t AnonymizeDeviceNameInner(const char *str, char **anonymized)
+static void AnonymizeDeviceNameInner(const char *str, AnonymizeOutput *out)
 {
     static const uint32_t DEVICE_NAME_PREFIX = 1;
     static const uint32_t DEVICE_NAME_SUFFIX = 3;
     static const uint32_t DEVICE_NAME_RATIO_ANONYMIZE_LEN = 8;
 
     if (str == NULL) {
-        return CopyStr("NULL", anonymized);
+        CopyStr("NULL", out);
+        return;
     }
     uint32_t len = strlen(str);
     if (len == 0) {
-        return CopyStr("EMPTY", anonymized);
+        CopyStr("EMPTY", out);
+        return;
     }
     if (len >= COMMON_STRING_MAX_LEN) {
         COMM_LOGW(COMM_DFX, "invalid str len=%{public}u", len);
-        return CopyStr("INVALID", anonymized);
+        CopyStr("INVALID", out);
+        return;
     }
-
-    char *localeBefore = NULL;
-    int32_t ret = SetLocale(&localeBefore);
-    COMM_CHECK_AND_RETURN_RET_LOGE(ret == SOFTBUS_OK, ret, COMM_DFX, "get locale failed");
-
-    wchar_t wideStr[COMMON_STRING_MAX_LEN] = {0};
-    uint32_t wideStrLen = (uint32_t)mbstowcs(wideStr, str, len);
-    if (wideStrLen == 0 || wideStrLen > len) {
-        COMM_LOGW(COMM_DFX, "convert wide str failed");
+    uint32_t charNum = GetUtf8StrLen(str, len);
+    if (charNum == 0) {
+        COMM_LOGW(COMM_DFX, "invalid utf-8 str");
         /* string is garbled when the memory is abnormal*/
-        RestoreLocale(localeBefore);
-        return CopyStr(str, anonymized);
+        CopyStr(str, out);
+        return;
     }
-    if (wideStrLen < DEVICE_NAME_RATIO_ANONYMIZE_LEN) {
-        RestoreLocale(localeBefore);
-        return AnonymizeCommString(str, len, anonymized);
+    if (charNum < DEVICE_NAME_RATIO_ANONYMIZE_LEN) {
+        AnonymizeCommString(str, len, out);
+        return;
     }
-    uint32_t anonymizedNum = wideStrLen - DEVICE_NAME_PREFIX - DEVICE_NAME_SUFFIX;
     AnonymizeParam param = {
         .plainPrefixPos = DEVICE_NAME_PREFIX,
-        .plainSuffixPos = DEVICE_NAME_PREFIX + anonymizedNum,
-        .len = len,
+        .plainSuffixPos = charNum - DEVICE_NAME_SUFFIX,
     };
+    AnonymizeUtf8Str(str, len, &param, out);
+}
 
-    ret = AnonymizeWideStrToByteStr(wideStr, wideStrLen, &param, anonymized);
-    RestoreLocale(localeBefore);
-    COMM_CHECK_AND_RETURN_RET_LOGE(ret == SOFTBUS_OK, ret, COMM_DFX, "anonymize multi byte str failed");
-    return ret;
+typedef void (*AnonymizeInnerFunc)(const char *, AnonymizeOutput *);
+
+static const char *AnonymizeToBufInner(AnonymizeInnerFunc func, const char *plainStr, char *buf, uint32_t bufLen)
+{
+    if (buf == NULL || bufLen == 0) {
+        COMM_LOGE(COMM_DFX, "invalid buf");
+        return "NULL";
+    }
+    AnonymizeOutput out = { .buf = buf, .bufLen = bufLen, .pos = 0 };
+    func(plainStr, &out);
+    buf[out.pos] = '\0';
+    return buf;
+}
+
+static void AnonymizeToHeap(AnonymizeInnerFunc func, const char *plainStr, char **anonymizedStr)
+{
+    /* the anonymized str is never longer than the plain str or the fixed placeholders */
+    uint32_t len = (plainStr == NULL) ? 0 : strlen(plainStr);
+    uint32_t bufLen = (len > ANONYMIZE_FIXED_MAX_LEN ? len : ANONYMIZE_FIXED_MAX_LEN) + 1;
+    *anonymizedStr = (char *)malloc(bufLen);
+    COMM_CHECK_AND_RETURN_LOGE(*anonymizedStr != NULL, COMM_DFX, "malloc failed");
+    (void)AnonymizeToBufInner(func, plainStr, *anonymizedStr, bufLen);
+}
+
+const char *AnonymizeToBuf(const char *plainStr, char *buf, uint32_t bufLen)
+{
+    return AnonymizeToBufInner(AnonymizeInner, plainStr, buf, bufLen);
+}
+
+const char *AnonymizeDeviceNameToBuf(const char *plainStr, char *buf, uint32_t bufLen)
+{
+    return AnonymizeToBufInner(AnonymizeDeviceNameInner, plainStr, buf, bufLen);
 }
 
 void Anonymize(const char *plainStr, char **anonymizedStr)
 {
     COMM_CHECK_AND_RETURN_LOGE(anonymizedStr != NULL, COMM_DFX, "anonymizedStr is null");
-
-    if (AnonymizeInner(plainStr, anonymizedStr) == SOFTBUS_OK) {
-        return;
-    }
-    if (*anonymizedStr != NULL) {
-        AnonymizeFree(*anonymizedStr);
-        *anonymizedStr = NULL;
-    }
+    AnonymizeToHeap(AnonymizeInner, plainStr, anonymizedStr);
 }
 
 void AnonymizeFree(char *anonymizedStr)
@@ -495,12 +525,5 @@ const char *AnonymizeWrapper(const char *anonymizedStr)
 void AnonymizeDeviceName(const char *plainStr, char **anonymizedStr)
 {
     COMM_CHECK_AND_RETURN_LOGE(anonymizedStr != NULL, COMM_DFX, "anonymizedStr is null");
-
-    if (AnonymizeDeviceNameInner(plainStr, anonymizedStr) == SOFTBUS_OK) {
-        return;
-    }
-    if (*anonymizedStr != NULL) {
-        AnonymizeFree(*anonymizedStr);
-        *anonymizedStr = NULL;
-    }
+    AnonymizeToHeap(AnonymizeDeviceNameInner, plainStr, anonymizedStr);
 }
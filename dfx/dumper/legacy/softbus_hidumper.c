@@ -14,6 +14,7 @@
  */
 #include "legacy/softbus_hidumper.h"
 
+#include <inttypes.h>
 #include <stdio.h>
 #include <string.h>
 #include <securec.h>
@@ -30,8 +31,21 @@
 #include "legacy/softbus_hidumper_nstack.h"
 #include "legacy/softbus_hidumper_trans.h"
 
+#define SOFTBUS_MEM_MODULE_NAME "mem"
+#define SOFTBUS_MEM_MODULE_HELP "List the memory in use of each module"
+
 static LIST_HEAD(g_hidumperhander_list);
 
+static const char *g_memModuleName[SOFTBUS_MEM_MODULE_BUTT] = {
+    [SOFTBUS_MEM_MODULE_COMMON] = "common",
+    [SOFTBUS_MEM_MODULE_AUTH] = "auth",
+    [SOFTBUS_MEM_MODULE_LNN] = "lnn",
+    [SOFTBUS_MEM_MODULE_CONN] = "conn",
+    [SOFTBUS_MEM_MODULE_DISC] = "disc",
+    [SOFTBUS_MEM_MODULE_TRANS] = "trans",
+    [SOFTBUS_MEM_MODULE_SDK] = "sdk",
+};
+
 void SoftBusDumpShowHelp(int fd)
 {
     if (fd < 0) {
@@ -237,6 +251,26 @@ int32_t SoftBusDumpDispatch(int fd, int32_t argc, const char **argv)
     return SOFTBUS_OK;
 }
 
+static int32_t SoftBusMemDumpHander(int fd, int32_t argc, const char **argv)
+{
+    (void)argc;
+    (void)argv;
+    if (fd < 0) {
+        return SOFTBUS_INVALID_PARAM;
+    }
+    SoftBusMemStat stat;
+    for (int32_t module = SOFTBUS_MEM_MODULE_COMMON; module < SOFTBUS_MEM_MODULE_BUTT; module++) {
+        if (SoftBusGetMemStat((SoftBusMemModule)module, &stat) != SOFTBUS_OK) {
+            SOFTBUS_DPRINTF(fd, "memory accounting is not enabled\n");
+            return SOFTBUS_OK;
+        }
+        SOFTBUS_DPRINTF(fd, "%-8s usedBytes=%" PRIu64 " usedCount=%" PRIu64 " peakBytes=%" PRIu64
+            " totalCount=%" PRIu64 "\n", g_memModuleName[module], stat.usedBytes, stat.usedCount, stat.peakBytes,
+            stat.totalCount);
+    }
+    return SOFTBUS_OK;
+}
+
 int32_t SoftBusHiDumperModuleInit(void)
 {
     if (SoftBusBcMgrHiDumperInit() != SOFTBUS_OK) {
@@ -273,6 +307,12 @@ int32_t SoftBusHiDumperModuleInit(void)
         COMM_LOGE(COMM_INIT, "init Trans HiDumper fail!");
         return SOFTBUS_ERR;
     }
+
+    if (SoftBusRegHiDumperHandler(SOFTBUS_MEM_MODULE_NAME, SOFTBUS_MEM_MODULE_HELP, &SoftBusMemDumpHander) !=
+        SOFTBUS_OK) {
+        COMM_LOGE(COMM_INIT, "init Mem HiDumper fail!");
+        return SOFTBUS_ERR;
+    }
     return SOFTBUS_OK;
 }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -12,6 +12,8 @@
  * See the License for the specific language governing permissions and
  * limitations under the License.
  */
+#include <stdatomic.h>
+
 #include "comm_log.h"
 #include "securec.h"
 #include "softbus_error_code.h"
@@ -72,8 +74,13 @@
 #define TIME_COST_4S (4000)
 #define TIME_COST_7S (7000)
 #define TIME_COST_11S (11000)
-#define API_TYPE_DEFAULT (1)
-#define API_CALLED_DEFAULT (1)
+#define MAX_PKG_NAME_CNT 200
+#define CALLER_SLOT_NUM 256
+#define CALLER_SLOT_MASK (CALLER_SLOT_NUM - 1)
+#define FNV_OFFSET_BASIS 2166136261U
+#define FNV_PRIME 16777619U
+#define RECORDER_EPOCH_NUM 2
+#define RECORDER_WAIT_MS 1
 
 static char g_softbusVersion[SOFTBUS_HISYSEVT_PARAM_LEN] = "softbusVersion1";
 static char g_pkgVersion[SOFTBUS_HISYSEVT_PARAM_LEN] = "packageVersion1";
@@ -163,26 +170,30 @@ typedef struct {
     char callerPackageName[SOFTBUS_HISYSEVT_PARAM_LEN];
 } OpenSessionKpiStruct;
 
-typedef struct {
-    ListNode node;
-    char appName[SOFTBUS_HISYSEVT_PARAM_LEN];
-    char softbusVersion[SOFTBUS_HISYSEVT_PARAM_LEN];
-    char packageVersion[SOFTBUS_HISYSEVT_PARAM_LEN];
-    int32_t cnt; //Api count
-    ListNode apiCntList;
-} CalledApiInfoStruct;
+#define CALLED_API_NUM (sizeof(g_apiNameIdMapTbl) / sizeof(ApiNameIdMap))
 
+/* interned caller, freed only after the recorders that may still hold it have left, see DetachCallers */
 typedef struct {
-    ListNode node;
-    char apiName[SOFTBUS_HISYSEVT_PARAM_LEN];
-    int32_t calledtotalCnt;
-} CalledApiCntStruct;
+    uint32_t hash;
+    char appName[SOFTBUS_HISYSEVT_PARAM_LEN];
+    _Atomic uint32_t calledCnt[CALLED_API_NUM];
+} CalledApiCallerInfo;
 
 static OpenSessionCntStruct g_openSessionCnt;
 static OpenSessionTimeStruct g_openSessionTime;
 static OpenSessionKpiStruct g_openSessionKpi;
-static SoftBusList *g_calledApiInfoList = NULL;
-static SoftBusList *g_calledApiCntlist = NULL;
+/* ipc code -> index of g_apiNameIdMapTbl plus one, zero means the code is not counted */
+static uint8_t g_apiIndexTbl[SOFTBUS_FUNC_ID_BUIT];
+static _Atomic uint32_t g_calledApiCnt[CALLED_API_NUM];
+static CalledApiCallerInfo *_Atomic g_callerTbl[CALLER_SLOT_NUM];
+static uint32_t g_callerNum = 0;
+static _Atomic uint32_t g_droppedCallerCnt = 0;
+static SoftBusMutex g_callerLock;
+static bool g_callerLockInit = false;
+static _Atomic bool g_calledApiInit = false;
+/* recorders count themselves in the current epoch, a reporter flips it and waits for the old one to drain */
+static _Atomic uint32_t g_recorderEpoch = 0;
+static _Atomic uint32_t g_recorderCnt[RECORDER_EPOCH_NUM];
 
 #define TIME_THOUSANDS_FACTOR (1000)
 
@@ -196,208 +207,165 @@ int64_t GetSoftbusRecordTimeMillis(void)
     return when;
 }
 
-static void ReleaseCalledApiInfoList(void)
+static void InitCalledApiIndexTbl(void)
 {
-    if (g_calledApiInfoList == NULL) {
-        COMM_LOGE(COMM_EVENT, "list NULL");
-        return;
-    }
-    if (SoftBusMutexLock(&g_calledApiInfoList->lock) != SOFTBUS_OK) {
-        COMM_LOGE(COMM_EVENT, "ReleaseCalledApiInfoList lock failed");
-        return;
-    }
-    CalledApiInfoStruct *item = NULL;
-    CalledApiInfoStruct *nextItem = NULL;
-    LIST_FOR_EACH_ENTRY_SAFE(item, nextItem, &g_calledApiInfoList->list, CalledApiInfoStruct, node) {
-        ListDelete(&item->node);
-        SoftBusFree(item);
-        g_calledApiInfoList->cnt--;
+    for (uint32_t i = 0; i < CALLED_API_NUM; i++) {
+        g_apiIndexTbl[g_apiNameIdMapTbl[i].code] = (uint8_t)(i + 1);
     }
-    ListInit(&g_calledApiInfoList->list);
-    (void)SoftBusMutexUnlock(&g_calledApiInfoList->lock);
 }
 
-static void ReleaseCalledApiCntList(void)
+static inline int32_t GetApiIndexByCode(uint32_t code)
 {
-    if (g_calledApiCntlist == NULL) {
-        COMM_LOGE(COMM_EVENT, "list NULL");
-        return;
-    }
-    if (SoftBusMutexLock(&g_calledApiCntlist->lock) != SOFTBUS_OK) {
-        COMM_LOGE(COMM_EVENT, "ReleaseCalledApiCntList lock failed");
-        return;
+    if (code >= SOFTBUS_FUNC_ID_BUIT || g_apiIndexTbl[code] == 0) {
+        return -1;
     }
-    CalledApiCntStruct *item = NULL;
-    CalledApiCntStruct *nextItem = NULL;
-    LIST_FOR_EACH_ENTRY_SAFE(item, nextItem, &g_calledApiCntlist->list, CalledApiCntStruct, node) {
-        ListDelete(&item->node);
-        SoftBusFree(item);
-        g_calledApiCntlist->cnt--;
-    }
-    ListInit(&g_calledApiCntlist->list);
-    (void)SoftBusMutexUnlock(&g_calledApiCntlist->lock);
+    return (int32_t)g_apiIndexTbl[code] - 1;
 }
 
-static CalledApiCntStruct *GetNewApiCnt(char *apiName)
+static uint32_t GetAppNameHash(const char *appName)
 {
-    CalledApiCntStruct *apiCnt = (CalledApiCntStruct *)SoftBusMalloc(sizeof(CalledApiCntStruct));
-    if (apiCnt == NULL) {
-        COMM_LOGE(COMM_EVENT, "GetNewApiCnt malloc failed");
-        return NULL;
+    uint32_t hash = FNV_OFFSET_BASIS;
+    for (const unsigned char *c = (const unsigned char *)appName; *c != '\0'; c++) {
+        hash = (hash ^ *c) * FNV_PRIME;
     }
-    if (strcpy_s(apiCnt->apiName, SOFTBUS_HISYSEVT_PARAM_LEN, apiName) != EOK) {
-        COMM_LOGE(COMM_EVENT, "GetNewApiCnt strcpy failed");
-        SoftBusFree(apiCnt);
-        return NULL;
+    return hash;
+}
+
+static CalledApiCallerInfo *FindCaller(const char *appName, uint32_t hash, uint32_t *emptySlot)
+{
+    for (uint32_t i = 0; i < CALLER_SLOT_NUM; i++) {
+        uint32_t slot = (hash + i) & CALLER_SLOT_MASK;
+        CalledApiCallerInfo *caller = atomic_load_explicit(&g_callerTbl[slot], memory_order_acquire);
+        if (caller == NULL) {
+            *emptySlot = slot;
+            return NULL;
+        }
+        if (caller->hash == hash && strcmp(caller->appName, appName) == 0) {
+            return caller;
+        }
     }
-    ListInit(&apiCnt->node);
-    apiCnt->calledtotalCnt = API_CALLED_DEFAULT;
-    return apiCnt;
+    *emptySlot = CALLER_SLOT_NUM;
+    return NULL;
 }
 
-static CalledApiInfoStruct *GetNewApiInfo(const char *appName, char *apiName)
+static CalledApiCallerInfo *InternCaller(const char *appName, uint32_t hash)
 {
-    CalledApiInfoStruct *apiInfo = (CalledApiInfoStruct *)SoftBusMalloc(sizeof(CalledApiInfoStruct));
-    if (apiInfo == NULL) {
-        COMM_LOGE(COMM_EVENT, "GetNewApiInfo malloc failed");
+    if (SoftBusMutexLock(&g_callerLock) != SOFTBUS_OK) {
+        COMM_LOGE(COMM_EVENT, "InternCaller lock fail");
         return NULL;
     }
-    if (strcpy_s(apiInfo->appName, SOFTBUS_HISYSEVT_PARAM_LEN, appName) != EOK ||
-        strcpy_s(apiInfo->softbusVersion, SOFTBUS_HISYSEVT_PARAM_LEN, g_softbusVersion) != EOK ||
-        strcpy_s(apiInfo->packageVersion, SOFTBUS_HISYSEVT_PARAM_LEN, g_pkgVersion) != EOK) {
-        COMM_LOGE(COMM_EVENT, "GetNewApiInfo strcpy failed");
-        SoftBusFree(apiInfo);
+    uint32_t emptySlot = CALLER_SLOT_NUM;
+    CalledApiCallerInfo *caller = FindCaller(appName, hash, &emptySlot);
+    if (caller != NULL || emptySlot == CALLER_SLOT_NUM || g_callerNum >= MAX_PKG_NAME_CNT) {
+        (void)SoftBusMutexUnlock(&g_callerLock);
+        return caller;
+    }
+    caller = (CalledApiCallerInfo *)SoftBusCalloc(sizeof(CalledApiCallerInfo));
+    if (caller == NULL) {
+        (void)SoftBusMutexUnlock(&g_callerLock);
+        COMM_LOGE(COMM_EVENT, "InternCaller calloc fail");
         return NULL;
     }
-    ListInit(&apiInfo->node);
-    ListInit(&apiInfo->apiCntList);
-    CalledApiCntStruct *apiCnt = GetNewApiCnt(apiName);
-    if (apiCnt == NULL) {
-        COMM_LOGE(COMM_EVENT, "GetNewApiCnt return NULL");
-        SoftBusFree(apiInfo);
+    if (strcpy_s(caller->appName, SOFTBUS_HISYSEVT_PARAM_LEN, appName) != EOK) {
+        (void)SoftBusMutexUnlock(&g_callerLock);
+        COMM_LOGE(COMM_EVENT, "InternCaller strcpy fail");
+        SoftBusFree(caller);
         return NULL;
     }
-    ListAdd(&apiInfo->apiCntList, &apiCnt->node);
-    apiInfo->cnt = API_TYPE_DEFAULT;
-    return apiInfo;
+    caller->hash = hash;
+    atomic_store_explicit(&g_callerTbl[emptySlot], caller, memory_order_release);
+    g_callerNum++;
+    (void)SoftBusMutexUnlock(&g_callerLock);
+    return caller;
 }
 
-static char *GetApiNameByCode(uint32_t code)
+/* empty the caller table and return the callers once no recorder can still hold one of them */
+static uint32_t DetachCallers(CalledApiCallerInfo **callers)
 {
-    for (uint32_t i = 0; i < sizeof(g_apiNameIdMapTbl) / sizeof(ApiNameIdMap); i++) {
-        if (g_apiNameIdMapTbl[i].code == code) {
-            return g_apiNameIdMapTbl[i].apiName;
+    if (SoftBusMutexLock(&g_callerLock) != SOFTBUS_OK) {
+        COMM_LOGE(COMM_EVENT, "DetachCallers lock fail");
+        return 0;
+    }
+    uint32_t num = 0;
+    for (uint32_t slot = 0; slot < CALLER_SLOT_NUM; slot++) {
+        CalledApiCallerInfo *caller = atomic_exchange(&g_callerTbl[slot], NULL);
+        if (caller != NULL) {
+            callers[num++] = caller;
         }
     }
-    return NULL;
+    g_callerNum = 0;
+    uint32_t oldEpoch = atomic_fetch_xor(&g_recorderEpoch, 1) & 1;
+    (void)SoftBusMutexUnlock(&g_callerLock);
+    while (atomic_load(&g_recorderCnt[oldEpoch]) != 0) {
+        (void)SoftBusSleepMs(RECORDER_WAIT_MS);
+    }
+    return num;
 }
 
-static void AddInfoNodeToList(bool isAppDiff, const char *appName, char *apiName)
+/* count the recorder in an epoch that was still current after counting, so a reporter that flips it waits */
+static uint32_t EnterRecorderEpoch(void)
 {
-#define MAX_PKG_NAME_CNT 200
-    CalledApiInfoStruct *apiInfoNode = NULL;
-    if (isAppDiff) {
-        if (g_calledApiInfoList->cnt > MAX_PKG_NAME_CNT) {
-            COMM_LOGE(COMM_EVENT, "the number %{public}u of callers exceeds the limit", g_calledApiInfoList->cnt);
-            return;
-        }
-        apiInfoNode = GetNewApiInfo(appName, apiName);
-        if (apiInfoNode == NULL) {
-            COMM_LOGE(COMM_EVENT, "GetNewApiInfo fail");
-            return;
+    while (true) {
+        uint32_t epoch = atomic_load(&g_recorderEpoch) & 1;
+        atomic_fetch_add(&g_recorderCnt[epoch], 1);
+        if ((atomic_load(&g_recorderEpoch) & 1) == epoch) {
+            return epoch;
         }
-        ListAdd(&g_calledApiInfoList->list, &apiInfoNode->node);
-        g_calledApiInfoList->cnt++;
-        COMM_LOGD(COMM_EVENT, "GetNewApiInfo success");
+        atomic_fetch_sub(&g_recorderCnt[epoch], 1);
     }
 }
 
-void SoftbusRecordCalledApiInfo(const char *appName, uint32_t code)
+static void FreeCallers(CalledApiCallerInfo **callers, uint32_t num)
 {
-    COMM_CHECK_AND_RETURN_LOGE(appName != NULL, COMM_EVENT, "app name is null");
-    COMM_CHECK_AND_RETURN_LOGE(g_calledApiInfoList != NULL, COMM_EVENT, "g_calledApiInfoList is null");
-    COMM_CHECK_AND_RETURN_LOGE(SoftBusMutexLock(&g_calledApiInfoList->lock) == SOFTBUS_OK,
-        COMM_EVENT, "SoftbusRecordCalledApiInfo lock fail");
-    char *apiName = GetApiNameByCode(code);
-    if (apiName == NULL) {
-        (void)SoftBusMutexUnlock(&g_calledApiInfoList->lock);
-        COMM_LOGE(COMM_EVENT, "GetApiNameByCode fail");
-        return;
+    for (uint32_t i = 0; i < num; i++) {
+        SoftBusFree(callers[i]);
     }
+}
 
-    CalledApiInfoStruct *apiInfoNode = NULL;
-    CalledApiCntStruct *apiCntNode = NULL;
-    bool isAppDiff = true;
-    bool isApiDiff = true;
-    LIST_FOR_EACH_ENTRY(apiInfoNode, &g_calledApiInfoList->list, CalledApiInfoStruct, node) {
-        if (strcmp(apiInfoNode->appName, appName) == 0) {
-            isAppDiff = false;
-            LIST_FOR_EACH_ENTRY(apiCntNode, &apiInfoNode->apiCntList, CalledApiCntStruct, node) {
-                if (strcmp(apiCntNode->apiName, apiName) == 0) {
-                    isApiDiff = false;
-                    apiCntNode->calledtotalCnt++;
-                    COMM_LOGD(COMM_EVENT, "cmpare apiName success");
-                    break;
-                }
-            }
-        }
-    }
-    AddInfoNodeToList(isAppDiff, appName, apiName);
-    if ((isAppDiff == false) && (isApiDiff == true)) {
-        apiInfoNode = NULL;
-        LIST_FOR_EACH_ENTRY(apiInfoNode, &g_calledApiInfoList->list, CalledApiInfoStruct, node) {
-            if (strcmp(apiInfoNode->appName, appName) == 0) {
-                apiCntNode = GetNewApiCnt(apiName);
-                if (apiCntNode == NULL) {
-                    COMM_LOGE(COMM_EVENT, "GetNewApiCnt fail");
-                    (void)SoftBusMutexUnlock(&g_calledApiInfoList->lock);
-                    return;
-                }
-                ListAdd(&apiInfoNode->apiCntList, &apiCntNode->node);
-                apiInfoNode->cnt++;
-                COMM_LOGD(COMM_EVENT, "GetNewApiCnt success");
+static void RecordCallerApiInfo(const char *appName, int32_t index)
+{
+    uint32_t hash = GetAppNameHash(appName);
+    uint32_t emptySlot = CALLER_SLOT_NUM;
+    CalledApiCallerInfo *caller = FindCaller(appName, hash, &emptySlot);
+    if (caller == NULL) {
+        caller = InternCaller(appName, hash);
+        if (caller == NULL) {
+            if (atomic_fetch_add_explicit(&g_droppedCallerCnt, 1, memory_order_relaxed) == 0) {
+                COMM_LOGE(COMM_EVENT, "caller table is full, new callers are not counted, limit=%{public}d",
+                    MAX_PKG_NAME_CNT);
             }
+            return;
         }
     }
-    (void)SoftBusMutexUnlock(&g_calledApiInfoList->lock);
+    atomic_fetch_add_explicit(&caller->calledCnt[index], 1, memory_order_relaxed);
 }
 
-void SoftbusRecordCalledApiCnt(uint32_t code)
+void SoftbusRecordCalledApiInfo(const char *appName, uint32_t code)
 {
-    if (g_calledApiCntlist == NULL) {
-        COMM_LOGE(COMM_EVENT, "g_calledApiCntlist is null");
+    COMM_CHECK_AND_RETURN_LOGE(appName != NULL, COMM_EVENT, "app name is null");
+    COMM_CHECK_AND_RETURN_LOGE(atomic_load_explicit(&g_calledApiInit, memory_order_acquire),
+        COMM_EVENT, "called api statistic not init");
+    int32_t index = GetApiIndexByCode(code);
+    if (index < 0) {
+        COMM_LOGE(COMM_EVENT, "GetApiIndexByCode fail");
         return;
     }
-    if (SoftBusMutexLock(&g_calledApiCntlist->lock) != SOFTBUS_OK) {
-        COMM_LOGE(COMM_EVENT, "SoftbusRecordCalledApiCnt lock fail");
+    uint32_t epoch = EnterRecorderEpoch();
+    RecordCallerApiInfo(appName, index);
+    atomic_fetch_sub(&g_recorderCnt[epoch], 1);
+}
+
+void SoftbusRecordCalledApiCnt(uint32_t code)
+{
+    if (!atomic_load_explicit(&g_calledApiInit, memory_order_acquire)) {
+        COMM_LOGE(COMM_EVENT, "called api statistic not init");
         return;
     }
-    char *apiName = GetApiNameByCode(code);
-    if (apiName == NULL) {
-        (void)SoftBusMutexUnlock(&g_calledApiCntlist->lock);
+    int32_t index = GetApiIndexByCode(code);
+    if (index < 0) {
         return;
     }
-
-    CalledApiCntStruct *apiCntNode = NULL;
-    bool isDiff = true;
-    LIST_FOR_EACH_ENTRY(apiCntNode, &g_calledApiCntlist->list, CalledApiCntStruct, node) {
-        if (strcmp(apiCntNode->apiName, apiName) == 0) {
-            isDiff = false;
-            apiCntNode->calledtotalCnt++;
-            break;
-        }
-    }
-    if (isDiff == true) {
-        apiCntNode = GetNewApiCnt(apiName);
-        if (apiCntNode == NULL) {
-            COMM_LOGE(COMM_EVENT, "GetNewApiCnt fail");
-            (void)SoftBusMutexUnlock(&g_calledApiCntlist->lock);
-            return;
-        }
-        ListAdd(&g_calledApiCntlist->list, &apiCntNode->node);
-        g_calledApiCntlist->cnt++;
-    }
-    (void)SoftBusMutexUnlock(&g_calledApiCntlist->lock);
+    atomic_fetch_add_explicit(&g_calledApiCnt[index], 1, memory_order_relaxed);
 }
 
 void SoftbusRecordOpenSessionKpi(const char *pkgName, int32_t linkType, SoftBusOpenSessionStatus isSucc, int64_t time)
@@ -508,8 +476,8 @@ static inline int32_t InitOpenSessionEvtMutexLock(void)
     return SOFTBUS_OK;
 }
 
-static void CreateCalledApiInfoMsg(SoftBusEvtReportMsg* msg, CalledApiCntStruct *apiCntItem,
-    char *appName, char *softbusVersion, char *packageVersion)
+static void CreateCalledApiInfoMsg(SoftBusEvtReportMsg* msg, const char *appName, const char *apiName,
+    uint32_t calledCnt)
 {
     // event
     (void)strcpy_s(msg->evtName, SOFTBUS_HISYSEVT_NAME_LEN, STATISTIC_EVT_CALLED_API_INFO);
@@ -524,25 +492,25 @@ static void CreateCalledApiInfoMsg(SoftBusEvtReportMsg* msg, CalledApiCntStruct
     param = &msg->paramArray[SOFTBUS_EVT_PARAM_ONE];
     (void)strcpy_s(param->paramName, SOFTBUS_HISYSEVT_NAME_LEN, TRANS_PARAM_SOFTBUS_VERSION);
     param->paramType = SOFTBUS_EVT_PARAMTYPE_STRING;
-    (void)strcpy_s(param->paramValue.str, SOFTBUS_HISYSEVT_PARAM_LEN, softbusVersion);
+    (void)strcpy_s(param->paramValue.str, SOFTBUS_HISYSEVT_PARAM_LEN, g_softbusVersion);
     // param 2
     param = &msg->paramArray[SOFTBUS_EVT_PARAM_TWO];
     (void)strcpy_s(param->paramName, SOFTBUS_HISYSEVT_NAME_LEN, TRANS_PARAM_PACKAGE_VERSION);
     param->paramType = SOFTBUS_EVT_PARAMTYPE_STRING;
-    (void)strcpy_s(param->paramValue.str, SOFTBUS_HISYSEVT_PARAM_LEN, packageVersion);
+    (void)strcpy_s(param->paramValue.str, SOFTBUS_HISYSEVT_PARAM_LEN, g_pkgVersion);
     // param 3
     param = &msg->paramArray[SOFTBUS_EVT_PARAM_THREE];
     (void)strcpy_s(param->paramName, SOFTBUS_HISYSEVT_NAME_LEN, TRANS_PARAM_API_NAME);
     param->paramType = SOFTBUS_EVT_PARAMTYPE_STRING;
-    (void)strcpy_s(param->paramValue.str, SOFTBUS_HISYSEVT_PARAM_LEN, apiCntItem->apiName);
+    (void)strcpy_s(param->paramValue.str, SOFTBUS_HISYSEVT_PARAM_LEN, apiName);
     // param 4
     param = &msg->paramArray[SOFTBUS_EVT_PARAM_FOUR];
     (void)strcpy_s(param->paramName, SOFTBUS_HISYSEVT_NAME_LEN, TRANS_PARAM_TOTAL_CNT);
     param->paramType = SOFTBUS_EVT_PARAMTYPE_INT32;
-    param->paramValue.i32v = apiCntItem->calledtotalCnt;
+    param->paramValue.i32v = (int32_t)calledCnt;
 }
 
-static void CreateCalledApiCntMsg(SoftBusEvtReportMsg* msg, CalledApiCntStruct *apiCntItem)
+static void CreateCalledApiCntMsg(SoftBusEvtReportMsg* msg, const char *apiName, uint32_t calledCnt)
 {
     // event
     (void)strcpy_s(msg->evtName, SOFTBUS_HISYSEVT_NAME_LEN, STATISTIC_EVT_CALLED_API_CNT);
@@ -552,12 +520,12 @@ static void CreateCalledApiCntMsg(SoftBusEvtReportMsg* msg, CalledApiCntStruct *
     SoftBusEvtParam* param = &msg->paramArray[SOFTBUS_EVT_PARAM_ZERO];
     (void)strcpy_s(param->paramName, SOFTBUS_HISYSEVT_NAME_LEN, TRANS_PARAM_API_NAME);
     param->paramType = SOFTBUS_EVT_PARAMTYPE_STRING;
-    (void)strcpy_s(param->paramValue.str, SOFTBUS_HISYSEVT_PARAM_LEN, apiCntItem->apiName);
+    (void)strcpy_s(param->paramValue.str, SOFTBUS_HISYSEVT_PARAM_LEN, apiName);
     // param 1
     param = &msg->paramArray[SOFTBUS_EVT_PARAM_ONE];
     (void)strcpy_s(param->paramName, SOFTBUS_HISYSEVT_NAME_LEN, TRANS_PARAM_TOTAL_CNT);
     param->paramType = SOFTBUS_EVT_PARAMTYPE_INT32;
-    param->paramValue.i32v = apiCntItem->calledtotalCnt;
+    param->paramValue.i32v = (int32_t)calledCnt;
 }
 
 static void CreateOpenSessionKpiMsg(SoftBusEvtReportMsg* msg)
@@ -673,81 +641,73 @@ static void CreateOpenSessionCntMsg(SoftBusEvtReportMsg* msg)
     (void)SoftBusMutexUnlock(&g_openSessionCnt.lock);
 }
 
+static int32_t ReportCallerApiInfo(SoftBusEvtReportMsg* msg, CalledApiCallerInfo *caller)
+{
+    for (uint32_t i = 0; i < CALLED_API_NUM; i++) {
+        uint32_t calledCnt = atomic_exchange_explicit(&caller->calledCnt[i], 0, memory_order_relaxed);
+        if (calledCnt == 0) {
+            continue;
+        }
+        CreateCalledApiInfoMsg(msg, caller->appName, g_apiNameIdMapTbl[i].apiName, calledCnt);
+        int32_t ret = SoftbusWriteHisEvt(msg);
+        if (ret != SOFTBUS_OK) {
+            return ret;
+        }
+    }
+    return SOFTBUS_OK;
+}
+
 static int32_t SoftbusReportCalledAPIEvt(void)
 {
+    if (!atomic_load_explicit(&g_calledApiInit, memory_order_acquire)) {
+        COMM_LOGE(COMM_EVENT, "called api statistic not init");
+        return SOFTBUS_NO_INIT;
+    }
     SoftBusEvtReportMsg* msg = SoftbusCreateEvtReportMsg(SOFTBUS_EVT_PARAM_FIVE);
     if (msg == NULL) {
         COMM_LOGE(COMM_EVENT, "Alloc EvtReport Msg Fail!");
         return SOFTBUS_MALLOC_ERR;
     }
-    if (g_calledApiInfoList == NULL) {
-        COMM_LOGE(COMM_EVENT, "g_calledApiInfoList is null");
-        SoftbusFreeEvtReportMsg(msg);
-        return SOFTBUS_NO_INIT;
-    }
-    if (SoftBusMutexLock(&g_calledApiInfoList->lock) != SOFTBUS_OK) {
-        COMM_LOGE(COMM_EVENT, "SoftbusReportCalledAPIEvt lock fail");
-        SoftbusFreeEvtReportMsg(msg);
-        return SOFTBUS_LOCK_ERR;
-    }
-    char appName[SOFTBUS_HISYSEVT_PARAM_LEN];
-    char softbusVersion[SOFTBUS_HISYSEVT_PARAM_LEN];
-    char packageVersion[SOFTBUS_HISYSEVT_PARAM_LEN];
-    CalledApiInfoStruct *apiInfoItem = NULL;
-    CalledApiCntStruct *apiCntItem = NULL;
+    // callers are released on every report, so the caller limit applies per report period
+    CalledApiCallerInfo *callers[CALLER_SLOT_NUM] = { NULL };
+    uint32_t num = DetachCallers(callers);
     int32_t ret = SOFTBUS_OK;
-    LIST_FOR_EACH_ENTRY(apiInfoItem, &g_calledApiInfoList->list, CalledApiInfoStruct, node) {
-        (void)strcpy_s(appName, SOFTBUS_HISYSEVT_NAME_LEN, apiInfoItem->appName);
-        (void)strcpy_s(softbusVersion, SOFTBUS_HISYSEVT_NAME_LEN, apiInfoItem->softbusVersion);
-        (void)strcpy_s(packageVersion, SOFTBUS_HISYSEVT_NAME_LEN, apiInfoItem->packageVersion);
-        LIST_FOR_EACH_ENTRY(apiCntItem, &apiInfoItem->apiCntList, CalledApiCntStruct, node) {
-            CreateCalledApiInfoMsg(msg, apiCntItem, appName, softbusVersion, packageVersion);
-            ret = SoftbusWriteHisEvt(msg);
-            if (ret != SOFTBUS_OK) {
-                SoftbusFreeEvtReportMsg(msg);
-                (void)SoftBusMutexUnlock(&g_calledApiInfoList->lock);
-                ReleaseCalledApiInfoList();
-                return ret;
-            }
-        }
+    for (uint32_t i = 0; i < num && ret == SOFTBUS_OK; i++) {
+        ret = ReportCallerApiInfo(msg, callers[i]);
     }
+    FreeCallers(callers, num);
     SoftbusFreeEvtReportMsg(msg);
-    (void)SoftBusMutexUnlock(&g_calledApiInfoList->lock);
-    ReleaseCalledApiInfoList();
-    return SOFTBUS_OK;
+    uint32_t droppedCnt = atomic_exchange_explicit(&g_droppedCallerCnt, 0, memory_order_relaxed);
+    if (droppedCnt != 0) {
+        COMM_LOGW(COMM_EVENT, "calls not counted for the caller table is full, droppedCnt=%{public}u", droppedCnt);
+    }
+    return ret;
 }
 
 static int32_t SoftbusReportCalledAPICntEvt(void)
 {
+    if (!atomic_load_explicit(&g_calledApiInit, memory_order_acquire)) {
+        COMM_LOGE(COMM_EVENT, "called api statistic not init");
+        return SOFTBUS_NO_INIT;
+    }
     SoftBusEvtReportMsg* msg = SoftbusCreateEvtReportMsg(SOFTBUS_EVT_PARAM_TWO);
     if (msg == NULL) {
         COMM_LOGE(COMM_EVENT, "Alloc EvtReport Msg Fail!");
         return SOFTBUS_MALLOC_ERR;
     }
-    if (g_calledApiCntlist == NULL) {
-        COMM_LOGE(COMM_EVENT, "g_calledApiCntlist is null");
-        SoftbusFreeEvtReportMsg(msg);
-        return SOFTBUS_NO_INIT;
-    }
-    if (SoftBusMutexLock(&g_calledApiCntlist->lock) != SOFTBUS_OK) {
-        SoftbusFreeEvtReportMsg(msg);
-        return SOFTBUS_LOCK_ERR;
-    }
-    CalledApiCntStruct *apiCntItem = NULL;
-    int32_t ret = SOFTBUS_OK;
-    LIST_FOR_EACH_ENTRY(apiCntItem, &g_calledApiCntlist->list, CalledApiCntStruct, node) {
-        CreateCalledApiCntMsg(msg, apiCntItem);
-        ret = SoftbusWriteHisEvt(msg);
+    for (uint32_t i = 0; i < CALLED_API_NUM; i++) {
+        uint32_t calledCnt = atomic_exchange_explicit(&g_calledApiCnt[i], 0, memory_order_relaxed);
+        if (calledCnt == 0) {
+            continue;
+        }
+        CreateCalledApiCntMsg(msg, g_apiNameIdMapTbl[i].apiName, calledCnt);
+        int32_t ret = SoftbusWriteHisEvt(msg);
         if (ret != SOFTBUS_OK) {
             SoftbusFreeEvtReportMsg(msg);
-            (void)SoftBusMutexUnlock(&g_calledApiCntlist->lock);
-            ReleaseCalledApiCntList();
             return ret;
         }
     }
     SoftbusFreeEvtReportMsg(msg);
-    (void)SoftBusMutexUnlock(&g_calledApiCntlist->lock);
-    ReleaseCalledApiCntList();
     return SOFTBUS_OK;
 }
 
@@ -931,15 +891,15 @@ int32_t InitTransStatisticSysEvt(void)
         return SOFTBUS_DFX_INIT_FAILED;
     }
 
-    g_calledApiInfoList = CreateSoftBusList();
-    if (g_calledApiInfoList == NULL) {
-        COMM_LOGE(COMM_EVENT, "Create g_calledApiInfoList failed.");
-        return SOFTBUS_CREATE_LIST_ERR;
-    }
-    g_calledApiCntlist = CreateSoftBusList();
-    if (g_calledApiCntlist == NULL) {
-        COMM_LOGE(COMM_EVENT, "Create g_calledApiCntlist failed.");
-        return SOFTBUS_CREATE_LIST_ERR;
+    if (!atomic_load_explicit(&g_calledApiInit, memory_order_acquire)) {
+        if (!g_callerLockInit && SoftBusMutexInit(&g_callerLock, NULL) != SOFTBUS_OK) {
+            COMM_LOGE(COMM_EVENT, "Called Api Evt Lock Init Fail!");
+            DeinitOpenSessionEvtMutexLock();
+            return SOFTBUS_DFX_INIT_FAILED;
+        }
+        g_callerLockInit = true;
+        InitCalledApiIndexTbl();
+        atomic_store_explicit(&g_calledApiInit, true, memory_order_release);
     }
     ClearOpenSessionCnt();
     ClearOpenSessionKpi();
@@ -955,12 +915,15 @@ int32_t InitTransStatisticSysEvt(void)
 
 void DeinitTransStatisticSysEvt(void)
 {
-    if (g_calledApiInfoList == NULL || g_calledApiCntlist == NULL) {
-        COMM_LOGE(COMM_EVENT, "g_calledApiInfoList or g_calledApiCntlist is NULL");
+    if (!atomic_load_explicit(&g_calledApiInit, memory_order_acquire)) {
+        COMM_LOGE(COMM_EVENT, "called api statistic not init");
         return;
     }
-    DestroySoftBusList(g_calledApiInfoList);
-    DestroySoftBusList(g_calledApiCntlist);
-    g_calledApiInfoList = NULL;
-    g_calledApiCntlist = NULL;
+    atomic_store_explicit(&g_calledApiInit, false, memory_order_release);
+    CalledApiCallerInfo *callers[CALLER_SLOT_NUM] = { NULL };
+    FreeCallers(callers, DetachCallers(callers));
+    for (uint32_t i = 0; i < CALLED_API_NUM; i++) {
+        atomic_store_explicit(&g_calledApiCnt[i], 0, memory_order_relaxed);
+    }
+    atomic_store_explicit(&g_droppedCallerCnt, 0, memory_order_relaxed);
 }
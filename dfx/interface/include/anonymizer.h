@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -16,9 +16,22 @@
 #ifndef SOFTBUS_DFX_ANONYMIZE_H
 #define SOFTBUS_DFX_ANONYMIZE_H
 
+#include <stdint.h>
+
 #ifdef __cplusplus
 extern "C" {
 #endif
+
+/* the anonymized string is never longer than the plain string, longer results are cut at a char boundary */
+#define ANONYMIZE_BUF_LEN 129
+
+/* declare a stack buffer for {@link ANONYMIZE} and {@link ANONYMIZE_DEVICE_NAME} */
+#define ANONYMIZE_BUF(name) char name[ANONYMIZE_BUF_LEN]
+
+/* anonymize into a char array, evaluates to the array so it can be passed straight to a log format */
+#define ANONYMIZE(buf, plainStr) AnonymizeToBuf((plainStr), (buf), (uint32_t)sizeof(buf))
+#define ANONYMIZE_DEVICE_NAME(buf, plainStr) AnonymizeDeviceNameToBuf((plainStr), (buf), (uint32_t)sizeof(buf))
+
 /**
  * Anonymize the sensitive plain text.
  *
@@ -37,6 +50,26 @@ void Anonymize(const char *plainStr, char **anonymizedStr);
  */
 void AnonymizeDeviceName(const char *plainStr, char **anonymizedStr);
 
+/**
+ * Anonymize the sensitive plain text into the caller buffer, no memory is allocated.
+ *
+ * @param plainStr The plain string to be anonymized.
+ * @param buf The buffer to store the anonymized string.
+ * @param bufLen The length of buf, the result is truncated to bufLen - 1 bytes.
+ * @return buf, or "NULL" if buf is invalid. Never returns null.
+ */
+const char *AnonymizeToBuf(const char *plainStr, char *buf, uint32_t bufLen);
+
+/**
+ * Anonymize the sensitive plain deviceName into the caller buffer, no memory is allocated.
+ *
+ * @param plainStr The plain string to be anonymized.
+ * @param buf The buffer to store the anonymized string.
+ * @param bufLen The length of buf, the result is truncated to bufLen - 1 bytes.
+ * @return buf, or "NULL" if buf is invalid. Never returns null.
+ */
+const char *AnonymizeDeviceNameToBuf(const char *plainStr, char *buf, uint32_t bufLen);
+
 /**
  * Release the anonymized string.
  *
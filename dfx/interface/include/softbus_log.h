@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -79,14 +79,17 @@ extern "C" {
     (void)HiLogPrint(LOG_CORE, level, label.domain, label.tag, FORMAT(fmt), __FUNCTION__, ##__VA_ARGS__)
 #endif
 #else
+/* the arguments, e.g. ANONYMIZE(...), are only evaluated when the level is loggable */
 #ifdef BUILD_VARIANT_ENG
-#define SOFTBUS_LOG_INNER(level, label, fmt, ...) \
-    (void)HILOG_IMPL(                             \
-        LOG_CORE, level, label.domain, label.tag, FORMAT(fmt), FILE_NAME, __LINE__, __FUNCTION__, ##__VA_ARGS__)
+#define SOFTBUS_LOG_INNER(level, label, fmt, ...)                                                            \
+    (HiLogIsLoggable(label.domain, label.tag, level) ?                                                      \
+        (void)HILOG_IMPL(LOG_CORE, level, label.domain, label.tag, FORMAT(fmt), FILE_NAME, __LINE__,        \
+            __FUNCTION__, ##__VA_ARGS__) : (void)0)
 #else
-#define SOFTBUS_LOG_INNER(level, label, fmt, ...) \
-    (void)HILOG_IMPL(                             \
-        LOG_CORE, level, label.domain, label.tag, FORMAT(fmt), __FUNCTION__, ##__VA_ARGS__)
+#define SOFTBUS_LOG_INNER(level, label, fmt, ...)                                                            \
+    (HiLogIsLoggable(label.domain, label.tag, level) ?                                                      \
+        (void)HILOG_IMPL(LOG_CORE, level, label.domain, label.tag, FORMAT(fmt), __FUNCTION__, ##__VA_ARGS__) : \
+        (void)0)
 #endif
 #endif
 
@@ -98,6 +98,8 @@ typedef struct {
     SoftBusVersion version;
     AuthVersion authVersion;
     bool isSupportCompress;
+    bool isSupportCompressDict;
+    bool isSupportDeviceInfoTlv;
     bool isSupportFastAuth;
     bool isNeedFastAuth;
     bool isSupportDmDeviceKey;
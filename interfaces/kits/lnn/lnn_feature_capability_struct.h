@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -52,6 +52,7 @@ typedef enum {
     BIT_SUPPORT_BR_FAST_VIRTUAL_SWITCH_REAL_LINK = 29, // support double enable virtual link through br channel
     BIT_SUPPORT_AGENT_COMMUNICATION = 30,
     BIT_SUPPORT_PUSH = 31,
+    BIT_SUPPORT_SYNC_INFO_BATCH = 32, // support several sync info types packed in one message
     BIT_FEATURE_COUNT,
 } FeatureCapability;
 
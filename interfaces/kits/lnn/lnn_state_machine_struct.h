@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -32,6 +32,11 @@ extern "C" {
 #define FSM_CTRL_MSG_STOP 2
 #define FSM_CTRL_MSG_DEINIT 3
 
+/* parameters up to this length are carried inline in the message */
+#define FSM_MSG_INLINE_PARA_LEN 96
+/* only data message types below this value can be declared coalescable */
+#define FSM_MSG_COALESCE_TYPE_MAX 32
+
 struct tagFsmStateMachine;
 
 typedef void (*StateEnterFunc)(struct tagFsmStateMachine *fsm);
@@ -56,11 +61,13 @@ typedef struct tagFsmStateMachine {
     SoftBusHandler handler;
 
     FsmDeinitCallback deinitCallback;
+    uint32_t coalesceMask;
 } FsmStateMachine;
 
 typedef struct {
     FsmStateMachine *fsm;
     void *obj;
+    bool isParaOwned; /* obj is a copy held by the message, it is released with the message */
 } FsmCtrlMsgObj;
 
 #ifdef __cplusplus
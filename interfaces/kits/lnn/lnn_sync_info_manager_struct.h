@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -47,6 +47,7 @@ typedef enum {
     LNN_INFO_TYPE_USERID,
     LNN_INFO_TYPE_SYNC_BROADCASTLINKKEY,
     LNN_INFO_TYPE_SLE_MAC,
+    LNN_INFO_TYPE_BATCH,
     LNN_INFO_TYPE_COUNT,
     //LNN_INFO_TYPE_P2P_ROLE = 256,
 } LnnSyncInfoType;
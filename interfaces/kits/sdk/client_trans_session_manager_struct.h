@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -63,7 +63,7 @@ typedef struct {
     bool condIsWaiting;
     int32_t bindErrCode;
     uint32_t maxWaitTime; // 0 means no check time out, for Bind end
-    uint32_t waitTime;
+    uint32_t waitStartTick;
 } SocketLifecycleData;
 
 typedef enum {
@@ -93,8 +93,16 @@ typedef enum {
     LINK_DOWN_MAX_NUM_TYPE,
 } LinkDownType;
 
+struct ClientSessionServer;
+
 typedef struct {
     ListNode node;
+    /* sessionId index, protected by session server list lock */
+    ListNode idNode;
+    struct ClientSessionServer *server;
+    /* bind wait and idle timer wheel, protected by session server list lock */
+    ListNode timerNode;
+    uint32_t timerTick;
     int32_t sessionId;
     int32_t channelId;
     ChannelType channelType;
@@ -107,7 +115,7 @@ typedef struct {
     bool isPagingRoot;
     SessionRole role;
     uint32_t maxIdleTime;
-    uint32_t timeout;
+    uint32_t idleStartTick;
     SessionEnableStatus enableStatus;
     int32_t peerUid;
     int32_t peerPid;
@@ -154,7 +162,7 @@ typedef struct {
     ISocketListener socketServer;
 } SessionListenerAdapter;
 
-typedef struct {
+typedef struct ClientSessionServer {
     ListNode node;
     SoftBusSecType type;
     char sessionName[SESSION_NAME_SIZE_MAX];
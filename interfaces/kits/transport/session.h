@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -515,6 +515,9 @@ int RemoveSessionServer(const char *pkgName, const char *sessionName);
  * The session is opened to trigger the first packet interaction process.
  * {@link OnSessionOpened} is invoked to return whether the session is successfully opened.
  * Data can be transmitted only after the session is successfully opened.
+ * When the build enables <b>dsoftbus_feature_trans_async_open_session</b>, which standard systems do by
+ * default, the call also returns before the link is set up, and a failure to set up the link is reported by
+ * {@link OnSessionOpened} only.
  *
  * @param mySessionName Indicates the pointer to the local session name.
  * @param peerSessionName Indicates the pointer to the remote session name.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -183,10 +183,32 @@ typedef struct {
     uint32_t authReqId;
     int32_t seq;
     ListNode node;
+    ListNode idHashNode; /* channelId index of the proxy channel list */
+    ListNode pairHashNode; /* (myId, peerId) index of the proxy channel list */
     AuthHandle authHandle; /* for cipher */
     AppInfo appInfo;
 } ProxyChannelInfo;
 
+/* the fields of a proxy channel needed to send one data message */
+typedef struct {
+    int8_t status;
+    int16_t myId;
+    int16_t peerId;
+    uint32_t connId;
+    int32_t pid;
+    AppType appType;
+    BusinessType businessType;
+} ProxyChannelSendInfo;
+
+/* the fields of a proxy channel needed to deliver one received data message */
+typedef struct {
+    int32_t channelId;
+    int32_t pid;
+    AppType appType;
+    char pkgName[PKG_NAME_SIZE_MAX];
+    char sessionName[SESSION_NAME_SIZE_MAX];
+} ProxyChannelRecvInfo;
+
 typedef struct  {
     int32_t magicNumber;
     int32_t seq;
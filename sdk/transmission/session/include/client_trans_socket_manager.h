@@ -102,6 +102,25 @@ void PrivilegeDestroyAllClientSession(
 
 int32_t ClientRegisterRelationChecker(IFeatureAbilityRelationChecker *relationChecker);
 
+/* sessionId and channel index of the sessions in session server list, need get list lock before call */
+void ClientIndexSession(ClientSessionServer *server, SessionInfo *session);
+
+void ClientUnindexSession(SessionInfo *session);
+
+SessionInfo *ClientFindSessionById(int32_t sessionId, ClientSessionServer **server);
+
+SessionInfo *ClientFindSessionByChannel(const ListNode *serverList, int32_t channelId, int32_t channelType,
+    bool withReserve, ClientSessionServer **server);
+
+/* bind wait and idle timeout wheel of the indexed sessions, need get list lock before call */
+void ClientArmSessionTimer(SessionInfo *session);
+
+void ClientRestartWaitTimer(SessionInfo *session);
+
+void ClientRestartIdleTimer(SessionInfo *session);
+
+void ClientProcessSessionTimer(int32_t waitOutSocket[], uint32_t capacity, uint32_t *num, ListNode *destroyList);
+
 int32_t ClientTransCheckCollabRelation(
     const CollabInfo *sourceInfo, const CollabInfo *sinkInfo, int32_t channelId, int32_t channelType);
 
@@ -625,10 +625,17 @@ int32_t TransOnSessionOpenFailed(int32_t channelId, int32_t channelType, int32_t
     if (channelType == CHANNEL_TYPE_UNDEFINED) {
         sessionId = channelId;
         (void)ClientSetEnableStatusBySocket(sessionId, ENABLE_STATUS_FAILED);
-        // only client async bind failed call
+        // only client async bind and OpenSession failed call
         bool tmpIsServer = false;
         ClientGetSessionCallbackAdapterById(sessionId, &sessionCallback, &tmpIsServer);
-        (void)TransOnBindFailed(sessionId, &sessionCallback.socketClient, errCode);
+        if (sessionCallback.isSocketListener) {
+            (void)TransOnBindFailed(sessionId, &sessionCallback.socketClient, errCode);
+            return SOFTBUS_OK;
+        }
+        if (sessionCallback.session.OnSessionOpened != NULL) {
+            (void)sessionCallback.session.OnSessionOpened(sessionId, errCode);
+        }
+        (void)ClientDeleteSession(sessionId);
         return SOFTBUS_OK;
     }
     TRANS_LOGI(TRANS_SDK, "trigger session open failed callback, channelId=%{public}d, channelType=%{public}d",
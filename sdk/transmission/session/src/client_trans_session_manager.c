@@ -85,19 +85,11 @@ int32_t CheckPermissionState(int32_t sessionId)
         return ret;
     }
     ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if (sessionNode->sessionId == sessionId) {
-                bool permissionState = serverNode->permissionState;
-                UnlockClientSessionServerList();
-                return permissionState ? SOFTBUS_OK : SOFTBUS_PERMISSION_DENIED;
-            }
-        }
+    SessionInfo *sessionNode = ClientFindSessionById(sessionId, &serverNode);
+    if (sessionNode != NULL) {
+        bool permissionState = serverNode->permissionState;
+        UnlockClientSessionServerList();
+        return permissionState ? SOFTBUS_OK : SOFTBUS_PERMISSION_DENIED;
     }
     UnlockClientSessionServerList();
     return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
@@ -162,21 +154,7 @@ int32_t TransClientInit(void)
 
 static bool SessionIdIsAvailable(int32_t sessionId)
 {
-    ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if (sessionNode->sessionId == sessionId) {
-                return false;
-            }
-        }
-    }
-
-    return true;
+    return ClientFindSessionById(sessionId, NULL) == NULL;
 }
 
 static void ShowAllSessionInfo(void)
@@ -494,21 +472,13 @@ static int32_t GetSessionById(int32_t sessionId, ClientSessionServer **server, S
 {
     /* need get lock before */
     ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if (sessionNode->sessionId == sessionId) {
-                *server = serverNode;
-                *session = sessionNode;
-                return SOFTBUS_OK;
-            }
-        }
+    SessionInfo *sessionNode = ClientFindSessionById(sessionId, &serverNode);
+    if (sessionNode == NULL) {
+        return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
     }
-    return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
+    *server = serverNode;
+    *session = sessionNode;
+    return SOFTBUS_OK;
 }
 
 bool IsContainServiceBySocket(int32_t socket)
@@ -540,23 +510,14 @@ static int32_t GetSessionByChannelId(int32_t channelId, int32_t channelType, Cli
 {
     /* need get lock before */
     ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if ((sessionNode->channelId == channelId && (int32_t)sessionNode->channelType == channelType) ||
-                (sessionNode->channelIdReserve == channelId &&
-                (int32_t)sessionNode->channelTypeReserve == channelType)) {
-                *server = serverNode;
-                *session = sessionNode;
-                return SOFTBUS_OK;
-            }
-        }
+    SessionInfo *sessionNode = ClientFindSessionByChannel(
+        &(g_clientSessionServerList->list), channelId, channelType, true, &serverNode);
+    if (sessionNode == NULL) {
+        return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
     }
-    return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
+    *server = serverNode;
+    *session = sessionNode;
+    return SOFTBUS_OK;
 }
 
 static int32_t AddSession(const char *sessionName, SessionInfo *session)
@@ -577,6 +538,7 @@ static int32_t AddSession(const char *sessionName, SessionInfo *session)
             continue;
         }
         ListAdd(&serverNode->sessionList, &session->node);
+        ClientIndexSession(serverNode, session);
         char *anonyDeviceId = NULL;
         Anonymize(session->info.peerDeviceId, &anonyDeviceId);
         TRANS_LOGI(TRANS_SDK,
@@ -732,6 +694,7 @@ int32_t ClientDeleteSession(int32_t sessionId)
                 continue;
             }
             ListDelete(&(sessionNode->node));
+            ClientUnindexSession(sessionNode);
             TRANS_LOGI(TRANS_SDK, "delete session by sessionId=%{public}d success", sessionId);
             DestroySessionId();
             if (!sessionNode->lifecycle.condIsWaiting) {
@@ -949,7 +912,13 @@ int32_t ClientSetEnableStatusBySocket(int32_t socket, SessionEnableStatus enable
         return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
     }
 
+    bool enabling = (enableStatus == ENABLE_STATUS_SUCCESS && sessionNode->enableStatus != ENABLE_STATUS_SUCCESS);
     sessionNode->enableStatus = enableStatus;
+    if (enabling) {
+        ClientRestartIdleTimer(sessionNode);
+    } else {
+        ClientArmSessionTimer(sessionNode);
+    }
     UnlockClientSessionServerList();
     return SOFTBUS_OK;
 }
@@ -1141,20 +1110,12 @@ int32_t GetEncryptByChannelId(int32_t channelId, int32_t channelType, int32_t *d
     }
 
     ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-
-        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if (sessionNode->channelId == channelId && (int32_t)sessionNode->channelType == channelType) {
-                *data = (int32_t)sessionNode->isEncrypt;
-                UnlockClientSessionServerList();
-                return SOFTBUS_OK;
-            }
-        }
+    SessionInfo *sessionNode = ClientFindSessionByChannel(
+        &(g_clientSessionServerList->list), channelId, channelType, false, &serverNode);
+    if (sessionNode != NULL) {
+        *data = (int32_t)sessionNode->isEncrypt;
+        UnlockClientSessionServerList();
+        return SOFTBUS_OK;
     }
 
     UnlockClientSessionServerList();
@@ -1176,20 +1137,12 @@ int32_t ClientGetSessionStateByChannelId(int32_t channelId, int32_t channelType,
     }
 
     ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-
-        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if (sessionNode->channelId == channelId && sessionNode->channelType == (ChannelType)channelType) {
-                *sessionState = sessionNode->lifecycle.sessionState;
-                UnlockClientSessionServerList();
-                return SOFTBUS_OK;
-            }
-        }
+    SessionInfo *sessionNode = ClientFindSessionByChannel(
+        &(g_clientSessionServerList->list), channelId, channelType, false, &serverNode);
+    if (sessionNode != NULL) {
+        *sessionState = sessionNode->lifecycle.sessionState;
+        UnlockClientSessionServerList();
+        return SOFTBUS_OK;
     }
 
     UnlockClientSessionServerList();
@@ -1212,6 +1165,18 @@ int32_t ClientGetSessionIdByChannelId(int32_t channelId, int32_t channelType, in
 
     ClientSessionServer *serverNode = NULL;
     SessionInfo *sessionNode = NULL;
+    if (!isClosing) {
+        sessionNode = ClientFindSessionByChannel(
+            &(g_clientSessionServerList->list), channelId, channelType, true, NULL);
+        if (sessionNode != NULL) {
+            *sessionId = sessionNode->sessionId;
+            UnlockClientSessionServerList();
+            return SOFTBUS_OK;
+        }
+        UnlockClientSessionServerList();
+        TRANS_LOGE(TRANS_SDK, "not found session by channelId=%{public}d", channelId);
+        return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
+    }
 
     LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
         if (IsListEmpty(&serverNode->sessionList)) {
@@ -1219,7 +1184,7 @@ int32_t ClientGetSessionIdByChannelId(int32_t channelId, int32_t channelType, in
         }
 
         LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            bool flag = (isClosing ? sessionNode->isClosing : true);
+            bool flag = sessionNode->isClosing;
             if (sessionNode->channelId == channelId && sessionNode->channelType == (ChannelType)channelType && flag) {
                 *sessionId = sessionNode->sessionId;
                 UnlockClientSessionServerList();
@@ -1288,18 +1253,12 @@ int32_t ClientGetSessionIsD2DByChannelId(int32_t channelId, int32_t channelType,
         return ret;
     }
     ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if (sessionNode->channelId == channelId && sessionNode->channelType == (ChannelType)channelType) {
-                *isD2D = sessionNode->isD2D;
-                UnlockClientSessionServerList();
-                return SOFTBUS_OK;
-            }
-        }
+    SessionInfo *sessionNode = ClientFindSessionByChannel(
+        &(g_clientSessionServerList->list), channelId, channelType, false, &serverNode);
+    if (sessionNode != NULL) {
+        *isD2D = sessionNode->isD2D;
+        UnlockClientSessionServerList();
+        return SOFTBUS_OK;
     }
     UnlockClientSessionServerList();
     TRANS_LOGE(TRANS_SDK, "not found session by channelId=%{public}d", channelId);
@@ -1319,19 +1278,11 @@ int32_t ClientGetSessionIsAsyncBySessionId(int32_t sessionId, bool *isAsync)
         return ret;
     }
     ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-
-        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if (sessionNode->sessionId == sessionId) {
-                *isAsync = sessionNode->isAsync;
-                UnlockClientSessionServerList();
-                return SOFTBUS_OK;
-            }
-        }
+    SessionInfo *sessionNode = ClientFindSessionById(sessionId, &serverNode);
+    if (sessionNode != NULL) {
+        *isAsync = sessionNode->isAsync;
+        UnlockClientSessionServerList();
+        return SOFTBUS_OK;
     }
 
     UnlockClientSessionServerList();
@@ -1352,20 +1303,12 @@ int32_t GetIsAsyncAndTokenTypeBySessionId(int32_t sessionId, bool *isAsync, int3
         return ret;
     }
     ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-
-        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if (sessionNode->sessionId == sessionId) {
-                *isAsync = sessionNode->isAsync;
-                *tokenType = sessionNode->tokenType;
-                UnlockClientSessionServerList();
-                return SOFTBUS_OK;
-            }
-        }
+    SessionInfo *sessionNode = ClientFindSessionById(sessionId, &serverNode);
+    if (sessionNode != NULL) {
+        *isAsync = sessionNode->isAsync;
+        *tokenType = sessionNode->tokenType;
+        UnlockClientSessionServerList();
+        return SOFTBUS_OK;
     }
 
     UnlockClientSessionServerList();
@@ -1459,12 +1402,12 @@ static void ClientSetAuthSessionTimer(const ClientSessionServer *serverNode, Ses
     if (sessionNode->channelType == CHANNEL_TYPE_AUTH && sessionNode->actionId != 0) {
         if (strcmp(serverNode->sessionName, ISHARE_AUTH_SESSION) == 0) {
             sessionNode->lifecycle.maxWaitTime = ISHARE_AUTH_SESSION_MAX_IDLE_TIME;
-            sessionNode->lifecycle.waitTime = 0;
+            ClientRestartWaitTimer(sessionNode);
             TRANS_LOGI(TRANS_SDK, "set ISHARE auth sessionId=%{public}d waitTime success.", sessionNode->sessionId);
             return;
         } else if (strcmp(serverNode->sessionName, DM_AUTH_SESSION) == 0) {
             sessionNode->lifecycle.maxWaitTime = DM_AUTH_SESSION_MAX_IDLE_TIME;
-            sessionNode->lifecycle.waitTime = 0;
+            ClientRestartWaitTimer(sessionNode);
             TRANS_LOGI(TRANS_SDK, "set DM auth sessionId=%{public}d waitTime success.", sessionNode->sessionId);
             return;
         }
@@ -1508,6 +1451,7 @@ int32_t ClientEnableSessionByChannelId(const ChannelInfo *channel, int32_t *sess
                 *sessionId = sessionNode->sessionId;
                 sessionNode->isSupportTlv = channel->isSupportTlv;
                 sessionNode->enableMultipath = channel->enableMultipath;
+                ClientRestartIdleTimer(sessionNode);
                 sessionNode->keyType = channel->keyType;
                 if (channel->channelType == CHANNEL_TYPE_AUTH || !sessionNode->isEncrypt || channel->isD2D) {
                     ClientSetAuthSessionTimer(serverNode, sessionNode);
@@ -1536,6 +1480,7 @@ int32_t ClientEnableSessionByChannelId(const ChannelInfo *channel, int32_t *sess
                 *sessionId = sessionNode->sessionId;
                 sessionNode->isSupportTlv = channel->isSupportTlv;
                 sessionNode->enableMultipath = channel->enableMultipath;
+                ClientRestartIdleTimer(sessionNode);
                 if (channel->channelType == CHANNEL_TYPE_AUTH || !sessionNode->isEncrypt || channel->isD2D) {
                     ClientSetAuthSessionTimer(serverNode, sessionNode);
                     if (memcpy_s(sessionNode->info.peerDeviceId, DEVICE_ID_SIZE_MAX,
@@ -1809,6 +1754,7 @@ void ClientCleanAllSessionWhenServerDeath(ListNode *sessionServerInfoList)
             ListAdd(&destroyList, &(destroyNode->node));
             DestroySessionId();
             ListDelete(&sessionNode->node);
+            ClientUnindexSession(sessionNode);
             SoftBusFree(sessionNode);
             ++destroyCnt;
         }
@@ -1893,6 +1839,8 @@ int32_t DeletePagingSession(int32_t sessionId, char *pkgName, char *sessionName)
     }
 
     ListDelete(&(sessionNode->node));
+
+    ClientUnindexSession(sessionNode);
     TRANS_LOGI(TRANS_SDK, "delete session, sessionId=%{public}d", sessionId);
     SoftBusFree(sessionNode);
     UnlockClientSessionServerList();
@@ -2064,6 +2012,7 @@ int32_t DeleteSocketSession(int32_t sessionId, char *pkgName, char *sessionName)
         return SOFTBUS_STRCPY_ERR;
     }
     ListDelete(&(sessionNode->node));
+    ClientUnindexSession(sessionNode);
     TRANS_LOGI(TRANS_SDK, "delete session, sessionId=%{public}d", sessionId);
     DestroySessionId();
     if (!sessionNode->lifecycle.condIsWaiting) {
@@ -2140,6 +2089,7 @@ int32_t CreatePagingSession(const char *sessionName, int32_t businessType, int32
             }
         }
         ListAdd(&serverNode->sessionList, &session->node);
+        ClientIndexSession(serverNode, session);
         TRANS_LOGI(TRANS_SDK, "add paging, sessionId=%{public}d", session->sessionId);
         UnlockClientSessionServerList();
         return SOFTBUS_OK;
@@ -2373,7 +2323,7 @@ int32_t ClientHandleBindWaitTimer(int32_t socket, uint32_t maxWaitTime, TimerAct
     }
 
     sessionNode->lifecycle.maxWaitTime = (action == TIMER_ACTION_START) ? maxWaitTime : 0;
-    sessionNode->lifecycle.waitTime = 0;
+    ClientRestartWaitTimer(sessionNode);
     UnlockClientSessionServerList();
     return SOFTBUS_OK;
 }
@@ -2402,6 +2352,7 @@ int32_t ClientSetSocketState(int32_t socket, uint32_t maxIdleTimeout, SessionRol
     sessionNode->role = role;
     if (sessionNode->role == SESSION_ROLE_CLIENT) {
         sessionNode->maxIdleTime = maxIdleTimeout;
+        ClientArmSessionTimer(sessionNode);
     }
     if (sessionNode->role == SESSION_ROLE_SERVER) {
         serverNode->isSrvEncryptedRawStream = sessionNode->isEncyptedRawStream;
@@ -2626,22 +2577,11 @@ static void ClientTransSessionTimerProc(void)
         return;
     }
 
-    ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-    SessionInfo *nextSessionNode = NULL;
     ListNode destroyList;
     ListInit(&destroyList);
     int32_t waitOutSocket[MAX_SESSION_ID] = { 0 };
     uint32_t waitOutNum = 0;
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-        LIST_FOR_EACH_ENTRY_SAFE(sessionNode, nextSessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            ClientCheckWaitTimeOut(serverNode, sessionNode, waitOutSocket, MAX_SESSION_ID, &waitOutNum);
-            ClientUpdateIdleTimeout(serverNode, sessionNode, &destroyList);
-        }
-    }
+    ClientProcessSessionTimer(waitOutSocket, MAX_SESSION_ID, &waitOutNum, &destroyList);
     UnlockClientSessionServerList();
     (void)ClientCleanUpIdleTimeoutSocket(&destroyList);
     (void)ClientCleanUpWaitTimeoutSocket(waitOutSocket, waitOutNum);
@@ -2665,21 +2605,12 @@ int32_t ClientResetIdleTimeoutById(int32_t sessionId)
         return ret;
     }
 
-    ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-    SessionInfo *nextSessionNode = NULL;
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-        LIST_FOR_EACH_ENTRY_SAFE(sessionNode, nextSessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if (sessionNode->sessionId == sessionId) {
-                sessionNode->timeout = 0;
-                UnlockClientSessionServerList();
-                TRANS_LOGD(TRANS_SDK, "reset timeout of sessionId=%{public}d", sessionId);
-                return SOFTBUS_OK;
-            }
-        }
+    SessionInfo *sessionNode = ClientFindSessionById(sessionId, NULL);
+    if (sessionNode != NULL) {
+        ClientRestartIdleTimer(sessionNode);
+        UnlockClientSessionServerList();
+        TRANS_LOGD(TRANS_SDK, "reset timeout of sessionId=%{public}d", sessionId);
+        return SOFTBUS_OK;
     }
     UnlockClientSessionServerList();
     TRANS_LOGE(TRANS_SDK, "not found session by sessionId=%{public}d", sessionId);
@@ -2805,18 +2736,11 @@ int32_t SetSessionIsAsyncById(int32_t sessionId, bool isAsync)
     }
 
     ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if (sessionNode->sessionId == sessionId) {
-                sessionNode->isAsync = isAsync;
-                UnlockClientSessionServerList();
-                return SOFTBUS_OK;
-            }
-        }
+    SessionInfo *sessionNode = ClientFindSessionById(sessionId, &serverNode);
+    if (sessionNode != NULL) {
+        sessionNode->isAsync = isAsync;
+        UnlockClientSessionServerList();
+        return SOFTBUS_OK;
     }
     UnlockClientSessionServerList();
     return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
@@ -2836,21 +2760,15 @@ int32_t SetSessionInitInfoById(int32_t sessionId)
     }
 
     ClientSessionServer *serverNode = NULL;
-    SessionInfo *sessionNode = NULL;
-    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
-        if (IsListEmpty(&serverNode->sessionList)) {
-            continue;
-        }
-        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
-            if (sessionNode->sessionId == sessionId) {
-                sessionNode->enableStatus = ENABLE_STATUS_INIT;
-                sessionNode->channelId = INVALID_CHANNEL_ID;
-                sessionNode->channelType = CHANNEL_TYPE_BUTT;
-                sessionNode->lifecycle.sessionState = SESSION_STATE_INIT;
-                UnlockClientSessionServerList();
-                return SOFTBUS_OK;
-            }
-        }
+    SessionInfo *sessionNode = ClientFindSessionById(sessionId, &serverNode);
+    if (sessionNode != NULL) {
+        sessionNode->enableStatus = ENABLE_STATUS_INIT;
+        sessionNode->channelId = INVALID_CHANNEL_ID;
+        sessionNode->channelType = CHANNEL_TYPE_BUTT;
+        sessionNode->lifecycle.sessionState = SESSION_STATE_INIT;
+        ClientArmSessionTimer(sessionNode);
+        UnlockClientSessionServerList();
+        return SOFTBUS_OK;
     }
     UnlockClientSessionServerList();
     return SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND;
@@ -3458,6 +3376,7 @@ int32_t SetMaxIdleTimeBySocket(int32_t socket, uint32_t maxIdleTime)
 
     if (sessionNode->role == SESSION_ROLE_CLIENT) {
         sessionNode->maxIdleTime = maxIdleTime;
+        ClientArmSessionTimer(sessionNode);
     } else {
         ret = SOFTBUS_NOT_IMPLEMENT;
     }
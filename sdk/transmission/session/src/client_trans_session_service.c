@@ -288,9 +288,15 @@ int32_t OpenSession(const char *mySessionName, const char *peerSessionName, cons
         TRANS_LOGE(TRANS_SDK, "add session err: ret=%{public}d", ret);
         return ret;
     }
+#ifdef DSOFTBUS_TRANS_ASYNC_OPEN_SESSION
+    // the server hands the channel over by set channel info once the lane is ready, and reports
+    // a failed open by OnSessionOpened, so the ipc call returns without waiting for the link
+    param.isAsync = true;
+#else
     param.isAsync = false;
+#endif
     param.sessionId = sessionId;
-    TransInfo transInfo = { 0 };
+    TransInfo transInfo = { .channelId = INVALID_CHANNEL_ID, .channelType = CHANNEL_TYPE_BUTT };
     ret = ServerIpcOpenSession(&param, &transInfo);
     if (ret != SOFTBUS_OK) {
         TRANS_LOGE(TRANS_SDK, "open session ipc err: ret=%{public}d", ret);
@@ -298,6 +304,11 @@ int32_t OpenSession(const char *mySessionName, const char *peerSessionName, cons
         (void)ClientDeleteSession(sessionId);
         return ret;
     }
+    if (transInfo.channelId == INVALID_CHANNEL_ID) {
+        TRANS_LOGI(TRANS_SDK, "ok, wait for channel: sessionId=%{public}d", sessionId);
+        SoftBusFree(tmpAttr);
+        return sessionId;
+    }
 
     ret = ClientSetChannelBySessionId(sessionId, &transInfo);
     if (ret != SOFTBUS_OK) {
@@ -42,9 +42,26 @@
 #define SENDBYTES_TIMEOUT_S  20
 
 #define DISTRIBUTED_DATA_SESSION "distributeddata-default"
+#define SESSION_ID_BUCKET_NUM    128
+#define CHANNEL_SLOT_NUM         256
+#define TIMER_WHEEL_SLOT_NUM     512
 static IFeatureAbilityRelationChecker *g_relationChecker = NULL;
 static SoftBusList *g_clientDataSeqInfoList = NULL;
 
+typedef struct {
+    int32_t channelId;
+    int32_t channelType;
+    int32_t sessionId;
+} ChannelSlot;
+
+/* protected by session server list lock */
+static ListNode g_sessionIdIndex[SESSION_ID_BUCKET_NUM];
+/* direct-mapped channel cache, every hit is verified against the session found by sessionId */
+static ChannelSlot g_channelIndex[CHANNEL_SLOT_NUM];
+/* one slot per TIMER_TIMEOUT tick, a session sits in the slot of its nearest bind wait or idle deadline */
+static ListNode g_timerWheel[TIMER_WHEEL_SLOT_NUM];
+static uint32_t g_sessionTick = 0;
+
 int32_t LockClientDataSeqInfoList()
 {
     if (g_clientDataSeqInfoList == NULL) {
@@ -94,7 +111,7 @@ SessionInfo *CreateNewSession(const SessionParam *param)
         TRANS_LOGE(TRANS_SDK, "param is null");
         return NULL;
     }
-    SessionInfo *session = (SessionInfo *)SoftBusCalloc(sizeof(SessionInfo));
+    SessionInfo *session = (SessionInfo *)SoftBusCallocByModule(SOFTBUS_MEM_MODULE_SDK, sizeof(SessionInfo));
     if (session == NULL) {
         TRANS_LOGE(TRANS_SDK, "calloc failed");
         return NULL;
@@ -238,10 +255,13 @@ void DestroyClientSessionServer(ClientSessionServer *server, ListNode *destroyLi
             }
             destroyNode = CreateDestroySessionNode(sessionNode, server, NOT_MULTIPATH);
             if (destroyNode == NULL) {
+                /* the server is freed below, keep the index from pointing into it */
+                ClientUnindexSession(sessionNode);
                 continue;
             }
             DestroySessionId();
             ListDelete(&sessionNode->node);
+            ClientUnindexSession(sessionNode);
             ListAdd(destroyList, &(destroyNode->node));
             SoftBusFree(sessionNode);
         }
@@ -300,7 +320,7 @@ SessionInfo *CreateNonEncryptSessionInfo(const char *sessionName)
         TRANS_LOGW(TRANS_SDK, "Invalid param");
         return NULL;
     }
-    SessionInfo *session = (SessionInfo *)SoftBusCalloc(sizeof(SessionInfo));
+    SessionInfo *session = (SessionInfo *)SoftBusCallocByModule(SOFTBUS_MEM_MODULE_SDK, sizeof(SessionInfo));
     if (session == NULL) {
         return NULL;
     }
@@ -506,6 +526,7 @@ void DestroyAllClientSession(const ClientSessionServer *server, ListNode *destro
         }
         DestroySessionId();
         ListDelete(&sessionNode->node);
+        ClientUnindexSession(sessionNode);
         ListAdd(destroyList, &(destroyNode->node));
         SoftBusFree(sessionNode);
     }
@@ -557,6 +578,7 @@ void DestroyClientSessionByNetworkId(
         }
         DestroySessionId();
         ListDelete(&sessionNode->node);
+        ClientUnindexSession(sessionNode);
         ListAdd(destroyList, &(destroyNode->node));
         SoftBusFree(sessionNode);
     }
@@ -679,7 +701,7 @@ SessionInfo *CreateNewSocketSession(const SessionParam *param)
         TRANS_LOGE(TRANS_SDK, "invalid param.");
         return NULL;
     }
-    SessionInfo *session = (SessionInfo *)SoftBusCalloc(sizeof(SessionInfo));
+    SessionInfo *session = (SessionInfo *)SoftBusCallocByModule(SOFTBUS_MEM_MODULE_SDK, sizeof(SessionInfo));
     if (session == NULL) {
         TRANS_LOGE(TRANS_SDK, "calloc failed");
         return NULL;
@@ -830,6 +852,11 @@ void ClientCleanUpIdleTimeoutSocket(const ListNode *destroyList)
     TRANS_LOGD(TRANS_SDK, "ok");
 }
 
+static uint32_t GetSessionElapsedTime(uint32_t startTick)
+{
+    return (g_sessionTick - startTick) * TIMER_TIMEOUT;
+}
+
 void ClientCheckWaitTimeOut(const ClientSessionServer *serverNode, SessionInfo *sessionNode, int32_t waitOutSocket[],
     uint32_t capacity, uint32_t *num)
 {
@@ -841,9 +868,8 @@ void ClientCheckWaitTimeOut(const ClientSessionServer *serverNode, SessionInfo *
         return;
     }
 
-    sessionNode->lifecycle.waitTime += TIMER_TIMEOUT;
     if (sessionNode->lifecycle.maxWaitTime == 0 ||
-        sessionNode->lifecycle.waitTime <= sessionNode->lifecycle.maxWaitTime) {
+        GetSessionElapsedTime(sessionNode->lifecycle.waitStartTick) <= sessionNode->lifecycle.maxWaitTime) {
         TRANS_LOGD(TRANS_SDK, "no wait timeout, socket=%{public}d", sessionNode->sessionId);
         return;
     }
@@ -922,8 +948,7 @@ void ClientUpdateIdleTimeout(const ClientSessionServer *serverNode, SessionInfo
         return;
     }
 
-    sessionNode->timeout += TIMER_TIMEOUT;
-    if (sessionNode->maxIdleTime == 0 || sessionNode->timeout <= sessionNode->maxIdleTime) {
+    if (sessionNode->maxIdleTime == 0 || GetSessionElapsedTime(sessionNode->idleStartTick) <= sessionNode->maxIdleTime) {
         return;
     }
 
@@ -935,6 +960,7 @@ void ClientUpdateIdleTimeout(const ClientSessionServer *serverNode, SessionInfo
     ListAdd(destroyList, &(destroyNode->node));
     DestroySessionId();
     ListDelete(&sessionNode->node);
+    ClientUnindexSession(sessionNode);
     SoftBusFree(sessionNode);
 }
 
@@ -1117,6 +1143,7 @@ void PrivilegeDestroyAllClientSession(
         }
         DestroySessionId();
         ListDelete(&sessionNode->node);
+        ClientUnindexSession(sessionNode);
         ListAdd(destroyList, &(destroyNode->node));
         SoftBusFree(sessionNode);
     }
@@ -1329,4 +1356,219 @@ void TransAsyncSendBytesTimeoutProc(void)
     }
     UnlockClientDataSeqInfoList();
     (void)TransOnBindSentProc(&timeoutItemList);
-}
\ No newline at end of file
+}
+
+static ListNode *GetSessionIdBucket(int32_t sessionId)
+{
+    ListNode *bucket = &g_sessionIdIndex[(uint32_t)sessionId % SESSION_ID_BUCKET_NUM];
+    if (bucket->next == NULL) {
+        ListInit(bucket);
+    }
+    return bucket;
+}
+
+// need get g_clientSessionServerList->lock before call this function
+void ClientIndexSession(ClientSessionServer *server, SessionInfo *session)
+{
+    if (server == NULL || session == NULL) {
+        TRANS_LOGE(TRANS_SDK, "invalid param.");
+        return;
+    }
+    session->server = server;
+    ListTailInsert(GetSessionIdBucket(session->sessionId), &session->idNode);
+    session->lifecycle.waitStartTick = g_sessionTick;
+    session->idleStartTick = g_sessionTick;
+    ClientArmSessionTimer(session);
+}
+
+// need get g_clientSessionServerList->lock before call this function
+void ClientUnindexSession(SessionInfo *session)
+{
+    if (session == NULL) {
+        return;
+    }
+    ListDelete(&session->idNode);
+    ListDelete(&session->timerNode);
+    session->server = NULL;
+}
+
+// need get g_clientSessionServerList->lock before call this function
+SessionInfo *ClientFindSessionById(int32_t sessionId, ClientSessionServer **server)
+{
+    SessionInfo *session = NULL;
+    ListNode *bucket = GetSessionIdBucket(sessionId);
+    LIST_FOR_EACH_ENTRY(session, bucket, SessionInfo, idNode) {
+        if (session->sessionId == sessionId) {
+            if (server != NULL) {
+                *server = session->server;
+            }
+            return session;
+        }
+    }
+    return NULL;
+}
+
+static bool IsSessionOnChannel(const SessionInfo *session, int32_t channelId, int32_t channelType, bool withReserve)
+{
+    if (session->channelId == channelId && (int32_t)session->channelType == channelType) {
+        return true;
+    }
+    return withReserve && session->channelIdReserve == channelId && (int32_t)session->channelTypeReserve == channelType;
+}
+
+static ChannelSlot *GetChannelSlot(int32_t channelId, int32_t channelType)
+{
+    uint32_t hash = (uint32_t)channelId * CHANNEL_SLOT_NUM + (uint32_t)channelType;
+    return &g_channelIndex[(hash ^ (hash >> 8)) % CHANNEL_SLOT_NUM];
+}
+
+// need get g_clientSessionServerList->lock before call this function
+SessionInfo *ClientFindSessionByChannel(const ListNode *serverList, int32_t channelId, int32_t channelType,
+    bool withReserve, ClientSessionServer **server)
+{
+    ChannelSlot *slot = GetChannelSlot(channelId, channelType);
+    if (slot->channelId == channelId && slot->channelType == channelType) {
+        ClientSessionServer *serverNode = NULL;
+        SessionInfo *session = ClientFindSessionById(slot->sessionId, &serverNode);
+        if (session != NULL && IsSessionOnChannel(session, channelId, channelType, withReserve)) {
+            if (server != NULL) {
+                *server = serverNode;
+            }
+            return session;
+        }
+    }
+    ClientSessionServer *serverNode = NULL;
+    SessionInfo *sessionNode = NULL;
+    LIST_FOR_EACH_ENTRY(serverNode, serverList, ClientSessionServer, node) {
+        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
+            if (!IsSessionOnChannel(sessionNode, channelId, channelType, withReserve)) {
+                continue;
+            }
+            slot->channelId = channelId;
+            slot->channelType = channelType;
+            slot->sessionId = sessionNode->sessionId;
+            if (server != NULL) {
+                *server = serverNode;
+            }
+            return sessionNode;
+        }
+    }
+    return NULL;
+}
+
+static bool IsWaitTimerArmed(const SessionInfo *session)
+{
+    if (session->lifecycle.maxWaitTime == 0) {
+        return false;
+    }
+    return session->enableStatus != ENABLE_STATUS_SUCCESS ||
+        (session->server != NULL && IsRawAuthSession(session->server->sessionName));
+}
+
+static bool IsIdleTimerArmed(const SessionInfo *session)
+{
+    return session->maxIdleTime != 0 && session->role == SESSION_ROLE_CLIENT &&
+        session->enableStatus == ENABLE_STATUS_SUCCESS;
+}
+
+static uint32_t GetTimerDeadline(uint32_t startTick, uint32_t maxTime)
+{
+    // expired on the first tick that the elapsed time exceeds maxTime
+    return startTick + maxTime / TIMER_TIMEOUT + 1;
+}
+
+static bool IsTickBefore(uint32_t tick, uint32_t base)
+{
+    return (int32_t)(tick - base) < 0;
+}
+
+// need get g_clientSessionServerList->lock before call this function
+void ClientArmSessionTimer(SessionInfo *session)
+{
+    if (session == NULL || session->server == NULL) {
+        return;
+    }
+    ListDelete(&session->timerNode);
+    bool waitArmed = IsWaitTimerArmed(session);
+    bool idleArmed = IsIdleTimerArmed(session);
+    if (!waitArmed && !idleArmed) {
+        return;
+    }
+    uint32_t deadline = 0;
+    if (waitArmed) {
+        deadline = GetTimerDeadline(session->lifecycle.waitStartTick, session->lifecycle.maxWaitTime);
+    }
+    if (idleArmed) {
+        uint32_t idleDeadline = GetTimerDeadline(session->idleStartTick, session->maxIdleTime);
+        deadline = (waitArmed && IsTickBefore(deadline, idleDeadline)) ? deadline : idleDeadline;
+    }
+    if (IsTickBefore(deadline, g_sessionTick + 1)) {
+        deadline = g_sessionTick + 1;
+    }
+    ListNode *slot = &g_timerWheel[deadline % TIMER_WHEEL_SLOT_NUM];
+    if (slot->next == NULL) {
+        ListInit(slot);
+    }
+    session->timerTick = deadline;
+    ListTailInsert(slot, &session->timerNode);
+}
+
+// need get g_clientSessionServerList->lock before call this function
+void ClientRestartWaitTimer(SessionInfo *session)
+{
+    if (session == NULL) {
+        return;
+    }
+    session->lifecycle.waitStartTick = g_sessionTick;
+    ClientArmSessionTimer(session);
+}
+
+// need get g_clientSessionServerList->lock before call this function
+void ClientRestartIdleTimer(SessionInfo *session)
+{
+    if (session == NULL) {
+        return;
+    }
+    session->idleStartTick = g_sessionTick;
+    if (!IsIdleTimerArmed(session)) {
+        return;
+    }
+    // a later deadline is pushed back lazily when the session comes up in the wheel, keep send and recv O(1)
+    bool inWheel = session->timerNode.next != NULL && !IsListEmpty(&session->timerNode);
+    if (!inWheel || IsTickBefore(GetTimerDeadline(g_sessionTick, session->maxIdleTime), session->timerTick)) {
+        ClientArmSessionTimer(session);
+    }
+}
+
+// need get g_clientSessionServerList->lock before call this function
+void ClientProcessSessionTimer(int32_t waitOutSocket[], uint32_t capacity, uint32_t *num, ListNode *destroyList)
+{
+    if (waitOutSocket == NULL || num == NULL || destroyList == NULL) {
+        TRANS_LOGE(TRANS_SDK, "invalid param.");
+        return;
+    }
+    g_sessionTick++;
+    ListNode *slot = &g_timerWheel[g_sessionTick % TIMER_WHEEL_SLOT_NUM];
+    if (slot->next == NULL) {
+        ListInit(slot);
+        return;
+    }
+    ListNode expired;
+    ListInit(&expired);
+    SessionInfo *sessionNode = NULL;
+    SessionInfo *nextSessionNode = NULL;
+    LIST_FOR_EACH_ENTRY_SAFE(sessionNode, nextSessionNode, slot, SessionInfo, timerNode) {
+        if (sessionNode->timerTick != g_sessionTick) {
+            continue;
+        }
+        ListDelete(&sessionNode->timerNode);
+        ListTailInsert(&expired, &sessionNode->timerNode);
+    }
+    LIST_FOR_EACH_ENTRY_SAFE(sessionNode, nextSessionNode, &expired, SessionInfo, timerNode) {
+        ClientSessionServer *serverNode = sessionNode->server;
+        ClientCheckWaitTimeOut(serverNode, sessionNode, waitOutSocket, capacity, num);
+        // rearm before the idle check, which may free the session
+        ClientArmSessionTimer(sessionNode);
+        ClientUpdateIdleTimeout(serverNode, sessionNode, destroyList);
+    }
+}
@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "stream_frame_buffer_pool.h"
+
+#include <new>
+
+namespace Communication {
+namespace SoftBus {
+StreamFrameBuffer StreamFrameBufferPool::Acquire(size_t len)
+{
+    StreamFrameBuffer buffer;
+    if (len == 0) {
+        return buffer;
+    }
+    {
+        std::lock_guard<std::mutex> lock(lock_);
+        auto best = freeBuffers_.end();
+        for (auto it = freeBuffers_.begin(); it != freeBuffers_.end(); ++it) {
+            if (it->capacity >= len && (best == freeBuffers_.end() || it->capacity < best->capacity)) {
+                best = it;
+            }
+        }
+        if (best != freeBuffers_.end()) {
+            buffer = std::move(*best);
+            freeBuffers_.erase(best);
+            return buffer;
+        }
+    }
+    // the whole frame is overwritten by packetize and encrypt, no need to zero it
+    size_t capacity = (len + BUFFER_ALIGN_SIZE - 1) / BUFFER_ALIGN_SIZE * BUFFER_ALIGN_SIZE;
+    buffer.data.reset(new (std::nothrow) char[capacity]);
+    buffer.capacity = (buffer.data == nullptr) ? 0 : capacity;
+    return buffer;
+}
+
+void StreamFrameBufferPool::Release(StreamFrameBuffer buffer)
+{
+    if (buffer.data == nullptr || buffer.capacity > MAX_POOLED_SIZE) {
+        return;
+    }
+    std::lock_guard<std::mutex> lock(lock_);
+    if (freeBuffers_.size() < MAX_POOLED_NUM) {
+        freeBuffers_.push_back(std::move(buffer));
+        return;
+    }
+    // keep the larger one, the frame size of a stream only grows up to its resolution limit
+    auto smallest = freeBuffers_.begin();
+    for (auto it = freeBuffers_.begin(); it != freeBuffers_.end(); ++it) {
+        if (it->capacity < smallest->capacity) {
+            smallest = it;
+        }
+    }
+    if (smallest->capacity < buffer.capacity) {
+        *smallest = std::move(buffer);
+    }
+}
+
+void StreamFrameBufferPool::Clear()
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    freeBuffers_.clear();
+}
+
+size_t StreamFrameBufferPool::GetPooledNum()
+{
+    std::lock_guard<std::mutex> lock(lock_);
+    return freeBuffers_.size();
+}
+} // namespace SoftBus
+} // namespace Communication
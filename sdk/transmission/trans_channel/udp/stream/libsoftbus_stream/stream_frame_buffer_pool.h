@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef STREAM_FRAME_BUFFER_POOL_H
+#define STREAM_FRAME_BUFFER_POOL_H
+
+#include <cstddef>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+namespace Communication {
+namespace SoftBus {
+struct StreamFrameBuffer {
+    std::unique_ptr<char[]> data = nullptr;
+    size_t capacity = 0;
+};
+
+/*
+ * Keeps the few most recent send buffers of a stream socket, so that a frame of a similar size is packetized
+ * and encrypted without a new allocation. MAX_POOLED_SIZE covers MAX_STREAM_LEN plus the headers, larger
+ * buffers are never kept.
+ */
+class StreamFrameBufferPool {
+public:
+    static constexpr size_t MAX_POOLED_NUM = 4;
+    static constexpr size_t MAX_POOLED_SIZE = 4 * 1024 * 1024;
+    static constexpr size_t BUFFER_ALIGN_SIZE = 4096;
+
+    StreamFrameBufferPool() = default;
+    virtual ~StreamFrameBufferPool() = default;
+
+    StreamFrameBuffer Acquire(size_t len);
+    void Release(StreamFrameBuffer buffer);
+    void Clear();
+    size_t GetPooledNum();
+
+private:
+    std::mutex lock_;
+    std::vector<StreamFrameBuffer> freeBuffers_;
+};
+} // namespace SoftBus
+} // namespace Communication
+
+#endif
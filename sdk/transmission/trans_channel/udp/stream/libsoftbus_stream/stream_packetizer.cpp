@@ -40,21 +40,38 @@ ssize_t StreamPacketizer::CalculateExtSize(ssize_t extSize) const
     return total;
 }
 
-std::unique_ptr<char[]> StreamPacketizer::PacketizeStream()
+ssize_t StreamPacketizer::CalculatePacketLen()
 {
     dataSize_ = originData_->GetBufferLen();
     hdrSize_ = CalculateHeaderSize();
     extSize_ = CalculateExtSize(originData_->GetExtBufferLen());
-    auto data = std::make_unique<char[]>(hdrSize_ + extSize_ + dataSize_);
+    return GetPacketLen();
+}
 
+std::unique_ptr<char[]> StreamPacketizer::PacketizeStream()
+{
+    auto len = CalculatePacketLen();
+    auto data = std::make_unique<char[]>(len);
+    if (!PacketizeStream(data.get(), len)) {
+        return nullptr;
+    }
+    return data;
+}
+
+bool StreamPacketizer::PacketizeStream(char *buffer, ssize_t bufferLen)
+{
+    if (buffer == nullptr || bufferLen < GetPacketLen()) {
+        TRANS_LOGE(TRANS_STREAM, "invalid buffer, bufferLen=%{public}zd", bufferLen);
+        return false;
+    }
     auto streamPktHeader = StreamPacketHeader(streamType_, extSize_ > 0, extSize_ + dataSize_,
         originData_->GetStreamFrameInfo());
-    streamPktHeader.Packetize(data.get(), hdrSize_, 0);
+    streamPktHeader.Packetize(buffer, hdrSize_, 0);
 
     TwoLevelsTlv tlv(originData_->GetExtBuffer(), originData_->GetExtBufferLen());
-    if (tlv.Packetize(data.get(), extSize_, hdrSize_) != 0) {
+    if (tlv.Packetize(buffer, extSize_, hdrSize_) != 0) {
         TRANS_LOGE(TRANS_STREAM, "packetize tlv failed");
-        return nullptr;
+        return false;
     }
 
     TRANS_LOGD(TRANS_STREAM,
@@ -73,13 +90,13 @@ std::unique_ptr<char[]> StreamPacketizer::PacketizeStream()
         "TLV version=%{public}d, num=%{public}d, extSize=%{public}zd, extLen=%{public}zd, checksum=%{public}u",
         tlv.GetVersion(), tlv.GetTlvNums(), extSize_, tlv.GetExtLen(), tlv.GetCheckSum());
 
-    auto ret = memcpy_s(data.get() + hdrSize_ + extSize_, dataSize_, originData_->GetBuffer().get(),
+    auto ret = memcpy_s(buffer + hdrSize_ + extSize_, dataSize_, originData_->GetBuffer().get(),
         originData_->GetBufferLen());
     if (ret != 0) {
         TRANS_LOGE(TRANS_STREAM, "Failed to memcpy data! ret=%{public}d", ret);
     }
 
-    return data;
+    return true;
 }
 } // namespace SoftBus
 } // namespace Communication
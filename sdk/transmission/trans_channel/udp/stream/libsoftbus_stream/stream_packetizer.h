@@ -33,6 +33,9 @@ public:
     ssize_t CalculateExtSize(ssize_t extSize) const;
 
     std::unique_ptr<char[]> PacketizeStream();
+    // packetize into a caller buffer of at least CalculatePacketLen() bytes, the payload is copied only once
+    ssize_t CalculatePacketLen();
+    bool PacketizeStream(char *buffer, ssize_t bufferLen);
     ssize_t GetPacketLen() const
     {
         return hdrSize_ + dataSize_ + extSize_;
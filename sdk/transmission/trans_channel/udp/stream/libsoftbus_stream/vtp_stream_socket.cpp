@@ -557,6 +557,7 @@ void VtpStreamSocket::DestroyStreamSocket(bool isClose)
     }
 
     QuitStreamBuffer();
+    framePool_.Clear();
     vtpInstance_->UpdateSocketStreamCount(false);
     isDestroyed_ = true;
     TRANS_LOGD(TRANS_STREAM, "ok");
@@ -605,24 +606,30 @@ bool VtpStreamSocket::Connect(const IpAndPort &remote)
     return true;
 }
 
-bool VtpStreamSocket::EncryptStreamPacket(std::unique_ptr<IStream> stream, std::unique_ptr<char[]> &data, ssize_t &len)
+bool VtpStreamSocket::EncryptStreamPacket(std::unique_ptr<IStream> stream, StreamFrameBuffer &data, ssize_t &len)
 {
     StreamPacketizer packet(streamType_, std::move(stream));
-    auto plainData = packet.PacketizeStream();
-    if (plainData == nullptr) {
+    ssize_t packetLen = packet.CalculatePacketLen();
+    len = packetLen + GetEncryptOverhead();
+    TRANS_LOGD(TRANS_STREAM, "packetLen=%{public}zd, encryptOverhead=%{public}zd", packetLen, GetEncryptOverhead());
+    data = framePool_.Acquire(len + FRAME_HEADER_LEN);
+    if (data.data == nullptr) {
+        TRANS_LOGE(TRANS_STREAM, "acquire frame buffer failed, len=%{public}zd", len);
+        return false;
+    }
+    // frame length | iv | packet | tag, the packet is written where the ciphertext goes and encrypted in place
+    char *cipher = data.data.get() + FRAME_HEADER_LEN;
+    char *plain = cipher + GCM_IV_LEN;
+    if (!packet.PacketizeStream(plain, packetLen)) {
         TRANS_LOGE(TRANS_STREAM, "PacketizeStream failed");
         return false;
     }
-    len = packet.GetPacketLen() + GetEncryptOverhead();
-    TRANS_LOGD(TRANS_STREAM, "packetLen=%{public}zd, encryptOverhead=%{public}zd",
-        packet.GetPacketLen(), GetEncryptOverhead());
-    data = std::make_unique<char[]>(len + FRAME_HEADER_LEN);
-    ssize_t encLen = Encrypt(plainData.get(), packet.GetPacketLen(), data.get() + FRAME_HEADER_LEN, len);
+    ssize_t encLen = Encrypt(plain, packetLen, cipher, len);
     if (encLen != len) {
         TRANS_LOGE(TRANS_STREAM, "encrypted failed, dataLen=%{public}zd, encLen=%{public}zd", len, encLen);
         return false;
     }
-    InsertBufferLength(len, FRAME_HEADER_LEN, reinterpret_cast<uint8_t *>(data.get()));
+    InsertBufferLength(len, FRAME_HEADER_LEN, reinterpret_cast<uint8_t *>(data.data.get()));
     len += FRAME_HEADER_LEN;
 
     return true;
@@ -666,10 +673,13 @@ bool VtpStreamSocket::Send(std::unique_ptr<IStream> stream)
 
         ret = FtSendFrame(streamFd_, data.get(), len, 0, &frameInfo);
     } else if (streamType_ == COMMON_VIDEO_STREAM || streamType_ == COMMON_AUDIO_STREAM) {
-        if (!EncryptStreamPacket(std::move(stream), data, len)) {
+        StreamFrameBuffer frame;
+        if (!EncryptStreamPacket(std::move(stream), frame, len)) {
+            framePool_.Release(std::move(frame));
             return false;
         }
-        ret = FtSendFrame(streamFd_, data.get(), len, 0, &frameInfo);
+        ret = FtSendFrame(streamFd_, frame.data.get(), len, 0, &frameInfo);
+        framePool_.Release(std::move(frame));
     }
 
     if (ret == -1) {
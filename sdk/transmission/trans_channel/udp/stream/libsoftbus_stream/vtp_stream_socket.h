@@ -17,6 +17,7 @@
 #define VTP_STREAM_SOCKET_H
 
 #include "common_inner.h"
+#include "stream_frame_buffer_pool.h"
 #include "vtp_instance.h"
 
 namespace Communication {
@@ -91,7 +92,7 @@ private:
         { PKT_STATISTICS, FT_CONF_APP_FC_STATISTICS },
         { PKT_LOSS, FT_CONF_APP_FC_RECV_PKT_LOSS },
     };
-    bool EncryptStreamPacket(std::unique_ptr<IStream> stream, std::unique_ptr<char[]> &data, ssize_t &len);
+    bool EncryptStreamPacket(std::unique_ptr<IStream> stream, StreamFrameBuffer &data, ssize_t &len);
     bool ProcessCommonDataStream(std::unique_ptr<char[]> &dataBuffer, int32_t &dataLength,
         std::unique_ptr<char[]> &extBuffer, int32_t &extLen, StreamFrameInfo &info);
     void InsertElementToFuncMap(int32_t type, ValueType valueType, MySetFunc set, MyGetFunc get);
@@ -198,6 +199,7 @@ private:
     std::mutex streamSocketLock_;
     int32_t scene_ = UNKNOWN_SCENE;
     int32_t streamHdrSize_ = 0;
+    StreamFrameBufferPool framePool_;
     bool isDestroyed_ = false;
     OnFrameEvt onStreamEvtCb_ = nullptr;
 };
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <cstring>
+
+#include "softbus_adapter_mem.h"
+
+namespace OHOS {
+static constexpr int32_t BATCH_NUM = 64;
+static constexpr int32_t MIN_SIZE = 32;
+static constexpr int32_t MAX_SIZE = 4096;
+static constexpr int32_t MAX_THREAD_NUM = 8;
+
+/**
+ * @tc.name: MallocFreeTestCase
+ * @tc.desc: libc malloc and free Performance Testing, the baseline of SoftBusCalloc
+ * @tc.type: FUNC
+ * @tc.require: malloc normal operation
+ */
+static void MallocFreeTestCase(benchmark::State &state)
+{
+    size_t size = static_cast<size_t>(state.range(0));
+    void *blocks[BATCH_NUM] = { nullptr };
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < BATCH_NUM; i++) {
+            blocks[i] = malloc(size);
+            if (blocks[i] != nullptr) {
+                (void)memset(blocks[i], 0, size);
+            }
+        }
+        for (int32_t i = 0; i < BATCH_NUM; i++) {
+            free(blocks[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH_NUM);
+}
+BENCHMARK(MallocFreeTestCase)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE)->ThreadRange(1, MAX_THREAD_NUM);
+
+/**
+ * @tc.name: SoftBusCallocFreeTestCase
+ * @tc.desc: SoftBusCalloc and SoftBusFree Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: SoftBusCalloc normal operation
+ */
+static void SoftBusCallocFreeTestCase(benchmark::State &state)
+{
+    uint32_t size = static_cast<uint32_t>(state.range(0));
+    void *blocks[BATCH_NUM] = { nullptr };
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < BATCH_NUM; i++) {
+            blocks[i] = SoftBusCalloc(size);
+        }
+        for (int32_t i = 0; i < BATCH_NUM; i++) {
+            SoftBusFree(blocks[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH_NUM);
+}
+BENCHMARK(SoftBusCallocFreeTestCase)->RangeMultiplier(8)->Range(MIN_SIZE, MAX_SIZE)->ThreadRange(1, MAX_THREAD_NUM);
+
+/**
+ * @tc.name: SoftBusCallocByModuleTestCase
+ * @tc.desc: SoftBusCallocByModule Performance Testing, with the module accounting on the path
+ * @tc.type: FUNC
+ * @tc.require: SoftBusCallocByModule normal operation
+ */
+static void SoftBusCallocByModuleTestCase(benchmark::State &state)
+{
+    uint32_t size = static_cast<uint32_t>(state.range(0));
+    void *blocks[BATCH_NUM] = { nullptr };
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < BATCH_NUM; i++) {
+            blocks[i] = SoftBusCallocByModule(SOFTBUS_MEM_MODULE_TRANS, size);
+        }
+        for (int32_t i = 0; i < BATCH_NUM; i++) {
+            SoftBusFree(blocks[i]);
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * BATCH_NUM);
+}
+BENCHMARK(SoftBusCallocByModuleTestCase)->Arg(MIN_SIZE)->ThreadRange(1, MAX_THREAD_NUM);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
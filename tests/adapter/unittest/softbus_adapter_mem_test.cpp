@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cstdlib>
+#include <cstring>
+#include <sys/mman.h>
+#include <thread>
+#include <unistd.h>
+#include <vector>
+
+#include "softbus_adapter_mem.h"
+#include "softbus_error_code.h"
+#include "gtest/gtest.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+static constexpr uint32_t SMALL_SIZE = 24;
+static constexpr uint32_t CLASS_SIZE = 200;
+static constexpr uint32_t LARGE_SIZE = 8192;
+static constexpr uint32_t THREAD_NUM = 4;
+static constexpr uint32_t LOOP_NUM = 1000;
+static constexpr uint32_t BATCH_NUM = 100;
+static constexpr uint32_t TRIM_SIZE = 1024;
+static constexpr uint32_t TRIM_BLOCK_NUM = 256; // spans several 64k spans of the 1k class
+static constexpr uint8_t TRIM_PATTERN = 0xA5;
+
+class AdapterDsoftbusMemSlabTest : public testing::Test {
+protected:
+    static void SetUpTestCase(void) { }
+    static void TearDownTestCase(void) { }
+    void SetUp() { }
+    void TearDown() { }
+};
+
+static SoftBusMemStat GetStat(SoftBusMemModule module)
+{
+    SoftBusMemStat stat = { 0 };
+    EXPECT_EQ(SOFTBUS_OK, SoftBusGetMemStat(module, &stat));
+    return stat;
+}
+
+/*
+ * @tc.name: SoftBusMemStatTest001
+ * @tc.desc: alloc and free by module, the module stat counts the bytes and objects in use
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AdapterDsoftbusMemSlabTest, SoftBusMemStatTest001, TestSize.Level1)
+{
+    SoftBusMemStat before = GetStat(SOFTBUS_MEM_MODULE_AUTH);
+    void *small = SoftBusCallocByModule(SOFTBUS_MEM_MODULE_AUTH, SMALL_SIZE);
+    void *large = SoftBusMallocByModule(SOFTBUS_MEM_MODULE_AUTH, LARGE_SIZE);
+    ASSERT_NE(small, nullptr);
+    ASSERT_NE(large, nullptr);
+    SoftBusMemStat during = GetStat(SOFTBUS_MEM_MODULE_AUTH);
+    EXPECT_EQ(during.usedBytes, before.usedBytes + SMALL_SIZE + LARGE_SIZE);
+    EXPECT_EQ(during.usedCount, before.usedCount + 2);
+    EXPECT_GE(during.peakBytes, during.usedBytes);
+    EXPECT_EQ(during.totalCount, before.totalCount + 2);
+    SoftBusFree(small);
+    SoftBusFree(large);
+    SoftBusMemStat after = GetStat(SOFTBUS_MEM_MODULE_AUTH);
+    EXPECT_EQ(after.usedBytes, before.usedBytes);
+    EXPECT_EQ(after.usedCount, before.usedCount);
+}
+
+/*
+ * @tc.name: SoftBusMemStatTest002
+ * @tc.desc: the thread module tags SoftBusMalloc and an unfreed block shows up as a leak of that module
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AdapterDsoftbusMemSlabTest, SoftBusMemStatTest002, TestSize.Level1)
+{
+    SoftBusMemStat before = GetStat(SOFTBUS_MEM_MODULE_DISC);
+    SoftBusMemModule prev = SoftBusSetMemModule(SOFTBUS_MEM_MODULE_DISC);
+    void *leak = SoftBusCalloc(CLASS_SIZE);
+    EXPECT_EQ(SOFTBUS_MEM_MODULE_DISC, SoftBusSetMemModule(prev));
+    ASSERT_NE(leak, nullptr);
+    SoftBusMemStat leaked = GetStat(SOFTBUS_MEM_MODULE_DISC);
+    EXPECT_EQ(leaked.usedBytes - before.usedBytes, CLASS_SIZE);
+    EXPECT_EQ(leaked.usedCount - before.usedCount, 1);
+    SoftBusFree(leak);
+    EXPECT_EQ(GetStat(SOFTBUS_MEM_MODULE_DISC).usedBytes, before.usedBytes);
+}
+
+/*
+ * @tc.name: SoftBusMemStatTest003
+ * @tc.desc: invalid param
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AdapterDsoftbusMemSlabTest, SoftBusMemStatTest003, TestSize.Level1)
+{
+    SoftBusMemStat stat = { 0 };
+    EXPECT_EQ(SOFTBUS_INVALID_PARAM, SoftBusGetMemStat(SOFTBUS_MEM_MODULE_BUTT, &stat));
+    EXPECT_EQ(SOFTBUS_INVALID_PARAM, SoftBusGetMemStat(SOFTBUS_MEM_MODULE_AUTH, nullptr));
+    EXPECT_EQ(nullptr, SoftBusMallocByModule(SOFTBUS_MEM_MODULE_BUTT, SMALL_SIZE));
+    EXPECT_EQ(nullptr, SoftBusMallocByModule(SOFTBUS_MEM_MODULE_AUTH, MAX_MALLOC_SIZE + 1));
+    EXPECT_EQ(SOFTBUS_MEM_MODULE_COMMON, SoftBusSetMemModule(SOFTBUS_MEM_MODULE_BUTT));
+}
+
+/*
+ * @tc.name: SoftBusMemFreeTest001
+ * @tc.desc: memory from plain malloc is handed to free and does not touch the module stats
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AdapterDsoftbusMemSlabTest, SoftBusMemFreeTest001, TestSize.Level1)
+{
+    SoftBusMemStat before = GetStat(SOFTBUS_MEM_MODULE_CONN);
+    void *block = SoftBusMallocByModule(SOFTBUS_MEM_MODULE_CONN, SMALL_SIZE);
+    void *large = SoftBusMallocByModule(SOFTBUS_MEM_MODULE_CONN, LARGE_SIZE);
+    ASSERT_NE(block, nullptr);
+    ASSERT_NE(large, nullptr);
+    void *foreign = malloc(SMALL_SIZE);
+    void *foreignLarge = malloc(LARGE_SIZE);
+    ASSERT_NE(foreign, nullptr);
+    ASSERT_NE(foreignLarge, nullptr);
+    SoftBusFree(foreign);
+    SoftBusFree(foreignLarge);
+    SoftBusMemStat during = GetStat(SOFTBUS_MEM_MODULE_CONN);
+    EXPECT_EQ(during.usedCount, before.usedCount + 2);
+    EXPECT_EQ(during.usedBytes, before.usedBytes + SMALL_SIZE + LARGE_SIZE);
+    SoftBusFree(large);
+    SoftBusFree(block);
+    EXPECT_EQ(GetStat(SOFTBUS_MEM_MODULE_CONN).usedCount, before.usedCount);
+}
+
+/*
+ * @tc.name: SoftBusMemThreadTest001
+ * @tc.desc: blocks allocated and freed across threads do not leak and keep their content
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AdapterDsoftbusMemSlabTest, SoftBusMemThreadTest001, TestSize.Level1)
+{
+    SoftBusMemStat before = GetStat(SOFTBUS_MEM_MODULE_TRANS);
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < THREAD_NUM; i++) {
+        threads.emplace_back([i]() {
+            for (uint32_t loop = 0; loop < LOOP_NUM; loop++) {
+                uint8_t *blocks[BATCH_NUM] = { nullptr };
+                for (uint32_t j = 0; j < BATCH_NUM; j++) {
+                    uint32_t size = SMALL_SIZE + (j * CLASS_SIZE) % LARGE_SIZE;
+                    blocks[j] = static_cast<uint8_t *>(SoftBusCallocByModule(SOFTBUS_MEM_MODULE_TRANS, size));
+                    ASSERT_NE(blocks[j], nullptr);
+                    blocks[j][0] = static_cast<uint8_t>(i + j);
+                }
+                for (uint32_t j = 0; j < BATCH_NUM; j++) {
+                    EXPECT_EQ(blocks[j][0], static_cast<uint8_t>(i + j));
+                    SoftBusFree(blocks[j]);
+                }
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    SoftBusMemStat after = GetStat(SOFTBUS_MEM_MODULE_TRANS);
+    EXPECT_EQ(after.usedBytes, before.usedBytes);
+    EXPECT_EQ(after.usedCount, before.usedCount);
+    EXPECT_EQ(after.totalCount - before.totalCount, THREAD_NUM * LOOP_NUM * BATCH_NUM);
+}
+
+static bool IsPageResident(const void *pt)
+{
+    uintptr_t pageSize = static_cast<uintptr_t>(sysconf(_SC_PAGESIZE));
+    void *page = reinterpret_cast<void *>(reinterpret_cast<uintptr_t>(pt) & ~(pageSize - 1));
+    unsigned char vec = 0;
+    EXPECT_EQ(0, mincore(page, pageSize, &vec));
+    return (vec & 1) != 0;
+}
+
+/*
+ * @tc.name: SoftBusMemTrimTest001
+ * @tc.desc: trim gives the pages of fully free spans back to the OS, keeps a block in use and the arena reusable
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AdapterDsoftbusMemSlabTest, SoftBusMemTrimTest001, TestSize.Level1)
+{
+    SoftBusMemStat before = GetStat(SOFTBUS_MEM_MODULE_LNN);
+    uint8_t *kept = static_cast<uint8_t *>(SoftBusMallocByModule(SOFTBUS_MEM_MODULE_LNN, TRIM_SIZE));
+    ASSERT_NE(kept, nullptr);
+    (void)memset(kept, TRIM_PATTERN, TRIM_SIZE);
+    std::vector<void *> freed;
+    // blocks freed on an exiting thread go to the depot, where trim can see them
+    std::thread worker([&freed]() {
+        for (uint32_t i = 0; i < TRIM_BLOCK_NUM; i++) {
+            void *block = SoftBusCallocByModule(SOFTBUS_MEM_MODULE_LNN, TRIM_SIZE);
+            ASSERT_NE(block, nullptr);
+            freed.push_back(block);
+        }
+        for (void *block : freed) {
+            SoftBusFree(block);
+        }
+    });
+    worker.join();
+    ASSERT_EQ(freed.size(), TRIM_BLOCK_NUM);
+
+    SoftBusMemTrim();
+    uint32_t residentNum = 0;
+    for (void *block : freed) {
+        residentNum += IsPageResident(block) ? 1 : 0;
+    }
+    EXPECT_LT(residentNum, TRIM_BLOCK_NUM);
+    for (uint32_t i = 0; i < TRIM_SIZE; i++) {
+        ASSERT_EQ(kept[i], TRIM_PATTERN);
+    }
+    SoftBusFree(kept);
+
+    for (uint32_t i = 0; i < TRIM_BLOCK_NUM; i++) {
+        uint8_t *block = static_cast<uint8_t *>(SoftBusCallocByModule(SOFTBUS_MEM_MODULE_LNN, TRIM_SIZE));
+        ASSERT_NE(block, nullptr);
+        EXPECT_EQ(block[TRIM_SIZE - 1], 0);
+        freed[i] = block;
+    }
+    for (void *block : freed) {
+        SoftBusFree(block);
+    }
+    SoftBusMemStat after = GetStat(SOFTBUS_MEM_MODULE_LNN);
+    EXPECT_EQ(after.usedBytes, before.usedBytes);
+    EXPECT_EQ(after.usedCount, before.usedCount);
+}
+} // namespace OHOS
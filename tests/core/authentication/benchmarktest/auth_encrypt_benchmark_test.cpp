@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <securec.h>
+
+#include "auth_common.h"
+#include "auth_interface.h"
+#include "auth_manager.h"
+#include "auth_session_key.h"
+#include "softbus_error_code.h"
+
+namespace OHOS {
+static constexpr int64_t ENCRYPT_NUM = 100000;
+static constexpr int64_t AUTH_SEQ_BASE = 1000;
+static constexpr uint32_t AUTH_MANAGER_NUM = 64;
+static constexpr int32_t KEY_INDEX = 1;
+static constexpr uint32_t PLAIN_LEN = 256;
+
+static bool PrepareAuthManagers(void)
+{
+    static bool isPrepared = false;
+    if (isPrepared) {
+        return true;
+    }
+    if (AuthCommonInit() != SOFTBUS_OK || InitSessionKeyCipherCache() != SOFTBUS_OK) {
+        return false;
+    }
+    for (uint32_t i = 0; i < AUTH_MANAGER_NUM; i++) {
+        AuthSessionInfo info;
+        (void)memset_s(&info, sizeof(AuthSessionInfo), 0, sizeof(AuthSessionInfo));
+        info.connId = i;
+        info.connInfo.type = AUTH_LINK_TYPE_WIFI;
+        info.version = SOFTBUS_NEW_V2;
+        (void)sprintf_s(info.udid, UDID_BUF_LEN, "benchmarkudid%u", i);
+        (void)sprintf_s(info.uuid, UUID_BUF_LEN, "benchmarkuuid%u", i);
+        (void)sprintf_s(info.connInfo.info.ipInfo.ip, IP_LEN, "192.168.1.%u", i + 1);
+        if (!RequireAuthLock()) {
+            return false;
+        }
+        AuthManager *auth = NewAuthManager(AUTH_SEQ_BASE + i, &info);
+        SessionKey sessionKey = { .len = SESSION_KEY_LENGTH };
+        (void)memset_s(sessionKey.value, SESSION_KEY_LENGTH, i + 1, SESSION_KEY_LENGTH);
+        bool isOk = auth != nullptr &&
+            AddSessionKey(&auth->sessionKeyList, KEY_INDEX, &sessionKey, AUTH_LINK_TYPE_WIFI, false) == SOFTBUS_OK &&
+            SetSessionKeyAvailable(&auth->sessionKeyList, KEY_INDEX) == SOFTBUS_OK;
+        ReleaseAuthLock();
+        if (!isOk) {
+            return false;
+        }
+    }
+    isPrepared = true;
+    return true;
+}
+
+/**
+ * @tc.name: AuthEncryptTestCase
+ * @tc.desc: encrypt with the session keys of 64 auth managers Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: AuthEncrypt normal operation
+ */
+static void AuthEncryptTestCase(benchmark::State &state)
+{
+    if (!PrepareAuthManagers()) {
+        state.SkipWithError("AuthEncryptTestCase prepare failed.");
+        return;
+    }
+    uint8_t inData[PLAIN_LEN] = { 0 };
+    uint8_t outData[PLAIN_LEN + ENCRYPT_OVER_HEAD_LEN] = { 0 };
+    uint32_t index = 0;
+    while (state.KeepRunning()) {
+        AuthHandle authHandle = { .authId = AUTH_SEQ_BASE + index, .type = AUTH_LINK_TYPE_WIFI };
+        uint32_t outLen = sizeof(outData);
+        if (AuthEncrypt(&authHandle, inData, sizeof(inData), outData, &outLen) != SOFTBUS_OK) {
+            state.SkipWithError("AuthEncryptTestCase failed.");
+            break;
+        }
+        index = (index + 1) % AUTH_MANAGER_NUM;
+    }
+}
+BENCHMARK(AuthEncryptTestCase)->Iterations(ENCRYPT_NUM);
+
+/**
+ * @tc.name: AuthEncryptDecryptTestCase
+ * @tc.desc: encrypt and decrypt round trip with the session keys of 64 auth managers Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: AuthEncrypt and AuthDecrypt normal operation
+ */
+static void AuthEncryptDecryptTestCase(benchmark::State &state)
+{
+    if (!PrepareAuthManagers()) {
+        state.SkipWithError("AuthEncryptDecryptTestCase prepare failed.");
+        return;
+    }
+    uint8_t inData[PLAIN_LEN] = { 0 };
+    uint8_t encData[PLAIN_LEN + ENCRYPT_OVER_HEAD_LEN] = { 0 };
+    uint8_t decData[PLAIN_LEN] = { 0 };
+    uint32_t index = 0;
+    while (state.KeepRunning()) {
+        AuthHandle authHandle = { .authId = AUTH_SEQ_BASE + index, .type = AUTH_LINK_TYPE_WIFI };
+        uint32_t encLen = sizeof(encData);
+        uint32_t decLen = sizeof(decData);
+        if (AuthEncrypt(&authHandle, inData, sizeof(inData), encData, &encLen) != SOFTBUS_OK ||
+            AuthDecrypt(&authHandle, encData, encLen, decData, &decLen) != SOFTBUS_OK) {
+            state.SkipWithError("AuthEncryptDecryptTestCase failed.");
+            break;
+        }
+        index = (index + 1) % AUTH_MANAGER_NUM;
+    }
+}
+BENCHMARK(AuthEncryptDecryptTestCase)->Iterations(ENCRYPT_NUM);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
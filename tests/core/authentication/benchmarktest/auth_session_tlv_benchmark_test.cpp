@@ -0,0 +1,217 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <securec.h>
+
+#include "auth_session_json.c"
+#include "auth_session_json_mock.h"
+
+namespace OHOS {
+using namespace testing;
+static constexpr int32_t TEST_MASTER_WEIGHT = 1000;
+static constexpr int32_t TEST_DEVICE_TYPE_ID = 0x0E;
+static constexpr uint64_t TEST_FEATURE = 0x1F7FFFEULL;
+static constexpr int64_t TEST_ACCOUNT_ID = 123456789;
+
+static NiceMock<AuthSessionJsonInterfaceMock> g_mock;
+
+static void BuildNodeInfo(NodeInfo *info)
+{
+    (void)memset_s(info, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+    (void)strcpy_s(info->softBusVersion, sizeof(info->softBusVersion), "hm.1.0.0");
+    (void)strcpy_s(info->masterUdid, sizeof(info->masterUdid),
+        "8A5B2C4D6E8F0A1B3C5D7E9F0A2B4C6D8E0F1A3B5C7D9E0F2A4B6C8D0E1F3A5B");
+    (void)strcpy_s(info->nodeAddress, sizeof(info->nodeAddress), "127.0.0.1");
+    (void)strcpy_s(info->deviceInfo.deviceName, sizeof(info->deviceInfo.deviceName), "benchmark device");
+    (void)strcpy_s(info->deviceInfo.unifiedName, sizeof(info->deviceInfo.unifiedName), "benchmark unified");
+    (void)strcpy_s(info->networkId, sizeof(info->networkId),
+        "2F1E0D9C8B7A69584736251403F2E1D0C9B8A79685746352413F2E1D0C9B8A79");
+    (void)strcpy_s(info->deviceInfo.deviceUdid, sizeof(info->deviceInfo.deviceUdid),
+        "8A5B2C4D6E8F0A1B3C5D7E9F0A2B4C6D8E0F1A3B5C7D9E0F2A4B6C8D0E1F3A5B");
+    (void)strcpy_s(info->uuid, sizeof(info->uuid), "1D2C3B4A59687F6E5D4C3B2A19087F6E5D4C3B2A19087F6E5D4C3B2A19087F6E");
+    (void)strcpy_s(info->connectInfo.macAddr, sizeof(info->connectInfo.macAddr), "11:22:33:44:55:66");
+    (void)strcpy_s(info->p2pInfo.p2pMac, sizeof(info->p2pInfo.p2pMac), "12:34:56:78:9a:bc");
+    (void)strcpy_s(info->p2pInfo.chanList5g, sizeof(info->p2pInfo.chanList5g), "36##40##44##48##149##153##157##161");
+    (void)strcpy_s(info->deviceInfo.osVersion, sizeof(info->deviceInfo.osVersion), "OpenHarmony 6.0");
+    (void)strcpy_s(info->accountUid, sizeof(info->accountUid), "123456789");
+    info->masterWeight = TEST_MASTER_WEIGHT;
+    info->deviceInfo.deviceTypeId = TEST_DEVICE_TYPE_ID;
+    info->deviceInfo.osType = OH_OS_TYPE;
+    info->netCapacity = DEFAULT_STATIC_NET_CAP;
+    info->staticNetCap = DEFAULT_STATIC_NET_CAP;
+    info->feature = TEST_FEATURE;
+    info->accountId = TEST_ACCOUNT_ID;
+    info->wifiBuffSize = DEFAULT_WIFI_BUFF_SIZE;
+    info->brBuffSize = DEFAULT_BR_BUFF_SIZE;
+    info->p2pInfo.p2pRole = -1;
+    info->p2pInfo.staFrequency = -1;
+    info->isScreenOn = true;
+}
+
+static char *PackJsonMessage(const NodeInfo *info)
+{
+    JsonObj *json = JSON_CreateObject();
+    if (json == nullptr) {
+        return nullptr;
+    }
+    char *msg = nullptr;
+    if (PackCommon(json, info, SOFTBUS_NEW_V2, false) == SOFTBUS_OK) {
+        msg = JSON_PrintUnformatted(json);
+    }
+    JSON_Delete(json);
+    return msg;
+}
+
+static uint8_t *PackTlvMessage(const NodeInfo *info, uint32_t *len)
+{
+    JsonObj *json = JSON_CreateObject();
+    if (json == nullptr) {
+        return nullptr;
+    }
+    PackCommonExtension(json, info);
+    char *ext = JSON_PrintUnformatted(json);
+    JSON_Delete(json);
+    if (ext == nullptr) {
+        return nullptr;
+    }
+    DevInfoTlvOption option = { .version = SOFTBUS_NEW_V2, .isMetaAuth = false };
+    uint8_t *frame = nullptr;
+    if (PackDeviceInfoTlvFrame(info, &option, ext, &frame, len) != SOFTBUS_OK) {
+        frame = nullptr;
+    }
+    JSON_Free(ext);
+    return frame;
+}
+
+/**
+ * @tc.name: JsonPackTestCase
+ * @tc.desc: device info json pack Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: PackCommon normal operation
+ */
+static void JsonPackTestCase(benchmark::State &state)
+{
+    NodeInfo info;
+    BuildNodeInfo(&info);
+    size_t bytes = 0;
+    while (state.KeepRunning()) {
+        char *msg = PackJsonMessage(&info);
+        if (msg == nullptr) {
+            state.SkipWithError("JsonPackTestCase failed.");
+            break;
+        }
+        bytes = strlen(msg) + 1;
+        JSON_Free(msg);
+    }
+    state.counters["bytes"] = bytes;
+}
+BENCHMARK(JsonPackTestCase);
+
+/**
+ * @tc.name: TlvPackTestCase
+ * @tc.desc: device info tlv pack Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: PackDeviceInfoTlvFrame normal operation
+ */
+static void TlvPackTestCase(benchmark::State &state)
+{
+    NodeInfo info;
+    BuildNodeInfo(&info);
+    uint32_t bytes = 0;
+    while (state.KeepRunning()) {
+        uint8_t *frame = PackTlvMessage(&info, &bytes);
+        if (frame == nullptr) {
+            state.SkipWithError("TlvPackTestCase failed.");
+            break;
+        }
+        SoftBusFree(frame);
+    }
+    state.counters["bytes"] = bytes;
+}
+BENCHMARK(TlvPackTestCase);
+
+/**
+ * @tc.name: JsonUnpackTestCase
+ * @tc.desc: device info json unpack Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: UnpackCommon normal operation
+ */
+static void JsonUnpackTestCase(benchmark::State &state)
+{
+    NodeInfo info;
+    BuildNodeInfo(&info);
+    char *msg = PackJsonMessage(&info);
+    if (msg == nullptr) {
+        state.SkipWithError("JsonUnpackTestCase pack failed.");
+        return;
+    }
+    uint32_t len = strlen(msg) + 1;
+    while (state.KeepRunning()) {
+        JsonObj *json = JSON_Parse(msg, len);
+        if (json == nullptr) {
+            state.SkipWithError("JsonUnpackTestCase failed.");
+            break;
+        }
+        NodeInfo out;
+        (void)memset_s(&out, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+        UnpackCommon(json, &out, SOFTBUS_NEW_V2, false);
+        JSON_Delete(json);
+        benchmark::DoNotOptimize(out.feature);
+    }
+    JSON_Free(msg);
+}
+BENCHMARK(JsonUnpackTestCase);
+
+/**
+ * @tc.name: TlvUnpackTestCase
+ * @tc.desc: device info tlv unpack Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: UnpackDeviceInfoTlvFrame normal operation
+ */
+static void TlvUnpackTestCase(benchmark::State &state)
+{
+    NodeInfo info;
+    BuildNodeInfo(&info);
+    uint32_t len = 0;
+    uint8_t *frame = PackTlvMessage(&info, &len);
+    if (frame == nullptr) {
+        state.SkipWithError("TlvUnpackTestCase pack failed.");
+        return;
+    }
+    DevInfoTlvOption option = { .version = SOFTBUS_NEW_V2, .isMetaAuth = false };
+    while (state.KeepRunning()) {
+        NodeInfo out;
+        (void)memset_s(&out, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+        const char *ext = nullptr;
+        uint32_t extLen = 0;
+        if (UnpackDeviceInfoTlvFrame(frame, len, &option, &out, &ext, &extLen) != SOFTBUS_OK) {
+            state.SkipWithError("TlvUnpackTestCase failed.");
+            break;
+        }
+        JsonObj *json = JSON_Parse(ext, extLen);
+        if (json != nullptr) {
+            UnpackCommonExtension(json, &out);
+            JSON_Delete(json);
+        }
+        benchmark::DoNotOptimize(out.feature);
+    }
+    SoftBusFree(frame);
+}
+BENCHMARK(TlvUnpackTestCase);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
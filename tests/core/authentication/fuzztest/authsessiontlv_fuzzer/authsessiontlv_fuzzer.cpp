@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "authsessiontlv_fuzzer.h"
+#include <cstddef>
+#include <cstdlib>
+#include <cstring>
+#include <fuzzer/FuzzedDataProvider.h>
+#include <securec.h>
+#include <string>
+
+#include "auth_session_tlv.h"
+#include "softbus_adapter_mem.h"
+#include "softbus_error_code.h"
+
+namespace OHOS {
+static constexpr size_t MAX_EXT_LEN = 256;
+
+static void ConsumeString(FuzzedDataProvider &provider, char *buf, size_t bufLen)
+{
+    std::string str = provider.ConsumeRandomLengthString(bufLen - 1);
+    if (strcpy_s(buf, bufLen, str.c_str()) != EOK) {
+        buf[0] = '\0';
+    }
+}
+
+static void BuildNodeInfo(FuzzedDataProvider &provider, NodeInfo *info)
+{
+    ConsumeString(provider, info->networkId, sizeof(info->networkId));
+    ConsumeString(provider, info->masterUdid, sizeof(info->masterUdid));
+    ConsumeString(provider, info->versionType, sizeof(info->versionType));
+    ConsumeString(provider, info->accountUid, sizeof(info->accountUid));
+    ConsumeString(provider, info->p2pInfo.wifiCfg, sizeof(info->p2pInfo.wifiCfg));
+    info->netCapacity = provider.ConsumeIntegral<uint32_t>();
+    info->staticNetCap = provider.ConsumeIntegral<uint32_t>();
+    info->authCapacity = provider.ConsumeIntegral<uint32_t>();
+    info->masterWeight = provider.ConsumeIntegral<int32_t>();
+    info->wifiBuffSize = provider.ConsumeIntegral<int32_t>();
+    info->feature = provider.ConsumeIntegral<uint64_t>();
+    info->accountId = provider.ConsumeIntegral<int64_t>();
+    info->isScreenOn = provider.ConsumeBool();
+}
+
+static bool IsSameNodeInfo(const NodeInfo *info, const NodeInfo *out)
+{
+    return strcmp(info->networkId, out->networkId) == 0 && strcmp(info->masterUdid, out->masterUdid) == 0 &&
+        strcmp(info->versionType, out->versionType) == 0 && strcmp(info->accountUid, out->accountUid) == 0 &&
+        strcmp(info->p2pInfo.wifiCfg, out->p2pInfo.wifiCfg) == 0 && info->netCapacity == out->netCapacity &&
+        info->staticNetCap == out->staticNetCap && info->authCapacity == out->authCapacity &&
+        info->masterWeight == out->masterWeight && info->wifiBuffSize == out->wifiBuffSize &&
+        info->feature == out->feature && info->accountId == out->accountId && info->isScreenOn == out->isScreenOn;
+}
+
+void DeviceInfoTlvRoundTripFuzzTest(FuzzedDataProvider &provider)
+{
+    NodeInfo info;
+    (void)memset_s(&info, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+    BuildNodeInfo(provider, &info);
+    std::string ext = provider.ConsumeRandomLengthString(MAX_EXT_LEN);
+    DevInfoTlvOption option = { .version = SOFTBUS_NEW_V2, .isMetaAuth = false };
+    uint8_t *frame = nullptr;
+    uint32_t frameLen = 0;
+    if (PackDeviceInfoTlvFrame(&info, &option, ext.c_str(), &frame, &frameLen) != SOFTBUS_OK) {
+        return;
+    }
+    NodeInfo out;
+    (void)memset_s(&out, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+    const char *jsonExt = nullptr;
+    uint32_t jsonExtLen = 0;
+    if (!IsDeviceInfoTlvFrame(frame, frameLen) ||
+        UnpackDeviceInfoTlvFrame(frame, frameLen, &option, &out, &jsonExt, &jsonExtLen) != SOFTBUS_OK ||
+        !IsSameNodeInfo(&info, &out) || strcmp(jsonExt, ext.c_str()) != 0) {
+        SoftBusFree(frame);
+        abort();
+    }
+    SoftBusFree(frame);
+}
+
+void DeviceInfoTlvUnpackFuzzTest(const uint8_t *data, size_t size)
+{
+    if (!IsDeviceInfoTlvFrame(data, static_cast<uint32_t>(size))) {
+        return;
+    }
+    NodeInfo out;
+    (void)memset_s(&out, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+    DevInfoTlvOption option = { .version = SOFTBUS_NEW_V2, .isMetaAuth = false };
+    const char *jsonExt = nullptr;
+    uint32_t jsonExtLen = 0;
+    (void)UnpackDeviceInfoTlvFrame(data, static_cast<uint32_t>(size), &option, &out, &jsonExt, &jsonExtLen);
+}
+} // namespace OHOS
+
+/* Fuzzer entry point */
+extern "C" int32_t LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (data == nullptr || size == 0) {
+        return 0;
+    }
+    FuzzedDataProvider provider(data, size);
+    OHOS::DeviceInfoTlvRoundTripFuzzTest(provider);
+    OHOS::DeviceInfoTlvUnpackFuzzTest(data, size);
+    return 0;
+}
@@ -55,6 +55,26 @@ void DelDupAuthManager(AuthManager *auth)
     return GetAuthDeviceDepsIf()->DelDupAuthManager(auth);
 }
 
+const AuthManager *GetAuthManagerRef(int64_t authId)
+{
+    return GetAuthDeviceDepsIf()->GetAuthManagerRef(authId);
+}
+
+void PutAuthManagerRef(const AuthManager *auth)
+{
+    return GetAuthDeviceDepsIf()->PutAuthManagerRef(auth);
+}
+
+int32_t AuthManagerPeekLatestSessionKey(int64_t authId, AuthLinkType type, int32_t *index, SessionKey *key)
+{
+    return GetAuthDeviceDepsIf()->AuthManagerPeekLatestSessionKey(authId, type, index, key);
+}
+
+int32_t AuthManagerPeekSessionKeyByIndex(int64_t authId, int32_t index, AuthLinkType type, SessionKey *key)
+{
+    return GetAuthDeviceDepsIf()->AuthManagerPeekSessionKeyByIndex(authId, index, type, key);
+}
+
 void RemoveNotPassedAuthManagerByUdid(const char *udid)
 {
     return GetAuthDeviceDepsIf()->RemoveNotPassedAuthManagerByUdid(udid);
@@ -114,6 +134,18 @@ int32_t DecryptData(const SessionKeyList *list, AuthLinkType type, const InDataI
     return GetAuthDeviceDepsIf()->DecryptData(list, type, inDataInfo, outData, outLen);
 }
 
+int32_t EncryptDataByKey(int64_t authId, int32_t index, const SessionKey *key, const InDataInfo *inDataInfo,
+    uint8_t *outData, uint32_t *outLen)
+{
+    return GetAuthDeviceDepsIf()->EncryptDataByKey(authId, index, key, inDataInfo, outData, outLen);
+}
+
+int32_t DecryptDataByKey(int64_t authId, int32_t index, const SessionKey *key, const InDataInfo *inDataInfo,
+    uint8_t *outData, uint32_t *outLen)
+{
+    return GetAuthDeviceDepsIf()->DecryptDataByKey(authId, index, key, inDataInfo, outData, outLen);
+}
+
 uint32_t AuthGetDecryptSize(uint32_t inLen)
 {
     return GetAuthDeviceDepsIf()->AuthGetDecryptSize(inLen);
@@ -45,6 +45,12 @@ public:
 
     virtual AuthManager *GetAuthManagerByAuthId(int64_t authId) = 0;
     virtual void DelDupAuthManager(AuthManager *auth) = 0;
+    virtual const AuthManager *GetAuthManagerRef(int64_t authId) = 0;
+    virtual void PutAuthManagerRef(const AuthManager *auth) = 0;
+    virtual int32_t AuthManagerPeekLatestSessionKey(int64_t authId, AuthLinkType type, int32_t *index,
+        SessionKey *key) = 0;
+    virtual int32_t AuthManagerPeekSessionKeyByIndex(
+        int64_t authId, int32_t index, AuthLinkType type, SessionKey *key) = 0;
     virtual void RemoveNotPassedAuthManagerByUdid(const char *udid) = 0;
     virtual AuthManager *GetDeviceAuthManager(int64_t authSeq, const AuthSessionInfo *info,
         bool *isNewCreated, int64_t lastAuthSeq) = 0;
@@ -61,6 +67,10 @@ public:
         uint8_t *outData, uint32_t *outLen) = 0;
     virtual int32_t DecryptData(const SessionKeyList *list, AuthLinkType type, const InDataInfo *inDataInfo,
         uint8_t *outData, uint32_t *outLen) = 0;
+    virtual int32_t EncryptDataByKey(int64_t authId, int32_t index, const SessionKey *key,
+        const InDataInfo *inDataInfo, uint8_t *outData, uint32_t *outLen) = 0;
+    virtual int32_t DecryptDataByKey(int64_t authId, int32_t index, const SessionKey *key,
+        const InDataInfo *inDataInfo, uint8_t *outData, uint32_t *outLen) = 0;
     virtual uint32_t AuthGetDecryptSize(uint32_t inLen) = 0;
     virtual int32_t PostAuthData(uint64_t connId, bool toServer, const AuthDataHead *head, const uint8_t *data) = 0;
     virtual int32_t ConnectAuthDevice(uint32_t requestId, const AuthConnInfo *connInfo, ConnSideType sideType) = 0;
@@ -111,6 +121,10 @@ public:
 
     MOCK_METHOD1(GetAuthManagerByAuthId, AuthManager *(int64_t));
     MOCK_METHOD1(DelDupAuthManager, void(AuthManager *));
+    MOCK_METHOD1(GetAuthManagerRef, const AuthManager *(int64_t));
+    MOCK_METHOD1(PutAuthManagerRef, void(const AuthManager *));
+    MOCK_METHOD4(AuthManagerPeekLatestSessionKey, int32_t(int64_t, AuthLinkType, int32_t *, SessionKey *));
+    MOCK_METHOD4(AuthManagerPeekSessionKeyByIndex, int32_t(int64_t, int32_t, AuthLinkType, SessionKey *));
     MOCK_METHOD1(RemoveNotPassedAuthManagerByUdid, void(const char *));
     MOCK_METHOD4(GetDeviceAuthManager, AuthManager *(int64_t, const AuthSessionInfo *, bool *, int64_t));
     MOCK_METHOD1(GetLatestIdByConnInfo, int64_t(const AuthConnInfo *));
@@ -124,6 +138,10 @@ public:
         int32_t(const SessionKeyList *, AuthLinkType, const InDataInfo *, uint8_t **, uint32_t *));
     MOCK_METHOD5(EncryptData, int32_t(const SessionKeyList *, AuthLinkType, const InDataInfo *, uint8_t *, uint32_t *));
     MOCK_METHOD5(DecryptData, int32_t(const SessionKeyList *, AuthLinkType, const InDataInfo *, uint8_t *, uint32_t *));
+    MOCK_METHOD6(EncryptDataByKey,
+        int32_t(int64_t, int32_t, const SessionKey *, const InDataInfo *, uint8_t *, uint32_t *));
+    MOCK_METHOD6(DecryptDataByKey,
+        int32_t(int64_t, int32_t, const SessionKey *, const InDataInfo *, uint8_t *, uint32_t *));
     MOCK_METHOD1(AuthGetDecryptSize, uint32_t(uint32_t));
     MOCK_METHOD4(PostAuthData, int32_t(uint64_t, bool, const AuthDataHead *, const uint8_t *));
     MOCK_METHOD3(ConnectAuthDevice, int32_t(uint32_t, const AuthConnInfo *, ConnSideType));
@@ -29,6 +29,7 @@ using namespace testing::ext;
 constexpr int64_t TEST_AUTH_ID = 1;
 constexpr uint32_t TEST_REQUEST_ID = 100;
 constexpr uint64_t TEST_CURRENT_TIME = 1000000;
+constexpr uint32_t TEST_CIPHER_LEN = ENCRYPT_OVER_HEAD_LEN + 4;
 constexpr char TEST_UDID[] = "1234567890abcdef1234567890abcdef12345678";
 constexpr char TEST_UUID[] = "test_uuid_001";
 
@@ -499,7 +500,8 @@ HWTEST_F(AuthDeviceTest, AUTH_DEVICE_ENCRYPT_TEST_002, TestSize.Level1)
     uint8_t inData[] = "test";
     uint8_t outData[128] = {0};
     uint32_t outLen = sizeof(outData);
-    EXPECT_CALL(mock, GetAuthManagerByAuthId).WillOnce(Return(nullptr));
+    EXPECT_CALL(mock, AuthManagerPeekLatestSessionKey).WillOnce(Return(SOFTBUS_AUTH_NOT_FOUND));
+    EXPECT_CALL(mock, EncryptDataByKey).Times(0);
     int32_t ret = AuthDeviceEncrypt(&handle, inData, sizeof(inData), outData, &outLen);
     EXPECT_EQ(ret, SOFTBUS_AUTH_NOT_FOUND);
 }
@@ -513,18 +515,14 @@ HWTEST_F(AuthDeviceTest, AUTH_DEVICE_ENCRYPT_TEST_002, TestSize.Level1)
 HWTEST_F(AuthDeviceTest, AUTH_DEVICE_ENCRYPT_TEST_003, TestSize.Level1)
 {
     NiceMock<AuthDeviceDepsInterfaceMock> mock;
-    AuthManager *auth = CreateTestAuthManager(TEST_AUTH_ID);
-    ASSERT_NE(auth, nullptr);
     AuthHandle handle = { .authId = TEST_AUTH_ID, .type = AUTH_LINK_TYPE_WIFI };
     uint8_t inData[] = "test";
     uint8_t outData[128] = {0};
     uint32_t outLen = sizeof(outData);
-    EXPECT_CALL(mock, GetAuthManagerByAuthId).WillOnce(Return(auth));
-    EXPECT_CALL(mock, EncryptData).WillOnce(Return(SOFTBUS_ENCRYPT_ERR));
-    EXPECT_CALL(mock, DelDupAuthManager).Times(1);
+    EXPECT_CALL(mock, AuthManagerPeekLatestSessionKey).WillOnce(Return(SOFTBUS_OK));
+    EXPECT_CALL(mock, EncryptDataByKey).WillOnce(Return(SOFTBUS_ENCRYPT_ERR));
     int32_t ret = AuthDeviceEncrypt(&handle, inData, sizeof(inData), outData, &outLen);
     EXPECT_EQ(ret, SOFTBUS_ENCRYPT_ERR);
-    SoftBusFree(auth);
 }
 
 /*
@@ -536,18 +534,14 @@ HWTEST_F(AuthDeviceTest, AUTH_DEVICE_ENCRYPT_TEST_003, TestSize.Level1)
 HWTEST_F(AuthDeviceTest, AUTH_DEVICE_ENCRYPT_TEST_004, TestSize.Level1)
 {
     NiceMock<AuthDeviceDepsInterfaceMock> mock;
-    AuthManager *auth = CreateTestAuthManager(TEST_AUTH_ID);
-    ASSERT_NE(auth, nullptr);
     AuthHandle handle = { .authId = TEST_AUTH_ID, .type = AUTH_LINK_TYPE_WIFI };
     uint8_t inData[] = "test";
     uint8_t outData[128] = {0};
     uint32_t outLen = sizeof(outData);
-    EXPECT_CALL(mock, GetAuthManagerByAuthId).WillOnce(Return(auth));
-    EXPECT_CALL(mock, EncryptData).WillOnce(Return(SOFTBUS_OK));
-    EXPECT_CALL(mock, DelDupAuthManager).Times(1);
+    EXPECT_CALL(mock, AuthManagerPeekLatestSessionKey).WillOnce(Return(SOFTBUS_OK));
+    EXPECT_CALL(mock, EncryptDataByKey).WillOnce(Return(SOFTBUS_OK));
     int32_t ret = AuthDeviceEncrypt(&handle, inData, sizeof(inData), outData, &outLen);
     EXPECT_EQ(ret, SOFTBUS_OK);
-    SoftBusFree(auth);
 }
 
 /*
@@ -576,13 +570,15 @@ HWTEST_F(AuthDeviceTest, AUTH_DEVICE_DECRYPT_TEST_002, TestSize.Level1)
 {
     NiceMock<AuthDeviceDepsInterfaceMock> mock;
     AuthHandle handle = { .authId = TEST_AUTH_ID, .type = AUTH_LINK_TYPE_WIFI };
-    uint8_t inData[] = "test";
+    uint8_t inData[TEST_CIPHER_LEN] = {0};
     uint8_t outData[128] = {0};
     uint32_t outLen = sizeof(outData);
-    EXPECT_CALL(mock, AuthGetDecryptSize).WillOnce(Return(sizeof(outData)));
-    EXPECT_CALL(mock, GetAuthManagerByAuthId).WillOnce(Return(nullptr));
+    EXPECT_CALL(mock, AuthManagerPeekSessionKeyByIndex).WillOnce(Return(SOFTBUS_AUTH_NOT_FOUND));
     int32_t ret = AuthDeviceDecrypt(&handle, inData, sizeof(inData), outData, &outLen);
     EXPECT_EQ(ret, SOFTBUS_AUTH_NOT_FOUND);
+    EXPECT_CALL(mock, GetAuthManagerRef).WillOnce(Return(nullptr));
+    ret = AuthDeviceDecrypt(&handle, inData, ENCRYPT_OVER_HEAD_LEN, outData, &outLen);
+    EXPECT_EQ(ret, SOFTBUS_AUTH_NOT_FOUND);
 }
 
 /*
@@ -594,43 +590,34 @@ HWTEST_F(AuthDeviceTest, AUTH_DEVICE_DECRYPT_TEST_002, TestSize.Level1)
 HWTEST_F(AuthDeviceTest, AUTH_DEVICE_DECRYPT_TEST_003, TestSize.Level1)
 {
     NiceMock<AuthDeviceDepsInterfaceMock> mock;
-    AuthManager *auth = CreateTestAuthManager(TEST_AUTH_ID);
-    ASSERT_NE(auth, nullptr);
     AuthHandle handle = { .authId = TEST_AUTH_ID, .type = AUTH_LINK_TYPE_WIFI };
-    uint8_t inData[] = "test";
+    uint8_t inData[TEST_CIPHER_LEN] = {0};
     uint8_t outData[128] = {0};
     uint32_t outLen = sizeof(outData);
-    EXPECT_CALL(mock, AuthGetDecryptSize).WillOnce(Return(sizeof(outData)));
-    EXPECT_CALL(mock, GetAuthManagerByAuthId).WillOnce(Return(auth));
-    EXPECT_CALL(mock, DecryptData).WillOnce(Return(SOFTBUS_ENCRYPT_ERR));
-    EXPECT_CALL(mock, DelDupAuthManager).Times(1);
+    EXPECT_CALL(mock, AuthManagerPeekSessionKeyByIndex).WillOnce(Return(SOFTBUS_OK));
+    EXPECT_CALL(mock, DecryptDataByKey).WillOnce(Return(SOFTBUS_ENCRYPT_ERR));
     int32_t ret = AuthDeviceDecrypt(&handle, inData, sizeof(inData), outData, &outLen);
     EXPECT_EQ(ret, SOFTBUS_ENCRYPT_ERR);
-    SoftBusFree(auth);
 }
 
 /*
  * @tc.name: AUTH_DEVICE_DECRYPT_TEST_004
- * @tc.desc: Test AuthDeviceDecrypt success
+ * @tc.desc: Test AuthDeviceDecrypt success, the key is looked up for the link type of the handle
  * @tc.type: FUNC
  * @tc.level: Level1
  */
 HWTEST_F(AuthDeviceTest, AUTH_DEVICE_DECRYPT_TEST_004, TestSize.Level1)
 {
     NiceMock<AuthDeviceDepsInterfaceMock> mock;
-    AuthManager *auth = CreateTestAuthManager(TEST_AUTH_ID);
-    ASSERT_NE(auth, nullptr);
     AuthHandle handle = { .authId = TEST_AUTH_ID, .type = AUTH_LINK_TYPE_WIFI };
-    uint8_t inData[] = "test";
+    uint8_t inData[TEST_CIPHER_LEN] = {0};
     uint8_t outData[128] = {0};
     uint32_t outLen = sizeof(outData);
-    EXPECT_CALL(mock, AuthGetDecryptSize).WillOnce(Return(sizeof(outData)));
-    EXPECT_CALL(mock, GetAuthManagerByAuthId).WillOnce(Return(auth));
-    EXPECT_CALL(mock, DecryptData).WillOnce(Return(SOFTBUS_OK));
-    EXPECT_CALL(mock, DelDupAuthManager).Times(1);
+    EXPECT_CALL(mock, AuthManagerPeekSessionKeyByIndex(TEST_AUTH_ID, _, AUTH_LINK_TYPE_WIFI, _))
+        .WillOnce(Return(SOFTBUS_OK));
+    EXPECT_CALL(mock, DecryptDataByKey).WillOnce(Return(SOFTBUS_OK));
     int32_t ret = AuthDeviceDecrypt(&handle, inData, sizeof(inData), outData, &outLen);
     EXPECT_EQ(ret, SOFTBUS_OK);
-    SoftBusFree(auth);
 }
 
 /*
@@ -718,7 +705,7 @@ HWTEST_F(AuthDeviceTest, AUTH_DEVICE_GET_SERVER_SIDE_TEST_002, TestSize.Level1)
 {
     NiceMock<AuthDeviceDepsInterfaceMock> mock;
     bool isServer = false;
-    EXPECT_CALL(mock, GetAuthManagerByAuthId).WillOnce(Return(nullptr));
+    EXPECT_CALL(mock, GetAuthManagerRef).WillOnce(Return(nullptr));
     EXPECT_EQ(AuthDeviceGetServerSide(TEST_AUTH_ID, &isServer), SOFTBUS_AUTH_NOT_FOUND);
 }
 
@@ -734,8 +721,8 @@ HWTEST_F(AuthDeviceTest, AUTH_DEVICE_GET_SERVER_SIDE_TEST_003, TestSize.Level1)
     AuthManager *auth = CreateTestAuthManager(TEST_AUTH_ID, true);
     ASSERT_NE(auth, nullptr);
     bool isServer = false;
-    EXPECT_CALL(mock, GetAuthManagerByAuthId).WillOnce(Return(auth));
-    EXPECT_CALL(mock, DelDupAuthManager).Times(1);
+    EXPECT_CALL(mock, GetAuthManagerRef).WillOnce(Return(auth));
+    EXPECT_CALL(mock, PutAuthManagerRef(auth)).Times(1);
     int32_t ret = AuthDeviceGetServerSide(TEST_AUTH_ID, &isServer);
     EXPECT_EQ(ret, SOFTBUS_OK);
     EXPECT_TRUE(isServer);
@@ -808,7 +795,7 @@ HWTEST_F(AuthDeviceTest, AUTH_DEVICE_GET_VERSION_TEST_002, TestSize.Level1)
 {
     NiceMock<AuthDeviceDepsInterfaceMock> mock;
     SoftBusVersion version;
-    EXPECT_CALL(mock, GetAuthManagerByAuthId).WillOnce(Return(nullptr));
+    EXPECT_CALL(mock, GetAuthManagerRef).WillOnce(Return(nullptr));
     EXPECT_EQ(AuthDeviceGetVersion(TEST_AUTH_ID, &version), SOFTBUS_AUTH_NOT_FOUND);
 }
 
@@ -824,8 +811,8 @@ HWTEST_F(AuthDeviceTest, AUTH_DEVICE_GET_VERSION_TEST_003, TestSize.Level1)
     AuthManager *auth = CreateTestAuthManager(TEST_AUTH_ID);
     ASSERT_NE(auth, nullptr);
     SoftBusVersion version;
-    EXPECT_CALL(mock, GetAuthManagerByAuthId).WillOnce(Return(auth));
-    EXPECT_CALL(mock, DelDupAuthManager).Times(1);
+    EXPECT_CALL(mock, GetAuthManagerRef).WillOnce(Return(auth));
+    EXPECT_CALL(mock, PutAuthManagerRef(auth)).Times(1);
     int32_t ret = AuthDeviceGetVersion(TEST_AUTH_ID, &version);
     EXPECT_EQ(ret, SOFTBUS_OK);
     EXPECT_EQ(version, SOFTBUS_NEW_V1);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -1226,4 +1226,71 @@ HWTEST_F(AuthManagerTest, AUTH_DEVICE_GET_CONN_INFO_BY_TYPE_TEST_001, TestSize.L
     ret = AuthDeviceGetConnInfoByType(UUID_TEST, type, &connInfo);
     EXPECT_EQ(ret, SOFTBUS_AUTH_CONN_NOT_ACTIVE);
 }
+
+/*
+ * @tc.name: AUTH_MANAGER_REF_TEST_001
+ * @tc.desc: Verify that an auth manager removed while a handle is held stays readable and is freed
+ *           by the last PutAuthManagerRef, and that it can no longer be found by authId.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(AuthManagerTest, AUTH_MANAGER_REF_TEST_001, TestSize.Level1)
+{
+    AuthSessionInfo info;
+    EXPECT_NO_FATAL_FAILURE(SetAuthSessionInfo(&info, CONN_ID, true, AUTH_LINK_TYPE_WIFI));
+    AuthManager *auth = NewAuthManager(AUTH_SEQ_5, &info);
+    ASSERT_NE(auth, nullptr);
+    int64_t authId = auth->authId;
+    const AuthManager *ref = GetAuthManagerRef(authId);
+    ASSERT_EQ(ref, auth);
+    const AuthManager *ref1 = GetAuthManagerRef(authId);
+    ASSERT_EQ(ref1, auth);
+    EXPECT_NO_FATAL_FAILURE(DelAuthManager(auth, AUTH_LINK_TYPE_MAX));
+    EXPECT_EQ(GetAuthManagerRef(authId), nullptr);
+    EXPECT_EQ(FindAuthManagerByAuthId(authId), nullptr);
+    PutAuthManagerRef(ref1);
+    EXPECT_TRUE(ref->isServer);
+    EXPECT_EQ(ref->authId, authId);
+    PutAuthManagerRef(ref);
+}
+
+/*
+ * @tc.name: AUTH_MANAGER_PEEK_SESSION_KEY_TEST_001
+ * @tc.desc: Verify that session keys are copied out by authId without a duplicated auth manager, and
+ *           that a missing auth manager is reported as not found.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(AuthManagerTest, AUTH_MANAGER_PEEK_SESSION_KEY_TEST_001, TestSize.Level1)
+{
+    int32_t index = 0;
+    SessionKey key;
+    (void)memset_s(&key, sizeof(SessionKey), 0, sizeof(SessionKey));
+    EXPECT_EQ(AuthManagerPeekLatestSessionKey(AUTH_SEQ_5, AUTH_LINK_TYPE_WIFI, &index, &key),
+        SOFTBUS_AUTH_NOT_FOUND);
+    EXPECT_EQ(AuthManagerPeekSessionKeyByIndex(AUTH_SEQ_5, KEY_INDEX, AUTH_LINK_TYPE_WIFI, &key),
+        SOFTBUS_AUTH_NOT_FOUND);
+    AuthSessionInfo info;
+    EXPECT_NO_FATAL_FAILURE(SetAuthSessionInfo(&info, CONN_ID, false, AUTH_LINK_TYPE_WIFI));
+    AuthManager *auth = NewAuthManager(AUTH_SEQ_5, &info);
+    ASSERT_NE(auth, nullptr);
+    SessionKey sessionKey = { .len = KEY_VALUE_LEN };
+    EXPECT_EQ(memcpy_s(sessionKey.value, SESSION_KEY_LENGTH, KEY_VALUE, KEY_VALUE_LEN), EOK);
+    EXPECT_EQ(AddSessionKey(&auth->sessionKeyList, KEY_INDEX, &sessionKey, AUTH_LINK_TYPE_WIFI, false), SOFTBUS_OK);
+    EXPECT_EQ(SetSessionKeyAvailable(&auth->sessionKeyList, KEY_INDEX), SOFTBUS_OK);
+    EXPECT_EQ(AuthManagerPeekLatestSessionKey(auth->authId, AUTH_LINK_TYPE_WIFI, &index, &key), SOFTBUS_OK);
+    EXPECT_EQ(index, KEY_INDEX);
+    EXPECT_EQ(key.len, sessionKey.len);
+    EXPECT_EQ(memcmp(key.value, sessionKey.value, sessionKey.len), 0);
+    (void)memset_s(&key, sizeof(SessionKey), 0, sizeof(SessionKey));
+    EXPECT_EQ(AuthManagerPeekSessionKeyByIndex(auth->authId, KEY_INDEX, AUTH_LINK_TYPE_WIFI, &key), SOFTBUS_OK);
+    EXPECT_EQ(memcmp(key.value, sessionKey.value, sessionKey.len), 0);
+    EXPECT_EQ(AuthManagerPeekSessionKeyByIndex(auth->authId, KEY_INDEX + 1, AUTH_LINK_TYPE_WIFI, &key),
+        SOFTBUS_AUTH_SESSION_KEY_NOT_FOUND);
+    EXPECT_EQ(AuthManagerPeekSessionKeyByIndex(auth->authId, KEY_INDEX, AUTH_LINK_TYPE_MAX, &key),
+        SOFTBUS_INVALID_PARAM);
+    EXPECT_NO_FATAL_FAILURE(DelAuthManager(auth, AUTH_LINK_TYPE_MAX));
+}
 } // namespace OHOS
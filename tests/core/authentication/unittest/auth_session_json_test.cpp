@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -45,6 +45,9 @@ constexpr uint8_t STATIC_CAPABILITY[STATIC_CAP_LEN] = "staticCapability";
 constexpr char REMOTE_PTK[PTK_DEFAULT_LEN] = "remotePtktest";
 constexpr char KEY_TEST[SESSION_KEY_LENGTH] = "123456keytest";
 constexpr char TEST_DATA[] = "testdata";
+constexpr uint64_t TEST_FEATURE = 0x3F7EULL;
+constexpr int32_t TEST_WIFI_BUFF_SIZE = 32768;
+constexpr int32_t TEST_BR_BUFF_SIZE = 4096;
 
 class AuthSessionJsonTest : public testing::Test {
 public:
@@ -930,4 +933,72 @@ HWTEST_F(AuthSessionJsonTest, GenerateUdidShortHash_TEST_001, TestSize.Level1)
     EXPECT_TRUE(GenerateUdidShortHash(udid, udidHashHexStr, SHA_256_HEX_HASH_LEN));
     EXPECT_TRUE(!GenerateUdidShortHash(udid, udidHashHexStr, 10));
 }
+
+/*
+ * @tc.name: DEVICE_INFO_TLV_FRAME_TEST_001
+ * @tc.desc: device info tlv frame pack and unpack test
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(AuthSessionJsonTest, DEVICE_INFO_TLV_FRAME_TEST_001, TestSize.Level1)
+{
+    NodeInfo info;
+    (void)memset_s(&info, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+    EXPECT_EQ(EOK, strcpy_s(info.networkId, NETWORK_ID_BUF_LEN, NETWORK_ID_TEST));
+    EXPECT_EQ(EOK, strcpy_s(info.deviceInfo.deviceName, DEVICE_NAME_BUF_LEN, DEVICE_NAME_TEST));
+    EXPECT_EQ(EOK, strcpy_s(info.connectInfo.macAddr, MAC_LEN, "aa:bb:cc:dd:ee:ff"));
+    info.feature = TEST_FEATURE;
+    info.masterWeight = DEFAULT_NODE_WEIGHT;
+    info.p2pInfo.p2pRole = -1;
+    DevInfoTlvOption option = { .version = SOFTBUS_NEW_V1, .isMetaAuth = false };
+    uint8_t *frame = nullptr;
+    uint32_t frameLen = 0;
+    EXPECT_EQ(SOFTBUS_INVALID_PARAM, PackDeviceInfoTlvFrame(nullptr, &option, "{}", &frame, &frameLen));
+    EXPECT_EQ(SOFTBUS_OK, PackDeviceInfoTlvFrame(&info, &option, "{}", &frame, &frameLen));
+    ASSERT_NE(frame, nullptr);
+    EXPECT_TRUE(IsDeviceInfoTlvFrame(frame, frameLen));
+    EXPECT_FALSE(IsDeviceInfoTlvFrame(reinterpret_cast<const uint8_t *>(TEST_DATA), sizeof(TEST_DATA)));
+    NodeInfo out;
+    (void)memset_s(&out, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+    const char *jsonExt = nullptr;
+    uint32_t jsonExtLen = 0;
+    EXPECT_EQ(SOFTBUS_OK, UnpackDeviceInfoTlvFrame(frame, frameLen, &option, &out, &jsonExt, &jsonExtLen));
+    EXPECT_STREQ(out.networkId, NETWORK_ID_TEST);
+    EXPECT_STREQ(out.deviceInfo.deviceName, DEVICE_NAME_TEST);
+    EXPECT_STREQ(out.connectInfo.macAddr, "AA:BB:CC:DD:EE:FF");
+    EXPECT_STREQ(out.nodeAddress, NODE_ADDR_LOOPBACK);
+    EXPECT_STREQ(jsonExt, "{}");
+    EXPECT_EQ(out.feature, TEST_FEATURE);
+    EXPECT_EQ(out.masterWeight, DEFAULT_NODE_WEIGHT);
+    EXPECT_EQ(out.staticNetCap, info.staticNetCap);
+    EXPECT_EQ(out.p2pInfo.p2pRole, -1);
+    EXPECT_NE(SOFTBUS_OK, UnpackDeviceInfoTlvFrame(frame, frameLen - 1, &option, &out, &jsonExt, &jsonExtLen));
+    SoftBusFree(frame);
+}
+/*
+ * @tc.name: DEVICE_INFO_JSON_COMMON_TEST_001
+ * @tc.desc: common json fields shared by the json and tlv device info paths test
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(AuthSessionJsonTest, DEVICE_INFO_JSON_COMMON_TEST_001, TestSize.Level1)
+{
+    NiceMock<AuthSessionJsonInterfaceMock> mock;
+    NodeInfo info;
+    (void)memset_s(&info, sizeof(NodeInfo), 0, sizeof(NodeInfo));
+    JsonObj *json = JSON_CreateObject();
+    ASSERT_NE(json, nullptr);
+    PackCommonExtension(json, &info);
+    bool distributedSwitch = false;
+    EXPECT_TRUE(JSON_GetBoolFromOject(json, DISTRIBUTED_SWITCH, &distributedSwitch));
+    EXPECT_TRUE(distributedSwitch);
+    EXPECT_TRUE(JSON_AddInt32ToObject(json, WIFI_BUFF_SIZE, TEST_WIFI_BUFF_SIZE));
+    EXPECT_TRUE(JSON_AddInt32ToObject(json, BR_BUFF_SIZE, TEST_BR_BUFF_SIZE));
+    ParseCommonJsonOptInfo(json, &info);
+    EXPECT_EQ(info.wifiBuffSize, TEST_WIFI_BUFF_SIZE);
+    EXPECT_EQ(info.brBuffSize, TEST_BR_BUFF_SIZE);
+    JSON_Delete(json);
+}
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -13,10 +13,12 @@
  * limitations under the License.
  */
 
+#include <atomic>
 #include <cinttypes>
 #include <gtest/gtest.h>
 #include <securec.h>
 #include <sys/time.h>
+#include <thread>
 
 #include "auth_common.h"
 #include "auth_session_key.h"
@@ -28,6 +30,8 @@ using namespace testing::ext;
 constexpr uint32_t SESSIONKEY_LEN = 32;
 constexpr int32_t SESSIONKEY_INDEX = 1;
 constexpr int32_t SESSIONKEY_INDEX2 = 2;
+constexpr int64_t CIPHER_AUTH_ID = 100;
+constexpr uint32_t CIPHER_LOOP_NUM = 10;
 
 class AuthSessionKeyTest : public testing::Test {
 public:
@@ -1724,4 +1728,130 @@ HWTEST_F(AuthSessionKeyTest, GET_SESSION_KEY_TYPE_EMPTY_LIST_TEST_001, TestSize.
     AuthLinkType type = GetSessionKeyTypeByIndex(&list_, SESSIONKEY_INDEX);
     EXPECT_EQ(type, AUTH_LINK_TYPE_MAX);
 }
+
+/*
+ * @tc.name: SESSION_KEY_CIPHER_CACHE_TEST_001
+ * @tc.desc: Test data encrypted with the cached cipher ctx is compatible with the session key list path.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(AuthSessionKeyTest, SESSION_KEY_CIPHER_CACHE_TEST_001, TestSize.Level1)
+{
+    EXPECT_EQ(InitSessionKeyCipherCache(), SOFTBUS_OK);
+    SessionKey sessionKey = { { 1, 2, 3, 4 }, SESSIONKEY_LEN };
+    EXPECT_NO_FATAL_FAILURE(InitSessionKeyList(&list_));
+    EXPECT_EQ(AddSessionKey(&list_, SESSIONKEY_INDEX, &sessionKey, AUTH_LINK_TYPE_WIFI, false), SOFTBUS_OK);
+    EXPECT_EQ(SetSessionKeyAvailable(&list_, SESSIONKEY_INDEX), SOFTBUS_OK);
+
+    const char *plainText = "cipher cache";
+    uint32_t plainLen = static_cast<uint32_t>(strlen(plainText)) + 1;
+    uint8_t encData[SESSIONKEY_LEN + ENCRYPT_OVER_HEAD_LEN] = { 0 };
+    uint8_t decData[SESSIONKEY_LEN] = { 0 };
+    for (uint32_t i = 0; i < CIPHER_LOOP_NUM; i++) {
+        InDataInfo inDataInfo = { reinterpret_cast<const uint8_t *>(plainText), plainLen };
+        uint32_t encLen = sizeof(encData);
+        EXPECT_EQ(EncryptDataByKey(CIPHER_AUTH_ID, SESSIONKEY_INDEX, &sessionKey, &inDataInfo, encData, &encLen),
+            SOFTBUS_OK);
+        EXPECT_EQ(encLen, plainLen + ENCRYPT_OVER_HEAD_LEN);
+        InDataInfo encInfo = { encData, encLen };
+        uint32_t decLen = sizeof(decData);
+        EXPECT_EQ(DecryptData(&list_, AUTH_LINK_TYPE_WIFI, &encInfo, decData, &decLen), SOFTBUS_OK);
+        EXPECT_EQ(decLen, plainLen);
+        EXPECT_STREQ(reinterpret_cast<const char *>(decData), plainText);
+
+        encLen = sizeof(encData);
+        EXPECT_EQ(EncryptData(&list_, AUTH_LINK_TYPE_WIFI, &inDataInfo, encData, &encLen), SOFTBUS_OK);
+        decLen = sizeof(decData);
+        (void)memset_s(decData, sizeof(decData), 0, sizeof(decData));
+        EXPECT_EQ(DecryptDataByKey(CIPHER_AUTH_ID, SESSIONKEY_INDEX, &sessionKey, &encInfo, decData, &decLen),
+            SOFTBUS_OK);
+        EXPECT_STREQ(reinterpret_cast<const char *>(decData), plainText);
+    }
+    DeinitSessionKeyCipherCache();
+}
+
+/*
+ * @tc.name: SESSION_KEY_CIPHER_CACHE_TEST_002
+ * @tc.desc: Test the cached cipher ctx is dropped when the key of the index changes or the auth is cleared.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(AuthSessionKeyTest, SESSION_KEY_CIPHER_CACHE_TEST_002, TestSize.Level1)
+{
+    EXPECT_EQ(InitSessionKeyCipherCache(), SOFTBUS_OK);
+    SessionKey oldKey = { { 1, 1, 1, 1 }, SESSIONKEY_LEN };
+    SessionKey newKey = { { 2, 2, 2, 2 }, SESSIONKEY_LEN };
+    const char *plainText = "cipher cache";
+    uint32_t plainLen = static_cast<uint32_t>(strlen(plainText)) + 1;
+    InDataInfo inDataInfo = { reinterpret_cast<const uint8_t *>(plainText), plainLen };
+    uint8_t encData[SESSIONKEY_LEN + ENCRYPT_OVER_HEAD_LEN] = { 0 };
+    uint8_t decData[SESSIONKEY_LEN] = { 0 };
+    uint32_t encLen = sizeof(encData);
+    EXPECT_EQ(EncryptDataByKey(CIPHER_AUTH_ID, SESSIONKEY_INDEX, &oldKey, &inDataInfo, encData, &encLen),
+        SOFTBUS_OK);
+    InDataInfo encInfo = { encData, encLen };
+    uint32_t decLen = sizeof(decData);
+    EXPECT_NE(DecryptDataByKey(CIPHER_AUTH_ID, SESSIONKEY_INDEX, &newKey, &encInfo, decData, &decLen), SOFTBUS_OK);
+    ClearSessionKeyCipherCache(CIPHER_AUTH_ID);
+    decLen = sizeof(decData);
+    EXPECT_EQ(DecryptDataByKey(CIPHER_AUTH_ID, SESSIONKEY_INDEX, &oldKey, &encInfo, decData, &decLen), SOFTBUS_OK);
+    EXPECT_STREQ(reinterpret_cast<const char *>(decData), plainText);
+    encLen = sizeof(encData);
+    EXPECT_EQ(EncryptDataByKey(CIPHER_AUTH_ID, SESSIONKEY_INDEX, &oldKey, &inDataInfo, nullptr, &encLen),
+        SOFTBUS_INVALID_PARAM);
+    decLen = sizeof(decData);
+    encInfo.inLen = ENCRYPT_OVER_HEAD_LEN;
+    EXPECT_EQ(DecryptDataByKey(CIPHER_AUTH_ID, SESSIONKEY_INDEX, &oldKey, &encInfo, decData, &decLen),
+        SOFTBUS_INVALID_PARAM);
+    DeinitSessionKeyCipherCache();
+    encLen = sizeof(encData);
+    EXPECT_EQ(EncryptDataByKey(CIPHER_AUTH_ID, SESSIONKEY_INDEX, &oldKey, &inDataInfo, encData, &encLen),
+        SOFTBUS_OK);
+}
+
+/*
+ * @tc.name: SESSION_KEY_CIPHER_CACHE_TEST_003
+ * @tc.desc: Test encrypt and decrypt keep working while the cipher cache is deinit and init again.
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(AuthSessionKeyTest, SESSION_KEY_CIPHER_CACHE_TEST_003, TestSize.Level1)
+{
+    EXPECT_EQ(InitSessionKeyCipherCache(), SOFTBUS_OK);
+    SessionKey sessionKey = { { 1, 2, 3, 4 }, SESSIONKEY_LEN };
+    const char *plainText = "cipher cache";
+    uint32_t plainLen = static_cast<uint32_t>(strlen(plainText)) + 1;
+    std::atomic<bool> isRunning(true);
+    std::atomic<uint32_t> failNum(0);
+    std::thread worker([&]() {
+        uint8_t encData[SESSIONKEY_LEN + ENCRYPT_OVER_HEAD_LEN] = { 0 };
+        uint8_t decData[SESSIONKEY_LEN] = { 0 };
+        while (isRunning.load()) {
+            InDataInfo inDataInfo = { reinterpret_cast<const uint8_t *>(plainText), plainLen };
+            uint32_t encLen = sizeof(encData);
+            if (EncryptDataByKey(CIPHER_AUTH_ID, SESSIONKEY_INDEX, &sessionKey, &inDataInfo, encData, &encLen) !=
+                SOFTBUS_OK) {
+                failNum++;
+                continue;
+            }
+            InDataInfo encInfo = { encData, encLen };
+            uint32_t decLen = sizeof(decData);
+            if (DecryptDataByKey(CIPHER_AUTH_ID, SESSIONKEY_INDEX, &sessionKey, &encInfo, decData, &decLen) !=
+                SOFTBUS_OK) {
+                failNum++;
+            }
+        }
+    });
+    for (uint32_t i = 0; i < CIPHER_LOOP_NUM; i++) {
+        DeinitSessionKeyCipherCache();
+        EXPECT_EQ(InitSessionKeyCipherCache(), SOFTBUS_OK);
+    }
+    isRunning = false;
+    worker.join();
+    EXPECT_EQ(failNum.load(), 0U);
+    DeinitSessionKeyCipherCache();
+}
 } // namespace OHOS
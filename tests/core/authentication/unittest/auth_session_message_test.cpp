@@ -1011,8 +1011,8 @@ HWTEST_F(AuthSessionMessageTest, GET_DUMP_SESSIONKEY_LIST_TEST_001, TestSize.Lev
     char data[TEST_DATA_LEN] = { 0 };
     InDataInfo inDataInfo;
     (void)memset_s(&inDataInfo, sizeof(InDataInfo), 0, sizeof(InDataInfo));
-    SetIndataInfo(&inDataInfo, nullptr, 0, data);
-    SetIndataInfo(&inDataInfo, nullptr, compressLen, data);
-    SetIndataInfo(&inDataInfo, compressData, 0, data);
+    SetIndataInfo(&inDataInfo, nullptr, 0, reinterpret_cast<uint8_t *>(data), TEST_DATA_LEN);
+    SetIndataInfo(&inDataInfo, nullptr, compressLen, reinterpret_cast<uint8_t *>(data), TEST_DATA_LEN);
+    SetIndataInfo(&inDataInfo, compressData, 0, reinterpret_cast<uint8_t *>(data), TEST_DATA_LEN);
 }
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -77,6 +77,11 @@ int32_t TransProxyPipelineCloseChannelDelay(int32_t channelId)
     return GetLaneLinkDepsInterface()->TransProxyPipelineCloseChannelDelay(channelId);
 }
 
+int32_t TransProxyPipelineCancelChannel(int32_t requestId)
+{
+    return GetLaneLinkDepsInterface()->TransProxyPipelineCancelChannel(requestId);
+}
+
 int32_t FindLaneResourceByLinkType(const char *peerUdid, LaneLinkType type, LaneResource *resource)
 {
     return GetLaneLinkDepsInterface()->FindLaneResourceByLinkType(peerUdid, type, resource);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -38,6 +38,7 @@ public:
         const TransProxyPipelineChannelOption *option, const ITransProxyPipelineCallback *callback) = 0;
     virtual int32_t TransProxyPipelineCloseChannel(int32_t channelId) = 0;
     virtual int32_t TransProxyPipelineCloseChannelDelay(int32_t channelId) = 0;
+    virtual int32_t TransProxyPipelineCancelChannel(int32_t requestId) = 0;
     virtual int32_t FindLaneResourceByLinkType(const char *peerUdid, LaneLinkType type, LaneResource *resource) = 0;
     virtual int32_t LaneDetectReliability(uint32_t laneReqId, const LaneLinkInfo *linkInfo,
         const LaneLinkCb *callback) = 0;
@@ -81,6 +82,7 @@ public:
         const TransProxyPipelineChannelOption *option, const ITransProxyPipelineCallback *callback));
     MOCK_METHOD1(TransProxyPipelineCloseChannel, int32_t (int32_t channelId));
     MOCK_METHOD1(TransProxyPipelineCloseChannelDelay, int32_t (int32_t channelId));
+    MOCK_METHOD1(TransProxyPipelineCancelChannel, int32_t (int32_t requestId));
     MOCK_METHOD3(FindLaneResourceByLinkType, int32_t (const char *peerUdid, LaneLinkType type,
         LaneResource *resource));
     MOCK_METHOD3(LaneDetectReliability, int32_t (uint32_t laneReqId, const LaneLinkInfo *linkInfo,
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2025-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -13,10 +13,15 @@
  * limitations under the License.
  */
 
+#include <atomic>
+#include <chrono>
+#include <functional>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <mutex>
 #include <securec.h>
 #include <thread>
+#include <vector>
 
 #include "g_enhance_lnn_func_pack.h"
 #include "lnn_lane_deps_mock.h"
@@ -52,6 +57,11 @@ constexpr int32_t LANE_REQUEST_ID = 0;
 constexpr uint32_t AUTH_REQUEST_ID = 1;
 constexpr uint32_t P2P_REQ_ID = 0;
 constexpr uint32_t NEW_P2P_REQ_ID = 1;
+constexpr int32_t RACE_CHANNEL_REQ_ID = 21;
+constexpr uint32_t RACE_FAST_LATENCY_MS = 20;
+constexpr uint32_t RACE_SLOW_LATENCY_MS = 600;
+constexpr uint32_t RACE_LATE_LATENCY_MS = 400;
+constexpr uint32_t RACE_WAIT_MS = 1000;
 
 static SoftBusCond g_cond = {0};
 static SoftBusMutex g_lock = {0};
@@ -1811,4 +1821,303 @@ HWTEST_F(LNNLaneLinkP2pTest, ON_WIFI_DIRECT_CONNECT_FAILURE_TEST_003, TestSize.L
     ret = DelP2pLinkReqByReqId(ASYNC_RESULT_P2P, P2P_REQ_ID);
     EXPECT_EQ(ret, SOFTBUS_OK);
 }
-}
\ No newline at end of file
+
+typedef struct {
+    uint32_t latencyMs;
+    bool isSucc;
+} FakeGuideTransport;
+
+static FakeGuideTransport g_fakeAuthTransport;
+static FakeGuideTransport g_fakeProxyTransport;
+static std::mutex g_fakeGuideLock;
+static std::vector<std::thread> g_fakeGuideThreads;
+static std::atomic<int32_t> g_raceConnectNum(0);
+static std::atomic<int32_t> g_raceNegoChannelType(-1);
+static std::atomic<int32_t> g_raceLinkFailNum(0);
+static std::atomic<uint64_t> g_raceConnectTime(0);
+static std::atomic<bool> g_fakeProxyCanceled(false);
+
+static void RunFakeGuideTransport(std::function<void(void)> complete, uint32_t latencyMs)
+{
+    std::lock_guard<std::mutex> guard(g_fakeGuideLock);
+    g_fakeGuideThreads.emplace_back([complete, latencyMs]() {
+        std::this_thread::sleep_for(std::chrono::milliseconds(latencyMs));
+        complete();
+    });
+}
+
+static void JoinFakeGuideTransports(void)
+{
+    std::this_thread::sleep_for(std::chrono::milliseconds(RACE_WAIT_MS));
+    std::vector<std::thread> threads;
+    {
+        std::lock_guard<std::mutex> guard(g_fakeGuideLock);
+        threads.swap(g_fakeGuideThreads);
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+static int32_t FakeAuthOpenConn(const AuthConnInfo *info, uint32_t requestId, const AuthConnCallback *callback,
+    bool isMeta)
+{
+    (void)info;
+    (void)isMeta;
+    AuthConnCallback cb = *callback;
+    bool isSucc = g_fakeAuthTransport.isSucc;
+    RunFakeGuideTransport([cb, requestId, isSucc]() {
+        if (isSucc) {
+            AuthHandle authHandle = { .authId = AUTHID, .type = AUTH_LINK_TYPE_WIFI };
+            cb.onConnOpened(requestId, authHandle);
+        } else {
+            cb.onConnOpenFailed(requestId, SOFTBUS_LANE_BUILD_LINK_FAIL);
+        }
+    }, g_fakeAuthTransport.latencyMs);
+    return SOFTBUS_OK;
+}
+
+static int32_t FakeProxyOpenChannel(int32_t requestId, const char *networkId,
+    const TransProxyPipelineChannelOption *option, const ITransProxyPipelineCallback *callback)
+{
+    (void)networkId;
+    (void)option;
+    ITransProxyPipelineCallback cb = *callback;
+    bool isSucc = g_fakeProxyTransport.isSucc;
+    RunFakeGuideTransport([cb, requestId, isSucc]() {
+        if (g_fakeProxyCanceled) {
+            return;
+        }
+        if (isSucc) {
+            cb.onChannelOpened(requestId, RACE_CHANNEL_REQ_ID);
+        } else {
+            cb.onChannelOpenFailed(requestId, SOFTBUS_LANE_BUILD_LINK_FAIL);
+        }
+    }, g_fakeProxyTransport.latencyMs);
+    return SOFTBUS_OK;
+}
+
+static int32_t FakeProxyCancelChannel(int32_t requestId)
+{
+    (void)requestId;
+    g_fakeProxyCanceled = true;
+    return SOFTBUS_OK;
+}
+
+static int32_t RaceConnectDevice(struct WifiDirectConnectInfo *info, struct WifiDirectConnectCallback *callback)
+{
+    (void)callback;
+    g_raceConnectTime = SoftBusGetSysTimeMs();
+    g_raceNegoChannelType = info->negoChannel.type;
+    g_raceConnectNum++;
+    return SOFTBUS_OK;
+}
+
+static void RaceLaneLinkFail(uint32_t reqId, int32_t reason, LaneLinkType linkType)
+{
+    (void)reqId;
+    (void)reason;
+    (void)linkType;
+    g_raceLinkFailNum++;
+}
+
+static struct WifiDirectManager g_raceManager = {
+    .isNegotiateChannelNeeded = nullptr,
+    .getRequestId = GetRequestId,
+    .connectDevice = RaceConnectDevice,
+    .cancelConnectDevice = nullptr,
+    .disconnectDevice = DisconnectDevice,
+    .supportHmlTwo = nullptr,
+};
+
+static void StartGuideChannelRace(FakeGuideTransport authTransport, FakeGuideTransport proxyTransport)
+{
+    g_fakeAuthTransport = authTransport;
+    g_fakeProxyTransport = proxyTransport;
+    g_raceConnectNum = 0;
+    g_raceNegoChannelType = -1;
+    g_raceLinkFailNum = 0;
+    g_raceConnectTime = 0;
+    g_fakeProxyCanceled = false;
+    WdGuideInfo guideInfo;
+    (void)memset_s(&guideInfo, sizeof(WdGuideInfo), 0, sizeof(WdGuideInfo));
+    guideInfo.laneReqId = LANEREQID;
+    guideInfo.request.linkType = LANE_HML;
+    guideInfo.request.triggerLinkTime = SoftBusGetSysTimeMs();
+    guideInfo.request.availableLinkTime = DEFAULT_LINK_LATENCY;
+    EXPECT_EQ(strcpy_s(guideInfo.request.peerNetworkId, NETWORK_ID_BUF_LEN, NODE_NETWORK_ID), EOK);
+    guideInfo.callback.onLaneLinkSuccess = TestLaneLinkSuccess;
+    guideInfo.callback.onLaneLinkFail = RaceLaneLinkFail;
+    guideInfo.guideList[0] = LANE_ACTIVE_AUTH_NEGO;
+    guideInfo.guideList[1] = LANE_PROXY_AUTH_NEGO;
+    guideInfo.guideNum = GUIDE_TYPE_NUMBERS_TWO;
+    guideInfo.raceNum = GetGuideChannelRaceNum(guideInfo.guideList, guideInfo.guideNum);
+    guideInfo.racingNum = 1;
+    EXPECT_EQ(guideInfo.raceNum, GUIDE_TYPE_NUMBERS_TWO);
+    EXPECT_EQ(AddGuideInfoItem(&guideInfo), SOFTBUS_OK);
+    BuildGuideChannel(LANEREQID, LANE_HML);
+}
+
+static void StopGuideChannelRace(void)
+{
+    JoinFakeGuideTransports();
+    (void)DelP2pLinkReqByReqId(ASYNC_RESULT_P2P, REQUEST_ID);
+    DelGuideInfoItem(LANEREQID, LANE_HML);
+}
+
+/*
+* @tc.name: GET_GUIDE_CHANNEL_RACE_NUM_TEST_001
+* @tc.desc: only leading negotiation guide channels are raced, at most GUIDE_CHANNEL_RACE_NUM_MAX
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(LNNLaneLinkP2pTest, GET_GUIDE_CHANNEL_RACE_NUM_TEST_001, TestSize.Level1)
+{
+    WdGuideType negoList[] = { LANE_ACTIVE_AUTH_NEGO, LANE_ACTIVE_BR_NEGO, LANE_PROXY_AUTH_NEGO };
+    EXPECT_EQ(GetGuideChannelRaceNum(negoList, GUIDE_TYPE_NUMBERS_THREE), GUIDE_CHANNEL_RACE_NUM_MAX);
+    EXPECT_EQ(GetGuideChannelRaceNum(negoList, GUIDE_TYPE_NUMBERS_ONE), 0);
+    WdGuideType triggerList[] = { LANE_ACTIVE_AUTH_TRIGGER, LANE_BLE_TRIGGER };
+    EXPECT_EQ(GetGuideChannelRaceNum(triggerList, GUIDE_TYPE_NUMBERS_TWO), 0);
+    WdGuideType mixedList[] = { LANE_ACTIVE_AUTH_NEGO, LANE_BLE_TRIGGER, LANE_PROXY_AUTH_NEGO };
+    EXPECT_EQ(GetGuideChannelRaceNum(mixedList, GUIDE_TYPE_NUMBERS_THREE), 0);
+}
+
+/*
+* @tc.name: GUIDE_CHANNEL_RACE_TEST_001
+* @tc.desc: the fast proxy channel started after the stagger delay wins, the slow auth conn is closed
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(LNNLaneLinkP2pTest, GUIDE_CHANNEL_RACE_TEST_001, TestSize.Level1)
+{
+    NiceMock<LaneDepsInterfaceMock> linkMock;
+    NiceMock<LaneLinkDepsInterfaceMock> laneLinkMock;
+    EXPECT_CALL(linkMock, GetWifiDirectManager).WillRepeatedly(Return(&g_raceManager));
+    EXPECT_CALL(linkMock, AuthGenRequestId).WillRepeatedly(Return(AUTH_REQ_ID));
+    EXPECT_CALL(linkMock, AuthOpenConn).WillOnce(FakeAuthOpenConn);
+    EXPECT_CALL(linkMock, AuthCloseConn).Times(1);
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineGenRequestId).WillRepeatedly(Return(REQID));
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineOpenChannel).WillOnce(FakeProxyOpenChannel);
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineCloseChannel).Times(0);
+
+    StartGuideChannelRace({ RACE_SLOW_LATENCY_MS, true }, { RACE_FAST_LATENCY_MS, true });
+    JoinFakeGuideTransports();
+    EXPECT_EQ(g_raceConnectNum, 1);
+    EXPECT_EQ(g_raceNegoChannelType, NEGO_CHANNEL_COC);
+    WdGuideType guideType = LANE_CHANNEL_BUTT;
+    EXPECT_EQ(GetCurrentGuideType(LANEREQID, LANE_HML, &guideType), SOFTBUS_OK);
+    EXPECT_EQ(guideType, LANE_PROXY_AUTH_NEGO);
+    P2pLinkReqList reqInfo;
+    (void)memset_s(&reqInfo, sizeof(P2pLinkReqList), 0, sizeof(P2pLinkReqList));
+    EXPECT_EQ(GetP2pLinkReqByReqId(ASYNC_RESULT_AUTH, AUTH_REQ_ID, &reqInfo), SOFTBUS_LANE_NOT_FOUND);
+    StopGuideChannelRace();
+}
+
+/*
+* @tc.name: GUIDE_CHANNEL_RACE_TEST_002
+* @tc.desc: a fast auth conn wins before the stagger delay, the proxy channel is never opened
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(LNNLaneLinkP2pTest, GUIDE_CHANNEL_RACE_TEST_002, TestSize.Level1)
+{
+    NiceMock<LaneDepsInterfaceMock> linkMock;
+    NiceMock<LaneLinkDepsInterfaceMock> laneLinkMock;
+    EXPECT_CALL(linkMock, GetWifiDirectManager).WillRepeatedly(Return(&g_raceManager));
+    EXPECT_CALL(linkMock, AuthGenRequestId).WillRepeatedly(Return(AUTH_REQ_ID));
+    EXPECT_CALL(linkMock, AuthOpenConn).WillOnce(FakeAuthOpenConn);
+    EXPECT_CALL(linkMock, AuthCloseConn).Times(0);
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineOpenChannel).Times(0);
+
+    StartGuideChannelRace({ RACE_FAST_LATENCY_MS, true }, { RACE_FAST_LATENCY_MS, true });
+    JoinFakeGuideTransports();
+    EXPECT_EQ(g_raceConnectNum, 1);
+    EXPECT_EQ(g_raceNegoChannelType, NEGO_CHANNEL_AUTH);
+    StopGuideChannelRace();
+}
+
+/*
+* @tc.name: GUIDE_CHANNEL_RACE_TEST_003
+* @tc.desc: a failed auth conn starts the proxy channel at once instead of waiting the stagger delay
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(LNNLaneLinkP2pTest, GUIDE_CHANNEL_RACE_TEST_003, TestSize.Level1)
+{
+    NiceMock<LaneDepsInterfaceMock> linkMock;
+    NiceMock<LaneLinkDepsInterfaceMock> laneLinkMock;
+    EXPECT_CALL(linkMock, GetWifiDirectManager).WillRepeatedly(Return(&g_raceManager));
+    EXPECT_CALL(linkMock, AuthGenRequestId).WillRepeatedly(Return(AUTH_REQ_ID));
+    EXPECT_CALL(linkMock, AuthOpenConn).WillOnce(FakeAuthOpenConn);
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineGenRequestId).WillRepeatedly(Return(REQID));
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineOpenChannel).WillOnce(FakeProxyOpenChannel);
+
+    uint64_t startTime = SoftBusGetSysTimeMs();
+    StartGuideChannelRace({ RACE_FAST_LATENCY_MS, false }, { RACE_FAST_LATENCY_MS, true });
+    JoinFakeGuideTransports();
+    EXPECT_EQ(g_raceConnectNum, 1);
+    EXPECT_EQ(g_raceNegoChannelType, NEGO_CHANNEL_COC);
+    EXPECT_LT(g_raceConnectTime - startTime, (uint64_t)GUIDE_CHANNEL_RACE_DELAY);
+    EXPECT_EQ(g_raceLinkFailNum, 0);
+    WdGuideInfo guideInfo;
+    (void)memset_s(&guideInfo, sizeof(WdGuideInfo), 0, sizeof(WdGuideInfo));
+    EXPECT_EQ(GetGuideInfo(LANEREQID, LANE_HML, &guideInfo), SOFTBUS_OK);
+    EXPECT_EQ(guideInfo.firstGuideErrCode, SOFTBUS_LANE_BUILD_LINK_FAIL);
+    StopGuideChannelRace();
+}
+
+/*
+* @tc.name: GUIDE_CHANNEL_RACE_TEST_004
+* @tc.desc: the lane link fails once after every raced guide channel failed
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(LNNLaneLinkP2pTest, GUIDE_CHANNEL_RACE_TEST_004, TestSize.Level1)
+{
+    NiceMock<LaneDepsInterfaceMock> linkMock;
+    NiceMock<LaneLinkDepsInterfaceMock> laneLinkMock;
+    EXPECT_CALL(linkMock, GetWifiDirectManager).WillRepeatedly(Return(&g_raceManager));
+    EXPECT_CALL(linkMock, AuthGenRequestId).WillRepeatedly(Return(AUTH_REQ_ID));
+    EXPECT_CALL(linkMock, AuthOpenConn).WillOnce(FakeAuthOpenConn);
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineGenRequestId).WillRepeatedly(Return(REQID));
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineOpenChannel).WillOnce(FakeProxyOpenChannel);
+
+    StartGuideChannelRace({ RACE_SLOW_LATENCY_MS, false }, { RACE_FAST_LATENCY_MS, false });
+    JoinFakeGuideTransports();
+    EXPECT_EQ(g_raceConnectNum, 0);
+    EXPECT_EQ(g_raceLinkFailNum, 1);
+    WdGuideInfo guideInfo;
+    (void)memset_s(&guideInfo, sizeof(WdGuideInfo), 0, sizeof(WdGuideInfo));
+    EXPECT_EQ(GetGuideInfo(LANEREQID, LANE_HML, &guideInfo), SOFTBUS_LANE_NOT_FOUND);
+    StopGuideChannelRace();
+}
+
+/*
+* @tc.name: GUIDE_CHANNEL_RACE_TEST_005
+* @tc.desc: the auth conn wins while the proxy channel is still opening, the proxy channel is cancelled
+* @tc.type: FUNC
+* @tc.require:
+*/
+HWTEST_F(LNNLaneLinkP2pTest, GUIDE_CHANNEL_RACE_TEST_005, TestSize.Level1)
+{
+    NiceMock<LaneDepsInterfaceMock> linkMock;
+    NiceMock<LaneLinkDepsInterfaceMock> laneLinkMock;
+    EXPECT_CALL(linkMock, GetWifiDirectManager).WillRepeatedly(Return(&g_raceManager));
+    EXPECT_CALL(linkMock, AuthGenRequestId).WillRepeatedly(Return(AUTH_REQ_ID));
+    EXPECT_CALL(linkMock, AuthOpenConn).WillOnce(FakeAuthOpenConn);
+    EXPECT_CALL(linkMock, AuthCloseConn).Times(0);
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineGenRequestId).WillRepeatedly(Return(REQID));
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineOpenChannel).WillOnce(FakeProxyOpenChannel);
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineCancelChannel(REQID)).WillOnce(FakeProxyCancelChannel);
+    EXPECT_CALL(laneLinkMock, TransProxyPipelineCloseChannel).Times(0);
+
+    StartGuideChannelRace({ RACE_LATE_LATENCY_MS, true }, { RACE_SLOW_LATENCY_MS, true });
+    JoinFakeGuideTransports();
+    EXPECT_EQ(g_raceConnectNum, 1);
+    EXPECT_EQ(g_raceNegoChannelType, NEGO_CHANNEL_AUTH);
+    P2pLinkReqList reqInfo;
+    (void)memset_s(&reqInfo, sizeof(P2pLinkReqList), 0, sizeof(P2pLinkReqList));
+    EXPECT_EQ(GetP2pLinkReqByReqId(ASYNC_RESULT_CHANNEL, REQID, &reqInfo), SOFTBUS_LANE_NOT_FOUND);
+    StopGuideChannelRace();
+}
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -31,6 +31,8 @@ public:
     virtual int32_t LnnUnregSyncInfoHandler(LnnSyncInfoType type, LnnSyncInfoMsgHandler handler);
     virtual int32_t LnnSendSyncInfoMsg(LnnSyncInfoType type, const char *networkId, const uint8_t *msg, uint32_t len,
         LnnSyncInfoMsgComplete complete) = 0;
+    virtual int32_t LnnSendSyncInfoMsgToPeers(LnnSyncInfoType type, const LnnSyncInfoPeerList *peerList,
+        const uint8_t *msg, uint32_t len) = 0;
     virtual int32_t LnnSendP2pSyncInfoMsg(const char *networkId, uint32_t netCapability) = 0;
 
     virtual void LnnSendAsyncInfoMsg(void *param) = 0;
@@ -47,6 +49,8 @@ public:
     MOCK_METHOD2(LnnUnregSyncInfoHandler, int32_t(LnnSyncInfoType, LnnSyncInfoMsgHandler));
     MOCK_METHOD5(
         LnnSendSyncInfoMsg, int32_t(LnnSyncInfoType, const char *, const uint8_t *, uint32_t, LnnSyncInfoMsgComplete));
+    MOCK_METHOD4(LnnSendSyncInfoMsgToPeers,
+        int32_t(LnnSyncInfoType, const LnnSyncInfoPeerList *, const uint8_t *, uint32_t));
     MOCK_METHOD2(LnnSendP2pSyncInfoMsg, int32_t(const char *, uint32_t));
 
     MOCK_METHOD1(LnnSendAsyncInfoMsg, void(void *));
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -40,6 +40,10 @@ constexpr uint64_t TIMES_STAP2 = 2;
 constexpr int32_t STATE_VERSION2 = 12;
 constexpr int32_t KEY_SIZE0 = 0;
 constexpr int32_t KEY_SIZE1 = 1;
+constexpr uint32_t REPLAY_DEVICE_NUM = 200;
+constexpr uint32_t REPLAY_FIELD_NAME_NUM = 20;
+constexpr uint32_t REPLAY_ROUND_NUM = 2;
+constexpr int32_t REPLAY_KEY_NUM = REPLAY_DEVICE_NUM * REPLAY_FIELD_NAME_NUM * REPLAY_ROUND_NUM;
 
 namespace OHOS {
 using namespace testing;
@@ -700,18 +704,19 @@ HWTEST_F(LNNDataCloudSyncMockTest, HandleDBAddChangeInternal_Test_001, TestSize.
         .stateVersion = STATE_VERSION2,
     };
     EXPECT_EQ(EOK, strcpy_s(localCaheInfo.deviceInfo.deviceUdid, UDID_BUF_LEN, PEERUDID));
-    NiceMock<LnnDataCloudSyncInterfaceMock> DataCloudSyncMock;
-    LnnEnhanceFuncList *pfnLnnEnhanceFuncList = LnnEnhanceFuncListGet();
-    pfnLnnEnhanceFuncList->lnnGetLocalCacheNodeInfo = LnnGetLocalCacheNodeInfo;
-    EXPECT_CALL(DataCloudSyncMock, LnnGetLocalCacheNodeInfo)
-        .WillOnce(Return(SOFTBUS_INVALID_PARAM))
-        .WillRepeatedly(DoAll(SetArgPointee<0>(localCaheInfo), Return(SOFTBUS_OK)));
     const char *key = "key1#key2#key3";
     const char *value = "value1#value2#value3";
+    CloudSyncField field;
+    (void)memset_s(&field, sizeof(CloudSyncField), 0, sizeof(CloudSyncField));
+    EXPECT_EQ(ParseCloudSyncField(key, value, &field), SOFTBUS_OK);
+    EXPECT_STREQ(field.deviceUdid, "key2");
+    EXPECT_STREQ(field.fieldName, "key3");
+    EXPECT_STREQ(field.trueValue, "value1");
     NodeInfo cacheInfo;
     (void)memset_s(&cacheInfo, sizeof(NodeInfo), 0, sizeof(NodeInfo));
-    EXPECT_EQ(HandleDBAddChangeInternal(key, value, &cacheInfo), SOFTBUS_INVALID_PARAM);
-    EXPECT_EQ(HandleDBAddChangeInternal(key, value, &cacheInfo), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(HandleDBAddChangeInternal(&field, &localCaheInfo, &cacheInfo), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(EOK, strcpy_s(field.deviceUdid, UDID_BUF_LEN, PEERUDID));
+    EXPECT_EQ(HandleDBAddChangeInternal(&field, &localCaheInfo, &cacheInfo), SOFTBUS_OK);
 }
 
 /*
@@ -724,10 +729,17 @@ HWTEST_F(LNNDataCloudSyncMockTest, HandleDBAddChangeInternal_Test_001, TestSize.
 HWTEST_F(LNNDataCloudSyncMockTest, HandleDBAddChangeInternal_Test_002, TestSize.Level1)
 {
     NodeInfo cacheInfo = { 0 };
-    int32_t ret = HandleDBAddChangeInternal(nullptr, nullptr, &cacheInfo);
+    NodeInfo localCaheInfo = { 0 };
+    CloudSyncField field;
+    (void)memset_s(&field, sizeof(CloudSyncField), 0, sizeof(CloudSyncField));
+    int32_t ret = ParseCloudSyncField(nullptr, nullptr, &field);
     EXPECT_EQ(ret, SOFTBUS_INVALID_PARAM);
     const char *key = "key";
-    ret = HandleDBAddChangeInternal(key, nullptr, &cacheInfo);
+    ret = ParseCloudSyncField(key, nullptr, &field);
+    EXPECT_EQ(ret, SOFTBUS_INVALID_PARAM);
+    ret = HandleDBAddChangeInternal(nullptr, &localCaheInfo, &cacheInfo);
+    EXPECT_EQ(ret, SOFTBUS_INVALID_PARAM);
+    ret = HandleDBAddChangeInternal(&field, nullptr, &cacheInfo);
     EXPECT_EQ(ret, SOFTBUS_INVALID_PARAM);
 }
 
@@ -1000,4 +1012,180 @@ HWTEST_F(LNNDataCloudSyncMockTest, LnnDeleteDevInfoSyncToDB_Test_001, TestSize.L
     EXPECT_EQ(ret, SOFTBUS_INVALID_PARAM);
 }
 
+static const char *g_replayFieldName[REPLAY_FIELD_NAME_NUM] = {
+    DEVICE_INFO_DEVICE_UDID, DEVICE_INFO_DEVICE_NAME, DEVICE_INFO_UNIFIED_DEVICE_NAME,
+    DEVICE_INFO_UNIFIED_DEFAULT_DEVICE_NAME, DEVICE_INFO_SETTINGS_NICK_NAME, DEVICE_INFO_DEVICE_TYPE,
+    DEVICE_INFO_OS_TYPE, DEVICE_INFO_OS_VERSION, DEVICE_INFO_DEVICE_UUID, DEVICE_INFO_STATE_VERSION,
+    DEVICE_INFO_TRANSPORT_PROTOCOL, DEVICE_INFO_WIFI_VERSION, DEVICE_INFO_BLE_VERSION, DEVICE_INFO_ACCOUNT_ID,
+    DEVICE_INFO_FEATURE, DEVICE_INFO_CONN_SUB_FEATURE, DEVICE_INFO_AUTH_CAP, DEVICE_INFO_NETWORK_ID,
+    DEVICE_INFO_PKG_VERSION, DEVICE_INFO_SW_VERSION,
+};
+
+/*
+ * a login burst: every field of every device is written twice, the kv store hands the fields over
+ * interleaved across devices and the second round carries the newer value
+ */
+static void BuildReplayKeyValue(const char ***key, const char ***value)
+{
+    *key = reinterpret_cast<const char **>(SoftBusCalloc(sizeof(char *) * REPLAY_KEY_NUM));
+    *value = reinterpret_cast<const char **>(SoftBusCalloc(sizeof(char *) * REPLAY_KEY_NUM));
+    ASSERT_TRUE(*key != nullptr && *value != nullptr);
+    int32_t index = 0;
+    for (uint32_t round = 0; round < REPLAY_ROUND_NUM; round++) {
+        for (uint32_t field = 0; field < REPLAY_FIELD_NAME_NUM; field++) {
+            for (uint32_t device = 0; device < REPLAY_DEVICE_NUM; device++) {
+                char *keyStr = reinterpret_cast<char *>(SoftBusCalloc(KEY_MAX_LEN));
+                char *valueStr = reinterpret_cast<char *>(SoftBusCalloc(PUT_VALUE_MAX_LEN));
+                ASSERT_TRUE(keyStr != nullptr && valueStr != nullptr);
+                char udid[UDID_BUF_LEN] = { 0 };
+                EXPECT_GT(sprintf_s(udid, UDID_BUF_LEN, "replayUdid%03u", device), 0);
+                EXPECT_GT(sprintf_s(keyStr, KEY_MAX_LEN, "0#%s#%s", udid, g_replayFieldName[field]), 0);
+                char trueValue[SPLIT_MAX_LEN] = { 0 };
+                if (strcmp(g_replayFieldName[field], DEVICE_INFO_DEVICE_UDID) == 0) {
+                    EXPECT_EQ(EOK, strcpy_s(trueValue, SPLIT_MAX_LEN, udid));
+                } else if (strcmp(g_replayFieldName[field], DEVICE_INFO_STATE_VERSION) == 0) {
+                    EXPECT_GT(sprintf_s(trueValue, SPLIT_MAX_LEN, "%u", round + 1), 0);
+                } else {
+                    EXPECT_GT(sprintf_s(trueValue, SPLIT_MAX_LEN, "value%u", round), 0);
+                }
+                EXPECT_GT(sprintf_s(valueStr, PUT_VALUE_MAX_LEN, "%s#%u#%u", trueValue, round + 1, round + 1), 0);
+                (*key)[index] = keyStr;
+                (*value)[index] = valueStr;
+                index++;
+            }
+        }
+    }
+}
+
+/*
+ * @tc.name: LnnDBDataAddChangeSyncToCache_Test_003
+ * @tc.desc: LnnDBDataAddChangeSyncToCache replays 200 devices x 20 fields written twice with one local
+ *           info fetch and one save and ledger update per device
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(LNNDataCloudSyncMockTest, LnnDBDataAddChangeSyncToCache_Test_003, TestSize.Level1)
+{
+    NodeInfo localCacheInfo = {
+        .stateVersion = STATE_VERSION2,
+    };
+    EXPECT_EQ(EOK, strcpy_s(localCacheInfo.deviceInfo.deviceUdid, UDID_BUF_LEN, PEERUDID));
+    LnnEnhanceFuncList *pfnLnnEnhanceFuncList = LnnEnhanceFuncListGet();
+    pfnLnnEnhanceFuncList->lnnGetLocalCacheNodeInfo = LnnGetLocalCacheNodeInfo;
+    pfnLnnEnhanceFuncList->lnnRetrieveDeviceInfo = LnnRetrieveDeviceInfo;
+    pfnLnnEnhanceFuncList->lnnSaveRemoteDeviceInfo = LnnSaveRemoteDeviceInfo;
+    NiceMock<LnnDataCloudSyncInterfaceMock> DataCloudSyncMock;
+    NiceMock<LnnNetLedgertInterfaceMock> NetLedgerMock;
+    EXPECT_CALL(DataCloudSyncMock, LnnGetLocalCacheNodeInfo)
+        .Times(1)
+        .WillOnce(DoAll(SetArgPointee<0>(localCacheInfo), Return(SOFTBUS_OK)));
+    EXPECT_CALL(DataCloudSyncMock, LnnGenerateHexStringHash)
+        .Times(REPLAY_DEVICE_NUM)
+        .WillRepeatedly(Return(SOFTBUS_OK));
+    EXPECT_CALL(DataCloudSyncMock, LnnRetrieveDeviceInfo)
+        .Times(REPLAY_DEVICE_NUM)
+        .WillRepeatedly(Return(SOFTBUS_NOT_FIND));
+    EXPECT_CALL(DataCloudSyncMock, LnnSaveRemoteDeviceInfo)
+        .Times(REPLAY_DEVICE_NUM)
+        .WillRepeatedly([](const NodeInfo *info) {
+            EXPECT_EQ(strncmp(info->deviceInfo.deviceUdid, "replayUdid", strlen("replayUdid")), 0);
+            EXPECT_STREQ(info->deviceInfo.deviceName, "value1");
+            EXPECT_EQ(info->stateVersion, static_cast<int32_t>(REPLAY_ROUND_NUM));
+            EXPECT_EQ(info->localStateVersion, STATE_VERSION2);
+            return SOFTBUS_OK;
+        });
+    EXPECT_CALL(NetLedgerMock, LnnUpdateDistributedNodeInfo)
+        .Times(REPLAY_DEVICE_NUM)
+        .WillRepeatedly(Return(SOFTBUS_OK));
+    const char **key = nullptr;
+    const char **value = nullptr;
+    BuildReplayKeyValue(&key, &value);
+    EXPECT_EQ(LnnDBDataAddChangeSyncToCache(key, value, REPLAY_KEY_NUM), SOFTBUS_OK);
+}
+
+/*
+ * @tc.name: LnnDBDataUpdateChangeSyncToCache_Test_001
+ * @tc.desc: LnnDBDataUpdateChangeSyncToCache replays 200 devices x 20 fields written twice with one
+ *           retrieve and save per device and sets each changed field to the ledger once
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(LNNDataCloudSyncMockTest, LnnDBDataUpdateChangeSyncToCache_Test_001, TestSize.Level1)
+{
+    NodeInfo localCacheInfo = {
+        .stateVersion = STATE_VERSION2,
+    };
+    EXPECT_EQ(EOK, strcpy_s(localCacheInfo.deviceInfo.deviceUdid, UDID_BUF_LEN, PEERUDID));
+    LnnEnhanceFuncList *pfnLnnEnhanceFuncList = LnnEnhanceFuncListGet();
+    pfnLnnEnhanceFuncList->lnnGetLocalCacheNodeInfo = LnnGetLocalCacheNodeInfo;
+    pfnLnnEnhanceFuncList->lnnRetrieveDeviceInfo = LnnRetrieveDeviceInfo;
+    pfnLnnEnhanceFuncList->lnnSaveRemoteDeviceInfo = LnnSaveRemoteDeviceInfo;
+    NiceMock<LnnDataCloudSyncInterfaceMock> DataCloudSyncMock;
+    NiceMock<LnnNetLedgertInterfaceMock> NetLedgerMock;
+    EXPECT_CALL(DataCloudSyncMock, LnnGetLocalCacheNodeInfo)
+        .Times(1)
+        .WillOnce(DoAll(SetArgPointee<0>(localCacheInfo), Return(SOFTBUS_OK)));
+    EXPECT_CALL(DataCloudSyncMock, LnnGenerateHexStringHash)
+        .Times(REPLAY_DEVICE_NUM)
+        .WillRepeatedly(Return(SOFTBUS_OK));
+    EXPECT_CALL(DataCloudSyncMock, LnnRetrieveDeviceInfo).Times(REPLAY_DEVICE_NUM).WillRepeatedly(Return(SOFTBUS_OK));
+    EXPECT_CALL(DataCloudSyncMock, LnnSaveRemoteDeviceInfo)
+        .Times(REPLAY_DEVICE_NUM)
+        .WillRepeatedly([](const NodeInfo *info) {
+            EXPECT_STREQ(info->deviceInfo.deviceName, "value1");
+            EXPECT_EQ(info->stateVersion, static_cast<int32_t>(REPLAY_ROUND_NUM));
+            EXPECT_EQ(info->localStateVersion, STATE_VERSION2);
+            return SOFTBUS_OK;
+        });
+    EXPECT_CALL(NetLedgerMock, LnnUpdateDistributedNodeInfo).Times(0);
+    EXPECT_CALL(NetLedgerMock, LnnSetDLDeviceInfoName).Times(REPLAY_DEVICE_NUM).WillRepeatedly(Return(true));
+    EXPECT_CALL(NetLedgerMock, LnnSetDLDeviceStateVersion)
+        .Times(REPLAY_DEVICE_NUM)
+        .WillRepeatedly(Return(SOFTBUS_OK));
+    EXPECT_CALL(DataCloudSyncMock, LnnUpdateNetworkId).Times(REPLAY_DEVICE_NUM).WillRepeatedly(Return(SOFTBUS_OK));
+    const char **key = nullptr;
+    const char **value = nullptr;
+    BuildReplayKeyValue(&key, &value);
+    EXPECT_EQ(LnnDBDataUpdateChangeSyncToCache(key, value, REPLAY_KEY_NUM), SOFTBUS_OK);
+    EXPECT_EQ(LnnDBDataUpdateChangeSyncToCache(nullptr, nullptr, REPLAY_KEY_NUM), SOFTBUS_INVALID_PARAM);
+}
+
+/*
+ * @tc.name: LnnDBDataUpdateChangeSyncToCache_Test_002
+ * @tc.desc: LnnDBDataUpdateChangeSyncToCache skips a malformed kv and still applies the rest of the batch
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(LNNDataCloudSyncMockTest, LnnDBDataUpdateChangeSyncToCache_Test_002, TestSize.Level1)
+{
+    NodeInfo localCacheInfo = {
+        .stateVersion = STATE_VERSION2,
+    };
+    EXPECT_EQ(EOK, strcpy_s(localCacheInfo.deviceInfo.deviceUdid, UDID_BUF_LEN, PEERUDID));
+    LnnEnhanceFuncList *pfnLnnEnhanceFuncList = LnnEnhanceFuncListGet();
+    pfnLnnEnhanceFuncList->lnnGetLocalCacheNodeInfo = LnnGetLocalCacheNodeInfo;
+    pfnLnnEnhanceFuncList->lnnRetrieveDeviceInfo = LnnRetrieveDeviceInfo;
+    pfnLnnEnhanceFuncList->lnnSaveRemoteDeviceInfo = LnnSaveRemoteDeviceInfo;
+    NiceMock<LnnDataCloudSyncInterfaceMock> DataCloudSyncMock;
+    NiceMock<LnnNetLedgertInterfaceMock> NetLedgerMock;
+    EXPECT_CALL(DataCloudSyncMock, LnnGetLocalCacheNodeInfo)
+        .WillOnce(DoAll(SetArgPointee<0>(localCacheInfo), Return(SOFTBUS_OK)));
+    EXPECT_CALL(DataCloudSyncMock, LnnGenerateHexStringHash).WillRepeatedly(Return(SOFTBUS_OK));
+    EXPECT_CALL(DataCloudSyncMock, LnnRetrieveDeviceInfo).Times(REPLAY_DEVICE_NUM).WillRepeatedly(Return(SOFTBUS_OK));
+    EXPECT_CALL(DataCloudSyncMock, LnnSaveRemoteDeviceInfo).Times(REPLAY_DEVICE_NUM).WillRepeatedly(Return(SOFTBUS_OK));
+    EXPECT_CALL(NetLedgerMock, LnnSetDLDeviceInfoName).WillRepeatedly(Return(true));
+    EXPECT_CALL(NetLedgerMock, LnnSetDLDeviceStateVersion).WillRepeatedly(Return(SOFTBUS_OK));
+    EXPECT_CALL(DataCloudSyncMock, LnnUpdateNetworkId).WillRepeatedly(Return(SOFTBUS_OK));
+    const char **key = nullptr;
+    const char **value = nullptr;
+    BuildReplayKeyValue(&key, &value);
+    SoftBusFree(const_cast<char *>(value[0]));
+    value[0] = reinterpret_cast<const char *>(SoftBusCalloc(PUT_VALUE_MAX_LEN));
+    ASSERT_TRUE(value[0] != nullptr);
+    EXPECT_EQ(EOK, strcpy_s(const_cast<char *>(value[0]), PUT_VALUE_MAX_LEN, "malformed"));
+    EXPECT_EQ(LnnDBDataUpdateChangeSyncToCache(key, value, REPLAY_KEY_NUM), SOFTBUS_OK);
+}
 } // namespace OHOS
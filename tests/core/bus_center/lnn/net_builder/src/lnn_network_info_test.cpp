@@ -307,8 +307,6 @@ HWTEST_F(LNNNetworkInfoTest, IS_NEED_TO_SEND_TEST_001, TestSize.Level1)
     EXPECT_CALL(netLedgerMock, LnnHasDiscoveryType).WillRepeatedly(Return(true));
     NiceMock<LnnServicetInterfaceMock> serviceMock;
     EXPECT_CALL(serviceMock, IsFeatureSupport).WillRepeatedly(Return(false));
-    NiceMock<LnnSyncInfoInterfaceMock> syncInfoMock;
-    EXPECT_CALL(syncInfoMock, LnnSendSyncInfoMsg).WillRepeatedly(Return(SOFTBUS_OK));
     NodeInfo nodeInfo;
     (void)memset_s(&nodeInfo, sizeof(NodeInfo), 0, sizeof(NodeInfo));
     NodeBasicInfo netInfo;
@@ -316,13 +314,11 @@ HWTEST_F(LNNNetworkInfoTest, IS_NEED_TO_SEND_TEST_001, TestSize.Level1)
     EXPECT_EQ(EOK, strcpy_s(netInfo.networkId, NETWORK_ID_BUF_LEN, NETWORKID));
     uint32_t netCapability = TYPE_0;
     uint32_t delCapability = TYPE_0;
-    uint32_t tmpMsg = TYPE_63;
-    uint8_t *msg = reinterpret_cast<uint8_t *>(&tmpMsg);
-    DoSendCapability(nodeInfo, netInfo, msg, netCapability, TYPE_8);
+    EXPECT_TRUE(DoSendCapability(&nodeInfo, &netInfo, netCapability, TYPE_8));
     EXPECT_CALL(serviceMock, IsFeatureSupport).WillRepeatedly(Return(true));
     EXPECT_CALL(serviceMock, LnnStartHbByTypeAndStrategy).WillRepeatedly(Return(SOFTBUS_OK));
-    DoSendCapability(nodeInfo, netInfo, msg, netCapability, TYPE_8);
-    DoSendCapability(nodeInfo, netInfo, msg, netCapability, TYPE_2);
+    DoSendCapability(&nodeInfo, &netInfo, netCapability, TYPE_8);
+    DoSendCapability(&nodeInfo, &netInfo, netCapability, TYPE_2);
     EXPECT_CALL(netLedgerMock, LnnSetNetCapability).WillRepeatedly(Return(SOFTBUS_OK));
     EXPECT_CALL(netLedgerMock, LnnClearNetCapability).WillRepeatedly(Return(SOFTBUS_OK));
     LnnClearNetBandCapability(&netCapability);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -15,6 +15,7 @@
 
 #include <gtest/gtest.h>
 #include <securec.h>
+#include <vector>
 
 #include "auth_interface.h"
 #include "distribute_net_ledger_mock.h"
@@ -2831,4 +2832,253 @@ HWTEST_F(LNNSyncInfoManagerTest, IsEnhancedP2pSupported_001, TestSize.Level1)
     EXPECT_EQ(IsEnhancedP2pSupported(NETWORKID), false);
     EXPECT_EQ(IsEnhancedP2pSupported(NETWORKID), true);
 }
+
+static constexpr int32_t SIM_PEER_NUM = 100;
+static constexpr int32_t SIM_CHANGE_NUM = 50;
+static constexpr int32_t SIM_CHANNEL_BASE = 1000;
+static constexpr LnnSyncInfoType SIM_TYPES[] = {
+    LNN_INFO_TYPE_CAPABILITY, LNN_INFO_TYPE_P2P_INFO, LNN_INFO_TYPE_WIFI_DIRECT };
+static constexpr int32_t SIM_TYPE_NUM = sizeof(SIM_TYPES) / sizeof(SIM_TYPES[0]);
+static int32_t g_simLastChange[LNN_INFO_TYPE_COUNT];
+static int32_t g_simRecvNum = 0;
+
+static void SimRecordHandler(LnnSyncInfoType type, const char *networkId, const uint8_t *msg, uint32_t len)
+{
+    (void)networkId;
+    if (len == sizeof(int32_t)) {
+        (void)memcpy_s(&g_simLastChange[type], sizeof(int32_t), msg, len);
+        g_simRecvNum++;
+    }
+}
+
+static void AddSimPeers(NodeBasicInfo *peers, int32_t num)
+{
+    for (int32_t i = 0; i < num; i++) {
+        (void)memset_s(&peers[i], sizeof(NodeBasicInfo), 0, sizeof(NodeBasicInfo));
+        (void)sprintf_s(peers[i].networkId, NETWORK_ID_BUF_LEN, "simPeer%d", i);
+        SyncChannelInfo *info = CreateSyncChannelInfo(peers[i].networkId);
+        ASSERT_NE(info, nullptr);
+        // the channel is still opening, so the outbox holds what the burst sends
+        info->clientChannelId = SIM_CHANNEL_BASE + i;
+        ListNodeInsert(&g_syncInfoManager.channelInfoList, &info->node);
+    }
+}
+
+static int32_t GetQueuedMsgNum(const SyncChannelInfo *info)
+{
+    int32_t num = 0;
+    SyncInfoMsg *msg = nullptr;
+    LIST_FOR_EACH_ENTRY(msg, &info->syncMsgList, SyncInfoMsg, node) {
+        num++;
+    }
+    return num;
+}
+
+/*
+ * @tc.name: EnqueueSyncInfoMsg_001
+ * @tc.desc: a queued latest value type is replaced by the newer message, other types stay queued in order
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.level: Level1
+ */
+HWTEST_F(LNNSyncInfoManagerTest, EnqueueSyncInfoMsg_001, TestSize.Level1)
+{
+    SyncChannelInfo *info = CreateSyncChannelInfo(NETWORKID);
+    ASSERT_NE(info, nullptr);
+    SyncInfoMsg *oldCap = CreateSyncInfoMsg(LNN_INFO_TYPE_CAPABILITY, MSG, LEN, nullptr);
+    SyncInfoMsg *topo = CreateSyncInfoMsg(LNN_INFO_TYPE_TOPO_UPDATE, MSG, LEN, nullptr);
+    SyncInfoMsg *topoNext = CreateSyncInfoMsg(LNN_INFO_TYPE_TOPO_UPDATE, MSG, LEN, nullptr);
+    SyncInfoMsg *newCap = CreateSyncInfoMsg(LNN_INFO_TYPE_CAPABILITY, MSG, LEN, nullptr);
+    ASSERT_TRUE(oldCap != nullptr && topo != nullptr && topoNext != nullptr && newCap != nullptr);
+
+    EnqueueSyncInfoMsg(info, oldCap);
+    EnqueueSyncInfoMsg(info, topo);
+    EnqueueSyncInfoMsg(info, topoNext);
+    EnqueueSyncInfoMsg(info, newCap);
+    EXPECT_EQ(GetQueuedMsgNum(info), 3);
+    SyncInfoMsg *last = LIST_ENTRY(GET_LIST_TAIL(&info->syncMsgList), SyncInfoMsg, node);
+    EXPECT_EQ(last, newCap);
+    DestroySyncInfoMsgList(&info->syncMsgList);
+    SoftBusFree(info);
+}
+
+/*
+ * @tc.name: DispatchSyncInfoBatch_001
+ * @tc.desc: a batch frame is dispatched per packed type and a truncated item stops the parse
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.level: Level1
+ */
+HWTEST_F(LNNSyncInfoManagerTest, DispatchSyncInfoBatch_001, TestSize.Level1)
+{
+    ListNode list;
+    ListNode packed;
+    ListInit(&list);
+    ListInit(&packed);
+    for (int32_t i = 0; i < SIM_TYPE_NUM; i++) {
+        SyncInfoMsg *msg = CreateSyncInfoMsg(SIM_TYPES[i], reinterpret_cast<const uint8_t *>(&i), sizeof(i), nullptr);
+        ASSERT_NE(msg, nullptr);
+        ListTailInsert(&list, &msg->node);
+    }
+    uint8_t frame[MAX_SYNC_INFO_MSG_LEN] = { 0 };
+    uint32_t frameLen = 0;
+    EXPECT_EQ(PackSyncInfoBatch(&list, &packed, frame, &frameLen), static_cast<uint32_t>(SIM_TYPE_NUM));
+    EXPECT_TRUE(IsListEmpty(&list));
+    DestroySyncInfoMsgList(&packed);
+
+    for (LnnSyncInfoType type : SIM_TYPES) {
+        g_syncInfoManager.handlers[type] = SimRecordHandler;
+        g_simLastChange[type] = -1;
+    }
+    g_simRecvNum = 0;
+    DispatchSyncInfoBatch(NETWORKID, frame + MSG_HEAD_LEN, frameLen - MSG_HEAD_LEN);
+    EXPECT_EQ(g_simRecvNum, SIM_TYPE_NUM);
+    for (int32_t i = 0; i < SIM_TYPE_NUM; i++) {
+        EXPECT_EQ(g_simLastChange[SIM_TYPES[i]], i);
+    }
+    g_simRecvNum = 0;
+    DispatchSyncInfoBatch(NETWORKID, frame + MSG_HEAD_LEN, frameLen - MSG_HEAD_LEN - 1);
+    EXPECT_EQ(g_simRecvNum, SIM_TYPE_NUM - 1);
+    for (LnnSyncInfoType type : SIM_TYPES) {
+        g_syncInfoManager.handlers[type] = nullptr;
+    }
+}
+
+/*
+ * @tc.name: SendSyncInfoBatchFromList_001
+ * @tc.desc: an oversized message flushes the batch before it and is sent alone, so the peer gets
+ *           every queued message in order
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.level: Level1
+ */
+HWTEST_F(LNNSyncInfoManagerTest, SendSyncInfoBatchFromList_001, TestSize.Level1)
+{
+    NiceMock<LnnTransInterfaceMock> transMock;
+    std::vector<int32_t> frameTypes;
+    EXPECT_CALL(transMock, TransSendNetworkingMessage)
+        .WillRepeatedly([&frameTypes](int32_t channelId, const char *data, uint32_t len, int32_t priority) {
+            (void)channelId;
+            (void)len;
+            (void)priority;
+            frameTypes.push_back(*reinterpret_cast<const int32_t *>(data));
+            return SOFTBUS_OK;
+        });
+    SyncChannelInfo *info = CreateSyncChannelInfo(NETWORKID);
+    ASSERT_NE(info, nullptr);
+    info->clientChannelId = SIM_CHANNEL_BASE;
+    std::vector<uint8_t> bigPayload(MAX_SYNC_INFO_MSG_LEN - MSG_HEAD_LEN, 0);
+    for (int32_t i = 0; i < SIM_TYPE_NUM + 2; i++) {
+        SyncInfoMsg *msg = (i == SIM_TYPE_NUM - 1) ?
+            CreateSyncInfoMsg(LNN_INFO_TYPE_TOPO_UPDATE, bigPayload.data(), bigPayload.size(), nullptr) :
+            CreateSyncInfoMsg(SIM_TYPES[i % SIM_TYPE_NUM], reinterpret_cast<const uint8_t *>(&i), sizeof(i), nullptr);
+        ASSERT_NE(msg, nullptr);
+        ListTailInsert(&info->syncMsgList, &msg->node);
+    }
+
+    SendSyncInfoBatchFromList(info);
+    EXPECT_TRUE(IsListEmpty(&info->syncMsgList));
+    std::vector<int32_t> expectTypes = { LNN_INFO_TYPE_BATCH, LNN_INFO_TYPE_TOPO_UPDATE, LNN_INFO_TYPE_BATCH };
+    EXPECT_EQ(frameTypes, expectTypes);
+    SoftBusFree(info);
+}
+
+/*
+ * @tc.name: LnnSendSyncInfoMsgToPeers_001
+ * @tc.desc: invalid params and the batch type are rejected by LnnSendSyncInfoMsgToPeers
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.level: Level1
+ */
+HWTEST_F(LNNSyncInfoManagerTest, LnnSendSyncInfoMsgToPeers_001, TestSize.Level1)
+{
+    LnnSyncInfoPeerList peerList = {
+        .peers = nullptr,
+        .peerNum = 1,
+        .filter = nullptr,
+        .para = nullptr,
+    };
+    EXPECT_EQ(LnnSendSyncInfoMsgToPeers(LNN_INFO_TYPE_CAPABILITY, nullptr, MSG, LEN), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(LnnSendSyncInfoMsgToPeers(LNN_INFO_TYPE_CAPABILITY, &peerList, MSG, LEN), SOFTBUS_INVALID_PARAM);
+    peerList.peerNum = 0;
+    EXPECT_EQ(LnnSendSyncInfoMsgToPeers(LNN_INFO_TYPE_BATCH, &peerList, MSG, LEN), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(LnnSendSyncInfoMsgToPeers(LNN_INFO_TYPE_CAPABILITY, &peerList, MSG, LENGTH), SOFTBUS_MEM_ERR);
+    EXPECT_EQ(LnnSendSyncInfoMsgToPeers(LNN_INFO_TYPE_CAPABILITY, &peerList, MSG, LEN), SOFTBUS_OK);
+}
+
+/*
+ * @tc.name: SyncInfoBurstSimulation_001
+ * @tc.desc: a burst of 50 changes to 100 peers with opening channels is coalesced per type and
+ *           flushed as one batch frame per peer carrying the latest value of every type
+ * @tc.type: FUNC
+ * @tc.require:
+ * @tc.level: Level1
+ */
+HWTEST_F(LNNSyncInfoManagerTest, SyncInfoBurstSimulation_001, TestSize.Level1)
+{
+    uint64_t feature = 1ULL << BIT_SUPPORT_SYNC_INFO_BATCH;
+    NiceMock<LnnNetLedgertInterfaceMock> ledgerMock;
+    NiceMock<DistributeLedgerInterfaceMock> distributeLedgerMock;
+    NiceMock<LnnServicetInterfaceMock> serviceMock;
+    NiceMock<LnnTransInterfaceMock> transMock;
+    EXPECT_CALL(ledgerMock, LnnGetLocalNumU64Info)
+        .WillRepeatedly(DoAll(SetArgPointee<1>(feature), Return(SOFTBUS_OK)));
+    EXPECT_CALL(distributeLedgerMock, LnnGetRemoteNumU64Info)
+        .WillRepeatedly(DoAll(SetArgPointee<2>(feature), Return(SOFTBUS_OK)));
+    EXPECT_CALL(serviceMock, IsFeatureSupport).WillRepeatedly(Return(true));
+    std::vector<uint8_t> lastFrame;
+    int32_t frameNum = 0;
+    EXPECT_CALL(transMock, TransSendNetworkingMessage)
+        .WillRepeatedly([&lastFrame, &frameNum](int32_t channelId, const char *data, uint32_t len, int32_t priority) {
+            (void)channelId;
+            (void)priority;
+            lastFrame.assign(data, data + len);
+            frameNum++;
+            return SOFTBUS_OK;
+        });
+
+    ListDelete(&g_syncInfoManager.channelInfoList);
+    NodeBasicInfo peers[SIM_PEER_NUM];
+    AddSimPeers(peers, SIM_PEER_NUM);
+    LnnSyncInfoPeerList peerList = {
+        .peers = peers,
+        .peerNum = SIM_PEER_NUM,
+        .filter = nullptr,
+        .para = nullptr,
+    };
+    for (int32_t change = 0; change < SIM_CHANGE_NUM; change++) {
+        EXPECT_EQ(LnnSendSyncInfoMsgToPeers(SIM_TYPES[change % SIM_TYPE_NUM], &peerList,
+            reinterpret_cast<const uint8_t *>(&change), sizeof(change)), SOFTBUS_OK);
+    }
+    EXPECT_EQ(frameNum, 0);
+    SyncChannelInfo *info = nullptr;
+    LIST_FOR_EACH_ENTRY(info, &g_syncInfoManager.channelInfoList, SyncChannelInfo, node) {
+        EXPECT_EQ(GetQueuedMsgNum(info), SIM_TYPE_NUM);
+    }
+
+    LIST_FOR_EACH_ENTRY(info, &g_syncInfoManager.channelInfoList, SyncChannelInfo, node) {
+        info->isClientOpened = true;
+        SendSyncInfoMsgFromList(info);
+        EXPECT_TRUE(IsListEmpty(&info->syncMsgList));
+    }
+    EXPECT_EQ(frameNum, SIM_PEER_NUM);
+
+    ASSERT_GT(lastFrame.size(), static_cast<size_t>(MSG_HEAD_LEN));
+    EXPECT_EQ(*reinterpret_cast<const int32_t *>(lastFrame.data()), LNN_INFO_TYPE_BATCH);
+    for (LnnSyncInfoType type : SIM_TYPES) {
+        g_syncInfoManager.handlers[type] = SimRecordHandler;
+        g_simLastChange[type] = -1;
+    }
+    g_simRecvNum = 0;
+    DispatchSyncInfoBatch(NETWORKID, lastFrame.data() + MSG_HEAD_LEN, lastFrame.size() - MSG_HEAD_LEN);
+    EXPECT_EQ(g_simRecvNum, SIM_TYPE_NUM);
+    for (int32_t i = 0; i < SIM_TYPE_NUM; i++) {
+        int32_t latest = (SIM_CHANGE_NUM - 1) - ((SIM_CHANGE_NUM - 1 - i) % SIM_TYPE_NUM);
+        EXPECT_EQ(g_simLastChange[SIM_TYPES[i]], latest);
+    }
+    for (LnnSyncInfoType type : SIM_TYPES) {
+        g_syncInfoManager.handlers[type] = nullptr;
+    }
+    ClearSyncChannelInfo();
+}
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -57,6 +57,12 @@ int32_t LnnSendSyncInfoMsg(
     return GetSyncInterface()->LnnSendSyncInfoMsg(type, networkId, msg, len, complete);
 }
 
+int32_t LnnSendSyncInfoMsgToPeers(LnnSyncInfoType type, const LnnSyncInfoPeerList *peerList,
+    const uint8_t *msg, uint32_t len)
+{
+    return GetSyncInterface()->LnnSendSyncInfoMsgToPeers(type, peerList, msg, len);
+}
+
 int32_t LnnSendP2pSyncInfoMsg(const char *networkId, uint32_t netCapability)
 {
     return GetSyncInterface()->LnnSendP2pSyncInfoMsg(networkId, netCapability);
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <securec.h>
+
+#include "common_list.h"
+#include "lnn_heartbeat_deadline.h"
+#include "softbus_adapter_mem.h"
+#include "softbus_error_code.h"
+
+namespace OHOS {
+// 500 online peers each sending a heartbeat every second for one minute
+static constexpr uint32_t PEER_NUM = 500;
+static constexpr uint32_t ROUND_NUM = 60;
+static constexpr uint64_t HB_INTERVAL_MS = 1000;
+static constexpr uint64_t PEER_SPREAD_MS = 2;
+static constexpr uint64_t CHECK_DELAY_MS = 10000 + 2000;
+static constexpr int64_t REPLAY_NUM = 20;
+
+/* the delayed check message the looper queue held per peer before the deadline table */
+typedef struct {
+    ListNode node;
+    char networkId[NETWORK_ID_BUF_LEN];
+    ConnectionAddrType addrType;
+    uint64_t fireTime;
+} LooperCheckMsg;
+
+static char g_networkId[PEER_NUM][NETWORK_ID_BUF_LEN];
+
+static void BuildPeers(void)
+{
+    for (uint32_t i = 0; i < PEER_NUM; i++) {
+        (void)sprintf_s(g_networkId[i], NETWORK_ID_BUF_LEN, "networkId%08u", i);
+    }
+}
+
+/* the old heartbeat path: scan the queue to remove the pending check, then post a new one in time order */
+static bool LooperRestartCheck(ListNode *queue, uint32_t peer, uint64_t now)
+{
+    LooperCheckMsg *msg = nullptr;
+    LooperCheckMsg *next = nullptr;
+    LIST_FOR_EACH_ENTRY_SAFE(msg, next, queue, LooperCheckMsg, node) {
+        if (msg->addrType == CONNECTION_ADDR_BLE && strcmp(msg->networkId, g_networkId[peer]) == 0) {
+            ListDelete(&msg->node);
+            SoftBusFree(msg);
+        }
+    }
+    LooperCheckMsg *newMsg = static_cast<LooperCheckMsg *>(SoftBusCalloc(sizeof(LooperCheckMsg)));
+    if (newMsg == nullptr) {
+        return false;
+    }
+    (void)strcpy_s(newMsg->networkId, NETWORK_ID_BUF_LEN, g_networkId[peer]);
+    newMsg->addrType = CONNECTION_ADDR_BLE;
+    newMsg->fireTime = now + CHECK_DELAY_MS;
+    ListNode *pos = queue->prev;
+    while (pos != queue && (CONTAINER_OF(pos, LooperCheckMsg, node))->fireTime > newMsg->fireTime) {
+        pos = pos->prev;
+    }
+    ListAdd(pos, &newMsg->node);
+    return true;
+}
+
+static void LooperClear(ListNode *queue)
+{
+    LooperCheckMsg *msg = nullptr;
+    LooperCheckMsg *next = nullptr;
+    LIST_FOR_EACH_ENTRY_SAFE(msg, next, queue, LooperCheckMsg, node) {
+        ListDelete(&msg->node);
+        SoftBusFree(msg);
+    }
+}
+
+/**
+ * @tc.name: LooperRestartTestCase
+ * @tc.desc: 500 peers at 1Hz remove and repost a delayed check message per heartbeat Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: previous offline timing restart
+ */
+static void LooperRestartTestCase(benchmark::State &state)
+{
+    BuildPeers();
+    uint64_t posts = 0;
+    while (state.KeepRunning()) {
+        ListNode queue;
+        ListInit(&queue);
+        for (uint32_t round = 0; round < ROUND_NUM; round++) {
+            for (uint32_t peer = 0; peer < PEER_NUM; peer++) {
+                if (!LooperRestartCheck(&queue, peer, round * HB_INTERVAL_MS + peer * PEER_SPREAD_MS)) {
+                    state.SkipWithError("LooperRestartTestCase malloc failed.");
+                    break;
+                }
+                posts++;
+            }
+        }
+        LooperClear(&queue);
+    }
+    state.counters["timerPosts"] = (state.iterations() == 0) ? 0 : static_cast<double>(posts) / state.iterations();
+}
+BENCHMARK(LooperRestartTestCase)->Iterations(REPLAY_NUM);
+
+/**
+ * @tc.name: DeadlineTableTestCase
+ * @tc.desc: 500 peers at 1Hz update their deadline in place under one earliest-deadline timer Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: LnnSetHbDeadline normal operation
+ */
+static void DeadlineTableTestCase(benchmark::State &state)
+{
+    BuildPeers();
+    static LnnHbDeadlineTable table;
+    if (LnnInitHbDeadlineTable(&table) != SOFTBUS_OK) {
+        state.SkipWithError("DeadlineTableTestCase init failed.");
+        return;
+    }
+    LnnHbDeadlineInfo info = {
+        .addrType = CONNECTION_ADDR_BLE,
+        .hbType = HEARTBEAT_TYPE_BLE_V1,
+        .checkDelay = CHECK_DELAY_MS,
+    };
+    LnnHbDeadlineInfo expired[HB_DEADLINE_EXPIRED_MAX_NUM];
+    uint64_t posts = 0;
+    uint32_t lost = 0;
+    while (state.KeepRunning()) {
+        LnnHbDeadlineTimer armed = { 0 };
+        uint64_t fireTime = 0;
+        for (uint32_t round = 0; round < ROUND_NUM; round++) {
+            for (uint32_t peer = 0; peer < PEER_NUM; peer++) {
+                uint64_t now = round * HB_INTERVAL_MS + peer * PEER_SPREAD_MS;
+                LnnHbDeadlineTimer timer = { 0 };
+                // the armed check timer fires before this heartbeat is handled
+                if (armed.needArm && now >= fireTime) {
+                    lost += LnnPopExpiredHbDeadline(&table, armed.timerSeq, now, expired,
+                        HB_DEADLINE_EXPIRED_MAX_NUM, &timer);
+                    armed = timer;
+                    fireTime = now + timer.delayMillis;
+                    posts += timer.needArm ? 1 : 0;
+                }
+                (void)strcpy_s(info.networkId, NETWORK_ID_BUF_LEN, g_networkId[peer]);
+                info.deadline = now + CHECK_DELAY_MS;
+                (void)LnnSetHbDeadline(&table, &info, now, &timer);
+                if (timer.needArm) {
+                    armed = timer;
+                    fireTime = now + timer.delayMillis;
+                    posts++;
+                }
+            }
+        }
+        LnnClearHbDeadlineTable(&table);
+    }
+    LnnDeinitHbDeadlineTable(&table);
+    benchmark::DoNotOptimize(lost);
+    state.counters["timerPosts"] = (state.iterations() == 0) ? 0 : static_cast<double>(posts) / state.iterations();
+}
+BENCHMARK(DeadlineTableTestCase)->Iterations(REPLAY_NUM);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
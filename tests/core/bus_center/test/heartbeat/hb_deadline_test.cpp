@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <securec.h>
+
+#include "lnn_heartbeat_deadline.h"
+#include "softbus_error_code.h"
+
+namespace OHOS {
+using namespace testing::ext;
+
+constexpr char NETWORKID1[] = "ABCDEF";
+constexpr char NETWORKID2[] = "123456";
+constexpr uint64_t NOW_TIME = 1000;
+constexpr uint64_t CHECK_DELAY = 10000;
+constexpr uint32_t PEER_NUM = 20;
+
+class HeartBeatDeadlineTest : public testing::Test {
+public:
+    static void SetUpTestCase() { }
+    static void TearDownTestCase() { }
+    void SetUp() override
+    {
+        ASSERT_EQ(LnnInitHbDeadlineTable(&table_), SOFTBUS_OK);
+    }
+    void TearDown() override
+    {
+        LnnDeinitHbDeadlineTable(&table_);
+    }
+
+    void BuildInfo(LnnHbDeadlineInfo *info, const char *networkId, ConnectionAddrType addrType, uint64_t deadline)
+    {
+        (void)memset_s(info, sizeof(LnnHbDeadlineInfo), 0, sizeof(LnnHbDeadlineInfo));
+        (void)strcpy_s(info->networkId, NETWORK_ID_BUF_LEN, networkId);
+        info->addrType = addrType;
+        info->hbType = HEARTBEAT_TYPE_BLE_V1;
+        info->checkDelay = CHECK_DELAY;
+        info->deadline = deadline;
+    }
+
+    LnnHbDeadlineTable table_;
+};
+
+/*
+ * @tc.name: HbSetDeadlineTest001
+ * @tc.desc: Test LnnSetHbDeadline arms a timer only for a deadline earlier than the armed one
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(HeartBeatDeadlineTest, HbSetDeadlineTest001, TestSize.Level1)
+{
+    LnnHbDeadlineInfo info;
+    LnnHbDeadlineTimer timer;
+    BuildInfo(&info, NETWORKID1, CONNECTION_ADDR_BLE, NOW_TIME + CHECK_DELAY);
+    EXPECT_EQ(LnnSetHbDeadline(&table_, &info, NOW_TIME, &timer), SOFTBUS_OK);
+    EXPECT_TRUE(timer.needArm);
+    EXPECT_EQ(timer.delayMillis, CHECK_DELAY);
+
+    // a heartbeat moves the deadline later in place without a new timer
+    info.deadline += CHECK_DELAY;
+    EXPECT_EQ(LnnSetHbDeadline(&table_, &info, NOW_TIME, &timer), SOFTBUS_OK);
+    EXPECT_FALSE(timer.needArm);
+    EXPECT_EQ(table_.num, 1U);
+
+    BuildInfo(&info, NETWORKID2, CONNECTION_ADDR_BLE, NOW_TIME + 1);
+    uint32_t armedSeq = table_.timerSeq;
+    EXPECT_EQ(LnnSetHbDeadline(&table_, &info, NOW_TIME, &timer), SOFTBUS_OK);
+    EXPECT_TRUE(timer.needArm);
+    EXPECT_NE(timer.timerSeq, armedSeq);
+    EXPECT_EQ(timer.delayMillis, 1U);
+    EXPECT_EQ(table_.num, 2U);
+
+    EXPECT_EQ(LnnSetHbDeadline(nullptr, &info, NOW_TIME, &timer), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(LnnSetHbDeadline(&table_, nullptr, NOW_TIME, &timer), SOFTBUS_INVALID_PARAM);
+}
+
+/*
+ * @tc.name: HbRemoveDeadlineTest001
+ * @tc.desc: Test LnnRemoveHbDeadline removes only the peer with the same networkId and addrType
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(HeartBeatDeadlineTest, HbRemoveDeadlineTest001, TestSize.Level1)
+{
+    LnnHbDeadlineInfo info;
+    LnnHbDeadlineTimer timer;
+    BuildInfo(&info, NETWORKID1, CONNECTION_ADDR_BLE, NOW_TIME + CHECK_DELAY);
+    EXPECT_EQ(LnnSetHbDeadline(&table_, &info, NOW_TIME, &timer), SOFTBUS_OK);
+    info.addrType = CONNECTION_ADDR_WLAN;
+    EXPECT_EQ(LnnSetHbDeadline(&table_, &info, NOW_TIME, &timer), SOFTBUS_OK);
+    EXPECT_EQ(table_.num, 2U);
+
+    LnnRemoveHbDeadline(&table_, NETWORKID2, CONNECTION_ADDR_BLE);
+    EXPECT_EQ(table_.num, 2U);
+    LnnRemoveHbDeadline(&table_, NETWORKID1, CONNECTION_ADDR_BLE);
+    EXPECT_EQ(table_.num, 1U);
+    LnnRemoveHbDeadline(&table_, NETWORKID1, CONNECTION_ADDR_BLE);
+    EXPECT_EQ(table_.num, 1U);
+    LnnRemoveHbDeadline(&table_, nullptr, CONNECTION_ADDR_WLAN);
+    EXPECT_EQ(table_.num, 1U);
+}
+
+/*
+ * @tc.name: HbPopExpiredDeadlineTest001
+ * @tc.desc: Test LnnPopExpiredHbDeadline takes out expired peers and arms the next earliest deadline
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(HeartBeatDeadlineTest, HbPopExpiredDeadlineTest001, TestSize.Level1)
+{
+    LnnHbDeadlineInfo info;
+    LnnHbDeadlineTimer timer;
+    BuildInfo(&info, NETWORKID1, CONNECTION_ADDR_BLE, NOW_TIME + CHECK_DELAY);
+    EXPECT_EQ(LnnSetHbDeadline(&table_, &info, NOW_TIME, &timer), SOFTBUS_OK);
+    uint32_t timerSeq = timer.timerSeq;
+    BuildInfo(&info, NETWORKID2, CONNECTION_ADDR_BLE, NOW_TIME + CHECK_DELAY * 2);
+    EXPECT_EQ(LnnSetHbDeadline(&table_, &info, NOW_TIME, &timer), SOFTBUS_OK);
+
+    LnnHbDeadlineInfo expired[HB_DEADLINE_EXPIRED_MAX_NUM];
+    uint64_t fireTime = NOW_TIME + CHECK_DELAY;
+    EXPECT_EQ(LnnPopExpiredHbDeadline(&table_, timerSeq, fireTime, expired, HB_DEADLINE_EXPIRED_MAX_NUM, &timer), 1U);
+    EXPECT_STREQ(expired[0].networkId, NETWORKID1);
+    EXPECT_EQ(expired[0].checkDelay, CHECK_DELAY);
+    EXPECT_TRUE(timer.needArm);
+    EXPECT_EQ(timer.delayMillis, CHECK_DELAY);
+    EXPECT_EQ(table_.num, 1U);
+
+    // a stale timer leaves the armed one alone and takes nothing before the deadline
+    EXPECT_EQ(LnnPopExpiredHbDeadline(&table_, timerSeq, fireTime, expired, HB_DEADLINE_EXPIRED_MAX_NUM, &timer), 0U);
+    EXPECT_FALSE(timer.needArm);
+
+    EXPECT_EQ(LnnPopExpiredHbDeadline(&table_, table_.timerSeq, NOW_TIME + CHECK_DELAY * 2, expired,
+        HB_DEADLINE_EXPIRED_MAX_NUM, &timer), 1U);
+    EXPECT_STREQ(expired[0].networkId, NETWORKID2);
+    EXPECT_FALSE(timer.needArm);
+    EXPECT_FALSE(table_.isTimerArmed);
+    EXPECT_EQ(table_.num, 0U);
+}
+
+/*
+ * @tc.name: HbPopExpiredDeadlineTest002
+ * @tc.desc: Test LnnPopExpiredHbDeadline takes at most maxNum peers and fires again at once for the rest
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(HeartBeatDeadlineTest, HbPopExpiredDeadlineTest002, TestSize.Level1)
+{
+    LnnHbDeadlineInfo info;
+    LnnHbDeadlineTimer timer;
+    char networkId[NETWORK_ID_BUF_LEN] = { 0 };
+    for (uint32_t i = 0; i < PEER_NUM; i++) {
+        (void)sprintf_s(networkId, sizeof(networkId), "peer%u", i);
+        BuildInfo(&info, networkId, CONNECTION_ADDR_BLE, NOW_TIME + CHECK_DELAY);
+        EXPECT_EQ(LnnSetHbDeadline(&table_, &info, NOW_TIME, &timer), SOFTBUS_OK);
+    }
+    EXPECT_EQ(table_.num, PEER_NUM);
+
+    LnnHbDeadlineInfo expired[HB_DEADLINE_EXPIRED_MAX_NUM];
+    uint64_t fireTime = NOW_TIME + CHECK_DELAY;
+    EXPECT_EQ(LnnPopExpiredHbDeadline(&table_, table_.timerSeq, fireTime, expired, HB_DEADLINE_EXPIRED_MAX_NUM,
+        &timer), HB_DEADLINE_EXPIRED_MAX_NUM);
+    EXPECT_TRUE(timer.needArm);
+    EXPECT_EQ(timer.delayMillis, 0U);
+    EXPECT_EQ(LnnPopExpiredHbDeadline(&table_, timer.timerSeq, fireTime, expired, HB_DEADLINE_EXPIRED_MAX_NUM,
+        &timer), PEER_NUM - HB_DEADLINE_EXPIRED_MAX_NUM);
+    EXPECT_FALSE(timer.needArm);
+    EXPECT_EQ(table_.num, 0U);
+    EXPECT_EQ(LnnPopExpiredHbDeadline(&table_, 0, fireTime, nullptr, HB_DEADLINE_EXPIRED_MAX_NUM, &timer), 0U);
+}
+
+/*
+ * @tc.name: HbCancelDeadlineTimerTest001
+ * @tc.desc: Test LnnCancelHbDeadlineTimer lets the next deadline arm a new timer after a failed post
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(HeartBeatDeadlineTest, HbCancelDeadlineTimerTest001, TestSize.Level1)
+{
+    LnnHbDeadlineInfo info;
+    LnnHbDeadlineTimer timer;
+    BuildInfo(&info, NETWORKID1, CONNECTION_ADDR_BLE, NOW_TIME + CHECK_DELAY);
+    EXPECT_EQ(LnnSetHbDeadline(&table_, &info, NOW_TIME, &timer), SOFTBUS_OK);
+    LnnCancelHbDeadlineTimer(&table_, timer.timerSeq + 1);
+    EXPECT_TRUE(table_.isTimerArmed);
+    LnnCancelHbDeadlineTimer(&table_, timer.timerSeq);
+    EXPECT_FALSE(table_.isTimerArmed);
+
+    info.deadline += CHECK_DELAY;
+    EXPECT_EQ(LnnSetHbDeadline(&table_, &info, NOW_TIME, &timer), SOFTBUS_OK);
+    EXPECT_TRUE(timer.needArm);
+    EXPECT_EQ(timer.delayMillis, CHECK_DELAY * 2);
+
+    LnnClearHbDeadlineTable(&table_);
+    EXPECT_EQ(table_.num, 0U);
+    EXPECT_FALSE(table_.isTimerArmed);
+}
+} // namespace OHOS
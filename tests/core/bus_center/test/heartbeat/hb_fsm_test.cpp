@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -533,12 +533,14 @@ HWTEST_F(HeartBeatFSMTest, OnCheckDevStatusTest_01, TestSize.Level1)
         .WillRepeatedly(Return(SOFTBUS_SCREEN_ON));
     ret = OnCheckDevStatus(&hbFsm->fsm, TEST_ARGS, para);
     EXPECT_TRUE(ret == SOFTBUS_OK);
+    SoftBusFree(para);
     LnnCheckDevStatusMsgPara *para2 =
         reinterpret_cast<LnnCheckDevStatusMsgPara *>(SoftBusCalloc(sizeof(LnnCheckDevStatusMsgPara)));
     ASSERT_TRUE(para2 != nullptr);
     para2->hasNetworkId = true;
     ret = OnCheckDevStatus(&hbFsm->fsm, TEST_ARGS, reinterpret_cast<void *>(para2));
     EXPECT_TRUE(ret == SOFTBUS_OK);
+    SoftBusFree(para2);
 
     LnnCheckDevStatusMsgPara *para3 =
         reinterpret_cast<LnnCheckDevStatusMsgPara *>(SoftBusCalloc(sizeof(LnnCheckDevStatusMsgPara)));
@@ -546,6 +548,7 @@ HWTEST_F(HeartBeatFSMTest, OnCheckDevStatusTest_01, TestSize.Level1)
     para3->hasNetworkId = false;
     ret = OnCheckDevStatus(&hbFsm->fsm, TEST_ARGS, reinterpret_cast<void *>(para3));
     EXPECT_TRUE(ret == SOFTBUS_OK);
+    SoftBusFree(para3);
     LnnDestroyHeartbeatFsm(nullptr);
     DeinitHbFsmCallback(nullptr);
     ret = LnnStartHeartbeatFsm(nullptr);
@@ -831,6 +834,7 @@ HWTEST_F(HeartBeatFSMTest, RemoveScreenOffCheckStatus_01, TestSize.Level1)
     delMsgPara.hbType = 0;
     ret = RemoveScreenOffCheckStatus(&ctrlMsgObj, &delMsg);
     EXPECT_TRUE(ret == SOFTBUS_OK);
+    SoftBusFree(msgPara);
 }
 
 /*
@@ -863,6 +867,7 @@ HWTEST_F(HeartBeatFSMTest, RemoveScreenOffCheckStatus_02, TestSize.Level1)
 
     ret = RemoveScreenOffCheckStatus(&ctrlMsgObj, &delMsg);
     EXPECT_TRUE(ret == SOFTBUS_OK);
+    SoftBusFree(msgPara);
 }
 
 /*
@@ -894,6 +899,7 @@ HWTEST_F(HeartBeatFSMTest, RemoveScreenOffCheckStatus_03, TestSize.Level1)
 
     ret = RemoveScreenOffCheckStatus(&ctrlMsgObj, &delMsg);
     EXPECT_EQ(ret, SOFTBUS_NETWORK_HB_REMOVE_MSG_FAIL);
+    SoftBusFree(msgPara);
 }
 /*
  * @tc.name: OnScreeOffCheckDevStatus_01
@@ -921,6 +927,7 @@ HWTEST_F(HeartBeatFSMTest, OnScreeOffCheckDevStatus_01, TestSize.Level1)
     LnnRemoveScreenOffCheckStatusMsg(&hbFsm, nullptr);
     LnnRemoveScreenOffCheckStatusMsg(&hbFsm, &msgParas);
     ReportSendBroadcastResultEvt();
+    SoftBusFree(msgPara);
 }
 
 /*
@@ -1364,6 +1371,7 @@ HWTEST_F(HeartBeatFSMTest, OnCheckDevStatus_01, TestSize.Level1)
     EXPECT_CALL(distriLedgerMock, LnnGetDLHeartbeatTimestamp).WillRepeatedly(Return(SOFTBUS_OK));
     int32_t ret = OnCheckDevStatus(&fsm, TEST_ARGS, msgPara);
     EXPECT_EQ(ret, SOFTBUS_NETWORK_HB_CHECK_DEV_STATUS_ERROR);
+    SoftBusFree(msgPara);
     int32_t infoNum = 2;
     LnnCheckDevStatusMsgPara *msgPara1 = (LnnCheckDevStatusMsgPara *)SoftBusCalloc(sizeof(LnnCheckDevStatusMsgPara));
     ASSERT_TRUE(msgPara1 != nullptr);
@@ -1375,6 +1383,7 @@ HWTEST_F(HeartBeatFSMTest, OnCheckDevStatus_01, TestSize.Level1)
         .WillOnce(DoAll(SetArgPointee<0>(nodeBasicInfo), SetArgPointee<1>(infoNum), Return(SOFTBUS_OK)));
     EXPECT_CALL(netLedgerMock, LnnIsLSANode).WillOnce(Return(true)).WillRepeatedly(Return(false));
     ret = OnCheckDevStatus(&(hbFsm->fsm), TEST_ARGS, msgPara1);
+    SoftBusFree(msgPara1);
     SoftBusFree(hbFsm);
     EXPECT_EQ(ret, SOFTBUS_OK);
 }
@@ -1400,6 +1409,7 @@ HWTEST_F(HeartBeatFSMTest, OnCheckDevStatus_02, TestSize.Level1)
     LnnHeartbeatFsm *hbFsm = LnnCreateHeartbeatFsm();
     EXPECT_CALL(netLedgerMock, LnnGetAllOnlineNodeInfo).WillRepeatedly(Return(SOFTBUS_INVALID_PARAM));
     int32_t ret = OnCheckDevStatus(&(hbFsm->fsm), TEST_ARGS, msgPara);
+    SoftBusFree(msgPara);
     SoftBusFree(hbFsm);
     EXPECT_EQ(ret, SOFTBUS_NETWORK_HB_CHECK_DEV_STATUS_ERROR);
 }
@@ -1429,6 +1439,7 @@ HWTEST_F(HeartBeatFSMTest, OnCheckDevStatus_03, TestSize.Level1)
         .WillOnce(DoAll(SetArgPointee<0>(nodeBasicInfo), SetArgPointee<1>(infoNum), Return(SOFTBUS_OK)));
     msgPara->hasNetworkId = false;
     int32_t ret = OnCheckDevStatus(&(hbFsm->fsm), 0, msgPara);
+    SoftBusFree(msgPara);
     SoftBusFree(hbFsm);
     SoftBusFree(nodeBasicInfo);
     EXPECT_EQ(ret, SOFTBUS_OK);
@@ -1454,6 +1465,7 @@ HWTEST_F(HeartBeatFSMTest, OnCheckDevStatus_04, TestSize.Level1)
     EXPECT_CALL(netLedgerMock, LnnGetAllOnlineNodeInfo)
         .WillOnce(DoAll(SetArgPointee<0>(nullptr), SetArgPointee<1>(infoNum), Return(SOFTBUS_OK)));
     int32_t ret = OnCheckDevStatus(&(hbFsm->fsm), 0, msgPara);
+    SoftBusFree(msgPara);
     SoftBusFree(hbFsm);
     EXPECT_EQ(ret, SOFTBUS_OK);
 }
@@ -1478,7 +1490,48 @@ HWTEST_F(HeartBeatFSMTest, OnCheckDevStatus_05, TestSize.Level1)
         .WillOnce(DoAll(SetArgPointee<0>(nullptr), SetArgPointee<1>(infoNum), Return(SOFTBUS_OK)));
     msgPara->hasNetworkId = false;
     int32_t ret = OnCheckDevStatus(&(hbFsm->fsm), 0, msgPara);
+    SoftBusFree(msgPara);
     SoftBusFree(hbFsm);
     EXPECT_EQ(ret, SOFTBUS_OK);
 }
+
+/*
+ * @tc.name: OnCheckOfflineDeadline_01
+ * @tc.desc: on check offline deadline takes out the expired peers of the deadline table
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(HeartBeatFSMTest, OnCheckOfflineDeadline_01, TestSize.Level1)
+{
+    NiceMock<HeartBeatFSMInterfaceMock> heartbeatFsmMock;
+    EXPECT_CALL(heartbeatFsmMock, GetScreenState).WillRepeatedly(Return(SOFTBUS_SCREEN_OFF));
+    LnnHeartbeatFsm *hbFsm = LnnCreateHeartbeatFsm();
+    ASSERT_TRUE(hbFsm != nullptr);
+    LnnCheckDevStatusMsgPara msgPara = {
+        .hasNetworkId = true,
+        .networkId = TEST_NETWORK_ID,
+        .hbType = HEARTBEAT_TYPE_BLE_V1,
+        .addrType = CONNECTION_ADDR_BLE,
+    };
+    EXPECT_EQ(LnnSetOfflineDeadlineToHbFsm(nullptr, &msgPara, 0), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(LnnSetOfflineDeadlineToHbFsm(hbFsm, nullptr, 0), SOFTBUS_INVALID_PARAM);
+    LnnHbDeadlineInfo info = {
+        .addrType = CONNECTION_ADDR_BLE,
+        .hbType = HEARTBEAT_TYPE_BLE_V1,
+    };
+    (void)strcpy_s(info.networkId, NETWORK_ID_BUF_LEN, TEST_NETWORK_ID);
+    LnnHbDeadlineTimer timer = { 0 };
+    EXPECT_EQ(LnnSetHbDeadline(&hbFsm->deadlineTable, &info, 0, &timer), SOFTBUS_OK);
+    uint32_t timerSeq = timer.timerSeq;
+    EXPECT_EQ(OnCheckOfflineDeadline(&hbFsm->fsm, 0, nullptr), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(OnCheckOfflineDeadline(&hbFsm->fsm, 0, &timerSeq), SOFTBUS_OK);
+    EXPECT_EQ(hbFsm->deadlineTable.num, 0U);
+
+    EXPECT_EQ(LnnSetHbDeadline(&hbFsm->deadlineTable, &info, 0, &timer), SOFTBUS_OK);
+    LnnRemoveOfflineDeadlineFromHbFsm(hbFsm, &msgPara);
+    EXPECT_EQ(hbFsm->deadlineTable.num, 0U);
+    EXPECT_EQ(OnCheckOfflineDeadline(nullptr, 0, nullptr), SOFTBUS_NETWORK_HB_CHECK_DEV_STATUS_ERROR);
+    LnnDestroyHeartbeatFsm(hbFsm);
+}
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -146,13 +146,30 @@ HWTEST_F(HeartBeatStrategyTest, LNN_START_OFFLINE_TIMING_STRATEGY_TEST_01, TestS
     ON_CALL(hbMock, LnnGetRemoteNumU64Info).WillByDefault(Return(SOFTBUS_OK));
     ON_CALL(hbMock, IsFeatureSupport).WillByDefault(Return(false));
     ON_CALL(hbMock, LnnConvertHbTypeToId).WillByDefault(Return(1));
-    ON_CALL(hbMock, LnnPostCheckDevStatusMsgToHbFsm).WillByDefault(Return(SOFTBUS_INVALID_PARAM));
+    ON_CALL(hbMock, LnnSetOfflineDeadlineToHbFsm).WillByDefault(Return(SOFTBUS_INVALID_PARAM));
     int32_t ret = LnnStartOfflineTimingStrategy(nullptr, CONNECTION_ADDR_WLAN);
     EXPECT_TRUE(ret == SOFTBUS_INVALID_PARAM);
     ret = LnnStartOfflineTimingStrategy(NETWORKID, CONNECTION_ADDR_WLAN);
     EXPECT_EQ(ret, SOFTBUS_NETWORK_HB_GET_GEAR_MODE_FAIL);
 }
 
+/*
+ * @tc.name: LNN_START_OFFLINE_TIMING_STRATEGY_TEST_02
+ * @tc.desc: lnn start offline timing strategy drops the deadline of a burst peer
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(HeartBeatStrategyTest, LNN_START_OFFLINE_TIMING_STRATEGY_TEST_02, TestSize.Level1)
+{
+    NiceMock<HeartBeatFSMStrategyInterfaceMock> hbMock;
+    ON_CALL(hbMock, LnnIsSupportBurstFeature).WillByDefault(Return(true));
+    EXPECT_CALL(hbMock, LnnRemoveOfflineDeadlineFromHbFsm).Times(1);
+    EXPECT_CALL(hbMock, LnnSetOfflineDeadlineToHbFsm).Times(0);
+    int32_t ret = LnnStartOfflineTimingStrategy(NETWORKID, CONNECTION_ADDR_BLE);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+}
+
 /*
  * @tc.name: LNN_STOP_OFFLINE_TIMING_STRATEGY_TEST_01
  * @tc.desc: lnn stop offline timing strategy test
@@ -165,6 +182,7 @@ HWTEST_F(HeartBeatStrategyTest, LNN_STOP_OFFLINE_TIMING_STRATEGY_TEST_01, TestSi
     NiceMock<HeartBeatFSMStrategyInterfaceMock> hbMock;
     ON_CALL(hbMock, LnnConvertConnAddrTypeToHbType).WillByDefault(Return(CONNECTION_ADDR_WLAN));
     ON_CALL(hbMock, LnnRemoveCheckDevStatusMsg).WillByDefault(Return());
+    EXPECT_CALL(hbMock, LnnRemoveOfflineDeadlineFromHbFsm).Times(1);
     int32_t ret = LnnStopOfflineTimingStrategy(nullptr, CONNECTION_ADDR_WLAN);
     EXPECT_TRUE(ret == SOFTBUS_INVALID_PARAM);
     ret = LnnStopOfflineTimingStrategy(NETWORKID, CONNECTION_ADDR_WLAN);
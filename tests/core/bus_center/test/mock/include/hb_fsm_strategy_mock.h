@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -50,10 +50,13 @@ public:
         LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *para, uint64_t delayMillis) = 0;
     virtual int32_t LnnPostScreenOffCheckDevMsgToHbFsm(
         LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *para, uint64_t delayMillis) = 0;
+    virtual int32_t LnnSetOfflineDeadlineToHbFsm(
+        LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *para, uint64_t delayMillis) = 0;
     virtual LnnHeartbeatFsm *LnnCreateHeartbeatFsm(void) = 0;
     virtual int32_t LnnStartHeartbeatFsm(LnnHeartbeatFsm *hbFsm) = 0;
     virtual void LnnRemoveScreenOffCheckStatusMsg(LnnHeartbeatFsm *hbFsm, LnnCheckDevStatusMsgPara *msgPara) = 0;
     virtual void LnnRemoveCheckDevStatusMsg(LnnHeartbeatFsm *hbFsm, LnnCheckDevStatusMsgPara *msgPara) = 0;
+    virtual void LnnRemoveOfflineDeadlineFromHbFsm(LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *msgPara) = 0;
     virtual int32_t LnnPostStopMsgToHbFsm(LnnHeartbeatFsm *hbFsm, LnnHeartbeatType type) = 0;
     virtual int32_t LnnStopHeartbeatFsm(LnnHeartbeatFsm *hbFsm) = 0;
     virtual void LnnRemoveSendEndMsg(
@@ -97,10 +100,13 @@ public:
         LnnPostCheckDevStatusMsgToHbFsm, int32_t(LnnHeartbeatFsm *, const LnnCheckDevStatusMsgPara *, uint64_t));
     MOCK_METHOD3(
         LnnPostScreenOffCheckDevMsgToHbFsm, int32_t(LnnHeartbeatFsm *, const LnnCheckDevStatusMsgPara *, uint64_t));
+    MOCK_METHOD3(
+        LnnSetOfflineDeadlineToHbFsm, int32_t(LnnHeartbeatFsm *, const LnnCheckDevStatusMsgPara *, uint64_t));
     MOCK_METHOD0(LnnCreateHeartbeatFsm, LnnHeartbeatFsm *());
     MOCK_METHOD1(LnnStartHeartbeatFsm, int32_t(LnnHeartbeatFsm *));
     MOCK_METHOD2(LnnRemoveScreenOffCheckStatusMsg, void(LnnHeartbeatFsm *, LnnCheckDevStatusMsgPara *));
     MOCK_METHOD2(LnnRemoveCheckDevStatusMsg, void(LnnHeartbeatFsm *, LnnCheckDevStatusMsgPara *));
+    MOCK_METHOD2(LnnRemoveOfflineDeadlineFromHbFsm, void(LnnHeartbeatFsm *, const LnnCheckDevStatusMsgPara *));
     MOCK_METHOD2(LnnPostStopMsgToHbFsm, int32_t(LnnHeartbeatFsm *, LnnHeartbeatType));
     MOCK_METHOD1(LnnStopHeartbeatFsm, int32_t(LnnHeartbeatFsm *));
     MOCK_METHOD4(LnnRemoveSendEndMsg, void(LnnHeartbeatFsm *, LnnProcessSendOnceMsgPara *, bool, bool *));
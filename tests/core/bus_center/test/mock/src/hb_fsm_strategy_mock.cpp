@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -102,6 +102,12 @@ int32_t LnnPostScreenOffCheckDevMsgToHbFsm(
     return HeartBeatFSMStrategyInterfaceInstance()->LnnPostScreenOffCheckDevMsgToHbFsm(hbFsm, para, delayMillis);
 }
 
+int32_t LnnSetOfflineDeadlineToHbFsm(
+    LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *para, uint64_t delayMillis)
+{
+    return HeartBeatFSMStrategyInterfaceInstance()->LnnSetOfflineDeadlineToHbFsm(hbFsm, para, delayMillis);
+}
+
 LnnHeartbeatFsm *LnnCreateHeartbeatFsm(void)
 {
     return HeartBeatFSMStrategyInterfaceInstance()->LnnCreateHeartbeatFsm();
@@ -122,6 +128,11 @@ void LnnRemoveCheckDevStatusMsg(LnnHeartbeatFsm *hbFsm, LnnCheckDevStatusMsgPara
     return HeartBeatFSMStrategyInterfaceInstance()->LnnRemoveCheckDevStatusMsg(hbFsm, msgPara);
 }
 
+void LnnRemoveOfflineDeadlineFromHbFsm(LnnHeartbeatFsm *hbFsm, const LnnCheckDevStatusMsgPara *msgPara)
+{
+    return HeartBeatFSMStrategyInterfaceInstance()->LnnRemoveOfflineDeadlineFromHbFsm(hbFsm, msgPara);
+}
+
 int32_t LnnPostStopMsgToHbFsm(LnnHeartbeatFsm *hbFsm, LnnHeartbeatType type)
 {
     return HeartBeatFSMStrategyInterfaceInstance()->LnnPostStopMsgToHbFsm(hbFsm, type);
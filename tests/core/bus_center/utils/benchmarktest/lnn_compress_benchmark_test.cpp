@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+#include <vector>
+
+#include "lnn_compress.h"
+#include "softbus_adapter_mem.h"
+#include "softbus_error_code.h"
+
+namespace OHOS {
+static constexpr int32_t SAMPLE_NUM = 16;
+
+static std::string BuildDeviceInfoPayload(int32_t index)
+{
+    std::string idx = std::to_string(index);
+    return "{\"SW_VERSION\":\"OpenHarmony 6.0\",\"SW_VERSION_TYPE\":\"release\",\"DEVICE_NAME\":\"device " + idx +
+        "\",\"UNIFIED_DEVICE_NAME\":\"\",\"UNIFIED_DEFAULT_DEVICE_NAME\":\"\",\"SETTINGS_NICK_NAME\":\"\","
+        "\"DEVICE_TYPE\":\"PHONE\",\"DEVICE_UDID\":\"8A5B2C4D6E8F0A1B3C5D7E9F0A2B4C6D8E0F1A3B5C7D9E0F2A4B6C8D" + idx +
+        "\",\"NETWORK_ID\":\"2F1E0D9C8B7A69584736251403F2E1D0C9B8A79685746352413F2E1D0C9B8A" + idx +
+        "\",\"UUID\":\"1D2C3B4A59687F6E5D4C3B2A19087F6E5D4C3B2A19087F6E5D4C3B2A1908" + idx +
+        "\",\"BT_MAC\":\"00:00:00:00:00:00\",\"P2P_MAC_ADDR\":\"12:34:56:78:9a:" + idx +
+        "\",\"WIFI_CFG\":\"\",\"CHAN_LIST_5G\":\"36##40##44##48##149##153##157##161\",\"STA_FREQUENCY\":-1,"
+        "\"MASTER_WEIGHT\":1000,\"CONN_CAP\":127,\"NEW_CONN_CAP\":127,\"AUTH_CAP\":3,\"HB_CAP\":3,"
+        "\"OS_TYPE\":10,\"OS_VERSION\":\"OpenHarmony 6.0\",\"PKG_VERSION\":\"hm.1.0.0\",\"FEATURE\":33521662,"
+        "\"WIFI_BUFF_SIZE\":32768,\"BR_BUFF_SIZE\":4096,\"IS_SCREENON\":true,\"ACCOUNT_ID\":\"123456789\"}";
+}
+
+static std::vector<std::string> BuildSamples()
+{
+    std::vector<std::string> samples;
+    for (int32_t i = 0; i < SAMPLE_NUM; i++) {
+        samples.push_back(BuildDeviceInfoPayload(i));
+    }
+    return samples;
+}
+
+static void CompressTestCase(benchmark::State &state, CompressDictType dictType)
+{
+    std::vector<std::string> samples = BuildSamples();
+    uint64_t inBytes = 0;
+    uint64_t outBytes = 0;
+    size_t index = 0;
+    for (auto _ : state) {
+        std::string &payload = samples[index++ % samples.size()];
+        uint8_t *out = nullptr;
+        uint32_t outLen = 0;
+        if (DataCompressWithDict(dictType, (uint8_t *)payload.c_str(), payload.size() + 1, &out, &outLen) !=
+            SOFTBUS_OK) {
+            state.SkipWithError("DataCompressWithDict failed.");
+            break;
+        }
+        inBytes += payload.size() + 1;
+        outBytes += outLen;
+        SoftBusFree(out);
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(inBytes);
+    state.counters["ratio"] = (outBytes == 0) ? 0 : static_cast<double>(inBytes) / outBytes;
+}
+
+static void DecompressTestCase(benchmark::State &state, CompressDictType dictType)
+{
+    std::vector<std::string> samples = BuildSamples();
+    std::vector<std::pair<uint8_t *, uint32_t>> compressed;
+    for (auto &payload : samples) {
+        uint8_t *out = nullptr;
+        uint32_t outLen = 0;
+        if (DataCompressWithDict(dictType, (uint8_t *)payload.c_str(), payload.size() + 1, &out, &outLen) !=
+            SOFTBUS_OK) {
+            state.SkipWithError("DataCompressWithDict failed.");
+            break;
+        }
+        compressed.emplace_back(out, outLen);
+    }
+    size_t index = 0;
+    for (auto _ : state) {
+        if (compressed.size() != samples.size()) {
+            break;
+        }
+        auto &data = compressed[index++ % compressed.size()];
+        uint8_t *out = nullptr;
+        uint32_t outLen = 0;
+        if (DataDecompress(data.first, data.second, &out, &outLen) != SOFTBUS_OK) {
+            state.SkipWithError("DataDecompress failed.");
+            break;
+        }
+        SoftBusFree(out);
+    }
+    for (auto &data : compressed) {
+        SoftBusFree(data.first);
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+
+/**
+ * @tc.name: CompressTestCase
+ * @tc.desc: device info compress Performance Testing, gzip and preset dictionary
+ * @tc.type: FUNC
+ * @tc.require: DataCompressWithDict normal operation
+ */
+BENCHMARK_CAPTURE(CompressTestCase, Gzip, COMPRESS_DICT_NONE);
+BENCHMARK_CAPTURE(CompressTestCase, DeviceInfoDict, COMPRESS_DICT_DEVICE_INFO);
+
+/**
+ * @tc.name: DecompressTestCase
+ * @tc.desc: device info decompress Performance Testing, gzip and preset dictionary
+ * @tc.type: FUNC
+ * @tc.require: DataDecompress normal operation
+ */
+BENCHMARK_CAPTURE(DecompressTestCase, Gzip, COMPRESS_DICT_NONE);
+BENCHMARK_CAPTURE(DecompressTestCase, DeviceInfoDict, COMPRESS_DICT_DEVICE_INFO);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <deque>
+#include <securec.h>
+
+#include "lnn_state_machine.h"
+#include "softbus_adapter_mem.h"
+#include "softbus_error_code.h"
+
+namespace OHOS {
+static constexpr uint32_t MSG_TYPE_CHECK = 1;
+static constexpr uint32_t MSG_TYPE_ROLE = 2;
+static constexpr uint32_t BURST_NUM = 64;
+
+/* the size of the heartbeat check dev status parameter */
+typedef struct {
+    bool hasNetworkId;
+    bool isWakeUp;
+    char networkId[65];
+    int32_t hbType;
+    int32_t addrType;
+    uint64_t checkDelay;
+} BenchCheckPara;
+
+static std::deque<SoftBusMessage *> g_msgQueue;
+static bool g_isParaOwnedByState = false;
+
+static void QueuePostMessage(const SoftBusLooper *looper, SoftBusMessage *msg)
+{
+    (void)looper;
+    g_msgQueue.push_back(msg);
+}
+
+static void QueuePostMessageDelay(const SoftBusLooper *looper, SoftBusMessage *msg, uint64_t delayMillis)
+{
+    (void)looper;
+    (void)delayMillis;
+    g_msgQueue.push_back(msg);
+}
+
+static void QueueRemoveMessageCustom(const SoftBusLooper *looper, const SoftBusHandler *handler,
+    int (*customFunc)(const SoftBusMessage*, void*), void *args)
+{
+    (void)looper;
+    for (auto it = g_msgQueue.begin(); it != g_msgQueue.end();) {
+        if ((*it)->handler == handler && customFunc(*it, args) == 0) {
+            (*it)->FreeMessage(*it);
+            it = g_msgQueue.erase(it);
+            continue;
+        }
+        ++it;
+    }
+}
+
+static void QueueDispatch(void)
+{
+    while (!g_msgQueue.empty()) {
+        SoftBusMessage *msg = g_msgQueue.front();
+        g_msgQueue.pop_front();
+        msg->handler->HandleMessage(msg);
+        msg->FreeMessage(msg);
+    }
+}
+
+static bool BenchProcess(FsmStateMachine *fsm, int32_t msgType, void *para)
+{
+    (void)fsm;
+    if (msgType == MSG_TYPE_CHECK && g_isParaOwnedByState) {
+        SoftBusFree(para);
+    }
+    return true;
+}
+
+static FsmState g_benchState = {
+    .process = BenchProcess,
+};
+
+static bool InitBenchFsm(FsmStateMachine *fsm, SoftBusLooper *looper)
+{
+    (void)memset_s(looper, sizeof(SoftBusLooper), 0, sizeof(SoftBusLooper));
+    looper->PostMessage = QueuePostMessage;
+    looper->PostMessageDelay = QueuePostMessageDelay;
+    looper->RemoveMessageCustom = QueueRemoveMessageCustom;
+    if (LnnFsmInit(fsm, looper, (char *)"BenchFsm", nullptr) != SOFTBUS_OK ||
+        LnnFsmAddState(fsm, &g_benchState) != SOFTBUS_OK || LnnFsmStart(fsm, &g_benchState) != SOFTBUS_OK) {
+        return false;
+    }
+    QueueDispatch();
+    return true;
+}
+
+/**
+ * @tc.name: PostCallocParaTestCase
+ * @tc.desc: a burst of check messages each with a calloc copied para freed by the state Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: previous LnnFsmPostMessageDelay with a heap para
+ */
+static void PostCallocParaTestCase(benchmark::State &state)
+{
+    FsmStateMachine fsm;
+    SoftBusLooper looper;
+    if (!InitBenchFsm(&fsm, &looper)) {
+        state.SkipWithError("PostCallocParaTestCase init fsm failed.");
+        return;
+    }
+    BenchCheckPara para = { .hasNetworkId = true };
+    g_isParaOwnedByState = true;
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < BURST_NUM; i++) {
+            BenchCheckPara *dupPara = static_cast<BenchCheckPara *>(SoftBusCalloc(sizeof(BenchCheckPara)));
+            if (dupPara == nullptr || memcpy_s(dupPara, sizeof(BenchCheckPara), &para, sizeof(para)) != EOK ||
+                LnnFsmPostMessageDelay(&fsm, MSG_TYPE_CHECK, dupPara, 0) != SOFTBUS_OK) {
+                state.SkipWithError("PostCallocParaTestCase post failed.");
+                SoftBusFree(dupPara);
+                break;
+            }
+        }
+        QueueDispatch();
+    }
+    g_isParaOwnedByState = false;
+}
+BENCHMARK(PostCallocParaTestCase);
+
+/**
+ * @tc.name: PostCopyParaTestCase
+ * @tc.desc: a burst of check messages each carrying its para inline Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: LnnFsmPostMessageCopy normal operation
+ */
+static void PostCopyParaTestCase(benchmark::State &state)
+{
+    FsmStateMachine fsm;
+    SoftBusLooper looper;
+    if (!InitBenchFsm(&fsm, &looper)) {
+        state.SkipWithError("PostCopyParaTestCase init fsm failed.");
+        return;
+    }
+    BenchCheckPara para = { .hasNetworkId = true };
+    FsmMsgStats before = { 0 };
+    LnnFsmGetMsgStats(&before);
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < BURST_NUM; i++) {
+            if (LnnFsmPostMessageCopy(&fsm, MSG_TYPE_CHECK, &para, sizeof(para), 0) != SOFTBUS_OK) {
+                state.SkipWithError("PostCopyParaTestCase post failed.");
+                break;
+            }
+        }
+        QueueDispatch();
+    }
+    FsmMsgStats after = { 0 };
+    LnnFsmGetMsgStats(&after);
+    state.counters["allocAvoided"] = static_cast<double>(after.allocAvoided - before.allocAvoided) /
+        (state.iterations() == 0 ? 1 : state.iterations());
+}
+BENCHMARK(PostCopyParaTestCase);
+
+/**
+ * @tc.name: PostCoalescedTestCase
+ * @tc.desc: a burst of role switch messages of a coalescable type handled once Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: LnnFsmSetCoalescable normal operation
+ */
+static void PostCoalescedTestCase(benchmark::State &state)
+{
+    FsmStateMachine fsm;
+    SoftBusLooper looper;
+    if (!InitBenchFsm(&fsm, &looper) || LnnFsmSetCoalescable(&fsm, MSG_TYPE_ROLE) != SOFTBUS_OK) {
+        state.SkipWithError("PostCoalescedTestCase init fsm failed.");
+        return;
+    }
+    FsmMsgStats before = { 0 };
+    LnnFsmGetMsgStats(&before);
+    for (auto _ : state) {
+        for (uint32_t i = 0; i < BURST_NUM; i++) {
+            if (LnnFsmPostMessage(&fsm, MSG_TYPE_ROLE, nullptr) != SOFTBUS_OK) {
+                state.SkipWithError("PostCoalescedTestCase post failed.");
+                break;
+            }
+        }
+        QueueDispatch();
+    }
+    FsmMsgStats after = { 0 };
+    LnnFsmGetMsgStats(&after);
+    state.counters["merged"] = static_cast<double>(after.mergedNum - before.mergedNum) /
+        (state.iterations() == 0 ? 1 : state.iterations());
+}
+BENCHMARK(PostCoalescedTestCase);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,6 +14,9 @@
  */
 
 #include <gtest/gtest.h>
+#include <string>
+#include <thread>
+#include <vector>
 
 #include "bus_center_utils_mock.h"
 #include "lnn_async_callback_utils.h"
@@ -35,6 +38,9 @@ static Map g_bcUtilsMap;
 #define NETWORK_ID_BUF_LEN 65
 #define HDF_MAP_VALUE_MAX_SIZE 4000
 #define FSM_MSG_TYPE_JOIN_LNN_TIMEOUT 6
+#define FSM_MSG_TYPE_TEST_COPY 1
+#define FSM_MSG_TYPE_TEST_COALESCE 2
+#define FSM_TEST_LARGE_PARA_LEN 256
 
 class BusCenterUtilsTest : public testing::Test {
 public:
@@ -79,6 +85,76 @@ static SoftBusHandler g_buscenterUtilsHandler = {
     .name = (char *)"g_buscenterUtilsHandler"
 };
 
+static std::vector<SoftBusMessage *> g_fsmMsgQueue;
+static std::vector<uint8_t> g_fsmProcessPara;
+static uint32_t g_fsmProcessNum = 0;
+
+static void FsmQueuePostMessage(const SoftBusLooper *looper, SoftBusMessage *msg)
+{
+    (void)looper;
+    g_fsmMsgQueue.push_back(msg);
+}
+
+static void FsmQueuePostMessageDelay(const SoftBusLooper *looper, SoftBusMessage *msg, uint64_t delayMillis)
+{
+    (void)looper;
+    (void)delayMillis;
+    g_fsmMsgQueue.push_back(msg);
+}
+
+static void FsmQueueRemoveMessageCustom(const SoftBusLooper *looper, const SoftBusHandler *handler,
+    int (*customFunc)(const SoftBusMessage*, void*), void *args)
+{
+    (void)looper;
+    for (auto it = g_fsmMsgQueue.begin(); it != g_fsmMsgQueue.end();) {
+        SoftBusMessage *msg = *it;
+        if (msg->handler == handler && customFunc(msg, args) == 0) {
+            msg->FreeMessage(msg);
+            it = g_fsmMsgQueue.erase(it);
+            continue;
+        }
+        ++it;
+    }
+}
+
+static void FsmQueueDispatch(void)
+{
+    while (!g_fsmMsgQueue.empty()) {
+        SoftBusMessage *msg = g_fsmMsgQueue.front();
+        g_fsmMsgQueue.erase(g_fsmMsgQueue.begin());
+        msg->handler->HandleMessage(msg);
+        msg->FreeMessage(msg);
+    }
+}
+
+static bool FsmTestProcess(FsmStateMachine *fsm, int32_t msgType, void *para)
+{
+    (void)fsm;
+    g_fsmProcessNum++;
+    if (msgType == FSM_MSG_TYPE_TEST_COPY && para != nullptr) {
+        uint8_t *data = static_cast<uint8_t *>(para);
+        g_fsmProcessPara.assign(data, data + g_fsmProcessPara.size());
+    }
+    return true;
+}
+
+static FsmState g_fsmTestState = {
+    .process = FsmTestProcess,
+};
+
+static void InitTestFsm(FsmStateMachine *fsm, SoftBusLooper *looper)
+{
+    (void)memset_s(looper, sizeof(SoftBusLooper), 0, sizeof(SoftBusLooper));
+    looper->PostMessage = FsmQueuePostMessage;
+    looper->PostMessageDelay = FsmQueuePostMessageDelay;
+    looper->RemoveMessageCustom = FsmQueueRemoveMessageCustom;
+    ASSERT_EQ(LnnFsmInit(fsm, looper, (char *)"FsmTest", nullptr), SOFTBUS_OK);
+    ASSERT_EQ(LnnFsmAddState(fsm, &g_fsmTestState), SOFTBUS_OK);
+    ASSERT_EQ(LnnFsmStart(fsm, &g_fsmTestState), SOFTBUS_OK);
+    FsmQueueDispatch();
+    g_fsmProcessNum = 0;
+}
+
 /*
 * @tc.name: GET_UUID_FROM_FILE_TEST_001
 * @tc.desc: get uuid from file test
@@ -590,6 +666,119 @@ HWTEST_F(BusCenterUtilsTest, DATA_DE_COMPRESS_TEST_001, TestSize.Level1)
     EXPECT_EQ(ret, SOFTBUS_INVALID_PARAM);
 }
 
+static std::string BuildDeviceInfoPayload(int32_t index)
+{
+    std::string idx = std::to_string(index);
+    return "{\"SW_VERSION\":\"OpenHarmony 6.0\",\"DEVICE_NAME\":\"device " + idx +
+        "\",\"DEVICE_TYPE\":\"PHONE\",\"DEVICE_UDID\":\"8A5B2C4D6E8F0A1B3C5D7E9F0A2B4C6D" + idx +
+        "\",\"NETWORK_ID\":\"2F1E0D9C8B7A69584736251403F2E1D0" + idx +
+        "\",\"BT_MAC\":\"00:00:00:00:00:00\",\"P2P_MAC_ADDR\":\"00:00:00:00:00:00\","
+        "\"WIFI_CFG\":\"\",\"CHAN_LIST_5G\":\"36##40##44##48##149##153##157##161\",\"MASTER_WEIGHT\":1000,"
+        "\"CONN_CAP\":127,\"NEW_CONN_CAP\":127,\"AUTH_CAP\":3,\"FEATURE\":33521662,\"STA_FREQUENCY\":-1}";
+}
+
+static void CheckRoundTrip(CompressDictType dictType, const std::string &payload, uint32_t *compressLen)
+{
+    uint8_t *compressData = nullptr;
+    uint8_t *decompressData = nullptr;
+    uint32_t decompressLen = 0;
+    EXPECT_EQ(SOFTBUS_OK, DataCompressWithDict(dictType, (uint8_t *)payload.c_str(), payload.size() + 1,
+        &compressData, compressLen));
+    ASSERT_NE(compressData, nullptr);
+    EXPECT_EQ(SOFTBUS_OK, DataDecompress(compressData, *compressLen, &decompressData, &decompressLen));
+    ASSERT_NE(decompressData, nullptr);
+    EXPECT_EQ(decompressLen, payload.size() + 1);
+    EXPECT_STREQ((const char *)decompressData, payload.c_str());
+    SoftBusFree(compressData);
+    SoftBusFree(decompressData);
+}
+
+/*
+* @tc.name: DATA_COMPRESS_WITH_DICT_TEST_001
+* @tc.desc: data compress with dict param invalid test
+* @tc.type: FUNC
+* @tc.level: Level1
+* @tc.require:
+*/
+HWTEST_F(BusCenterUtilsTest, DATA_COMPRESS_WITH_DICT_TEST_001, TestSize.Level1)
+{
+    std::string payload = BuildDeviceInfoPayload(0);
+    uint8_t *out = nullptr;
+    uint32_t outLen = 0;
+    EXPECT_EQ(SOFTBUS_INVALID_PARAM, DataCompressWithDict(COMPRESS_DICT_BUTT, (uint8_t *)payload.c_str(),
+        payload.size(), &out, &outLen));
+    EXPECT_EQ(SOFTBUS_INVALID_PARAM, DataCompressWithDict(COMPRESS_DICT_DEVICE_INFO, nullptr, 0, &out, &outLen));
+    EXPECT_EQ(SOFTBUS_INVALID_PARAM, DataCompressWithDict(COMPRESS_DICT_DEVICE_INFO, (uint8_t *)payload.c_str(),
+        payload.size(), nullptr, &outLen));
+    EXPECT_EQ(out, nullptr);
+}
+
+/*
+* @tc.name: DATA_COMPRESS_WITH_DICT_TEST_002
+* @tc.desc: the streams reused across calls keep round trip, the dictionary output is smaller
+* @tc.type: FUNC
+* @tc.level: Level1
+* @tc.require:
+*/
+HWTEST_F(BusCenterUtilsTest, DATA_COMPRESS_WITH_DICT_TEST_002, TestSize.Level1)
+{
+    for (int32_t i = 0; i < 10; i++) {
+        std::string payload = BuildDeviceInfoPayload(i);
+        uint32_t plainLen = 0;
+        uint32_t dictLen = 0;
+        CheckRoundTrip(COMPRESS_DICT_NONE, payload, &plainLen);
+        CheckRoundTrip(COMPRESS_DICT_DEVICE_INFO, payload, &dictLen);
+        EXPECT_LT(dictLen, plainLen);
+    }
+}
+
+/*
+* @tc.name: DATA_COMPRESS_WITH_DICT_TEST_003
+* @tc.desc: the per thread streams are independent
+* @tc.type: FUNC
+* @tc.level: Level1
+* @tc.require:
+*/
+HWTEST_F(BusCenterUtilsTest, DATA_COMPRESS_WITH_DICT_TEST_003, TestSize.Level1)
+{
+    std::vector<std::thread> threads;
+    for (int32_t i = 0; i < 4; i++) {
+        threads.emplace_back([i]() {
+            for (int32_t loop = 0; loop < 100; loop++) {
+                uint32_t compressLen = 0;
+                CompressDictType dictType = (loop % 2 == 0) ? COMPRESS_DICT_NONE : COMPRESS_DICT_DEVICE_INFO;
+                CheckRoundTrip(dictType, BuildDeviceInfoPayload(i * 100 + loop), &compressLen);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+}
+
+/*
+* @tc.name: DATA_DE_COMPRESS_TEST_002
+* @tc.desc: corrupted data fails and does not break the next decompress
+* @tc.type: FUNC
+* @tc.level: Level1
+* @tc.require:
+*/
+HWTEST_F(BusCenterUtilsTest, DATA_DE_COMPRESS_TEST_002, TestSize.Level1)
+{
+    std::string payload = BuildDeviceInfoPayload(1);
+    uint8_t *compressData = nullptr;
+    uint32_t compressLen = 0;
+    ASSERT_EQ(SOFTBUS_OK, DataCompressWithDict(COMPRESS_DICT_DEVICE_INFO, (uint8_t *)payload.c_str(),
+        payload.size() + 1, &compressData, &compressLen));
+    uint8_t *out = nullptr;
+    uint32_t outLen = 0;
+    EXPECT_EQ(SOFTBUS_INFLATE_FAIL, DataDecompress(compressData, compressLen / 2, &out, &outLen));
+    compressData[2] ^= 0xFF;
+    EXPECT_EQ(SOFTBUS_INFLATE_FAIL, DataDecompress(compressData, compressLen, &out, &outLen));
+    SoftBusFree(compressData);
+    CheckRoundTrip(COMPRESS_DICT_DEVICE_INFO, payload, &compressLen);
+}
+
 /*
 * @tc.name: LNN_FSM_POST_MESSAGE_DELAY_TEST_001
 * @tc.desc: lnn fsm post message delay test
@@ -684,6 +873,88 @@ HWTEST_F(BusCenterUtilsTest, LNN_FSM_REMOVE_MESSAGE_TEST_001, TestSize.Level1)
     SoftBusFree(fsm);
 }
 
+/*
+* @tc.name: LNN_FSM_POST_MESSAGE_COPY_TEST_001
+* @tc.desc: lnn fsm post message copy hands a copy of the para to the state and releases it with the message
+* @tc.type: FUNC
+* @tc.level: Level1
+* @tc.require:
+*/
+HWTEST_F(BusCenterUtilsTest, LNN_FSM_POST_MESSAGE_COPY_TEST_001, TestSize.Level1)
+{
+    uint8_t para[FSM_MSG_INLINE_PARA_LEN] = { 0 };
+    EXPECT_EQ(LnnFsmPostMessageCopy(nullptr, FSM_MSG_TYPE_TEST_COPY, para, sizeof(para), 0), SOFTBUS_INVALID_PARAM);
+
+    FsmStateMachine fsm;
+    SoftBusLooper loop;
+    InitTestFsm(&fsm, &loop);
+    FsmMsgStats before = { 0 };
+    LnnFsmGetMsgStats(&before);
+    for (uint32_t i = 0; i < sizeof(para); i++) {
+        para[i] = static_cast<uint8_t>(i);
+    }
+    EXPECT_EQ(LnnFsmPostMessageCopy(&fsm, FSM_MSG_TYPE_TEST_COPY, para, sizeof(para), 0), SOFTBUS_OK);
+    // the caller keeps its buffer, the message carries its own copy
+    (void)memset_s(para, sizeof(para), 0, sizeof(para));
+    g_fsmProcessPara.assign(sizeof(para), 0);
+    FsmQueueDispatch();
+    EXPECT_EQ(g_fsmProcessNum, 1U);
+    for (uint32_t i = 0; i < sizeof(para); i++) {
+        EXPECT_EQ(g_fsmProcessPara[i], static_cast<uint8_t>(i));
+    }
+    FsmMsgStats after = { 0 };
+    LnnFsmGetMsgStats(&after);
+    EXPECT_GT(after.allocAvoided, before.allocAvoided);
+
+    std::vector<uint8_t> largePara(FSM_TEST_LARGE_PARA_LEN, 0x5A);
+    EXPECT_EQ(LnnFsmPostMessageCopy(&fsm, FSM_MSG_TYPE_TEST_COPY, largePara.data(), FSM_TEST_LARGE_PARA_LEN, 0),
+        SOFTBUS_OK);
+    g_fsmProcessPara.assign(FSM_TEST_LARGE_PARA_LEN, 0);
+    FsmQueueDispatch();
+    EXPECT_EQ(g_fsmProcessPara, largePara);
+
+    // a removed message releases its copy without the state seeing it
+    EXPECT_EQ(LnnFsmPostMessageCopy(&fsm, FSM_MSG_TYPE_TEST_COPY, largePara.data(), FSM_TEST_LARGE_PARA_LEN, 0),
+        SOFTBUS_OK);
+    EXPECT_EQ(LnnFsmRemoveMessage(&fsm, FSM_MSG_TYPE_TEST_COPY), SOFTBUS_OK);
+    EXPECT_TRUE(g_fsmMsgQueue.empty());
+    EXPECT_EQ(g_fsmProcessNum, 2U);
+}
+
+/*
+* @tc.name: LNN_FSM_SET_COALESCABLE_TEST_001
+* @tc.desc: lnn fsm keeps one pending message of a coalescable type and counts the merged ones
+* @tc.type: FUNC
+* @tc.level: Level1
+* @tc.require:
+*/
+HWTEST_F(BusCenterUtilsTest, LNN_FSM_SET_COALESCABLE_TEST_001, TestSize.Level1)
+{
+    FsmStateMachine fsm;
+    SoftBusLooper loop;
+    EXPECT_EQ(LnnFsmSetCoalescable(nullptr, FSM_MSG_TYPE_TEST_COALESCE), SOFTBUS_INVALID_PARAM);
+    InitTestFsm(&fsm, &loop);
+    EXPECT_EQ(LnnFsmSetCoalescable(&fsm, FSM_MSG_COALESCE_TYPE_MAX), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(LnnFsmSetCoalescable(&fsm, FSM_MSG_TYPE_TEST_COALESCE), SOFTBUS_OK);
+
+    FsmMsgStats before = { 0 };
+    LnnFsmGetMsgStats(&before);
+    EXPECT_EQ(LnnFsmPostMessage(&fsm, FSM_MSG_TYPE_TEST_COALESCE, nullptr), SOFTBUS_OK);
+    EXPECT_EQ(LnnFsmPostMessageDelay(&fsm, FSM_MSG_TYPE_TEST_COALESCE, nullptr, 0), SOFTBUS_OK);
+    EXPECT_EQ(LnnFsmPostMessage(&fsm, FSM_MSG_TYPE_TEST_COALESCE, nullptr), SOFTBUS_OK);
+    EXPECT_EQ(g_fsmMsgQueue.size(), 1U);
+    FsmMsgStats after = { 0 };
+    LnnFsmGetMsgStats(&after);
+    EXPECT_EQ(after.mergedNum - before.mergedNum, 2U);
+
+    // other types still queue up
+    EXPECT_EQ(LnnFsmPostMessage(&fsm, FSM_MSG_TYPE_TEST_COPY, nullptr), SOFTBUS_OK);
+    EXPECT_EQ(LnnFsmPostMessage(&fsm, FSM_MSG_TYPE_TEST_COPY, nullptr), SOFTBUS_OK);
+    EXPECT_EQ(g_fsmMsgQueue.size(), 3U);
+    FsmQueueDispatch();
+    EXPECT_EQ(g_fsmProcessNum, 3U);
+}
+
 /*
 * @tc.name: LNN_MAP_NEXT_TEST_001
 * @tc.desc: lnn map next test
@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <cstring>
+#include <securec.h>
+#include <sys/stat.h>
+
+#include "softbus_adapter_file.h"
+#include "softbus_error_code.h"
+#include "sqlite3_utils.h"
+
+namespace OHOS {
+// a trusted device table of 10k records: 100 accounts with 100 devices each
+static constexpr uint32_t ACCOUNT_NUM = 100;
+static constexpr uint32_t DEVICE_NUM = 100;
+static constexpr uint32_t RECORD_NUM = ACCOUNT_NUM * DEVICE_NUM;
+static constexpr int64_t REPLAY_NUM = 5;
+
+/* the insert statement InsertRecord compiled for every row before the statement cache */
+static constexpr char SQL_INSERT_TRUSTED_DEV_INFO[] =
+    "INSERT INTO TrustedDeviceInfo (accountHash, udid) VALUES (?, ?)";
+
+static TrustedDevInfoRecord g_records[RECORD_NUM];
+
+static DbContext *OpenBenchDb(benchmark::State &state)
+{
+    DbContext *ctx = nullptr;
+    (void)mkdir(DEFAULT_STORAGE_PATH "/dsoftbus", S_IRWXU);
+    SoftBusRemoveFile(DATABASE_NAME);
+    if (OpenDatabase(&ctx) != SOFTBUS_OK || CreateTable(ctx, TABLE_TRUSTED_DEV_INFO) != SOFTBUS_OK) {
+        state.SkipWithError("open benchmark database failed.");
+        if (ctx != nullptr) {
+            (void)CloseDatabase(ctx);
+        }
+        return nullptr;
+    }
+    for (uint32_t i = 0; i < RECORD_NUM; i++) {
+        (void)sprintf_s(g_records[i].accountHexHash, sizeof(g_records[i].accountHexHash), "account%08u",
+            i / DEVICE_NUM);
+        (void)sprintf_s(g_records[i].udid, sizeof(g_records[i].udid), "udid%08u", i);
+    }
+    return ctx;
+}
+
+static void CloseBenchDb(DbContext *ctx)
+{
+    (void)DeleteTable(ctx, TABLE_TRUSTED_DEV_INFO);
+    (void)CloseDatabase(ctx);
+    SoftBusRemoveFile(DATABASE_NAME);
+}
+
+static bool InsertOnePrepared(DbContext *ctx, const TrustedDevInfoRecord *record)
+{
+    sqlite3_stmt *stmt = nullptr;
+    if (sqlite3_prepare_v2(ctx->db, SQL_INSERT_TRUSTED_DEV_INFO, strlen(SQL_INSERT_TRUSTED_DEV_INFO), &stmt,
+        nullptr) != SQLITE_OK) {
+        return false;
+    }
+    (void)sqlite3_bind_text(stmt, 1, record->accountHexHash, strlen(record->accountHexHash), SQLITE_STATIC);
+    (void)sqlite3_bind_text(stmt, 2, record->udid, strlen(record->udid), SQLITE_STATIC);
+    int32_t rc = sqlite3_step(stmt);
+    (void)sqlite3_finalize(stmt);
+    return rc == SQLITE_DONE;
+}
+
+/**
+ * @tc.name: PrepareEachRowTestCase
+ * @tc.desc: Insert 10k trusted device records compiling the statement per row in one transaction
+ *           Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: previous InsertRecord statement handling
+ */
+static void PrepareEachRowTestCase(benchmark::State &state)
+{
+    DbContext *ctx = OpenBenchDb(state);
+    if (ctx == nullptr) {
+        return;
+    }
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        (void)RemoveAllRecord(ctx, TABLE_TRUSTED_DEV_INFO);
+        state.ResumeTiming();
+        (void)OpenTransaction(ctx);
+        for (uint32_t i = 0; i < RECORD_NUM; i++) {
+            if (!InsertOnePrepared(ctx, &g_records[i])) {
+                state.SkipWithError("PrepareEachRowTestCase insert failed.");
+                break;
+            }
+        }
+        (void)CloseTransaction(ctx, CLOSE_TRANS_COMMIT);
+    }
+    CloseBenchDb(ctx);
+}
+BENCHMARK(PrepareEachRowTestCase)->Iterations(REPLAY_NUM);
+
+/**
+ * @tc.name: InsertRecordTestCase
+ * @tc.desc: Insert 10k trusted device records one InsertRecord call each in one transaction Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: InsertRecord normal operation
+ */
+static void InsertRecordTestCase(benchmark::State &state)
+{
+    DbContext *ctx = OpenBenchDb(state);
+    if (ctx == nullptr) {
+        return;
+    }
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        (void)RemoveAllRecord(ctx, TABLE_TRUSTED_DEV_INFO);
+        state.ResumeTiming();
+        (void)OpenTransaction(ctx);
+        for (uint32_t i = 0; i < RECORD_NUM; i++) {
+            if (InsertRecord(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)&g_records[i]) != SOFTBUS_OK) {
+                state.SkipWithError("InsertRecordTestCase insert failed.");
+                break;
+            }
+        }
+        (void)CloseTransaction(ctx, CLOSE_TRANS_COMMIT);
+    }
+    CloseBenchDb(ctx);
+}
+BENCHMARK(InsertRecordTestCase)->Iterations(REPLAY_NUM);
+
+/**
+ * @tc.name: InsertRecordsTestCase
+ * @tc.desc: Insert 10k trusted device records in one InsertRecords call Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: InsertRecords normal operation
+ */
+static void InsertRecordsTestCase(benchmark::State &state)
+{
+    DbContext *ctx = OpenBenchDb(state);
+    if (ctx == nullptr) {
+        return;
+    }
+    if (state.range(0) != 0 && EnableDbWalMode(ctx) != SOFTBUS_OK) {
+        state.SkipWithError("InsertRecordsTestCase enable wal failed.");
+        CloseBenchDb(ctx);
+        return;
+    }
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        (void)RemoveAllRecord(ctx, TABLE_TRUSTED_DEV_INFO);
+        state.ResumeTiming();
+        if (InsertRecords(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)g_records, RECORD_NUM) != SOFTBUS_OK) {
+            state.SkipWithError("InsertRecordsTestCase insert failed.");
+            break;
+        }
+    }
+    CloseBenchDb(ctx);
+}
+BENCHMARK(InsertRecordsTestCase)->Arg(0)->Arg(1)->Iterations(REPLAY_NUM);
+
+/**
+ * @tc.name: QueryRecordTestCase
+ * @tc.desc: Count and read the devices of every account in a 10k record table Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: GetRecordNumByKey and QueryRecordByKey normal operation
+ */
+static void QueryRecordTestCase(benchmark::State &state)
+{
+    DbContext *ctx = OpenBenchDb(state);
+    if (ctx == nullptr) {
+        return;
+    }
+    if (InsertRecords(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)g_records, RECORD_NUM) != SOFTBUS_OK) {
+        state.SkipWithError("QueryRecordTestCase insert failed.");
+        CloseBenchDb(ctx);
+        return;
+    }
+    static char udids[DEVICE_NUM * UDID_BUF_LEN];
+    uint8_t *reply = (uint8_t *)udids;
+    uint64_t rows = 0;
+    while (state.KeepRunning()) {
+        for (uint32_t i = 0; i < RECORD_NUM; i += DEVICE_NUM) {
+            uint8_t *account = (uint8_t *)g_records[i].accountHexHash;
+            int32_t num = GetRecordNumByKey(ctx, TABLE_TRUSTED_DEV_INFO, account);
+            if (num <= 0 || QueryRecordByKey(ctx, TABLE_TRUSTED_DEV_INFO, account, &reply, num) != SOFTBUS_OK) {
+                state.SkipWithError("QueryRecordTestCase query failed.");
+                break;
+            }
+            rows += (uint64_t)num;
+        }
+    }
+    benchmark::DoNotOptimize(rows);
+    CloseBenchDb(ctx);
+}
+BENCHMARK(QueryRecordTestCase)->Iterations(REPLAY_NUM);
+
+/**
+ * @tc.name: RemoveRecordsTestCase
+ * @tc.desc: Remove 10k trusted device records in one RemoveRecordsByKey call Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: RemoveRecordsByKey normal operation
+ */
+static void RemoveRecordsTestCase(benchmark::State &state)
+{
+    DbContext *ctx = OpenBenchDb(state);
+    if (ctx == nullptr) {
+        return;
+    }
+    while (state.KeepRunning()) {
+        state.PauseTiming();
+        (void)RemoveAllRecord(ctx, TABLE_TRUSTED_DEV_INFO);
+        if (InsertRecords(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)g_records, RECORD_NUM) != SOFTBUS_OK) {
+            state.SkipWithError("RemoveRecordsTestCase insert failed.");
+            break;
+        }
+        state.ResumeTiming();
+        if (RemoveRecordsByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)g_records, RECORD_NUM) != SOFTBUS_OK) {
+            state.SkipWithError("RemoveRecordsTestCase remove failed.");
+            break;
+        }
+    }
+    CloseBenchDb(ctx);
+}
+BENCHMARK(RemoveRecordsTestCase)->Iterations(REPLAY_NUM);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
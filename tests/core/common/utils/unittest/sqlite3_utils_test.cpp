@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -843,4 +843,121 @@ HWTEST_F(Sqlite3UtilsTest, BindParaDouble_Valid_001, TestSize.Level1)
     EXPECT_EQ(DeleteTable(ctx, TABLE_TRUSTED_DEV_INFO), SOFTBUS_OK);
     EXPECT_EQ(CloseDatabase(ctx), SOFTBUS_OK);
 }
+
+/*
+ * @tc.name: Insert_Records_Test_001
+ * @tc.desc: Verify InsertRecords and RemoveRecordsByKey handle many records in one transaction
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(Sqlite3UtilsTest, Insert_Records_Test_001, TestSize.Level1)
+{
+    DbContext *ctx = nullptr;
+    TrustedDevInfoRecord records[] = { g_record1, g_record2, g_record3 };
+    TrustedDevInfoRecord removeRecords[] = { g_record1, g_record3 };
+
+    EXPECT_EQ(InsertRecords(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)records, 3), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(OpenDatabase(&ctx), SOFTBUS_OK);
+    ASSERT_TRUE(ctx != nullptr);
+    EXPECT_EQ(CreateTable(ctx, TABLE_TRUSTED_DEV_INFO), SOFTBUS_OK);
+    EXPECT_EQ(InsertRecords(ctx, TABLE_TRUSTED_DEV_INFO, nullptr, 3), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(InsertRecords(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)records, 0), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(InsertRecords(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)records, 3), SOFTBUS_OK);
+    EXPECT_TRUE(ctx->stmt == nullptr);
+    EXPECT_TRUE(ctx->stmtCache[TABLE_TRUSTED_DEV_INFO][DB_STMT_INSERT] != nullptr);
+    EXPECT_EQ(GetRecordNumByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)USER1_ID), 2);
+    EXPECT_EQ(GetRecordNumByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)USER2_ID), 1);
+
+    EXPECT_EQ(RemoveRecordsByKey(ctx, TABLE_TRUSTED_DEV_INFO, nullptr, 2), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(RemoveRecordsByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)removeRecords, 2), SOFTBUS_OK);
+    EXPECT_EQ(GetRecordNumByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)USER1_ID), 1);
+    EXPECT_EQ(GetRecordNumByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)USER2_ID), 0);
+    EXPECT_EQ(DeleteTable(ctx, TABLE_TRUSTED_DEV_INFO), SOFTBUS_OK);
+    EXPECT_EQ(CloseDatabase(ctx), SOFTBUS_OK);
+}
+
+/*
+ * @tc.name: Insert_Records_Test_002
+ * @tc.desc: Verify InsertRecords rolls back its own transaction on a failed record
+ *           and leaves a transaction opened by the caller to the caller
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(Sqlite3UtilsTest, Insert_Records_Test_002, TestSize.Level1)
+{
+    DbContext *ctx = nullptr;
+    TrustedDevInfoRecord records[] = { g_record1, g_record2, g_record1 };
+
+    EXPECT_EQ(OpenDatabase(&ctx), SOFTBUS_OK);
+    ASSERT_TRUE(ctx != nullptr);
+    EXPECT_EQ(CreateTable(ctx, TABLE_TRUSTED_DEV_INFO), SOFTBUS_OK);
+    EXPECT_EQ(InsertRecords(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)records, 3), SOFTBUS_ERR);
+    EXPECT_EQ(GetRecordNumByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)USER1_ID), 0);
+
+    EXPECT_EQ(OpenTransaction(ctx), SOFTBUS_OK);
+    EXPECT_EQ(InsertRecords(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)records, 2), SOFTBUS_OK);
+    EXPECT_EQ(InsertRecord(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)&g_record3), SOFTBUS_OK);
+    EXPECT_EQ(CloseTransaction(ctx, CLOSE_TRANS_ROLLBACK), SOFTBUS_OK);
+    EXPECT_EQ(GetRecordNumByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)USER1_ID), 0);
+    EXPECT_EQ(GetRecordNumByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)USER2_ID), 0);
+    EXPECT_EQ(DeleteTable(ctx, TABLE_TRUSTED_DEV_INFO), SOFTBUS_OK);
+    EXPECT_EQ(CloseDatabase(ctx), SOFTBUS_OK);
+}
+
+/*
+ * @tc.name: Cached_Stmt_Test_001
+ * @tc.desc: Verify a cached statement is reused across calls and dropped with its table
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(Sqlite3UtilsTest, Cached_Stmt_Test_001, TestSize.Level1)
+{
+    DbContext *ctx = nullptr;
+    char *udid = (char *)SoftBusCalloc(UDID_BUF_LEN);
+    ASSERT_TRUE(udid != nullptr);
+
+    EXPECT_EQ(OpenDatabase(&ctx), SOFTBUS_OK);
+    ASSERT_TRUE(ctx != nullptr);
+    EXPECT_EQ(CreateTable(ctx, TABLE_TRUSTED_DEV_INFO), SOFTBUS_OK);
+    EXPECT_EQ(InsertRecord(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)&g_record1), SOFTBUS_OK);
+    sqlite3_stmt *insertStmt = ctx->stmtCache[TABLE_TRUSTED_DEV_INFO][DB_STMT_INSERT];
+    EXPECT_TRUE(insertStmt != nullptr);
+    EXPECT_EQ(InsertRecord(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)&g_record3), SOFTBUS_OK);
+    EXPECT_EQ(ctx->stmtCache[TABLE_TRUSTED_DEV_INFO][DB_STMT_INSERT], insertStmt);
+    EXPECT_EQ(QueryRecordByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)USER2_ID, (uint8_t **)&udid, 1),
+        SOFTBUS_OK);
+    EXPECT_STREQ(udid, DEVICE1_HASH);
+    EXPECT_TRUE(ctx->stmt == nullptr);
+
+    EXPECT_EQ(DeleteTable(ctx, TABLE_TRUSTED_DEV_INFO), SOFTBUS_OK);
+    EXPECT_TRUE(ctx->stmtCache[TABLE_TRUSTED_DEV_INFO][DB_STMT_INSERT] == nullptr);
+    EXPECT_TRUE(ctx->stmtCache[TABLE_TRUSTED_DEV_INFO][DB_STMT_SEARCH_BY_KEY] == nullptr);
+    EXPECT_EQ(CreateTable(ctx, TABLE_TRUSTED_DEV_INFO), SOFTBUS_OK);
+    EXPECT_EQ(InsertRecord(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)&g_record1), SOFTBUS_OK);
+    EXPECT_EQ(GetRecordNumByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)USER1_ID), 1);
+    EXPECT_EQ(DeleteTable(ctx, TABLE_TRUSTED_DEV_INFO), SOFTBUS_OK);
+    EXPECT_EQ(CloseDatabase(ctx), SOFTBUS_OK);
+    SoftBusFree(udid);
+}
+
+/*
+ * @tc.name: Enable_Db_Wal_Mode_Test_001
+ * @tc.desc: Verify EnableDbWalMode switches the journal to WAL and records still round trip
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(Sqlite3UtilsTest, Enable_Db_Wal_Mode_Test_001, TestSize.Level1)
+{
+    DbContext *ctx = nullptr;
+
+    EXPECT_EQ(EnableDbWalMode(ctx), SOFTBUS_INVALID_PARAM);
+    EXPECT_EQ(OpenDatabase(&ctx), SOFTBUS_OK);
+    ASSERT_TRUE(ctx != nullptr);
+    EXPECT_EQ(EnableDbWalMode(ctx), SOFTBUS_OK);
+    EXPECT_EQ(CreateTable(ctx, TABLE_TRUSTED_DEV_INFO), SOFTBUS_OK);
+    EXPECT_EQ(InsertRecord(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)&g_record1), SOFTBUS_OK);
+    EXPECT_EQ(GetRecordNumByKey(ctx, TABLE_TRUSTED_DEV_INFO, (uint8_t *)USER1_ID), 1);
+    EXPECT_EQ(DeleteTable(ctx, TABLE_TRUSTED_DEV_INFO), SOFTBUS_OK);
+    EXPECT_EQ(CloseDatabase(ctx), SOFTBUS_OK);
+}
 } // namespace OHOS
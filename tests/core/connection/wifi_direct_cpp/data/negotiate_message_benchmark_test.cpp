@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "data/interface_info.h"
+#include "data/link_info.h"
+#include "data/negotiate_message.h"
+#include "protocol/tlv_protocol.h"
+#include "protocol/wifi_direct_protocol_factory.h"
+#include "softbus_error_code.h"
+
+namespace OHOS::SoftBus {
+static constexpr int TEST_BANDWIDTH = 80;
+static constexpr int TEST_CENTER_20M = 5180;
+static constexpr uint32_t TEST_SESSION_ID = 10;
+static constexpr uint32_t TEST_CHALLENGE_CODE = 0x5a5a;
+
+static NegotiateMessage BuildConnectRequest()
+{
+    NegotiateMessage msg(NegotiateMessageType::CMD_CONN_V2_REQ_1);
+    msg.SetSessionId(TEST_SESSION_ID);
+    msg.SetIsModeStrict(true);
+    msg.SetPreferLinkMode(LinkInfo::LinkMode::HML);
+    msg.SetPreferLinkBandWidth(TEST_BANDWIDTH);
+    msg.SetChallengeCode(TEST_CHALLENGE_CODE);
+    msg.Set5GChannelList("36#40#44#48#149#153#157#161");
+    msg.Set5GChannelScore("90#80#70#60#50#40#30#20");
+    msg.SetIpv4InfoArray({ Ipv4Info("172.30.1.1"), Ipv4Info("172.30.1.2") });
+
+    InterfaceInfo interface;
+    interface.SetName("chba0");
+    interface.SetBaseMac("01:02:03:04:05:06");
+    interface.SetRole(LinkInfo::LinkMode::HML);
+    interface.SetCenter20M(TEST_CENTER_20M);
+    interface.SetBandWidth(TEST_BANDWIDTH);
+    msg.SetInterfaceInfoArray({ interface });
+
+    LinkInfo linkInfo("chba0", "chba0", LinkInfo::LinkMode::HML, LinkInfo::LinkMode::HML);
+    linkInfo.SetCenter20M(TEST_CENTER_20M);
+    linkInfo.SetLocalBaseMac("01:02:03:04:05:06");
+    linkInfo.SetRemoteBaseMac("06:05:04:03:02:01");
+    msg.SetLinkInfo(linkInfo);
+    return msg;
+}
+
+static std::shared_ptr<WifiDirectProtocol> CreateTlvProtocol()
+{
+    auto protocol = WifiDirectProtocolFactory::CreateProtocol(ProtocolType::TLV);
+    protocol->SetFormat({ TlvProtocol::TLV_TAG_SIZE, TlvProtocol::TLV_LENGTH_SIZE2 });
+    return protocol;
+}
+
+/**
+ * @tc.name: MarshallingTestCase
+ * @tc.desc: NegotiateMessage tlv marshalling Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: Marshalling normal operation
+ */
+static void MarshallingTestCase(benchmark::State &state)
+{
+    auto msg = BuildConnectRequest();
+    while (state.KeepRunning()) {
+        auto protocol = CreateTlvProtocol();
+        std::vector<uint8_t> output;
+        if (msg.Marshalling(*protocol, output) != SOFTBUS_OK) {
+            state.SkipWithError("MarshallingTestCase failed.");
+        }
+        benchmark::DoNotOptimize(output.data());
+    }
+}
+BENCHMARK(MarshallingTestCase);
+
+/**
+ * @tc.name: UnmarshallingTestCase
+ * @tc.desc: NegotiateMessage tlv unmarshalling Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: Unmarshalling normal operation
+ */
+static void UnmarshallingTestCase(benchmark::State &state)
+{
+    auto msg = BuildConnectRequest();
+    std::vector<uint8_t> input;
+    msg.Marshalling(*CreateTlvProtocol(), input);
+    while (state.KeepRunning()) {
+        auto protocol = CreateTlvProtocol();
+        NegotiateMessage result;
+        if (result.Unmarshalling(*protocol, input) != SOFTBUS_OK) {
+            state.SkipWithError("UnmarshallingTestCase failed.");
+        }
+        benchmark::DoNotOptimize(result.GetSessionId());
+    }
+}
+BENCHMARK(UnmarshallingTestCase);
+
+/**
+ * @tc.name: GetAttributesTestCase
+ * @tc.desc: NegotiateMessage getter Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: Get normal operation
+ */
+static void GetAttributesTestCase(benchmark::State &state)
+{
+    auto msg = BuildConnectRequest();
+    while (state.KeepRunning()) {
+        benchmark::DoNotOptimize(msg.GetMessageType());
+        benchmark::DoNotOptimize(msg.GetSessionId());
+        benchmark::DoNotOptimize(msg.GetPreferLinkBandWidth());
+        benchmark::DoNotOptimize(msg.GetChallengeCode());
+        benchmark::DoNotOptimize(msg.GetLegacyP2pGoPort());
+    }
+}
+BENCHMARK(GetAttributesTestCase);
+} // namespace OHOS::SoftBus
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -17,6 +17,7 @@
 #include "data/link_info.h"
 #include "data/negotiate_message.h"
 #include "protocol/wifi_direct_protocol_factory.h"
+#include "softbus_error_code.h"
 using namespace testing::ext;
 
 namespace OHOS::SoftBus {
@@ -401,4 +402,43 @@ HWTEST_F(NegotiateMessageTest, MessageTypeToString, TestSize.Level1)
     msg.SetMessageType(NegotiateMessageType::CMD_INVALID);
     EXPECT_EQ(str, "CMD_INVALID");
 }
+
+/*
+ * @tc.name: MarshallingKeepsPresenceAndOrder
+ * @tc.desc: only present keys of both key ranges are marshalled, in key order, and survive a tlv round trip
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(NegotiateMessageTest, MarshallingKeepsPresenceAndOrder, TestSize.Level1)
+{
+    NegotiateMessage msg1;
+    msg1.SetLegacyP2pGoPort(8888);
+    msg1.SetChallengeCode(0x1234);
+    msg1.SetLegacyP2pGcIp("192.168.49.2");
+    msg1.SetSessionId(7);
+    msg1.SetRemoteDeviceId("ignored");
+
+    auto protocol1 = WifiDirectProtocolFactory::CreateProtocol(ProtocolType::TLV);
+    protocol1->SetFormat({ TlvProtocol::TLV_TAG_SIZE, TlvProtocol::TLV_LENGTH_SIZE2 });
+    std::vector<uint8_t> output1;
+    EXPECT_EQ(msg1.Marshalling(*protocol1, output1), SOFTBUS_OK);
+
+    NegotiateMessage msg2;
+    auto protocol2 = WifiDirectProtocolFactory::CreateProtocol(ProtocolType::TLV);
+    protocol2->SetFormat({ TlvProtocol::TLV_TAG_SIZE, TlvProtocol::TLV_LENGTH_SIZE2 });
+    EXPECT_EQ(msg2.Unmarshalling(*protocol2, output1), SOFTBUS_OK);
+    EXPECT_EQ(msg2.GetLegacyP2pGoPort(), 8888);
+    EXPECT_EQ(msg2.GetChallengeCode(), 0x1234);
+    EXPECT_EQ(msg2.GetLegacyP2pGcIp(), "192.168.49.2");
+    EXPECT_EQ(msg2.GetSessionId(), 7);
+    EXPECT_EQ(msg2.GetRemoteDeviceId(), "");
+    EXPECT_EQ(msg2.GetResultCode(), NegotiateMessage::RESULT_CODE_INVALID);
+    EXPECT_EQ(msg2.GetLegacyP2pGoIp(), "");
+
+    auto protocol3 = WifiDirectProtocolFactory::CreateProtocol(ProtocolType::TLV);
+    protocol3->SetFormat({ TlvProtocol::TLV_TAG_SIZE, TlvProtocol::TLV_LENGTH_SIZE2 });
+    std::vector<uint8_t> output2;
+    EXPECT_EQ(msg2.Marshalling(*protocol3, output2), SOFTBUS_OK);
+    EXPECT_EQ(output1, output2);
+}
 } // namespace OHOS::SoftBus
\ No newline at end of file
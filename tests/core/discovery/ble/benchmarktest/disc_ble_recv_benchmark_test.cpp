@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <securec.h>
+
+#include "common_list.h"
+#include "disc_ble_recv_table.h"
+#include "softbus_adapter_crypto.h"
+#include "softbus_adapter_mem.h"
+#include "softbus_error_code.h"
+
+namespace OHOS {
+// a crowded scan: nearby passive devices each re-advertise every scan window for the 6s message lifetime
+static constexpr uint32_t DEVICE_NUM = 64;
+static constexpr uint32_t SCAN_ROUND = 60;
+static constexpr uint64_t SCAN_INTERVAL_MS = 100;
+static constexpr uint64_t MSG_TIME_OUT_MS = 6000;
+static constexpr uint32_t ADV_LEN = 24;
+static constexpr uint32_t RSP_LEN = 27;
+static constexpr uint32_t NONCE_DEVICE_STEP = 10;
+static constexpr uint32_t NONCE_DEVICE_SHIFT = 16;
+static constexpr uint32_t NONCE_ROUND_STEP = 10;
+static constexpr int64_t REPLAY_NUM = 200;
+
+typedef struct {
+    uint8_t payload[ADV_LEN + RSP_LEN];
+    uint32_t capBitMap;
+} ScanRecord;
+
+/* the list entry the recv path kept before the hashed table */
+typedef struct {
+    ListNode node;
+    uint32_t capBitMap[CAPABILITY_NUM];
+    char key[SHA_HASH_LEN];
+} ListRecvMessage;
+
+static ScanRecord g_trace[DEVICE_NUM * SCAN_ROUND];
+
+/* the recorded trace is rebuilt from a fixed pattern so every run replays the same packets */
+static void BuildScanTrace(void)
+{
+    for (uint32_t round = 0; round < SCAN_ROUND; round++) {
+        for (uint32_t dev = 0; dev < DEVICE_NUM; dev++) {
+            ScanRecord *record = &g_trace[round * DEVICE_NUM + dev];
+            for (uint32_t i = 0; i < sizeof(record->payload); i++) {
+                record->payload[i] = static_cast<uint8_t>(dev * 31 + i);
+            }
+            // some devices rotate a nonce every second, the rest repeat the same packet
+            if (dev % NONCE_DEVICE_STEP == 0) {
+                uint32_t nonce = (dev << NONCE_DEVICE_SHIFT) | (round / NONCE_ROUND_STEP);
+                (void)memcpy_s(record->payload + ADV_LEN - sizeof(nonce), sizeof(nonce), &nonce, sizeof(nonce));
+            }
+            record->capBitMap = 1U << (dev % 8);
+        }
+    }
+}
+
+static ListRecvMessage *ListFind(ListNode *list, const char *key)
+{
+    ListRecvMessage *msg = nullptr;
+    LIST_FOR_EACH_ENTRY(msg, list, ListRecvMessage, node) {
+        if (memcmp(key, msg->key, SHA_HASH_LEN) == 0) {
+            return msg;
+        }
+    }
+    return nullptr;
+}
+
+static uint32_t ListAggregateCap(ListNode *list)
+{
+    ListRecvMessage *msg = nullptr;
+    uint32_t cap = 0;
+    LIST_FOR_EACH_ENTRY(msg, list, ListRecvMessage, node) {
+        cap |= msg->capBitMap[0];
+    }
+    return cap;
+}
+
+static void ListClear(ListNode *list)
+{
+    ListRecvMessage *msg = nullptr;
+    ListRecvMessage *next = nullptr;
+    LIST_FOR_EACH_ENTRY_SAFE(msg, next, list, ListRecvMessage, node) {
+        ListDelete(&msg->node);
+        SoftBusFree(msg);
+    }
+}
+
+/**
+ * @tc.name: ListReplayTestCase
+ * @tc.desc: replay a recorded scan through sha256 keys and the recv message list Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: previous recv message dedup
+ */
+static void ListReplayTestCase(benchmark::State &state)
+{
+    BuildScanTrace();
+    uint32_t updates = 0;
+    while (state.KeepRunning()) {
+        ListNode list;
+        ListInit(&list);
+        for (const ScanRecord &record : g_trace) {
+            char key[SHA_HASH_LEN] = { 0 };
+            (void)SoftBusGenerateStrHash(record.payload, sizeof(record.payload), (unsigned char *)key);
+            uint32_t oldCap = ListAggregateCap(&list);
+            if (ListFind(&list, key) != nullptr) {
+                continue;
+            }
+            ListRecvMessage *msg = static_cast<ListRecvMessage *>(SoftBusCalloc(sizeof(ListRecvMessage)));
+            if (msg == nullptr) {
+                state.SkipWithError("ListReplayTestCase malloc failed.");
+                break;
+            }
+            (void)memcpy_s(msg->key, sizeof(msg->key), key, sizeof(key));
+            msg->capBitMap[0] = record.capBitMap;
+            ListTailInsert(&list, &msg->node);
+            updates += (oldCap != ListAggregateCap(&list)) ? 1 : 0;
+        }
+        ListClear(&list);
+    }
+    benchmark::DoNotOptimize(updates);
+}
+BENCHMARK(ListReplayTestCase)->Iterations(REPLAY_NUM);
+
+/**
+ * @tc.name: TableReplayTestCase
+ * @tc.desc: replay a recorded scan through the shipped recv table path with cached sha256 keys Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: DiscBleRecvTableAdd normal operation
+ */
+static void TableReplayTestCase(benchmark::State &state)
+{
+    BuildScanTrace();
+    static RecvTable table;
+    if (DiscBleRecvTableInit(&table) != SOFTBUS_OK) {
+        state.SkipWithError("TableReplayTestCase init failed.");
+        return;
+    }
+    uint32_t updates = 0;
+    while (state.KeepRunning()) {
+        uint64_t now = 0;
+        uint32_t index = 0;
+        for (const ScanRecord &record : g_trace) {
+            RecvMessage msg = { 0 };
+            (void)memcpy_s(msg.payload, sizeof(msg.payload), record.payload, sizeof(record.payload));
+            msg.payloadLen = sizeof(record.payload);
+            msg.hash = DiscBleRecvTableHash(&table, msg.payload, msg.payloadLen);
+            if (DiscBleRecvTableGetActionKey(&table, &msg, msg.actionKey, sizeof(msg.actionKey)) == SOFTBUS_NOT_FIND &&
+                SoftBusGenerateStrHash(msg.payload, msg.payloadLen, msg.actionKey) != SOFTBUS_OK) {
+                state.SkipWithError("TableReplayTestCase hash failed.");
+                break;
+            }
+            msg.capBitMap[0] = record.capBitMap;
+            msg.expireTime = now + MSG_TIME_OUT_MS;
+            uint32_t oldCap = table.aggregateCap[0];
+            bool isNew = false;
+            if (DiscBleRecvTableAdd(&table, &msg, &isNew) != SOFTBUS_OK) {
+                state.SkipWithError("TableReplayTestCase add failed.");
+                break;
+            }
+            updates += (isNew && oldCap != table.aggregateCap[0]) ? 1 : 0;
+            if (++index % DEVICE_NUM == 0) {
+                now += SCAN_INTERVAL_MS;
+            }
+        }
+        DiscBleRecvTableClear(&table);
+    }
+    benchmark::DoNotOptimize(updates);
+}
+BENCHMARK(TableReplayTestCase)->Iterations(REPLAY_NUM);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <securec.h>
+
+#include "disc_ble_recv_table.h"
+#include "disc_log.h"
+#include "softbus_error_code.h"
+
+using namespace testing::ext;
+namespace OHOS {
+static constexpr uint64_t EXPIRE_TIME = 6000;
+static constexpr uint32_t CAP_BIT_A = 0x1;
+static constexpr uint32_t CAP_BIT_B = 0x4;
+static constexpr uint8_t ACTION_KEY_BYTE = 0x5A;
+
+class DiscBleRecvTableTest : public testing::Test {
+public:
+    DiscBleRecvTableTest() { }
+    ~DiscBleRecvTableTest() { }
+    static void SetUpTestCase(void) { }
+    static void TearDownTestCase(void) { }
+    void SetUp() override
+    {
+        ASSERT_EQ(DiscBleRecvTableInit(&table_), SOFTBUS_OK);
+    }
+    void TearDown() override { }
+
+    void BuildMessage(RecvMessage *msg, uint8_t tag, uint32_t capBit, uint64_t expireTime)
+    {
+        (void)memset_s(msg, sizeof(RecvMessage), 0, sizeof(RecvMessage));
+        msg->payloadLen = RECV_PAYLOAD_MAX_LEN;
+        for (uint16_t i = 0; i < msg->payloadLen; i++) {
+            msg->payload[i] = static_cast<uint8_t>(tag + i);
+        }
+        msg->hash = DiscBleRecvTableHash(&table_, msg->payload, msg->payloadLen);
+        msg->capBitMap[0] = capBit;
+        msg->needBrMac = true;
+        msg->expireTime = expireTime;
+    }
+
+    RecvTable table_;
+};
+
+/*
+ * @tc.name: RecvTableHashTest001
+ * @tc.desc: Test DiscBleRecvTableHash is stable for a payload and tells apart a one byte change
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DiscBleRecvTableTest, RecvTableHashTest001, TestSize.Level1)
+{
+    DISC_LOGI(DISC_TEST, "RecvTableHashTest001 begin");
+    RecvMessage msgA;
+    RecvMessage msgB;
+    BuildMessage(&msgA, 0, CAP_BIT_A, EXPIRE_TIME);
+    BuildMessage(&msgB, 0, CAP_BIT_A, EXPIRE_TIME);
+    EXPECT_EQ(msgA.hash, msgB.hash);
+
+    msgB.payload[RECV_PAYLOAD_MAX_LEN - 1] ^= 0x1;
+    EXPECT_NE(msgA.hash, DiscBleRecvTableHash(&table_, msgB.payload, msgB.payloadLen));
+    DISC_LOGI(DISC_TEST, "RecvTableHashTest001 end");
+}
+
+/*
+ * @tc.name: RecvTableAddTest001
+ * @tc.desc: Test DiscBleRecvTableAdd refreshes a known packet and compares the full payload on a hash hit
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DiscBleRecvTableTest, RecvTableAddTest001, TestSize.Level1)
+{
+    DISC_LOGI(DISC_TEST, "RecvTableAddTest001 begin");
+    RecvMessage msg;
+    BuildMessage(&msg, 0, CAP_BIT_A, EXPIRE_TIME);
+    bool isNew = false;
+    EXPECT_EQ(DiscBleRecvTableAdd(&table_, &msg, &isNew), SOFTBUS_OK);
+    EXPECT_TRUE(isNew);
+
+    msg.expireTime = EXPIRE_TIME * 2;
+    EXPECT_EQ(DiscBleRecvTableAdd(&table_, &msg, &isNew), SOFTBUS_OK);
+    EXPECT_FALSE(isNew);
+    EXPECT_EQ(table_.num, 1U);
+
+    // same hash but another payload must not be taken as a repeat
+    msg.payload[0] ^= 0x1;
+    EXPECT_EQ(DiscBleRecvTableAdd(&table_, &msg, &isNew), SOFTBUS_OK);
+    EXPECT_TRUE(isNew);
+    EXPECT_EQ(table_.num, 2U);
+    EXPECT_EQ(table_.numNeedBrMac, 2U);
+
+    EXPECT_EQ(DiscBleRecvTableAdd(nullptr, &msg, &isNew), SOFTBUS_INVALID_PARAM);
+    DISC_LOGI(DISC_TEST, "RecvTableAddTest001 end");
+}
+
+/*
+ * @tc.name: RecvTableAddTest002
+ * @tc.desc: Test DiscBleRecvTableAdd rejects new packets once the table reaches its max load
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DiscBleRecvTableTest, RecvTableAddTest002, TestSize.Level1)
+{
+    DISC_LOGI(DISC_TEST, "RecvTableAddTest002 begin");
+    RecvMessage msg;
+    bool isNew = false;
+    int32_t ret = SOFTBUS_OK;
+    uint32_t added = 0;
+    for (uint32_t i = 0; i < RECV_TABLE_SIZE && ret == SOFTBUS_OK; i++) {
+        BuildMessage(&msg, 0, CAP_BIT_A, EXPIRE_TIME);
+        (void)memcpy_s(msg.payload, sizeof(msg.payload), &i, sizeof(i));
+        msg.hash = DiscBleRecvTableHash(&table_, msg.payload, msg.payloadLen);
+        ret = DiscBleRecvTableAdd(&table_, &msg, &isNew);
+        added += (ret == SOFTBUS_OK) ? 1 : 0;
+    }
+    EXPECT_EQ(ret, SOFTBUS_NO_RESOURCE_ERR);
+    EXPECT_EQ(added, table_.num);
+    EXPECT_LT(table_.num, static_cast<uint32_t>(RECV_TABLE_SIZE));
+    DISC_LOGI(DISC_TEST, "RecvTableAddTest002 end");
+}
+
+/*
+ * @tc.name: RecvTableGetActionKeyTest001
+ * @tc.desc: Test DiscBleRecvTableGetActionKey returns the key stored with a packet and misses an unknown packet
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DiscBleRecvTableTest, RecvTableGetActionKeyTest001, TestSize.Level1)
+{
+    DISC_LOGI(DISC_TEST, "RecvTableGetActionKeyTest001 begin");
+    RecvMessage msg;
+    BuildMessage(&msg, 0, CAP_BIT_A, EXPIRE_TIME);
+    uint8_t key[SHA_HASH_LEN] = { 0 };
+    EXPECT_EQ(DiscBleRecvTableGetActionKey(&table_, &msg, key, sizeof(key)), SOFTBUS_NOT_FIND);
+
+    (void)memset_s(msg.actionKey, sizeof(msg.actionKey), ACTION_KEY_BYTE, sizeof(msg.actionKey));
+    bool isNew = false;
+    EXPECT_EQ(DiscBleRecvTableAdd(&table_, &msg, &isNew), SOFTBUS_OK);
+    (void)memset_s(msg.actionKey, sizeof(msg.actionKey), 0, sizeof(msg.actionKey));
+    EXPECT_EQ(DiscBleRecvTableGetActionKey(&table_, &msg, key, sizeof(key)), SOFTBUS_OK);
+    uint8_t expectKey[SHA_HASH_LEN] = { 0 };
+    (void)memset_s(expectKey, sizeof(expectKey), ACTION_KEY_BYTE, sizeof(expectKey));
+    EXPECT_EQ(memcmp(key, expectKey, sizeof(key)), 0);
+
+    msg.payload[0] ^= 0x1;
+    EXPECT_EQ(DiscBleRecvTableGetActionKey(&table_, &msg, key, sizeof(key)), SOFTBUS_NOT_FIND);
+    EXPECT_EQ(DiscBleRecvTableGetActionKey(&table_, &msg, key, sizeof(key) - 1), SOFTBUS_INVALID_PARAM);
+    DISC_LOGI(DISC_TEST, "RecvTableGetActionKeyTest001 end");
+}
+
+/*
+ * @tc.name: RecvTableExpireTest001
+ * @tc.desc: Test DiscBleRecvTableExpire removes expired packets and keeps the aggregated capability in step
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DiscBleRecvTableTest, RecvTableExpireTest001, TestSize.Level1)
+{
+    DISC_LOGI(DISC_TEST, "RecvTableExpireTest001 begin");
+    RecvMessage msgA;
+    RecvMessage msgB;
+    RecvMessage msgC;
+    BuildMessage(&msgA, 0, CAP_BIT_A, EXPIRE_TIME);
+    BuildMessage(&msgB, 1, CAP_BIT_A | CAP_BIT_B, EXPIRE_TIME * 2);
+    BuildMessage(&msgC, 2, CAP_BIT_A, EXPIRE_TIME * 3);
+    bool isNew = false;
+    EXPECT_EQ(DiscBleRecvTableAdd(&table_, &msgA, &isNew), SOFTBUS_OK);
+    EXPECT_EQ(DiscBleRecvTableAdd(&table_, &msgB, &isNew), SOFTBUS_OK);
+    EXPECT_EQ(DiscBleRecvTableAdd(&table_, &msgC, &isNew), SOFTBUS_OK);
+    EXPECT_EQ(table_.aggregateCap[0], CAP_BIT_A | CAP_BIT_B);
+
+    uint64_t next = 0;
+    EXPECT_EQ(DiscBleRecvTableExpire(&table_, EXPIRE_TIME, &next), 1U);
+    EXPECT_EQ(next, EXPIRE_TIME * 2);
+    EXPECT_EQ(table_.aggregateCap[0], CAP_BIT_A | CAP_BIT_B);
+
+    EXPECT_EQ(DiscBleRecvTableExpire(&table_, EXPIRE_TIME * 2, &next), 1U);
+    EXPECT_EQ(next, EXPIRE_TIME * 3);
+    EXPECT_EQ(table_.aggregateCap[0], CAP_BIT_A);
+
+    // the remaining packet is still found after the shifts
+    EXPECT_EQ(DiscBleRecvTableAdd(&table_, &msgC, &isNew), SOFTBUS_OK);
+    EXPECT_FALSE(isNew);
+
+    EXPECT_EQ(DiscBleRecvTableExpire(&table_, EXPIRE_TIME * 3, &next), 1U);
+    EXPECT_EQ(next, 0U);
+    EXPECT_EQ(table_.num, 0U);
+    EXPECT_EQ(table_.numNeedBrMac, 0U);
+    EXPECT_EQ(table_.aggregateCap[0], 0U);
+    DISC_LOGI(DISC_TEST, "RecvTableExpireTest001 end");
+}
+
+/*
+ * @tc.name: RecvTableClearTest001
+ * @tc.desc: Test DiscBleRecvTableClear empties the table and keeps the hash seed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DiscBleRecvTableTest, RecvTableClearTest001, TestSize.Level1)
+{
+    DISC_LOGI(DISC_TEST, "RecvTableClearTest001 begin");
+    RecvMessage msg;
+    BuildMessage(&msg, 0, CAP_BIT_A, EXPIRE_TIME);
+    bool isNew = false;
+    EXPECT_EQ(DiscBleRecvTableAdd(&table_, &msg, &isNew), SOFTBUS_OK);
+
+    DiscBleRecvTableClear(&table_);
+    EXPECT_EQ(table_.num, 0U);
+    EXPECT_EQ(table_.aggregateCap[0], 0U);
+    EXPECT_EQ(msg.hash, DiscBleRecvTableHash(&table_, msg.payload, msg.payloadLen));
+    DISC_LOGI(DISC_TEST, "RecvTableClearTest001 end");
+}
+} // namespace OHOS
@@ -0,0 +1,68 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "json_payload_bench_helper.h"
+
+#include <securec.h>
+
+#include "cJSON.h"
+#include "json_payload.h"
+#include "nstackx_device.h"
+#include "nstackx_device_local.h"
+#include "nstackx_error.h"
+
+#define BENCH_LOCAL_IP "192.168.3.100"
+#define BENCH_CAPABILITY_NUM 2
+#define BENCH_CAPABILITY 0x1F
+#define BENCH_BUSINESS_TYPE 1
+
+static uint32_t g_capabilityBitmap[BENCH_CAPABILITY_NUM] = { BENCH_CAPABILITY, BENCH_CAPABILITY };
+static NSTACKX_ResponseSettings g_responseSettings;
+
+int32_t BenchSetLocalDevice(void)
+{
+    ConfigureLocalDeviceName("benchmark device");
+    SetLocalDeviceHash(0x1234567890ABCDEF);
+    SetLocalDeviceMode(DEFAULT_MODE);
+    if (SetLocalDeviceCapability(BENCH_CAPABILITY_NUM, g_capabilityBitmap) != NSTACKX_EOK ||
+        SetLocalDeviceServiceData("port:12345,") != NSTACKX_EOK ||
+        SetLocalDeviceBusinessData("{\"business\":\"unicast\"}", true) != NSTACKX_EOK ||
+        SetLocalDeviceBusinessData("{\"business\":\"broadcast\"}", false) != NSTACKX_EOK) {
+        return NSTACKX_EFAILED;
+    }
+    g_responseSettings.capBitmapNum = BENCH_CAPABILITY_NUM;
+    (void)memcpy_s(g_responseSettings.capBitmap, sizeof(g_responseSettings.capBitmap),
+        g_capabilityBitmap, sizeof(g_capabilityBitmap));
+    return NSTACKX_EOK;
+}
+
+int32_t BenchPrepareResponse(bool overrideCapability)
+{
+    struct DiscoverInfo info = {
+        .af = AF_INET,
+        .localIpStr = BENCH_LOCAL_IP,
+        .isBroadcast = NSTACKX_FALSE,
+        .businessType = BENCH_BUSINESS_TYPE,
+        .serviceData = "",
+        .responseSettings = overrideCapability ? &g_responseSettings : NULL,
+    };
+    IncreaseUcastSequenceNumber(AF_INET);
+    char *data = PrepareServiceDiscover(&info);
+    if (data == NULL) {
+        return NSTACKX_EFAILED;
+    }
+    cJSON_free(data);
+    return NSTACKX_EOK;
+}
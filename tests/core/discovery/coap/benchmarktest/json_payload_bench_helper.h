@@ -0,0 +1,34 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef JSON_PAYLOAD_BENCH_HELPER_H
+#define JSON_PAYLOAD_BENCH_HELPER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* the nstackx headers are c only, the benchmark builds discover payloads through these */
+int32_t BenchSetLocalDevice(void);
+/* one unicast response payload, a capability override forces the full cJSON serialization */
+int32_t BenchPrepareResponse(bool overrideCapability);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* JSON_PAYLOAD_BENCH_HELPER_H */
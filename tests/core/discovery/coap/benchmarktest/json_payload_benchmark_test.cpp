@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "json_payload_bench_helper.h"
+
+namespace OHOS {
+static constexpr int64_t RESPONSE_NUM = 10000;
+static bool g_isLocalDeviceReady = false;
+
+static bool SetLocalDevice(void)
+{
+    if (!g_isLocalDeviceReady) {
+        g_isLocalDeviceReady = (BenchSetLocalDevice() == 0);
+    }
+    return g_isLocalDeviceReady;
+}
+
+/**
+ * @tc.name: PrepareResponseFullTestCase
+ * @tc.desc: unicast responses serialized through a full cJSON build responses/s Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: PrepareServiceDiscover with a capability override
+ */
+static void PrepareResponseFullTestCase(benchmark::State &state)
+{
+    if (!SetLocalDevice()) {
+        state.SkipWithError("PrepareResponseFullTestCase set local device failed.");
+        return;
+    }
+    while (state.KeepRunning()) {
+        if (BenchPrepareResponse(true) != 0) {
+            state.SkipWithError("PrepareResponseFullTestCase prepare failed.");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(PrepareResponseFullTestCase)->Iterations(RESPONSE_NUM);
+
+/**
+ * @tc.name: PrepareResponseCachedTestCase
+ * @tc.desc: unicast responses patched from the cached payload responses/s Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: PrepareServiceDiscover normal operation
+ */
+static void PrepareResponseCachedTestCase(benchmark::State &state)
+{
+    if (!SetLocalDevice()) {
+        state.SkipWithError("PrepareResponseCachedTestCase set local device failed.");
+        return;
+    }
+    while (state.KeepRunning()) {
+        if (BenchPrepareResponse(false) != 0) {
+            state.SkipWithError("PrepareResponseCachedTestCase prepare failed.");
+            break;
+        }
+    }
+    state.SetItemsProcessed(state.iterations());
+}
+BENCHMARK(PrepareResponseCachedTestCase)->Iterations(RESPONSE_NUM);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
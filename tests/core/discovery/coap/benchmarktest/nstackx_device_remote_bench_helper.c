@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "nstackx_device_remote_bench_helper.h"
+
+#include <arpa/inet.h>
+#include <securec.h>
+#include <stdlib.h>
+
+#include "nstackx_device_remote.h"
+#include "nstackx_error.h"
+
+#define BASE_IPV4 0x0A000001
+
+static NSTACKX_InterfaceInfo g_ifaceInfo;
+static DeviceInfo g_deviceInfo[BENCH_DEVICE_NUM];
+
+/* the product cap is NSTACKX_MAX_DEVICE_NUM, lift it so the table holds the whole synthetic LAN */
+uint32_t GetMaxDeviceNum(void)
+{
+    return BENCH_DEVICE_NUM + 1;
+}
+
+static void BuildSyntheticDevices(void)
+{
+    (void)strcpy_s(g_ifaceInfo.networkName, sizeof(g_ifaceInfo.networkName), "wlan0");
+    (void)strcpy_s(g_ifaceInfo.networkIpAddr, sizeof(g_ifaceInfo.networkIpAddr), "10.0.0.254");
+    for (uint32_t i = 0; i < BENCH_DEVICE_NUM; i++) {
+        DeviceInfo *info = &g_deviceInfo[i];
+        (void)memset_s(info, sizeof(DeviceInfo), 0, sizeof(DeviceInfo));
+        // udids share a long prefix like real ones do, so every compare walks most of the string
+        (void)sprintf_s(info->deviceId, sizeof(info->deviceId), "{\"UDID\":\"%064u\"}", i);
+        (void)sprintf_s(info->deviceName, sizeof(info->deviceName), "device%u", i);
+        info->netChannelInfo.wifiApInfo.af = AF_INET;
+        info->netChannelInfo.wifiApInfo.addr.in.s_addr = htonl(BASE_IPV4 + i);
+        info->discoveryType = NSTACKX_DISCOVERY_TYPE_PASSIVE;
+    }
+}
+
+int32_t BenchBuildRemoteDevices(void)
+{
+    BuildSyntheticDevices();
+    if (RemoteDeviceListInit() != NSTACKX_EOK) {
+        return NSTACKX_EFAILED;
+    }
+    return BenchUpdateRemoteDevices();
+}
+
+int32_t BenchUpdateRemoteDevices(void)
+{
+    for (uint32_t i = 0; i < BENCH_DEVICE_NUM; i++) {
+        int8_t updated = NSTACKX_FALSE;
+        if (UpdateRemoteNodeByDeviceInfo(g_deviceInfo[i].deviceId, &g_ifaceInfo, &g_deviceInfo[i],
+            &updated) != NSTACKX_EOK) {
+            return NSTACKX_EFAILED;
+        }
+    }
+    return NSTACKX_EOK;
+}
+
+int32_t BenchSnapshotRemoteDevices(uint32_t *snapshotNum)
+{
+    DeviceInfo *snapshot = NULL;
+    int32_t ret = GetDeviceListSnapshot(&snapshot, snapshotNum, BENCH_DEVICE_NUM, false);
+    free(snapshot);
+    return ret;
+}
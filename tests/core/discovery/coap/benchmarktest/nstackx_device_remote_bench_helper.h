@@ -0,0 +1,35 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef NSTACKX_DEVICE_REMOTE_BENCH_HELPER_H
+#define NSTACKX_DEVICE_REMOTE_BENCH_HELPER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* the nstackx headers are c only, the benchmark drives the remote device table through these */
+#define BENCH_DEVICE_NUM 1000
+
+int32_t BenchBuildRemoteDevices(void);
+int32_t BenchUpdateRemoteDevices(void);
+int32_t BenchSnapshotRemoteDevices(uint32_t *snapshotNum);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* NSTACKX_DEVICE_REMOTE_BENCH_HELPER_H */
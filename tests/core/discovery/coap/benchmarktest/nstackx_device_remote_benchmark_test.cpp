@@ -0,0 +1,77 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "nstackx_device_remote_bench_helper.h"
+
+namespace OHOS {
+static constexpr int64_t ROUND_NUM = 1000;
+static bool g_isTableReady = false;
+
+static bool BuildRemoteTable(void)
+{
+    if (!g_isTableReady) {
+        g_isTableReady = (BenchBuildRemoteDevices() == 0);
+    }
+    return g_isTableReady;
+}
+
+/**
+ * @tc.name: UpdateKnownDeviceTestCase
+ * @tc.desc: 1000 known devices notify again through UpdateRemoteNodeByDeviceInfo Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: UpdateRemoteNodeByDeviceInfo normal operation
+ */
+static void UpdateKnownDeviceTestCase(benchmark::State &state)
+{
+    if (!BuildRemoteTable()) {
+        state.SkipWithError("UpdateKnownDeviceTestCase build remote table failed.");
+        return;
+    }
+    while (state.KeepRunning()) {
+        if (BenchUpdateRemoteDevices() != 0) {
+            state.SkipWithError("UpdateKnownDeviceTestCase update failed.");
+            break;
+        }
+    }
+}
+BENCHMARK(UpdateKnownDeviceTestCase)->Iterations(ROUND_NUM);
+
+/**
+ * @tc.name: GetDeviceListSnapshotTestCase
+ * @tc.desc: 1000 devices copied out of the remote device table Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: GetDeviceListSnapshot normal operation
+ */
+static void GetDeviceListSnapshotTestCase(benchmark::State &state)
+{
+    if (!BuildRemoteTable()) {
+        state.SkipWithError("GetDeviceListSnapshotTestCase build remote table failed.");
+        return;
+    }
+    while (state.KeepRunning()) {
+        uint32_t snapshotNum = 0;
+        if (BenchSnapshotRemoteDevices(&snapshotNum) != 0 || snapshotNum != BENCH_DEVICE_NUM) {
+            state.SkipWithError("GetDeviceListSnapshotTestCase snapshot failed.");
+            break;
+        }
+    }
+}
+BENCHMARK(GetDeviceListSnapshotTestCase)->Iterations(ROUND_NUM);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
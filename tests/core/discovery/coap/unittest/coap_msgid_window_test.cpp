@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <securec.h>
+
+#include "coap_msgid_window.h"
+#include "nstackx_error.h"
+
+using namespace testing::ext;
+namespace OHOS {
+static constexpr uint32_t PEER_NUM = 1000;
+static constexpr uint32_t MSG_PER_PEER = 3;
+static constexpr uint32_t RETRANSMIT_NUM = 2;
+static constexpr uint32_t SMALL_CAPACITY = 100;
+static constexpr uint32_t BASE_IPV4 = 0x0A000001;
+static constexpr uint16_t COAP_PORT = 5684;
+static constexpr uint64_t START_SECONDS = 1000;
+
+class CoapMsgIdWindowTest : public testing::Test {
+public:
+    CoapMsgIdWindowTest() { }
+    ~CoapMsgIdWindowTest() { }
+    static void SetUpTestCase(void) { }
+    static void TearDownTestCase(void) { }
+    void SetUp() override { }
+    void TearDown() override
+    {
+        CoapMsgIdWindowDeinit(&window_);
+    }
+
+    static CoapMsgIdKey BuildKey(uint32_t peer, uint16_t msgId)
+    {
+        CoapMsgIdKey key;
+        (void)memset_s(&key, sizeof(key), 0, sizeof(key));
+        key.af = AF_INET;
+        key.port = htons(COAP_PORT);
+        key.msgId = msgId;
+        key.addr.in.s_addr = htonl(BASE_IPV4 + peer);
+        return key;
+    }
+
+    CoapMsgIdWindow window_ = {};
+};
+
+/*
+ * @tc.name: CoapMsgIdWindowInitTest001
+ * @tc.desc: Test CoapMsgIdWindowInit rejects a zero or oversized capacity and a zero survival time
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CoapMsgIdWindowTest, CoapMsgIdWindowInitTest001, TestSize.Level1)
+{
+    EXPECT_EQ(CoapMsgIdWindowInit(nullptr, COAP_MSGID_WINDOW_CAPACITY, COAP_MSGID_SURVIVAL_SECONDS), NSTACKX_EINVAL);
+    EXPECT_EQ(CoapMsgIdWindowInit(&window_, 0, COAP_MSGID_SURVIVAL_SECONDS), NSTACKX_EINVAL);
+    EXPECT_EQ(CoapMsgIdWindowInit(&window_, UINT32_MAX, COAP_MSGID_SURVIVAL_SECONDS), NSTACKX_EINVAL);
+    EXPECT_EQ(CoapMsgIdWindowInit(&window_, COAP_MSGID_WINDOW_CAPACITY, 0), NSTACKX_EINVAL);
+    EXPECT_EQ(CoapMsgIdWindowInit(&window_, COAP_MSGID_WINDOW_CAPACITY, COAP_MSGID_SURVIVAL_SECONDS), NSTACKX_EOK);
+
+    // an uninitialized window takes every message as a fresh one
+    CoapMsgIdWindow empty = {};
+    CoapMsgIdKey key = BuildKey(0, 1);
+    EXPECT_TRUE(CoapMsgIdWindowRefresh(&empty, &key, START_SECONDS));
+    EXPECT_TRUE(CoapMsgIdWindowRefresh(&empty, &key, START_SECONDS));
+}
+
+/*
+ * @tc.name: CoapMsgIdWindowReplayTest001
+ * @tc.desc: Test 1000 peers' discovery traffic with retransmissions against the production window, every repeat
+ *           is caught and none is evicted
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CoapMsgIdWindowTest, CoapMsgIdWindowReplayTest001, TestSize.Level1)
+{
+    ASSERT_EQ(CoapMsgIdWindowInit(&window_, COAP_MSGID_WINDOW_CAPACITY, COAP_MSGID_SURVIVAL_SECONDS), NSTACKX_EOK);
+    uint32_t freshNum = 0;
+    uint32_t repeatNum = 0;
+    uint64_t now = START_SECONDS;
+    for (uint32_t msg = 0; msg < MSG_PER_PEER; msg++) {
+        for (uint32_t retry = 0; retry <= RETRANSMIT_NUM; retry++) {
+            for (uint32_t peer = 0; peer < PEER_NUM; peer++) {
+                // every peer counts its own message ids, so the same id arrives from many addresses
+                CoapMsgIdKey key = BuildKey(peer, static_cast<uint16_t>(msg + 1));
+                bool isFresh = CoapMsgIdWindowRefresh(&window_, &key, now);
+                freshNum += isFresh ? 1 : 0;
+                repeatNum += isFresh ? 0 : 1;
+                EXPECT_EQ(isFresh, retry == 0);
+            }
+            now++;
+        }
+    }
+    EXPECT_EQ(freshNum, PEER_NUM * MSG_PER_PEER);
+    EXPECT_EQ(repeatNum, PEER_NUM * MSG_PER_PEER * RETRANSMIT_NUM);
+    EXPECT_EQ(window_.num, PEER_NUM * MSG_PER_PEER);
+    EXPECT_EQ(window_.evictNum, 0U);
+    EXPECT_EQ(window_.repeatNum, repeatNum);
+}
+
+/*
+ * @tc.name: CoapMsgIdWindowReplayTest002
+ * @tc.desc: Test 1000 peers against a small window, the oldest pairs are evicted and counted
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CoapMsgIdWindowTest, CoapMsgIdWindowReplayTest002, TestSize.Level1)
+{
+    ASSERT_EQ(CoapMsgIdWindowInit(&window_, SMALL_CAPACITY, COAP_MSGID_SURVIVAL_SECONDS), NSTACKX_EOK);
+    for (uint32_t peer = 0; peer < PEER_NUM; peer++) {
+        CoapMsgIdKey key = BuildKey(peer, 1);
+        EXPECT_TRUE(CoapMsgIdWindowRefresh(&window_, &key, START_SECONDS));
+    }
+    EXPECT_EQ(window_.num, SMALL_CAPACITY);
+    EXPECT_EQ(window_.evictNum, PEER_NUM - SMALL_CAPACITY);
+
+    // the newest peers are still known, the evicted ones are taken as fresh again
+    CoapMsgIdKey recent = BuildKey(PEER_NUM - 1, 1);
+    EXPECT_FALSE(CoapMsgIdWindowRefresh(&window_, &recent, START_SECONDS));
+    CoapMsgIdKey evicted = BuildKey(0, 1);
+    EXPECT_TRUE(CoapMsgIdWindowRefresh(&window_, &evicted, START_SECONDS));
+}
+
+/*
+ * @tc.name: CoapMsgIdWindowExpireTest001
+ * @tc.desc: Test a pair expires one survival time after its last receive and a repeat refreshes it
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CoapMsgIdWindowTest, CoapMsgIdWindowExpireTest001, TestSize.Level1)
+{
+    ASSERT_EQ(CoapMsgIdWindowInit(&window_, COAP_MSGID_WINDOW_CAPACITY, COAP_MSGID_SURVIVAL_SECONDS), NSTACKX_EOK);
+    CoapMsgIdKey keyA = BuildKey(0, 1);
+    CoapMsgIdKey keyB = BuildKey(1, 1);
+    EXPECT_TRUE(CoapMsgIdWindowRefresh(&window_, &keyA, START_SECONDS));
+    EXPECT_TRUE(CoapMsgIdWindowRefresh(&window_, &keyB, START_SECONDS));
+
+    uint64_t half = START_SECONDS + COAP_MSGID_SURVIVAL_SECONDS / 2;
+    EXPECT_FALSE(CoapMsgIdWindowRefresh(&window_, &keyA, half));
+
+    uint64_t expired = START_SECONDS + COAP_MSGID_SURVIVAL_SECONDS;
+    EXPECT_TRUE(CoapMsgIdWindowRefresh(&window_, &keyB, expired));
+    EXPECT_FALSE(CoapMsgIdWindowRefresh(&window_, &keyA, expired));
+    EXPECT_EQ(window_.expireNum, 1U);
+
+    EXPECT_TRUE(CoapMsgIdWindowRefresh(&window_, &keyA, expired + COAP_MSGID_SURVIVAL_SECONDS));
+    EXPECT_EQ(window_.evictNum, 0U);
+}
+
+/*
+ * @tc.name: CoapMsgIdWindowKeyTest001
+ * @tc.desc: Test the same message id from another port or address family is a different pair
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(CoapMsgIdWindowTest, CoapMsgIdWindowKeyTest001, TestSize.Level1)
+{
+    ASSERT_EQ(CoapMsgIdWindowInit(&window_, COAP_MSGID_WINDOW_CAPACITY, COAP_MSGID_SURVIVAL_SECONDS), NSTACKX_EOK);
+    CoapMsgIdKey key = BuildKey(0, 1);
+    EXPECT_TRUE(CoapMsgIdWindowRefresh(&window_, &key, START_SECONDS));
+
+    CoapMsgIdKey otherPort = key;
+    otherPort.port = htons(COAP_PORT + 1);
+    EXPECT_TRUE(CoapMsgIdWindowRefresh(&window_, &otherPort, START_SECONDS));
+
+    CoapMsgIdKey ipv6;
+    (void)memset_s(&ipv6, sizeof(ipv6), 0, sizeof(ipv6));
+    ipv6.af = AF_INET6;
+    ipv6.port = key.port;
+    ipv6.msgId = key.msgId;
+    ipv6.addr.in6.s6_addr[0] = 0xFE;
+    ipv6.addr.in6.s6_addr[1] = 0x80;
+    EXPECT_TRUE(CoapMsgIdWindowRefresh(&window_, &ipv6, START_SECONDS));
+    EXPECT_FALSE(CoapMsgIdWindowRefresh(&window_, &ipv6, START_SECONDS));
+    EXPECT_EQ(window_.num, 3U);
+}
+} // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -13,20 +13,26 @@
  * limitations under the License.
  */
 
+#include <chrono>
 #include <csignal>
 #include <gmock/gmock.h>
 #include <gtest/gtest.h>
+#include <map>
+#include <mutex>
+#include <set>
 #include <thread>
 
 #include "ble_mock.h"
 #include "coap_mock.h"
 #include "constraint_mock.h"
+#include "disc_found_queue.h"
 #include "disc_interface.h"
 #include "disc_log.h"
 #include "disc_manager.h"
 #include "softbus_error_code.h"
 #include "usb_mock.h"
 #include "nfc_mock.h"
+#include "securec.h"
 
 using namespace testing::ext;
 using testing::Return;
@@ -71,11 +77,69 @@ public:
                                  const InnerDeviceInfoAddtions *additions, int32_t subscribeId)
     {
         (void)subscribeId;
+        std::lock_guard<std::mutex> guard(foundLock_);
         callbackPackageName_ = packageName;
         deviceInfo_ = *device;
         return SOFTBUS_OK;
     }
 
+    static int32_t OnCountDeviceFound(const char *packageName, const DeviceInfo *device,
+                                      const InnerDeviceInfoAddtions *additions, int32_t subscribeId)
+    {
+        (void)additions;
+        (void)subscribeId;
+        {
+            std::lock_guard<std::mutex> guard(foundLock_);
+            foundCount_[packageName]++;
+            foundDevices_[packageName].insert(device->devId);
+        }
+        if (strcmp(packageName, slowPackageName_) == 0) {
+            std::this_thread::sleep_for(std::chrono::milliseconds(SLOW_CALLBACK_MS));
+        }
+        return SOFTBUS_OK;
+    }
+
+    static bool WaitDeviceFound(const char *packageName)
+    {
+        for (int32_t i = 0; i < WAIT_FOUND_TIMES; i++) {
+            {
+                std::lock_guard<std::mutex> guard(foundLock_);
+                if (callbackPackageName_ == packageName) {
+                    return true;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_FOUND_INTERVAL_MS));
+        }
+        return false;
+    }
+
+    static bool WaitFoundDevices(const char *packageName, size_t deviceNum)
+    {
+        for (int32_t i = 0; i < WAIT_FOUND_TIMES; i++) {
+            {
+                std::lock_guard<std::mutex> guard(foundLock_);
+                if (foundDevices_[packageName].size() >= deviceNum) {
+                    return true;
+                }
+            }
+            std::this_thread::sleep_for(std::chrono::milliseconds(WAIT_FOUND_INTERVAL_MS));
+        }
+        return false;
+    }
+
+    static void ResetFoundCount()
+    {
+        std::lock_guard<std::mutex> guard(foundLock_);
+        foundCount_.clear();
+        foundDevices_.clear();
+    }
+
+    static uint32_t GetFoundCount(const char *packageName)
+    {
+        std::lock_guard<std::mutex> guard(foundLock_);
+        return foundCount_[packageName];
+    }
+
     static void DiscMgrInitFuncMock()
     {
         BleMock bleMock;
@@ -104,6 +168,7 @@ public:
 
     static inline DiscInnerCallback innerCallback_ { OnDeviceFoundInner };
     static inline IServerDiscInnerCallback serverCallback_ { OnDeviceFound };
+    static inline IServerDiscInnerCallback countCallback_ { OnCountDeviceFound };
     static inline DeviceInfo innerDeviceInfo_;
     static inline DeviceInfo deviceInfo_;
 
@@ -125,9 +190,17 @@ public:
     static constexpr int32_t SUBSCRIBE_ID7 = 7;
     static constexpr int32_t SUBSCRIBE_ID8 = 8;
 
+    static constexpr int32_t SLOW_CALLBACK_MS = 50;
+    static constexpr int32_t WAIT_FOUND_TIMES = 500;
+    static constexpr int32_t WAIT_FOUND_INTERVAL_MS = 10;
+
+    static inline std::mutex foundLock_;
+    static inline std::map<std::string, uint32_t> foundCount_;
+    static inline std::map<std::string, std::set<std::string>> foundDevices_;
     static inline std::string callbackPackageName_;
     static inline const char *packageName_ = "TestPackage";
     static inline const char *packageName1_ = "TestPackage1";
+    static inline const char *slowPackageName_ = "TestSlowPackage";
     static inline const char *largePackageName_ = "aaaaaaaaabbbbbbbbccccccccddddddddaaaaaaaaabbbbbbbbccccccccdddddddde";
     static inline ConstraintMock *globalConstraintMock_ = nullptr;
 };
@@ -935,8 +1008,9 @@ HWTEST_F(DiscManagerMockTest, DiscMgrDeathCallback001, TestSize.Level1)
         DeviceInfo deviceInfo;
         deviceInfo.capabilityBitmapNum = 1;
         deviceInfo.capabilityBitmap[0] = 1 << OSD_CAPABILITY_BITMAP;
+        callbackPackageName_ = "";
         BleMock::InjectDeviceFoundEvent(&deviceInfo);
-        EXPECT_EQ(callbackPackageName_, packageName_);
+        EXPECT_TRUE(WaitDeviceFound(packageName_));
         EXPECT_EQ(deviceInfo_.capabilityBitmapNum, deviceInfo.capabilityBitmapNum);
         EXPECT_EQ(innerDeviceInfo_.capabilityBitmapNum, deviceInfo.capabilityBitmapNum);
     }
@@ -1481,4 +1555,142 @@ HWTEST_F(DiscManagerMockTest, DiscOnDeviceFoundConstraint001, TestSize.Level1)
     DISC_LOGI(DISC_TEST, "DiscOnDeviceFoundConstraint001 end ----");
 }
 
-} // namespace OHOS
\ No newline at end of file
+/*
+ * @tc.name: DiscOnDeviceFoundSlowClient001
+ * @tc.desc: a slow client callback does not block the reporting medium, other subscribers still get every device
+ *           and repeated reports of the same device are coalesced for the slow one
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DiscManagerMockTest, DiscOnDeviceFoundSlowClient001, TestSize.Level1)
+{
+    DISC_LOGI(DISC_TEST, "DiscOnDeviceFoundSlowClient001 begin ----");
+    constexpr int32_t deviceNum = 20;
+    constexpr int32_t reportRounds = 10;
+    static_assert(deviceNum <= DISC_FOUND_QUEUE_MAX, "every device fits in the found queue");
+    DiscMgrInitFuncMock();
+    {
+        BleMock bleMock;
+        bleMock.SetupStub();
+        SubscribeInfo info;
+        info.subscribeId = SUBSCRIBE_ID1;
+        info.medium = BLE;
+        info.mode = DISCOVER_MODE_ACTIVE;
+        info.freq = LOW;
+        info.capability = "osdCapability";
+        info.capabilityData = (uint8_t *)"test";
+        info.dataLen = 4;
+        ResetFoundCount();
+        EXPECT_EQ(DiscStartDiscovery(slowPackageName_, &info, &countCallback_, 0), SOFTBUS_OK);
+        EXPECT_EQ(DiscStartDiscovery(packageName_, &info, &countCallback_, 0), SOFTBUS_OK);
+
+        auto begin = std::chrono::steady_clock::now();
+        for (int32_t round = 0; round < reportRounds; round++) {
+            for (int32_t i = 0; i < deviceNum; i++) {
+                DeviceInfo deviceInfo = {};
+                (void)sprintf_s(deviceInfo.devId, sizeof(deviceInfo.devId), "device%d", i);
+                deviceInfo.capabilityBitmapNum = 1;
+                deviceInfo.capabilityBitmap[0] = 1 << OSD_CAPABILITY_BITMAP;
+                deviceInfo.range = round;
+                BleMock::InjectDeviceFoundEvent(&deviceInfo);
+            }
+        }
+        auto cost = std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - begin);
+        EXPECT_LT(cost.count(), SLOW_CALLBACK_MS * deviceNum);
+
+        EXPECT_TRUE(WaitFoundDevices(packageName_, deviceNum));
+        EXPECT_TRUE(WaitFoundDevices(slowPackageName_, deviceNum));
+        EXPECT_LT(GetFoundCount(slowPackageName_), static_cast<uint32_t>(deviceNum * reportRounds));
+
+        EXPECT_EQ(DiscStopDiscovery(slowPackageName_, SUBSCRIBE_ID1, 0), SOFTBUS_OK);
+        EXPECT_EQ(DiscStopDiscovery(packageName_, SUBSCRIBE_ID1, 0), SOFTBUS_OK);
+    }
+    DiscMgrDeInitFuncMock();
+    DISC_LOGI(DISC_TEST, "DiscOnDeviceFoundSlowClient001 end ----");
+}
+
+/*
+ * @tc.name: DiscOnDeviceFoundDedup001
+ * @tc.desc: identical reports of the same device inside the dedup window reach the client once
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DiscManagerMockTest, DiscOnDeviceFoundDedup001, TestSize.Level1)
+{
+    DISC_LOGI(DISC_TEST, "DiscOnDeviceFoundDedup001 begin ----");
+    constexpr int32_t reportTimes = 10;
+    DiscMgrInitFuncMock();
+    {
+        BleMock bleMock;
+        bleMock.SetupStub();
+        SubscribeInfo info;
+        info.subscribeId = SUBSCRIBE_ID2;
+        info.medium = BLE;
+        info.mode = DISCOVER_MODE_ACTIVE;
+        info.freq = LOW;
+        info.capability = "osdCapability";
+        info.capabilityData = (uint8_t *)"test";
+        info.dataLen = 4;
+        ResetFoundCount();
+        EXPECT_EQ(DiscStartDiscovery(packageName_, &info, &countCallback_, 0), SOFTBUS_OK);
+
+        DeviceInfo deviceInfo = {};
+        (void)strcpy_s(deviceInfo.devId, sizeof(deviceInfo.devId), "device");
+        deviceInfo.capabilityBitmapNum = 1;
+        deviceInfo.capabilityBitmap[0] = 1 << OSD_CAPABILITY_BITMAP;
+        for (int32_t i = 0; i < reportTimes; i++) {
+            BleMock::InjectDeviceFoundEvent(&deviceInfo);
+        }
+        EXPECT_TRUE(WaitFoundDevices(packageName_, 1));
+        std::this_thread::sleep_for(std::chrono::milliseconds(SLOW_CALLBACK_MS));
+        EXPECT_EQ(GetFoundCount(packageName_), 1U);
+
+        EXPECT_EQ(DiscStopDiscovery(packageName_, SUBSCRIBE_ID2, 0), SOFTBUS_OK);
+    }
+    DiscMgrDeInitFuncMock();
+    DISC_LOGI(DISC_TEST, "DiscOnDeviceFoundDedup001 end ----");
+}
+
+/*
+ * @tc.name: DiscOnDeviceFoundStop001
+ * @tc.desc: no report reaches a slow client after its stop discovery returns, the report being delivered is waited
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DiscManagerMockTest, DiscOnDeviceFoundStop001, TestSize.Level1)
+{
+    DISC_LOGI(DISC_TEST, "DiscOnDeviceFoundStop001 begin ----");
+    constexpr int32_t deviceNum = 10;
+    DiscMgrInitFuncMock();
+    {
+        BleMock bleMock;
+        bleMock.SetupStub();
+        SubscribeInfo info;
+        info.subscribeId = SUBSCRIBE_ID1;
+        info.medium = BLE;
+        info.mode = DISCOVER_MODE_ACTIVE;
+        info.freq = LOW;
+        info.capability = "osdCapability";
+        info.capabilityData = (uint8_t *)"test";
+        info.dataLen = 4;
+        ResetFoundCount();
+        EXPECT_EQ(DiscStartDiscovery(slowPackageName_, &info, &countCallback_, 0), SOFTBUS_OK);
+
+        for (int32_t i = 0; i < deviceNum; i++) {
+            DeviceInfo deviceInfo = {};
+            (void)sprintf_s(deviceInfo.devId, sizeof(deviceInfo.devId), "device%d", i);
+            deviceInfo.capabilityBitmapNum = 1;
+            deviceInfo.capabilityBitmap[0] = 1 << OSD_CAPABILITY_BITMAP;
+            BleMock::InjectDeviceFoundEvent(&deviceInfo);
+        }
+        EXPECT_TRUE(WaitFoundDevices(slowPackageName_, 1));
+        EXPECT_EQ(DiscStopDiscovery(slowPackageName_, SUBSCRIBE_ID1, 0), SOFTBUS_OK);
+        uint32_t stopCount = GetFoundCount(slowPackageName_);
+        std::this_thread::sleep_for(std::chrono::milliseconds(SLOW_CALLBACK_MS * 2));
+        EXPECT_EQ(GetFoundCount(slowPackageName_), stopCount);
+        EXPECT_LT(stopCount, static_cast<uint32_t>(deviceNum));
+    }
+    DiscMgrDeInitFuncMock();
+    DISC_LOGI(DISC_TEST, "DiscOnDeviceFoundStop001 end ----");
+}
+} // namespace OHOS
@@ -0,0 +1,102 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <string>
+
+#include "legacy/softbus_hisysevt_transreporter.h"
+#include "message_option.h"
+#include "message_parcel.h"
+#include "softbus_access_token_test.h"
+#include "softbus_bus_center.h"
+#include "softbus_error_code.h"
+#include "softbus_server.h"
+#include "softbus_server_frame.h"
+#include "softbus_server_ipc_interface_code.h"
+#include "system_ability_definition.h"
+
+namespace OHOS {
+static constexpr int64_t REPLAY_PARCEL_NUM = 1000000;
+static constexpr uint32_t CALLER_NUM = 20;
+static const char *TEST_PKG_NAME = "com.softbus.benchmark";
+
+static sptr<SoftBusServerStub> GetServerStub()
+{
+    static sptr<SoftBusServerStub> stub = nullptr;
+    if (stub == nullptr) {
+        SetAccessTokenPermission("SoftbusServerStubBenchmarkTest");
+        InitSoftBusServer();
+        stub = new (std::nothrow) SoftBusServer(SOFTBUS_SERVER_SA_ID, true);
+    }
+    return stub;
+}
+
+/**
+ * @tc.name: OnRemoteRequestTestCase
+ * @tc.desc: replay get local device info parcels through the server stub
+ * @tc.type: FUNC
+ * @tc.require: OnRemoteRequest normal operation
+ */
+static void OnRemoteRequestTestCase(benchmark::State &state)
+{
+    sptr<SoftBusServerStub> stub = GetServerStub();
+    if (stub == nullptr) {
+        state.SkipWithError("OnRemoteRequestTestCase new stub failed.");
+        return;
+    }
+    MessageOption option;
+    while (state.KeepRunning()) {
+        MessageParcel data;
+        MessageParcel reply;
+        data.WriteInterfaceToken(SoftBusServerStub::GetDescriptor());
+        data.WriteCString(TEST_PKG_NAME);
+        data.WriteUint32(sizeof(NodeBasicInfo));
+        if (stub->OnRemoteRequest(SERVER_GET_LOCAL_DEVICE_INFO, data, reply, option) != SOFTBUS_OK) {
+            state.SkipWithError("OnRemoteRequestTestCase failed.");
+            break;
+        }
+    }
+}
+BENCHMARK(OnRemoteRequestTestCase)->Iterations(REPLAY_PARCEL_NUM);
+
+/**
+ * @tc.name: RecordCalledApiTestCase
+ * @tc.desc: ipc ingress accounting from concurrent binder threads
+ * @tc.type: FUNC
+ * @tc.require: SoftbusRecordCalledApiCnt and SoftbusRecordCalledApiInfo normal operation
+ */
+static void RecordCalledApiTestCase(benchmark::State &state)
+{
+    static const bool isInit = (InitTransStatisticSysEvt() == SOFTBUS_OK);
+    if (!isInit) {
+        state.SkipWithError("RecordCalledApiTestCase init failed.");
+        return;
+    }
+    std::string callers[CALLER_NUM];
+    for (uint32_t i = 0; i < CALLER_NUM; i++) {
+        callers[i] = std::string(TEST_PKG_NAME) + std::to_string(i);
+    }
+    uint32_t index = 0;
+    while (state.KeepRunning()) {
+        SoftbusRecordCalledApiCnt(SERVER_GET_LOCAL_DEVICE_INFO);
+        SoftbusRecordCalledApiInfo(callers[index].c_str(), SERVER_GET_LOCAL_DEVICE_INFO);
+        index = (index + 1) % CALLER_NUM;
+    }
+}
+BENCHMARK(RecordCalledApiTestCase)->Iterations(REPLAY_PARCEL_NUM)->Threads(1)->Threads(4);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -2669,6 +2669,25 @@ HWTEST_F(SoftbusServerStubTest, CheckPermissionTest003, TestSize.Level1)
     EXPECT_EQ(ret, SOFTBUS_OK);
 }
 
+/*
+ * @tc.name: CheckPermissionTest004
+ * @tc.desc: Verify the flat handler and permission tables for codes inside and outside the table
+ * @tc.type: FUNC
+ * @tc.require: 1
+ */
+HWTEST_F(SoftbusServerStubTest, CheckPermissionTest004, TestSize.Level1)
+{
+    sptr<OHOS::SoftBusServerStub> softBusServer = new OHOS::SoftBusServer(SOFTBUS_SERVER_SA_ID, true);
+    ASSERT_NE(softBusServer, nullptr);
+    EXPECT_NE(softBusServer->memberFuncMap_[SERVER_OPEN_SESSION], nullptr);
+    EXPECT_NE(softBusServer->memberPermissionMap_[SERVER_OPEN_SESSION], nullptr);
+    EXPECT_NE(softBusServer->memberFuncMap_[SERVER_SESSION_SENDMSG], nullptr);
+    EXPECT_EQ(softBusServer->memberPermissionMap_[SERVER_SESSION_SENDMSG], nullptr);
+    EXPECT_EQ(softBusServer->memberFuncMap_[CLIENT_ON_CHANNEL_OPENED], nullptr);
+    EXPECT_EQ(softBusServer->CheckPermission(SOFTBUS_FUNC_ID_BUIT), SOFTBUS_OK);
+    EXPECT_EQ(softBusServer->CheckPermission(UINT32_MAX), SOFTBUS_OK);
+}
+
 /*
  * @tc.name: CheckAccountConstraintTest004
  * @tc.desc: Verify CheckAccountConstraint returns SOFTBUS_ACCOUNT_CONSTRAINT_ENABLE when constraint enabled
@@ -0,0 +1,121 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfile_send_bench_helper.h"
+
+#include <arpa/inet.h>
+#include <securec.h>
+#include <stdlib.h>
+
+#include "nstackx_error.h"
+#include "nstackx_socket.h"
+#include "nstackx_util.h"
+
+#define BENCH_RECV_BUF_LEN 65536
+
+static Socket g_sender = { .sockfd = INVALID_SOCKET };
+static SocketDesc g_receiver = INVALID_SOCKET;
+static uint8_t g_frames[BENCH_BATCH_NUM][BENCH_FRAME_LEN];
+static struct iovec g_iov[BENCH_BATCH_NUM];
+
+static int32_t BindLoopbackReceiver(struct sockaddr_in *addr)
+{
+    socklen_t len = sizeof(struct sockaddr_in);
+
+    g_receiver = socket(AF_INET, SOCK_DGRAM, 0);
+    if (g_receiver == INVALID_SOCKET) {
+        return NSTACKX_EFAILED;
+    }
+    addr->sin_family = AF_INET;
+    addr->sin_port = 0;
+    addr->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    if (bind(g_receiver, (struct sockaddr *)addr, len) != 0 ||
+        getsockname(g_receiver, (struct sockaddr *)addr, &len) != 0 || SetSocketNonBlock(g_receiver) != NSTACKX_EOK) {
+        return NSTACKX_EFAILED;
+    }
+    return NSTACKX_EOK;
+}
+
+int32_t BenchOpenLoopback(void)
+{
+    struct sockaddr_in addr;
+    (void)memset_s(&addr, sizeof(addr), 0, sizeof(addr));
+    if (BindLoopbackReceiver(&addr) != NSTACKX_EOK) {
+        BenchCloseLoopback();
+        return NSTACKX_EFAILED;
+    }
+    g_sender.protocol = NSTACKX_PROTOCOL_UDP;
+    g_sender.dstAddr = addr;
+    g_sender.sockfd = socket(AF_INET, SOCK_DGRAM, 0);
+    if (g_sender.sockfd == INVALID_SOCKET) {
+        BenchCloseLoopback();
+        return NSTACKX_EFAILED;
+    }
+    for (uint32_t i = 0; i < BENCH_BATCH_NUM; i++) {
+        (void)memset_s(g_frames[i], BENCH_FRAME_LEN, (int32_t)i, BENCH_FRAME_LEN);
+        g_iov[i].iov_base = g_frames[i];
+        g_iov[i].iov_len = BENCH_FRAME_LEN;
+    }
+    return NSTACKX_EOK;
+}
+
+void BenchCloseLoopback(void)
+{
+    if (g_sender.sockfd != INVALID_SOCKET) {
+        CloseSocketInner(g_sender.sockfd);
+        g_sender.sockfd = INVALID_SOCKET;
+    }
+    if (g_receiver != INVALID_SOCKET) {
+        CloseSocketInner(g_receiver);
+        g_receiver = INVALID_SOCKET;
+    }
+}
+
+void BenchDrainLoopback(void)
+{
+    static uint8_t buf[BENCH_RECV_BUF_LEN];
+    while (recv(g_receiver, buf, sizeof(buf), 0) > 0) {
+    }
+}
+
+/* one sendto per frame, what SendFileDataFrame did before the batch transmit */
+int32_t BenchSendEachFrame(void)
+{
+    for (uint32_t i = 0; i < BENCH_BATCH_NUM; i++) {
+        if (SocketSend(&g_sender, g_frames[i], BENCH_FRAME_LEN) != BENCH_FRAME_LEN) {
+            return NSTACKX_EFAILED;
+        }
+    }
+    return NSTACKX_EOK;
+}
+
+int32_t BenchSendBatch(void)
+{
+    uint32_t sent = 0;
+    while (sent < BENCH_BATCH_NUM) {
+        int32_t ret = SocketSendBatch(&g_sender, &g_iov[sent], BENCH_BATCH_NUM - sent);
+        if (ret <= 0) {
+            return NSTACKX_EFAILED;
+        }
+        sent += (uint32_t)ret;
+    }
+    return NSTACKX_EOK;
+}
+
+int32_t BenchSendGso(void)
+{
+    int32_t ret = SocketSendEx(&g_sender, BENCH_FRAME_LEN, g_iov, BENCH_BATCH_NUM);
+    return (ret == BENCH_FRAME_LEN * BENCH_BATCH_NUM) ? NSTACKX_EOK : NSTACKX_EFAILED;
+}
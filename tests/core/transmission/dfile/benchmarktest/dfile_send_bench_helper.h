@@ -0,0 +1,39 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DFILE_SEND_BENCH_HELPER_H
+#define DFILE_SEND_BENCH_HELPER_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* the nstackx headers are c only, the benchmark drives a loopback udp socket through these */
+#define BENCH_FRAME_LEN 1400 /* one dfile data frame on a 1500 mtu link */
+#define BENCH_BATCH_NUM 20   /* frames the dfile send thread hands to one batch transmit */
+
+int32_t BenchOpenLoopback(void);
+void BenchCloseLoopback(void);
+void BenchDrainLoopback(void);
+int32_t BenchSendEachFrame(void);
+int32_t BenchSendBatch(void);
+int32_t BenchSendGso(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* DFILE_SEND_BENCH_HELPER_H */
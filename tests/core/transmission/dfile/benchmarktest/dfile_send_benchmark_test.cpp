@@ -0,0 +1,89 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "dfile_send_bench_helper.h"
+
+namespace OHOS {
+static constexpr int64_t BATCH_BYTES = BENCH_FRAME_LEN * BENCH_BATCH_NUM;
+
+static bool OpenBenchLoopback(benchmark::State &state)
+{
+    if (BenchOpenLoopback() != 0) {
+        state.SkipWithError("open loopback udp socket failed.");
+        return false;
+    }
+    return true;
+}
+
+static void RunSendTestCase(benchmark::State &state, int32_t (*send)(void), const char *errMsg)
+{
+    if (!OpenBenchLoopback(state)) {
+        return;
+    }
+    while (state.KeepRunning()) {
+        if (send() != 0) {
+            state.SkipWithError(errMsg);
+            break;
+        }
+        state.PauseTiming();
+        BenchDrainLoopback();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * BENCH_BATCH_NUM);
+    state.SetBytesProcessed(state.iterations() * BATCH_BYTES);
+    BenchCloseLoopback();
+}
+
+/**
+ * @tc.name: SendEachFrameTestCase
+ * @tc.desc: Send 20 dfile sized frames over loopback udp with one sendto each Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: previous SendFileDataFrame udp transmit
+ */
+static void SendEachFrameTestCase(benchmark::State &state)
+{
+    RunSendTestCase(state, BenchSendEachFrame, "SendEachFrameTestCase send failed.");
+}
+BENCHMARK(SendEachFrameTestCase);
+
+/**
+ * @tc.name: SendBatchTestCase
+ * @tc.desc: Send 20 dfile sized frames over loopback udp with one sendmmsg Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: SocketSendBatch normal operation
+ */
+static void SendBatchTestCase(benchmark::State &state)
+{
+    RunSendTestCase(state, BenchSendBatch, "SendBatchTestCase send failed.");
+}
+BENCHMARK(SendBatchTestCase);
+
+/**
+ * @tc.name: SendGsoTestCase
+ * @tc.desc: Send 20 dfile sized frames over loopback udp with one udp gso sendmsg Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: SocketSendEx normal operation on a kernel with udp gso
+ */
+static void SendGsoTestCase(benchmark::State &state)
+{
+    RunSendTestCase(state, BenchSendGso, "SendGsoTestCase send failed, kernel without udp gso.");
+}
+BENCHMARK(SendGsoTestCase);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
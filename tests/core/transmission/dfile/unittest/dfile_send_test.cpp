@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <cerrno>
+#include <gtest/gtest.h>
+
+#include "dfile_send_test_helper.h"
+#include "nstackx_error.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+static constexpr uint32_t BATCH_NUM = 20;
+static constexpr uint32_t FILE_FRAME_NUM = 100;
+static constexpr int32_t PARTIAL_SENT_NUM = 7;
+
+class DFileSendTest : public testing::Test {
+public:
+    static void SetUpTestCase(void) { }
+    static void TearDownTestCase(void) { }
+    void SetUp() override { }
+    void TearDown() override
+    {
+        SendTestDeinit();
+    }
+};
+
+/* every frame of the file has been delivered once and in sequence order */
+static void ExpectDeliveredInOrder(uint32_t frameNum)
+{
+    uint32_t seq[SEND_TEST_MAX_FRAMES] = { 0 };
+    uint32_t num = SendTestGetDelivered(seq, SEND_TEST_MAX_FRAMES);
+    EXPECT_EQ(num, frameNum);
+    for (uint32_t i = 0; i < num; i++) {
+        EXPECT_EQ(seq[i], i);
+    }
+}
+
+/*
+ * @tc.name: UdpSendFileDataFrameBatchTest001
+ * @tc.desc: a partial batch send delivers the leading frames and keeps the rest queued in order
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DFileSendTest, UdpSendFileDataFrameBatchTest001, TestSize.Level1)
+{
+    SendTestInit(0, false);
+    const int32_t results[] = { PARTIAL_SENT_NUM };
+    SendTestScriptBatch(results, sizeof(results) / sizeof(results[0]));
+    uint32_t left = 0;
+    EXPECT_EQ(SendTestSendBatch(BATCH_NUM, &left), NSTACKX_EAGAIN);
+    EXPECT_EQ(left, BATCH_NUM - PARTIAL_SENT_NUM);
+    ExpectDeliveredInOrder(PARTIAL_SENT_NUM);
+
+    EXPECT_EQ(SendTestSendBatch(BATCH_NUM, &left), static_cast<int32_t>(BATCH_NUM));
+    EXPECT_EQ(left, 0U);
+}
+
+/*
+ * @tc.name: UdpSendFileDataFrameBatchTest002
+ * @tc.desc: a gso send failing with EIO falls back to batch send and turns gso off for the peer
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DFileSendTest, UdpSendFileDataFrameBatchTest002, TestSize.Level1)
+{
+    SendTestInit(0, true);
+    uint32_t left = 0;
+    EXPECT_EQ(SendTestSendBatch(BATCH_NUM, &left), static_cast<int32_t>(BATCH_NUM));
+    EXPECT_EQ(SendTestGetGsoSendNum(), 1U);
+    EXPECT_FALSE(SendTestIsGsoDisabled());
+
+    SendTestScriptGso(EIO);
+    EXPECT_EQ(SendTestSendBatch(BATCH_NUM, &left), static_cast<int32_t>(BATCH_NUM));
+    EXPECT_EQ(left, 0U);
+    EXPECT_TRUE(SendTestIsGsoDisabled());
+    EXPECT_EQ(SendTestSendBatch(BATCH_NUM, &left), static_cast<int32_t>(BATCH_NUM));
+    EXPECT_EQ(SendTestGetGsoSendNum(), 2U);
+    ExpectDeliveredInOrder(BATCH_NUM * 3);
+}
+
+/*
+ * @tc.name: UdpSendFileDataFrameBatchTest003
+ * @tc.desc: a gso send failing for another reason fails the batch and keeps gso on
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DFileSendTest, UdpSendFileDataFrameBatchTest003, TestSize.Level1)
+{
+    SendTestInit(0, true);
+    SendTestScriptGso(EPERM);
+    uint32_t left = 0;
+    EXPECT_EQ(SendTestSendBatch(BATCH_NUM, &left), NSTACKX_EFAILED);
+    EXPECT_FALSE(SendTestIsGsoDisabled());
+    ExpectDeliveredInOrder(0);
+}
+
+/*
+ * @tc.name: SendDataFrameTest001
+ * @tc.desc: frames of EAGAIN and partial sends go back to the unsent list and are later sent in order
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DFileSendTest, SendDataFrameTest001, TestSize.Level1)
+{
+    SendTestInit(FILE_FRAME_NUM, false);
+    const int32_t results[] = { SEND_TEST_SEND_EAGAIN, PARTIAL_SENT_NUM, SEND_TEST_SEND_EAGAIN, PARTIAL_SENT_NUM };
+    SendTestScriptBatch(results, sizeof(results) / sizeof(results[0]));
+    EXPECT_EQ(SendTestSendDataFrame(), NSTACKX_EAGAIN);
+    EXPECT_EQ(SendTestGetUnsentNum(), BATCH_NUM);
+    EXPECT_EQ(SendTestSendDataFrame(), NSTACKX_EAGAIN);
+    EXPECT_EQ(SendTestGetUnsentNum(), BATCH_NUM - PARTIAL_SENT_NUM);
+    EXPECT_EQ(SendTestSendDataFrame(), NSTACKX_EAGAIN);
+    EXPECT_EQ(SendTestGetUnsentNum(), BATCH_NUM);
+    EXPECT_EQ(SendTestSendDataFrame(), NSTACKX_EAGAIN);
+    EXPECT_EQ(SendTestSendDataFrame(), NSTACKX_EOK);
+    EXPECT_EQ(SendTestGetUnsentNum(), 0U);
+    ExpectDeliveredInOrder(FILE_FRAME_NUM);
+}
+
+/*
+ * @tc.name: SendDataFrameTest002
+ * @tc.desc: an EAGAIN batch smaller than the unsent list keeps the frames it did not take
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(DFileSendTest, SendDataFrameTest002, TestSize.Level1)
+{
+    SendTestInit(FILE_FRAME_NUM, false);
+    const int32_t results[] = { SEND_TEST_SEND_EAGAIN, SEND_TEST_SEND_EAGAIN };
+    SendTestScriptBatch(results, sizeof(results) / sizeof(results[0]));
+    EXPECT_EQ(SendTestSendDataFrame(), NSTACKX_EAGAIN);
+    EXPECT_EQ(SendTestGetUnsentNum(), BATCH_NUM);
+
+    /* with the rate used up the batch holds one frame, the other unsent frames must stay */
+    SendTestUseUpRate(true);
+    EXPECT_EQ(SendTestSendDataFrame(), NSTACKX_EAGAIN);
+    EXPECT_EQ(SendTestGetUnsentNum(), BATCH_NUM);
+
+    SendTestUseUpRate(false);
+    EXPECT_EQ(SendTestSendDataFrame(), NSTACKX_EOK);
+    EXPECT_EQ(SendTestGetUnsentNum(), 0U);
+    ExpectDeliveredInOrder(FILE_FRAME_NUM);
+}
+} // namespace OHOS
@@ -0,0 +1,248 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "dfile_send_test_helper.h"
+
+#include <arpa/inet.h>
+#include <errno.h>
+#include <securec.h>
+
+#include "nstackx_dfile_send.c"
+
+#define SEND_TEST_RATE 1000
+
+static DFileSession g_session;
+static PeerInfo g_peerInfo;
+static List g_unsent;
+static uint32_t g_frameNum = 0;
+static uint32_t g_nextSeq = 0;
+static int32_t g_batchResults[SEND_TEST_MAX_FRAMES];
+static uint32_t g_batchResultNum = 0;
+static uint32_t g_batchResultIndex = 0;
+static int32_t g_gsoErr = 0;
+static uint32_t g_gsoSendNum = 0;
+static uint32_t g_delivered[SEND_TEST_MAX_FRAMES];
+static uint32_t g_deliveredNum = 0;
+
+static BlockFrame *NewFrame(void)
+{
+    BlockFrame *block = (BlockFrame *)calloc(1, sizeof(BlockFrame));
+    FileDataFrameZS *f = (FileDataFrameZS *)calloc(1, sizeof(FileDataFrameZS) + SEND_TEST_FRAME_LEN);
+    if (block == NULL || f == NULL) {
+        free(block);
+        free(f);
+        return NULL;
+    }
+    f->header.type = NSTACKX_DFILE_FILE_DATA_FRAME;
+    f->header.length = htons((uint16_t)(sizeof(FileDataFrameZS) - DFILE_FRAME_HEADER_LEN + SEND_TEST_FRAME_LEN));
+    f->blockSequence = htonl(g_nextSeq++);
+    block->fileDataFrame = (FileDataFrame *)(void *)f;
+    return block;
+}
+
+static void Deliver(const struct iovec *iov, uint32_t cnt)
+{
+    for (uint32_t i = 0; i < cnt && g_deliveredNum < SEND_TEST_MAX_FRAMES; i++) {
+        const FileDataFrameZS *f = (const FileDataFrameZS *)iov[i].iov_base;
+        g_delivered[g_deliveredNum++] = ntohl(f->blockSequence);
+    }
+}
+
+int32_t SocketSendBatch(const Socket *socket, const struct iovec *iov, uint32_t cnt)
+{
+    (void)socket;
+    int32_t result = (int32_t)cnt;
+    if (g_batchResultIndex < g_batchResultNum) {
+        result = g_batchResults[g_batchResultIndex++];
+    }
+    if (result == SEND_TEST_SEND_EAGAIN) {
+        errno = EAGAIN;
+        return NSTACKX_EAGAIN;
+    }
+    uint32_t sent = ((uint32_t)result < cnt) ? (uint32_t)result : cnt;
+    Deliver(iov, sent);
+    return (int32_t)sent;
+}
+
+int32_t SocketSendEx(const Socket *socket, uint16_t mss, const struct iovec *iov, uint32_t cnt)
+{
+    (void)socket;
+    (void)mss;
+    g_gsoSendNum++;
+    if (g_gsoErr != 0) {
+        errno = g_gsoErr;
+        return NSTACKX_EFAILED;
+    }
+    int32_t len = 0;
+    for (uint32_t i = 0; i < cnt; i++) {
+        len += (int32_t)iov[i].iov_len;
+    }
+    Deliver(iov, cnt);
+    return len;
+}
+
+int32_t SocketSend(const Socket *socket, const uint8_t *buffer, size_t length)
+{
+    (void)socket;
+    (void)buffer;
+    (void)length;
+    return NSTACKX_EFAILED;
+}
+
+int32_t SocketRecv(Socket *socket, uint8_t *buffer, size_t length, struct sockaddr_in *srcAddr,
+    const socklen_t *addrLen)
+{
+    (void)socket;
+    (void)buffer;
+    (void)length;
+    (void)srcAddr;
+    (void)addrLen;
+    return NSTACKX_EFAILED;
+}
+
+void DestroyQueueNode(QueueNode *queueNode)
+{
+    (void)queueNode;
+}
+
+PeerInfo *ClientGetPeerInfoBySocketIndex(uint8_t socketIndex, const DFileSession *session)
+{
+    (void)session;
+    return (socketIndex == 0) ? &g_peerInfo : NULL;
+}
+
+uint8_t FileManagerHasPendingData(FileManager *fileManager)
+{
+    (void)fileManager;
+    return g_nextSeq < g_frameNum;
+}
+
+/* hands out the next frames of the file chained by list.next, the way the file manager does */
+int32_t FileManagerFileRead(FileManager *fileManager, uint32_t tid, BlockFrame **block, int32_t nr)
+{
+    (void)fileManager;
+    (void)tid;
+    BlockFrame *first = NULL;
+    BlockFrame *last = NULL;
+    int32_t cnt = 0;
+    while (cnt < nr && g_nextSeq < g_frameNum) {
+        BlockFrame *frame = NewFrame();
+        if (frame == NULL) {
+            break;
+        }
+        if (last == NULL) {
+            first = frame;
+        } else {
+            last->list.next = &frame->list;
+        }
+        last = frame;
+        cnt++;
+    }
+    *block = first;
+    return cnt;
+}
+
+void SendTestInit(uint32_t frameNum, bool gso)
+{
+    (void)memset_s(&g_session, sizeof(g_session), 0, sizeof(g_session));
+    (void)memset_s(&g_peerInfo, sizeof(g_peerInfo), 0, sizeof(g_peerInfo));
+    g_session.capability = gso ? NSTACKX_CAPS_UDP_GSO : 0;
+    g_peerInfo.session = &g_session;
+    g_peerInfo.amendSendRate = SEND_TEST_RATE;
+    ListInitHead(&g_unsent);
+    g_frameNum = (frameNum < SEND_TEST_MAX_FRAMES) ? frameNum : SEND_TEST_MAX_FRAMES;
+    g_nextSeq = 0;
+    g_batchResultNum = 0;
+    g_batchResultIndex = 0;
+    g_gsoErr = 0;
+    g_gsoSendNum = 0;
+    g_deliveredNum = 0;
+}
+
+void SendTestDeinit(void)
+{
+    DestroyIovList(&g_unsent, &g_session, 0);
+}
+
+void SendTestScriptBatch(const int32_t *results, uint32_t num)
+{
+    g_batchResultNum = (num < SEND_TEST_MAX_FRAMES) ? num : SEND_TEST_MAX_FRAMES;
+    g_batchResultIndex = 0;
+    (void)memcpy_s(g_batchResults, sizeof(g_batchResults), results, g_batchResultNum * sizeof(int32_t));
+}
+
+void SendTestScriptGso(int32_t err)
+{
+    g_gsoErr = err;
+}
+
+void SendTestUseUpRate(bool usedUp)
+{
+    g_peerInfo.intervalSendCount = usedUp ? (uint32_t)g_peerInfo.amendSendRate : 0;
+}
+
+int32_t SendTestSendDataFrame(void)
+{
+    return SendDataFrame(&g_session, &g_unsent, 0, 0);
+}
+
+int32_t SendTestSendBatch(uint32_t frameNum, uint32_t *left)
+{
+    List head;
+    ListInitHead(&head);
+    g_frameNum += frameNum;
+    for (uint32_t i = 0; i < frameNum; i++) {
+        BlockFrame *block = NewFrame();
+        if (block != NULL) {
+            ListInsertTail(&head, &block->list);
+        }
+    }
+    int32_t ret = UdpSendFileDataFrameBatch(&g_session, &g_peerInfo, &head);
+    uint32_t cnt = 0;
+    List *p = NULL;
+    LIST_FOR_EACH(p, &head) {
+        cnt++;
+    }
+    *left = cnt;
+    DestroyIovList(&head, &g_session, 0);
+    return ret;
+}
+
+uint32_t SendTestGetDelivered(uint32_t *seq, uint32_t maxNum)
+{
+    uint32_t num = (g_deliveredNum < maxNum) ? g_deliveredNum : maxNum;
+    (void)memcpy_s(seq, maxNum * sizeof(uint32_t), g_delivered, num * sizeof(uint32_t));
+    return num;
+}
+
+uint32_t SendTestGetUnsentNum(void)
+{
+    uint32_t cnt = 0;
+    List *p = NULL;
+    LIST_FOR_EACH(p, &g_unsent) {
+        cnt++;
+    }
+    return cnt;
+}
+
+uint32_t SendTestGetGsoSendNum(void)
+{
+    return g_gsoSendNum;
+}
+
+bool SendTestIsGsoDisabled(void)
+{
+    return g_peerInfo.gsoDisabled != 0;
+}
@@ -0,0 +1,52 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef DFILE_SEND_TEST_HELPER_H
+#define DFILE_SEND_TEST_HELPER_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* the dfile send path is c only, the test drives it with scripted socket results through these */
+#define SEND_TEST_FRAME_LEN   1400  /* payload of one data frame */
+#define SEND_TEST_MAX_FRAMES  256
+#define SEND_TEST_SEND_EAGAIN (-1)  /* a scripted batch send that fails with EAGAIN */
+
+void SendTestInit(uint32_t frameNum, bool gso);
+void SendTestDeinit(void);
+/* results of the next batch sends, the number of leading frames sent or SEND_TEST_SEND_EAGAIN */
+void SendTestScriptBatch(const int32_t *results, uint32_t num);
+/* errno of every gso send, 0 lets it succeed */
+void SendTestScriptGso(int32_t err);
+/* marks the send rate of the current interval used up, so the next batch holds a single frame */
+void SendTestUseUpRate(bool usedUp);
+/* one SendDataFrame call of the send thread */
+int32_t SendTestSendDataFrame(void);
+/* one UdpSendFileDataFrameBatch call over frameNum new frames, left is set to the frames still queued */
+int32_t SendTestSendBatch(uint32_t frameNum, uint32_t *left);
+/* sequences of the delivered frames in delivery order, returns their number */
+uint32_t SendTestGetDelivered(uint32_t *seq, uint32_t maxNum);
+uint32_t SendTestGetUnsentNum(void);
+uint32_t SendTestGetGsoSendNum(void);
+bool SendTestIsGsoDisabled(void);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* DFILE_SEND_TEST_HELPER_H */
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024-2025 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,7 +14,12 @@
  */
 
 #include "gtest/gtest.h"
+#include <atomic>
+#include <mutex>
 #include <securec.h>
+#include <set>
+#include <thread>
+#include <vector>
 
 #include "trans_lane_pending_ctl.c"
 #include "trans_lane_pending_test_mock.h"
@@ -31,6 +36,8 @@ using namespace testing::ext;
 #define TEST_LANE_ID 268438006
 #define TEST_NEW_LANE_ID 268438007
 #define TEST_TOKEN_ID 123456
+#define TEST_SLOW_OPEN_NUM 64
+#define TEST_IPC_THREAD_NUM 4
 
 namespace OHOS {
 
@@ -2480,7 +2487,7 @@ HWTEST_F(TransLanePendingTest, TransAddInfoByLaneHandleTest002, TestSize.Level1)
     ASSERT_TRUE(item != nullptr);
     item->laneHandle = 1235;
     (void)SoftBusMutexLock(&(g_reqLanePendingList->lock));
-    ListAdd(&(g_reqLanePendingList->list), &(item->node));
+    AddReqLaneItemLocked(g_reqLanePendingList, item, false);
     (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
     NetWorkingChannelInfo info = {
         .channelId = TEST_CHANNEL_ID,
@@ -2509,7 +2516,7 @@ HWTEST_F(TransLanePendingTest, TransAddInfoByLaneHandleTest003, TestSize.Level1)
     ASSERT_TRUE(item != nullptr);
     item->laneHandle = 1235;
     (void)SoftBusMutexLock(&(g_reqLanePendingList->lock));
-    ListAdd(&(g_reqLanePendingList->list), &(item->node));
+    AddReqLaneItemLocked(g_reqLanePendingList, item, false);
     (void)SoftBusMutexUnlock(&(g_reqLanePendingList->lock));
     NetWorkingChannelInfo info;
     info.isNetWorkingChannel = true;
@@ -2800,4 +2807,291 @@ HWTEST_F(TransLanePendingTest, UpdateChannelCancelEncryptionTest009, TestSize.Le
     EXPECT_NE(0, appInfo.udpChannelCapability & (1u << CHANNEL_ISMULTINEG_OFFSET));
     EXPECT_EQ(0, appInfo.udpChannelCapability & (1u << UDP_CHANNEL_CANCEL_ENCRYPTION));
 }
+
+static std::atomic<uint32_t> g_slowLaneHandle(TEST_LANE_ID);
+
+static uint32_t TestApplySlowLaneReqId(LaneType type)
+{
+    (void)type;
+    return g_slowLaneHandle++;
+}
+
+static LnnLaneManager g_slowLaneManager = {
+    .lnnGetLaneHandle = TestApplySlowLaneReqId,
+};
+
+/*
+ * @tc.name: TransAsyncGetLaneInfoByOptionTest001
+ * @tc.desc: 64 slow non qos opens on a fixed pool of 4 ipc threads return before any lane result,
+ *           and every open is completed later by its lane callback
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransLanePendingTest, TransAsyncGetLaneInfoByOptionTest001, TestSize.Level1)
+{
+    NiceMock<TransLanePendingTestInterfaceMock> mock;
+    TransAsyncReqLanePendingDeinit();
+    EXPECT_CALL(mock, CreateSoftBusList).WillOnce(Return(TestCreateSessionList()));
+    ASSERT_EQ(TransAsyncReqLanePendingInit(), SOFTBUS_OK);
+    EXPECT_CALL(mock, GetLaneManager).WillRepeatedly(Return(&g_slowLaneManager));
+    EXPECT_CALL(mock, TransGetLaneTransTypeBySession).WillRepeatedly(Return(LANE_T_BYTE));
+    EXPECT_CALL(mock, LnnGetRemoteNodeInfoById).WillRepeatedly(Return(SOFTBUS_NOT_FIND));
+    EXPECT_CALL(mock, TransGetUidAndPid).WillRepeatedly(Return(SOFTBUS_OK));
+
+    // the lane manager only queues the request, its result comes long after the ipc call
+    std::mutex lock;
+    std::vector<std::pair<uint32_t, ILaneListener>> pendingLanes;
+    EXPECT_CALL(mock, LnnRequestLane).WillRepeatedly(
+        [&lock, &pendingLanes](uint32_t laneReqId, const LaneRequestOption *request, const ILaneListener *listener) {
+            (void)request;
+            std::lock_guard<std::mutex> guard(lock);
+            pendingLanes.emplace_back(laneReqId, *listener);
+            return SOFTBUS_OK;
+        });
+    std::set<int32_t> failedSessions;
+    EXPECT_CALL(mock, ClientIpcOnChannelOpenFailed).WillRepeatedly(
+        [&lock, &failedSessions](ChannelMsg *data, int32_t errorCode) {
+            (void)errorCode;
+            std::lock_guard<std::mutex> guard(lock);
+            failedSessions.insert(data->msgChannelId);
+            return SOFTBUS_OK;
+        });
+
+    std::atomic<uint32_t> nextOpen(0);
+    std::atomic<uint32_t> okNum(0);
+    std::vector<std::thread> ipcPool;
+    for (uint32_t i = 0; i < TEST_IPC_THREAD_NUM; i++) {
+        ipcPool.emplace_back([&nextOpen, &okNum]() {
+            SessionAttribute attr;
+            (void)memset_s(&attr, sizeof(SessionAttribute), 0, sizeof(SessionAttribute));
+            attr.dataType = TYPE_BYTES;
+            char peerDeviceId[NETWORK_ID_BUF_LEN] = { 0 };
+            (void)strcpy_s(peerDeviceId, NETWORK_ID_BUF_LEN, TEST_DEVICE_ID);
+            AppInfo appInfo;
+            (void)memset_s(&appInfo, sizeof(AppInfo), 0, sizeof(AppInfo));
+            for (uint32_t index = nextOpen++; index < TEST_SLOW_OPEN_NUM; index = nextOpen++) {
+                SessionParam param;
+                (void)memset_s(&param, sizeof(SessionParam), 0, sizeof(SessionParam));
+                param.sessionName = TEST_SESSION_NAME;
+                param.peerSessionName = TEST_SESSION_NAME;
+                param.peerDeviceId = peerDeviceId;
+                param.attr = &attr;
+                param.sessionId = TEST_SESSION_ID + index;
+                param.isAsync = true;
+                uint32_t laneHandle = INVALID_LANE_REQ_ID;
+                if (TransAsyncGetLaneInfoByOption(&param, &laneHandle, &appInfo) == SOFTBUS_OK) {
+                    okNum++;
+                }
+            }
+        });
+    }
+    for (auto &thread : ipcPool) {
+        thread.join();
+    }
+    EXPECT_EQ(okNum.load(), TEST_SLOW_OPEN_NUM);
+    ASSERT_EQ(pendingLanes.size(), TEST_SLOW_OPEN_NUM);
+    EXPECT_EQ(g_asyncReqLanePendingList->cnt, TEST_SLOW_OPEN_NUM);
+    EXPECT_TRUE(failedSessions.empty());
+
+    std::thread laneThread([&pendingLanes]() {
+        for (auto &lane : pendingLanes) {
+            lane.second.onLaneRequestFail(lane.first, SOFTBUS_TRANS_GET_LANE_INFO_ERR);
+        }
+    });
+    laneThread.join();
+    EXPECT_EQ(failedSessions.size(), TEST_SLOW_OPEN_NUM);
+    EXPECT_EQ(*failedSessions.begin(), TEST_SESSION_ID);
+    EXPECT_EQ(g_asyncReqLanePendingList->cnt, 0U);
+    uint32_t laneHandle = INVALID_LANE_REQ_ID;
+    EXPECT_EQ(TransAsyncGetLaneInfoByOption(nullptr, &laneHandle, nullptr), SOFTBUS_INVALID_PARAM);
+}
+
+/*
+ * @tc.name: TransAsyncGetLaneInfoByOptionTest002
+ * @tc.desc: a non qos open hands the channel to the client by set channel info once its lane succeeds,
+ *           and the lane is kept by the lane manager as a non qos lane
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransLanePendingTest, TransAsyncGetLaneInfoByOptionTest002, TestSize.Level1)
+{
+    NiceMock<TransLanePendingTestInterfaceMock> mock;
+    TransAsyncReqLanePendingDeinit();
+    EXPECT_CALL(mock, CreateSoftBusList).WillOnce(Return(TestCreateSessionList()));
+    ASSERT_EQ(TransAsyncReqLanePendingInit(), SOFTBUS_OK);
+    EXPECT_CALL(mock, GetLaneManager).WillRepeatedly(Return(&g_slowLaneManager));
+    EXPECT_CALL(mock, TransGetLaneTransTypeBySession).WillRepeatedly(Return(LANE_T_BYTE));
+    EXPECT_CALL(mock, LnnGetRemoteNodeInfoById).WillRepeatedly(Return(SOFTBUS_NOT_FIND));
+    EXPECT_CALL(mock, TransGetUidAndPid).WillRepeatedly(Return(SOFTBUS_OK));
+    uint32_t requestedLane = INVALID_LANE_REQ_ID;
+    ILaneListener laneListener;
+    (void)memset_s(&laneListener, sizeof(ILaneListener), 0, sizeof(ILaneListener));
+    EXPECT_CALL(mock, LnnRequestLane).WillOnce(
+        [&requestedLane, &laneListener](uint32_t laneReqId, const LaneRequestOption *request,
+            const ILaneListener *listener) {
+            (void)request;
+            requestedLane = laneReqId;
+            laneListener = *listener;
+            return SOFTBUS_OK;
+        });
+    EXPECT_CALL(mock, TransOpenChannelProc).WillOnce(
+        [](ChannelType type, AppInfo *appInfo, const ConnectOption *connOpt, int32_t *channelId) {
+            (void)type;
+            (void)appInfo;
+            (void)connOpt;
+            *channelId = TEST_CHANNEL_ID;
+            return SOFTBUS_OK;
+        });
+    EXPECT_CALL(mock, ClientIpcSetChannelInfo(_, _, TEST_SESSION_ID, _, _)).WillOnce(Return(SOFTBUS_OK));
+    EXPECT_CALL(mock, TransLaneMgrAddLane(_, _, _, false, _)).WillOnce(Return(SOFTBUS_OK));
+    EXPECT_CALL(mock, ClientIpcOnChannelOpenFailed).Times(0);
+
+    SessionAttribute attr;
+    (void)memset_s(&attr, sizeof(SessionAttribute), 0, sizeof(SessionAttribute));
+    attr.dataType = TYPE_BYTES;
+    char peerDeviceId[NETWORK_ID_BUF_LEN] = { 0 };
+    (void)strcpy_s(peerDeviceId, NETWORK_ID_BUF_LEN, TEST_DEVICE_ID);
+    SessionParam param;
+    (void)memset_s(&param, sizeof(SessionParam), 0, sizeof(SessionParam));
+    param.sessionName = TEST_SESSION_NAME;
+    param.peerSessionName = TEST_SESSION_NAME;
+    param.peerDeviceId = peerDeviceId;
+    param.attr = &attr;
+    param.sessionId = TEST_SESSION_ID;
+    param.isAsync = true;
+    AppInfo appInfo;
+    (void)memset_s(&appInfo, sizeof(AppInfo), 0, sizeof(AppInfo));
+    uint32_t laneHandle = INVALID_LANE_REQ_ID;
+    ASSERT_EQ(TransAsyncGetLaneInfoByOption(&param, &laneHandle, &appInfo), SOFTBUS_OK);
+    ASSERT_NE(laneListener.onLaneRequestSuccess, nullptr);
+    EXPECT_EQ(g_asyncReqLanePendingList->cnt, 1U);
+
+    LaneConnInfo connInfo;
+    (void)memset_s(&connInfo, sizeof(LaneConnInfo), 0, sizeof(LaneConnInfo));
+    connInfo.type = LANE_WLAN_2P4G;
+    laneListener.onLaneRequestSuccess(requestedLane, &connInfo);
+    EXPECT_EQ(g_asyncReqLanePendingList->cnt, 0U);
+}
+
+/* drive a traced non qos open from TransAsyncGetLaneInfoByOption to its lane callback on the lane thread */
+static uint32_t TestTracedAsyncOpen(NiceMock<TransLanePendingTestInterfaceMock> &mock, int32_t openRet,
+    ChannelType *openType)
+{
+    TransAsyncReqLanePendingDeinit();
+    EXPECT_CALL(mock, CreateSoftBusList).WillOnce(Return(TestCreateSessionList()));
+    EXPECT_EQ(TransAsyncReqLanePendingInit(), SOFTBUS_OK);
+    EXPECT_CALL(mock, GetLaneManager).WillRepeatedly(Return(&g_slowLaneManager));
+    EXPECT_CALL(mock, TransGetLaneTransTypeBySession).WillRepeatedly(Return(LANE_T_BYTE));
+    EXPECT_CALL(mock, LnnGetRemoteNodeInfoById).WillRepeatedly(Return(SOFTBUS_NOT_FIND));
+    EXPECT_CALL(mock, TransGetUidAndPid).WillRepeatedly(Return(SOFTBUS_OK));
+    uint32_t requestedLane = INVALID_LANE_REQ_ID;
+    ILaneListener laneListener;
+    (void)memset_s(&laneListener, sizeof(ILaneListener), 0, sizeof(ILaneListener));
+    EXPECT_CALL(mock, LnnRequestLane).WillOnce(
+        [&requestedLane, &laneListener](uint32_t laneReqId, const LaneRequestOption *request,
+            const ILaneListener *listener) {
+            (void)request;
+            requestedLane = laneReqId;
+            laneListener = *listener;
+            return SOFTBUS_OK;
+        });
+    EXPECT_CALL(mock, TransOpenChannelProc).WillOnce(
+        [openRet, openType](ChannelType type, AppInfo *appInfo, const ConnectOption *connOpt, int32_t *channelId) {
+            (void)appInfo;
+            (void)connOpt;
+            *openType = type;
+            *channelId = TEST_CHANNEL_ID;
+            return openRet;
+        });
+    EXPECT_CALL(mock, ClientIpcSetChannelInfo).WillRepeatedly(Return(SOFTBUS_OK));
+    EXPECT_CALL(mock, TransLaneMgrAddLane).WillRepeatedly(Return(SOFTBUS_OK));
+
+    SessionAttribute attr;
+    (void)memset_s(&attr, sizeof(SessionAttribute), 0, sizeof(SessionAttribute));
+    attr.dataType = TYPE_BYTES;
+    char peerDeviceId[NETWORK_ID_BUF_LEN] = { 0 };
+    (void)strcpy_s(peerDeviceId, NETWORK_ID_BUF_LEN, TEST_DEVICE_ID);
+    SessionParam param;
+    (void)memset_s(&param, sizeof(SessionParam), 0, sizeof(SessionParam));
+    param.sessionName = TEST_SESSION_NAME;
+    param.peerSessionName = TEST_SESSION_NAME;
+    param.peerDeviceId = peerDeviceId;
+    param.attr = &attr;
+    param.sessionId = TEST_SESSION_ID;
+    param.isAsync = true;
+    AppInfo appInfo;
+    (void)memset_s(&appInfo, sizeof(AppInfo), 0, sizeof(AppInfo));
+    uint32_t traceId = TransOpenTraceBegin();
+    uint32_t laneHandle = INVALID_LANE_REQ_ID;
+    EXPECT_EQ(TransAsyncGetLaneInfoByOption(&param, &laneHandle, &appInfo), SOFTBUS_OK);
+    TransOpenTraceSetCurrent(TRANS_OPEN_TRACE_INVALID_ID);
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_LANE_HANDLE, requestedLane), traceId);
+    if (laneListener.onLaneRequestSuccess == nullptr) {
+        ADD_FAILURE() << "lane listener is not set";
+        return traceId;
+    }
+
+    LaneConnInfo connInfo;
+    (void)memset_s(&connInfo, sizeof(LaneConnInfo), 0, sizeof(LaneConnInfo));
+    connInfo.type = LANE_WLAN_2P4G;
+    std::thread laneThread([&laneListener, requestedLane, &connInfo]() {
+        laneListener.onLaneRequestSuccess(requestedLane, &connInfo);
+        EXPECT_EQ(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_INVALID_ID);
+    });
+    laneThread.join();
+    return traceId;
+}
+
+/*
+ * @tc.name: TransOpenTraceAsyncOpenTest001
+ * @tc.desc: the lane callback and TransAsyncOpenChannelProc record their phases on the trace bound to the
+ *           laneHandle, and bind the opened channel by its type and channelId
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransLanePendingTest, TransOpenTraceAsyncOpenTest001, TestSize.Level1)
+{
+    ASSERT_EQ(TransOpenTraceInit(), SOFTBUS_OK);
+    TransOpenTraceClear();
+    NiceMock<TransLanePendingTestInterfaceMock> mock;
+    ChannelType openType = CHANNEL_TYPE_BUTT;
+    uint32_t traceId = TestTracedAsyncOpen(mock, SOFTBUS_OK, &openType);
+    ASSERT_NE(traceId, TRANS_OPEN_TRACE_INVALID_ID);
+
+    TransOpenSpan span;
+    ASSERT_EQ(TransOpenTraceGetSpan(traceId, &span), SOFTBUS_OK);
+    EXPECT_NE(span.phaseMask & (1U << TRANS_OPEN_PHASE_LANE_ALLOCED), 0U);
+    EXPECT_NE(span.phaseMask & (1U << TRANS_OPEN_PHASE_CHANNEL_CONNECT), 0U);
+    EXPECT_EQ(span.phaseMask & (1U << TRANS_OPEN_PHASE_FAILED), 0U);
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(openType, TEST_CHANNEL_ID)), traceId);
+    int32_t otherType = (openType == CHANNEL_TYPE_PROXY) ? CHANNEL_TYPE_TCP_DIRECT : CHANNEL_TYPE_PROXY;
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(otherType, TEST_CHANNEL_ID)), TRANS_OPEN_TRACE_INVALID_ID);
+    TransOpenTraceDeinit();
+}
+
+/*
+ * @tc.name: TransOpenTraceAsyncOpenTest002
+ * @tc.desc: a channel open failure in TransAsyncOpenChannelProc ends the trace bound to the laneHandle as failed
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransLanePendingTest, TransOpenTraceAsyncOpenTest002, TestSize.Level1)
+{
+    ASSERT_EQ(TransOpenTraceInit(), SOFTBUS_OK);
+    TransOpenTraceClear();
+    NiceMock<TransLanePendingTestInterfaceMock> mock;
+    ChannelType openType = CHANNEL_TYPE_BUTT;
+    uint32_t traceId = TestTracedAsyncOpen(mock, SOFTBUS_TRANS_CREATE_CHANNEL_ERR, &openType);
+    ASSERT_NE(traceId, TRANS_OPEN_TRACE_INVALID_ID);
+
+    TransOpenSpan span;
+    ASSERT_EQ(TransOpenTraceGetSpan(traceId, &span), SOFTBUS_OK);
+    EXPECT_NE(span.phaseMask & (1U << TRANS_OPEN_PHASE_CHANNEL_CONNECT), 0U);
+    EXPECT_NE(span.phaseMask & (1U << TRANS_OPEN_PHASE_FAILED), 0U);
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(openType, TEST_CHANNEL_ID)), TRANS_OPEN_TRACE_INVALID_ID);
+    TransOpenTraceDeinit();
+}
 } // namespace OHOS
@@ -0,0 +1,200 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <gtest/gtest.h>
+#include <thread>
+
+#include "softbus_error_code.h"
+#include "trans_open_trace.h"
+
+using namespace testing::ext;
+
+namespace OHOS {
+constexpr uint32_t TEST_LANE_HANDLE = 1001;
+constexpr int32_t TEST_CHANNEL_ID = 2001;
+constexpr int32_t TEST_CHANNEL_TYPE = 1;
+constexpr int32_t TEST_OTHER_CHANNEL_TYPE = 2;
+constexpr uint32_t TEST_REQUEST_ID = 3001;
+constexpr uint32_t TEST_OPEN_NUM = 50;
+
+class TransOpenTraceTest : public testing::Test {
+public:
+    static void SetUpTestCase() { }
+    static void TearDownTestCase() { }
+    void SetUp() override
+    {
+        ASSERT_EQ(TransOpenTraceInit(), SOFTBUS_OK);
+        TransOpenTraceClear();
+    }
+    void TearDown() override
+    {
+        TransOpenTraceDeinit();
+    }
+};
+
+/* a qos open: lane callback, proxy connect result and channel opened callback each come on their own thread */
+static uint32_t StubLocalOpen(uint32_t laneHandle, int32_t channelId, uint32_t requestId)
+{
+    uint32_t traceId = TransOpenTraceBegin();
+    TransOpenTraceRecord(TransOpenTraceGetCurrent(), TRANS_OPEN_PHASE_LANE_REQUEST);
+    TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_LANE_HANDLE, laneHandle);
+    TransOpenTraceSetCurrent(TRANS_OPEN_TRACE_INVALID_ID);
+
+    std::thread laneThread([laneHandle, channelId, requestId]() {
+        uint32_t laneTraceId = TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_LANE_HANDLE, laneHandle);
+        TransOpenTraceRecord(laneTraceId, TRANS_OPEN_PHASE_LANE_ALLOCED);
+        TransOpenTraceSetCurrent(laneTraceId);
+        TransOpenTraceRecord(TransOpenTraceGetCurrent(), TRANS_OPEN_PHASE_CHANNEL_CONNECT);
+        TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+            TransOpenTraceChannelKey(TEST_CHANNEL_TYPE, channelId));
+        TransOpenTraceBind(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_KEY_REQUEST_ID, requestId);
+        TransOpenTraceSetCurrent(TRANS_OPEN_TRACE_INVALID_ID);
+    });
+    laneThread.join();
+    std::thread connThread([requestId]() {
+        TransOpenTraceRecordByKey(TRANS_OPEN_TRACE_KEY_REQUEST_ID, requestId, TRANS_OPEN_PHASE_CONN_CONNECTED);
+    });
+    connThread.join();
+    std::thread openedThread([channelId]() {
+        TransOpenTraceRecordByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+            TransOpenTraceChannelKey(TEST_CHANNEL_TYPE, channelId), TRANS_OPEN_PHASE_CHANNEL_OPENED);
+    });
+    openedThread.join();
+    return traceId;
+}
+
+/*
+ * @tc.name: TransOpenTraceSpanTest001
+ * @tc.desc: Test a stubbed local open carries its trace id across laneHandle, channelId and requestId
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(TransOpenTraceTest, TransOpenTraceSpanTest001, TestSize.Level1)
+{
+    uint32_t traceId = StubLocalOpen(TEST_LANE_HANDLE, TEST_CHANNEL_ID, TEST_REQUEST_ID);
+    ASSERT_NE(traceId, TRANS_OPEN_TRACE_INVALID_ID);
+
+    TransOpenSpan span;
+    ASSERT_EQ(TransOpenTraceGetSpan(traceId, &span), SOFTBUS_OK);
+    EXPECT_EQ(span.traceId, traceId);
+    for (uint32_t i = TRANS_OPEN_PHASE_START; i <= TRANS_OPEN_PHASE_CHANNEL_OPENED; i++) {
+        EXPECT_NE(span.phaseMask & (1U << i), 0U) << "phase " << i;
+    }
+    EXPECT_EQ(span.phaseMask & (1U << TRANS_OPEN_PHASE_FAILED), 0U);
+    for (uint32_t i = TRANS_OPEN_PHASE_LANE_REQUEST; i <= TRANS_OPEN_PHASE_CHANNEL_OPENED; i++) {
+        EXPECT_GE(span.phaseTimeUs[i], span.phaseTimeUs[i - 1]) << "phase " << i;
+    }
+
+    // the opened trace drops its bindings so reused ids start clean
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_LANE_HANDLE, TEST_LANE_HANDLE),
+        TRANS_OPEN_TRACE_INVALID_ID);
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(TEST_CHANNEL_TYPE, TEST_CHANNEL_ID)), TRANS_OPEN_TRACE_INVALID_ID);
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_REQUEST_ID, TEST_REQUEST_ID),
+        TRANS_OPEN_TRACE_INVALID_ID);
+    EXPECT_EQ(TransOpenTraceGetSpan(traceId + 1, &span), SOFTBUS_NOT_FIND);
+    EXPECT_EQ(TransOpenTraceGetSpan(traceId, nullptr), SOFTBUS_INVALID_PARAM);
+}
+
+/*
+ * @tc.name: TransOpenTraceSummaryTest001
+ * @tc.desc: Test TransOpenTraceGetSummary gives ordered percentiles of opened traces and counts failed ones
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(TransOpenTraceTest, TransOpenTraceSummaryTest001, TestSize.Level1)
+{
+    for (uint32_t i = 0; i < TEST_OPEN_NUM; i++) {
+        EXPECT_NE(StubLocalOpen(TEST_LANE_HANDLE + i, TEST_CHANNEL_ID + i, TEST_REQUEST_ID + i),
+            TRANS_OPEN_TRACE_INVALID_ID);
+    }
+    uint32_t failedId = TransOpenTraceBegin();
+    TransOpenTraceBind(failedId, TRANS_OPEN_TRACE_KEY_LANE_HANDLE, TEST_LANE_HANDLE);
+    TransOpenTraceRecordByKey(TRANS_OPEN_TRACE_KEY_LANE_HANDLE, TEST_LANE_HANDLE, TRANS_OPEN_PHASE_FAILED);
+    TransOpenTraceSetCurrent(TRANS_OPEN_TRACE_INVALID_ID);
+    // an open still waiting for its lane is neither opened nor failed
+    (void)TransOpenTraceBegin();
+    TransOpenTraceSetCurrent(TRANS_OPEN_TRACE_INVALID_ID);
+
+    TransOpenTraceSummary summary;
+    ASSERT_EQ(TransOpenTraceGetSummary(&summary), SOFTBUS_OK);
+    EXPECT_EQ(summary.openedNum, TEST_OPEN_NUM);
+    EXPECT_EQ(summary.failedNum, 1U);
+    EXPECT_EQ(summary.total.count, TEST_OPEN_NUM);
+    EXPECT_LE(summary.total.p50Us, summary.total.p90Us);
+    EXPECT_LE(summary.total.p90Us, summary.total.p99Us);
+    EXPECT_LE(summary.total.p99Us, summary.total.maxUs);
+    uint64_t phaseSumMax = 0;
+    for (uint32_t i = TRANS_OPEN_PHASE_LANE_REQUEST; i <= TRANS_OPEN_PHASE_CHANNEL_OPENED; i++) {
+        EXPECT_EQ(summary.phase[i].count, TEST_OPEN_NUM) << "phase " << i;
+        EXPECT_LE(summary.phase[i].p50Us, summary.phase[i].p99Us);
+        phaseSumMax += summary.phase[i].maxUs;
+    }
+    EXPECT_LE(summary.total.maxUs, phaseSumMax);
+    EXPECT_EQ(TransOpenTraceGetSummary(nullptr), SOFTBUS_INVALID_PARAM);
+}
+
+/*
+ * @tc.name: TransOpenTraceChannelKeyTest001
+ * @tc.desc: Test a failure of another channel type with the same channelId leaves the open trace running
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(TransOpenTraceTest, TransOpenTraceChannelKeyTest001, TestSize.Level1)
+{
+    uint32_t traceId = TransOpenTraceBegin();
+    TransOpenTraceBind(traceId, TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(TEST_CHANNEL_TYPE, TEST_CHANNEL_ID));
+    TransOpenTraceSetCurrent(TRANS_OPEN_TRACE_INVALID_ID);
+    EXPECT_NE(TransOpenTraceChannelKey(TEST_CHANNEL_TYPE, TEST_CHANNEL_ID),
+        TransOpenTraceChannelKey(TEST_OTHER_CHANNEL_TYPE, TEST_CHANNEL_ID));
+
+    TransOpenTraceRecordByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(TEST_OTHER_CHANNEL_TYPE, TEST_CHANNEL_ID), TRANS_OPEN_PHASE_FAILED);
+    TransOpenSpan span;
+    ASSERT_EQ(TransOpenTraceGetSpan(traceId, &span), SOFTBUS_OK);
+    EXPECT_EQ(span.phaseMask & (1U << TRANS_OPEN_PHASE_FAILED), 0U);
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(TEST_CHANNEL_TYPE, TEST_CHANNEL_ID)), traceId);
+
+    TransOpenTraceRecordByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(TEST_CHANNEL_TYPE, TEST_CHANNEL_ID), TRANS_OPEN_PHASE_FAILED);
+    ASSERT_EQ(TransOpenTraceGetSpan(traceId, &span), SOFTBUS_OK);
+    EXPECT_NE(span.phaseMask & (1U << TRANS_OPEN_PHASE_FAILED), 0U);
+}
+
+/*
+ * @tc.name: TransOpenTraceNoInitTest001
+ * @tc.desc: Test the recorder ignores every hook once it is deinit
+ * @tc.type: FUNC
+ * @tc.level: Level1
+ * @tc.require:
+ */
+HWTEST_F(TransOpenTraceTest, TransOpenTraceNoInitTest001, TestSize.Level1)
+{
+    TransOpenTraceDeinit();
+    EXPECT_EQ(TransOpenTraceBegin(), TRANS_OPEN_TRACE_INVALID_ID);
+    TransOpenTraceBind(1, TRANS_OPEN_TRACE_KEY_CHANNEL_ID, TEST_CHANNEL_ID);
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID, TEST_CHANNEL_ID),
+        TRANS_OPEN_TRACE_INVALID_ID);
+    TransOpenTraceRecord(1, TRANS_OPEN_PHASE_START);
+    ASSERT_EQ(TransOpenTraceInit(), SOFTBUS_OK);
+    TransOpenSpan span;
+    EXPECT_EQ(TransOpenTraceGetSpan(1, &span), SOFTBUS_NOT_FIND);
+}
+} // namespace OHOS
@@ -369,6 +369,106 @@ HWTEST_F(TransChannelManagerTest, TransOpenChannel006, TestSize.Level1)
     SoftBusFree(transInfo);
 }
 
+/* a sync open whose lane is a wlan link and whose channel open returns openRet, traceId is the open's trace */
+static int32_t TestTracedSyncOpen(TransManagerInterfaceMock &mock, int32_t openRet, TransInfo *transInfo,
+    uint32_t *traceId)
+{
+    SessionParam param;
+    (void)memset_s(&param, sizeof(SessionParam), 0, sizeof(SessionParam));
+    param.sessionName = TEST_SESSION_NAME;
+    param.sessionId = 1;
+    param.attr = &g_sessionAttr[0];
+    EXPECT_CALL(mock, TransCommonGetAppInfo).WillOnce(Return(SOFTBUS_OK));
+    EXPECT_CALL(mock, TransGetLaneInfo).WillOnce(
+        [](const SessionParam *param, LaneConnInfo *connInfo, uint32_t *laneHandle) {
+            (void)param;
+            (void)memset_s(connInfo, sizeof(LaneConnInfo), 0, sizeof(LaneConnInfo));
+            connInfo->type = LANE_WLAN_5G;
+            *laneHandle = TEST_LANE_ID;
+            return SOFTBUS_OK;
+        });
+    EXPECT_CALL(mock, TransGetConnectOptByConnInfo).WillOnce(Return(SOFTBUS_OK));
+    EXPECT_CALL(mock, TransOpenChannelProc).WillOnce(
+        [openRet, traceId](ChannelType type, AppInfo *appInfo, const ConnectOption *connOpt, int32_t *channelId) {
+            (void)type;
+            (void)appInfo;
+            (void)connOpt;
+            *traceId = TransOpenTraceGetCurrent();
+            *channelId = TEST_TDC_CHANNEL_ID;
+            return openRet;
+        });
+    return TransOpenChannel(&param, transInfo);
+}
+
+/*
+ * @tc.name: TransOpenChannelTrace001
+ * @tc.desc: test TransOpenChannel records every sync open phase on its trace and binds the channel by type
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransChannelManagerTest, TransOpenChannelTrace001, TestSize.Level1)
+{
+    TransOpenTraceClear();
+    g_socketChannelList = CreateSoftBusList();
+    TransManagerInterfaceMock mock;
+    TransInfo transInfo;
+    (void)memset_s(&transInfo, sizeof(TransInfo), 0, sizeof(TransInfo));
+    uint32_t traceId = TRANS_OPEN_TRACE_INVALID_ID;
+    int32_t ret = TestTracedSyncOpen(mock, SOFTBUS_OK, &transInfo, &traceId);
+    EXPECT_EQ(SOFTBUS_OK, ret);
+    EXPECT_EQ(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_INVALID_ID);
+    ASSERT_NE(traceId, TRANS_OPEN_TRACE_INVALID_ID);
+
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(transInfo.channelType, TEST_TDC_CHANNEL_ID)), traceId);
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_LANE_HANDLE, TEST_LANE_ID), traceId);
+    TransOpenSpan span;
+    ASSERT_EQ(TransOpenTraceGetSpan(traceId, &span), SOFTBUS_OK);
+    for (uint32_t i = TRANS_OPEN_PHASE_START; i <= TRANS_OPEN_PHASE_CHANNEL_CONNECT; i++) {
+        EXPECT_NE(span.phaseMask & (1U << i), 0U) << "phase " << i;
+    }
+    EXPECT_EQ(span.phaseMask & (1U << TRANS_OPEN_PHASE_FAILED), 0U);
+
+    // a failure reported for another channel type with the same channelId leaves this open running
+    int32_t otherType = (transInfo.channelType == CHANNEL_TYPE_PROXY) ? CHANNEL_TYPE_UDP : CHANNEL_TYPE_PROXY;
+    TransOpenTraceRecordByKey(TRANS_OPEN_TRACE_KEY_CHANNEL_ID,
+        TransOpenTraceChannelKey(otherType, TEST_TDC_CHANNEL_ID), TRANS_OPEN_PHASE_FAILED);
+    ASSERT_EQ(TransOpenTraceGetSpan(traceId, &span), SOFTBUS_OK);
+    EXPECT_EQ(span.phaseMask & (1U << TRANS_OPEN_PHASE_FAILED), 0U);
+
+    (void)TransLaneMgrDelLane(transInfo.channelId, transInfo.channelType, true);
+    DestroySoftBusList(g_socketChannelList);
+    g_socketChannelList = nullptr;
+}
+
+/*
+ * @tc.name: TransOpenChannelTrace002
+ * @tc.desc: test TransOpenChannel ends its trace as failed and drops its bindings when the channel open fails
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransChannelManagerTest, TransOpenChannelTrace002, TestSize.Level1)
+{
+    TransOpenTraceClear();
+    g_socketChannelList = CreateSoftBusList();
+    TransManagerInterfaceMock mock;
+    TransInfo transInfo;
+    (void)memset_s(&transInfo, sizeof(TransInfo), 0, sizeof(TransInfo));
+    uint32_t traceId = TRANS_OPEN_TRACE_INVALID_ID;
+    int32_t ret = TestTracedSyncOpen(mock, SOFTBUS_TRANS_CREATE_CHANNEL_ERR, &transInfo, &traceId);
+    EXPECT_EQ(SOFTBUS_TRANS_CREATE_CHANNEL_ERR, ret);
+    EXPECT_EQ(TransOpenTraceGetCurrent(), TRANS_OPEN_TRACE_INVALID_ID);
+    EXPECT_EQ(TransOpenTraceGetIdByKey(TRANS_OPEN_TRACE_KEY_LANE_HANDLE, TEST_LANE_ID), TRANS_OPEN_TRACE_INVALID_ID);
+    ASSERT_NE(traceId, TRANS_OPEN_TRACE_INVALID_ID);
+
+    TransOpenSpan span;
+    ASSERT_EQ(TransOpenTraceGetSpan(traceId, &span), SOFTBUS_OK);
+    EXPECT_NE(span.phaseMask & (1U << TRANS_OPEN_PHASE_CHANNEL_CONNECT), 0U);
+    EXPECT_NE(span.phaseMask & (1U << TRANS_OPEN_PHASE_FAILED), 0U);
+    DestroySoftBusList(g_socketChannelList);
+    g_socketChannelList = nullptr;
+}
+
 /*
  * @tc.name: TransOpenChannelSecond001
  * @tc.desc: test TransOpenChannelSecond with invalid channel id
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <securec.h>
+
+#include "softbus_adapter_mem.h"
+#include "softbus_error_code.h"
+#include "softbus_proxychannel_manager.h"
+#include "softbus_proxychannel_manager.c"
+
+namespace OHOS {
+// 500 open proxy channels, the peer channel id of each is its own id plus PEER_ID_OFFSET
+static constexpr int32_t CHANNEL_NUM = 500;
+static constexpr int32_t CHANNEL_ID_BASE = 1;
+static constexpr int16_t PEER_ID_OFFSET = 1000;
+
+static bool OpenBenchChannels(benchmark::State &state)
+{
+    g_proxyChannelList = CreateSoftBusList();
+    if (g_proxyChannelList == nullptr) {
+        state.SkipWithError("create proxy channel list failed.");
+        return false;
+    }
+    InitProxyChannelBucket();
+    for (int32_t i = 0; i < CHANNEL_NUM; i++) {
+        ProxyChannelInfo *chan = reinterpret_cast<ProxyChannelInfo *>(SoftBusCalloc(sizeof(ProxyChannelInfo)));
+        if (chan == nullptr) {
+            state.SkipWithError("calloc proxy channel failed.");
+            return false;
+        }
+        chan->channelId = CHANNEL_ID_BASE + i;
+        chan->myId = (int16_t)chan->channelId;
+        chan->peerId = (int16_t)(chan->myId + PEER_ID_OFFSET);
+        chan->connId = (uint32_t)i;
+        chan->status = PROXY_CHANNEL_STATUS_COMPLETED;
+        chan->appInfo.appType = APP_TYPE_NORMAL;
+        (void)strcpy_s(chan->appInfo.myData.pkgName, sizeof(chan->appInfo.myData.pkgName), "ohos.dsoftbus.bench");
+        if (TransProxyAddChanItem(chan) != SOFTBUS_OK) {
+            SoftBusFree(chan);
+            state.SkipWithError("add proxy channel failed.");
+            return false;
+        }
+    }
+    return true;
+}
+
+static void CloseBenchChannels(void)
+{
+    TransProxyManagerDeinitInner();
+}
+
+/* the lookup every data message did before the channel table was indexed */
+static int32_t ScanSendMsgChanInfo(int32_t channelId, ProxyChannelInfo *chanInfo)
+{
+    ProxyChannelInfo *item = nullptr;
+    (void)SoftBusMutexLock(&g_proxyChannelList->lock);
+    LIST_FOR_EACH_ENTRY(item, &g_proxyChannelList->list, ProxyChannelInfo, node) {
+        if (item->channelId == channelId) {
+            (void)memcpy_s(chanInfo, sizeof(ProxyChannelInfo), item, sizeof(ProxyChannelInfo));
+            (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+            return SOFTBUS_OK;
+        }
+    }
+    (void)SoftBusMutexUnlock(&g_proxyChannelList->lock);
+    return SOFTBUS_TRANS_NODE_NOT_FOUND;
+}
+
+/**
+ * @tc.name: ScanSendMsgChanInfoTestCase
+ * @tc.desc: Look up and copy the whole channel of every one of 500 proxy channels by a list scan
+ *           Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: previous TransProxyGetSendMsgChanInfo lookup
+ */
+static void ScanSendMsgChanInfoTestCase(benchmark::State &state)
+{
+    if (!OpenBenchChannels(state)) {
+        CloseBenchChannels();
+        return;
+    }
+    ProxyChannelInfo *chanInfo = reinterpret_cast<ProxyChannelInfo *>(SoftBusCalloc(sizeof(ProxyChannelInfo)));
+    if (chanInfo == nullptr) {
+        state.SkipWithError("calloc proxy channel failed.");
+        CloseBenchChannels();
+        return;
+    }
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < CHANNEL_NUM; i++) {
+            if (ScanSendMsgChanInfo(CHANNEL_ID_BASE + i, chanInfo) != SOFTBUS_OK) {
+                state.SkipWithError("ScanSendMsgChanInfoTestCase lookup failed.");
+                break;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(chanInfo->connId);
+    SoftBusFree(chanInfo);
+    CloseBenchChannels();
+}
+BENCHMARK(ScanSendMsgChanInfoTestCase);
+
+/**
+ * @tc.name: GetSendMsgChanInfoTestCase
+ * @tc.desc: Look up and copy the whole channel of every one of 500 proxy channels by the channelId index
+ *           Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: TransProxyGetSendMsgChanInfo normal operation
+ */
+static void GetSendMsgChanInfoTestCase(benchmark::State &state)
+{
+    if (!OpenBenchChannels(state)) {
+        CloseBenchChannels();
+        return;
+    }
+    ProxyChannelInfo *chanInfo = reinterpret_cast<ProxyChannelInfo *>(SoftBusCalloc(sizeof(ProxyChannelInfo)));
+    if (chanInfo == nullptr) {
+        state.SkipWithError("calloc proxy channel failed.");
+        CloseBenchChannels();
+        return;
+    }
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < CHANNEL_NUM; i++) {
+            if (TransProxyGetSendMsgChanInfo(CHANNEL_ID_BASE + i, chanInfo) != SOFTBUS_OK) {
+                state.SkipWithError("GetSendMsgChanInfoTestCase lookup failed.");
+                break;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(chanInfo->connId);
+    SoftBusFree(chanInfo);
+    CloseBenchChannels();
+}
+BENCHMARK(GetSendMsgChanInfoTestCase);
+
+/**
+ * @tc.name: GetSendMsgInfoTestCase
+ * @tc.desc: Look up the send fields of every one of 500 proxy channels Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: TransProxyGetSendMsgInfo normal operation
+ */
+static void GetSendMsgInfoTestCase(benchmark::State &state)
+{
+    if (!OpenBenchChannels(state)) {
+        CloseBenchChannels();
+        return;
+    }
+    ProxyChannelSendInfo sendInfo;
+    (void)memset_s(&sendInfo, sizeof(ProxyChannelSendInfo), 0, sizeof(ProxyChannelSendInfo));
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < CHANNEL_NUM; i++) {
+            if (TransProxyGetSendMsgInfo(CHANNEL_ID_BASE + i, &sendInfo) != SOFTBUS_OK) {
+                state.SkipWithError("GetSendMsgInfoTestCase lookup failed.");
+                break;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(sendInfo.connId);
+    CloseBenchChannels();
+}
+BENCHMARK(GetSendMsgInfoTestCase);
+
+/**
+ * @tc.name: GetRecvMsgInfoTestCase
+ * @tc.desc: Look up the receive fields of every one of 500 proxy channels by (myId, peerId)
+ *           Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: TransProxyGetRecvMsgInfo normal operation
+ */
+static void GetRecvMsgInfoTestCase(benchmark::State &state)
+{
+    if (!OpenBenchChannels(state)) {
+        CloseBenchChannels();
+        return;
+    }
+    ProxyChannelRecvInfo recvInfo;
+    (void)memset_s(&recvInfo, sizeof(ProxyChannelRecvInfo), 0, sizeof(ProxyChannelRecvInfo));
+    while (state.KeepRunning()) {
+        for (int32_t i = 0; i < CHANNEL_NUM; i++) {
+            int16_t myId = (int16_t)(CHANNEL_ID_BASE + i);
+            if (TransProxyGetRecvMsgInfo(myId, (int16_t)(myId + PEER_ID_OFFSET), &recvInfo) != SOFTBUS_OK) {
+                state.SkipWithError("GetRecvMsgInfoTestCase lookup failed.");
+                break;
+            }
+        }
+    }
+    benchmark::DoNotOptimize(recvInfo.channelId);
+    CloseBenchChannels();
+}
+BENCHMARK(GetRecvMsgInfoTestCase);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
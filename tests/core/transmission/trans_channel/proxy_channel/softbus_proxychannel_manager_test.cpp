@@ -1752,12 +1752,12 @@ HWTEST_F(SoftbusProxyChannelManagerTest, TransProxyResetChanTest001, TestSize.Le
 }
 
 /*@
- * @tc.name: TransProxyGetRecvMsgChanInfoTest001
- * @tc.desc: test proxy get recv msg chanInfo
+ * @tc.name: TransProxyGetRecvMsgInfoTest001
+ * @tc.desc: test proxy get recv msg info
  * @tc.type: FUNC
  * @tc.require:
  */
-HWTEST_F(SoftbusProxyChannelManagerTest, TransProxyGetRecvMsgChanInfoTest001, TestSize.Level1)
+HWTEST_F(SoftbusProxyChannelManagerTest, TransProxyGetRecvMsgInfoTest001, TestSize.Level1)
 {
     ProxyChannelInfo *chan = reinterpret_cast<ProxyChannelInfo *>(SoftBusCalloc(sizeof(ProxyChannelInfo)));
     ASSERT_TRUE(nullptr != chan);
@@ -1771,14 +1771,15 @@ HWTEST_F(SoftbusProxyChannelManagerTest, TransProxyGetRecvMsgChanInfoTest001, Te
     int32_t ret = TransProxyAddChanItem(chan);
     EXPECT_EQ(SOFTBUS_OK, ret);
 
-    ProxyChannelInfo *chanRes = reinterpret_cast<ProxyChannelInfo *>(SoftBusCalloc(sizeof(ProxyChannelInfo)));
-    ASSERT_TRUE(nullptr != chanRes);
-    chanRes->status = PROXY_CHANNEL_STATUS_HANDSHAKEING;
-    ret = TransProxyGetRecvMsgChanInfo(TEST_NUMBER_ZERO, TEST_NUMBER_ONE, chanRes);
+    ProxyChannelRecvInfo recvInfo;
+    (void)memset_s(&recvInfo, sizeof(ProxyChannelRecvInfo), 0, sizeof(ProxyChannelRecvInfo));
+    ret = TransProxyGetRecvMsgInfo(TEST_NUMBER_ZERO, TEST_NUMBER_ONE, &recvInfo);
     EXPECT_EQ(SOFTBUS_OK, ret);
-    EXPECT_EQ(PROXY_CHANNEL_STATUS_COMPLETED, chanRes->status);
+    EXPECT_EQ(TEST_PARSE_MESSAGE_CHANNEL, recvInfo.channelId);
+    EXPECT_EQ(0, chan->timeout);
+    ret = TransProxyGetRecvMsgInfo(TEST_NUMBER_ONE, TEST_NUMBER_ZERO, &recvInfo);
+    EXPECT_EQ(SOFTBUS_TRANS_NODE_NOT_FOUND, ret);
     TransProxyDelChanByChanId(TEST_PARSE_MESSAGE_CHANNEL);
-    SoftBusFree(chanRes);
 }
 
 /*@
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021-2023 Huawei Device Co., Ltd.
+ * Copyright (c) 2021-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -84,6 +84,7 @@ namespace OHOS {
 
 #define TEST_CHANNEL_ID 1124
 #define SLEEP_TIME 5
+#define TEST_CANCEL_REQUEST_ID 3099
 
 class SoftbusProxyChannelPipelineTest : public testing::Test {
 public:
@@ -481,4 +482,30 @@ HWTEST_F(SoftbusProxyChannelPipelineTest, TransProxyPackHandshakeMsgTest001, Tes
     char *ret = TransProxyPackHandshakeErrMsg(SOFTBUS_OK);
     EXPECT_EQ(ret, nullptr);
 }
+/**
+  * @tc.name: TransProxyPipelineCancelChannelTest001
+  * @tc.desc: a channel still opening is dropped by its request id and no longer reported
+  * @tc.type: FUNC
+  * @tc.require:
+  */
+HWTEST_F(SoftbusProxyChannelPipelineTest, TransProxyPipelineCancelChannelTest001, TestSize.Level1)
+{
+    int32_t requestId = TEST_CANCEL_REQUEST_ID;
+    struct PipelineChannelItem *item =
+        static_cast<struct PipelineChannelItem *>(SoftBusCalloc(sizeof(struct PipelineChannelItem)));
+    ASSERT_NE(item, nullptr);
+    item->requestId = requestId;
+    item->channelId = INVALID_CHANNEL_ID;
+    ASSERT_EQ(SoftBusMutexLock(&g_manager.channels->lock), SOFTBUS_OK);
+    ListInit(&item->node);
+    ListAdd(&g_manager.channels->list, &item->node);
+    g_manager.channels->cnt++;
+    (void)SoftBusMutexUnlock(&g_manager.channels->lock);
+
+    EXPECT_EQ(TransProxyPipelineCancelChannel(requestId), SOFTBUS_OK);
+    ASSERT_EQ(SoftBusMutexLock(&g_manager.channels->lock), SOFTBUS_OK);
+    EXPECT_EQ(SearchChannelItemUnsafe(&requestId, CompareByRequestId), nullptr);
+    (void)SoftBusMutexUnlock(&g_manager.channels->lock);
+    EXPECT_EQ(TransProxyPipelineCancelChannel(requestId), SOFTBUS_OK);
+}
 } // namespace OHOS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -80,5 +80,15 @@ int32_t LnnGetLocalStrInfoByIfnameIdx(InfoKey key, char *info, uint32_t len, int
 {
     return GetTransTcpDirectWifiInterface()->LnnGetLocalStrInfoByIfnameIdx(key, info, len, ifIdx);
 }
+
+uint32_t TransOpenTraceGetCurrent(void)
+{
+    return GetTransTcpDirectWifiInterface()->TransOpenTraceGetCurrent();
+}
+
+void TransOpenTraceBind(uint32_t traceId, TransOpenTraceKeyType keyType, int64_t key)
+{
+    return GetTransTcpDirectWifiInterface()->TransOpenTraceBind(traceId, keyType, key);
+}
 }
 }
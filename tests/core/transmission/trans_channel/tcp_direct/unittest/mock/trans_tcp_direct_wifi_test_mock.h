@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2024-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -21,6 +21,7 @@
 #include "auth_interface.h"
 #include "lnn_network_manager.h"
 #include "softbus_conn_interface.h"
+#include "trans_open_trace.h"
 #include "trans_tcp_direct_sessionconn.h"
 
 namespace OHOS {
@@ -37,6 +38,8 @@ public:
     virtual int32_t ConnOpenClientSocket(const ConnectOption *option, const char *bindAddr, bool isNonBlock) = 0;
     virtual int32_t AddTrigger(ListenerModule module, int32_t fd, TriggerType trigger) = 0;
     virtual int32_t LnnGetLocalStrInfoByIfnameIdx(InfoKey key, char *info, uint32_t len, int32_t ifIdx) = 0;
+    virtual uint32_t TransOpenTraceGetCurrent(void) = 0;
+    virtual void TransOpenTraceBind(uint32_t traceId, TransOpenTraceKeyType keyType, int64_t key) = 0;
 };
 
 class TransTcpDirectWifiInterfaceMock : public TransTcpDirectWifiInterface {
@@ -53,6 +56,8 @@ public:
     MOCK_METHOD3(ConnOpenClientSocket, int32_t (const ConnectOption *option, const char *bindAddr, bool isNonBlock));
     MOCK_METHOD3(AddTrigger, int32_t (ListenerModule module, int32_t fd, TriggerType trigger));
     MOCK_METHOD4(LnnGetLocalStrInfoByIfnameIdx, int32_t(InfoKey, char *, uint32_t, int32_t));
+    MOCK_METHOD0(TransOpenTraceGetCurrent, uint32_t (void));
+    MOCK_METHOD3(TransOpenTraceBind, void (uint32_t traceId, TransOpenTraceKeyType keyType, int64_t key));
 };
 } // namespace OHOS
 #endif // TRANS_TCP_DIRECT_WIFI_TEST_MOCK_H
@@ -0,0 +1,81 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+
+#include "anonymizer.h"
+#include "comm_log.h"
+
+namespace OHOS {
+static const char *TEST_PLAIN_UDID = "a8ynvpdaihw1f6nknjd2hkfhxljxypkr6kvjsbhnhpp16974uo4fvsrpfa6t50fm";
+static const char *TEST_PLAIN_NETWORK_ID = "2F1E0D9C8B7A69584736251403F2E1D0C9B8A79685746352413F2E1D0C9B8A79";
+static const char *TEST_PLAIN_DEVICE_NAME = "张三的MatePad Pro";
+
+/**
+ * @tc.name: AnonymizeHeapTestCase
+ * @tc.desc: anonymize into heap memory Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: Anonymize normal operation
+ */
+static void AnonymizeHeapTestCase(benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        char *anonyUdid = nullptr;
+        char *anonyDeviceName = nullptr;
+        Anonymize(TEST_PLAIN_UDID, &anonyUdid);
+        AnonymizeDeviceName(TEST_PLAIN_DEVICE_NAME, &anonyDeviceName);
+        benchmark::DoNotOptimize(anonyUdid);
+        benchmark::DoNotOptimize(anonyDeviceName);
+        AnonymizeFree(anonyUdid);
+        AnonymizeFree(anonyDeviceName);
+    }
+}
+BENCHMARK(AnonymizeHeapTestCase)->Threads(1)->Threads(4);
+
+/**
+ * @tc.name: AnonymizeToBufTestCase
+ * @tc.desc: anonymize into stack buffer Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: AnonymizeToBuf normal operation
+ */
+static void AnonymizeToBufTestCase(benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        ANONYMIZE_BUF(anonyUdid);
+        ANONYMIZE_BUF(anonyDeviceName);
+        benchmark::DoNotOptimize(ANONYMIZE(anonyUdid, TEST_PLAIN_UDID));
+        benchmark::DoNotOptimize(ANONYMIZE_DEVICE_NAME(anonyDeviceName, TEST_PLAIN_DEVICE_NAME));
+    }
+}
+BENCHMARK(AnonymizeToBufTestCase)->Threads(1)->Threads(4);
+
+/**
+ * @tc.name: AnonymizeDebugLogTestCase
+ * @tc.desc: debug log with anonymized argument Performance Testing, nothing is anonymized when debug is disabled
+ * @tc.type: FUNC
+ * @tc.require: COMM_LOGD normal operation
+ */
+static void AnonymizeDebugLogTestCase(benchmark::State &state)
+{
+    while (state.KeepRunning()) {
+        ANONYMIZE_BUF(anonyNetworkId);
+        COMM_LOGD(COMM_TEST, "networkId=%{public}s", ANONYMIZE(anonyNetworkId, TEST_PLAIN_NETWORK_ID));
+    }
+}
+BENCHMARK(AnonymizeDebugLogTestCase);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2023-2024 Huawei Device Co., Ltd.
+ * Copyright (c) 2023-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -13,8 +13,11 @@
  * limitations under the License.
  */
 
+#include <cstring>
 #include <gtest/gtest.h>
 #include <string>
+#include <thread>
+#include <vector>
 
 #include "anonymizer.h"
 
@@ -43,6 +46,11 @@ const char *TEST_ANONYMIZED_IP_THREE = "10.11.12.***";
 const char *TEST_PLAIN_IP_CIDR = "10.0.0.0/32";
 const char *TEST_ANONYMIZED_IP_CIDR = "10.0.0.****";
 const uint32_t DEVICE_NAME_MAX_LEN = 128;
+const uint32_t TEST_SHORT_BUF_LEN = 5;
+const uint32_t TEST_CHAR_BOUNDARY_BUF_LEN = 8;
+const uint32_t TEST_MAC_TRUNCATED_BUF_LEN = 14;
+const uint32_t TEST_THREAD_NUM = 8;
+const uint32_t TEST_LOOP_NUM = 10000;
 } // namespace
 
 namespace OHOS {
@@ -543,4 +551,100 @@ HWTEST_F(AnonymizerTest, AnonymizeDeviceNameTest003, TestSize.Level0)
     EXPECT_STREQ("一******************************二三1", anonymizedStr);
     AnonymizeFree(anonymizedStr);
 }
+
+/*
+ * @tc.name: AnonymizeToBufTest001
+ * @tc.desc: Test anonymize into stack buffer, the result is the same as Anonymize
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AnonymizerTest, AnonymizeToBufTest001, TestSize.Level0)
+{
+    ANONYMIZE_BUF(anonymized);
+    EXPECT_STREQ("NULL", ANONYMIZE(anonymized, nullptr));
+    EXPECT_STREQ("EMPTY", ANONYMIZE(anonymized, ""));
+    EXPECT_STREQ(TEST_ANONYMIZED_UDID, ANONYMIZE(anonymized, TEST_PLAIN_UDID));
+    EXPECT_STREQ(TEST_ANONYMIZED_MAC_COLON, ANONYMIZE(anonymized, TEST_PLAIN_MAC_COLON));
+    EXPECT_STREQ(TEST_ANONYMIZED_IP_THREE, ANONYMIZE(anonymized, TEST_PLAIN_IP_THREE));
+    EXPECT_STREQ("张**四", ANONYMIZE(anonymized, "张三李四"));
+    EXPECT_STREQ("张**四", ANONYMIZE_DEVICE_NAME(anonymized, "张三李四"));
+    EXPECT_STREQ("z*******李si", ANONYMIZE_DEVICE_NAME(anonymized, "zhagnsan李si"));
+
+    const char *plainStr = "abcdefghijklmn";
+    char *anonymizedStr = nullptr;
+    Anonymize(plainStr, &anonymizedStr);
+    EXPECT_STREQ(anonymizedStr, ANONYMIZE(anonymized, plainStr));
+    AnonymizeFree(anonymizedStr);
+}
+
+/*
+ * @tc.name: AnonymizeToBufTest002
+ * @tc.desc: Test short buffer truncates at char boundary and invalid buffer
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AnonymizerTest, AnonymizeToBufTest002, TestSize.Level0)
+{
+    char shortBuf[TEST_SHORT_BUF_LEN] = { 0 };
+    EXPECT_STREQ("a8yn", AnonymizeToBuf(TEST_PLAIN_UDID, shortBuf, sizeof(shortBuf)));
+    EXPECT_STREQ("10.1", AnonymizeToBuf(TEST_PLAIN_IP_THREE, shortBuf, sizeof(shortBuf)));
+    EXPECT_STREQ("张*", AnonymizeToBuf("张三李四", shortBuf, sizeof(shortBuf)));
+    char charBoundaryBuf[TEST_CHAR_BOUNDARY_BUF_LEN] = { 0 };
+    EXPECT_STREQ("李**", AnonymizeToBuf("李四张三", charBoundaryBuf, sizeof(charBoundaryBuf)));
+    char macBuf[TEST_MAC_TRUNCATED_BUF_LEN] = { 0 };
+    EXPECT_STREQ("dd:15:bc:**:*", AnonymizeToBuf(TEST_PLAIN_MAC_COLON, macBuf, sizeof(macBuf)));
+    EXPECT_STREQ("NUL", AnonymizeToBuf(nullptr, shortBuf, TEST_SHORT_BUF_LEN - 1));
+    EXPECT_STREQ("", AnonymizeToBuf(TEST_PLAIN_UDID, shortBuf, 1));
+    EXPECT_STREQ("NULL", AnonymizeToBuf(TEST_PLAIN_UDID, nullptr, sizeof(shortBuf)));
+    EXPECT_STREQ("NULL", AnonymizeToBuf(TEST_PLAIN_UDID, shortBuf, 0));
+    EXPECT_STREQ("NULL", AnonymizeDeviceNameToBuf(TEST_PLAIN_UDID, nullptr, 0));
+}
+
+/*
+ * @tc.name: AnonymizeToBufTest003
+ * @tc.desc: Test invalid utf-8 str is copied as it is, overlong and surrogate are rejected
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AnonymizerTest, AnonymizeToBufTest003, TestSize.Level0)
+{
+    ANONYMIZE_BUF(anonymized);
+    EXPECT_STREQ("ab\xff" "cd", ANONYMIZE(anonymized, "ab\xff" "cd"));
+    EXPECT_STREQ("ab\xc0\xaf" "cd", ANONYMIZE(anonymized, "ab\xc0\xaf" "cd"));
+    EXPECT_STREQ("ab\xed\xa0\x80" "cd", ANONYMIZE(anonymized, "ab\xed\xa0\x80" "cd"));
+    EXPECT_STREQ("ab\xe4\xb8" "cd", ANONYMIZE_DEVICE_NAME(anonymized, "ab\xe4\xb8" "cd"));
+    EXPECT_STREQ("a***\xf0\x9f\x98\x80", ANONYMIZE(anonymized, "ab\xf0\x9f\x98\x80" "c\xf0\x9f\x98\x80"));
+}
+
+/*
+ * @tc.name: AnonymizeToBufTest004
+ * @tc.desc: Test anonymize concurrently, each thread gets a stable result
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(AnonymizerTest, AnonymizeToBufTest004, TestSize.Level1)
+{
+    std::vector<std::thread> threads;
+    std::vector<uint32_t> failCnt(TEST_THREAD_NUM, 0);
+    for (uint32_t i = 0; i < TEST_THREAD_NUM; ++i) {
+        threads.emplace_back([i, &failCnt]() {
+            for (uint32_t loop = 0; loop < TEST_LOOP_NUM; ++loop) {
+                ANONYMIZE_BUF(anonymized);
+                char *anonymizedStr = nullptr;
+                bool isSame = strcmp(TEST_ANONYMIZED_UDID, ANONYMIZE(anonymized, TEST_PLAIN_UDID)) == 0 &&
+                    strcmp("张**四", ANONYMIZE_DEVICE_NAME(anonymized, "张三李四")) == 0;
+                AnonymizeDeviceName("一二三四五六七八九十", &anonymizedStr);
+                isSame = isSame && anonymizedStr != nullptr && strcmp("一******八九十", anonymizedStr) == 0;
+                AnonymizeFree(anonymizedStr);
+                failCnt[i] += isSame ? 0 : 1;
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (uint32_t i = 0; i < TEST_THREAD_NUM; ++i) {
+        EXPECT_EQ(0, failCnt[i]);
+    }
+}
 } // namespace OHOS
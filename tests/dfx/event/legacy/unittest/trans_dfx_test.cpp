@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2022 Huawei Device Co., Ltd.
+ * Copyright (c) 2022-2026 Huawei Device Co., Ltd.
  * Licensed under the Apache License, Version 2.0 (the "License");
  * you may not use this file except in compliance with the License.
  * You may obtain a copy of the License at
@@ -14,11 +14,14 @@
  */
 
 #include <string>
+#include <thread>
+#include <vector>
 #include <gtest/gtest.h>
 
 #include "softbus_error_code.h"
-#include "legacy/softbus_hisysevt_transreporter.h"
+#include "legacy/softbus_hisysevt_transreporter.c"
 #include "softbus_hidumper_trans.c"
+#include "softbus_server_ipc_interface_code.h"
 
 using namespace std;
 using namespace testing::ext;
@@ -38,6 +41,10 @@ static const int32_t TEST_ARGC_TWO = 2;
 static const char *g_testSessionName = "testSessionName";
 static const char *g_testPkgName = "testPkg";
 static const char *g_testMsg = "test";
+static const uint32_t TEST_RECORD_THREAD_NUM = 4;
+static const uint32_t TEST_RECORD_LOOP_NUM = 10000;
+static const uint32_t TEST_CALLER_NUM = 300;
+static const uint32_t TEST_CALLER_OVER_LIMIT = TEST_CALLER_NUM - 1;
 
 namespace OHOS {
 class TransDfxTest : public testing::Test {
@@ -56,6 +63,21 @@ void TransDfxTest::SetUp(void) {}
 
 void TransDfxTest::TearDown(void) {}
 
+static uint32_t GetCallerCalledCnt(const char *appName, uint32_t code)
+{
+    uint32_t emptySlot = CALLER_SLOT_NUM;
+    CalledApiCallerInfo *caller = FindCaller(appName, GetAppNameHash(appName), &emptySlot);
+    if (caller == nullptr) {
+        return 0;
+    }
+    return atomic_load(&caller->calledCnt[GetApiIndexByCode(code)]);
+}
+
+static uint32_t GetCalledCnt(uint32_t code)
+{
+    return atomic_load(&g_calledApiCnt[GetApiIndexByCode(code)]);
+}
+
 typedef struct {
     int32_t fd;
     int32_t argc;
@@ -279,4 +301,109 @@ HWTEST_F(TransDfxTest, SoftBusTransDumpRegisterSession001, TestSize.Level0)
     ret = SoftBusTransDumpHandler(TEST_FD, TEST_ARGC_ONE, &tmpArgv);
     EXPECT_EQ(SOFTBUS_OK, ret);
 }
+
+/*
+ * @tc.name: SoftbusRecordCalledApiTest001
+ * @tc.desc: Verify called api recording tolerates invalid param, unknown code and callers beyond the limit,
+ *           and that a report releases the callers so later callers are counted again
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransDfxTest, SoftbusRecordCalledApiTest001, TestSize.Level0)
+{
+    SoftbusRecordCalledApiCnt(SERVER_OPEN_SESSION);
+    SoftbusRecordCalledApiInfo(g_testPkgName, SERVER_OPEN_SESSION);
+    EXPECT_EQ(SOFTBUS_OK, InitTransStatisticSysEvt());
+    EXPECT_EQ(SOFTBUS_OK, InitTransStatisticSysEvt());
+    EXPECT_EQ(0U, GetCalledCnt(SERVER_OPEN_SESSION));
+    EXPECT_EQ(0U, GetCallerCalledCnt(g_testPkgName, SERVER_OPEN_SESSION));
+    SoftbusRecordCalledApiInfo(nullptr, SERVER_OPEN_SESSION);
+    SoftbusRecordCalledApiInfo(g_testPkgName, SOFTBUS_FUNC_ID_BUIT);
+    SoftbusRecordCalledApiInfo(g_testPkgName, UINT32_MAX);
+    SoftbusRecordCalledApiCnt(SOFTBUS_FUNC_ID_BUIT);
+    SoftbusRecordCalledApiCnt(UINT32_MAX);
+    EXPECT_EQ(0U, g_callerNum);
+    SoftbusRecordCalledApiCnt(SERVER_OPEN_SESSION);
+    SoftbusRecordCalledApiInfo(g_testPkgName, SERVER_OPEN_SESSION);
+    EXPECT_EQ(1U, GetCalledCnt(SERVER_OPEN_SESSION));
+    EXPECT_EQ(1U, GetCallerCalledCnt(g_testPkgName, SERVER_OPEN_SESSION));
+    EXPECT_EQ(0U, GetCallerCalledCnt(g_testPkgName, SERVER_JOIN_LNN));
+    for (uint32_t i = 0; i < TEST_CALLER_NUM; i++) {
+        std::string appName = std::string(g_testPkgName) + std::to_string(i);
+        SoftbusRecordCalledApiInfo(appName.c_str(), SERVER_JOIN_LNN);
+    }
+    EXPECT_EQ(static_cast<uint32_t>(MAX_PKG_NAME_CNT), g_callerNum);
+    EXPECT_EQ(TEST_CALLER_NUM + 1 - MAX_PKG_NAME_CNT, atomic_load(&g_droppedCallerCnt));
+    std::string lastApp = std::string(g_testPkgName) + std::to_string(TEST_CALLER_OVER_LIMIT);
+    EXPECT_EQ(0U, GetCallerCalledCnt(lastApp.c_str(), SERVER_JOIN_LNN));
+
+    (void)SoftbusReportCalledAPIEvt();
+    EXPECT_EQ(0U, g_callerNum);
+    EXPECT_EQ(0U, GetCallerCalledCnt(g_testPkgName, SERVER_OPEN_SESSION));
+    SoftbusRecordCalledApiInfo(lastApp.c_str(), SERVER_JOIN_LNN);
+    EXPECT_EQ(1U, GetCallerCalledCnt(lastApp.c_str(), SERVER_JOIN_LNN));
+    (void)SoftbusReportCalledAPICntEvt();
+    EXPECT_EQ(0U, GetCalledCnt(SERVER_OPEN_SESSION));
+
+    DeinitTransStatisticSysEvt();
+    EXPECT_EQ(0U, g_callerNum);
+    DeinitTransStatisticSysEvt();
+    SoftbusRecordCalledApiInfo(g_testPkgName, SERVER_OPEN_SESSION);
+    EXPECT_EQ(0U, GetCallerCalledCnt(g_testPkgName, SERVER_OPEN_SESSION));
+}
+
+/*
+ * @tc.name: SoftbusRecordCalledApiTest002
+ * @tc.desc: Verify called api recording from concurrent ipc threads
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransDfxTest, SoftbusRecordCalledApiTest002, TestSize.Level1)
+{
+    EXPECT_EQ(SOFTBUS_OK, InitTransStatisticSysEvt());
+    std::vector<std::thread> threads;
+    for (uint32_t i = 0; i < TEST_RECORD_THREAD_NUM; i++) {
+        threads.emplace_back([i]() {
+            std::string appName = std::string(g_testPkgName) + std::to_string(i);
+            for (uint32_t loop = 0; loop < TEST_RECORD_LOOP_NUM; loop++) {
+                SoftbusRecordCalledApiCnt(SERVER_OPEN_SESSION);
+                SoftbusRecordCalledApiInfo(appName.c_str(), SERVER_OPEN_SESSION);
+                SoftbusRecordCalledApiInfo(g_testPkgName, SERVER_CLOSE_CHANNEL);
+            }
+        });
+    }
+    for (auto &thread : threads) {
+        thread.join();
+    }
+    for (uint32_t i = 0; i < TEST_RECORD_THREAD_NUM; i++) {
+        std::string appName = std::string(g_testPkgName) + std::to_string(i);
+        EXPECT_EQ(TEST_RECORD_LOOP_NUM, GetCallerCalledCnt(appName.c_str(), SERVER_OPEN_SESSION));
+    }
+    EXPECT_EQ(TEST_RECORD_THREAD_NUM * TEST_RECORD_LOOP_NUM, GetCallerCalledCnt(g_testPkgName, SERVER_CLOSE_CHANNEL));
+    EXPECT_EQ(TEST_RECORD_THREAD_NUM * TEST_RECORD_LOOP_NUM, GetCalledCnt(SERVER_OPEN_SESSION));
+    EXPECT_EQ(0U, GetCalledCnt(SERVER_CLOSE_CHANNEL));
+    DeinitTransStatisticSysEvt();
+}
+
+/*
+ * @tc.name: SoftbusRecordCalledApiTest003
+ * @tc.desc: Verify called api recording keeps interned callers valid across deinit and reinit
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransDfxTest, SoftbusRecordCalledApiTest003, TestSize.Level1)
+{
+    EXPECT_EQ(SOFTBUS_OK, InitTransStatisticSysEvt());
+    std::thread recorder([]() {
+        for (uint32_t loop = 0; loop < TEST_RECORD_LOOP_NUM; loop++) {
+            SoftbusRecordCalledApiInfo(g_testPkgName, SERVER_OPEN_SESSION);
+        }
+    });
+    for (uint32_t loop = 0; loop < TEST_RECORD_THREAD_NUM; loop++) {
+        DeinitTransStatisticSysEvt();
+        EXPECT_EQ(SOFTBUS_OK, InitTransStatisticSysEvt());
+    }
+    recorder.join();
+    DeinitTransStatisticSysEvt();
+}
 } // namespace OHOS
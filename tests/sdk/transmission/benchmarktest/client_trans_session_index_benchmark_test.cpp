@@ -0,0 +1,157 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <securec.h>
+
+#include "client_trans_session_manager.c"
+#include "client_trans_socket_manager.c"
+
+namespace OHOS {
+static constexpr int32_t SERVER_NUM = 50;
+static constexpr int32_t SOCKET_NUM = 1000;
+static constexpr int32_t CHANNEL_ID_BASE = 2000;
+static constexpr int64_t LOOKUP_NUM = 1000000;
+
+/* the public api caps servers and sessions, build the registry directly to reach the target scale */
+static bool BuildRegistry()
+{
+    if (g_clientSessionServerList == nullptr && TransClientInit() != SOFTBUS_OK) {
+        return false;
+    }
+    if (g_clientSessionServerList->cnt == SERVER_NUM) {
+        return true;
+    }
+    ClientSessionServer *servers[SERVER_NUM] = { nullptr };
+    for (int32_t i = 0; i < SERVER_NUM; i++) {
+        servers[i] = static_cast<ClientSessionServer *>(SoftBusCalloc(sizeof(ClientSessionServer)));
+        if (servers[i] == nullptr) {
+            return false;
+        }
+        (void)sprintf_s(servers[i]->sessionName, sizeof(servers[i]->sessionName), "ohos.benchmark.session%d", i);
+        ListInit(&servers[i]->node);
+        ListInit(&servers[i]->sessionList);
+        ListAdd(&g_clientSessionServerList->list, &servers[i]->node);
+        g_clientSessionServerList->cnt++;
+    }
+    for (int32_t i = 0; i < SOCKET_NUM; i++) {
+        SessionInfo *session = static_cast<SessionInfo *>(SoftBusCalloc(sizeof(SessionInfo)));
+        if (session == nullptr) {
+            return false;
+        }
+        session->sessionId = i + 1;
+        session->channelId = CHANNEL_ID_BASE + i;
+        session->channelType = (i % 2 == 0) ? CHANNEL_TYPE_UDP : CHANNEL_TYPE_TCP_DIRECT;
+        session->channelIdReserve = INVALID_CHANNEL_ID;
+        session->channelTypeReserve = CHANNEL_TYPE_BUTT;
+        ClientSessionServer *server = servers[i % SERVER_NUM];
+        ListAdd(&server->sessionList, &session->node);
+        ClientIndexSession(server, session);
+    }
+    return true;
+}
+
+/* the lookup before the index: walk every session of every server */
+static int32_t ScanSessionIdByChannelId(int32_t channelId, int32_t channelType)
+{
+    ClientSessionServer *serverNode = nullptr;
+    SessionInfo *sessionNode = nullptr;
+    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
+        LIST_FOR_EACH_ENTRY(sessionNode, &(serverNode->sessionList), SessionInfo, node) {
+            if (sessionNode->channelId == channelId && (int32_t)sessionNode->channelType == channelType) {
+                return sessionNode->sessionId;
+            }
+        }
+    }
+    return INVALID_SESSION_ID;
+}
+
+/**
+ * @tc.name: ScanByChannelTestCase
+ * @tc.desc: 1000 sockets in 50 session servers lookup by channel with a list walk Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: nested session list walk
+ */
+static void ScanByChannelTestCase(benchmark::State &state)
+{
+    if (!BuildRegistry()) {
+        state.SkipWithError("ScanByChannelTestCase build registry failed.");
+        return;
+    }
+    int32_t index = 0;
+    while (state.KeepRunning()) {
+        int32_t channelType = (index % 2 == 0) ? CHANNEL_TYPE_UDP : CHANNEL_TYPE_TCP_DIRECT;
+        if (ScanSessionIdByChannelId(CHANNEL_ID_BASE + index, channelType) != index + 1) {
+            state.SkipWithError("ScanByChannelTestCase failed.");
+            break;
+        }
+        index = (index + 1) % SOCKET_NUM;
+    }
+}
+BENCHMARK(ScanByChannelTestCase)->Iterations(LOOKUP_NUM);
+
+/**
+ * @tc.name: IndexByChannelTestCase
+ * @tc.desc: 1000 sockets in 50 session servers lookup by channel through the index Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: ClientGetSessionIdByChannelId normal operation
+ */
+static void IndexByChannelTestCase(benchmark::State &state)
+{
+    if (!BuildRegistry()) {
+        state.SkipWithError("IndexByChannelTestCase build registry failed.");
+        return;
+    }
+    int32_t index = 0;
+    while (state.KeepRunning()) {
+        int32_t channelType = (index % 2 == 0) ? CHANNEL_TYPE_UDP : CHANNEL_TYPE_TCP_DIRECT;
+        int32_t sessionId = INVALID_SESSION_ID;
+        if (ClientGetSessionIdByChannelId(CHANNEL_ID_BASE + index, channelType, &sessionId, false) != SOFTBUS_OK ||
+            sessionId != index + 1) {
+            state.SkipWithError("IndexByChannelTestCase failed.");
+            break;
+        }
+        index = (index + 1) % SOCKET_NUM;
+    }
+}
+BENCHMARK(IndexByChannelTestCase)->Iterations(LOOKUP_NUM);
+
+/**
+ * @tc.name: IndexBySessionIdTestCase
+ * @tc.desc: 1000 sockets in 50 session servers lookup by sessionId through the index Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: ClientGetSessionIsAsyncBySessionId normal operation
+ */
+static void IndexBySessionIdTestCase(benchmark::State &state)
+{
+    if (!BuildRegistry()) {
+        state.SkipWithError("IndexBySessionIdTestCase build registry failed.");
+        return;
+    }
+    int32_t index = 0;
+    while (state.KeepRunning()) {
+        bool isAsync = false;
+        if (ClientGetSessionIsAsyncBySessionId(index + 1, &isAsync) != SOFTBUS_OK) {
+            state.SkipWithError("IndexBySessionIdTestCase failed.");
+            break;
+        }
+        index = (index + 1) % SOCKET_NUM;
+    }
+}
+BENCHMARK(IndexBySessionIdTestCase)->Iterations(LOOKUP_NUM);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <securec.h>
+
+#include "client_trans_session_manager.c"
+#include "client_trans_socket_manager.c"
+
+namespace OHOS {
+static constexpr int32_t SERVER_NUM = 50;
+static constexpr int32_t SOCKET_NUM = 5000;
+static constexpr uint32_t MIN_IDLE_TIME = 60 * TIMER_TIMEOUT;
+static constexpr uint32_t IDLE_TIME_SPREAD = 600;
+// sockets with traffic in one tick, every socket sees traffic well within its idle time
+static constexpr int32_t ACTIVE_PER_TICK = 100;
+static constexpr int64_t TICK_NUM = 100000;
+
+/* the public api caps servers and sessions, build the registry directly to reach the target scale */
+static bool BuildRegistry()
+{
+    if (g_clientSessionServerList == nullptr && TransClientInit() != SOFTBUS_OK) {
+        return false;
+    }
+    if (g_clientSessionServerList->cnt == SERVER_NUM) {
+        return true;
+    }
+    ClientSessionServer *servers[SERVER_NUM] = { nullptr };
+    for (int32_t i = 0; i < SERVER_NUM; i++) {
+        servers[i] = static_cast<ClientSessionServer *>(SoftBusCalloc(sizeof(ClientSessionServer)));
+        if (servers[i] == nullptr) {
+            return false;
+        }
+        (void)sprintf_s(servers[i]->sessionName, sizeof(servers[i]->sessionName), "ohos.benchmark.session%d", i);
+        ListInit(&servers[i]->node);
+        ListInit(&servers[i]->sessionList);
+        ListAdd(&g_clientSessionServerList->list, &servers[i]->node);
+        g_clientSessionServerList->cnt++;
+    }
+    for (int32_t i = 0; i < SOCKET_NUM; i++) {
+        SessionInfo *session = static_cast<SessionInfo *>(SoftBusCalloc(sizeof(SessionInfo)));
+        if (session == nullptr) {
+            return false;
+        }
+        session->sessionId = i + 1;
+        session->role = SESSION_ROLE_CLIENT;
+        session->enableStatus = ENABLE_STATUS_SUCCESS;
+        session->maxIdleTime = MIN_IDLE_TIME + (uint32_t)(i % IDLE_TIME_SPREAD) * TIMER_TIMEOUT;
+        ClientSessionServer *server = servers[i % SERVER_NUM];
+        ListAdd(&server->sessionList, &session->node);
+        ClientIndexSession(server, session);
+    }
+    return true;
+}
+
+static void MakeTraffic(int32_t *next)
+{
+    for (int32_t i = 0; i < ACTIVE_PER_TICK; i++) {
+        (void)ClientResetIdleTimeoutById(*next + 1);
+        *next = (*next + 1) % SOCKET_NUM;
+    }
+}
+
+/* the tick before the timer wheel: visit every session of every server, registered last as it skips the wheel */
+static void WalkAllSessions(int32_t waitOutSocket[], uint32_t *waitOutNum, ListNode *destroyList)
+{
+    ClientSessionServer *serverNode = nullptr;
+    SessionInfo *sessionNode = nullptr;
+    SessionInfo *nextSessionNode = nullptr;
+    LIST_FOR_EACH_ENTRY(serverNode, &(g_clientSessionServerList->list), ClientSessionServer, node) {
+        LIST_FOR_EACH_ENTRY_SAFE(sessionNode, nextSessionNode, &(serverNode->sessionList), SessionInfo, node) {
+            ClientCheckWaitTimeOut(serverNode, sessionNode, waitOutSocket, MAX_SESSION_ID, waitOutNum);
+            ClientUpdateIdleTimeout(serverNode, sessionNode, destroyList);
+        }
+    }
+}
+
+/**
+ * @tc.name: WheelTickTestCase
+ * @tc.desc: 5000 idle sockets timeout tick through the timer wheel Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: ClientProcessSessionTimer normal operation
+ */
+static void WheelTickTestCase(benchmark::State &state)
+{
+    if (!BuildRegistry()) {
+        state.SkipWithError("WheelTickTestCase build registry failed.");
+        return;
+    }
+    int32_t next = 0;
+    while (state.KeepRunning()) {
+        MakeTraffic(&next);
+        int32_t waitOutSocket[MAX_SESSION_ID] = { 0 };
+        uint32_t waitOutNum = 0;
+        ListNode destroyList;
+        ListInit(&destroyList);
+        ClientProcessSessionTimer(waitOutSocket, MAX_SESSION_ID, &waitOutNum, &destroyList);
+        if (waitOutNum != 0 || !IsListEmpty(&destroyList)) {
+            state.SkipWithError("WheelTickTestCase unexpected timeout.");
+            break;
+        }
+    }
+}
+BENCHMARK(WheelTickTestCase)->Iterations(TICK_NUM);
+
+/**
+ * @tc.name: WalkTickTestCase
+ * @tc.desc: 5000 idle sockets timeout tick with a walk over all sessions Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: nested session list walk
+ */
+static void WalkTickTestCase(benchmark::State &state)
+{
+    if (!BuildRegistry()) {
+        state.SkipWithError("WalkTickTestCase build registry failed.");
+        return;
+    }
+    int32_t next = 0;
+    while (state.KeepRunning()) {
+        MakeTraffic(&next);
+        int32_t waitOutSocket[MAX_SESSION_ID] = { 0 };
+        uint32_t waitOutNum = 0;
+        ListNode destroyList;
+        ListInit(&destroyList);
+        g_sessionTick++;
+        WalkAllSessions(waitOutSocket, &waitOutNum, &destroyList);
+        if (waitOutNum != 0 || !IsListEmpty(&destroyList)) {
+            state.SkipWithError("WalkTickTestCase unexpected timeout.");
+            break;
+        }
+    }
+}
+BENCHMARK(WalkTickTestCase)->Iterations(TICK_NUM);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
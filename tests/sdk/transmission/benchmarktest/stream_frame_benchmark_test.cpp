@@ -0,0 +1,129 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include <benchmark/benchmark.h>
+#include <securec.h>
+
+#include "softbus_adapter_crypto.h"
+#include "stream_common_data.h"
+#include "stream_packetizer.h"
+
+#define private   public
+#define protected public
+#include "vtp_stream_socket.h"
+#undef protected
+#undef private
+
+namespace OHOS {
+// a 1080p key frame at a high bit rate, P frames are a fraction of it
+static constexpr ssize_t FRAME_1080P_LEN = 1920 * 1080 / 2;
+static constexpr ssize_t FRAME_EXT_LEN = 16;
+static constexpr uint32_t TEST_KEY_LEN = 32;
+static constexpr int32_t FRAME_HEADER_LEN = 4;
+
+static std::unique_ptr<Communication::SoftBus::IStream> MakeFrame(const char *payload)
+{
+    Communication::SoftBus::StreamData data = {
+        .buffer = std::make_unique<char[]>(FRAME_1080P_LEN),
+        .bufLen = FRAME_1080P_LEN,
+        .extBuffer = std::make_unique<char[]>(FRAME_EXT_LEN),
+        .extLen = FRAME_EXT_LEN,
+    };
+    (void)memcpy_s(data.buffer.get(), FRAME_1080P_LEN, payload, FRAME_1080P_LEN);
+    Communication::SoftBus::StreamFrameInfo frameInfo = { 0 };
+    return Communication::SoftBus::IStream::MakeCommonStream(data, frameInfo);
+}
+
+static std::shared_ptr<Communication::SoftBus::VtpStreamSocket> MakeSocket()
+{
+    auto socket = std::make_shared<Communication::SoftBus::VtpStreamSocket>();
+    socket->streamType_ = Communication::SoftBus::COMMON_VIDEO_STREAM;
+    socket->sessionKey_.second = TEST_KEY_LEN;
+    socket->sessionKey_.first = new uint8_t[TEST_KEY_LEN];
+    (void)memset_s(socket->sessionKey_.first, TEST_KEY_LEN, 1, TEST_KEY_LEN);
+    return socket;
+}
+
+/* the send path before the frame pool: a packet buffer and a cipher buffer for each frame */
+static bool EncryptByCopy(Communication::SoftBus::VtpStreamSocket &socket,
+    std::unique_ptr<Communication::SoftBus::IStream> stream, std::unique_ptr<char[]> &data, ssize_t &len)
+{
+    Communication::SoftBus::StreamPacketizer packet(socket.streamType_, std::move(stream));
+    auto plainData = packet.PacketizeStream();
+    if (plainData == nullptr) {
+        return false;
+    }
+    len = packet.GetPacketLen() + socket.GetEncryptOverhead();
+    data = std::make_unique<char[]>(len + FRAME_HEADER_LEN);
+    if (socket.Encrypt(plainData.get(), packet.GetPacketLen(), data.get() + FRAME_HEADER_LEN, len) != len) {
+        return false;
+    }
+    socket.InsertBufferLength(len, FRAME_HEADER_LEN, reinterpret_cast<uint8_t *>(data.get()));
+    len += FRAME_HEADER_LEN;
+    return true;
+}
+
+/**
+ * @tc.name: EncryptByCopyTestCase
+ * @tc.desc: 1080p frame packetize and encrypt with a new buffer per step Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: StreamPacketizer::PacketizeStream normal operation
+ */
+static void EncryptByCopyTestCase(benchmark::State &state)
+{
+    auto socket = MakeSocket();
+    auto payload = std::make_unique<char[]>(FRAME_1080P_LEN);
+    for (auto _ : state) {
+        std::unique_ptr<char[]> data = nullptr;
+        ssize_t len = 0;
+        if (!EncryptByCopy(*socket, MakeFrame(payload.get()), data, len)) {
+            state.SkipWithError("EncryptByCopyTestCase failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(data.get());
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * FRAME_1080P_LEN);
+}
+BENCHMARK(EncryptByCopyTestCase);
+
+/**
+ * @tc.name: EncryptInPlaceTestCase
+ * @tc.desc: 1080p frame packetize and encrypt in place in a pooled buffer Performance Testing
+ * @tc.type: FUNC
+ * @tc.require: VtpStreamSocket::EncryptStreamPacket normal operation
+ */
+static void EncryptInPlaceTestCase(benchmark::State &state)
+{
+    auto socket = MakeSocket();
+    auto payload = std::make_unique<char[]>(FRAME_1080P_LEN);
+    for (auto _ : state) {
+        Communication::SoftBus::StreamFrameBuffer frame;
+        ssize_t len = 0;
+        if (!socket->EncryptStreamPacket(MakeFrame(payload.get()), frame, len)) {
+            state.SkipWithError("EncryptInPlaceTestCase failed.");
+            break;
+        }
+        benchmark::DoNotOptimize(frame.data.get());
+        socket->framePool_.Release(std::move(frame));
+    }
+    state.SetItemsProcessed(state.iterations());
+    state.SetBytesProcessed(state.iterations() * FRAME_1080P_LEN);
+}
+BENCHMARK(EncryptInPlaceTestCase);
+} // namespace OHOS
+
+// Run the benchmark
+BENCHMARK_MAIN();
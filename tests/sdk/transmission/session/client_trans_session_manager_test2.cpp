@@ -1838,4 +1838,102 @@ HWTEST_F(TransClientSessionManagerTest, TransGetKeyTypeBySocketIdSuccessTest001,
     SoftBusFree(sessionParam);
     TransClientDeinit();
 }
+
+/*
+ * @tc.name: ClientSessionIndexTest001
+ * @tc.desc: test sessions are found by sessionId and by channel after add and not found after delete
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransClientSessionManagerTest, ClientSessionIndexTest001, TestSize.Level1)
+{
+    int32_t ret = TransClientInit();
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    uint64_t timestamp = 0;
+    ret = ClientAddSessionServer(SEC_TYPE_PLAINTEXT, g_pkgName, g_sessionName, &g_sessionlistener, &timestamp);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    SessionParam *sessionParam = reinterpret_cast<SessionParam *>(SoftBusCalloc(sizeof(SessionParam)));
+    ASSERT_TRUE(sessionParam != nullptr);
+    GenerateCommParam(sessionParam);
+    SessionInfo *session = GenerateSession(sessionParam);
+    ASSERT_TRUE(session != nullptr);
+    session->channelId = TRANS_TEST_CHANNEL_ID;
+    session->channelType = CHANNEL_TYPE_PROXY;
+    session->isAsync = true;
+    ret = ClientAddNewSession(g_sessionName, session);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    int32_t sessionId = session->sessionId;
+    bool isAsync = false;
+    ret = ClientGetSessionIsAsyncBySessionId(sessionId, &isAsync);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    EXPECT_TRUE(isAsync);
+    int32_t foundId = INVALID_SESSION_ID;
+    ret = ClientGetSessionIdByChannelId(TRANS_TEST_CHANNEL_ID, CHANNEL_TYPE_PROXY, &foundId, false);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    EXPECT_EQ(foundId, sessionId);
+    ret = ClientGetSessionIdByChannelId(TRANS_TEST_CHANNEL_ID, CHANNEL_TYPE_UDP, &foundId, false);
+    EXPECT_EQ(ret, SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND);
+    ret = ClientDeleteSession(sessionId);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    ret = ClientGetSessionIsAsyncBySessionId(sessionId, &isAsync);
+    EXPECT_EQ(ret, SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND);
+    ret = ClientGetSessionIdByChannelId(TRANS_TEST_CHANNEL_ID, CHANNEL_TYPE_PROXY, &foundId, false);
+    EXPECT_EQ(ret, SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND);
+    ret = ClientDeleteSessionServer(SEC_TYPE_PLAINTEXT, g_sessionName);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    SoftBusFree(sessionParam);
+    TransClientDeinit();
+}
+
+/*
+ * @tc.name: ClientSessionIndexTest002
+ * @tc.desc: test channel lookup follows the reserve channel and a channel moved to another session
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransClientSessionManagerTest, ClientSessionIndexTest002, TestSize.Level1)
+{
+    int32_t ret = TransClientInit();
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    uint64_t timestamp = 0;
+    ret = ClientAddSessionServer(SEC_TYPE_PLAINTEXT, g_pkgName, g_sessionName, &g_sessionlistener, &timestamp);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    SessionParam *sessionParam = reinterpret_cast<SessionParam *>(SoftBusCalloc(sizeof(SessionParam)));
+    ASSERT_TRUE(sessionParam != nullptr);
+    GenerateCommParam(sessionParam);
+    SessionInfo *first = GenerateSession(sessionParam);
+    ASSERT_TRUE(first != nullptr);
+    first->channelId = TRANS_TEST_CHANNEL_ID;
+    first->channelType = CHANNEL_TYPE_TCP_DIRECT;
+    first->channelIdReserve = TRANS_TEST_CHANNEL_ID + 1;
+    first->channelTypeReserve = CHANNEL_TYPE_UDP;
+    ret = ClientAddNewSession(g_sessionName, first);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    int32_t foundId = INVALID_SESSION_ID;
+    ret = ClientGetSessionIdByChannelId(TRANS_TEST_CHANNEL_ID + 1, CHANNEL_TYPE_UDP, &foundId, false);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    EXPECT_EQ(foundId, first->sessionId);
+    int32_t data = 0;
+    ret = GetEncryptByChannelId(TRANS_TEST_CHANNEL_ID + 1, CHANNEL_TYPE_UDP, &data);
+    EXPECT_EQ(ret, SOFTBUS_TRANS_SESSION_INFO_NOT_FOUND);
+
+    SessionInfo *second = GenerateSession(sessionParam);
+    ASSERT_TRUE(second != nullptr);
+    second->channelId = TRANS_TEST_CHANNEL_ID + 1;
+    second->channelType = CHANNEL_TYPE_UDP;
+    ret = ClientAddNewSession(g_sessionName, second);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    int32_t secondId = second->sessionId;
+    ret = ClientDeleteSession(first->sessionId);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    ret = ClientGetSessionIdByChannelId(TRANS_TEST_CHANNEL_ID + 1, CHANNEL_TYPE_UDP, &foundId, false);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    EXPECT_EQ(foundId, secondId);
+    ret = ClientDeleteSession(secondId);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    ret = ClientDeleteSessionServer(SEC_TYPE_PLAINTEXT, g_sessionName);
+    EXPECT_EQ(ret, SOFTBUS_OK);
+    SoftBusFree(sessionParam);
+    TransClientDeinit();
+}
 } // namespace OHOS
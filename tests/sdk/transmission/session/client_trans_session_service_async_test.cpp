@@ -0,0 +1,187 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gmock/gmock.h>
+#include <gtest/gtest.h>
+
+#include "client_trans_session_service.c"
+#include "softbus_error_code.h"
+
+using namespace testing;
+using namespace testing::ext;
+
+#define TRANS_TEST_SESSION_ID 10
+#define TRANS_TEST_CHANNEL_ID 12345
+
+namespace OHOS {
+const char *g_asyncSessionName = "ohos.distributedschedule.dms.async";
+const char *g_asyncNetworkId = "ABCDEF00ABCDEF00ABCDEF00ABCDEF00ABCDEF00ABCDEF00ABCDEF00ABCDEF0";
+const char *g_asyncGroupId = "TEST_GROUP_ID";
+
+class TransAsyncOpenInterface {
+public:
+    TransAsyncOpenInterface() {};
+    virtual ~TransAsyncOpenInterface() {};
+
+    virtual int32_t ClientAddSession(const SessionParam *param, int32_t *sessionId,
+        SessionEnableStatus *isEnabled) = 0;
+    virtual int32_t ServerIpcOpenSession(const SessionParam *param, TransInfo *info) = 0;
+    virtual int32_t ClientSetChannelBySessionId(int32_t sessionId, TransInfo *transInfo) = 0;
+    virtual int32_t ClientDeleteSession(int32_t sessionId) = 0;
+};
+
+class TransAsyncOpenMock : public TransAsyncOpenInterface {
+public:
+    TransAsyncOpenMock();
+    ~TransAsyncOpenMock() override;
+
+    MOCK_METHOD3(ClientAddSession, int32_t(const SessionParam *param, int32_t *sessionId,
+        SessionEnableStatus *isEnabled));
+    MOCK_METHOD2(ServerIpcOpenSession, int32_t(const SessionParam *param, TransInfo *info));
+    MOCK_METHOD2(ClientSetChannelBySessionId, int32_t(int32_t sessionId, TransInfo *transInfo));
+    MOCK_METHOD1(ClientDeleteSession, int32_t(int32_t sessionId));
+};
+
+static void *g_asyncOpenInterface = nullptr;
+
+TransAsyncOpenMock::TransAsyncOpenMock()
+{
+    g_asyncOpenInterface = reinterpret_cast<void *>(this);
+}
+
+TransAsyncOpenMock::~TransAsyncOpenMock()
+{
+    g_asyncOpenInterface = nullptr;
+}
+
+static TransAsyncOpenInterface *GetAsyncOpenInterface()
+{
+    return reinterpret_cast<TransAsyncOpenInterface *>(g_asyncOpenInterface);
+}
+
+extern "C" {
+int32_t ClientAddSession(const SessionParam *param, int32_t *sessionId, SessionEnableStatus *isEnabled)
+{
+    return GetAsyncOpenInterface()->ClientAddSession(param, sessionId, isEnabled);
+}
+
+int32_t ServerIpcOpenSession(const SessionParam *param, TransInfo *info)
+{
+    return GetAsyncOpenInterface()->ServerIpcOpenSession(param, info);
+}
+
+int32_t ClientSetChannelBySessionId(int32_t sessionId, TransInfo *transInfo)
+{
+    return GetAsyncOpenInterface()->ClientSetChannelBySessionId(sessionId, transInfo);
+}
+
+int32_t ClientDeleteSession(int32_t sessionId)
+{
+    return GetAsyncOpenInterface()->ClientDeleteSession(sessionId);
+}
+}
+
+class TransClientSessionServiceAsyncTest : public testing::Test {
+public:
+    TransClientSessionServiceAsyncTest()
+    {}
+    ~TransClientSessionServiceAsyncTest()
+    {}
+    static void SetUpTestCase(void)
+    {}
+    static void TearDownTestCase(void)
+    {}
+    void SetUp() override
+    {}
+    void TearDown() override
+    {}
+};
+
+static int32_t ActionOfClientAddSession(const SessionParam *param, int32_t *sessionId, SessionEnableStatus *isEnabled)
+{
+    (void)param;
+    (void)isEnabled;
+    *sessionId = TRANS_TEST_SESSION_ID;
+    return SOFTBUS_OK;
+}
+
+/**
+ * @tc.name: TransClientSessionServiceAsyncTest001
+ * @tc.desc: with the async open feature on, OpenSession asks the server for an async open and returns the
+ *           session id without a channel, leaving the session for the set channel info callback.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransClientSessionServiceAsyncTest, TransClientSessionServiceAsyncTest001, TestSize.Level1)
+{
+    NiceMock<TransAsyncOpenMock> mock;
+    bool isAsync = false;
+    EXPECT_CALL(mock, ClientAddSession).WillOnce(ActionOfClientAddSession);
+    EXPECT_CALL(mock, ServerIpcOpenSession).WillOnce([&isAsync](const SessionParam *param, TransInfo *info) {
+        isAsync = param->isAsync;
+        EXPECT_EQ(param->sessionId, TRANS_TEST_SESSION_ID);
+        EXPECT_EQ(info->channelId, INVALID_CHANNEL_ID);
+        return SOFTBUS_OK;
+    });
+    EXPECT_CALL(mock, ClientSetChannelBySessionId).Times(0);
+    EXPECT_CALL(mock, ClientDeleteSession).Times(0);
+
+    SessionAttribute attr = { .dataType = TYPE_BYTES };
+    int32_t ret = OpenSession(g_asyncSessionName, g_asyncSessionName, g_asyncNetworkId, g_asyncGroupId, &attr);
+    EXPECT_EQ(ret, TRANS_TEST_SESSION_ID);
+    EXPECT_TRUE(isAsync);
+}
+
+/**
+ * @tc.name: TransClientSessionServiceAsyncTest002
+ * @tc.desc: a failed async open request deletes the session added for it and returns the ipc error.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransClientSessionServiceAsyncTest, TransClientSessionServiceAsyncTest002, TestSize.Level1)
+{
+    NiceMock<TransAsyncOpenMock> mock;
+    EXPECT_CALL(mock, ClientAddSession).WillOnce(ActionOfClientAddSession);
+    EXPECT_CALL(mock, ServerIpcOpenSession).WillOnce(Return(SOFTBUS_TRANS_PROXY_SEND_REQUEST_FAILED));
+    EXPECT_CALL(mock, ClientDeleteSession(TRANS_TEST_SESSION_ID)).WillOnce(Return(SOFTBUS_OK));
+
+    SessionAttribute attr = { .dataType = TYPE_BYTES };
+    int32_t ret = OpenSession(g_asyncSessionName, g_asyncSessionName, g_asyncNetworkId, g_asyncGroupId, &attr);
+    EXPECT_EQ(ret, SOFTBUS_TRANS_PROXY_SEND_REQUEST_FAILED);
+}
+
+/**
+ * @tc.name: TransClientSessionServiceAsyncTest003
+ * @tc.desc: a server that still answers with a channel has it set on the session right away.
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransClientSessionServiceAsyncTest, TransClientSessionServiceAsyncTest003, TestSize.Level1)
+{
+    NiceMock<TransAsyncOpenMock> mock;
+    EXPECT_CALL(mock, ClientAddSession).WillOnce(ActionOfClientAddSession);
+    EXPECT_CALL(mock, ServerIpcOpenSession).WillOnce([](const SessionParam *param, TransInfo *info) {
+        (void)param;
+        info->channelId = TRANS_TEST_CHANNEL_ID;
+        info->channelType = CHANNEL_TYPE_PROXY;
+        return SOFTBUS_OK;
+    });
+    EXPECT_CALL(mock, ClientSetChannelBySessionId(TRANS_TEST_SESSION_ID, _)).WillOnce(Return(SOFTBUS_OK));
+    EXPECT_CALL(mock, ClientDeleteSession).Times(0);
+
+    SessionAttribute attr = { .dataType = TYPE_BYTES };
+    int32_t ret = OpenSession(g_asyncSessionName, g_asyncSessionName, g_asyncNetworkId, g_asyncGroupId, &attr);
+    EXPECT_EQ(ret, TRANS_TEST_SESSION_ID);
+}
+} // namespace OHOS
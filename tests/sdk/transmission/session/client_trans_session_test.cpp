@@ -1604,6 +1604,68 @@ HWTEST_F(TransClientSessionTest, ClientUpdateIdleTimeoutTest001, TestSize.Level1
     SoftBusFree(info);
 }
 
+/*
+ * @tc.name: ClientProcessSessionTimerTest001
+ * @tc.desc: test the timer wheel reports bind wait timeout and idle timeout on the expected tick
+ *           and a reset idle timer is pushed back
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(TransClientSessionTest, ClientProcessSessionTimerTest001, TestSize.Level1)
+{
+    SessionParam *sessionParam = reinterpret_cast<SessionParam*>(SoftBusCalloc(sizeof(SessionParam)));
+    ASSERT_TRUE(sessionParam != nullptr);
+    TestGenerateCommParam(sessionParam);
+    ClientSessionServer serverNode;
+    (void)memset_s(&serverNode, sizeof(ClientSessionServer), 0, sizeof(ClientSessionServer));
+    (void)strcpy_s(serverNode.sessionName, SESSION_NAME_SIZE_MAX, g_sessionName);
+    ListInit(&serverNode.node);
+    ListInit(&serverNode.sessionList);
+    SessionInfo *waitSession = TestGenerateSession(sessionParam);
+    ASSERT_TRUE(waitSession != nullptr);
+    waitSession->lifecycle.maxWaitTime = TIMER_TIMEOUT * 2;
+    ListAdd(&serverNode.sessionList, &waitSession->node);
+    ClientIndexSession(&serverNode, waitSession);
+    SessionInfo *idleSession = TestGenerateSession(sessionParam);
+    ASSERT_TRUE(idleSession != nullptr);
+    idleSession->sessionId = TRANS_TEST_SESSION_ID + 1;
+    idleSession->role = SESSION_ROLE_CLIENT;
+    idleSession->enableStatus = ENABLE_STATUS_SUCCESS;
+    idleSession->maxIdleTime = TIMER_TIMEOUT * 3;
+    ListAdd(&serverNode.sessionList, &idleSession->node);
+    ClientIndexSession(&serverNode, idleSession);
+
+    int32_t waitOutSocket[MAX_SESSION_ID] = { 0 };
+    uint32_t waitOutNum = 0;
+    ListNode destroyList;
+    ListInit(&destroyList);
+    ClientProcessSessionTimer(waitOutSocket, MAX_SESSION_ID, &waitOutNum, &destroyList);
+    ClientProcessSessionTimer(waitOutSocket, MAX_SESSION_ID, &waitOutNum, &destroyList);
+    EXPECT_EQ(waitOutNum, 0);
+    ClientRestartIdleTimer(idleSession);
+    ClientProcessSessionTimer(waitOutSocket, MAX_SESSION_ID, &waitOutNum, &destroyList);
+    EXPECT_EQ(waitOutNum, 1);
+    EXPECT_EQ(waitOutSocket[0], TRANS_TEST_SESSION_ID);
+    ClientProcessSessionTimer(waitOutSocket, MAX_SESSION_ID, &waitOutNum, &destroyList);
+    ClientProcessSessionTimer(waitOutSocket, MAX_SESSION_ID, &waitOutNum, &destroyList);
+    EXPECT_TRUE(IsListEmpty(&destroyList));
+    ClientProcessSessionTimer(waitOutSocket, MAX_SESSION_ID, &waitOutNum, &destroyList);
+    EXPECT_FALSE(IsListEmpty(&destroyList));
+    EXPECT_EQ(ClientFindSessionById(TRANS_TEST_SESSION_ID + 1, nullptr), nullptr);
+    EXPECT_EQ(waitOutNum, 1);
+
+    DestroySessionInfo *destroyNode = nullptr;
+    DestroySessionInfo *destroyNodeNext = nullptr;
+    LIST_FOR_EACH_ENTRY_SAFE(destroyNode, destroyNodeNext, &destroyList, DestroySessionInfo, node) {
+        ListDelete(&destroyNode->node);
+        SoftBusFree(destroyNode);
+    }
+    ListDelete(&waitSession->node);
+    ClientUnindexSession(waitSession);
+    SoftBusFree(waitSession);
+    SoftBusFree(sessionParam);
+}
+
 /*
  * @tc.name: PrivilegeDestroyAllClientSessionTest001
  * @tc.desc: test PrivilegeDestroyAllClientSession given null params
@@ -0,0 +1,106 @@
+/*
+ * Copyright (c) 2026 Huawei Device Co., Ltd.
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS,
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+#include <gtest/gtest.h>
+#include <vector>
+
+#include "stream_frame_buffer_pool.h"
+
+using namespace testing::ext;
+using namespace Communication;
+using namespace SoftBus;
+namespace OHOS {
+static constexpr size_t SMALL_FRAME_LEN = 1000;
+static constexpr size_t LARGE_FRAME_LEN = 100 * 1024;
+
+class StreamFrameBufferPoolTest : public testing::Test {
+public:
+    StreamFrameBufferPoolTest() { }
+    ~StreamFrameBufferPoolTest() { }
+    static void SetUpTestCase(void) { }
+    static void TearDownTestCase(void) { }
+    void SetUp() override { }
+    void TearDown() override { }
+};
+
+/*
+ * @tc.name: AcquireTest001
+ * @tc.desc: test Acquire
+ *           a released buffer is reused by the next frame that fits in it
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamFrameBufferPoolTest, AcquireTest001, TestSize.Level1)
+{
+    StreamFrameBufferPool pool;
+    StreamFrameBuffer buffer = pool.Acquire(0);
+    EXPECT_EQ(buffer.data, nullptr);
+
+    buffer = pool.Acquire(SMALL_FRAME_LEN);
+    ASSERT_NE(buffer.data, nullptr);
+    EXPECT_GE(buffer.capacity, SMALL_FRAME_LEN);
+    char *addr = buffer.data.get();
+    pool.Release(std::move(buffer));
+    EXPECT_EQ(pool.GetPooledNum(), 1);
+
+    buffer = pool.Acquire(SMALL_FRAME_LEN + 1);
+    EXPECT_EQ(buffer.data.get(), addr);
+    EXPECT_EQ(pool.GetPooledNum(), 0);
+
+    StreamFrameBuffer large = pool.Acquire(LARGE_FRAME_LEN);
+    ASSERT_NE(large.data, nullptr);
+    EXPECT_NE(large.data.get(), addr);
+    pool.Release(std::move(buffer));
+    pool.Release(std::move(large));
+    EXPECT_EQ(pool.GetPooledNum(), 2);
+
+    buffer = pool.Acquire(SMALL_FRAME_LEN);
+    EXPECT_EQ(buffer.data.get(), addr);
+    pool.Clear();
+    EXPECT_EQ(pool.GetPooledNum(), 0);
+}
+
+/*
+ * @tc.name: ReleaseTest001
+ * @tc.desc: test Release
+ *           the pool keeps at most MAX_POOLED_NUM buffers, preferring larger ones, and no oversize buffer
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamFrameBufferPoolTest, ReleaseTest001, TestSize.Level1)
+{
+    StreamFrameBufferPool pool;
+    pool.Release(StreamFrameBuffer());
+    pool.Release(pool.Acquire(StreamFrameBufferPool::MAX_POOLED_SIZE + 1));
+    EXPECT_EQ(pool.GetPooledNum(), 0);
+
+    for (size_t i = 0; i < StreamFrameBufferPool::MAX_POOLED_NUM; i++) {
+        pool.Release(pool.Acquire(SMALL_FRAME_LEN));
+    }
+    EXPECT_EQ(pool.GetPooledNum(), 1);
+
+    std::vector<StreamFrameBuffer> buffers;
+    for (size_t i = 0; i < StreamFrameBufferPool::MAX_POOLED_NUM; i++) {
+        buffers.push_back(pool.Acquire(SMALL_FRAME_LEN));
+    }
+    StreamFrameBuffer large = pool.Acquire(LARGE_FRAME_LEN);
+    char *addr = large.data.get();
+    for (auto &buffer : buffers) {
+        pool.Release(std::move(buffer));
+    }
+    pool.Release(std::move(large));
+    EXPECT_EQ(pool.GetPooledNum(), StreamFrameBufferPool::MAX_POOLED_NUM);
+    EXPECT_EQ(pool.Acquire(LARGE_FRAME_LEN).data.get(), addr);
+}
+} // namespace OHOS
@@ -100,4 +100,51 @@ HWTEST_F(StreamPacketizerTest, PacketizeStreamTest001, TestSize.Level1)
     auto pdata = streamPacketizer.PacketizeStream();
     EXPECT_NE(pdata, nullptr);
 }
+
+static std::unique_ptr<IStream> MakeTestStream(ssize_t dataLen, ssize_t extLen)
+{
+    StreamData data = {
+        .buffer = std::make_unique<char[]>(dataLen),
+        .bufLen = dataLen,
+        .extBuffer = std::make_unique<char[]>(extLen),
+        .extLen = extLen,
+    };
+    (void)memset_s(data.buffer.get(), dataLen, 'a', dataLen);
+    (void)memset_s(data.extBuffer.get(), extLen, 'b', extLen);
+    StreamFrameInfo frameInfo = {
+        .streamId = 0,
+        .seqNum = 1,
+        .level = 1,
+        .frameType = FrameType::RADIO_MAX,
+        .seqSubNum = 1,
+        .bitMap = 1,
+        .bitrate = 0,
+    };
+    return IStream::MakeCommonStream(data, frameInfo);
+}
+
+/*
+ * @tc.name: PacketizeStreamTest002
+ * @tc.desc: test PacketizeStream into a caller buffer
+ *           the packet is the same as the one allocated by PacketizeStream
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(StreamPacketizerTest, PacketizeStreamTest002, TestSize.Level1)
+{
+    const ssize_t dataLen = 1024;
+    const ssize_t extLen = 8;
+    StreamPacketizer allocPacketizer(COMMON_VIDEO_STREAM, MakeTestStream(dataLen, extLen));
+    auto expected = allocPacketizer.PacketizeStream();
+    ASSERT_NE(expected, nullptr);
+    ssize_t packetLen = allocPacketizer.GetPacketLen();
+
+    StreamPacketizer streamPacketizer(COMMON_VIDEO_STREAM, MakeTestStream(dataLen, extLen));
+    EXPECT_EQ(streamPacketizer.CalculatePacketLen(), packetLen);
+    auto packet = std::make_unique<char[]>(packetLen);
+    EXPECT_FALSE(streamPacketizer.PacketizeStream(nullptr, packetLen));
+    EXPECT_FALSE(streamPacketizer.PacketizeStream(packet.get(), packetLen - 1));
+    EXPECT_TRUE(streamPacketizer.PacketizeStream(packet.get(), packetLen));
+    EXPECT_EQ(memcmp(expected.get(), packet.get(), packetLen), 0);
+}
 } // namespace OHOS
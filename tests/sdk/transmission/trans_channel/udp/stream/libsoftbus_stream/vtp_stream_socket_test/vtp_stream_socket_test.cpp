@@ -1500,4 +1500,52 @@ HWTEST_F(VtpStreamSocketTest, CreateClientProcessThread001, TestSize.Level1)
     SoftBusStreamTestInterfaceMock streamMock;
     EXPECT_NO_FATAL_FAILURE(vtpStreamSocket->CreateClientProcessThread());
 }
+
+/*
+ * @tc.name: EncryptStreamPacket001
+ * @tc.desc: EncryptStreamPacket test, the frame encrypted in place decrypts to the packetized stream
+ *           and its buffer is reused by the next frame
+ * @tc.type: FUNC
+ * @tc.require:
+ */
+HWTEST_F(VtpStreamSocketTest, EncryptStreamPacket001, TestSize.Level1)
+{
+    std::shared_ptr<Communication::SoftBus::VtpStreamSocket> vtpStreamSocket =
+        std::make_shared<Communication::SoftBus::VtpStreamSocket>();
+    uint8_t key[SESSION_KEY_LENGTH] = { 0 };
+    vtpStreamSocket->sessionKey_.first = new uint8_t[SESSION_KEY_LENGTH];
+    vtpStreamSocket->sessionKey_.second = SESSION_KEY_LENGTH;
+    (void)memcpy_s(vtpStreamSocket->sessionKey_.first, SESSION_KEY_LENGTH, key, SESSION_KEY_LENGTH);
+    vtpStreamSocket->streamType_ = Communication::SoftBus::COMMON_VIDEO_STREAM;
+
+    auto makeStream = []() {
+        Communication::SoftBus::StreamData data = {
+            .buffer = std::make_unique<char[]>(STREAM_DATA_LENGTH),
+            .bufLen = STREAM_DATA_LENGTH,
+            .extBuffer = nullptr,
+            .extLen = 0,
+        };
+        (void)memset_s(data.buffer.get(), STREAM_DATA_LENGTH, 'a', STREAM_DATA_LENGTH);
+        return IStream::MakeCommonStream(data, frameInfo);
+    };
+    StreamPacketizer packetizer(Communication::SoftBus::COMMON_VIDEO_STREAM, makeStream());
+    auto expected = packetizer.PacketizeStream();
+    ASSERT_NE(expected, nullptr);
+    ssize_t packetLen = packetizer.GetPacketLen();
+
+    Communication::SoftBus::StreamFrameBuffer frame;
+    ssize_t len = 0;
+    ASSERT_TRUE(vtpStreamSocket->EncryptStreamPacket(makeStream(), frame, len));
+    ASSERT_EQ(len, packetLen + OVERHEAD_LEN + FRAME_HEADER_LEN);
+    auto plain = std::make_unique<char[]>(packetLen);
+    ssize_t plainLen = vtpStreamSocket->Decrypt(frame.data.get() + FRAME_HEADER_LEN, len - FRAME_HEADER_LEN,
+        plain.get(), packetLen);
+    EXPECT_EQ(plainLen, packetLen);
+    EXPECT_EQ(memcmp(plain.get(), expected.get(), packetLen), 0);
+
+    char *addr = frame.data.get();
+    vtpStreamSocket->framePool_.Release(std::move(frame));
+    ASSERT_TRUE(vtpStreamSocket->EncryptStreamPacket(makeStream(), frame, len));
+    EXPECT_EQ(frame.data.get(), addr);
+}
 } // OHOS